@@ -0,0 +1,395 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "BootNotification20.h"
+#include "JsonValidator.h"
+#include "LockFreeQueue.h"
+#include "MessagesConverter20.h"
+#include "Queue.h"
+#include "Timer.h"
+#include "TimerPool.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <experimental/filesystem>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ocpp::helpers;
+using namespace ocpp::json;
+using namespace ocpp::messages::ocpp20;
+using namespace ocpp::types::ocpp20;
+
+/** @brief Default path to the OCPP 2.0.1 schemas */
+#ifndef BENCH_SCHEMAS_DIR
+#define BENCH_SCHEMAS_DIR "schemas/ocpp20"
+#endif
+
+/** @brief Run a function on multiple threads and get the number of operations per second */
+template <typename Function>
+static double runThreads(size_t threads, size_t iterations, Function function)
+{
+    std::vector<std::thread> workers;
+    auto                     start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < threads; i++)
+    {
+        workers.emplace_back([&function, iterations] { function(iterations); });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(threads * iterations) / duration.count();
+}
+
+/** @brief JSON schema validation of the OCPP 2.0.1 requests */
+static void benchValidator(const std::string& schemas_dir)
+{
+    namespace fs = std::experimental::filesystem;
+
+    // Validators of all the requests
+    std::vector<std::unique_ptr<JsonValidator>> validators;
+    std::error_code                             error_code;
+    for (const auto& entry : fs::directory_iterator(schemas_dir, error_code))
+    {
+        std::string name = entry.path().filename().string();
+        if (name.find("Request.json") != std::string::npos)
+        {
+            std::unique_ptr<JsonValidator> validator(new JsonValidator());
+            if (validator->init(entry.path().string()))
+            {
+                validators.push_back(std::move(validator));
+            }
+        }
+    }
+    if (validators.empty())
+    {
+        std::cout << "validator : no schema found in " << schemas_dir << std::endl;
+        return;
+    }
+
+    // Valid payloads of the high volume requests
+    static const std::vector<std::pair<std::string, std::string>> payloads = {
+        {"Heartbeat", "{}"},
+        {"StatusNotification", R"({"timestamp":"2024-01-01T00:00:00Z","connectorStatus":"Available","evseId":1,"connectorId":1})"},
+        {"Authorize", R"({"idToken":{"idToken":"0123456789","type":"ISO14443"}})"},
+        {"MeterValues",
+         R"({"evseId":1,"meterValue":[{"timestamp":"2024-01-01T00:00:00Z","sampledValue":[{"value":1234.5,)"
+         R"("measurand":"Energy.Active.Import.Register","unitOfMeasure":{"unit":"Wh"}},{"value":7.2,"measurand":"Power.Active.Import"}]}]})"},
+        {"TransactionEvent",
+         R"({"eventType":"Updated","timestamp":"2024-01-01T00:00:00Z","triggerReason":"MeterValuePeriodic","seqNo":3,)"
+         R"("transactionInfo":{"transactionId":"TX0001","chargingState":"Charging"},"evse":{"id":1,"connectorId":1},)"
+         R"("meterValue":[{"timestamp":"2024-01-01T00:00:00Z","sampledValue":[{"value":1234.5}]}]})"}};
+    std::vector<std::unique_ptr<JsonValidator>> hot_validators;
+    std::vector<rapidjson::Document>            hot_documents;
+    for (const auto& payload : payloads)
+    {
+        std::unique_ptr<JsonValidator> validator(new JsonValidator());
+        if (validator->init(schemas_dir + "/" + payload.first + "Request.json"))
+        {
+            hot_validators.push_back(std::move(validator));
+            hot_documents.emplace_back();
+            hot_documents.back().Parse(payload.second.c_str());
+        }
+    }
+    rapidjson::Document empty;
+    empty.SetObject();
+
+    for (size_t threads : {1u, 4u})
+    {
+        // Valid payloads
+        std::atomic<size_t> invalid(0);
+        double              hot_rate = runThreads(threads,
+                                     50000u,
+                                     [&](size_t iterations)
+                                     {
+                                         std::string error;
+                                         for (size_t i = 0; i < iterations; i++)
+                                         {
+                                             size_t index = i % hot_validators.size();
+                                             if (!hot_validators[index]->isValid(hot_documents[index], error))
+                                             {
+                                                 invalid++;
+                                             }
+                                         }
+                                     });
+
+        // Empty payload against all the schemas, mostly rejected on the required properties
+        double all_rate = runThreads(threads,
+                                     50000u,
+                                     [&](size_t iterations)
+                                     {
+                                         std::string error;
+                                         for (size_t i = 0; i < iterations; i++)
+                                         {
+                                             validators[i % validators.size()]->isValid(empty, error);
+                                         }
+                                     });
+
+        std::cout << "validator : " << threads << " thread(s), " << static_cast<uint64_t>(hot_rate) << " validations/s on "
+                  << hot_validators.size() << " high volume requests (" << invalid << " invalid), " << static_cast<uint64_t>(all_rate)
+                  << " validations/s on " << validators.size() << " request schemas" << std::endl;
+    }
+}
+
+/** @brief Number of allocations done through the global operator new */
+static std::atomic<size_t> s_allocations(0);
+
+/** @brief Global operator new counting the allocations (not inlined so that the compiler doesn't pair malloc with delete) */
+__attribute__((noinline)) void* operator new(size_t size)
+{
+    s_allocations.fetch_add(1u, std::memory_order_relaxed);
+    void* ptr = std::malloc(size ? size : 1u);
+    if (!ptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+/** @brief Global operator delete matching the counting operator new */
+__attribute__((noinline)) void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+/** @brief Global sized operator delete matching the counting operator new */
+__attribute__((noinline)) void operator delete(void* ptr, size_t size) noexcept
+{
+    (void)size;
+    std::free(ptr);
+}
+
+/** @brief Get the number of allocations done by a function for each call */
+template <typename Function>
+static double allocationsPerCall(size_t iterations, Function function)
+{
+    size_t start = s_allocations.load();
+    function(iterations);
+    return static_cast<double>(s_allocations.load() - start) / static_cast<double>(iterations);
+}
+
+/** @brief Request and response conversions of the BootNotification call() path */
+static void benchConverter()
+{
+    MessagesConverter20 converters;
+
+    BootNotificationReq request;
+    request.reason = BootReasonEnumType::PowerUp;
+    request.chargingStation.model.assign("Model");
+    request.chargingStation.vendorName.assign("Vendor");
+
+    rapidjson::Document response;
+    response.Parse(R"({"currentTime":"2024-01-01T00:00:00Z","interval":300,"status":"Accepted"})");
+
+    // Shared stateless converters, as used by GenericMessageSender::call()
+    auto shared = [&](size_t iterations)
+    {
+        std::string error_code;
+        std::string error_message;
+        for (size_t i = 0; i < iterations; i++)
+        {
+            auto req_converter  = converters.getRequestConverter<BootNotificationReq>(BOOTNOTIFICATION_ACTION);
+            auto resp_converter = converters.getResponseConverter<BootNotificationConf>(BOOTNOTIFICATION_ACTION);
+
+            rapidjson::Document payload(rapidjson::kObjectType);
+            req_converter->toJson(request, payload, payload.GetAllocator());
+            BootNotificationConf conf;
+            resp_converter->fromJson(response, conf, error_code, error_message);
+        }
+    };
+
+    // Same registry lookups followed by a converter allocated for each message, as done by the former clone() per call
+    auto cloned = [&](size_t iterations)
+    {
+        std::string error_code;
+        std::string error_message;
+        for (size_t i = 0; i < iterations; i++)
+        {
+            if (converters.getRequestConverter<BootNotificationReq>(BOOTNOTIFICATION_ACTION) &&
+                converters.getResponseConverter<BootNotificationConf>(BOOTNOTIFICATION_ACTION))
+            {
+                std::unique_ptr<BootNotificationReqConverter>  req_converter(new BootNotificationReqConverter());
+                std::unique_ptr<BootNotificationConfConverter> resp_converter(new BootNotificationConfConverter());
+
+                rapidjson::Document payload(rapidjson::kObjectType);
+                req_converter->toJson(request, payload, payload.GetAllocator());
+                BootNotificationConf conf;
+                resp_converter->fromJson(response, conf, error_code, error_message);
+            }
+        }
+    };
+
+    std::cout << "converter : " << allocationsPerCall(1000u, shared) << " allocations/call with shared converters, "
+              << allocationsPerCall(1000u, cloned) << " allocations/call with a converter allocated per call" << std::endl;
+    for (size_t threads : {1u, 4u})
+    {
+        double shared_rate = runThreads(threads, 200000u, shared);
+        double cloned_rate = runThreads(threads, 200000u, cloned);
+        std::cout << "converter : " << threads << " thread(s), " << static_cast<uint64_t>(shared_rate)
+                  << " calls/s with shared converters, " << static_cast<uint64_t>(cloned_rate)
+                  << " calls/s with a converter allocated per call" << std::endl;
+    }
+}
+
+/** @brief Transfer of items from multiple producers to a single consumer */
+template <typename QueueType>
+static double queueTransfer(size_t producers, size_t items)
+{
+    QueueType           queue;
+    std::atomic<size_t> received(0);
+    std::thread         consumer(
+        [&queue, &received, producers, items]
+        {
+            size_t item = 0;
+            while ((received < (producers * items)) && queue.pop(item, 1000u))
+            {
+                received++;
+            }
+        });
+    double rate = runThreads(producers,
+                             items,
+                             [&queue](size_t iterations)
+                             {
+                                 for (size_t i = 0; i < iterations; i++)
+                                 {
+                                     // Bounded queues : retry while full
+                                     while (!queue.push(i))
+                                     {
+                                         std::this_thread::yield();
+                                     }
+                                 }
+                             });
+    consumer.join();
+    return rate;
+}
+
+/** @brief Mutex based queue against lock-free queue */
+static void benchQueue()
+{
+    for (size_t producers : {1u, 4u, 16u})
+    {
+        size_t items       = 2000000u / producers;
+        double mutex_rate  = queueTransfer<Queue<size_t, 1024u>>(producers, items);
+        double atomic_rate = queueTransfer<LockFreeQueue<size_t, 1024u>>(producers, items);
+        std::cout << "queue : " << producers << " producer(s), " << static_cast<uint64_t>(mutex_rate) << " items/s with Queue, "
+                  << static_cast<uint64_t>(atomic_rate) << " items/s with LockFreeQueue" << std::endl;
+    }
+}
+
+/** @brief Start, stop and expiry of a large number of timers */
+static void benchTimers()
+{
+    static constexpr size_t TIMERS_COUNT = 100000u;
+
+    TimerPool                           pool;
+    std::vector<std::unique_ptr<Timer>> timers;
+    std::atomic<size_t>                 fired(0);
+    for (size_t i = 0; i < TIMERS_COUNT; i++)
+    {
+        std::string name = "timer" + std::to_string(i);
+        timers.emplace_back(new Timer(pool, name.c_str()));
+        timers.back()->setCallback([&fired] { fired++; });
+    }
+
+    // Periodic timers far in the future, in random order
+    std::mt19937                       random(42u);
+    std::uniform_int_distribution<int> intervals(60000, 3600000);
+    auto                               start = std::chrono::steady_clock::now();
+    for (auto& timer : timers)
+    {
+        timer->start(std::chrono::milliseconds(intervals(random)));
+    }
+    std::chrono::duration<double> start_duration = std::chrono::steady_clock::now() - start;
+
+    // Restart of all the active timers
+    start = std::chrono::steady_clock::now();
+    for (auto& timer : timers)
+    {
+        timer->restart(std::chrono::milliseconds(intervals(random)));
+    }
+    std::chrono::duration<double> restart_duration = std::chrono::steady_clock::now() - start;
+
+    // Lookup by name
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < 10000u; i++)
+    {
+        pool.getTimer("timer" + std::to_string((i * 7919u) % TIMERS_COUNT));
+    }
+    std::chrono::duration<double> lookup_duration = std::chrono::steady_clock::now() - start;
+
+    // Expiry of all the timers within the same 100ms
+    for (auto& timer : timers)
+    {
+        timer->stop();
+    }
+    for (auto& timer : timers)
+    {
+        timer->start(std::chrono::milliseconds(100), true);
+    }
+    start = std::chrono::steady_clock::now();
+    while ((fired < TIMERS_COUNT) && ((std::chrono::steady_clock::now() - start) < std::chrono::seconds(30)))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::chrono::duration<double> expiry_duration = std::chrono::steady_clock::now() - start;
+
+    std::cout << "timers : " << TIMERS_COUNT << " timers, " << static_cast<uint64_t>(TIMERS_COUNT / start_duration.count())
+              << " starts/s, " << static_cast<uint64_t>(TIMERS_COUNT / restart_duration.count()) << " restarts/s, "
+              << static_cast<uint64_t>(10000u / lookup_duration.count()) << " lookups/s, " << fired << " expired in "
+              << static_cast<uint64_t>(expiry_duration.count() * 1000.) << "ms (100ms interval)" << std::endl;
+
+    for (auto& timer : timers)
+    {
+        timer->stop();
+    }
+}
+
+/** @brief Entry point */
+int main(int argc, char* argv[])
+{
+    // ocpp_bench [validator|converter|queue|timers] [schemas directory]
+    std::string bench       = (argc > 1) ? argv[1] : "all";
+    std::string schemas_dir = (argc > 2) ? argv[2] : BENCH_SCHEMAS_DIR;
+
+    if ((bench == "all") || (bench == "validator"))
+    {
+        benchValidator(schemas_dir);
+    }
+    if ((bench == "all") || (bench == "converter"))
+    {
+        benchConverter();
+    }
+    if ((bench == "all") || (bench == "queue"))
+    {
+        benchQueue();
+    }
+    if ((bench == "all") || (bench == "timers"))
+    {
+        benchTimers();
+    }
+
+    return 0;
+}
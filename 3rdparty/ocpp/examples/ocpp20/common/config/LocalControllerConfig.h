@@ -73,6 +73,28 @@ class LocalControllerConfig : public ocpp::config::ILocalControllerConfig20
     std::string tlsServerCertificateCa() const override { return getString("TlsServerCertificateCa"); }
     /** @brief Enable client authentication using certificate */
     bool tlsClientCertificateAuthent() const override { return getBool("TlsClientCertificateAuthent"); }
+    /** @brief Number of threads servicing the websocket connections (0 = 1 thread) */
+    unsigned int webSocketServiceThreadsCount() const override { return get<unsigned int>("WebSocketServiceThreadsCount"); }
+    /** @brief Maximum number of messages waiting to be sent on a websocket connection (0 = default) */
+    unsigned int webSocketSendQueueMaxMessages() const override { return get<unsigned int>("WebSocketSendQueueMaxMessages"); }
+    /** @brief Maximum number of bytes waiting to be sent on a websocket connection (0 = no limit) */
+    unsigned int webSocketSendQueueMaxBytes() const override { return get<unsigned int>("WebSocketSendQueueMaxBytes"); }
+    /** @brief Enable the negotiation of the permessage-deflate compression on the websocket connections */
+    bool webSocketCompression() const override { return getBool("WebSocketCompression"); }
+    /** @brief Only accept the compression if the server resets its compression context after each message */
+    bool webSocketCompressionServerNoContextTakeover() const override { return getBool("WebSocketCompressionServerNoContextTakeover"); }
+    /** @brief Only accept the compression if the client resets its compression context after each message */
+    bool webSocketCompressionClientNoContextTakeover() const override { return getBool("WebSocketCompressionClientNoContextTakeover"); }
+    /** @brief Size in bits of the server's compression window requested by the outgoing connections */
+    unsigned int webSocketCompressionServerMaxWindowBits() const override
+    {
+        return get<unsigned int>("WebSocketCompressionServerMaxWindowBits");
+    }
+    /** @brief Size in bits of the client's compression window requested by the outgoing connections */
+    unsigned int webSocketCompressionClientMaxWindowBits() const override
+    {
+        return get<unsigned int>("WebSocketCompressionClientMaxWindowBits");
+    }
     /** @brief Client certificate */
     std::string tlsClientCertificate() const { return getString("TlsClientCertificate"); }
     /** @brief Client certificate's private key */
@@ -92,6 +114,9 @@ class LocalControllerConfig : public ocpp::config::ILocalControllerConfig20
     {
         return get<unsigned int>("IncomingRequestsFromCpThreadPoolSize");
     };
+    /** @brief Size of the thread pool running the timer callbacks and the asynchronous jobs
+     *         (0 = number of CPU cores, at least 2) */
+    unsigned int workerThreadPoolSize() const override { return get<unsigned int>("WorkerThreadPoolSize"); }
     /** @brief Size of the thread pool to handle incoming requests from the Central System */
     unsigned int incomingRequestsFromCsThreadPoolSize() const override
     {
@@ -99,6 +124,8 @@ class LocalControllerConfig : public ocpp::config::ILocalControllerConfig20
     };
     /** @brief Disconnect from Charge Point on Central System disconnection */
     bool disconnectFromCpWhenCsDisconnected() const override { return getBool("DisconnectFromCpWhenCsDisconnected"); }
+    /** @brief Enable the negotiation of the permessage-deflate compression on the connections to the Central System */
+    bool centralSystemWebSocketCompression() const override { return getBool("CentralSystemWebSocketCompression"); }
 
   private:
     /** @brief Configuration file */
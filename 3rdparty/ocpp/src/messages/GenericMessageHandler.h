@@ -63,13 +63,33 @@ class GenericMessageHandler : public IMessageDispatcher::IMessageHandler
         if (m_request_converter->fromJson(payload, request, error_code, error_message))
         {
             // Handle message
-            ResponseType resp;
-            if (handleMessage(request, resp, error_code, error_message))
-            {
-                // Convert response
-                m_response_converter->setAllocator(&response.GetAllocator());
-                ret = m_response_converter->toJson(resp, response);
-            }
+            ret = handleRequest(request, response, error_code, error_message);
+        }
+
+        return ret;
+    }
+
+    /** @copydoc bool IMessageHandler::handle(const std::string&
+                                              ocpp::json::JsonReader&
+                                              rapidjson::Document&
+                                              std::string&
+                                              std::string&) */
+    bool handle(const std::string&      action,
+                ocpp::json::JsonReader& payload,
+                rapidjson::Document&    response,
+                std::string&            error_code,
+                std::string&            error_message) override
+    {
+        bool ret = false;
+        // Ignore action
+        (void)action;
+
+        // Convert request while reading it
+        RequestType request;
+        if (m_request_converter->fromJson(payload, request, error_code, error_message))
+        {
+            // Handle message
+            ret = handleRequest(request, response, error_code, error_message);
         }
 
         return ret;
@@ -86,8 +106,26 @@ class GenericMessageHandler : public IMessageDispatcher::IMessageHandler
     virtual bool handleMessage(const RequestType& request, ResponseType& response, std::string& error_code, std::string& error_message) = 0;
 
   private:
-    std::unique_ptr<IMessageConverter<RequestType>>  m_request_converter;
-    std::unique_ptr<IMessageConverter<ResponseType>> m_response_converter;
+    /** @brief Request converter (shared, not owned) */
+    const IMessageConverter<RequestType>* m_request_converter;
+    /** @brief Response converter (shared, not owned) */
+    const IMessageConverter<ResponseType>* m_response_converter;
+
+    /** @brief Handle a converted request and convert its response */
+    bool handleRequest(const RequestType& request, rapidjson::Document& response, std::string& error_code, std::string& error_message)
+    {
+        bool ret = false;
+
+        // Handle message
+        ResponseType resp;
+        if (handleMessage(request, resp, error_code, error_message))
+        {
+            // Convert response
+            ret = m_response_converter->toJson(resp, response, response.GetAllocator());
+        }
+
+        return ret;
+    }
 };
 
 } // namespace messages
@@ -26,6 +26,9 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "IRpc.h"
 #include "Logger.h"
 
+#include <functional>
+#include <memory>
+
 namespace ocpp
 {
 namespace messages
@@ -140,8 +143,7 @@ class GenericMessageSender
         {
             // Convert request
             rapidjson::Document payload(rapidjson::kObjectType);
-            req_converter->setAllocator(&payload.GetAllocator());
-            if (req_converter->toJson(request, payload))
+            if (req_converter->toJson(request, payload, payload.GetAllocator()))
             {
                 // Check if request_fifo is empty
                 if (!request_fifo || request_fifo->empty())
@@ -156,14 +158,13 @@ class GenericMessageSender
                         {
                             // Validate response
                             ocpp::json::JsonValidator* validator = m_messages_validator.getValidator(action, false);
-                            if (validator)
+                            if (validator || m_messages_validator.isSchemaValidationOptional())
                             {
-                                if (validator->isValid(resp))
+                                std::string error_code;
+                                std::string error_message;
+                                if (m_messages_validator.isValid(validator, resp, error_message))
                                 {
                                     // Convert response
-                                    std::string error_code;
-                                    std::string error_message;
-                                    resp_converter->setAllocator(&rpc_frame.GetAllocator());
                                     if (resp_converter->fromJson(resp, response, error_code, error_message))
                                     {
                                         ret = CallResult::Ok;
@@ -171,7 +172,7 @@ class GenericMessageSender
                                 }
                                 else
                                 {
-                                    LOG_ERROR << "[" << action << "] - Invalid response : " << validator->lastError();
+                                    LOG_ERROR << "[" << action << "] - Invalid response : " << error_message;
                                 }
                             }
                         }
@@ -202,6 +203,93 @@ class GenericMessageSender
         return ret;
     }
 
+    /**
+     * @brief Execute an asynchronous call request
+     * @param action RPC action for the request
+     * @param request Request payload
+     * @param handler Handler to call with the result of the request (See CallResult documentation),
+     *                the response payload and the error and error message (Empty if not a CallError)
+     * @return true if the request has been sent, false otherwise
+     */
+    template <typename RequestType, typename ResponseType>
+    bool callAsync(const std::string&                                                                           action,
+                   const RequestType&                                                                           request,
+                   std::function<void(CallResult, const ResponseType&, const std::string&, const std::string&)> handler)
+    {
+        bool ret = false;
+
+        // Get converters
+        auto req_converter  = m_messages_converter.getRequestConverter<RequestType>(action);
+        auto resp_converter = m_messages_converter.getResponseConverter<ResponseType>(action);
+        if (req_converter && resp_converter)
+        {
+            // Convert request
+            rapidjson::Document payload(rapidjson::kObjectType);
+            if (req_converter->toJson(request, payload, payload.GetAllocator()))
+            {
+                // Response processing must not rely on the sender and its validators which may have been destroyed in the meantime
+                // => the response validator is shared with the completion handler
+                std::shared_ptr<ocpp::json::JsonValidator> validator           = m_messages_validator.getSharedValidator(action, false);
+                bool                                       validation_optional = m_messages_validator.isSchemaValidationOptional();
+                ocpp::rpc::IRpc::CallCompletionHandler     completion_handler =
+                    [action, resp_converter, validator, validation_optional, handler](bool                 received,
+                                                                                      rapidjson::Document& rpc_frame,
+                                                                                      rapidjson::Value&    resp,
+                                                                                      const std::string&   error,
+                                                                                      const std::string&   message)
+                {
+                    (void)rpc_frame;
+
+                    CallResult   result = CallResult::Failed;
+                    ResponseType response;
+                    std::string  error_message;
+                    if (received)
+                    {
+                        // Check error
+                        if (error.empty())
+                        {
+                            // Validate response
+                            if (validator || validation_optional)
+                            {
+                                std::string error_code;
+                                if (IMessagesValidator::isValid(validator.get(), resp, error_message))
+                                {
+                                    // Convert response
+                                    if (resp_converter->fromJson(resp, response, error_code, error_message))
+                                    {
+                                        result = CallResult::Ok;
+                                    }
+                                }
+                                else
+                                {
+                                    LOG_ERROR << "[" << action << "] - Invalid response : " << error_message;
+                                }
+                            }
+                        }
+                        else
+                        {
+                            result = CallResult::Error;
+                        }
+                    }
+                    if (received && (result == CallResult::Failed))
+                    {
+                        // Response received but rejected
+                        handler(result, response, ocpp::rpc::IRpc::RPC_FAILURE_INVALID_RESPONSE, error_message);
+                    }
+                    else
+                    {
+                        handler(result, response, error, message);
+                    }
+                };
+
+                // Execute call
+                ret = m_rpc.callAsync(action, payload, completion_handler, m_timeout);
+            }
+        }
+
+        return ret;
+    }
+
     /**
      * @brief Execute a call request on a JSON request
      * @param action RPC action for the request
@@ -230,14 +318,13 @@ class GenericMessageSender
                 {
                     // Validate response
                     ocpp::json::JsonValidator* validator = m_messages_validator.getValidator(action, false);
-                    if (validator)
+                    if (validator || m_messages_validator.isSchemaValidationOptional())
                     {
-                        if (validator->isValid(resp))
+                        std::string error_code;
+                        std::string error_message;
+                        if (m_messages_validator.isValid(validator, resp, error_message))
                         {
                             // Convert response
-                            std::string error_code;
-                            std::string error_message;
-                            resp_converter->setAllocator(&rpc_frame.GetAllocator());
                             if (resp_converter->fromJson(resp, response, error_code, error_message))
                             {
                                 ret = CallResult::Ok;
@@ -245,7 +332,7 @@ class GenericMessageSender
                         }
                         else
                         {
-                            LOG_ERROR << "[" << action << "] - Invalid response : " << validator->lastError();
+                            LOG_ERROR << "[" << action << "] - Invalid response : " << error_message;
                         }
                     }
                 }
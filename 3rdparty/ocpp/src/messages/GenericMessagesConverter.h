@@ -19,7 +19,6 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #ifndef OPENOCPP_GENERICMESSAGESCONVERTER_H
 #define OPENOCPP_GENERICMESSAGESCONVERTER_H
 
-#include <memory>
 #include <string>
 #include <unordered_map>
 
@@ -40,34 +39,36 @@ class GenericMessagesConverter
 
     /**
      * @brief Get the converter for a request
+     *        (converters are stateless and can be used concurrently by any thread)
      * @param action Ocpp call action corresponding to the request
      * @return Pointer to the message converter for the request or nullptr if the converter doesn't exists
      */
     template <typename RequestType>
-    std::unique_ptr<IMessageConverter<RequestType>> getRequestConverter(const std::string& action) const
+    const IMessageConverter<RequestType>* getRequestConverter(const std::string& action) const
     {
-        std::unique_ptr<IMessageConverter<RequestType>> ret;
-        auto                                            it = m_req_converters.find(action);
+        const IMessageConverter<RequestType>* ret = nullptr;
+        auto                                  it  = m_req_converters.find(action);
         if (it != m_req_converters.end())
         {
-            ret.reset(reinterpret_cast<IMessageConverter<RequestType>*>(it->second)->clone());
+            ret = reinterpret_cast<const IMessageConverter<RequestType>*>(it->second);
         }
         return ret;
     }
 
     /**
      * @brief Get the converter for a response
+     *        (converters are stateless and can be used concurrently by any thread)
      * @param action Ocpp call action corresponding to the response
      * @return Pointer to the message converter for the response or nullptr if the converter doesn't exists
      */
     template <typename ResponseType>
-    std::unique_ptr<IMessageConverter<ResponseType>> getResponseConverter(const std::string& action) const
+    const IMessageConverter<ResponseType>* getResponseConverter(const std::string& action) const
     {
-        std::unique_ptr<IMessageConverter<ResponseType>> ret;
-        auto                                             it = m_resp_converters.find(action);
+        const IMessageConverter<ResponseType>* ret = nullptr;
+        auto                                   it  = m_resp_converters.find(action);
         if (it != m_resp_converters.end())
         {
-            ret.reset(reinterpret_cast<IMessageConverter<ResponseType>*>(it->second)->clone());
+            ret = reinterpret_cast<const IMessageConverter<ResponseType>*>(it->second);
         }
         return ret;
     }
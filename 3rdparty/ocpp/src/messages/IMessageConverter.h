@@ -21,9 +21,13 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include "CiStringType.h"
 #include "DateTime.h"
+#include "EnumToStringFromString.h"
 #include "IMessageDispatcher.h"
+#include "JsonReader.h"
 #include "Optional.h"
 
+#include <limits>
+
 namespace ocpp
 {
 namespace messages
@@ -38,38 +42,50 @@ class IMessageConverter
     virtual ~IMessageConverter() { }
 
     /**
-     * Clone a message converter instance
-     * @return Cloned message converter instance
+     * @brief Convert a JSON object to a C++ data type
+     * @param json JSON object to convert
+     * @param data C++ data type to fill
+     * @param error_code Error code in case of invalid input
+     * @param error_message Error message in case of invalid input
+     * @return true the object has been converted, false otherwise
      */
-    virtual IMessageConverter* clone() const = 0;
+    virtual bool fromJson(const rapidjson::Value& json, DataType& data, std::string& error_code, std::string& error_message) const = 0;
 
     /**
-     * @brief Convert a JSON object to a C++ data type
-     * @param json JSON object to convert
+     * @brief Convert a JSON object read from a stream to a C++ data type
+     *        (default implementation builds a DOM of the object and converts it,
+     *         converters of the high volume messages read the stream directly)
+     * @param reader JSON reader positioned on the start of the object to convert
      * @param data C++ data type to fill
      * @param error_code Error code in case of invalid input
      * @param error_message Error message in case of invalid input
      * @return true the object has been converted, false otherwise
      */
-    virtual bool fromJson(const rapidjson::Value& json, DataType& data, std::string& error_code, std::string& error_message) = 0;
+    virtual bool fromJson(ocpp::json::JsonReader& reader, DataType& data, std::string& error_code, std::string& error_message) const
+    {
+        rapidjson::Document json;
+        return reader.parse(json) && fromJson(json, data, error_code, error_message);
+    }
 
     /**
      * @brief Convert a C++ data type to a JSON object
      * @param data C++ data type to convert
      * @param json JSON object to fill
+     * @param allocator Allocator of the JSON document the object belongs to
      * @return true the object has been converted, false otherwise
      */
-    virtual bool toJson(const DataType& data, rapidjson::Document& json) = 0;
+    virtual bool toJson(const DataType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const = 0;
 
     /**
      * @brief Helper function to fill an integer value in a JSON object
      * @param json JSON object to fill
      * @param field Name of the field to fill
      * @param value Integer value to fill
+     * @param allocator Allocator of the JSON document
      */
-    void fill(rapidjson::Value& json, const char* name, const int value)
+    void fill(rapidjson::Value& json, const char* name, const int value, rapidjson::Document::AllocatorType& allocator) const
     {
-        json.AddMember(rapidjson::StringRef(name), rapidjson::Value(value), *allocator);
+        json.AddMember(rapidjson::StringRef(name), rapidjson::Value(value), allocator);
     }
 
     /**
@@ -77,10 +93,11 @@ class IMessageConverter
      * @param json JSON object to fill
      * @param field Name of the field to fill
      * @param value Unsigned integer value to fill
+     * @param allocator Allocator of the JSON document
      */
-    void fill(rapidjson::Value& json, const char* name, const unsigned int value)
+    void fill(rapidjson::Value& json, const char* name, const unsigned int value, rapidjson::Document::AllocatorType& allocator) const
     {
-        json.AddMember(rapidjson::StringRef(name), rapidjson::Value(value), *allocator);
+        json.AddMember(rapidjson::StringRef(name), rapidjson::Value(value), allocator);
     }
 
     /**
@@ -88,10 +105,11 @@ class IMessageConverter
      * @param json JSON object to fill
      * @param field Name of the field to fill
      * @param value Floating point value to fill
+     * @param allocator Allocator of the JSON document
      */
-    void fill(rapidjson::Value& json, const char* name, const float value)
+    void fill(rapidjson::Value& json, const char* name, const float value, rapidjson::Document::AllocatorType& allocator) const
     {
-        json.AddMember(rapidjson::StringRef(name), rapidjson::Value(value), *allocator);
+        json.AddMember(rapidjson::StringRef(name), rapidjson::Value(value), allocator);
     }
 
     /**
@@ -99,10 +117,11 @@ class IMessageConverter
      * @param json JSON object to fill
      * @param field Name of the field to fill
      * @param value Floating point value to fill
+     * @param allocator Allocator of the JSON document
      */
-    void fill(rapidjson::Value& json, const char* name, const double value)
+    void fill(rapidjson::Value& json, const char* name, const double value, rapidjson::Document::AllocatorType& allocator) const
     {
-        json.AddMember(rapidjson::StringRef(name), rapidjson::Value(value), *allocator);
+        json.AddMember(rapidjson::StringRef(name), rapidjson::Value(value), allocator);
     }
 
     /**
@@ -110,10 +129,11 @@ class IMessageConverter
      * @param json JSON object to fill
      * @param field Name of the field to fill
      * @param value String value to fill
+     * @param allocator Allocator of the JSON document
      */
-    void fill(rapidjson::Value& json, const char* name, const std::string& value)
+    void fill(rapidjson::Value& json, const char* name, const std::string& value, rapidjson::Document::AllocatorType& allocator) const
     {
-        json.AddMember(rapidjson::StringRef(name), rapidjson::Value(value.c_str(), *allocator).Move(), *allocator);
+        json.AddMember(rapidjson::StringRef(name), rapidjson::Value(value.c_str(), allocator).Move(), allocator);
     }
 
     /**
@@ -121,18 +141,26 @@ class IMessageConverter
      * @param json JSON object to fill
      * @param field Name of the field to fill
      * @param value Date and time value to fill
+     * @param allocator Allocator of the JSON document
      */
-    void fill(rapidjson::Value& json, const char* name, const ocpp::types::DateTime& value) { fill(json, name, value.str()); }
+    void fill(rapidjson::Value&                   json,
+              const char*                         name,
+              const ocpp::types::DateTime&        value,
+              rapidjson::Document::AllocatorType& allocator) const
+    {
+        fill(json, name, value.str(), allocator);
+    }
 
     /**
      * @brief Helper function to fill a boolean value in a JSON object
      * @param json JSON object to fill
      * @param field Name of the field to fill
      * @param value Boolean value to fill
+     * @param allocator Allocator of the JSON document
      */
-    void fill(rapidjson::Value& json, const char* name, const bool value)
+    void fill(rapidjson::Value& json, const char* name, const bool value, rapidjson::Document::AllocatorType& allocator) const
     {
-        json.AddMember(rapidjson::StringRef(name), rapidjson::Value(value), *allocator);
+        json.AddMember(rapidjson::StringRef(name), rapidjson::Value(value), allocator);
     }
 
     /**
@@ -140,13 +168,17 @@ class IMessageConverter
      * @param json JSON object to fill
      * @param field Name of the field to fill
      * @param value Optional value to fill
+     * @param allocator Allocator of the JSON document
      */
     template <typename T>
-    void fill(rapidjson::Value& json, const char* name, const ocpp::types::Optional<T>& value)
+    void fill(rapidjson::Value&                   json,
+              const char*                         name,
+              const ocpp::types::Optional<T>&     value,
+              rapidjson::Document::AllocatorType& allocator) const
     {
         if (value.isSet())
         {
-            fill(json, name, value.value());
+            fill(json, name, value.value(), allocator);
         }
     }
 
@@ -156,24 +188,143 @@ class IMessageConverter
      * @param field Name of the field to extract
      * @param value Integer value extracted
      */
-    void extract(const rapidjson::Value& json, const char* name, int& value) { value = json[name].GetInt(); }
+    void extract(const rapidjson::Value& json, const char* name, int& value) const { value = json[name].GetInt(); }
+
+    /**
+     * @brief Helper function to extract a floating point value from a JSON object
+     * @param json JSON object
+     * @param field Name of the field to extract
+     * @param value Floating point value extracted
+     */
+    void extract(const rapidjson::Value& json, const char* name, float& value) const { value = json[name].GetFloat(); }
+
+    /**
+     * @brief Helper function to extract a string value from a JSON object
+     * @param json JSON object
+     * @param field Name of the field to extract
+     * @param value String value extracted
+     */
+    void extract(const rapidjson::Value& json, const char* name, std::string& value) const { value = json[name].GetString(); }
+
+    /**
+     * @brief Helper function to extract a size limited string value from a JSON object
+     * @param json JSON object
+     * @param field Name of the field to extract
+     * @param value Size limited string value extracted
+     */
+    void extract(const rapidjson::Value& json, const char* name, ocpp::types::ICiStringType& value) const
+    {
+        value.assign(json[name].GetString());
+    }
+
+    /**
+     * @brief Helper function to extract a boolean value from a JSON object
+     * @param json JSON object
+     * @param field Name of the field to extract
+     * @param value Boolean value extracted
+     */
+    void extract(const rapidjson::Value& json, const char* name, bool& value) const { value = json[name].GetBool(); }
 
     /**
-     * @brief Helper function to extract an unsigned integer value from a JSON object
+     * @brief Helper function to extract an optional value from a JSON object
      * @param json JSON object
      * @param field Name of the field to extract
-     * @param value Unsigned integer value extracted
+     * @param value Optional value extracted
+     */
+    template <typename T>
+    void extract(const rapidjson::Value& json, const char* name, ocpp::types::Optional<T>& value) const
+    {
+        if (json.HasMember(name))
+        {
+            extract(json, name, value.value());
+        }
+    }
+
+    /**
+     * @brief Helper function to check that a member of a JSON object is an array with a valid number of items
+     * @param json JSON object
+     * @param name Name of the array to check
+     * @param is_required Indicate if the array must be present in the JSON object
+     * @param min_items Minimum number of items in the array
+     * @param max_items Maximum number of items in the array (0 = no limit)
+     * @param error_message Error message to fill
+     * @return true if the array is valid or if it is not present and not required, false otherwise
+     */
+    bool checkArray(const rapidjson::Value& json,
+                    const char*             name,
+                    bool                    is_required,
+                    size_t                  min_items,
+                    size_t                  max_items,
+                    std::string&            error_message) const
+    {
+        bool ret  = !is_required;
+        auto iter = json.FindMember(name);
+        if (iter != json.MemberEnd())
+        {
+            const rapidjson::Value& val = iter->value;
+            ret                         = val.IsArray();
+            if (ret)
+            {
+                ret = (val.Size() >= min_items) && ((max_items == 0) || (val.Size() <= max_items));
+                if (!ret)
+                {
+                    error_message = name;
+                    error_message += " parameter has an invalid number of items";
+                }
+            }
+            else
+            {
+                error_message = name;
+                error_message += " parameter is not an array";
+            }
+        }
+        else if (is_required)
+        {
+            error_message = name;
+            error_message += " parameter is missing";
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Helper function to convert an integer JSON value
+     * @param json JSON value
+     * @param name Name of the value
+     * @param value Integer value converted
      * @param error_message Error message to fill
-     * @return true if the value is an unsigned integer, false otherwise
+     * @return true if the JSON value is an integer, false otherwise
      */
-    bool extract(const rapidjson::Value& json, const char* name, unsigned int& value, std::string& error_message)
+    template <typename JsonValue>
+    bool convert(const JsonValue& json, const char* name, int& value, std::string& error_message) const
     {
-        bool                    ret = false;
-        const rapidjson::Value& val = json[name];
-        if (val.GetInt() >= 0)
+        bool ret = json.IsInt();
+        if (ret)
         {
-            value = val.GetUint();
-            ret   = true;
+            value = json.GetInt();
+        }
+        else
+        {
+            error_message = name;
+            error_message += " parameter is not an integer";
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Helper function to convert an unsigned integer JSON value
+     * @param json JSON value
+     * @param name Name of the value
+     * @param value Unsigned integer value converted
+     * @param error_message Error message to fill
+     * @return true if the JSON value is an unsigned integer, false otherwise
+     */
+    template <typename JsonValue>
+    bool convert(const JsonValue& json, const char* name, unsigned int& value, std::string& error_message) const
+    {
+        bool ret = json.IsUint();
+        if (ret)
+        {
+            value = json.GetUint();
         }
         else
         {
@@ -184,47 +335,137 @@ class IMessageConverter
     }
 
     /**
-     * @brief Helper function to extract a floating point value from a JSON object
-     * @param json JSON object
-     * @param field Name of the field to extract
-     * @param value Floating point value extracted
+     * @brief Helper function to convert a floating point JSON value
+     * @param json JSON value
+     * @param name Name of the value
+     * @param value Floating point value converted
+     * @param error_message Error message to fill
+     * @return true if the JSON value is a number, false otherwise
      */
-    void extract(const rapidjson::Value& json, const char* name, float& value) { value = json[name].GetFloat(); }
+    template <typename JsonValue>
+    bool convert(const JsonValue& json, const char* name, float& value, std::string& error_message) const
+    {
+        bool ret = json.IsNumber();
+        if (ret)
+        {
+            value = json.GetFloat();
+        }
+        else
+        {
+            error_message = name;
+            error_message += " parameter is not a number";
+        }
+        return ret;
+    }
 
     /**
-     * @brief Helper function to extract a string value from a JSON object
-     * @param json JSON object
-     * @param field Name of the field to extract
-     * @param value String value extracted
+     * @brief Helper function to convert a boolean JSON value
+     * @param json JSON value
+     * @param name Name of the value
+     * @param value Boolean value converted
+     * @param error_message Error message to fill
+     * @return true if the JSON value is a boolean, false otherwise
      */
-    void extract(const rapidjson::Value& json, const char* name, std::string& value) { value = json[name].GetString(); }
+    template <typename JsonValue>
+    bool convert(const JsonValue& json, const char* name, bool& value, std::string& error_message) const
+    {
+        bool ret = json.IsBool();
+        if (ret)
+        {
+            value = json.GetBool();
+        }
+        else
+        {
+            error_message = name;
+            error_message += " parameter is not a boolean";
+        }
+        return ret;
+    }
 
     /**
-     * @brief Helper function to extract a size limited string value from a JSON object
-     * @param json JSON object
-     * @param field Name of the field to extract
-     * @param value Size limited string value extracted
+     * @brief Helper function to convert a string JSON value
+     * @param json JSON value
+     * @param name Name of the value
+     * @param value String value converted
+     * @param error_message Error message to fill
+     * @return true if the JSON value is a string, false otherwise
      */
-    void extract(const rapidjson::Value& json, const char* name, ocpp::types::ICiStringType& value)
+    template <typename JsonValue>
+    bool convert(const JsonValue& json, const char* name, std::string& value, std::string& error_message) const
     {
-        value.assign(json[name].GetString());
+        bool ret = json.IsString();
+        if (ret)
+        {
+            value.assign(json.GetString(), json.GetStringLength());
+        }
+        else
+        {
+            error_message = name;
+            error_message += " parameter is not a string";
+        }
+        return ret;
     }
 
     /**
-     * @brief Helper function to extract a date and time value from a JSON object
-     * @param json JSON object
-     * @param field Name of the field to extract
-     * @param value Date and time value extracted
+     * @brief Helper function to convert a size limited string JSON value
+     * @param json JSON value
+     * @param name Name of the value
+     * @param value Size limited string value converted
+     * @param error_message Error message to fill
+     * @return true if the JSON value is a string which respects the size limit, false otherwise
+     */
+    template <typename JsonValue>
+    bool convert(const JsonValue& json, const char* name, ocpp::types::ICiStringType& value, std::string& error_message) const
+    {
+        bool ret = json.IsString();
+        if (ret)
+        {
+            // Size limit is expressed in characters as in the JSON schemas
+            const char* str    = json.GetString();
+            size_t      length = 0;
+            for (rapidjson::SizeType i = 0; i < json.GetStringLength(); i++)
+            {
+                if ((static_cast<unsigned char>(str[i]) & 0xC0u) != 0x80u)
+                {
+                    length++;
+                }
+            }
+            ret = (length <= value.max());
+            if (ret)
+            {
+                value.assign(std::string(str, json.GetStringLength()));
+            }
+            else
+            {
+                error_message = name;
+                error_message += " parameter exceeds the maximum length of ";
+                error_message += std::to_string(value.max());
+                error_message += " characters";
+            }
+        }
+        else
+        {
+            error_message = name;
+            error_message += " parameter is not a string";
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Helper function to convert a date and time JSON value
+     * @param json JSON value
+     * @param name Name of the value
+     * @param value Date and time value converted
      * @param error_message Error message to fill
-     * @return true if the value is a date and time, false otherwise
+     * @return true if the JSON value is a date and time, false otherwise
      */
-    bool extract(const rapidjson::Value& json, const char* name, ocpp::types::DateTime& value, std::string& error_message)
+    template <typename JsonValue>
+    bool convert(const JsonValue& json, const char* name, ocpp::types::DateTime& value, std::string& error_message) const
     {
-        bool                    ret = false;
-        const rapidjson::Value& val = json[name];
-        if (val.IsString())
+        bool ret = false;
+        if (json.IsString())
         {
-            ret = value.assign(val.GetString());
+            ret = value.assign(json.GetString());
         }
         if (!ret)
         {
@@ -235,52 +476,382 @@ class IMessageConverter
     }
 
     /**
-     * @brief Helper function to extract a boolean value from a JSON object
+     * @brief Helper function to convert a bounded numeric JSON value
+     * @param json JSON value
+     * @param name Name of the value
+     * @param value Numeric value converted
+     * @param min Minimum allowed value
+     * @param max Maximum allowed value
+     * @param error_message Error message to fill
+     * @return true if the JSON value is a number within the bounds, false otherwise
+     */
+    template <typename JsonValue, typename T>
+    bool convert(const JsonValue& json, const char* name, T& value, T min, T max, std::string& error_message) const
+    {
+        bool ret = convert(json, name, value, error_message);
+        if (ret && ((value < min) || (value > max)))
+        {
+            ret           = false;
+            error_message = name;
+            error_message += " parameter is out of range";
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Helper function to convert an enum JSON value
+     * @param json JSON value
+     * @param name Name of the value
+     * @param value Enum value converted
+     * @param helper Helper to convert the enum from its string representation
+     * @param error_message Error message to fill
+     * @return true if the JSON value is a string representing one of the enum values, false otherwise
+     */
+    template <typename JsonValue, typename EnumType>
+    bool convert(const JsonValue&                                     json,
+                 const char*                                          name,
+                 EnumType&                                            value,
+                 const ocpp::types::EnumToStringFromString<EnumType>& helper,
+                 std::string&                                         error_message) const
+    {
+        bool ret = json.IsString() && helper.fromString(json.GetString(), value);
+        if (!ret)
+        {
+            error_message = name;
+            error_message += " parameter is not a valid enum value";
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Helper function to convert an object JSON value
+     * @param json JSON value
+     * @param name Name of the value
+     * @param value Object value converted
+     * @param converter Converter to use for the object
+     * @param error_code Error code to fill
+     * @param error_message Error message to fill
+     * @return true if the JSON value is a valid object, false otherwise
+     */
+    template <typename T>
+    bool convert(const rapidjson::Value&     json,
+                 const char*                 name,
+                 T&                          value,
+                 const IMessageConverter<T>& converter,
+                 std::string&                error_code,
+                 std::string&                error_message) const
+    {
+        bool ret = json.IsObject();
+        if (ret)
+        {
+            ret = converter.fromJson(json, value, error_code, error_message);
+        }
+        else
+        {
+            error_message = name;
+            error_message += " parameter is not an object";
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Helper function to convert an object read from a JSON stream
+     * @param reader JSON reader positioned on the value
+     * @param name Name of the value
+     * @param value Object value converted
+     * @param converter Converter to use for the object
+     * @param error_code Error code to fill
+     * @param error_message Error message to fill
+     * @return true if the JSON value is a valid object, false otherwise
+     */
+    template <typename T>
+    bool convert(ocpp::json::JsonReader&     reader,
+                 const char*                 name,
+                 T&                          value,
+                 const IMessageConverter<T>& converter,
+                 std::string&                error_code,
+                 std::string&                error_message) const
+    {
+        bool ret = reader.IsObject();
+        if (ret)
+        {
+            ret = converter.fromJson(reader, value, error_code, error_message);
+        }
+        else
+        {
+            error_message = name;
+            error_message += " parameter is not an object";
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Helper function to check that the value read from a JSON stream is an array
+     * @param reader JSON reader positioned on the value
+     * @param name Name of the value
+     * @param error_message Error message to fill
+     * @return true if the value is an array, false otherwise
+     */
+    bool checkArray(const ocpp::json::JsonReader& reader, const char* name, std::string& error_message) const
+    {
+        bool ret = reader.IsArray();
+        if (!ret)
+        {
+            error_message = name;
+            error_message += " parameter is not an array";
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Helper function to check the number of items of an array read from a JSON stream
+     * @param name Name of the array
+     * @param count Number of items read
+     * @param min_items Minimum number of items in the array
+     * @param max_items Maximum number of items in the array (0 = no limit)
+     * @param error_message Error message to fill
+     * @return true if the number of items is valid, false otherwise
+     */
+    bool checkItems(const char* name, size_t count, size_t min_items, size_t max_items, std::string& error_message) const
+    {
+        bool ret = (count >= min_items) && ((max_items == 0) || (count <= max_items));
+        if (!ret)
+        {
+            error_message = name;
+            error_message += " parameter has an invalid number of items";
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Helper function to check that a mandatory member has been read from a JSON stream
+     * @param name Name of the member
+     * @param is_present Indicate if the member has been read
+     * @param error_message Error message to fill
+     * @return true if the member has been read, false otherwise
+     */
+    bool checkRequired(const char* name, bool is_present, std::string& error_message) const
+    {
+        if (!is_present)
+        {
+            error_message = name;
+            error_message += " parameter is missing";
+        }
+        return is_present;
+    }
+
+    /**
+     * @brief Helper function to extract a mandatory value from a JSON object
      * @param json JSON object
-     * @param field Name of the field to extract
-     * @param value Boolean value extracted
+     * @param name Name of the value to extract
+     * @param value Value extracted
+     * @param error_message Error message to fill
+     * @return true if the value is present and valid, false otherwise
      */
-    void extract(const rapidjson::Value& json, const char* name, bool& value) { value = json[name].GetBool(); }
+    template <typename T>
+    bool extract(const rapidjson::Value& json, const char* name, T& value, std::string& error_message) const
+    {
+        auto iter = json.FindMember(name);
+        bool ret  = (iter != json.MemberEnd());
+        if (ret)
+        {
+            ret = convert(iter->value, name, value, error_message);
+        }
+        else
+        {
+            error_message = name;
+            error_message += " parameter is missing";
+        }
+        return ret;
+    }
 
     /**
      * @brief Helper function to extract an optional value from a JSON object
      * @param json JSON object
-     * @param field Name of the field to extract
+     * @param name Name of the value to extract
      * @param value Optional value extracted
+     * @param error_message Error message to fill
+     * @return true if the value is not present or is valid, false otherwise
      */
     template <typename T>
-    void extract(const rapidjson::Value& json, const char* name, ocpp::types::Optional<T>& value)
+    bool extract(const rapidjson::Value& json, const char* name, ocpp::types::Optional<T>& value, std::string& error_message) const
     {
-        if (json.HasMember(name))
+        bool ret  = true;
+        auto iter = json.FindMember(name);
+        if (iter != json.MemberEnd())
         {
-            extract(json, name, value.value());
+            ret = convert(iter->value, name, value.value(), error_message);
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Helper function to extract a mandatory bounded numeric value from a JSON object
+     * @param json JSON object
+     * @param name Name of the value to extract
+     * @param value Numeric value extracted
+     * @param min Minimum allowed value
+     * @param max Maximum allowed value
+     * @param error_message Error message to fill
+     * @return true if the value is present and valid, false otherwise
+     */
+    template <typename T>
+    bool extract(const rapidjson::Value& json, const char* name, T& value, T min, T max, std::string& error_message) const
+    {
+        auto iter = json.FindMember(name);
+        bool ret  = (iter != json.MemberEnd());
+        if (ret)
+        {
+            ret = convert(iter->value, name, value, min, max, error_message);
         }
+        else
+        {
+            error_message = name;
+            error_message += " parameter is missing";
+        }
+        return ret;
     }
 
     /**
-     * @brief Helper function to extract an optional value from a JSON object
+     * @brief Helper function to extract an optional bounded numeric value from a JSON object
      * @param json JSON object
-     * @param field Name of the field to extract
-     * @param value Optional value extracted
+     * @param name Name of the value to extract
+     * @param value Optional numeric value extracted
+     * @param min Minimum allowed value
+     * @param max Maximum allowed value
      * @param error_message Error message to fill
      * @return true if the value is not present or is valid, false otherwise
      */
     template <typename T>
-    bool extract(const rapidjson::Value& json, const char* name, ocpp::types::Optional<T>& value, std::string& error_message)
+    bool extract(const rapidjson::Value&   json,
+                 const char*               name,
+                 ocpp::types::Optional<T>& value,
+                 T                         min,
+                 T                         max,
+                 std::string&              error_message) const
     {
-        bool ret = true;
-        if (json.HasMember(name))
+        bool ret  = true;
+        auto iter = json.FindMember(name);
+        if (iter != json.MemberEnd())
         {
-            ret = extract(json, name, value.value(), error_message);
+            ret = convert(iter->value, name, value.value(), min, max, error_message);
         }
         return ret;
     }
 
-    /** @brief Set the allocator to use */
-    void setAllocator(RAPIDJSON_DEFAULT_ALLOCATOR* _allocator) { allocator = _allocator; }
+    /**
+     * @brief Helper function to extract a mandatory enum value from a JSON object
+     * @param json JSON object
+     * @param name Name of the value to extract
+     * @param value Enum value extracted
+     * @param helper Helper to convert the enum from its string representation
+     * @param error_message Error message to fill
+     * @return true if the value is present and valid, false otherwise
+     */
+    template <typename EnumType>
+    bool extract(const rapidjson::Value&                              json,
+                 const char*                                          name,
+                 EnumType&                                            value,
+                 const ocpp::types::EnumToStringFromString<EnumType>& helper,
+                 std::string&                                         error_message) const
+    {
+        auto iter = json.FindMember(name);
+        bool ret  = (iter != json.MemberEnd());
+        if (ret)
+        {
+            ret = convert(iter->value, name, value, helper, error_message);
+        }
+        else
+        {
+            error_message = name;
+            error_message += " parameter is missing";
+        }
+        return ret;
+    }
 
-    /** @brief Allocator */
-    RAPIDJSON_DEFAULT_ALLOCATOR* allocator;
+    /**
+     * @brief Helper function to extract an optional enum value from a JSON object
+     * @param json JSON object
+     * @param name Name of the value to extract
+     * @param value Optional enum value extracted
+     * @param helper Helper to convert the enum from its string representation
+     * @param error_message Error message to fill
+     * @return true if the value is not present or is valid, false otherwise
+     */
+    template <typename EnumType>
+    bool extract(const rapidjson::Value&                              json,
+                 const char*                                          name,
+                 ocpp::types::Optional<EnumType>&                     value,
+                 const ocpp::types::EnumToStringFromString<EnumType>& helper,
+                 std::string&                                         error_message) const
+    {
+        bool ret  = true;
+        auto iter = json.FindMember(name);
+        if (iter != json.MemberEnd())
+        {
+            ret = convert(iter->value, name, value.value(), helper, error_message);
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Helper function to extract a mandatory object from a JSON object
+     * @param json JSON object
+     * @param name Name of the object to extract
+     * @param value Object extracted
+     * @param converter Converter to use for the object
+     * @param error_code Error code to fill
+     * @param error_message Error message to fill
+     * @return true if the object is present and valid, false otherwise
+     */
+    template <typename T>
+    bool extract(const rapidjson::Value&     json,
+                 const char*                 name,
+                 T&                          value,
+                 const IMessageConverter<T>& converter,
+                 std::string&                error_code,
+                 std::string&                error_message) const
+    {
+        auto iter = json.FindMember(name);
+        bool ret  = (iter != json.MemberEnd());
+        if (ret)
+        {
+            ret = convert(iter->value, name, value, converter, error_code, error_message);
+        }
+        else
+        {
+            error_message = name;
+            error_message += " parameter is missing";
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Helper function to extract an optional object from a JSON object
+     * @param json JSON object
+     * @param name Name of the object to extract
+     * @param value Optional object extracted
+     * @param converter Converter to use for the object
+     * @param error_code Error code to fill
+     * @param error_message Error message to fill
+     * @return true if the object is not present or is valid, false otherwise
+     */
+    template <typename T>
+    bool extract(const rapidjson::Value&     json,
+                 const char*                 name,
+                 ocpp::types::Optional<T>&   value,
+                 const IMessageConverter<T>& converter,
+                 std::string&                error_code,
+                 std::string&                error_message) const
+    {
+        bool ret  = true;
+        auto iter = json.FindMember(name);
+        if (iter != json.MemberEnd())
+        {
+            ret = convert(iter->value, name, value.value(), converter, error_code, error_message);
+        }
+        return ret;
+    }
 };
 
 /** @brief Helper macro to declare a converter class for req and conf messages
@@ -290,19 +861,48 @@ class IMessageConverter
     class MessageType##ReqConverter : public ocpp::messages::IMessageConverter<MessageType##Req>                                           \
     {                                                                                                                                      \
       public:                                                                                                                              \
-        IMessageConverter<MessageType##Req>* clone() const override { return new MessageType##ReqConverter(); }                            \
-        bool fromJson(const rapidjson::Value& json, MessageType##Req& data, std::string& error_code, std::string& error_message) override; \
-        bool toJson(const MessageType##Req& data, rapidjson::Document& json) override;                                                     \
+        bool fromJson(const rapidjson::Value& json,                                                                                        \
+                      MessageType##Req&       data,                                                                                        \
+                      std::string&            error_code,                                                                                  \
+                      std::string&            error_message) const override;                                                               \
+        bool toJson(const MessageType##Req& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;   \
+    };                                                                                                                                     \
+    class MessageType##ConfConverter : public ocpp::messages::IMessageConverter<MessageType##Conf>                                         \
+    {                                                                                                                                      \
+      public:                                                                                                                              \
+        bool fromJson(const rapidjson::Value& json,                                                                                        \
+                      MessageType##Conf&      data,                                                                                        \
+                      std::string&            error_code,                                                                                  \
+                      std::string&            error_message) const override;                                                               \
+        bool toJson(const MessageType##Conf& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;  \
+    };
+
+/** @brief Helper macro to declare a converter class for req and conf messages where the req message
+ *         can also be converted while being read from a JSON stream
+ *  @param MessageType Message type name
+ */
+#define STREAMED_MESSAGE_CONVERTERS(MessageType)                                                                                           \
+    class MessageType##ReqConverter : public ocpp::messages::IMessageConverter<MessageType##Req>                                           \
+    {                                                                                                                                      \
+      public:                                                                                                                              \
+        bool fromJson(const rapidjson::Value& json,                                                                                        \
+                      MessageType##Req&       data,                                                                                        \
+                      std::string&            error_code,                                                                                  \
+                      std::string&            error_message) const override;                                                               \
+        bool fromJson(ocpp::json::JsonReader& reader,                                                                                      \
+                      MessageType##Req&       data,                                                                                        \
+                      std::string&            error_code,                                                                                  \
+                      std::string&            error_message) const override;                                                               \
+        bool toJson(const MessageType##Req& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;   \
     };                                                                                                                                     \
     class MessageType##ConfConverter : public ocpp::messages::IMessageConverter<MessageType##Conf>                                         \
     {                                                                                                                                      \
       public:                                                                                                                              \
-        IMessageConverter<MessageType##Conf>* clone() const override { return new MessageType##ConfConverter(); }                          \
-        bool                                  fromJson(const rapidjson::Value& json,                                                       \
-                                                       MessageType##Conf&      data,                                                       \
-                                                       std::string&            error_code,                                                 \
-                                                       std::string&            error_message) override;                                               \
-        bool                                  toJson(const MessageType##Conf& data, rapidjson::Document& json) override;                   \
+        bool fromJson(const rapidjson::Value& json,                                                                                        \
+                      MessageType##Conf&      data,                                                                                        \
+                      std::string&            error_code,                                                                                  \
+                      std::string&            error_message) const override;                                                               \
+        bool toJson(const MessageType##Conf& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;  \
     };
 
 } // namespace messages
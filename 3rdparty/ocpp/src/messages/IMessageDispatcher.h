@@ -19,7 +19,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #ifndef OPENOCPP_IMESSAGEDISPATCHER_H
 #define OPENOCPP_IMESSAGEDISPATCHER_H
 
-#include "json.h"
+#include "JsonReader.h"
 
 #include <string>
 
@@ -62,6 +62,21 @@ class IMessageDispatcher
                                  std::string&            error_code,
                                  std::string&            error_message) = 0;
 
+    /**
+     * @brief Dispatch a received action to the registered handler, the payload is parsed by the handler
+     * @param action Action
+     * @param payload Null terminated JSON payload for the action, it can be modified during its parsing
+     * @param response JSON response to send
+     * @param error_code Standard error code, empty if no error
+     * @param error_msg Additionnal error message, empty if no error
+     * @return true if the call is accepted, false otherwise
+     */
+    virtual bool dispatchRawMessage(const std::string&   action,
+                                    char*                payload,
+                                    rapidjson::Document& response,
+                                    std::string&         error_code,
+                                    std::string&         error_message) = 0;
+
     /** @brief Interface for messages handlers implementations */
     class IMessageHandler
     {
@@ -83,6 +98,31 @@ class IMessageDispatcher
                             rapidjson::Document&    response,
                             std::string&            error_code,
                             std::string&            error_message) = 0;
+
+        /**
+         * @brief Handle a received action while parsing its payload
+         *        (default implementation builds a DOM of the payload and handles it)
+         * @param action Action
+         * @param payload JSON reader positioned on the start of the payload object
+         * @param response JSON response to send
+         * @param error_code Standard error code, empty if no error
+         * @param error_msg Additionnal error message, empty if no error
+         * @return true if the call is accepted, false otherwise
+         */
+        virtual bool handle(const std::string&      action,
+                            ocpp::json::JsonReader& payload,
+                            rapidjson::Document&    response,
+                            std::string&            error_code,
+                            std::string&            error_message)
+        {
+            bool                ret = false;
+            rapidjson::Document json_payload;
+            if (payload.parse(json_payload))
+            {
+                ret = handle(action, json_payload, response, error_code, error_message);
+            }
+            return ret;
+        }
     };
 };
 
@@ -21,6 +21,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include "JsonValidator.h"
 
+#include <memory>
 #include <string>
 
 namespace ocpp
@@ -42,6 +43,48 @@ class IMessagesValidator
      * @return Message validator if it exists, nullptr otherwise
     */
     virtual ocpp::json::JsonValidator* getValidator(const std::string& action, bool is_req) const = 0;
+
+    /**
+     * @brief Get the message validator corresponding to a given action, the caller shares its ownership
+     *        so that it can be used after the destruction of the messages validators (asynchronous responses)
+     * @param action Action corresponding to the message
+     * @param is_req Indicate if the validator if for the request or the response
+     * @return Message validator if it exists, nullptr otherwise
+    */
+    virtual std::shared_ptr<ocpp::json::JsonValidator> getSharedValidator(const std::string& action, bool is_req) const = 0;
+
+    /**
+     * @brief Indicate if the JSON schema validation of the messages is optional
+     *        (the messages converters then fully check the payloads during the conversion)
+     * @return true if a message without validator can be accepted, false otherwise
+     */
+    virtual bool isSchemaValidationOptional() const = 0;
+
+    /**
+     * @brief Check a message payload
+     * @param validator Message validator returned by getValidator(), if nullptr the payload
+     *                  is only checked to be an object and its converter does the remaining checks
+     * @param payload Payload to check
+     * @param error_message Error message in case of invalid payload
+     * @return true if the payload is valid, false otherwise
+     */
+    static bool isValid(ocpp::json::JsonValidator* validator, const rapidjson::Value& payload, std::string& error_message)
+    {
+        bool ret;
+        if (validator)
+        {
+            ret = validator->isValid(payload, error_message);
+        }
+        else
+        {
+            ret = payload.IsObject();
+            if (!ret)
+            {
+                error_message = "Payload is not a JSON object";
+            }
+        }
+        return ret;
+    }
 };
 
 } // namespace messages
@@ -47,9 +47,9 @@ bool MessageDispatcher::registerHandler(const std::string& action, IMessageHandl
     {
         // Get the payload validator
         ocpp::json::JsonValidator* validator = m_messages_validator.getValidator(action, true);
-        if (validator)
+        if (validator || m_messages_validator.isSchemaValidationOptional())
         {
-            LOG_DEBUG << "[" << action << "] Validator loaded";
+            LOG_DEBUG << "[" << action << "] Validator " << (validator ? "loaded" : "not needed");
 
             // Add handler
             std::pair<ocpp::json::JsonValidator*, IMessageHandler*> handler_data(validator, &handler);
@@ -86,7 +86,7 @@ bool MessageDispatcher::dispatchMessage(const std::string&      action,
         // Check payload
         auto&                      handler_data = it->second;
         ocpp::json::JsonValidator* validator    = handler_data.first;
-        if (validator && validator->isValid(payload))
+        if (m_messages_validator.isValid(validator, payload, error_message))
         {
             // Call handler
             IMessageHandler* handler = handler_data.second;
@@ -95,8 +95,71 @@ bool MessageDispatcher::dispatchMessage(const std::string&      action,
         else
         {
             // Invalid payload
-            error_code    = ocpp::rpc::IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
-            error_message = validator->lastError();
+            error_code = ocpp::rpc::IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
+        }
+    }
+    else
+    {
+        // Not implemented
+        error_code = ocpp::rpc::IRpc::RPC_ERROR_NOT_IMPLEMENTED;
+    }
+
+    return ret;
+}
+
+/** @copydoc bool IMessageDispatcher::dispatchRawMessage(const std::string&,
+                                                         char*,
+                                                         rapidjson::Document&,
+                                                         std::string&,
+                                                         std::string&) */
+bool MessageDispatcher::dispatchRawMessage(const std::string&   action,
+                                           char*                payload,
+                                           rapidjson::Document& response,
+                                           std::string&         error_code,
+                                           std::string&         error_message)
+{
+    bool ret = false;
+
+    // Look for a handler
+    auto it = m_handlers.find(action);
+    if (it != m_handlers.end())
+    {
+        auto& handler_data = it->second;
+        if (handler_data.first)
+        {
+            // Schema validation needs a DOM of the payload
+            rapidjson::Document json_payload;
+            json_payload.ParseInsitu(payload);
+            if (!json_payload.HasParseError())
+            {
+                ret = dispatchMessage(action, json_payload, response, error_code, error_message);
+            }
+            else
+            {
+                error_code    = ocpp::rpc::IRpc::RPC_ERROR_PROTOCOL;
+                error_message = rapidjson::GetParseError_En(json_payload.GetParseError());
+            }
+        }
+        else
+        {
+            // Let the handler convert the payload while reading it
+            ocpp::json::JsonReader reader(payload);
+            if (reader.next() && reader.IsObject())
+            {
+                IMessageHandler* handler = handler_data.second;
+                ret                      = handler->handle(action, reader, response, error_code, error_message);
+            }
+            else
+            {
+                error_code    = ocpp::rpc::IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
+                error_message = "Payload is not a JSON object";
+            }
+            if (!ret && reader.hasError())
+            {
+                // Syntax error
+                error_code    = ocpp::rpc::IRpc::RPC_ERROR_PROTOCOL;
+                error_message = reader.errorMessage();
+            }
         }
     }
     else
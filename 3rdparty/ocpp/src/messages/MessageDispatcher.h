@@ -61,6 +61,17 @@ class MessageDispatcher : public IMessageDispatcher
                          std::string&            error_code,
                          std::string&            error_message) override;
 
+    /** @copydoc bool IMessageDispatcher::dispatchRawMessage(const std::string&,
+                                                             char*,
+                                                             rapidjson::Document&,
+                                                             std::string&,
+                                                             std::string&) */
+    bool dispatchRawMessage(const std::string&   action,
+                            char*                payload,
+                            rapidjson::Document& response,
+                            std::string&         error_code,
+                            std::string&         error_message) override;
+
   private:
     /** @brief JSON schemas needed to validate payloads */
     const IMessagesValidator& m_messages_validator;
@@ -360,7 +360,7 @@ void CentralSystem::processUptime()
     // Save counters
     if ((m_uptime % 15u) == 0)
     {
-        m_worker_pool->run<void>(std::bind(&CentralSystem::saveUptime, this));
+        m_worker_pool->post(std::bind(&CentralSystem::saveUptime, this));
     }
 }
 
@@ -291,8 +291,7 @@ class ChargePointHandler
 
                     // Convert response to JSON
                     rapidjson::Document response(rapidjson::kObjectType);
-                    resp_converter->setAllocator(&response.GetAllocator());
-                    if (resp_converter->toJson(resp, response))
+                    if (resp_converter->toJson(resp, response, response.GetAllocator()))
                     {
 
                         // Serialize response
@@ -373,8 +373,7 @@ class ChargePointProxy : public ICentralSystem::IChargePoint, public ocpp::rpc::
         rapidjson::Document                        json_req(rapidjson::kObjectType);
         rapidjson::StringBuffer                    buffer;
         rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-        req_converter->setAllocator(&json_req.GetAllocator());
-        req_converter->toJson(request, json_req);
+        req_converter->toJson(request, json_req, json_req.GetAllocator());
         json_req.Accept(writer);
         req.data.value() = buffer.GetString();
 
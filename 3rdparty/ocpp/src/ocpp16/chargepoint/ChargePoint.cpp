@@ -1096,7 +1096,7 @@ void ChargePoint::processUptime()
     // Save counters
     if ((m_uptime % 15u) == 0)
     {
-        m_worker_pool->run<void>(std::bind(&ChargePoint::saveUptime, this));
+        m_worker_pool->post(std::bind(&ChargePoint::saveUptime, this));
     }
 }
 
@@ -1116,7 +1116,7 @@ void ChargePoint::scheduleReconnect()
     if (!m_reconnect_scheduled)
     {
         m_reconnect_scheduled = true;
-        m_worker_pool->run<void>(
+        m_worker_pool->post(
             [this]
             {
                 // Wait to let some time to configure other parameters
@@ -305,6 +305,14 @@ bool AuthentLocalList::performFullUpdate(const std::vector<ocpp::types::ocpp16::
             }
         }
     }
+
+    // Replace the whole list in a single transaction
+    ocpp::database::Database::Transaction transaction(m_database);
+    if (ret && !transaction.isActive())
+    {
+        LOG_ERROR << "Could not start the database transaction";
+        ret = false;
+    }
     if (ret)
     {
         // Clear local list
@@ -356,6 +364,10 @@ bool AuthentLocalList::performFullUpdate(const std::vector<ocpp::types::ocpp16::
             }
         }
     }
+    if (ret)
+    {
+        ret = transaction.commit();
+    }
 
     return ret;
 }
@@ -367,89 +379,103 @@ bool AuthentLocalList::performPartialUpdate(const std::vector<ocpp::types::ocpp1
 
     if (m_delete_query && m_find_query && m_update_query && m_insert_query)
     {
-        // Far all idTags
-        for (const AuthorizationData& authorization_data : authorization_datas)
+        // Apply all the changes in a single transaction
+        ocpp::database::Database::Transaction transaction(m_database);
+        if (!transaction.isActive())
         {
-            // Check if the idTag must be deleted
-            if (!authorization_data.idTagInfo.isSet())
+            LOG_ERROR << "Could not start the database transaction";
+            ret = false;
+        }
+        else
+        {
+            // Far all idTags
+            for (const AuthorizationData& authorization_data : authorization_datas)
             {
-                // Delete entry
-                m_delete_query->bind(0, authorization_data.idTag);
-                if (!m_delete_query->exec())
+                // Check if the idTag must be deleted
+                if (!authorization_data.idTagInfo.isSet())
                 {
-                    LOG_ERROR << "Could not delete idTag [" << authorization_data.idTag.str() << "]";
-                    ret = false;
+                    // Delete entry
+                    m_delete_query->bind(0, authorization_data.idTag);
+                    if (!m_delete_query->exec())
+                    {
+                        LOG_ERROR << "Could not delete idTag [" << authorization_data.idTag.str() << "]";
+                        ret = false;
+                    }
+                    else
+                    {
+                        LOG_DEBUG << "IdTag [" << authorization_data.idTag.str() << "] deleted";
+                    }
+                    m_delete_query->reset();
                 }
                 else
                 {
-                    LOG_DEBUG << "IdTag [" << authorization_data.idTag.str() << "] deleted";
-                }
-                m_delete_query->reset();
-            }
-            else
-            {
-                // Create or update, check if the entry exists
-                m_find_query->bind(0, authorization_data.idTag);
-                if (m_find_query->exec())
-                {
-                    if (m_find_query->hasRows())
+                    // Create or update, check if the entry exists
+                    m_find_query->bind(0, authorization_data.idTag);
+                    if (m_find_query->exec())
                     {
-                        // Update
-                        int entry = m_find_query->getInt32(0);
-                        m_update_query->bind(0, authorization_data.idTagInfo.value().parentIdTag.value());
-                        if (authorization_data.idTagInfo.value().expiryDate.isSet())
+                        if (m_find_query->hasRows())
                         {
-                            m_update_query->bind(1,
-                                                 static_cast<int64_t>(authorization_data.idTagInfo.value().expiryDate.value().timestamp()));
-                        }
-                        else
-                        {
-                            m_update_query->bind(1);
-                        }
-                        m_update_query->bind(2, static_cast<int>(authorization_data.idTagInfo.value().status));
-                        m_update_query->bind(3, entry);
-                        if (!m_update_query->exec())
-                        {
-                            LOG_ERROR << "Could not update idTag [" << authorization_data.idTag.str() << "]";
+                            // Update
+                            int entry = m_find_query->getInt32(0);
+                            m_update_query->bind(0, authorization_data.idTagInfo.value().parentIdTag.value());
+                            if (authorization_data.idTagInfo.value().expiryDate.isSet())
+                            {
+                                m_update_query->bind(
+                                    1, static_cast<int64_t>(authorization_data.idTagInfo.value().expiryDate.value().timestamp()));
+                            }
+                            else
+                            {
+                                m_update_query->bind(1);
+                            }
+                            m_update_query->bind(2, static_cast<int>(authorization_data.idTagInfo.value().status));
+                            m_update_query->bind(3, entry);
+                            if (!m_update_query->exec())
+                            {
+                                LOG_ERROR << "Could not update idTag [" << authorization_data.idTag.str() << "]";
+                            }
+                            else
+                            {
+                                LOG_DEBUG << "IdTag [" << authorization_data.idTag.str() << "] updated";
+                            }
+                            m_update_query->reset();
                         }
                         else
                         {
-                            LOG_DEBUG << "IdTag [" << authorization_data.idTag.str() << "] updated";
+                            // Insert
+                            m_insert_query->bind(0, authorization_data.idTag);
+                            m_insert_query->bind(1, authorization_data.idTagInfo.value().parentIdTag.value());
+                            if (authorization_data.idTagInfo.value().expiryDate.isSet())
+                            {
+                                m_insert_query->bind(
+                                    2, static_cast<int64_t>(authorization_data.idTagInfo.value().expiryDate.value().timestamp()));
+                            }
+                            else
+                            {
+                                m_insert_query->bind(2);
+                            }
+                            m_insert_query->bind(3, static_cast<int>(authorization_data.idTagInfo.value().status));
+                            if (!m_insert_query->exec())
+                            {
+                                LOG_ERROR << "Could not insert idTag [" << authorization_data.idTag.str() << "]";
+                                ret = false;
+                            }
+                            else
+                            {
+                                LOG_DEBUG << "IdTag [" << authorization_data.idTag.str() << "] inserted";
+                            }
+                            m_insert_query->reset();
                         }
-                        m_update_query->reset();
                     }
                     else
                     {
-                        // Insert
-                        m_insert_query->bind(0, authorization_data.idTag);
-                        m_insert_query->bind(1, authorization_data.idTagInfo.value().parentIdTag.value());
-                        if (authorization_data.idTagInfo.value().expiryDate.isSet())
-                        {
-                            m_insert_query->bind(2,
-                                                 static_cast<int64_t>(authorization_data.idTagInfo.value().expiryDate.value().timestamp()));
-                        }
-                        else
-                        {
-                            m_insert_query->bind(2);
-                        }
-                        m_insert_query->bind(3, static_cast<int>(authorization_data.idTagInfo.value().status));
-                        if (!m_insert_query->exec())
-                        {
-                            LOG_ERROR << "Could not insert idTag [" << authorization_data.idTag.str() << "]";
-                            ret = false;
-                        }
-                        else
-                        {
-                            LOG_DEBUG << "IdTag [" << authorization_data.idTag.str() << "] inserted";
-                        }
-                        m_insert_query->reset();
+                        ret = false;
                     }
+                    m_find_query->reset();
                 }
-                else
-                {
-                    ret = false;
-                }
-                m_find_query->reset();
+            }
+            if (ret)
+            {
+                ret = transaction.commit();
             }
         }
     }
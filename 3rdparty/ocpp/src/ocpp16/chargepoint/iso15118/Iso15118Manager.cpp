@@ -439,7 +439,7 @@ void Iso15118Manager::handle(const ocpp::messages::ocpp16::Iso15118TriggerMessag
 {
     (void)request;
 
-    m_worker_pool.run<void>(
+    m_worker_pool.post(
         [this]
         {
             // To let some time for the trigger message reply
@@ -501,7 +501,7 @@ bool Iso15118Manager::sendSignCertificate()
                     m_csr_timer.setCallback(
                         [this]()
                         {
-                            m_worker_pool.run<void>(
+                            m_worker_pool.post(
                                 [this]
                                 {
                                     LOG_ERROR << "Sign certificate timeout, triggering retry...";
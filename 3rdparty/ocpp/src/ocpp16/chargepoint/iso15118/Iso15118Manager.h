@@ -191,8 +191,7 @@ class Iso15118Manager : public IDataTransferManager::IDataTransferHandler
         rapidjson::Document                        json_req(rapidjson::kObjectType);
         rapidjson::StringBuffer                    buffer;
         rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-        req_converter->setAllocator(&json_req.GetAllocator());
-        req_converter->toJson(request, json_req);
+        req_converter->toJson(request, json_req, json_req.GetAllocator());
         json_req.Accept(writer);
         req.data.value() = buffer.GetString();
 
@@ -265,8 +264,7 @@ class Iso15118Manager : public IDataTransferManager::IDataTransferHandler
 
                     // Convert response to JSON
                     rapidjson::Document response(rapidjson::kObjectType);
-                    resp_converter->setAllocator(&response.GetAllocator());
-                    if (resp_converter->toJson(resp, response))
+                    if (resp_converter->toJson(resp, response, response.GetAllocator()))
                     {
 
                         // Serialize response
@@ -174,7 +174,7 @@ bool MaintenanceManager::onTriggerMessage(ocpp::types::ocpp16::MessageTrigger
     {
         case MessageTrigger::DiagnosticsStatusNotification:
         {
-            m_worker_pool.run<void>(
+            m_worker_pool.post(
                 [this]
                 {
                     // To let some time for the trigger message reply
@@ -186,7 +186,7 @@ bool MaintenanceManager::onTriggerMessage(ocpp::types::ocpp16::MessageTrigger
 
         case MessageTrigger::FirmwareStatusNotification:
         {
-            m_worker_pool.run<void>(
+            m_worker_pool.post(
                 [this]
                 {
                     // To let some time for the trigger message reply
@@ -216,7 +216,7 @@ bool MaintenanceManager::onTriggerMessage(ocpp::types::ocpp16::MessageTriggerEnu
     {
         case MessageTriggerEnumType::LogStatusNotification:
         {
-            m_worker_pool.run<void>(
+            m_worker_pool.post(
                 [this]
                 {
                     // To let some time for the trigger message reply
@@ -228,7 +228,7 @@ bool MaintenanceManager::onTriggerMessage(ocpp::types::ocpp16::MessageTriggerEnu
 
         case MessageTriggerEnumType::FirmwareStatusNotification:
         {
-            m_worker_pool.run<void>(
+            m_worker_pool.post(
                 [this]
                 {
                     // To let some time for the trigger message reply
@@ -357,7 +357,7 @@ void MeterValuesManager::processClockAligned(void)
     if (m_status_manager.getRegistrationStatus() == RegistrationStatus::Accepted)
     {
         // Process in background thread
-        m_worker_pool.run<void>(
+        m_worker_pool.post(
             [this]
             {
                 // Process meter value configuration
@@ -409,7 +409,7 @@ void MeterValuesManager::processClockAligned(void)
 void MeterValuesManager::processSampled(unsigned int connector_id)
 {
     // Process in background thread
-    m_worker_pool.run<void>(
+    m_worker_pool.post(
         [this, connector_id]
         {
             // Process sampled meter value configuration
@@ -458,7 +458,7 @@ void MeterValuesManager::processSampled(unsigned int connector_id)
 void MeterValuesManager::processTriggered(unsigned int connector_id)
 {
     // Process in background thread
-    m_worker_pool.run<void>(
+    m_worker_pool.post(
         [this, connector_id]
         {
             // To let some time for the trigger message reply
@@ -646,8 +646,7 @@ std::string MeterValuesManager::serialize(const ocpp::types::ocpp16::MeterValue&
 
     rapidjson::Document meter_value_json(rapidjson::kObjectType);
     MeterValueConverter meter_value_converter;
-    meter_value_converter.setAllocator(&meter_value_json.GetAllocator());
-    meter_value_converter.toJson(meter_value, meter_value_json);
+    meter_value_converter.toJson(meter_value, meter_value_json, meter_value_json.GetAllocator());
 
     rapidjson::StringBuffer                    buffer;
     rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
@@ -664,7 +663,6 @@ bool MeterValuesManager::deserialize(const std::string& meter_value_str, ocpp::t
     rapidjson::Document meter_value_json;
     meter_value_json.Parse(meter_value_str.c_str());
     MeterValueConverter meter_value_converter;
-    meter_value_converter.setAllocator(&meter_value_json.GetAllocator());
     return meter_value_converter.fromJson(meter_value_json, meter_value, error_code, error_message);
 }
 } // namespace chargepoint
@@ -61,7 +61,7 @@ RequestFifoManager::RequestFifoManager(ocpp::config::IOcppConfig&            ocp
       m_request_retry_timer(timer_pool, "Requests FIFO"),
       m_request_retry_count(0)
 {
-    m_request_retry_timer.setCallback([this] { m_worker_pool.run<void>(std::bind(&RequestFifoManager::processFifoRequest, this)); });
+    m_request_retry_timer.setCallback([this] { m_worker_pool.post(std::bind(&RequestFifoManager::processFifoRequest, this)); });
     m_requests_fifo.registerListener(this);
 }
 
@@ -82,7 +82,7 @@ void RequestFifoManager::updateConnectionStatus(bool is_connected)
             LOG_INFO << "Restart transaction related FIFO processing";
 
             // Start processing FIFO requests
-            m_worker_pool.run<void>(std::bind(&RequestFifoManager::processFifoRequest, this));
+            m_worker_pool.post(std::bind(&RequestFifoManager::processFifoRequest, this));
         }
     }
 }
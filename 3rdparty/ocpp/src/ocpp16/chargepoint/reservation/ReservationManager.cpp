@@ -231,7 +231,7 @@ bool ReservationManager::handleMessage(const ocpp::messages::ocpp16::ReserveNowR
                     response.status                      = ReservationStatus::Accepted;
 
                     // Update connector status and notify new status
-                    m_worker_pool.run<void>(
+                    m_worker_pool.post(
                         [this, connector]
                         {
                             m_status_manager.updateConnectorStatus(connector->id, ChargePointStatus::Reserved);
@@ -300,7 +300,7 @@ bool ReservationManager::handleMessage(const ocpp::messages::ocpp16::CancelReser
         if ((!connector->reservation_id_tag.empty()) && (connector->reservation_id == request.reservationId))
         {
             // Cancel reservation
-            m_worker_pool.run<void>([this, connector_id = connector->id] { endReservation(connector_id, true); });
+            m_worker_pool.post([this, connector_id = connector->id] { endReservation(connector_id, true); });
 
             // Prepare response
             response.status = CancelReservationStatus::Accepted;
@@ -323,7 +323,7 @@ void ReservationManager::checkExpiries()
         if ((!connector->reservation_id_tag.empty()) && (connector->reservation_expiry_date <= now))
         {
             // End reservation
-            m_worker_pool.run<void>(std::bind(&ReservationManager::endReservation, this, connector->id, false));
+            m_worker_pool.post(std::bind(&ReservationManager::endReservation, this, connector->id, false));
         }
     }
 }
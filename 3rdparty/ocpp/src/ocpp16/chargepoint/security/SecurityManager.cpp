@@ -320,8 +320,7 @@ bool SecurityManager::logSecurityEvent(const std::string& type, const std::strin
             {
                 // Stack is not started, queue the notification
                 rapidjson::Document payload(rapidjson::kObjectType);
-                m_security_event_req_converter->setAllocator(&payload.GetAllocator());
-                if (m_security_event_req_converter->toJson(request, payload))
+                if (m_security_event_req_converter->toJson(request, payload, payload.GetAllocator()))
                 {
                     m_requests_fifo.push(0, SECURITY_EVENT_NOTIFICATION_ACTION, payload);
                 }
@@ -378,7 +377,7 @@ bool SecurityManager::onTriggerMessage(ocpp::types::ocpp16::MessageTriggerEnumTy
 
     if (message == MessageTriggerEnumType::SignChargePointCertificate)
     {
-        m_worker_pool.run<void>(
+        m_worker_pool.post(
             [this]
             {
                 // To let some time for the trigger message reply
@@ -196,7 +196,7 @@ class SecurityManager : public ISecurityManager,
     /** @brief Transaction related requests FIFO */
     ocpp::messages::IRequestFifo& m_requests_fifo;
     /** @brief Message converter for SecurityEventNotificationReq */
-    std::unique_ptr<ocpp::messages::IMessageConverter<ocpp::messages::ocpp16::SecurityEventNotificationReq>> m_security_event_req_converter;
+    const ocpp::messages::IMessageConverter<ocpp::messages::ocpp16::SecurityEventNotificationReq>* m_security_event_req_converter;
     /** @brief Charge Point */
     IChargePoint& m_charge_point;
 
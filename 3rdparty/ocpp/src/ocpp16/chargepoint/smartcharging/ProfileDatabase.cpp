@@ -21,6 +21,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "ChargingProfileConverter.h"
 #include "Connectors.h"
 #include "IOcppConfig.h"
+#include "Logger.h"
 
 #include <algorithm>
 #include <sstream>
@@ -63,9 +64,16 @@ bool ProfileDatabase::clear(ocpp::types::Optional<int>
 {
     bool ret = false;
 
-    // Clear all ?
-    if (!id.isSet() && !connector_id.isSet() && !purpose.isSet() && !level.isSet())
+    // Remove the profiles from the database in a single transaction
+    ocpp::database::Database::Transaction transaction(m_database);
+    if (m_delete_query && !transaction.isActive())
     {
+        // The profiles lists must stay consistent with the database
+        LOG_ERROR << "Could not start the database transaction to clear the charging profiles";
+    }
+    else if (!id.isSet() && !connector_id.isSet() && !purpose.isSet() && !level.isSet())
+    {
+        // Clear all
         // Check existing profiles
         if (!m_chargepoint_max_profiles.empty() || !m_txdefault_profiles.empty() || !m_tx_profiles.empty())
         {
@@ -169,6 +177,7 @@ bool ProfileDatabase::clear(ocpp::types::Optional<int>
             }
         }
     }
+    transaction.commit();
 
     return ret;
 }
@@ -203,47 +212,59 @@ bool ProfileDatabase::install(unsigned int connector_id, const ocpp::types::ocpp
         break;
     }
 
-    // Check if a profile with the same connector and stack level exists
-    auto iter_profile =
-        std::find_if(profiles_list->begin(),
-                     profiles_list->end(),
-                     [connector_id, &profile](const ChargingProfileInfo& profile_info)
-                     { return ((profile_info.first == connector_id) && (profile_info.second.stackLevel == profile.stackLevel)); });
-    if (iter_profile != profiles_list->end())
+    // Replace the profile in the database in a single transaction
+    ocpp::database::Database::Transaction transaction(m_database);
+
+    if (m_insert_query && !transaction.isActive())
     {
-        // Erase existing profile
-        if (m_delete_query)
-        {
-            m_delete_query->bind(0, iter_profile->second.chargingProfileId);
-            m_delete_query->exec();
-            m_delete_query->reset();
-        }
-        profiles_list->erase(iter_profile);
+        // The profiles lists must stay consistent with the database
+        LOG_ERROR << "Could not start the database transaction to install the charging profile";
     }
-
-    // Check maximum number of installed profiles
-    size_t installed_profiles_count = m_chargepoint_max_profiles.size() + m_txdefault_profiles.size() + m_tx_profiles.size();
-    if (installed_profiles_count < m_ocpp_config.maxChargingProfilesInstalled())
+    else
     {
-        // Insert into list
-        profiles_list->insert({connector_id, profile});
-
-        // Insert into database
-        if (m_insert_query)
+        // Check if a profile with the same connector and stack level exists
+        auto iter_profile =
+            std::find_if(profiles_list->begin(),
+                         profiles_list->end(),
+                         [connector_id, &profile](const ChargingProfileInfo& profile_info)
+                         { return ((profile_info.first == connector_id) && (profile_info.second.stackLevel == profile.stackLevel)); });
+        if (iter_profile != profiles_list->end())
         {
-            // Serialize profile
-            std::string profile_str = serialize(profile);
-
-            // Insert
-            m_insert_query->bind(0, profile.chargingProfileId);
-            m_insert_query->bind(1, connector_id);
-            m_insert_query->bind(2, profile_str);
-            m_insert_query->exec();
-            m_insert_query->reset();
+            // Erase existing profile
+            if (m_delete_query)
+            {
+                m_delete_query->bind(0, iter_profile->second.chargingProfileId);
+                m_delete_query->exec();
+                m_delete_query->reset();
+            }
+            profiles_list->erase(iter_profile);
         }
 
-        ret = true;
+        // Check maximum number of installed profiles
+        size_t installed_profiles_count = m_chargepoint_max_profiles.size() + m_txdefault_profiles.size() + m_tx_profiles.size();
+        if (installed_profiles_count < m_ocpp_config.maxChargingProfilesInstalled())
+        {
+            // Insert into list
+            profiles_list->insert({connector_id, profile});
+
+            // Insert into database
+            if (m_insert_query)
+            {
+                // Serialize profile
+                std::string profile_str = serialize(profile);
+
+                // Insert
+                m_insert_query->bind(0, profile.chargingProfileId);
+                m_insert_query->bind(1, connector_id);
+                m_insert_query->bind(2, profile_str);
+                m_insert_query->exec();
+                m_insert_query->reset();
+            }
+
+            ret = true;
+        }
     }
+    transaction.commit();
 
     return ret;
 }
@@ -253,33 +274,45 @@ void ProfileDatabase::assignPendingTxProfiles(unsigned int connector_id, int tra
 {
     std::vector<int> profiles_to_remove;
 
-    // Look for pending profiles
-    for (const auto& profile : m_tx_profiles)
+    // Assign all the profiles in a single transaction
+    ocpp::database::Database::Transaction transaction(m_database);
+
+    if (m_insert_query && !transaction.isActive())
     {
-        if (((profile.first == Connectors::CONNECTOR_ID_CHARGE_POINT) || (profile.first == connector_id)) &&
-            !profile.second.transactionId.isSet())
+        // The profiles lists must stay consistent with the database
+        LOG_ERROR << "Could not start the database transaction to assign the pending TxProfiles";
+    }
+    else
+    {
+        // Look for pending profiles
+        for (const auto& profile : m_tx_profiles)
         {
-            // If no connector set, remove the profile completly
-            // so that it won't be used again
-            if (profile.first == Connectors::CONNECTOR_ID_CHARGE_POINT)
+            if (((profile.first == Connectors::CONNECTOR_ID_CHARGE_POINT) || (profile.first == connector_id)) &&
+                !profile.second.transactionId.isSet())
             {
-                profiles_to_remove.push_back(profile.second.chargingProfileId);
-            }
+                // If no connector set, remove the profile completly
+                // so that it won't be used again
+                if (profile.first == Connectors::CONNECTOR_ID_CHARGE_POINT)
+                {
+                    profiles_to_remove.push_back(profile.second.chargingProfileId);
+                }
 
-            // Assign transaction to a new profile
-            ChargingProfile assigned_profile = profile.second;
-            assigned_profile.transactionId   = transaction_id;
+                // Assign transaction to a new profile
+                ChargingProfile assigned_profile = profile.second;
+                assigned_profile.transactionId   = transaction_id;
 
-            // Replace existing with assigned profile
-            install(connector_id, assigned_profile);
+                // Replace existing with assigned profile
+                install(connector_id, assigned_profile);
+            }
         }
-    }
 
-    // Remove profiles
-    for (int profile_id : profiles_to_remove)
-    {
-        clear(profile_id);
+        // Remove profiles
+        for (int profile_id : profiles_to_remove)
+        {
+            clear(profile_id);
+        }
     }
+    transaction.commit();
 }
 
 /** @brief Initialize the database table */
@@ -358,8 +391,7 @@ std::string ProfileDatabase::serialize(const ocpp::types::ocpp16::ChargingProfil
 
     rapidjson::Document      profile_json(rapidjson::kObjectType);
     ChargingProfileConverter charging_profile_converter;
-    charging_profile_converter.setAllocator(&profile_json.GetAllocator());
-    charging_profile_converter.toJson(profile, profile_json);
+    charging_profile_converter.toJson(profile, profile_json, profile_json.GetAllocator());
 
     rapidjson::StringBuffer                    buffer;
     rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
@@ -377,7 +409,6 @@ bool ProfileDatabase::deserialize(const std::string& profile_str, ocpp::types::o
     rapidjson::Document profile_json;
     profile_json.Parse(profile_str.c_str());
     ChargingProfileConverter charging_profile_converter;
-    charging_profile_converter.setAllocator(&profile_json.GetAllocator());
     return charging_profile_converter.fromJson(profile_json, profile, error_code, error_message);
 }
 
@@ -67,7 +67,7 @@ SmartChargingManager::SmartChargingManager(const ocpp::config::IChargePointConfi
                                    *dynamic_cast<GenericMessageHandler<GetCompositeScheduleReq, GetCompositeScheduleConf>*>(this));
 
     // Periodic timer to cleanup profiles
-    m_cleanup_timer.setCallback([this] { this->m_worker_pool.run<void>(std::bind(&SmartChargingManager::cleanupProfiles, this)); });
+    m_cleanup_timer.setCallback([this] { this->m_worker_pool.post(std::bind(&SmartChargingManager::cleanupProfiles, this)); });
     m_cleanup_timer.start(std::chrono::minutes(1u));
     cleanupProfiles();
 }
@@ -70,8 +70,8 @@ StatusManager::StatusManager(const ocpp::config::IChargePointConfig&         sta
       m_boot_notification_timer(timer_pool, "Boot notification"),
       m_heartbeat_timer(timer_pool, "Heartbeat")
 {
-    m_boot_notification_timer.setCallback([this] { m_worker_pool.run<void>(std::bind(&StatusManager::bootNotificationProcess, this)); });
-    m_heartbeat_timer.setCallback([this] { m_worker_pool.run<void>(std::bind(&StatusManager::heartBeatProcess, this)); });
+    m_boot_notification_timer.setCallback([this] { m_worker_pool.post(std::bind(&StatusManager::bootNotificationProcess, this)); });
+    m_heartbeat_timer.setCallback([this] { m_worker_pool.post(std::bind(&StatusManager::heartBeatProcess, this)); });
 
     trigger_manager.registerHandler(ocpp::types::ocpp16::MessageTrigger::BootNotification, *this);
     trigger_manager.registerHandler(ocpp::types::ocpp16::MessageTrigger::Heartbeat, *this);
@@ -171,7 +171,7 @@ bool StatusManager::updateConnectorStatus(unsigned int
                 if (duration == std::chrono::seconds(0))
                 {
                     // Notify now
-                    m_worker_pool.run<void>(std::bind(&StatusManager::statusNotificationProcess, this, connector_id));
+                    m_worker_pool.post(std::bind(&StatusManager::statusNotificationProcess, this, connector_id));
                 }
                 else
                 {
@@ -181,7 +181,7 @@ bool StatusManager::updateConnectorStatus(unsigned int
                     {
                         connector->status_timer.setCallback(
                             [this, connector_id]
-                            { m_worker_pool.run<void>(std::bind(&StatusManager::statusNotificationProcess, this, connector_id)); });
+                            { m_worker_pool.post(std::bind(&StatusManager::statusNotificationProcess, this, connector_id)); });
                         connector->status_timer.start(std::chrono::milliseconds(duration), true);
                     }
                 }
@@ -212,7 +212,7 @@ bool StatusManager::onTriggerMessage(ocpp::types::ocpp16::MessageTrigger message
     {
         case MessageTrigger::BootNotification:
         {
-            m_worker_pool.run<void>(
+            m_worker_pool.post(
                 [this]
                 {
                     // To let some time for the trigger message reply
@@ -224,7 +224,7 @@ bool StatusManager::onTriggerMessage(ocpp::types::ocpp16::MessageTrigger message
 
         case MessageTrigger::Heartbeat:
         {
-            m_worker_pool.run<void>(
+            m_worker_pool.post(
                 [this]
                 {
                     // To let some time for the trigger message reply
@@ -239,7 +239,7 @@ bool StatusManager::onTriggerMessage(ocpp::types::ocpp16::MessageTrigger message
             if (connector_id.isSet())
             {
                 unsigned int id = connector_id;
-                m_worker_pool.run<void>(
+                m_worker_pool.post(
                     [this, id]
                     {
                         // To let some time for the trigger message reply
@@ -252,7 +252,7 @@ bool StatusManager::onTriggerMessage(ocpp::types::ocpp16::MessageTrigger message
                 for (const Connector* connector : m_connectors.getConnectors())
                 {
                     unsigned int id = connector->id;
-                    m_worker_pool.run<void>(
+                    m_worker_pool.post(
                         [this, id]
                         {
                             // To let some time for the trigger message reply
@@ -283,7 +283,7 @@ bool StatusManager::onTriggerMessage(ocpp::types::ocpp16::MessageTriggerEnumType
     {
         case MessageTriggerEnumType::BootNotification:
         {
-            m_worker_pool.run<void>(
+            m_worker_pool.post(
                 [this]
                 {
                     // To let some time for the trigger message reply
@@ -295,7 +295,7 @@ bool StatusManager::onTriggerMessage(ocpp::types::ocpp16::MessageTriggerEnumType
 
         case MessageTriggerEnumType::Heartbeat:
         {
-            m_worker_pool.run<void>(
+            m_worker_pool.post(
                 [this]
                 {
                     // To let some time for the trigger message reply
@@ -310,7 +310,7 @@ bool StatusManager::onTriggerMessage(ocpp::types::ocpp16::MessageTriggerEnumType
             if (connector_id.isSet())
             {
                 unsigned int id = connector_id;
-                m_worker_pool.run<void>(
+                m_worker_pool.post(
                     [this, id]
                     {
                         // To let some time for the trigger message reply
@@ -323,7 +323,7 @@ bool StatusManager::onTriggerMessage(ocpp::types::ocpp16::MessageTriggerEnumType
                 for (const Connector* connector : m_connectors.getConnectors())
                 {
                     unsigned int id = connector->id;
-                    m_worker_pool.run<void>(
+                    m_worker_pool.post(
                         [this, id]
                         {
                             // To let some time for the trigger message reply
@@ -390,12 +390,12 @@ bool StatusManager::handleMessage(const ocpp::messages::ocpp16::ChangeAvailabili
             {
                 for (unsigned int i = 0; i <= m_connectors.getCount(); i++)
                 {
-                    m_worker_pool.run<void>([this, i, status] { updateConnectorStatus(i, status); });
+                    m_worker_pool.post([this, i, status] { updateConnectorStatus(i, status); });
                 }
             }
             else
             {
-                m_worker_pool.run<void>([this, connector_id, status] { updateConnectorStatus(connector_id, status); });
+                m_worker_pool.post([this, connector_id, status] { updateConnectorStatus(connector_id, status); });
             }
         }
 
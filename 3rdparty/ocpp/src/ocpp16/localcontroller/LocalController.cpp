@@ -373,7 +373,7 @@ void LocalController::processUptime()
     // Save counters
     if ((m_uptime % 15u) == 0)
     {
-        m_worker_pool->run<void>(std::bind(&LocalController::saveUptime, this));
+        m_worker_pool->post(std::bind(&LocalController::saveUptime, this));
     }
 }
 
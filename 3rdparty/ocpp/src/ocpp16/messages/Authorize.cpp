@@ -43,7 +43,10 @@ namespace ocpp16
 {
 
 /** @copydoc bool IMessageConverter<DataType>::fromJson(const rapidjson::Value&, DataType&, std::string&, std::string&) */
-bool AuthorizeReqConverter::fromJson(const rapidjson::Value& json, AuthorizeReq& data, std::string& error_code, std::string& error_message)
+bool AuthorizeReqConverter::fromJson(const rapidjson::Value& json,
+                                     AuthorizeReq&           data,
+                                     std::string&            error_code,
+                                     std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -51,10 +54,10 @@ bool AuthorizeReqConverter::fromJson(const rapidjson::Value& json, AuthorizeReq&
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool AuthorizeReqConverter::toJson(const AuthorizeReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool AuthorizeReqConverter::toJson(const AuthorizeReq& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "idTag", data.idTag);
+    fill(json, "idTag", data.idTag, allocator);
     return true;
 }
 
@@ -62,21 +65,20 @@ bool AuthorizeReqConverter::toJson(const AuthorizeReq& data, rapidjson::Document
 bool AuthorizeConfConverter::fromJson(const rapidjson::Value& json,
                                       AuthorizeConf&          data,
                                       std::string&            error_code,
-                                      std::string&            error_message)
+                                      std::string&            error_message) const
 {
     IdTagInfoConverter id_tag_info_converter;
     bool               ret = id_tag_info_converter.fromJson(json["idTagInfo"], data.idTagInfo, error_code, error_message);
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool AuthorizeConfConverter::toJson(const AuthorizeConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool AuthorizeConfConverter::toJson(const AuthorizeConf& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
     IdTagInfoConverter id_tag_info_converter;
-    id_tag_info_converter.setAllocator(allocator);
-    rapidjson::Document id_tag_info(rapidjson::kObjectType);
-    bool                ret = id_tag_info_converter.toJson(data.idTagInfo, id_tag_info);
-    json.AddMember(rapidjson::StringRef("idTagInfo"), id_tag_info.Move(), *allocator);
+    rapidjson::Value   id_tag_info(rapidjson::kObjectType);
+    bool               ret = id_tag_info_converter.toJson(data.idTagInfo, id_tag_info, allocator);
+    json.AddMember(rapidjson::StringRef("idTagInfo"), id_tag_info.Move(), allocator);
     return ret;
 }
 
@@ -42,7 +42,7 @@ namespace ocpp16
 bool BootNotificationReqConverter::fromJson(const rapidjson::Value& json,
                                             BootNotificationReq&    data,
                                             std::string&            error_code,
-                                            std::string&            error_message)
+                                            std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -59,18 +59,20 @@ bool BootNotificationReqConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool BootNotificationReqConverter::toJson(const BootNotificationReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool BootNotificationReqConverter::toJson(const BootNotificationReq&          data,
+                                          rapidjson::Value&                   json,
+                                          rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "chargeBoxSerialNumber", data.chargeBoxSerialNumber);
-    fill(json, "chargePointModel", data.chargePointModel);
-    fill(json, "chargePointSerialNumber", data.chargePointSerialNumber);
-    fill(json, "chargePointVendor", data.chargePointVendor);
-    fill(json, "firmwareVersion", data.firmwareVersion);
-    fill(json, "iccid", data.iccid);
-    fill(json, "imsi", data.imsi);
-    fill(json, "meterSerialNumber", data.meterSerialNumber);
-    fill(json, "meterType", data.meterType);
+    fill(json, "chargeBoxSerialNumber", data.chargeBoxSerialNumber, allocator);
+    fill(json, "chargePointModel", data.chargePointModel, allocator);
+    fill(json, "chargePointSerialNumber", data.chargePointSerialNumber, allocator);
+    fill(json, "chargePointVendor", data.chargePointVendor, allocator);
+    fill(json, "firmwareVersion", data.firmwareVersion, allocator);
+    fill(json, "iccid", data.iccid, allocator);
+    fill(json, "imsi", data.imsi, allocator);
+    fill(json, "meterSerialNumber", data.meterSerialNumber, allocator);
+    fill(json, "meterType", data.meterType, allocator);
 
     return true;
 }
@@ -79,7 +81,7 @@ bool BootNotificationReqConverter::toJson(const BootNotificationReq& data, rapid
 bool BootNotificationConfConverter::fromJson(const rapidjson::Value& json,
                                              BootNotificationConf&   data,
                                              std::string&            error_code,
-                                             std::string&            error_message)
+                                             std::string&            error_message) const
 {
     bool ret;
 
@@ -93,12 +95,14 @@ bool BootNotificationConfConverter::fromJson(const rapidjson::Value& json,
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool BootNotificationConfConverter::toJson(const BootNotificationConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool BootNotificationConfConverter::toJson(const BootNotificationConf&         data,
+                                           rapidjson::Value&                   json,
+                                           rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "currentTime", data.currentTime.str());
-    fill(json, "interval", data.interval);
-    fill(json, "status", RegistrationStatusHelper.toString(data.status));
+    fill(json, "currentTime", data.currentTime.str(), allocator);
+    fill(json, "interval", data.interval, allocator);
+    fill(json, "status", RegistrationStatusHelper.toString(data.status), allocator);
     return true;
 }
 
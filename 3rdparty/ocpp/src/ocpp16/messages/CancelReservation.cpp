@@ -43,7 +43,7 @@ namespace ocpp16
 bool CancelReservationReqConverter::fromJson(const rapidjson::Value& json,
                                              CancelReservationReq&   data,
                                              std::string&            error_code,
-                                             std::string&            error_message)
+                                             std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -51,10 +51,12 @@ bool CancelReservationReqConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool CancelReservationReqConverter::toJson(const CancelReservationReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool CancelReservationReqConverter::toJson(const CancelReservationReq&         data,
+                                           rapidjson::Value&                   json,
+                                           rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "reservationId", data.reservationId);
+    fill(json, "reservationId", data.reservationId, allocator);
     return true;
 }
 
@@ -62,7 +64,7 @@ bool CancelReservationReqConverter::toJson(const CancelReservationReq& data, rap
 bool CancelReservationConfConverter::fromJson(const rapidjson::Value& json,
                                               CancelReservationConf&  data,
                                               std::string&            error_code,
-                                              std::string&            error_message)
+                                              std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -70,10 +72,12 @@ bool CancelReservationConfConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool CancelReservationConfConverter::toJson(const CancelReservationConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool CancelReservationConfConverter::toJson(const CancelReservationConf&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", CancelReservationStatusHelper.toString(data.status));
+    fill(json, "status", CancelReservationStatusHelper.toString(data.status), allocator);
     return true;
 }
 
@@ -43,7 +43,7 @@ namespace ocpp16
 bool CertificateSignedReqConverter::fromJson(const rapidjson::Value& json,
                                              CertificateSignedReq&   data,
                                              std::string&            error_code,
-                                             std::string&            error_message)
+                                             std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -51,10 +51,12 @@ bool CertificateSignedReqConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool CertificateSignedReqConverter::toJson(const CertificateSignedReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool CertificateSignedReqConverter::toJson(const CertificateSignedReq&         data,
+                                           rapidjson::Value&                   json,
+                                           rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "certificateChain", data.certificateChain);
+    fill(json, "certificateChain", data.certificateChain, allocator);
     return true;
 }
 
@@ -62,7 +64,7 @@ bool CertificateSignedReqConverter::toJson(const CertificateSignedReq& data, rap
 bool CertificateSignedConfConverter::fromJson(const rapidjson::Value& json,
                                               CertificateSignedConf&  data,
                                               std::string&            error_code,
-                                              std::string&            error_message)
+                                              std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -70,10 +72,12 @@ bool CertificateSignedConfConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool CertificateSignedConfConverter::toJson(const CertificateSignedConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool CertificateSignedConfConverter::toJson(const CertificateSignedConf&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", CertificateSignedStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", CertificateSignedStatusEnumTypeHelper.toString(data.status), allocator);
     return true;
 }
 
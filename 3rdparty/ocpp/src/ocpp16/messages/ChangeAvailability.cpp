@@ -47,7 +47,7 @@ namespace ocpp16
 bool ChangeAvailabilityReqConverter::fromJson(const rapidjson::Value& json,
                                               ChangeAvailabilityReq&  data,
                                               std::string&            error_code,
-                                              std::string&            error_message)
+                                              std::string&            error_message) const
 {
     bool ret;
     ret       = extract(json, "connectorId", data.connectorId, error_message);
@@ -59,11 +59,13 @@ bool ChangeAvailabilityReqConverter::fromJson(const rapidjson::Value& json,
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool ChangeAvailabilityReqConverter::toJson(const ChangeAvailabilityReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool ChangeAvailabilityReqConverter::toJson(const ChangeAvailabilityReq&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "connectorId", data.connectorId);
-    fill(json, "type", AvailabilityTypeHelper.toString(data.type));
+    fill(json, "connectorId", data.connectorId, allocator);
+    fill(json, "type", AvailabilityTypeHelper.toString(data.type), allocator);
     return true;
 }
 
@@ -71,7 +73,7 @@ bool ChangeAvailabilityReqConverter::toJson(const ChangeAvailabilityReq& data, r
 bool ChangeAvailabilityConfConverter::fromJson(const rapidjson::Value& json,
                                                ChangeAvailabilityConf& data,
                                                std::string&            error_code,
-                                               std::string&            error_message)
+                                               std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -79,10 +81,12 @@ bool ChangeAvailabilityConfConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool ChangeAvailabilityConfConverter::toJson(const ChangeAvailabilityConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool ChangeAvailabilityConfConverter::toJson(const ChangeAvailabilityConf&       data,
+                                             rapidjson::Value&                   json,
+                                             rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", AvailabilityStatusHelper.toString(data.status));
+    fill(json, "status", AvailabilityStatusHelper.toString(data.status), allocator);
     return true;
 }
 
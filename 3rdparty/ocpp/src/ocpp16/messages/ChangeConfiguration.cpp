@@ -44,7 +44,7 @@ namespace ocpp16
 bool ChangeConfigurationReqConverter::fromJson(const rapidjson::Value& json,
                                                ChangeConfigurationReq& data,
                                                std::string&            error_code,
-                                               std::string&            error_message)
+                                               std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -53,11 +53,13 @@ bool ChangeConfigurationReqConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool ChangeConfigurationReqConverter::toJson(const ChangeConfigurationReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool ChangeConfigurationReqConverter::toJson(const ChangeConfigurationReq&       data,
+                                             rapidjson::Value&                   json,
+                                             rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "key", data.key);
-    fill(json, "value", data.value);
+    fill(json, "key", data.key, allocator);
+    fill(json, "value", data.value, allocator);
     return true;
 }
 
@@ -65,7 +67,7 @@ bool ChangeConfigurationReqConverter::toJson(const ChangeConfigurationReq& data,
 bool ChangeConfigurationConfConverter::fromJson(const rapidjson::Value&  json,
                                                 ChangeConfigurationConf& data,
                                                 std::string&             error_code,
-                                                std::string&             error_message)
+                                                std::string&             error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -73,10 +75,12 @@ bool ChangeConfigurationConfConverter::fromJson(const rapidjson::Value&  json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool ChangeConfigurationConfConverter::toJson(const ChangeConfigurationConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool ChangeConfigurationConfConverter::toJson(const ChangeConfigurationConf&      data,
+                                              rapidjson::Value&                   json,
+                                              rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", ConfigurationStatusHelper.toString(data.status));
+    fill(json, "status", ConfigurationStatusHelper.toString(data.status), allocator);
     return true;
 }
 
@@ -43,7 +43,7 @@ namespace ocpp16
 bool ClearCacheReqConverter::fromJson(const rapidjson::Value& json,
                                       ClearCacheReq&          data,
                                       std::string&            error_code,
-                                      std::string&            error_message)
+                                      std::string&            error_message) const
 {
     (void)json;
     (void)data;
@@ -52,11 +52,12 @@ bool ClearCacheReqConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool ClearCacheReqConverter::toJson(const ClearCacheReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool ClearCacheReqConverter::toJson(const ClearCacheReq& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
     (void)data;
     (void)json;
+    (void)allocator;
     return true;
 }
 
@@ -64,7 +65,7 @@ bool ClearCacheReqConverter::toJson(const ClearCacheReq& data, rapidjson::Docume
 bool ClearCacheConfConverter::fromJson(const rapidjson::Value& json,
                                        ClearCacheConf&         data,
                                        std::string&            error_code,
-                                       std::string&            error_message)
+                                       std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -72,10 +73,12 @@ bool ClearCacheConfConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool ClearCacheConfConverter::toJson(const ClearCacheConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool ClearCacheConfConverter::toJson(const ClearCacheConf&               data,
+                                     rapidjson::Value&                   json,
+                                     rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", ClearCacheStatusHelper.toString(data.status));
+    fill(json, "status", ClearCacheStatusHelper.toString(data.status), allocator);
     return true;
 }
 
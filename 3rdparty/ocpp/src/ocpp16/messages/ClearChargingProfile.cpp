@@ -50,7 +50,7 @@ namespace ocpp16
 bool ClearChargingProfileReqConverter::fromJson(const rapidjson::Value&  json,
                                                 ClearChargingProfileReq& data,
                                                 std::string&             error_code,
-                                                std::string&             error_message)
+                                                std::string&             error_message) const
 {
     extract(json, "id", data.id);
     bool ret = extract(json, "connectorId", data.connectorId, error_message);
@@ -66,16 +66,18 @@ bool ClearChargingProfileReqConverter::fromJson(const rapidjson::Value&  json,
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool ClearChargingProfileReqConverter::toJson(const ClearChargingProfileReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool ClearChargingProfileReqConverter::toJson(const ClearChargingProfileReq&      data,
+                                              rapidjson::Value&                   json,
+                                              rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "id", data.id);
-    fill(json, "connectorId", data.connectorId);
+    fill(json, "id", data.id, allocator);
+    fill(json, "connectorId", data.connectorId, allocator);
     if (data.chargingProfilePurpose.isSet())
     {
-        fill(json, "chargingProfilePurpose", ChargingProfilePurposeTypeHelper.toString(data.chargingProfilePurpose));
+        fill(json, "chargingProfilePurpose", ChargingProfilePurposeTypeHelper.toString(data.chargingProfilePurpose), allocator);
     }
-    fill(json, "stackLevel", data.stackLevel);
+    fill(json, "stackLevel", data.stackLevel, allocator);
     return true;
 }
 
@@ -83,7 +85,7 @@ bool ClearChargingProfileReqConverter::toJson(const ClearChargingProfileReq& dat
 bool ClearChargingProfileConfConverter::fromJson(const rapidjson::Value&   json,
                                                  ClearChargingProfileConf& data,
                                                  std::string&              error_code,
-                                                 std::string&              error_message)
+                                                 std::string&              error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -91,10 +93,12 @@ bool ClearChargingProfileConfConverter::fromJson(const rapidjson::Value&   json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool ClearChargingProfileConfConverter::toJson(const ClearChargingProfileConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool ClearChargingProfileConfConverter::toJson(const ClearChargingProfileConf&     data,
+                                               rapidjson::Value&                   json,
+                                               rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", ClearChargingProfileStatusHelper.toString(data.status));
+    fill(json, "status", ClearChargingProfileStatusHelper.toString(data.status), allocator);
     return true;
 }
 
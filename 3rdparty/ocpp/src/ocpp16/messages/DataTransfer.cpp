@@ -45,7 +45,7 @@ namespace ocpp16
 bool DataTransferReqConverter::fromJson(const rapidjson::Value& json,
                                         DataTransferReq&        data,
                                         std::string&            error_code,
-                                        std::string&            error_message)
+                                        std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -55,12 +55,14 @@ bool DataTransferReqConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool DataTransferReqConverter::toJson(const DataTransferReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool DataTransferReqConverter::toJson(const DataTransferReq&              data,
+                                      rapidjson::Value&                   json,
+                                      rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "vendorId", data.vendorId);
-    fill(json, "messageId", data.messageId);
-    fill(json, "data", data.data);
+    fill(json, "vendorId", data.vendorId, allocator);
+    fill(json, "messageId", data.messageId, allocator);
+    fill(json, "data", data.data, allocator);
     return true;
 }
 
@@ -68,7 +70,7 @@ bool DataTransferReqConverter::toJson(const DataTransferReq& data, rapidjson::Do
 bool DataTransferConfConverter::fromJson(const rapidjson::Value& json,
                                          DataTransferConf&       data,
                                          std::string&            error_code,
-                                         std::string&            error_message)
+                                         std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -77,11 +79,13 @@ bool DataTransferConfConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool DataTransferConfConverter::toJson(const DataTransferConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool DataTransferConfConverter::toJson(const DataTransferConf&             data,
+                                       rapidjson::Value&                   json,
+                                       rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", DataTransferStatusHelper.toString(data.status));
-    fill(json, "data", data.data);
+    fill(json, "status", DataTransferStatusHelper.toString(data.status), allocator);
+    fill(json, "data", data.data, allocator);
     return true;
 }
 
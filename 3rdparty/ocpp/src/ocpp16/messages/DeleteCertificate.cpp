@@ -46,20 +46,21 @@ namespace ocpp16
 bool DeleteCertificateReqConverter::fromJson(const rapidjson::Value& json,
                                              DeleteCertificateReq&   data,
                                              std::string&            error_code,
-                                             std::string&            error_message)
+                                             std::string&            error_message) const
 {
     CertificateHashDataTypeConverter certificate_hash_converter;
     return certificate_hash_converter.fromJson(json["certificateHashData"], data.certificateHashData, error_code, error_message);
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool DeleteCertificateReqConverter::toJson(const DeleteCertificateReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool DeleteCertificateReqConverter::toJson(const DeleteCertificateReq&         data,
+                                           rapidjson::Value&                   json,
+                                           rapidjson::Document::AllocatorType& allocator) const
 {
     CertificateHashDataTypeConverter certificate_hash_converter;
-    certificate_hash_converter.setAllocator(allocator);
-    rapidjson::Document value(rapidjson::kObjectType);
-    bool                ret = certificate_hash_converter.toJson(data.certificateHashData, value);
-    json.AddMember(rapidjson::StringRef("certificateHashData"), value.Move(), *allocator);
+    rapidjson::Value                 value(rapidjson::kObjectType);
+    bool                             ret = certificate_hash_converter.toJson(data.certificateHashData, value, allocator);
+    json.AddMember(rapidjson::StringRef("certificateHashData"), value.Move(), allocator);
     return ret;
 }
 
@@ -67,7 +68,7 @@ bool DeleteCertificateReqConverter::toJson(const DeleteCertificateReq& data, rap
 bool DeleteCertificateConfConverter::fromJson(const rapidjson::Value& json,
                                               DeleteCertificateConf&  data,
                                               std::string&            error_code,
-                                              std::string&            error_message)
+                                              std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -75,10 +76,12 @@ bool DeleteCertificateConfConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool DeleteCertificateConfConverter::toJson(const DeleteCertificateConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool DeleteCertificateConfConverter::toJson(const DeleteCertificateConf&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", DeleteCertificateStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", DeleteCertificateStatusEnumTypeHelper.toString(data.status), allocator);
     return true;
 }
 
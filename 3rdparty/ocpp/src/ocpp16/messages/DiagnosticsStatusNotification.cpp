@@ -45,7 +45,7 @@ namespace ocpp16
 bool DiagnosticsStatusNotificationReqConverter::fromJson(const rapidjson::Value&           json,
                                                          DiagnosticsStatusNotificationReq& data,
                                                          std::string&                      error_code,
-                                                         std::string&                      error_message)
+                                                         std::string&                      error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -53,10 +53,12 @@ bool DiagnosticsStatusNotificationReqConverter::fromJson(const rapidjson::Value&
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool DiagnosticsStatusNotificationReqConverter::toJson(const DiagnosticsStatusNotificationReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool DiagnosticsStatusNotificationReqConverter::toJson(const DiagnosticsStatusNotificationReq& data,
+                                                       rapidjson::Value&                       json,
+                                                       rapidjson::Document::AllocatorType&     allocator) const
 {
-    fill(json, "status", DiagnosticsStatusHelper.toString(data.status));
+    fill(json, "status", DiagnosticsStatusHelper.toString(data.status), allocator);
     return true;
 }
 
@@ -64,7 +66,7 @@ bool DiagnosticsStatusNotificationReqConverter::toJson(const DiagnosticsStatusNo
 bool DiagnosticsStatusNotificationConfConverter::fromJson(const rapidjson::Value&            json,
                                                           DiagnosticsStatusNotificationConf& data,
                                                           std::string&                       error_code,
-                                                          std::string&                       error_message)
+                                                          std::string&                       error_message) const
 {
     (void)json;
     (void)data;
@@ -73,11 +75,14 @@ bool DiagnosticsStatusNotificationConfConverter::fromJson(const rapidjson::Value
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool DiagnosticsStatusNotificationConfConverter::toJson(const DiagnosticsStatusNotificationConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool DiagnosticsStatusNotificationConfConverter::toJson(const DiagnosticsStatusNotificationConf& data,
+                                                        rapidjson::Value&                        json,
+                                                        rapidjson::Document::AllocatorType&      allocator) const
 {
     (void)json;
     (void)data;
+    (void)allocator;
     return true;
 }
 
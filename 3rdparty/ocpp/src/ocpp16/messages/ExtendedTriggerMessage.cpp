@@ -55,7 +55,7 @@ namespace ocpp16
 bool ExtendedTriggerMessageReqConverter::fromJson(const rapidjson::Value&    json,
                                                   ExtendedTriggerMessageReq& data,
                                                   std::string&               error_code,
-                                                  std::string&               error_message)
+                                                  std::string&               error_message) const
 {
     bool ret;
     data.connectorId      = 0;
@@ -68,11 +68,13 @@ bool ExtendedTriggerMessageReqConverter::fromJson(const rapidjson::Value&    jso
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool ExtendedTriggerMessageReqConverter::toJson(const ExtendedTriggerMessageReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool ExtendedTriggerMessageReqConverter::toJson(const ExtendedTriggerMessageReq&    data,
+                                                rapidjson::Value&                   json,
+                                                rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "connectorId", data.connectorId);
-    fill(json, "requestedMessage", MessageTriggerEnumTypeHelper.toString(data.requestedMessage));
+    fill(json, "connectorId", data.connectorId, allocator);
+    fill(json, "requestedMessage", MessageTriggerEnumTypeHelper.toString(data.requestedMessage), allocator);
     return true;
 }
 
@@ -80,7 +82,7 @@ bool ExtendedTriggerMessageReqConverter::toJson(const ExtendedTriggerMessageReq&
 bool ExtendedTriggerMessageConfConverter::fromJson(const rapidjson::Value&     json,
                                                    ExtendedTriggerMessageConf& data,
                                                    std::string&                error_code,
-                                                   std::string&                error_message)
+                                                   std::string&                error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -88,10 +90,12 @@ bool ExtendedTriggerMessageConfConverter::fromJson(const rapidjson::Value&     j
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool ExtendedTriggerMessageConfConverter::toJson(const ExtendedTriggerMessageConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool ExtendedTriggerMessageConfConverter::toJson(const ExtendedTriggerMessageConf&   data,
+                                                 rapidjson::Value&                   json,
+                                                 rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", TriggerMessageStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", TriggerMessageStatusEnumTypeHelper.toString(data.status), allocator);
     return true;
 }
 
@@ -49,7 +49,7 @@ namespace ocpp16
 bool FirmwareStatusNotificationReqConverter::fromJson(const rapidjson::Value&        json,
                                                       FirmwareStatusNotificationReq& data,
                                                       std::string&                   error_code,
-                                                      std::string&                   error_message)
+                                                      std::string&                   error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -57,10 +57,12 @@ bool FirmwareStatusNotificationReqConverter::fromJson(const rapidjson::Value&
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool FirmwareStatusNotificationReqConverter::toJson(const FirmwareStatusNotificationReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool FirmwareStatusNotificationReqConverter::toJson(const FirmwareStatusNotificationReq& data,
+                                                    rapidjson::Value&                    json,
+                                                    rapidjson::Document::AllocatorType&  allocator) const
 {
-    fill(json, "status", FirmwareStatusHelper.toString(data.status));
+    fill(json, "status", FirmwareStatusHelper.toString(data.status), allocator);
     return true;
 }
 
@@ -68,7 +70,7 @@ bool FirmwareStatusNotificationReqConverter::toJson(const FirmwareStatusNotifica
 bool FirmwareStatusNotificationConfConverter::fromJson(const rapidjson::Value&         json,
                                                        FirmwareStatusNotificationConf& data,
                                                        std::string&                    error_code,
-                                                       std::string&                    error_message)
+                                                       std::string&                    error_message) const
 {
     (void)json;
     (void)data;
@@ -77,11 +79,14 @@ bool FirmwareStatusNotificationConfConverter::fromJson(const rapidjson::Value&
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool FirmwareStatusNotificationConfConverter::toJson(const FirmwareStatusNotificationConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool FirmwareStatusNotificationConfConverter::toJson(const FirmwareStatusNotificationConf& data,
+                                                     rapidjson::Value&                     json,
+                                                     rapidjson::Document::AllocatorType&   allocator) const
 {
     (void)json;
     (void)data;
+    (void)allocator;
     return true;
 }
 
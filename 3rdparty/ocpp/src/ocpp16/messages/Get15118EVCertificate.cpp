@@ -47,7 +47,7 @@ namespace ocpp16
 bool Get15118EVCertificateReqConverter::fromJson(const rapidjson::Value&   json,
                                                  Get15118EVCertificateReq& data,
                                                  std::string&              error_code,
-                                                 std::string&              error_message)
+                                                 std::string&              error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -57,12 +57,14 @@ bool Get15118EVCertificateReqConverter::fromJson(const rapidjson::Value&   json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool Get15118EVCertificateReqConverter::toJson(const Get15118EVCertificateReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool Get15118EVCertificateReqConverter::toJson(const Get15118EVCertificateReq&     data,
+                                               rapidjson::Value&                   json,
+                                               rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "iso15118SchemaVersion", data.iso15118SchemaVersion);
-    fill(json, "action", CertificateActionEnumTypeHelper.toString(data.action));
-    fill(json, "exiRequest", data.exiRequest);
+    fill(json, "iso15118SchemaVersion", data.iso15118SchemaVersion, allocator);
+    fill(json, "action", CertificateActionEnumTypeHelper.toString(data.action), allocator);
+    fill(json, "exiRequest", data.exiRequest, allocator);
     return true;
 }
 
@@ -70,7 +72,7 @@ bool Get15118EVCertificateReqConverter::toJson(const Get15118EVCertificateReq& d
 bool Get15118EVCertificateConfConverter::fromJson(const rapidjson::Value&    json,
                                                   Get15118EVCertificateConf& data,
                                                   std::string&               error_code,
-                                                  std::string&               error_message)
+                                                  std::string&               error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -79,11 +81,13 @@ bool Get15118EVCertificateConfConverter::fromJson(const rapidjson::Value&    jso
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool Get15118EVCertificateConfConverter::toJson(const Get15118EVCertificateConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool Get15118EVCertificateConfConverter::toJson(const Get15118EVCertificateConf&    data,
+                                                rapidjson::Value&                   json,
+                                                rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", Iso15118EVCertificateStatusEnumTypeHelper.toString(data.status));
-    fill(json, "exiResponse", data.exiResponse);
+    fill(json, "status", Iso15118EVCertificateStatusEnumTypeHelper.toString(data.status), allocator);
+    fill(json, "exiResponse", data.exiResponse, allocator);
     return true;
 }
 
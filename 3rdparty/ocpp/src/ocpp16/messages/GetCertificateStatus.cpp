@@ -44,7 +44,7 @@ namespace ocpp16
 bool GetCertificateStatusReqConverter::fromJson(const rapidjson::Value&  json,
                                                 GetCertificateStatusReq& data,
                                                 std::string&             error_code,
-                                                std::string&             error_message)
+                                                std::string&             error_message) const
 {
     const rapidjson::Value&      ocspRequestData = json["ocspRequestData"];
     OcspRequestDataTypeConverter ocsp_request_converter;
@@ -52,17 +52,18 @@ bool GetCertificateStatusReqConverter::fromJson(const rapidjson::Value&  json,
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool GetCertificateStatusReqConverter::toJson(const GetCertificateStatusReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool GetCertificateStatusReqConverter::toJson(const GetCertificateStatusReq&      data,
+                                              rapidjson::Value&                   json,
+                                              rapidjson::Document::AllocatorType& allocator) const
 {
     OcspRequestDataTypeConverter ocsp_request_converter;
-    ocsp_request_converter.setAllocator(allocator);
 
-    rapidjson::Document value(rapidjson::kObjectType);
-    bool                ret = ocsp_request_converter.toJson(data.ocspRequestData, value);
+    rapidjson::Value value(rapidjson::kObjectType);
+    bool             ret = ocsp_request_converter.toJson(data.ocspRequestData, value, allocator);
     if (ret)
     {
-        json.AddMember(rapidjson::StringRef("ocspRequestData"), value.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("ocspRequestData"), value.Move(), allocator);
     }
     return ret;
 }
@@ -71,7 +72,7 @@ bool GetCertificateStatusReqConverter::toJson(const GetCertificateStatusReq& dat
 bool GetCertificateStatusConfConverter::fromJson(const rapidjson::Value&   json,
                                                  GetCertificateStatusConf& data,
                                                  std::string&              error_code,
-                                                 std::string&              error_message)
+                                                 std::string&              error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -80,11 +81,13 @@ bool GetCertificateStatusConfConverter::fromJson(const rapidjson::Value&   json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool GetCertificateStatusConfConverter::toJson(const GetCertificateStatusConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool GetCertificateStatusConfConverter::toJson(const GetCertificateStatusConf&     data,
+                                               rapidjson::Value&                   json,
+                                               rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", GetCertificateStatusEnumTypeHelper.toString(data.status));
-    fill(json, "ocspResult", data.ocspResult);
+    fill(json, "status", GetCertificateStatusEnumTypeHelper.toString(data.status), allocator);
+    fill(json, "ocspResult", data.ocspResult, allocator);
     return true;
 }
 
@@ -44,7 +44,7 @@ namespace ocpp16
 bool GetCompositeScheduleReqConverter::fromJson(const rapidjson::Value&  json,
                                                 GetCompositeScheduleReq& data,
                                                 std::string&             error_code,
-                                                std::string&             error_message)
+                                                std::string&             error_message) const
 {
     bool ret = extract(json, "connectorId", data.connectorId, error_message);
     ret      = ret && extract(json, "duration", data.duration, error_message);
@@ -59,14 +59,16 @@ bool GetCompositeScheduleReqConverter::fromJson(const rapidjson::Value&  json,
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool GetCompositeScheduleReqConverter::toJson(const GetCompositeScheduleReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool GetCompositeScheduleReqConverter::toJson(const GetCompositeScheduleReq&      data,
+                                              rapidjson::Value&                   json,
+                                              rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "connectorId", data.connectorId);
-    fill(json, "duration", data.duration);
+    fill(json, "connectorId", data.connectorId, allocator);
+    fill(json, "duration", data.duration, allocator);
     if (data.chargingRateUnit.isSet())
     {
-        fill(json, "chargingRateUnit", ChargingRateUnitTypeHelper.toString(data.chargingRateUnit));
+        fill(json, "chargingRateUnit", ChargingRateUnitTypeHelper.toString(data.chargingRateUnit), allocator);
     }
     return true;
 }
@@ -75,7 +77,7 @@ bool GetCompositeScheduleReqConverter::toJson(const GetCompositeScheduleReq& dat
 bool GetCompositeScheduleConfConverter::fromJson(const rapidjson::Value&   json,
                                                  GetCompositeScheduleConf& data,
                                                  std::string&              error_code,
-                                                 std::string&              error_message)
+                                                 std::string&              error_message) const
 {
     data.status = GetCompositeScheduleStatusHelper.fromString(json["status"].GetString());
     bool ret    = extract(json, "connectorId", data.connectorId, error_message);
@@ -92,21 +94,22 @@ bool GetCompositeScheduleConfConverter::fromJson(const rapidjson::Value&   json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool GetCompositeScheduleConfConverter::toJson(const GetCompositeScheduleConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool GetCompositeScheduleConfConverter::toJson(const GetCompositeScheduleConf&     data,
+                                               rapidjson::Value&                   json,
+                                               rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
-    fill(json, "status", GetCompositeScheduleStatusHelper.toString(data.status));
-    fill(json, "connectorId", data.connectorId);
-    fill(json, "scheduleStart", data.scheduleStart);
+    fill(json, "status", GetCompositeScheduleStatusHelper.toString(data.status), allocator);
+    fill(json, "connectorId", data.connectorId, allocator);
+    fill(json, "scheduleStart", data.scheduleStart, allocator);
     if (data.chargingSchedule.isSet())
     {
         ChargingScheduleConverter charging_schedule_converter;
-        charging_schedule_converter.setAllocator(allocator);
 
-        rapidjson::Document value(rapidjson::kObjectType);
-        ret = charging_schedule_converter.toJson(data.chargingSchedule, value);
-        json.AddMember(rapidjson::StringRef("chargingSchedule"), value.Move(), *allocator);
+        rapidjson::Value value(rapidjson::kObjectType);
+        ret = charging_schedule_converter.toJson(data.chargingSchedule, value, allocator);
+        json.AddMember(rapidjson::StringRef("chargingSchedule"), value.Move(), allocator);
     }
     return ret;
 }
@@ -32,7 +32,7 @@ namespace ocpp16
 bool GetConfigurationReqConverter::fromJson(const rapidjson::Value& json,
                                             GetConfigurationReq&    data,
                                             std::string&            error_code,
-                                            std::string&            error_message)
+                                            std::string&            error_message) const
 {
     if (json.HasMember("key"))
     {
@@ -50,18 +50,19 @@ bool GetConfigurationReqConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool GetConfigurationReqConverter::toJson(const GetConfigurationReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool GetConfigurationReqConverter::toJson(const GetConfigurationReq&          data,
+                                          rapidjson::Value&                   json,
+                                          rapidjson::Document::AllocatorType& allocator) const
 {
     if (data.key.isSet())
     {
-        rapidjson::Value                    keys(rapidjson::kArrayType);
-        rapidjson::Document::AllocatorType& _allocator = json.GetAllocator();
+        rapidjson::Value keys(rapidjson::kArrayType);
         for (const auto& key : data.key.value())
         {
-            keys.PushBack(rapidjson::Value(key.c_str(), static_cast<rapidjson::SizeType>(key.str().size()), _allocator).Move(), _allocator);
+            keys.PushBack(rapidjson::Value(key.c_str(), static_cast<rapidjson::SizeType>(key.str().size()), allocator).Move(), allocator);
         }
-        json.AddMember(rapidjson::StringRef("key"), keys.Move(), _allocator);
+        json.AddMember(rapidjson::StringRef("key"), keys.Move(), allocator);
     }
     return true;
 }
@@ -70,7 +71,7 @@ bool GetConfigurationReqConverter::toJson(const GetConfigurationReq& data, rapid
 bool GetConfigurationConfConverter::fromJson(const rapidjson::Value& json,
                                              GetConfigurationConf&   data,
                                              std::string&            error_code,
-                                             std::string&            error_message)
+                                             std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -101,34 +102,34 @@ bool GetConfigurationConfConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool GetConfigurationConfConverter::toJson(const GetConfigurationConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool GetConfigurationConfConverter::toJson(const GetConfigurationConf&         data,
+                                           rapidjson::Value&                   json,
+                                           rapidjson::Document::AllocatorType& allocator) const
 {
     if (data.configurationKey.isSet())
     {
-        rapidjson::Value                    configurationKey(rapidjson::kArrayType);
-        rapidjson::Document::AllocatorType& _allocator = json.GetAllocator();
+        rapidjson::Value configurationKey(rapidjson::kArrayType);
         for (const KeyValue& key : data.configurationKey.value())
         {
-            rapidjson::Document value(rapidjson::kObjectType);
-            fill(value, "key", key.key);
-            fill(value, "readonly", key.readonly);
-            fill(value, "value", key.value);
-            configurationKey.PushBack(value.Move(), _allocator);
+            rapidjson::Value value(rapidjson::kObjectType);
+            fill(value, "key", key.key, allocator);
+            fill(value, "readonly", key.readonly, allocator);
+            fill(value, "value", key.value, allocator);
+            configurationKey.PushBack(value.Move(), allocator);
         }
-        json.AddMember(rapidjson::StringRef("configurationKey"), configurationKey.Move(), _allocator);
+        json.AddMember(rapidjson::StringRef("configurationKey"), configurationKey.Move(), allocator);
     }
 
     if (data.unknownKey.isSet())
     {
-        rapidjson::Value                    unknownKey(rapidjson::kArrayType);
-        rapidjson::Document::AllocatorType& _allocator = json.GetAllocator();
+        rapidjson::Value unknownKey(rapidjson::kArrayType);
         for (const auto& key : data.unknownKey.value())
         {
-            unknownKey.PushBack(rapidjson::Value(key.c_str(), static_cast<rapidjson::SizeType>(key.str().size()), _allocator).Move(),
-                                _allocator);
+            unknownKey.PushBack(rapidjson::Value(key.c_str(), static_cast<rapidjson::SizeType>(key.str().size()), allocator).Move(),
+                                allocator);
         }
-        json.AddMember(rapidjson::StringRef("unknownKey"), unknownKey.Move(), _allocator);
+        json.AddMember(rapidjson::StringRef("unknownKey"), unknownKey.Move(), allocator);
     }
     return true;
 }
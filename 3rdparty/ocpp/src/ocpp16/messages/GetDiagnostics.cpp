@@ -32,7 +32,7 @@ namespace ocpp16
 bool GetDiagnosticsReqConverter::fromJson(const rapidjson::Value& json,
                                           GetDiagnosticsReq&      data,
                                           std::string&            error_code,
-                                          std::string&            error_message)
+                                          std::string&            error_message) const
 {
     bool ret;
     extract(json, "location", data.location);
@@ -49,14 +49,16 @@ bool GetDiagnosticsReqConverter::fromJson(const rapidjson::Value& json,
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool GetDiagnosticsReqConverter::toJson(const GetDiagnosticsReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool GetDiagnosticsReqConverter::toJson(const GetDiagnosticsReq&            data,
+                                        rapidjson::Value&                   json,
+                                        rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "location", data.location);
-    fill(json, "retries", data.retries);
-    fill(json, "retryInterval", data.retryInterval);
-    fill(json, "startTime", data.startTime);
-    fill(json, "stopTime", data.stopTime);
+    fill(json, "location", data.location, allocator);
+    fill(json, "retries", data.retries, allocator);
+    fill(json, "retryInterval", data.retryInterval, allocator);
+    fill(json, "startTime", data.startTime, allocator);
+    fill(json, "stopTime", data.stopTime, allocator);
     return true;
 }
 
@@ -64,7 +66,7 @@ bool GetDiagnosticsReqConverter::toJson(const GetDiagnosticsReq& data, rapidjson
 bool GetDiagnosticsConfConverter::fromJson(const rapidjson::Value& json,
                                            GetDiagnosticsConf&     data,
                                            std::string&            error_code,
-                                           std::string&            error_message)
+                                           std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -72,10 +74,12 @@ bool GetDiagnosticsConfConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool GetDiagnosticsConfConverter::toJson(const GetDiagnosticsConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool GetDiagnosticsConfConverter::toJson(const GetDiagnosticsConf&           data,
+                                         rapidjson::Value&                   json,
+                                         rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "fileName", data.fileName);
+    fill(json, "fileName", data.fileName, allocator);
     return true;
 }
 
@@ -49,7 +49,7 @@ namespace ocpp16
 bool GetInstalledCertificateIdsReqConverter::fromJson(const rapidjson::Value&        json,
                                                       GetInstalledCertificateIdsReq& data,
                                                       std::string&                   error_code,
-                                                      std::string&                   error_message)
+                                                      std::string&                   error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -57,10 +57,12 @@ bool GetInstalledCertificateIdsReqConverter::fromJson(const rapidjson::Value&
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool GetInstalledCertificateIdsReqConverter::toJson(const GetInstalledCertificateIdsReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool GetInstalledCertificateIdsReqConverter::toJson(const GetInstalledCertificateIdsReq& data,
+                                                    rapidjson::Value&                    json,
+                                                    rapidjson::Document::AllocatorType&  allocator) const
 {
-    fill(json, "certificateType", CertificateUseEnumTypeHelper.toString(data.certificateType));
+    fill(json, "certificateType", CertificateUseEnumTypeHelper.toString(data.certificateType), allocator);
     return true;
 }
 
@@ -68,7 +70,7 @@ bool GetInstalledCertificateIdsReqConverter::toJson(const GetInstalledCertificat
 bool GetInstalledCertificateIdsConfConverter::fromJson(const rapidjson::Value&         json,
                                                        GetInstalledCertificateIdsConf& data,
                                                        std::string&                    error_code,
-                                                       std::string&                    error_message)
+                                                       std::string&                    error_message) const
 {
     bool ret    = true;
     data.status = GetInstalledCertificateStatusEnumTypeHelper.fromString(json["status"].GetString());
@@ -86,23 +88,24 @@ bool GetInstalledCertificateIdsConfConverter::fromJson(const rapidjson::Value&
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool GetInstalledCertificateIdsConfConverter::toJson(const GetInstalledCertificateIdsConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool GetInstalledCertificateIdsConfConverter::toJson(const GetInstalledCertificateIdsConf& data,
+                                                     rapidjson::Value&                     json,
+                                                     rapidjson::Document::AllocatorType&   allocator) const
 {
     bool ret = true;
-    fill(json, "status", GetInstalledCertificateStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", GetInstalledCertificateStatusEnumTypeHelper.toString(data.status), allocator);
     if (!data.certificateHashData.empty())
     {
         rapidjson::Value                 certificateHashData(rapidjson::kArrayType);
         CertificateHashDataTypeConverter certificate_hash_converter;
-        certificate_hash_converter.setAllocator(allocator);
         for (const CertificateHashDataType& certificate_hash : data.certificateHashData)
         {
-            rapidjson::Document value(rapidjson::kObjectType);
-            ret = ret && certificate_hash_converter.toJson(certificate_hash, value);
-            certificateHashData.PushBack(value.Move(), *allocator);
+            rapidjson::Value value(rapidjson::kObjectType);
+            ret = ret && certificate_hash_converter.toJson(certificate_hash, value, allocator);
+            certificateHashData.PushBack(value.Move(), allocator);
         }
-        json.AddMember(rapidjson::StringRef("certificateHashData"), certificateHashData.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("certificateHashData"), certificateHashData.Move(), allocator);
     }
     return ret;
 }
@@ -31,7 +31,7 @@ namespace ocpp16
 bool GetLocalListVersionReqConverter::fromJson(const rapidjson::Value& json,
                                                GetLocalListVersionReq& data,
                                                std::string&            error_code,
-                                               std::string&            error_message)
+                                               std::string&            error_message) const
 {
     (void)json;
     (void)data;
@@ -40,11 +40,14 @@ bool GetLocalListVersionReqConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool GetLocalListVersionReqConverter::toJson(const GetLocalListVersionReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool GetLocalListVersionReqConverter::toJson(const GetLocalListVersionReq&       data,
+                                             rapidjson::Value&                   json,
+                                             rapidjson::Document::AllocatorType& allocator) const
 {
     (void)data;
     (void)json;
+    (void)allocator;
     return true;
 }
 
@@ -52,7 +55,7 @@ bool GetLocalListVersionReqConverter::toJson(const GetLocalListVersionReq& data,
 bool GetLocalListVersionConfConverter::fromJson(const rapidjson::Value&  json,
                                                 GetLocalListVersionConf& data,
                                                 std::string&             error_code,
-                                                std::string&             error_message)
+                                                std::string&             error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -60,10 +63,12 @@ bool GetLocalListVersionConfConverter::fromJson(const rapidjson::Value&  json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool GetLocalListVersionConfConverter::toJson(const GetLocalListVersionConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool GetLocalListVersionConfConverter::toJson(const GetLocalListVersionConf&      data,
+                                              rapidjson::Value&                   json,
+                                              rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "listVersion", data.listVersion);
+    fill(json, "listVersion", data.listVersion, allocator);
     return true;
 }
 
@@ -46,7 +46,7 @@ namespace ocpp16
 {
 
 /** @copydoc bool IMessageConverter<DataType>::fromJson(const rapidjson::Value&, DataType&, std::string&, std::string&) */
-bool GetLogReqConverter::fromJson(const rapidjson::Value& json, GetLogReq& data, std::string& error_code, std::string& error_message)
+bool GetLogReqConverter::fromJson(const rapidjson::Value& json, GetLogReq& data, std::string& error_code, std::string& error_message) const
 {
     bool ret;
     data.logType = LogEnumTypeHelper.fromString(json["logType"].GetString());
@@ -67,24 +67,27 @@ bool GetLogReqConverter::fromJson(const rapidjson::Value& json, GetLogReq& data,
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool GetLogReqConverter::toJson(const GetLogReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool GetLogReqConverter::toJson(const GetLogReq& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "logType", LogEnumTypeHelper.toString(data.logType));
-    fill(json, "requestId", data.requestId);
-    fill(json, "retries", data.retries);
-    fill(json, "retryInterval", data.retryInterval);
+    fill(json, "logType", LogEnumTypeHelper.toString(data.logType), allocator);
+    fill(json, "requestId", data.requestId, allocator);
+    fill(json, "retries", data.retries, allocator);
+    fill(json, "retryInterval", data.retryInterval, allocator);
 
-    rapidjson::Document log(rapidjson::kObjectType);
-    fill(log, "remoteLocation", data.log.remoteLocation);
-    fill(log, "oldestTimestamp", data.log.oldestTimestamp);
-    fill(log, "latestTimestamp", data.log.latestTimestamp);
-    json.AddMember(rapidjson::StringRef("log"), log.Move(), *allocator);
+    rapidjson::Value log(rapidjson::kObjectType);
+    fill(log, "remoteLocation", data.log.remoteLocation, allocator);
+    fill(log, "oldestTimestamp", data.log.oldestTimestamp, allocator);
+    fill(log, "latestTimestamp", data.log.latestTimestamp, allocator);
+    json.AddMember(rapidjson::StringRef("log"), log.Move(), allocator);
     return true;
 }
 
 /** @copydoc bool IMessageConverter<DataType>::fromJson(const rapidjson::Value&, DataType&, std::string&, std::string&) */
-bool GetLogConfConverter::fromJson(const rapidjson::Value& json, GetLogConf& data, std::string& error_code, std::string& error_message)
+bool GetLogConfConverter::fromJson(const rapidjson::Value& json,
+                                   GetLogConf&             data,
+                                   std::string&            error_code,
+                                   std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -93,11 +96,11 @@ bool GetLogConfConverter::fromJson(const rapidjson::Value& json, GetLogConf& dat
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool GetLogConfConverter::toJson(const GetLogConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool GetLogConfConverter::toJson(const GetLogConf& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", LogStatusEnumTypeHelper.toString(data.status));
-    fill(json, "filename", data.fileName);
+    fill(json, "status", LogStatusEnumTypeHelper.toString(data.status), allocator);
+    fill(json, "filename", data.fileName, allocator);
     return true;
 }
 
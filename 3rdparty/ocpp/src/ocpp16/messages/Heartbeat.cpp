@@ -28,7 +28,10 @@ namespace messages
 namespace ocpp16
 {
 /** @copydoc bool IMessageConverter<DataType>::fromJson(const rapidjson::Value&, DataType&, std::string&, std::string&) */
-bool HeartbeatReqConverter::fromJson(const rapidjson::Value& json, HeartbeatReq& data, std::string& error_code, std::string& error_message)
+bool HeartbeatReqConverter::fromJson(const rapidjson::Value& json,
+                                     HeartbeatReq&           data,
+                                     std::string&            error_code,
+                                     std::string&            error_message) const
 {
     (void)json;
     (void)data;
@@ -37,11 +40,12 @@ bool HeartbeatReqConverter::fromJson(const rapidjson::Value& json, HeartbeatReq&
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool HeartbeatReqConverter::toJson(const HeartbeatReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool HeartbeatReqConverter::toJson(const HeartbeatReq& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
     (void)data;
     (void)json;
+    (void)allocator;
     return true;
 }
 
@@ -49,7 +53,7 @@ bool HeartbeatReqConverter::toJson(const HeartbeatReq& data, rapidjson::Document
 bool HeartbeatConfConverter::fromJson(const rapidjson::Value& json,
                                       HeartbeatConf&          data,
                                       std::string&            error_code,
-                                      std::string&            error_message)
+                                      std::string&            error_message) const
 {
     bool ret = extract(json, "currentTime", data.currentTime, error_message);
     if (!ret)
@@ -59,10 +63,10 @@ bool HeartbeatConfConverter::fromJson(const rapidjson::Value& json,
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool HeartbeatConfConverter::toJson(const HeartbeatConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool HeartbeatConfConverter::toJson(const HeartbeatConf& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "currentTime", data.currentTime.str());
+    fill(json, "currentTime", data.currentTime.str(), allocator);
     return true;
 }
 
@@ -46,7 +46,7 @@ namespace ocpp16
 bool InstallCertificateReqConverter::fromJson(const rapidjson::Value& json,
                                               InstallCertificateReq&  data,
                                               std::string&            error_code,
-                                              std::string&            error_message)
+                                              std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -55,11 +55,13 @@ bool InstallCertificateReqConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool InstallCertificateReqConverter::toJson(const InstallCertificateReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool InstallCertificateReqConverter::toJson(const InstallCertificateReq&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "certificateType", CertificateUseEnumTypeHelper.toString(data.certificateType));
-    fill(json, "certificate", data.certificate);
+    fill(json, "certificateType", CertificateUseEnumTypeHelper.toString(data.certificateType), allocator);
+    fill(json, "certificate", data.certificate, allocator);
     return true;
 }
 
@@ -67,7 +69,7 @@ bool InstallCertificateReqConverter::toJson(const InstallCertificateReq& data, r
 bool InstallCertificateConfConverter::fromJson(const rapidjson::Value& json,
                                                InstallCertificateConf& data,
                                                std::string&            error_code,
-                                               std::string&            error_message)
+                                               std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -75,10 +77,12 @@ bool InstallCertificateConfConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool InstallCertificateConfConverter::toJson(const InstallCertificateConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool InstallCertificateConfConverter::toJson(const InstallCertificateConf&       data,
+                                             rapidjson::Value&                   json,
+                                             rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", CertificateStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", CertificateStatusEnumTypeHelper.toString(data.status), allocator);
     return true;
 }
 
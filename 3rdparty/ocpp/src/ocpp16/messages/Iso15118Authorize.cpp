@@ -50,7 +50,7 @@ namespace ocpp16
 bool Iso15118AuthorizeReqConverter::fromJson(const rapidjson::Value& json,
                                              Iso15118AuthorizeReq&   data,
                                              std::string&            error_code,
-                                             std::string&            error_message)
+                                             std::string&            error_message) const
 {
     bool ret = true;
     extract(json, "certificate", data.certificate);
@@ -69,27 +69,28 @@ bool Iso15118AuthorizeReqConverter::fromJson(const rapidjson::Value& json,
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool Iso15118AuthorizeReqConverter::toJson(const Iso15118AuthorizeReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool Iso15118AuthorizeReqConverter::toJson(const Iso15118AuthorizeReq&         data,
+                                           rapidjson::Value&                   json,
+                                           rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
     if (data.certificate.isSet())
     {
-        fill(json, "certificate", data.certificate);
+        fill(json, "certificate", data.certificate, allocator);
     }
-    fill(json, "idToken", data.idToken);
+    fill(json, "idToken", data.idToken, allocator);
     if (!data.iso15118CertificateHashData.empty())
     {
         rapidjson::Value             certificateHashData(rapidjson::kArrayType);
         OcspRequestDataTypeConverter certificate_hash_converter;
-        certificate_hash_converter.setAllocator(allocator);
         for (const OcspRequestDataType& certificate_hash : data.iso15118CertificateHashData)
         {
-            rapidjson::Document value(rapidjson::kObjectType);
-            ret = ret && certificate_hash_converter.toJson(certificate_hash, value);
-            certificateHashData.PushBack(value.Move(), *allocator);
+            rapidjson::Value value(rapidjson::kObjectType);
+            ret = ret && certificate_hash_converter.toJson(certificate_hash, value, allocator);
+            certificateHashData.PushBack(value.Move(), allocator);
         }
-        json.AddMember(rapidjson::StringRef("iso15118CertificateHashData"), certificateHashData.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("iso15118CertificateHashData"), certificateHashData.Move(), allocator);
     }
     return ret;
 }
@@ -98,7 +99,7 @@ bool Iso15118AuthorizeReqConverter::toJson(const Iso15118AuthorizeReq& data, rap
 bool Iso15118AuthorizeConfConverter::fromJson(const rapidjson::Value& json,
                                               Iso15118AuthorizeConf&  data,
                                               std::string&            error_code,
-                                              std::string&            error_message)
+                                              std::string&            error_message) const
 {
     IdTokenInfoTypeConverter id_token_info_converter;
     bool                     ret = id_token_info_converter.fromJson(json["idTokenInfo"], data.idTokenInfo, error_code, error_message);
@@ -109,17 +110,18 @@ bool Iso15118AuthorizeConfConverter::fromJson(const rapidjson::Value& json,
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool Iso15118AuthorizeConfConverter::toJson(const Iso15118AuthorizeConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool Iso15118AuthorizeConfConverter::toJson(const Iso15118AuthorizeConf&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
     IdTokenInfoTypeConverter id_token_info_converter;
-    id_token_info_converter.setAllocator(allocator);
-    rapidjson::Document id_token_info(rapidjson::kObjectType);
-    bool                ret = id_token_info_converter.toJson(data.idTokenInfo, id_token_info);
-    json.AddMember(rapidjson::StringRef("idTokenInfo"), id_token_info.Move(), *allocator);
+    rapidjson::Value         id_token_info(rapidjson::kObjectType);
+    bool                     ret = id_token_info_converter.toJson(data.idTokenInfo, id_token_info, allocator);
+    json.AddMember(rapidjson::StringRef("idTokenInfo"), id_token_info.Move(), allocator);
     if (data.certificateStatus.isSet())
     {
-        fill(json, "certificateStatus", AuthorizeCertificateStatusEnumTypeHelper.toString(data.certificateStatus));
+        fill(json, "certificateStatus", AuthorizeCertificateStatusEnumTypeHelper.toString(data.certificateStatus), allocator);
     }
     return ret;
 }
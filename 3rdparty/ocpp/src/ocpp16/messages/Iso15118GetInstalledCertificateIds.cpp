@@ -33,7 +33,7 @@ namespace ocpp16
 bool Iso15118GetInstalledCertificateIdsReqConverter::fromJson(const rapidjson::Value&                json,
                                                               Iso15118GetInstalledCertificateIdsReq& data,
                                                               std::string&                           error_code,
-                                                              std::string&                           error_message)
+                                                              std::string&                           error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -48,18 +48,20 @@ bool Iso15118GetInstalledCertificateIdsReqConverter::fromJson(const rapidjson::V
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool Iso15118GetInstalledCertificateIdsReqConverter::toJson(const Iso15118GetInstalledCertificateIdsReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool Iso15118GetInstalledCertificateIdsReqConverter::toJson(const Iso15118GetInstalledCertificateIdsReq& data,
+                                                            rapidjson::Value&                            json,
+                                                            rapidjson::Document::AllocatorType&          allocator) const
 {
     if (!data.certificateType.empty())
     {
         rapidjson::Value certificateType(rapidjson::kArrayType);
         for (const GetCertificateIdUseEnumType& cert_type : data.certificateType)
         {
-            rapidjson::Value value(GetCertificateIdUseEnumTypeHelper.toString(cert_type).c_str(), *allocator);
-            certificateType.PushBack(value.Move(), *allocator);
+            rapidjson::Value value(GetCertificateIdUseEnumTypeHelper.toString(cert_type).c_str(), allocator);
+            certificateType.PushBack(value.Move(), allocator);
         }
-        json.AddMember(rapidjson::StringRef("certificateType"), certificateType.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("certificateType"), certificateType.Move(), allocator);
     }
     return true;
 }
@@ -68,7 +70,7 @@ bool Iso15118GetInstalledCertificateIdsReqConverter::toJson(const Iso15118GetIns
 bool Iso15118GetInstalledCertificateIdsConfConverter::fromJson(const rapidjson::Value&                 json,
                                                                Iso15118GetInstalledCertificateIdsConf& data,
                                                                std::string&                            error_code,
-                                                               std::string&                            error_message)
+                                                               std::string&                            error_message) const
 {
     bool ret    = true;
     data.status = GetInstalledCertificateStatusEnumTypeHelper.fromString(json["status"].GetString());
@@ -86,23 +88,24 @@ bool Iso15118GetInstalledCertificateIdsConfConverter::fromJson(const rapidjson::
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool Iso15118GetInstalledCertificateIdsConfConverter::toJson(const Iso15118GetInstalledCertificateIdsConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool Iso15118GetInstalledCertificateIdsConfConverter::toJson(const Iso15118GetInstalledCertificateIdsConf& data,
+                                                             rapidjson::Value&                             json,
+                                                             rapidjson::Document::AllocatorType&           allocator) const
 {
     bool ret = true;
-    fill(json, "status", GetInstalledCertificateStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", GetInstalledCertificateStatusEnumTypeHelper.toString(data.status), allocator);
     if (!data.certificateHashDataChain.empty())
     {
         rapidjson::Value                      certificateHashDataChain(rapidjson::kArrayType);
         CertificateHashDataChainTypeConverter certificate_hash_converter;
-        certificate_hash_converter.setAllocator(allocator);
         for (const CertificateHashDataChainType& certificate_hash : data.certificateHashDataChain)
         {
-            rapidjson::Document value(rapidjson::kObjectType);
-            ret = ret && certificate_hash_converter.toJson(certificate_hash, value);
-            certificateHashDataChain.PushBack(value.Move(), *allocator);
+            rapidjson::Value value(rapidjson::kObjectType);
+            ret = ret && certificate_hash_converter.toJson(certificate_hash, value, allocator);
+            certificateHashDataChain.PushBack(value.Move(), allocator);
         }
-        json.AddMember(rapidjson::StringRef("certificateHashDataChain"), certificateHashDataChain.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("certificateHashDataChain"), certificateHashDataChain.Move(), allocator);
     }
     return ret;
 }
@@ -52,7 +52,7 @@ namespace ocpp16
 bool Iso15118InstallCertificateReqConverter::fromJson(const rapidjson::Value&        json,
                                                       Iso15118InstallCertificateReq& data,
                                                       std::string&                   error_code,
-                                                      std::string&                   error_message)
+                                                      std::string&                   error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -61,11 +61,13 @@ bool Iso15118InstallCertificateReqConverter::fromJson(const rapidjson::Value&
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool Iso15118InstallCertificateReqConverter::toJson(const Iso15118InstallCertificateReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool Iso15118InstallCertificateReqConverter::toJson(const Iso15118InstallCertificateReq& data,
+                                                    rapidjson::Value&                    json,
+                                                    rapidjson::Document::AllocatorType&  allocator) const
 {
-    fill(json, "certificateType", InstallCertificateUseEnumTypeHelper.toString(data.certificateType));
-    fill(json, "certificate", data.certificate);
+    fill(json, "certificateType", InstallCertificateUseEnumTypeHelper.toString(data.certificateType), allocator);
+    fill(json, "certificate", data.certificate, allocator);
     return true;
 }
 
@@ -73,7 +75,7 @@ bool Iso15118InstallCertificateReqConverter::toJson(const Iso15118InstallCertifi
 bool Iso15118InstallCertificateConfConverter::fromJson(const rapidjson::Value&         json,
                                                        Iso15118InstallCertificateConf& data,
                                                        std::string&                    error_code,
-                                                       std::string&                    error_message)
+                                                       std::string&                    error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -81,10 +83,12 @@ bool Iso15118InstallCertificateConfConverter::fromJson(const rapidjson::Value&
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool Iso15118InstallCertificateConfConverter::toJson(const Iso15118InstallCertificateConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool Iso15118InstallCertificateConfConverter::toJson(const Iso15118InstallCertificateConf& data,
+                                                     rapidjson::Value&                     json,
+                                                     rapidjson::Document::AllocatorType&   allocator) const
 {
-    fill(json, "status", InstallCertificateStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", InstallCertificateStatusEnumTypeHelper.toString(data.status), allocator);
     return true;
 }
 
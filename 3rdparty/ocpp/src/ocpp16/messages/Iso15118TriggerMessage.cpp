@@ -32,7 +32,7 @@ namespace ocpp16
 bool Iso15118TriggerMessageReqConverter::fromJson(const rapidjson::Value&    json,
                                                   Iso15118TriggerMessageReq& data,
                                                   std::string&               error_code,
-                                                  std::string&               error_message)
+                                                  std::string&               error_message) const
 {
     (void)json;
     (void)data;
@@ -41,11 +41,14 @@ bool Iso15118TriggerMessageReqConverter::fromJson(const rapidjson::Value&    jso
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool Iso15118TriggerMessageReqConverter::toJson(const Iso15118TriggerMessageReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool Iso15118TriggerMessageReqConverter::toJson(const Iso15118TriggerMessageReq&    data,
+                                                rapidjson::Value&                   json,
+                                                rapidjson::Document::AllocatorType& allocator) const
 {
     (void)json;
     (void)data;
+    (void)allocator;
     return true;
 }
 
@@ -53,7 +56,7 @@ bool Iso15118TriggerMessageReqConverter::toJson(const Iso15118TriggerMessageReq&
 bool Iso15118TriggerMessageConfConverter::fromJson(const rapidjson::Value&     json,
                                                    Iso15118TriggerMessageConf& data,
                                                    std::string&                error_code,
-                                                   std::string&                error_message)
+                                                   std::string&                error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -61,10 +64,12 @@ bool Iso15118TriggerMessageConfConverter::fromJson(const rapidjson::Value&     j
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool Iso15118TriggerMessageConfConverter::toJson(const Iso15118TriggerMessageConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool Iso15118TriggerMessageConfConverter::toJson(const Iso15118TriggerMessageConf&   data,
+                                                 rapidjson::Value&                   json,
+                                                 rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", TriggerMessageStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", TriggerMessageStatusEnumTypeHelper.toString(data.status), allocator);
     return true;
 }
 
@@ -49,7 +49,7 @@ namespace ocpp16
 bool LogStatusNotificationReqConverter::fromJson(const rapidjson::Value&   json,
                                                  LogStatusNotificationReq& data,
                                                  std::string&              error_code,
-                                                 std::string&              error_message)
+                                                 std::string&              error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -58,11 +58,13 @@ bool LogStatusNotificationReqConverter::fromJson(const rapidjson::Value&   json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool LogStatusNotificationReqConverter::toJson(const LogStatusNotificationReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool LogStatusNotificationReqConverter::toJson(const LogStatusNotificationReq&     data,
+                                               rapidjson::Value&                   json,
+                                               rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", UploadLogStatusEnumTypeHelper.toString(data.status));
-    fill(json, "requestId", data.requestId);
+    fill(json, "status", UploadLogStatusEnumTypeHelper.toString(data.status), allocator);
+    fill(json, "requestId", data.requestId, allocator);
     return true;
 }
 
@@ -70,7 +72,7 @@ bool LogStatusNotificationReqConverter::toJson(const LogStatusNotificationReq& d
 bool LogStatusNotificationConfConverter::fromJson(const rapidjson::Value&    json,
                                                   LogStatusNotificationConf& data,
                                                   std::string&               error_code,
-                                                  std::string&               error_message)
+                                                  std::string&               error_message) const
 {
     (void)json;
     (void)data;
@@ -79,11 +81,14 @@ bool LogStatusNotificationConfConverter::fromJson(const rapidjson::Value&    jso
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool LogStatusNotificationConfConverter::toJson(const LogStatusNotificationConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool LogStatusNotificationConfConverter::toJson(const LogStatusNotificationConf&    data,
+                                                rapidjson::Value&                   json,
+                                                rapidjson::Document::AllocatorType& allocator) const
 {
     (void)json;
     (void)data;
+    (void)allocator;
     return true;
 }
 
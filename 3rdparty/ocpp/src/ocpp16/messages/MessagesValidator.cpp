@@ -144,6 +144,23 @@ ocpp::json::JsonValidator* MessagesValidator::getValidator(const std::string& ac
     return validator;
 }
 
+/** @brief Get the message validator corresponding to a given action, shared with the caller */
+std::shared_ptr<ocpp::json::JsonValidator> MessagesValidator::getSharedValidator(const std::string& action, bool is_req) const
+{
+    std::shared_ptr<ocpp::json::JsonValidator> validator;
+
+    // Get validators list
+    const auto& validators = (is_req ? m_req_validators : m_resp_validators);
+
+    auto iter = validators.find(action);
+    if (iter != validators.cend())
+    {
+        validator = iter->second;
+    }
+
+    return validator;
+}
+
 /** @brief Add a message validator bfor both request and response */
 bool MessagesValidator::addValidator(const std::string& schemas_path, const std::string& action)
 {
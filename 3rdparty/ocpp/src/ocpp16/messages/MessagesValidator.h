@@ -50,6 +50,12 @@ class MessagesValidator : public IMessagesValidator
     /** @copydoc ocpp::json::JsonValidator* IMessagesValidator::getValidator(const std::string&, bool) const */
     ocpp::json::JsonValidator* getValidator(const std::string& action, bool is_req) const override;
 
+    /** @copydoc std::shared_ptr<ocpp::json::JsonValidator> IMessagesValidator::getSharedValidator(const std::string&, bool) const */
+    std::shared_ptr<ocpp::json::JsonValidator> getSharedValidator(const std::string& action, bool is_req) const override;
+
+    /** @copydoc bool IMessagesValidator::isSchemaValidationOptional() const */
+    bool isSchemaValidationOptional() const override { return false; }
+
   private:
     /** @brief Messages validators for requests */
     std::unordered_map<std::string, std::shared_ptr<ocpp::json::JsonValidator>> m_req_validators;
@@ -105,7 +105,7 @@ namespace ocpp16
 bool MeterValuesReqConverter::fromJson(const rapidjson::Value& json,
                                        MeterValuesReq&         data,
                                        std::string&            error_code,
-                                       std::string&            error_message)
+                                       std::string&            error_message) const
 {
     bool ret = extract(json, "connectorId", data.connectorId, error_message);
     extract(json, "transactionId", data.transactionId);
@@ -121,24 +121,25 @@ bool MeterValuesReqConverter::fromJson(const rapidjson::Value& json,
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool MeterValuesReqConverter::toJson(const MeterValuesReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool MeterValuesReqConverter::toJson(const MeterValuesReq&               data,
+                                     rapidjson::Value&                   json,
+                                     rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
-    fill(json, "connectorId", data.connectorId);
-    fill(json, "transactionId", data.transactionId);
+    fill(json, "connectorId", data.connectorId, allocator);
+    fill(json, "transactionId", data.transactionId, allocator);
 
     rapidjson::Value    meterValue(rapidjson::kArrayType);
     MeterValueConverter metervalue_converter;
-    metervalue_converter.setAllocator(allocator);
     for (const MeterValue& meter_value : data.meterValue)
     {
-        rapidjson::Document value(rapidjson::kObjectType);
-        ret = ret && metervalue_converter.toJson(meter_value, value);
-        meterValue.PushBack(value.Move(), *allocator);
+        rapidjson::Value value(rapidjson::kObjectType);
+        ret = ret && metervalue_converter.toJson(meter_value, value, allocator);
+        meterValue.PushBack(value.Move(), allocator);
     }
-    json.AddMember(rapidjson::StringRef("meterValue"), meterValue.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("meterValue"), meterValue.Move(), allocator);
 
     return ret;
 }
@@ -147,7 +148,7 @@ bool MeterValuesReqConverter::toJson(const MeterValuesReq& data, rapidjson::Docu
 bool MeterValuesConfConverter::fromJson(const rapidjson::Value& json,
                                         MeterValuesConf&        data,
                                         std::string&            error_code,
-                                        std::string&            error_message)
+                                        std::string&            error_message) const
 {
     (void)json;
     (void)data;
@@ -156,11 +157,14 @@ bool MeterValuesConfConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool MeterValuesConfConverter::toJson(const MeterValuesConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool MeterValuesConfConverter::toJson(const MeterValuesConf&              data,
+                                      rapidjson::Value&                   json,
+                                      rapidjson::Document::AllocatorType& allocator) const
 {
     (void)data;
     (void)json;
+    (void)allocator;
     return true;
 }
 
@@ -44,7 +44,7 @@ namespace ocpp16
 bool RemoteStartTransactionReqConverter::fromJson(const rapidjson::Value&    json,
                                                   RemoteStartTransactionReq& data,
                                                   std::string&               error_code,
-                                                  std::string&               error_message)
+                                                  std::string&               error_message) const
 {
     bool ret = extract(json, "connectorId", data.connectorId, error_message);
     if (ret && (data.connectorId == 0u))
@@ -64,20 +64,21 @@ bool RemoteStartTransactionReqConverter::fromJson(const rapidjson::Value&    jso
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool RemoteStartTransactionReqConverter::toJson(const RemoteStartTransactionReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool RemoteStartTransactionReqConverter::toJson(const RemoteStartTransactionReq&    data,
+                                                rapidjson::Value&                   json,
+                                                rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
-    fill(json, "connectorId", data.connectorId);
-    fill(json, "idTag", data.idTag);
+    fill(json, "connectorId", data.connectorId, allocator);
+    fill(json, "idTag", data.idTag, allocator);
     if (data.chargingProfile.isSet())
     {
         ChargingProfileConverter charging_profile_converter;
-        charging_profile_converter.setAllocator(allocator);
 
-        rapidjson::Document chargingProfile(rapidjson::kObjectType);
-        ret = charging_profile_converter.toJson(data.chargingProfile, chargingProfile);
-        json.AddMember(rapidjson::StringRef("chargingProfile"), chargingProfile.Move(), *allocator);
+        rapidjson::Value chargingProfile(rapidjson::kObjectType);
+        ret = charging_profile_converter.toJson(data.chargingProfile, chargingProfile, allocator);
+        json.AddMember(rapidjson::StringRef("chargingProfile"), chargingProfile.Move(), allocator);
     }
 
     return ret;
@@ -87,7 +88,7 @@ bool RemoteStartTransactionReqConverter::toJson(const RemoteStartTransactionReq&
 bool RemoteStartTransactionConfConverter::fromJson(const rapidjson::Value&     json,
                                                    RemoteStartTransactionConf& data,
                                                    std::string&                error_code,
-                                                   std::string&                error_message)
+                                                   std::string&                error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -95,10 +96,12 @@ bool RemoteStartTransactionConfConverter::fromJson(const rapidjson::Value&     j
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool RemoteStartTransactionConfConverter::toJson(const RemoteStartTransactionConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool RemoteStartTransactionConfConverter::toJson(const RemoteStartTransactionConf&   data,
+                                                 rapidjson::Value&                   json,
+                                                 rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", RemoteStartStopStatusHelper.toString(data.status));
+    fill(json, "status", RemoteStartStopStatusHelper.toString(data.status), allocator);
     return true;
 }
 
@@ -32,7 +32,7 @@ namespace ocpp16
 bool RemoteStopTransactionReqConverter::fromJson(const rapidjson::Value&   json,
                                                  RemoteStopTransactionReq& data,
                                                  std::string&              error_code,
-                                                 std::string&              error_message)
+                                                 std::string&              error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -40,10 +40,12 @@ bool RemoteStopTransactionReqConverter::fromJson(const rapidjson::Value&   json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool RemoteStopTransactionReqConverter::toJson(const RemoteStopTransactionReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool RemoteStopTransactionReqConverter::toJson(const RemoteStopTransactionReq&     data,
+                                               rapidjson::Value&                   json,
+                                               rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "transactionId", data.transactionId);
+    fill(json, "transactionId", data.transactionId, allocator);
     return true;
 }
 
@@ -51,7 +53,7 @@ bool RemoteStopTransactionReqConverter::toJson(const RemoteStopTransactionReq& d
 bool RemoteStopTransactionConfConverter::fromJson(const rapidjson::Value&    json,
                                                   RemoteStopTransactionConf& data,
                                                   std::string&               error_code,
-                                                  std::string&               error_message)
+                                                  std::string&               error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -59,10 +61,12 @@ bool RemoteStopTransactionConfConverter::fromJson(const rapidjson::Value&    jso
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool RemoteStopTransactionConfConverter::toJson(const RemoteStopTransactionConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool RemoteStopTransactionConfConverter::toJson(const RemoteStopTransactionConf&    data,
+                                                rapidjson::Value&                   json,
+                                                rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", RemoteStartStopStatusHelper.toString(data.status));
+    fill(json, "status", RemoteStartStopStatusHelper.toString(data.status), allocator);
     return true;
 }
 
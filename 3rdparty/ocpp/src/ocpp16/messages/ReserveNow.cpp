@@ -46,7 +46,7 @@ namespace ocpp16
 bool ReserveNowReqConverter::fromJson(const rapidjson::Value& json,
                                       ReserveNowReq&          data,
                                       std::string&            error_code,
-                                      std::string&            error_message)
+                                      std::string&            error_message) const
 {
     bool ret;
     ret = extract(json, "connectorId", data.connectorId, error_message);
@@ -61,14 +61,14 @@ bool ReserveNowReqConverter::fromJson(const rapidjson::Value& json,
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool ReserveNowReqConverter::toJson(const ReserveNowReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool ReserveNowReqConverter::toJson(const ReserveNowReq& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "connectorId", data.connectorId);
-    fill(json, "expiryDate", data.expiryDate);
-    fill(json, "idTag", data.idTag);
-    fill(json, "parentIdTag", data.parentIdTag);
-    fill(json, "reservationId", data.reservationId);
+    fill(json, "connectorId", data.connectorId, allocator);
+    fill(json, "expiryDate", data.expiryDate, allocator);
+    fill(json, "idTag", data.idTag, allocator);
+    fill(json, "parentIdTag", data.parentIdTag, allocator);
+    fill(json, "reservationId", data.reservationId, allocator);
     return true;
 }
 
@@ -76,7 +76,7 @@ bool ReserveNowReqConverter::toJson(const ReserveNowReq& data, rapidjson::Docume
 bool ReserveNowConfConverter::fromJson(const rapidjson::Value& json,
                                        ReserveNowConf&         data,
                                        std::string&            error_code,
-                                       std::string&            error_message)
+                                       std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -84,10 +84,12 @@ bool ReserveNowConfConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool ReserveNowConfConverter::toJson(const ReserveNowConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool ReserveNowConfConverter::toJson(const ReserveNowConf&               data,
+                                     rapidjson::Value&                   json,
+                                     rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", ReservationStatusHelper.toString(data.status));
+    fill(json, "status", ReservationStatusHelper.toString(data.status), allocator);
     return true;
 }
 
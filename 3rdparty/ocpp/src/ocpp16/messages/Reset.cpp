@@ -40,7 +40,7 @@ namespace messages
 namespace ocpp16
 {
 /** @copydoc bool IMessageConverter<DataType>::fromJson(const rapidjson::Value&, DataType&, std::string&, std::string&) */
-bool ResetReqConverter::fromJson(const rapidjson::Value& json, ResetReq& data, std::string& error_code, std::string& error_message)
+bool ResetReqConverter::fromJson(const rapidjson::Value& json, ResetReq& data, std::string& error_code, std::string& error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -48,15 +48,15 @@ bool ResetReqConverter::fromJson(const rapidjson::Value& json, ResetReq& data, s
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool ResetReqConverter::toJson(const ResetReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool ResetReqConverter::toJson(const ResetReq& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "type", ResetTypeHelper.toString(data.type));
+    fill(json, "type", ResetTypeHelper.toString(data.type), allocator);
     return true;
 }
 
 /** @copydoc bool IMessageConverter<DataType>::fromJson(const rapidjson::Value&, DataType&, std::string&, std::string&) */
-bool ResetConfConverter::fromJson(const rapidjson::Value& json, ResetConf& data, std::string& error_code, std::string& error_message)
+bool ResetConfConverter::fromJson(const rapidjson::Value& json, ResetConf& data, std::string& error_code, std::string& error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -64,10 +64,10 @@ bool ResetConfConverter::fromJson(const rapidjson::Value& json, ResetConf& data,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool ResetConfConverter::toJson(const ResetConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool ResetConfConverter::toJson(const ResetConf& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", ResetStatusHelper.toString(data.status));
+    fill(json, "status", ResetStatusHelper.toString(data.status), allocator);
     return true;
 }
 
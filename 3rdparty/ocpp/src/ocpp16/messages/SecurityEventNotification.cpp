@@ -31,7 +31,7 @@ namespace ocpp16
 bool SecurityEventNotificationReqConverter::fromJson(const rapidjson::Value&       json,
                                                      SecurityEventNotificationReq& data,
                                                      std::string&                  error_code,
-                                                     std::string&                  error_message)
+                                                     std::string&                  error_message) const
 {
     extract(json, "type", data.type);
     bool ret = extract(json, "timestamp", data.timestamp, error_message);
@@ -43,12 +43,14 @@ bool SecurityEventNotificationReqConverter::fromJson(const rapidjson::Value&
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool SecurityEventNotificationReqConverter::toJson(const SecurityEventNotificationReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool SecurityEventNotificationReqConverter::toJson(const SecurityEventNotificationReq& data,
+                                                   rapidjson::Value&                   json,
+                                                   rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "type", data.type);
-    fill(json, "timestamp", data.timestamp);
-    fill(json, "techInfo", data.techInfo);
+    fill(json, "type", data.type, allocator);
+    fill(json, "timestamp", data.timestamp, allocator);
+    fill(json, "techInfo", data.techInfo, allocator);
     return true;
 }
 
@@ -56,7 +58,7 @@ bool SecurityEventNotificationReqConverter::toJson(const SecurityEventNotificati
 bool SecurityEventNotificationConfConverter::fromJson(const rapidjson::Value&        json,
                                                       SecurityEventNotificationConf& data,
                                                       std::string&                   error_code,
-                                                      std::string&                   error_message)
+                                                      std::string&                   error_message) const
 {
     (void)json;
     (void)data;
@@ -65,11 +67,14 @@ bool SecurityEventNotificationConfConverter::fromJson(const rapidjson::Value&
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool SecurityEventNotificationConfConverter::toJson(const SecurityEventNotificationConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool SecurityEventNotificationConfConverter::toJson(const SecurityEventNotificationConf& data,
+                                                    rapidjson::Value&                    json,
+                                                    rapidjson::Document::AllocatorType&  allocator) const
 {
     (void)json;
     (void)data;
+    (void)allocator;
     return true;
 }
 
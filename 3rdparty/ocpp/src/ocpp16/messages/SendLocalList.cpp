@@ -48,7 +48,7 @@ namespace ocpp16
 bool SendLocalListReqConverter::fromJson(const rapidjson::Value& json,
                                          SendLocalListReq&       data,
                                          std::string&            error_code,
-                                         std::string&            error_message)
+                                         std::string&            error_message) const
 {
     bool ret = true;
     extract(json, "listVersion", data.listVersion);
@@ -69,25 +69,26 @@ bool SendLocalListReqConverter::fromJson(const rapidjson::Value& json,
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool SendLocalListReqConverter::toJson(const SendLocalListReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool SendLocalListReqConverter::toJson(const SendLocalListReq&             data,
+                                       rapidjson::Value&                   json,
+                                       rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
-    fill(json, "listVersion", data.listVersion);
+    fill(json, "listVersion", data.listVersion, allocator);
     if (!data.localAuthorizationList.empty())
     {
         AuthorizationDataConverter authorization_data_converter;
-        authorization_data_converter.setAllocator(allocator);
-        rapidjson::Value localAuthorizationList(rapidjson::kArrayType);
+        rapidjson::Value           localAuthorizationList(rapidjson::kArrayType);
         for (const AuthorizationData& authorization_data : data.localAuthorizationList)
         {
-            rapidjson::Document value(rapidjson::kObjectType);
-            ret = ret && authorization_data_converter.toJson(authorization_data, value);
-            localAuthorizationList.PushBack(value.Move(), *allocator);
+            rapidjson::Value value(rapidjson::kObjectType);
+            ret = ret && authorization_data_converter.toJson(authorization_data, value, allocator);
+            localAuthorizationList.PushBack(value.Move(), allocator);
         }
-        json.AddMember(rapidjson::StringRef("localAuthorizationList"), localAuthorizationList.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("localAuthorizationList"), localAuthorizationList.Move(), allocator);
     }
-    fill(json, "updateType", UpdateTypeHelper.toString(data.updateType));
+    fill(json, "updateType", UpdateTypeHelper.toString(data.updateType), allocator);
     return ret;
 }
 
@@ -95,7 +96,7 @@ bool SendLocalListReqConverter::toJson(const SendLocalListReq& data, rapidjson::
 bool SendLocalListConfConverter::fromJson(const rapidjson::Value& json,
                                           SendLocalListConf&      data,
                                           std::string&            error_code,
-                                          std::string&            error_message)
+                                          std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -103,10 +104,12 @@ bool SendLocalListConfConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool SendLocalListConfConverter::toJson(const SendLocalListConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool SendLocalListConfConverter::toJson(const SendLocalListConf&            data,
+                                        rapidjson::Value&                   json,
+                                        rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", UpdateStatusHelper.toString(data.status));
+    fill(json, "status", UpdateStatusHelper.toString(data.status), allocator);
     return true;
 }
 
@@ -59,7 +59,7 @@ namespace ocpp16
 bool SetChargingProfileReqConverter::fromJson(const rapidjson::Value& json,
                                               SetChargingProfileReq&  data,
                                               std::string&            error_code,
-                                              std::string&            error_message)
+                                              std::string&            error_message) const
 {
     bool ret = extract(json, "connectorId", data.connectorId, error_message);
 
@@ -74,20 +74,21 @@ bool SetChargingProfileReqConverter::fromJson(const rapidjson::Value& json,
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool SetChargingProfileReqConverter::toJson(const SetChargingProfileReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool SetChargingProfileReqConverter::toJson(const SetChargingProfileReq&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
     (void)data;
     (void)json;
 
-    fill(json, "connectorId", data.connectorId);
+    fill(json, "connectorId", data.connectorId, allocator);
 
     ChargingProfileConverter charging_profile_converter;
-    charging_profile_converter.setAllocator(allocator);
 
-    rapidjson::Document csChargingProfiles(rapidjson::kObjectType);
-    bool                ret = charging_profile_converter.toJson(data.csChargingProfiles, csChargingProfiles);
-    json.AddMember(rapidjson::StringRef("csChargingProfiles"), csChargingProfiles.Move(), *allocator);
+    rapidjson::Value csChargingProfiles(rapidjson::kObjectType);
+    bool             ret = charging_profile_converter.toJson(data.csChargingProfiles, csChargingProfiles, allocator);
+    json.AddMember(rapidjson::StringRef("csChargingProfiles"), csChargingProfiles.Move(), allocator);
 
     return ret;
 }
@@ -96,7 +97,7 @@ bool SetChargingProfileReqConverter::toJson(const SetChargingProfileReq& data, r
 bool SetChargingProfileConfConverter::fromJson(const rapidjson::Value& json,
                                                SetChargingProfileConf& data,
                                                std::string&            error_code,
-                                               std::string&            error_message)
+                                               std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -105,10 +106,12 @@ bool SetChargingProfileConfConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool SetChargingProfileConfConverter::toJson(const SetChargingProfileConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool SetChargingProfileConfConverter::toJson(const SetChargingProfileConf&       data,
+                                             rapidjson::Value&                   json,
+                                             rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", ChargingProfileStatusHelper.toString(data.status));
+    fill(json, "status", ChargingProfileStatusHelper.toString(data.status), allocator);
     return true;
 }
 
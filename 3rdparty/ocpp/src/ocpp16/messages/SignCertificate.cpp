@@ -44,7 +44,7 @@ namespace ocpp16
 bool SignCertificateReqConverter::fromJson(const rapidjson::Value& json,
                                            SignCertificateReq&     data,
                                            std::string&            error_code,
-                                           std::string&            error_message)
+                                           std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -52,10 +52,12 @@ bool SignCertificateReqConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool SignCertificateReqConverter::toJson(const SignCertificateReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool SignCertificateReqConverter::toJson(const SignCertificateReq&           data,
+                                         rapidjson::Value&                   json,
+                                         rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "csr", data.csr);
+    fill(json, "csr", data.csr, allocator);
     return true;
 }
 
@@ -63,7 +65,7 @@ bool SignCertificateReqConverter::toJson(const SignCertificateReq& data, rapidjs
 bool SignCertificateConfConverter::fromJson(const rapidjson::Value& json,
                                             SignCertificateConf&    data,
                                             std::string&            error_code,
-                                            std::string&            error_message)
+                                            std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -71,10 +73,12 @@ bool SignCertificateConfConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool SignCertificateConfConverter::toJson(const SignCertificateConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool SignCertificateConfConverter::toJson(const SignCertificateConf&          data,
+                                          rapidjson::Value&                   json,
+                                          rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", GenericStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", GenericStatusEnumTypeHelper.toString(data.status), allocator);
     return true;
 }
 
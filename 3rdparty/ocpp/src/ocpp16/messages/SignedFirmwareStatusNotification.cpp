@@ -56,7 +56,7 @@ namespace ocpp16
 bool SignedFirmwareStatusNotificationReqConverter::fromJson(const rapidjson::Value&              json,
                                                             SignedFirmwareStatusNotificationReq& data,
                                                             std::string&                         error_code,
-                                                            std::string&                         error_message)
+                                                            std::string&                         error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -65,11 +65,13 @@ bool SignedFirmwareStatusNotificationReqConverter::fromJson(const rapidjson::Val
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool SignedFirmwareStatusNotificationReqConverter::toJson(const SignedFirmwareStatusNotificationReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool SignedFirmwareStatusNotificationReqConverter::toJson(const SignedFirmwareStatusNotificationReq& data,
+                                                          rapidjson::Value&                          json,
+                                                          rapidjson::Document::AllocatorType&        allocator) const
 {
-    fill(json, "status", FirmwareStatusEnumTypeHelper.toString(data.status));
-    fill(json, "requestId", data.requestId);
+    fill(json, "status", FirmwareStatusEnumTypeHelper.toString(data.status), allocator);
+    fill(json, "requestId", data.requestId, allocator);
     return true;
 }
 
@@ -77,7 +79,7 @@ bool SignedFirmwareStatusNotificationReqConverter::toJson(const SignedFirmwareSt
 bool SignedFirmwareStatusNotificationConfConverter::fromJson(const rapidjson::Value&               json,
                                                              SignedFirmwareStatusNotificationConf& data,
                                                              std::string&                          error_code,
-                                                             std::string&                          error_message)
+                                                             std::string&                          error_message) const
 {
     (void)json;
     (void)data;
@@ -86,11 +88,14 @@ bool SignedFirmwareStatusNotificationConfConverter::fromJson(const rapidjson::Va
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool SignedFirmwareStatusNotificationConfConverter::toJson(const SignedFirmwareStatusNotificationConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool SignedFirmwareStatusNotificationConfConverter::toJson(const SignedFirmwareStatusNotificationConf& data,
+                                                           rapidjson::Value&                           json,
+                                                           rapidjson::Document::AllocatorType&         allocator) const
 {
     (void)json;
     (void)data;
+    (void)allocator;
     return true;
 }
 
@@ -49,7 +49,7 @@ namespace ocpp16
 bool SignedUpdateFirmwareReqConverter::fromJson(const rapidjson::Value&  json,
                                                 SignedUpdateFirmwareReq& data,
                                                 std::string&             error_code,
-                                                std::string&             error_message)
+                                                std::string&             error_message) const
 {
     bool ret;
     extract(json, "requestId", data.requestId);
@@ -71,20 +71,22 @@ bool SignedUpdateFirmwareReqConverter::fromJson(const rapidjson::Value&  json,
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool SignedUpdateFirmwareReqConverter::toJson(const SignedUpdateFirmwareReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool SignedUpdateFirmwareReqConverter::toJson(const SignedUpdateFirmwareReq&      data,
+                                              rapidjson::Value&                   json,
+                                              rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "requestId", data.requestId);
-    fill(json, "retries", data.retries);
-    fill(json, "retryInterval", data.retryInterval);
+    fill(json, "requestId", data.requestId, allocator);
+    fill(json, "retries", data.retries, allocator);
+    fill(json, "retryInterval", data.retryInterval, allocator);
 
-    rapidjson::Document firmware(rapidjson::kObjectType);
-    fill(firmware, "location", data.firmware.location);
-    fill(firmware, "retrieveDateTime", data.firmware.retrieveDateTime);
-    fill(firmware, "installDateTime", data.firmware.installDateTime);
-    fill(firmware, "signingCertificate", data.firmware.signingCertificate);
-    fill(firmware, "signature", data.firmware.signature);
-    json.AddMember(rapidjson::StringRef("firmware"), firmware.Move(), *allocator);
+    rapidjson::Value firmware(rapidjson::kObjectType);
+    fill(firmware, "location", data.firmware.location, allocator);
+    fill(firmware, "retrieveDateTime", data.firmware.retrieveDateTime, allocator);
+    fill(firmware, "installDateTime", data.firmware.installDateTime, allocator);
+    fill(firmware, "signingCertificate", data.firmware.signingCertificate, allocator);
+    fill(firmware, "signature", data.firmware.signature, allocator);
+    json.AddMember(rapidjson::StringRef("firmware"), firmware.Move(), allocator);
     return true;
 }
 
@@ -92,7 +94,7 @@ bool SignedUpdateFirmwareReqConverter::toJson(const SignedUpdateFirmwareReq& dat
 bool SignedUpdateFirmwareConfConverter::fromJson(const rapidjson::Value&   json,
                                                  SignedUpdateFirmwareConf& data,
                                                  std::string&              error_code,
-                                                 std::string&              error_message)
+                                                 std::string&              error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -100,10 +102,12 @@ bool SignedUpdateFirmwareConfConverter::fromJson(const rapidjson::Value&   json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool SignedUpdateFirmwareConfConverter::toJson(const SignedUpdateFirmwareConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool SignedUpdateFirmwareConfConverter::toJson(const SignedUpdateFirmwareConf&     data,
+                                               rapidjson::Value&                   json,
+                                               rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", UpdateFirmwareStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", UpdateFirmwareStatusEnumTypeHelper.toString(data.status), allocator);
     return true;
 }
 
@@ -33,7 +33,7 @@ namespace ocpp16
 bool StartTransactionReqConverter::fromJson(const rapidjson::Value& json,
                                             StartTransactionReq&    data,
                                             std::string&            error_code,
-                                            std::string&            error_message)
+                                            std::string&            error_message) const
 {
     bool ret = extract(json, "connectorId", data.connectorId, error_message);
     if (ret && (data.connectorId == 0))
@@ -51,14 +51,16 @@ bool StartTransactionReqConverter::fromJson(const rapidjson::Value& json,
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool StartTransactionReqConverter::toJson(const StartTransactionReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool StartTransactionReqConverter::toJson(const StartTransactionReq&          data,
+                                          rapidjson::Value&                   json,
+                                          rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "connectorId", data.connectorId);
-    fill(json, "idTag", data.idTag);
-    fill(json, "meterStart", data.meterStart);
-    fill(json, "reservationId", data.reservationId);
-    fill(json, "timestamp", data.timestamp);
+    fill(json, "connectorId", data.connectorId, allocator);
+    fill(json, "idTag", data.idTag, allocator);
+    fill(json, "meterStart", data.meterStart, allocator);
+    fill(json, "reservationId", data.reservationId, allocator);
+    fill(json, "timestamp", data.timestamp, allocator);
     return true;
 }
 
@@ -66,7 +68,7 @@ bool StartTransactionReqConverter::toJson(const StartTransactionReq& data, rapid
 bool StartTransactionConfConverter::fromJson(const rapidjson::Value& json,
                                              StartTransactionConf&   data,
                                              std::string&            error_code,
-                                             std::string&            error_message)
+                                             std::string&            error_message) const
 {
     IdTagInfoConverter id_tag_info_converter;
     bool               ret = id_tag_info_converter.fromJson(json["idTagInfo"], data.idTagInfo, error_code, error_message);
@@ -78,16 +80,17 @@ bool StartTransactionConfConverter::fromJson(const rapidjson::Value& json,
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool StartTransactionConfConverter::toJson(const StartTransactionConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool StartTransactionConfConverter::toJson(const StartTransactionConf&         data,
+                                           rapidjson::Value&                   json,
+                                           rapidjson::Document::AllocatorType& allocator) const
 {
     IdTagInfoConverter id_tag_info_converter;
-    id_tag_info_converter.setAllocator(allocator);
 
-    rapidjson::Document id_tag_info(rapidjson::kObjectType);
-    bool                ret = id_tag_info_converter.toJson(data.idTagInfo, id_tag_info);
-    json.AddMember(rapidjson::StringRef("idTagInfo"), id_tag_info.Move(), *allocator);
-    fill(json, "transactionId", data.transactionId);
+    rapidjson::Value id_tag_info(rapidjson::kObjectType);
+    bool             ret = id_tag_info_converter.toJson(data.idTagInfo, id_tag_info, allocator);
+    json.AddMember(rapidjson::StringRef("idTagInfo"), id_tag_info.Move(), allocator);
+    fill(json, "transactionId", data.transactionId, allocator);
     return ret;
 }
 
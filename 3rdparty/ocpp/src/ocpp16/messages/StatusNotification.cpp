@@ -69,7 +69,7 @@ namespace ocpp16
 bool StatusNotificationReqConverter::fromJson(const rapidjson::Value& json,
                                               StatusNotificationReq&  data,
                                               std::string&            error_code,
-                                              std::string&            error_message)
+                                              std::string&            error_message) const
 {
     bool ret;
     ret            = extract(json, "connectorId", data.connectorId, error_message);
@@ -86,19 +86,21 @@ bool StatusNotificationReqConverter::fromJson(const rapidjson::Value& json,
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool StatusNotificationReqConverter::toJson(const StatusNotificationReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool StatusNotificationReqConverter::toJson(const StatusNotificationReq&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "connectorId", data.connectorId);
-    fill(json, "errorCode", ChargePointErrorCodeHelper.toString(data.errorCode));
-    fill(json, "status", ChargePointStatusHelper.toString(data.status));
-    fill(json, "timestamp", data.timestamp);
+    fill(json, "connectorId", data.connectorId, allocator);
+    fill(json, "errorCode", ChargePointErrorCodeHelper.toString(data.errorCode), allocator);
+    fill(json, "status", ChargePointStatusHelper.toString(data.status), allocator);
+    fill(json, "timestamp", data.timestamp, allocator);
     if (data.info.isSet())
-        fill(json, "info", data.info);
+        fill(json, "info", data.info, allocator);
     if (data.vendorId.isSet())
-        fill(json, "vendorId", data.vendorId);
+        fill(json, "vendorId", data.vendorId, allocator);
     if (data.vendorErrorCode.isSet())
-        fill(json, "vendorErrorCode", data.vendorErrorCode);
+        fill(json, "vendorErrorCode", data.vendorErrorCode, allocator);
     return true;
 }
 
@@ -106,7 +108,7 @@ bool StatusNotificationReqConverter::toJson(const StatusNotificationReq& data, r
 bool StatusNotificationConfConverter::fromJson(const rapidjson::Value& json,
                                                StatusNotificationConf& data,
                                                std::string&            error_code,
-                                               std::string&            error_message)
+                                               std::string&            error_message) const
 {
     (void)json;
     (void)data;
@@ -115,11 +117,14 @@ bool StatusNotificationConfConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool StatusNotificationConfConverter::toJson(const StatusNotificationConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool StatusNotificationConfConverter::toJson(const StatusNotificationConf&       data,
+                                             rapidjson::Value&                   json,
+                                             rapidjson::Document::AllocatorType& allocator) const
 {
     (void)data;
     (void)json;
+    (void)allocator;
     return true;
 }
 
@@ -55,7 +55,7 @@ namespace ocpp16
 bool StopTransactionReqConverter::fromJson(const rapidjson::Value& json,
                                            StopTransactionReq&     data,
                                            std::string&            error_code,
-                                           std::string&            error_message)
+                                           std::string&            error_message) const
 {
     extract(json, "idTag", data.idTag);
     extract(json, "meterStop", data.meterStop);
@@ -83,30 +83,31 @@ bool StopTransactionReqConverter::fromJson(const rapidjson::Value& json,
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool StopTransactionReqConverter::toJson(const StopTransactionReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool StopTransactionReqConverter::toJson(const StopTransactionReq&           data,
+                                         rapidjson::Value&                   json,
+                                         rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
-    fill(json, "idTag", data.idTag);
-    fill(json, "meterStop", data.meterStop);
-    fill(json, "timestamp", data.timestamp);
-    fill(json, "transactionId", data.transactionId);
+    fill(json, "idTag", data.idTag, allocator);
+    fill(json, "meterStop", data.meterStop, allocator);
+    fill(json, "timestamp", data.timestamp, allocator);
+    fill(json, "transactionId", data.transactionId, allocator);
     if (data.reason.isSet())
     {
-        fill(json, "reason", ReasonHelper.toString(data.reason));
+        fill(json, "reason", ReasonHelper.toString(data.reason), allocator);
     }
     if (!data.transactionData.empty())
     {
         rapidjson::Value    transactionData(rapidjson::kArrayType);
         MeterValueConverter metervalue_converter;
-        metervalue_converter.setAllocator(allocator);
         for (const MeterValue& meter_value : data.transactionData)
         {
-            rapidjson::Document value(rapidjson::kObjectType);
-            ret = ret && metervalue_converter.toJson(meter_value, value);
-            transactionData.PushBack(value.Move(), *allocator);
+            rapidjson::Value value(rapidjson::kObjectType);
+            ret = ret && metervalue_converter.toJson(meter_value, value, allocator);
+            transactionData.PushBack(value.Move(), allocator);
         }
-        json.AddMember(rapidjson::StringRef("transactionData"), transactionData.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("transactionData"), transactionData.Move(), allocator);
     }
     return ret;
 }
@@ -115,7 +116,7 @@ bool StopTransactionReqConverter::toJson(const StopTransactionReq& data, rapidjs
 bool StopTransactionConfConverter::fromJson(const rapidjson::Value& json,
                                             StopTransactionConf&    data,
                                             std::string&            error_code,
-                                            std::string&            error_message)
+                                            std::string&            error_message) const
 {
     bool ret = true;
     if (json.HasMember("idTagInfo"))
@@ -126,18 +127,19 @@ bool StopTransactionConfConverter::fromJson(const rapidjson::Value& json,
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool StopTransactionConfConverter::toJson(const StopTransactionConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool StopTransactionConfConverter::toJson(const StopTransactionConf&          data,
+                                          rapidjson::Value&                   json,
+                                          rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
     if (data.idTagInfo.isSet())
     {
         IdTagInfoConverter id_tag_info_converter;
-        id_tag_info_converter.setAllocator(allocator);
 
-        rapidjson::Document id_tag_info(rapidjson::kObjectType);
-        ret = id_tag_info_converter.toJson(data.idTagInfo, id_tag_info);
-        json.AddMember(rapidjson::StringRef("idTagInfo"), id_tag_info.Move(), *allocator);
+        rapidjson::Value id_tag_info(rapidjson::kObjectType);
+        ret = id_tag_info_converter.toJson(data.idTagInfo, id_tag_info, allocator);
+        json.AddMember(rapidjson::StringRef("idTagInfo"), id_tag_info.Move(), allocator);
     }
     return ret;
 }
@@ -53,7 +53,7 @@ namespace ocpp16
 bool TriggerMessageReqConverter::fromJson(const rapidjson::Value& json,
                                           TriggerMessageReq&      data,
                                           std::string&            error_code,
-                                          std::string&            error_message)
+                                          std::string&            error_message) const
 {
     bool ret;
     ret                   = extract(json, "connectorId", data.connectorId, error_message);
@@ -65,11 +65,13 @@ bool TriggerMessageReqConverter::fromJson(const rapidjson::Value& json,
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool TriggerMessageReqConverter::toJson(const TriggerMessageReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool TriggerMessageReqConverter::toJson(const TriggerMessageReq&            data,
+                                        rapidjson::Value&                   json,
+                                        rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "connectorId", data.connectorId);
-    fill(json, "requestedMessage", MessageTriggerHelper.toString(data.requestedMessage));
+    fill(json, "connectorId", data.connectorId, allocator);
+    fill(json, "requestedMessage", MessageTriggerHelper.toString(data.requestedMessage), allocator);
     return true;
 }
 
@@ -77,7 +79,7 @@ bool TriggerMessageReqConverter::toJson(const TriggerMessageReq& data, rapidjson
 bool TriggerMessageConfConverter::fromJson(const rapidjson::Value& json,
                                            TriggerMessageConf&     data,
                                            std::string&            error_code,
-                                           std::string&            error_message)
+                                           std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -85,10 +87,12 @@ bool TriggerMessageConfConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool TriggerMessageConfConverter::toJson(const TriggerMessageConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool TriggerMessageConfConverter::toJson(const TriggerMessageConf&           data,
+                                         rapidjson::Value&                   json,
+                                         rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", TriggerMessageStatusHelper.toString(data.status));
+    fill(json, "status", TriggerMessageStatusHelper.toString(data.status), allocator);
     return true;
 }
 
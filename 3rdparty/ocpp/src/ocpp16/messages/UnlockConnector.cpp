@@ -44,7 +44,7 @@ namespace ocpp16
 bool UnlockConnectorReqConverter::fromJson(const rapidjson::Value& json,
                                            UnlockConnectorReq&     data,
                                            std::string&            error_code,
-                                           std::string&            error_message)
+                                           std::string&            error_message) const
 {
     bool ret = extract(json, "connectorId", data.connectorId, error_message);
     ret      = ret && (data.connectorId > 0);
@@ -55,10 +55,12 @@ bool UnlockConnectorReqConverter::fromJson(const rapidjson::Value& json,
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool UnlockConnectorReqConverter::toJson(const UnlockConnectorReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool UnlockConnectorReqConverter::toJson(const UnlockConnectorReq&           data,
+                                         rapidjson::Value&                   json,
+                                         rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "connectorId", data.connectorId);
+    fill(json, "connectorId", data.connectorId, allocator);
     return true;
 }
 
@@ -66,7 +68,7 @@ bool UnlockConnectorReqConverter::toJson(const UnlockConnectorReq& data, rapidjs
 bool UnlockConnectorConfConverter::fromJson(const rapidjson::Value& json,
                                             UnlockConnectorConf&    data,
                                             std::string&            error_code,
-                                            std::string&            error_message)
+                                            std::string&            error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -74,10 +76,12 @@ bool UnlockConnectorConfConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool UnlockConnectorConfConverter::toJson(const UnlockConnectorConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool UnlockConnectorConfConverter::toJson(const UnlockConnectorConf&          data,
+                                          rapidjson::Value&                   json,
+                                          rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "status", UnlockStatusHelper.toString(data.status));
+    fill(json, "status", UnlockStatusHelper.toString(data.status), allocator);
     return true;
 }
 
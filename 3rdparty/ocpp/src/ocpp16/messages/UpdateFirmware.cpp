@@ -32,7 +32,7 @@ namespace ocpp16
 bool UpdateFirmwareReqConverter::fromJson(const rapidjson::Value& json,
                                           UpdateFirmwareReq&      data,
                                           std::string&            error_code,
-                                          std::string&            error_message)
+                                          std::string&            error_message) const
 {
     bool ret;
     extract(json, "location", data.location);
@@ -48,13 +48,15 @@ bool UpdateFirmwareReqConverter::fromJson(const rapidjson::Value& json,
     return ret;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool UpdateFirmwareReqConverter::toJson(const UpdateFirmwareReq& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool UpdateFirmwareReqConverter::toJson(const UpdateFirmwareReq&            data,
+                                        rapidjson::Value&                   json,
+                                        rapidjson::Document::AllocatorType& allocator) const
 {
-    fill(json, "location", data.location);
-    fill(json, "retries", data.retries);
-    fill(json, "retryInterval", data.retryInterval);
-    fill(json, "retrieveDate", data.retrieveDate);
+    fill(json, "location", data.location, allocator);
+    fill(json, "retries", data.retries, allocator);
+    fill(json, "retryInterval", data.retryInterval, allocator);
+    fill(json, "retrieveDate", data.retrieveDate, allocator);
     return true;
 }
 
@@ -62,7 +64,7 @@ bool UpdateFirmwareReqConverter::toJson(const UpdateFirmwareReq& data, rapidjson
 bool UpdateFirmwareConfConverter::fromJson(const rapidjson::Value& json,
                                            UpdateFirmwareConf&     data,
                                            std::string&            error_code,
-                                           std::string&            error_message)
+                                           std::string&            error_message) const
 {
     (void)json;
     (void)data;
@@ -71,11 +73,14 @@ bool UpdateFirmwareConfConverter::fromJson(const rapidjson::Value& json,
     return true;
 }
 
-/** @copydoc bool IMessageConverter<DataType>::toJson(DataType&, rapidjson::Document&, std::string&, std::string&) */
-bool UpdateFirmwareConfConverter::toJson(const UpdateFirmwareConf& data, rapidjson::Document& json)
+/** @copydoc bool IMessageConverter<DataType>::toJson(const DataType&, rapidjson::Value&, rapidjson::Document::AllocatorType&) */
+bool UpdateFirmwareConfConverter::toJson(const UpdateFirmwareConf&           data,
+                                         rapidjson::Value&                   json,
+                                         rapidjson::Document::AllocatorType& allocator) const
 {
     (void)json;
     (void)data;
+    (void)allocator;
     return true;
 }
 
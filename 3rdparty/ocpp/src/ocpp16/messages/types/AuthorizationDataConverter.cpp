@@ -38,7 +38,7 @@ namespace ocpp16
 bool AuthorizationDataConverter::fromJson(const rapidjson::Value&                 json,
                                           ocpp::types::ocpp16::AuthorizationData& data,
                                           std::string&                            error_code,
-                                          std::string&                            error_message)
+                                          std::string&                            error_message) const
 {
     bool ret = true;
     extract(json, "idTag", data.idTag);
@@ -51,18 +51,20 @@ bool AuthorizationDataConverter::fromJson(const rapidjson::Value&
 }
 
 /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::AuthorizationData>::toJson(const ocpp::types::ocpp16::AuthorizationData&,
- *                                                                  rapidjson::Document&) */
-bool AuthorizationDataConverter::toJson(const ocpp::types::ocpp16::AuthorizationData& data, rapidjson::Document& json)
+ *                                                                  rapidjson::Value&,
+ *                                                                  rapidjson::Document::AllocatorType&) */
+bool AuthorizationDataConverter::toJson(const ocpp::types::ocpp16::AuthorizationData& data,
+                                        rapidjson::Value&                             json,
+                                        rapidjson::Document::AllocatorType&           allocator) const
 {
     bool ret = true;
-    fill(json, "idTag", data.idTag);
+    fill(json, "idTag", data.idTag, allocator);
     if (data.idTagInfo.isSet())
     {
         IdTagInfoConverter id_tag_info_converter;
-        id_tag_info_converter.setAllocator(allocator);
-        rapidjson::Document value(rapidjson::kObjectType);
-        ret = id_tag_info_converter.toJson(data.idTagInfo, value);
-        json.AddMember(rapidjson::StringRef("idTagInfo"), value.Move(), *allocator);
+        rapidjson::Value   value(rapidjson::kObjectType);
+        ret = id_tag_info_converter.toJson(data.idTagInfo, value, allocator);
+        json.AddMember(rapidjson::StringRef("idTagInfo"), value.Move(), allocator);
     }
     return ret;
 }
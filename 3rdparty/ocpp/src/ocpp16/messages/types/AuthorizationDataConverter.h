@@ -33,9 +33,6 @@ namespace ocpp16
 class AuthorizationDataConverter : public IMessageConverter<ocpp::types::ocpp16::AuthorizationData>
 {
   public:
-    /** @copydoc IMessageConverter<ocpp::types::ocpp16::AuthorizationData>* IMessageConverter<ocpp::types::ocpp16::AuthorizationData>::clone() const */
-    IMessageConverter<ocpp::types::ocpp16::AuthorizationData>* clone() const override { return new AuthorizationDataConverter(); }
-
     /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::AuthorizationData>::fromJson(const rapidjson::Value&,
      *                                                                    ocpp::types::ocpp16::AuthorizationData&,
      *                                                                    std::string&,
@@ -43,11 +40,13 @@ class AuthorizationDataConverter : public IMessageConverter<ocpp::types::ocpp16:
     bool fromJson(const rapidjson::Value&                 json,
                   ocpp::types::ocpp16::AuthorizationData& data,
                   std::string&                            error_code,
-                  std::string&                            error_message) override;
+                  std::string&                            error_message) const override;
 
     /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::AuthorizationData>::toJson(const ocpp::types::ocpp16::AuthorizationData&,
      *                                                                  rapidjson::Document&) */
-    bool toJson(const ocpp::types::ocpp16::AuthorizationData& data, rapidjson::Document& json) override;
+    bool toJson(const ocpp::types::ocpp16::AuthorizationData& data,
+                rapidjson::Value&                             json,
+                rapidjson::Document::AllocatorType&           allocator) const override;
 };
 
 } // namespace ocpp16
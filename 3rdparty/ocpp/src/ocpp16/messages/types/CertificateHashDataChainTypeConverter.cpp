@@ -52,7 +52,7 @@ namespace ocpp16
 bool CertificateHashDataChainTypeConverter::fromJson(const rapidjson::Value&                            json,
                                                      ocpp::types::ocpp16::CertificateHashDataChainType& data,
                                                      std::string&                                       error_code,
-                                                     std::string&                                       error_message)
+                                                     std::string&                                       error_message) const
 {
     CertificateHashDataTypeConverter certificate_hash_data_type_converter;
 
@@ -74,30 +74,32 @@ bool CertificateHashDataChainTypeConverter::fromJson(const rapidjson::Value&
 }
 
 /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::CertificateHashDataChainType>::toJson(const ocpp::types::ocpp16::CertificateHashDataChainType&,
- *                                                                                     rapidjson::Document&) */
-bool CertificateHashDataChainTypeConverter::toJson(const ocpp::types::ocpp16::CertificateHashDataChainType& data, rapidjson::Document& json)
+ *                                                                                     rapidjson::Value&,
+ *                                                                                     rapidjson::Document::AllocatorType&) */
+bool CertificateHashDataChainTypeConverter::toJson(const ocpp::types::ocpp16::CertificateHashDataChainType& data,
+                                                   rapidjson::Value&                                        json,
+                                                   rapidjson::Document::AllocatorType&                      allocator) const
 {
-    fill(json, "certificateType", GetCertificateIdUseEnumTypeHelper.toString(data.certificateType));
+    fill(json, "certificateType", GetCertificateIdUseEnumTypeHelper.toString(data.certificateType), allocator);
 
     CertificateHashDataTypeConverter certificate_hash_data_type_converter;
-    certificate_hash_data_type_converter.setAllocator(allocator);
-    rapidjson::Document hash_data(rapidjson::kObjectType);
-    bool                ret = certificate_hash_data_type_converter.toJson(data.certificateHashData, hash_data);
+    rapidjson::Value                 hash_data(rapidjson::kObjectType);
+    bool                             ret = certificate_hash_data_type_converter.toJson(data.certificateHashData, hash_data, allocator);
     if (ret)
     {
-        json.AddMember(rapidjson::StringRef("certificateHashData"), hash_data.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("certificateHashData"), hash_data.Move(), allocator);
 
         rapidjson::Value childCertificateHashData(rapidjson::kArrayType);
         for (const auto& child_certificate : data.childCertificateHashData)
         {
-            rapidjson::Document value(rapidjson::kObjectType);
-            ret = ret && certificate_hash_data_type_converter.toJson(child_certificate, value);
+            rapidjson::Value value(rapidjson::kObjectType);
+            ret = ret && certificate_hash_data_type_converter.toJson(child_certificate, value, allocator);
             if (ret)
             {
-                childCertificateHashData.PushBack(value.Move(), *allocator);
+                childCertificateHashData.PushBack(value.Move(), allocator);
             }
         }
-        json.AddMember(rapidjson::StringRef("childCertificateHashData"), childCertificateHashData.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("childCertificateHashData"), childCertificateHashData.Move(), allocator);
     }
     return ret;
 }
@@ -33,12 +33,6 @@ namespace ocpp16
 class CertificateHashDataChainTypeConverter : public IMessageConverter<ocpp::types::ocpp16::CertificateHashDataChainType>
 {
   public:
-    /** @copydoc IMessageConverter<ocpp::types::ocpp16::CertificateHashDataChainType>* IMessageConverter<ocpp::types::ocpp16::CertificateHashDataChainType>::clone() const */
-    IMessageConverter<ocpp::types::ocpp16::CertificateHashDataChainType>* clone() const override
-    {
-        return new CertificateHashDataChainTypeConverter();
-    }
-
     /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::CertificateHashDataChainType>::fromJson(const rapidjson::Value&,
     *                                                                                        ocpp::types::ocpp16::CertificateHashDataChainType&,
     *                                                                                        std::string&,
@@ -46,11 +40,13 @@ class CertificateHashDataChainTypeConverter : public IMessageConverter<ocpp::typ
     bool fromJson(const rapidjson::Value&                            json,
                   ocpp::types::ocpp16::CertificateHashDataChainType& data,
                   std::string&                                       error_code,
-                  std::string&                                       error_message) override;
+                  std::string&                                       error_message) const override;
 
     /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::CertificateHashDataChainType>::toJson(const ocpp::types::ocpp16::CertificateHashDataChainType&,
      *                                                                                     rapidjson::Document&) */
-    bool toJson(const ocpp::types::ocpp16::CertificateHashDataChainType& data, rapidjson::Document& json) override;
+    bool toJson(const ocpp::types::ocpp16::CertificateHashDataChainType& data,
+                rapidjson::Value&                                        json,
+                rapidjson::Document::AllocatorType&                      allocator) const override;
 };
 
 } // namespace ocpp16
@@ -47,7 +47,7 @@ namespace ocpp16
 bool CertificateHashDataTypeConverter::fromJson(const rapidjson::Value&                       json,
                                                 ocpp::types::ocpp16::CertificateHashDataType& data,
                                                 std::string&                                  error_code,
-                                                std::string&                                  error_message)
+                                                std::string&                                  error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -59,13 +59,16 @@ bool CertificateHashDataTypeConverter::fromJson(const rapidjson::Value&
 }
 
 /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::CertificateHashDataType>::toJson(const ocpp::types::ocpp16::CertificateHashDataType&,
- *                                                                  rapidjson::Document&) */
-bool CertificateHashDataTypeConverter::toJson(const ocpp::types::ocpp16::CertificateHashDataType& data, rapidjson::Document& json)
+ *                                                                  rapidjson::Value&,
+ *                                                                  rapidjson::Document::AllocatorType&) */
+bool CertificateHashDataTypeConverter::toJson(const ocpp::types::ocpp16::CertificateHashDataType& data,
+                                              rapidjson::Value&                                   json,
+                                              rapidjson::Document::AllocatorType&                 allocator) const
 {
-    fill(json, "hashAlgorithm", HashAlgorithmEnumTypeHelper.toString(data.hashAlgorithm));
-    fill(json, "issuerKeyHash", data.issuerKeyHash);
-    fill(json, "issuerNameHash", data.issuerNameHash);
-    fill(json, "serialNumber", data.serialNumber);
+    fill(json, "hashAlgorithm", HashAlgorithmEnumTypeHelper.toString(data.hashAlgorithm), allocator);
+    fill(json, "issuerKeyHash", data.issuerKeyHash, allocator);
+    fill(json, "issuerNameHash", data.issuerNameHash, allocator);
+    fill(json, "serialNumber", data.serialNumber, allocator);
     return true;
 }
 
@@ -33,12 +33,6 @@ namespace ocpp16
 class CertificateHashDataTypeConverter : public IMessageConverter<ocpp::types::ocpp16::CertificateHashDataType>
 {
   public:
-    /** @copydoc IMessageConverter<ocpp::types::ocpp16::CertificateHashDataType>* IMessageConverter<ocpp::types::ocpp16::CertificateHashDataType>::clone() const */
-    IMessageConverter<ocpp::types::ocpp16::CertificateHashDataType>* clone() const override
-    {
-        return new CertificateHashDataTypeConverter();
-    }
-
     /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::CertificateHashDataType>::fromJson(const rapidjson::Value&,
     *                                                                                   ocpp::types::ocpp16::CertificateHashDataType&,
     *                                                                                   std::string&,
@@ -46,11 +40,13 @@ class CertificateHashDataTypeConverter : public IMessageConverter<ocpp::types::o
     bool fromJson(const rapidjson::Value&                       json,
                   ocpp::types::ocpp16::CertificateHashDataType& data,
                   std::string&                                  error_code,
-                  std::string&                                  error_message) override;
+                  std::string&                                  error_message) const override;
 
     /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::CertificateHashDataType>::toJson(const ocpp::types::ocpp16::CertificateHashDataType&,
      *                                                                                rapidjson::Document&) */
-    bool toJson(const ocpp::types::ocpp16::CertificateHashDataType& data, rapidjson::Document& json) override;
+    bool toJson(const ocpp::types::ocpp16::CertificateHashDataType& data,
+                rapidjson::Value&                                   json,
+                rapidjson::Document::AllocatorType&                 allocator) const override;
 };
 
 } // namespace ocpp16
@@ -38,7 +38,7 @@ namespace ocpp16
 bool ChargingProfileConverter::fromJson(const rapidjson::Value&               json,
                                         ocpp::types::ocpp16::ChargingProfile& data,
                                         std::string&                          error_code,
-                                        std::string&                          error_message)
+                                        std::string&                          error_message) const
 {
     bool ret;
     extract(json, "chargingProfileId", data.chargingProfileId);
@@ -64,26 +64,28 @@ bool ChargingProfileConverter::fromJson(const rapidjson::Value&               js
 }
 
 /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::ChargingProfile>::toJson(const ocpp::types::ocpp16::ChargingProfile&,
- *                                                                  rapidjson::Document&) */
-bool ChargingProfileConverter::toJson(const ocpp::types::ocpp16::ChargingProfile& data, rapidjson::Document& json)
+ *                                                                  rapidjson::Value&,
+ *                                                                  rapidjson::Document::AllocatorType&) */
+bool ChargingProfileConverter::toJson(const ocpp::types::ocpp16::ChargingProfile& data,
+                                      rapidjson::Value&                           json,
+                                      rapidjson::Document::AllocatorType&         allocator) const
 {
-    fill(json, "chargingProfileId", data.chargingProfileId);
-    fill(json, "transactionId", data.transactionId);
-    fill(json, "stackLevel", data.stackLevel);
-    fill(json, "chargingProfilePurpose", ChargingProfilePurposeTypeHelper.toString(data.chargingProfilePurpose));
-    fill(json, "chargingProfileKind", ChargingProfileKindTypeHelper.toString(data.chargingProfileKind));
+    fill(json, "chargingProfileId", data.chargingProfileId, allocator);
+    fill(json, "transactionId", data.transactionId, allocator);
+    fill(json, "stackLevel", data.stackLevel, allocator);
+    fill(json, "chargingProfilePurpose", ChargingProfilePurposeTypeHelper.toString(data.chargingProfilePurpose), allocator);
+    fill(json, "chargingProfileKind", ChargingProfileKindTypeHelper.toString(data.chargingProfileKind), allocator);
     if (data.recurrencyKind.isSet())
     {
-        fill(json, "recurrencyKind", RecurrencyKindTypeHelper.toString(data.recurrencyKind));
+        fill(json, "recurrencyKind", RecurrencyKindTypeHelper.toString(data.recurrencyKind), allocator);
     }
-    fill(json, "validFrom", data.validFrom);
-    fill(json, "validTo", data.validTo);
+    fill(json, "validFrom", data.validFrom, allocator);
+    fill(json, "validTo", data.validTo, allocator);
 
     ChargingScheduleConverter charging_schedule_converter;
-    charging_schedule_converter.setAllocator(allocator);
-    rapidjson::Document charging_schedule(rapidjson::kObjectType);
-    bool                ret = charging_schedule_converter.toJson(data.chargingSchedule, charging_schedule);
-    json.AddMember(rapidjson::StringRef("chargingSchedule"), charging_schedule.Move(), *allocator);
+    rapidjson::Value          charging_schedule(rapidjson::kObjectType);
+    bool                      ret = charging_schedule_converter.toJson(data.chargingSchedule, charging_schedule, allocator);
+    json.AddMember(rapidjson::StringRef("chargingSchedule"), charging_schedule.Move(), allocator);
 
     return ret;
 }
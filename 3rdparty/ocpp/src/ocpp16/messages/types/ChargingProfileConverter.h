@@ -33,9 +33,6 @@ namespace ocpp16
 class ChargingProfileConverter : public IMessageConverter<ocpp::types::ocpp16::ChargingProfile>
 {
   public:
-    /** @copydoc IMessageConverter<ocpp::types::ocpp16::ChargingProfile>* IMessageConverter<ocpp::types::ocpp16::ChargingProfile>::clone() const */
-    IMessageConverter<ocpp::types::ocpp16::ChargingProfile>* clone() const override { return new ChargingProfileConverter(); }
-
     /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::ChargingProfile>::fromJson(const rapidjson::Value&,
      *                                                                    ocpp::types::ocpp16::ChargingProfile&,
      *                                                                    std::string&,
@@ -43,11 +40,13 @@ class ChargingProfileConverter : public IMessageConverter<ocpp::types::ocpp16::C
     bool fromJson(const rapidjson::Value&               json,
                   ocpp::types::ocpp16::ChargingProfile& data,
                   std::string&                          error_code,
-                  std::string&                          error_message) override;
+                  std::string&                          error_message) const override;
 
     /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::ChargingProfile>::toJson(const ocpp::types::ocpp16::ChargingProfile&,
      *                                                                  rapidjson::Document&) */
-    bool toJson(const ocpp::types::ocpp16::ChargingProfile& data, rapidjson::Document& json) override;
+    bool toJson(const ocpp::types::ocpp16::ChargingProfile& data,
+                rapidjson::Value&                           json,
+                rapidjson::Document::AllocatorType&         allocator) const override;
 };
 
 } // namespace ocpp16
@@ -37,7 +37,7 @@ namespace ocpp16
 bool ChargingScheduleConverter::fromJson(const rapidjson::Value&                json,
                                          ocpp::types::ocpp16::ChargingSchedule& data,
                                          std::string&                           error_code,
-                                         std::string&                           error_message)
+                                         std::string&                           error_message) const
 {
     bool ret = extract(json, "startSchedule", data.startSchedule, error_message);
     extract(json, "duration", data.duration);
@@ -71,24 +71,27 @@ bool ChargingScheduleConverter::fromJson(const rapidjson::Value&
 }
 
 /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::ChargingSchedule>::toJson(const ocpp::types::ocpp16::ChargingSchedule&,
- *                                                                  rapidjson::Document&) */
-bool ChargingScheduleConverter::toJson(const ocpp::types::ocpp16::ChargingSchedule& data, rapidjson::Document& json)
+ *                                                                  rapidjson::Value&,
+ *                                                                  rapidjson::Document::AllocatorType&) */
+bool ChargingScheduleConverter::toJson(const ocpp::types::ocpp16::ChargingSchedule& data,
+                                       rapidjson::Value&                            json,
+                                       rapidjson::Document::AllocatorType&          allocator) const
 {
-    fill(json, "startSchedule", data.startSchedule);
-    fill(json, "duration", data.duration);
-    fill(json, "chargingRateUnit", ChargingRateUnitTypeHelper.toString(data.chargingRateUnit));
-    fill(json, "minChargingRate", data.minChargingRate);
+    fill(json, "startSchedule", data.startSchedule, allocator);
+    fill(json, "duration", data.duration, allocator);
+    fill(json, "chargingRateUnit", ChargingRateUnitTypeHelper.toString(data.chargingRateUnit), allocator);
+    fill(json, "minChargingRate", data.minChargingRate, allocator);
 
     rapidjson::Value chargingSchedulePeriod(rapidjson::kArrayType);
     for (const ChargingSchedulePeriod& schedule_period : data.chargingSchedulePeriod)
     {
-        rapidjson::Document value(rapidjson::kObjectType);
-        fill(value, "startPeriod", schedule_period.startPeriod);
-        fill(value, "limit", schedule_period.limit);
-        fill(value, "numberPhases", schedule_period.numberPhases);
-        chargingSchedulePeriod.PushBack(value.Move(), *allocator);
+        rapidjson::Value value(rapidjson::kObjectType);
+        fill(value, "startPeriod", schedule_period.startPeriod, allocator);
+        fill(value, "limit", schedule_period.limit, allocator);
+        fill(value, "numberPhases", schedule_period.numberPhases, allocator);
+        chargingSchedulePeriod.PushBack(value.Move(), allocator);
     }
-    json.AddMember(rapidjson::StringRef("chargingSchedulePeriod"), chargingSchedulePeriod.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("chargingSchedulePeriod"), chargingSchedulePeriod.Move(), allocator);
 
     return true;
 }
@@ -33,9 +33,6 @@ namespace ocpp16
 class ChargingScheduleConverter : public IMessageConverter<ocpp::types::ocpp16::ChargingSchedule>
 {
   public:
-    /** @copydoc IMessageConverter<ocpp::types::ocpp16::ChargingSchedule>* IMessageConverter<ocpp::types::ocpp16::ChargingSchedule>::clone() const */
-    IMessageConverter<ocpp::types::ocpp16::ChargingSchedule>* clone() const override { return new ChargingScheduleConverter(); }
-
     /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::ChargingSchedule>::fromJson(const rapidjson::Value&,
      *                                                                    ocpp::types::ocpp16::ChargingSchedule&,
      *                                                                    std::string&,
@@ -43,11 +40,13 @@ class ChargingScheduleConverter : public IMessageConverter<ocpp::types::ocpp16::
     bool fromJson(const rapidjson::Value&                json,
                   ocpp::types::ocpp16::ChargingSchedule& data,
                   std::string&                           error_code,
-                  std::string&                           error_message) override;
+                  std::string&                           error_message) const override;
 
     /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::ChargingSchedule>::toJson(const ocpp::types::ocpp16::ChargingSchedule&,
      *                                                                  rapidjson::Document&) */
-    bool toJson(const ocpp::types::ocpp16::ChargingSchedule& data, rapidjson::Document& json) override;
+    bool toJson(const ocpp::types::ocpp16::ChargingSchedule& data,
+                rapidjson::Value&                            json,
+                rapidjson::Document::AllocatorType&          allocator) const override;
 };
 
 } // namespace ocpp16
@@ -37,7 +37,7 @@ namespace ocpp16
 bool IdTagInfoConverter::fromJson(const rapidjson::Value&         json,
                                   ocpp::types::ocpp16::IdTagInfo& data,
                                   std::string&                    error_code,
-                                  std::string&                    error_message)
+                                  std::string&                    error_message) const
 {
     bool ret;
     ret = extract(json, "expiryDate", data.expiryDate, error_message);
@@ -51,12 +51,15 @@ bool IdTagInfoConverter::fromJson(const rapidjson::Value&         json,
 }
 
 /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::IdTagInfo>::toJson(const ocpp::types::ocpp16::IdTagInfo&,
- *                                                                  rapidjson::Document&) */
-bool IdTagInfoConverter::toJson(const ocpp::types::ocpp16::IdTagInfo& data, rapidjson::Document& json)
+ *                                                                  rapidjson::Value&,
+ *                                                                  rapidjson::Document::AllocatorType&) */
+bool IdTagInfoConverter::toJson(const ocpp::types::ocpp16::IdTagInfo& data,
+                                rapidjson::Value&                     json,
+                                rapidjson::Document::AllocatorType&   allocator) const
 {
-    fill(json, "expiryDate", data.expiryDate);
-    fill(json, "parentIdTag", data.parentIdTag);
-    fill(json, "status", AuthorizationStatusHelper.toString(data.status));
+    fill(json, "expiryDate", data.expiryDate, allocator);
+    fill(json, "parentIdTag", data.parentIdTag, allocator);
+    fill(json, "status", AuthorizationStatusHelper.toString(data.status), allocator);
     return true;
 }
 
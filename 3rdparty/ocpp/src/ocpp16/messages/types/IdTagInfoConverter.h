@@ -33,9 +33,6 @@ namespace ocpp16
 class IdTagInfoConverter : public IMessageConverter<ocpp::types::ocpp16::IdTagInfo>
 {
   public:
-    /** @copydoc IMessageConverter<ocpp::types::ocpp16::IdTagInfo>* IMessageConverter<ocpp::types::ocpp16::IdTagInfo>::clone() const */
-    IMessageConverter<ocpp::types::ocpp16::IdTagInfo>* clone() const override { return new IdTagInfoConverter(); }
-
     /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::IdTagInfo>::fromJson(const rapidjson::Value&,
      *                                                                    ocpp::types::ocpp16::IdTagInfo&,
      *                                                                    std::string&,
@@ -43,11 +40,13 @@ class IdTagInfoConverter : public IMessageConverter<ocpp::types::ocpp16::IdTagIn
     bool fromJson(const rapidjson::Value&         json,
                   ocpp::types::ocpp16::IdTagInfo& data,
                   std::string&                    error_code,
-                  std::string&                    error_message) override;
+                  std::string&                    error_message) const override;
 
     /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::IdTagInfo>::toJson(const ocpp::types::ocpp16::IdTagInfo&,
      *                                                                  rapidjson::Document&) */
-    bool toJson(const ocpp::types::ocpp16::IdTagInfo& data, rapidjson::Document& json) override;
+    bool toJson(const ocpp::types::ocpp16::IdTagInfo& data,
+                rapidjson::Value&                     json,
+                rapidjson::Document::AllocatorType&   allocator) const override;
 };
 
 } // namespace ocpp16
@@ -37,7 +37,7 @@ namespace ocpp16
 bool IdTokenInfoTypeConverter::fromJson(const rapidjson::Value&               json,
                                         ocpp::types::ocpp16::IdTokenInfoType& data,
                                         std::string&                          error_code,
-                                        std::string&                          error_message)
+                                        std::string&                          error_message) const
 {
     data.status = AuthorizationStatusHelper.fromString(json["status"].GetString());
     bool ret    = extract(json, "cacheExpiryDateTime", data.cacheExpiryDateTime, error_message);
@@ -49,13 +49,16 @@ bool IdTokenInfoTypeConverter::fromJson(const rapidjson::Value&               js
 }
 
 /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::IdTokenInfoType>::toJson(const ocpp::types::ocpp16::IdTokenInfoType&,
- *                                                                  rapidjson::Document&) */
-bool IdTokenInfoTypeConverter::toJson(const ocpp::types::ocpp16::IdTokenInfoType& data, rapidjson::Document& json)
+ *                                                                  rapidjson::Value&,
+ *                                                                  rapidjson::Document::AllocatorType&) */
+bool IdTokenInfoTypeConverter::toJson(const ocpp::types::ocpp16::IdTokenInfoType& data,
+                                      rapidjson::Value&                           json,
+                                      rapidjson::Document::AllocatorType&         allocator) const
 {
-    fill(json, "status", AuthorizationStatusHelper.toString(data.status));
+    fill(json, "status", AuthorizationStatusHelper.toString(data.status), allocator);
     if (data.cacheExpiryDateTime.isSet())
     {
-        fill(json, "cacheExpiryDateTime", data.cacheExpiryDateTime);
+        fill(json, "cacheExpiryDateTime", data.cacheExpiryDateTime, allocator);
     }
     return true;
 }
@@ -33,9 +33,6 @@ namespace ocpp16
 class IdTokenInfoTypeConverter : public IMessageConverter<ocpp::types::ocpp16::IdTokenInfoType>
 {
   public:
-    /** @copydoc IMessageConverter<ocpp::types::ocpp16::IdTokenInfoType>* IMessageConverter<ocpp::types::ocpp16::IdTokenInfoType>::clone() const */
-    IMessageConverter<ocpp::types::ocpp16::IdTokenInfoType>* clone() const override { return new IdTokenInfoTypeConverter(); }
-
     /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::IdTokenInfoType>::fromJson(const rapidjson::Value&,
      *                                                                    ocpp::types::ocpp16::IdTokenInfoType&,
      *                                                                    std::string&,
@@ -43,11 +40,13 @@ class IdTokenInfoTypeConverter : public IMessageConverter<ocpp::types::ocpp16::I
     bool fromJson(const rapidjson::Value&               json,
                   ocpp::types::ocpp16::IdTokenInfoType& data,
                   std::string&                          error_code,
-                  std::string&                          error_message) override;
+                  std::string&                          error_message) const override;
 
     /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::IdTokenInfoType>::toJson(const ocpp::types::ocpp16::IdTokenInfoType&,
      *                                                                  rapidjson::Document&) */
-    bool toJson(const ocpp::types::ocpp16::IdTokenInfoType& data, rapidjson::Document& json) override;
+    bool toJson(const ocpp::types::ocpp16::IdTokenInfoType& data,
+                rapidjson::Value&                           json,
+                rapidjson::Document::AllocatorType&         allocator) const override;
 };
 
 } // namespace ocpp16
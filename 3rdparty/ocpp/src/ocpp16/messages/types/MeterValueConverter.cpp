@@ -36,7 +36,7 @@ namespace ocpp16
 bool MeterValueConverter::fromJson(const rapidjson::Value&          json,
                                    ocpp::types::ocpp16::MeterValue& data,
                                    std::string&                     error_code,
-                                   std::string&                     error_message)
+                                   std::string&                     error_message) const
 {
     bool ret = extract(json, "timestamp", data.timestamp, error_message);
 
@@ -81,43 +81,46 @@ bool MeterValueConverter::fromJson(const rapidjson::Value&          json,
 }
 
 /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::MeterValue>::toJson(const ocpp::types::ocpp16::MeterValue&,
- *                                                                  rapidjson::Document&) */
-bool MeterValueConverter::toJson(const ocpp::types::ocpp16::MeterValue& data, rapidjson::Document& json)
+ *                                                                  rapidjson::Value&,
+ *                                                                  rapidjson::Document::AllocatorType&) */
+bool MeterValueConverter::toJson(const ocpp::types::ocpp16::MeterValue& data,
+                                 rapidjson::Value&                      json,
+                                 rapidjson::Document::AllocatorType&    allocator) const
 {
-    fill(json, "timestamp", data.timestamp);
+    fill(json, "timestamp", data.timestamp, allocator);
 
     rapidjson::Value sampledValue(rapidjson::kArrayType);
     for (const SampledValue& sampled_value : data.sampledValue)
     {
-        rapidjson::Document sampled(rapidjson::kObjectType);
-        fill(sampled, "value", sampled_value.value);
+        rapidjson::Value sampled(rapidjson::kObjectType);
+        fill(sampled, "value", sampled_value.value, allocator);
         if (sampled_value.context.isSet())
         {
-            fill(sampled, "context", ReadingContextHelper.toString(sampled_value.context));
+            fill(sampled, "context", ReadingContextHelper.toString(sampled_value.context), allocator);
         }
         if (sampled_value.format.isSet())
         {
-            fill(sampled, "format", ValueFormatHelper.toString(sampled_value.format));
+            fill(sampled, "format", ValueFormatHelper.toString(sampled_value.format), allocator);
         }
         if (sampled_value.measurand.isSet())
         {
-            fill(sampled, "measurand", MeasurandHelper.toString(sampled_value.measurand));
+            fill(sampled, "measurand", MeasurandHelper.toString(sampled_value.measurand), allocator);
         }
         if (sampled_value.phase.isSet())
         {
-            fill(sampled, "phase", PhaseHelper.toString(sampled_value.phase));
+            fill(sampled, "phase", PhaseHelper.toString(sampled_value.phase), allocator);
         }
         if (sampled_value.location.isSet())
         {
-            fill(sampled, "location", LocationHelper.toString(sampled_value.location));
+            fill(sampled, "location", LocationHelper.toString(sampled_value.location), allocator);
         }
         if (sampled_value.unit.isSet())
         {
-            fill(sampled, "unit", UnitOfMeasureHelper.toString(sampled_value.unit));
+            fill(sampled, "unit", UnitOfMeasureHelper.toString(sampled_value.unit), allocator);
         }
-        sampledValue.PushBack(sampled.Move(), *allocator);
+        sampledValue.PushBack(sampled.Move(), allocator);
     }
-    json.AddMember(rapidjson::StringRef("sampledValue"), sampledValue.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("sampledValue"), sampledValue.Move(), allocator);
 
     return true;
 }
@@ -33,9 +33,6 @@ namespace ocpp16
 class MeterValueConverter : public IMessageConverter<ocpp::types::ocpp16::MeterValue>
 {
   public:
-    /** @copydoc IMessageConverter<ocpp::types::ocpp16::MeterValue>* IMessageConverter<ocpp::types::ocpp16::MeterValue>::clone() const */
-    IMessageConverter<ocpp::types::ocpp16::MeterValue>* clone() const override { return new MeterValueConverter(); }
-
     /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::MeterValue>::fromJson(const rapidjson::Value&,
      *                                                                    ocpp::types::ocpp16::MeterValue&,
      *                                                                    std::string&,
@@ -43,11 +40,13 @@ class MeterValueConverter : public IMessageConverter<ocpp::types::ocpp16::MeterV
     bool fromJson(const rapidjson::Value&          json,
                   ocpp::types::ocpp16::MeterValue& data,
                   std::string&                     error_code,
-                  std::string&                     error_message) override;
+                  std::string&                     error_message) const override;
 
     /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::MeterValue>::toJson(const ocpp::types::ocpp16::MeterValue&,
      *                                                                  rapidjson::Document&) */
-    bool toJson(const ocpp::types::ocpp16::MeterValue& data, rapidjson::Document& json) override;
+    bool toJson(const ocpp::types::ocpp16::MeterValue& data,
+                rapidjson::Value&                      json,
+                rapidjson::Document::AllocatorType&    allocator) const override;
 };
 
 } // namespace ocpp16
@@ -37,7 +37,7 @@ namespace ocpp16
 bool OcspRequestDataTypeConverter::fromJson(const rapidjson::Value&                   json,
                                             ocpp::types::ocpp16::OcspRequestDataType& data,
                                             std::string&                              error_code,
-                                            std::string&                              error_message)
+                                            std::string&                              error_message) const
 {
     (void)error_code;
     (void)error_message;
@@ -50,14 +50,17 @@ bool OcspRequestDataTypeConverter::fromJson(const rapidjson::Value&
 }
 
 /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::OcspRequestDataType>::toJson(const ocpp::types::ocpp16::OcspRequestDataType&,
- *                                                                            rapidjson::Document&) */
-bool OcspRequestDataTypeConverter::toJson(const ocpp::types::ocpp16::OcspRequestDataType& data, rapidjson::Document& json)
+ *                                                                            rapidjson::Value&,
+ *                                                                            rapidjson::Document::AllocatorType&) */
+bool OcspRequestDataTypeConverter::toJson(const ocpp::types::ocpp16::OcspRequestDataType& data,
+                                          rapidjson::Value&                               json,
+                                          rapidjson::Document::AllocatorType&             allocator) const
 {
-    fill(json, "hashAlgorithm", HashAlgorithmEnumTypeHelper.toString(data.hashAlgorithm));
-    fill(json, "issuerKeyHash", data.issuerKeyHash);
-    fill(json, "issuerNameHash", data.issuerNameHash);
-    fill(json, "serialNumber", data.serialNumber);
-    fill(json, "responderURL", data.responderURL);
+    fill(json, "hashAlgorithm", HashAlgorithmEnumTypeHelper.toString(data.hashAlgorithm), allocator);
+    fill(json, "issuerKeyHash", data.issuerKeyHash, allocator);
+    fill(json, "issuerNameHash", data.issuerNameHash, allocator);
+    fill(json, "serialNumber", data.serialNumber, allocator);
+    fill(json, "responderURL", data.responderURL, allocator);
     return true;
 }
 
@@ -33,9 +33,6 @@ namespace ocpp16
 class OcspRequestDataTypeConverter : public IMessageConverter<ocpp::types::ocpp16::OcspRequestDataType>
 {
   public:
-    /** @copydoc IMessageConverter<ocpp::types::ocpp16::OcspRequestDataType>* IMessageConverter<ocpp::types::ocpp16::OcspRequestDataType>::clone() const */
-    IMessageConverter<ocpp::types::ocpp16::OcspRequestDataType>* clone() const override { return new OcspRequestDataTypeConverter(); }
-
     /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::OcspRequestDataType>::fromJson(const rapidjson::Value&,
     *                                                                               ocpp::types::ocpp16::OcspRequestDataType&,
     *                                                                               std::string&,
@@ -43,11 +40,13 @@ class OcspRequestDataTypeConverter : public IMessageConverter<ocpp::types::ocpp1
     bool fromJson(const rapidjson::Value&                   json,
                   ocpp::types::ocpp16::OcspRequestDataType& data,
                   std::string&                              error_code,
-                  std::string&                              error_message) override;
+                  std::string&                              error_message) const override;
 
     /** @copydoc bool IMessageConverter<ocpp::types::ocpp16::OcspRequestDataType>::toJson(const ocpp::types::ocpp16::OcspRequestDataType&,
      *                                                                            rapidjson::Document&) */
-    bool toJson(const ocpp::types::ocpp16::OcspRequestDataType& data, rapidjson::Document& json) override;
+    bool toJson(const ocpp::types::ocpp16::OcspRequestDataType& data,
+                rapidjson::Value&                               json,
+                rapidjson::Document::AllocatorType&             allocator) const override;
 };
 
 } // namespace ocpp16
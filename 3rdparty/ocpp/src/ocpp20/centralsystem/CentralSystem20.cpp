@@ -27,6 +27,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "WebsocketFactory.h"
 #include "WorkerThreadPool.h"
 
+#include <algorithm>
 #include <experimental/filesystem>
 #include <iostream>
 #include <random>
@@ -46,8 +47,13 @@ std::unique_ptr<ICentralSystem20> ICentralSystem20::create(const ocpp::config::I
                                                            ICentralSystemEventsHandler20&              events_handler)
 {
     std::shared_ptr<ocpp::helpers::ITimerPool>       timer_pool(new ocpp::helpers::TimerPool());
-    std::shared_ptr<ocpp::helpers::WorkerThreadPool> worker_pool =
-        std::make_shared<ocpp::helpers::WorkerThreadPool>(2u); // 1 asynchronous timer operations + 1 for asynchronous jobs/responses
+    unsigned int                                     worker_threads = stack_config.workerThreadPoolSize();
+    if (worker_threads == 0)
+    {
+        // At least 1 asynchronous timer operations + 1 for asynchronous jobs/responses
+        worker_threads = std::max(2u, std::thread::hardware_concurrency());
+    }
+    std::shared_ptr<ocpp::helpers::WorkerThreadPool> worker_pool = std::make_shared<ocpp::helpers::WorkerThreadPool>(worker_threads);
     return std::unique_ptr<ICentralSystem20>(new CentralSystem20(stack_config, events_handler, timer_pool, worker_pool));
 }
 
@@ -193,7 +199,16 @@ bool CentralSystem20::start()
             }
 
             // Allocate resources
-            m_ws_server  = std::unique_ptr<ocpp::websockets::IWebsocketServer>(ocpp::websockets::WebsocketFactory::newServer());
+            ocpp::websockets::CompressionConfig compression(m_stack_config.webSocketCompression(),
+                                                            m_stack_config.webSocketCompressionServerNoContextTakeover(),
+                                                            m_stack_config.webSocketCompressionClientNoContextTakeover(),
+                                                            m_stack_config.webSocketCompressionServerMaxWindowBits(),
+                                                            m_stack_config.webSocketCompressionClientMaxWindowBits());
+            m_ws_server  = std::unique_ptr<ocpp::websockets::IWebsocketServer>(
+                ocpp::websockets::WebsocketFactory::newServer(m_stack_config.webSocketServiceThreadsCount(),
+                                                              m_stack_config.webSocketSendQueueMaxMessages(),
+                                                              m_stack_config.webSocketSendQueueMaxBytes(),
+                                                              compression));
             m_rpc_server = std::make_unique<ocpp::rpc::RpcServer>(*m_ws_server, "ocpp2.0.1");
             m_rpc_server->registerServerListener(*this);
 
@@ -362,7 +377,7 @@ void CentralSystem20::processUptime()
     // Save counters
     if ((m_uptime % 15u) == 0)
     {
-        m_worker_pool->run<void>(std::bind(&CentralSystem20::saveUptime, this));
+        m_worker_pool->post(std::bind(&CentralSystem20::saveUptime, this));
     }
 }
 
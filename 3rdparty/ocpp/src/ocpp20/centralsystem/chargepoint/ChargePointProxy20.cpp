@@ -1240,6 +1240,334 @@ bool ChargePointProxy20::call(const ocpp::messages::ocpp20::UpdateFirmwareReq& r
 
     return ret;
 }
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::CancelReservationReq&,
+                ResponseHandler<ocpp::messages::ocpp20::CancelReservationConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::CancelReservationReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::CancelReservationConf> handler)
+{
+    return doCallAsync(CANCELRESERVATION_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::CertificateSignedReq&,
+                ResponseHandler<ocpp::messages::ocpp20::CertificateSignedConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::CertificateSignedReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::CertificateSignedConf> handler)
+{
+    return doCallAsync(CERTIFICATESIGNED_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::ChangeAvailabilityReq&,
+                ResponseHandler<ocpp::messages::ocpp20::ChangeAvailabilityConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::ChangeAvailabilityReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::ChangeAvailabilityConf> handler)
+{
+    return doCallAsync(CHANGEAVAILABILITY_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::ClearCacheReq&,
+                ResponseHandler<ocpp::messages::ocpp20::ClearCacheConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::ClearCacheReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::ClearCacheConf> handler)
+{
+    return doCallAsync(CLEARCACHE_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::ClearChargingProfileReq&,
+                ResponseHandler<ocpp::messages::ocpp20::ClearChargingProfileConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::ClearChargingProfileReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::ClearChargingProfileConf> handler)
+{
+    return doCallAsync(CLEARCHARGINGPROFILE_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::ClearDisplayMessageReq&,
+                ResponseHandler<ocpp::messages::ocpp20::ClearDisplayMessageConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::ClearDisplayMessageReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::ClearDisplayMessageConf> handler)
+{
+    return doCallAsync(CLEARDISPLAYMESSAGE_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::ClearVariableMonitoringReq&,
+                ResponseHandler<ocpp::messages::ocpp20::ClearVariableMonitoringConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::ClearVariableMonitoringReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::ClearVariableMonitoringConf> handler)
+{
+    return doCallAsync(CLEARVARIABLEMONITORING_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::CustomerInformationReq&,
+                ResponseHandler<ocpp::messages::ocpp20::CustomerInformationConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::CustomerInformationReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::CustomerInformationConf> handler)
+{
+    return doCallAsync(CUSTOMERINFORMATION_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::DataTransferReq&,
+                ResponseHandler<ocpp::messages::ocpp20::DataTransferConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::DataTransferReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::DataTransferConf> handler)
+{
+    return doCallAsync(DATATRANSFER_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::DeleteCertificateReq&,
+                ResponseHandler<ocpp::messages::ocpp20::DeleteCertificateConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::DeleteCertificateReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::DeleteCertificateConf> handler)
+{
+    return doCallAsync(DELETECERTIFICATE_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::Get15118EVCertificateReq&,
+                ResponseHandler<ocpp::messages::ocpp20::Get15118EVCertificateConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::Get15118EVCertificateReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::Get15118EVCertificateConf> handler)
+{
+    return doCallAsync(GET15118EVCERTIFICATE_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::GetBaseReportReq&,
+                ResponseHandler<ocpp::messages::ocpp20::GetBaseReportConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::GetBaseReportReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::GetBaseReportConf> handler)
+{
+    return doCallAsync(GETBASEREPORT_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::GetCertificateStatusReq&,
+                ResponseHandler<ocpp::messages::ocpp20::GetCertificateStatusConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::GetCertificateStatusReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::GetCertificateStatusConf> handler)
+{
+    return doCallAsync(GETCERTIFICATESTATUS_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::GetChargingProfilesReq&,
+                ResponseHandler<ocpp::messages::ocpp20::GetChargingProfilesConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::GetChargingProfilesReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::GetChargingProfilesConf> handler)
+{
+    return doCallAsync(GETCHARGINGPROFILES_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::GetCompositeScheduleReq&,
+                ResponseHandler<ocpp::messages::ocpp20::GetCompositeScheduleConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::GetCompositeScheduleReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::GetCompositeScheduleConf> handler)
+{
+    return doCallAsync(GETCOMPOSITESCHEDULE_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::GetDisplayMessagesReq&,
+                ResponseHandler<ocpp::messages::ocpp20::GetDisplayMessagesConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::GetDisplayMessagesReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::GetDisplayMessagesConf> handler)
+{
+    return doCallAsync(GETDISPLAYMESSAGES_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::GetInstalledCertificateIdsReq&,
+                ResponseHandler<ocpp::messages::ocpp20::GetInstalledCertificateIdsConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::GetInstalledCertificateIdsReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::GetInstalledCertificateIdsConf> handler)
+{
+    return doCallAsync(GETINSTALLEDCERTIFICATEIDS_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::GetLocalListVersionReq&,
+                ResponseHandler<ocpp::messages::ocpp20::GetLocalListVersionConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::GetLocalListVersionReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::GetLocalListVersionConf> handler)
+{
+    return doCallAsync(GETLOCALLISTVERSION_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::GetLogReq&,
+                ResponseHandler<ocpp::messages::ocpp20::GetLogConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::GetLogReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::GetLogConf> handler)
+{
+    return doCallAsync(GETLOG_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::GetMonitoringReportReq&,
+                ResponseHandler<ocpp::messages::ocpp20::GetMonitoringReportConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::GetMonitoringReportReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::GetMonitoringReportConf> handler)
+{
+    return doCallAsync(GETMONITORINGREPORT_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::GetReportReq&,
+                ResponseHandler<ocpp::messages::ocpp20::GetReportConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::GetReportReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::GetReportConf> handler)
+{
+    return doCallAsync(GETREPORT_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::GetTransactionStatusReq&,
+                ResponseHandler<ocpp::messages::ocpp20::GetTransactionStatusConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::GetTransactionStatusReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::GetTransactionStatusConf> handler)
+{
+    return doCallAsync(GETTRANSACTIONSTATUS_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::GetVariablesReq&,
+                ResponseHandler<ocpp::messages::ocpp20::GetVariablesConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::GetVariablesReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::GetVariablesConf> handler)
+{
+    return doCallAsync(GETVARIABLES_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::InstallCertificateReq&,
+                ResponseHandler<ocpp::messages::ocpp20::InstallCertificateConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::InstallCertificateReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::InstallCertificateConf> handler)
+{
+    return doCallAsync(INSTALLCERTIFICATE_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::PublishFirmwareReq&,
+                ResponseHandler<ocpp::messages::ocpp20::PublishFirmwareConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::PublishFirmwareReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::PublishFirmwareConf> handler)
+{
+    return doCallAsync(PUBLISHFIRMWARE_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::RequestStartTransactionReq&,
+                ResponseHandler<ocpp::messages::ocpp20::RequestStartTransactionConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::RequestStartTransactionReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::RequestStartTransactionConf> handler)
+{
+    return doCallAsync(REQUESTSTARTTRANSACTION_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::RequestStopTransactionReq&,
+                ResponseHandler<ocpp::messages::ocpp20::RequestStopTransactionConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::RequestStopTransactionReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::RequestStopTransactionConf> handler)
+{
+    return doCallAsync(REQUESTSTOPTRANSACTION_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::ReserveNowReq&,
+                ResponseHandler<ocpp::messages::ocpp20::ReserveNowConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::ReserveNowReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::ReserveNowConf> handler)
+{
+    return doCallAsync(RESERVENOW_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::ResetReq&,
+                ResponseHandler<ocpp::messages::ocpp20::ResetConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::ResetReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::ResetConf> handler)
+{
+    return doCallAsync(RESET_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::SendLocalListReq&,
+                ResponseHandler<ocpp::messages::ocpp20::SendLocalListConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::SendLocalListReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::SendLocalListConf> handler)
+{
+    return doCallAsync(SENDLOCALLIST_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::SetChargingProfileReq&,
+                ResponseHandler<ocpp::messages::ocpp20::SetChargingProfileConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::SetChargingProfileReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::SetChargingProfileConf> handler)
+{
+    return doCallAsync(SETCHARGINGPROFILE_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::SetDisplayMessageReq&,
+                ResponseHandler<ocpp::messages::ocpp20::SetDisplayMessageConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::SetDisplayMessageReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::SetDisplayMessageConf> handler)
+{
+    return doCallAsync(SETDISPLAYMESSAGE_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::SetMonitoringBaseReq&,
+                ResponseHandler<ocpp::messages::ocpp20::SetMonitoringBaseConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::SetMonitoringBaseReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::SetMonitoringBaseConf> handler)
+{
+    return doCallAsync(SETMONITORINGBASE_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::SetMonitoringLevelReq&,
+                ResponseHandler<ocpp::messages::ocpp20::SetMonitoringLevelConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::SetMonitoringLevelReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::SetMonitoringLevelConf> handler)
+{
+    return doCallAsync(SETMONITORINGLEVEL_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::SetNetworkProfileReq&,
+                ResponseHandler<ocpp::messages::ocpp20::SetNetworkProfileConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::SetNetworkProfileReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::SetNetworkProfileConf> handler)
+{
+    return doCallAsync(SETNETWORKPROFILE_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::SetVariableMonitoringReq&,
+                ResponseHandler<ocpp::messages::ocpp20::SetVariableMonitoringConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::SetVariableMonitoringReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::SetVariableMonitoringConf> handler)
+{
+    return doCallAsync(SETVARIABLEMONITORING_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::SetVariablesReq&,
+                ResponseHandler<ocpp::messages::ocpp20::SetVariablesConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::SetVariablesReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::SetVariablesConf> handler)
+{
+    return doCallAsync(SETVARIABLES_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::TriggerMessageReq&,
+                ResponseHandler<ocpp::messages::ocpp20::TriggerMessageConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::TriggerMessageReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::TriggerMessageConf> handler)
+{
+    return doCallAsync(TRIGGERMESSAGE_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::UnlockConnectorReq&,
+                ResponseHandler<ocpp::messages::ocpp20::UnlockConnectorConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::UnlockConnectorReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::UnlockConnectorConf> handler)
+{
+    return doCallAsync(UNLOCKCONNECTOR_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::UnpublishFirmwareReq&,
+                ResponseHandler<ocpp::messages::ocpp20::UnpublishFirmwareConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::UnpublishFirmwareReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::UnpublishFirmwareConf> handler)
+{
+    return doCallAsync(UNPUBLISHFIRMWARE_ACTION, request, handler);
+}
+/** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                const ocpp::messages::ocpp20::UpdateFirmwareReq&,
+                ResponseHandler<ocpp::messages::ocpp20::UpdateFirmwareConf>) */
+bool ChargePointProxy20::callAsync(const ocpp::messages::ocpp20::UpdateFirmwareReq&            request,
+                                   ResponseHandler<ocpp::messages::ocpp20::UpdateFirmwareConf> handler)
+{
+    return doCallAsync(UPDATEFIRMWARE_ACTION, request, handler);
+}
 
 // IRpc::IListener interface
 
@@ -1273,6 +1601,20 @@ bool ChargePointProxy20::rpcCallReceived(const std::string&      action,
     return m_msg_dispatcher.dispatchMessage(action, payload, response, error_code, error_message);
 }
 
+/** @copydoc bool IRpc::IListener::rpcRawCallReceived(const std::string&,
+                                                          char*,
+                                                          rapidjson::Document&,
+                                                          std::string&,
+                                                          std::string&) */
+bool ChargePointProxy20::rpcRawCallReceived(const std::string&   action,
+                                            char*                payload,
+                                            rapidjson::Document& response,
+                                            std::string&         error_code,
+                                            std::string&         error_message)
+{
+    return m_msg_dispatcher.dispatchRawMessage(action, payload, response, error_code, error_message);
+}
+
 // IRpc::ISpy interface
 
 /** @copydoc void IRpc::ISpy::rcpMessageReceived(const std::string& msg) */
@@ -455,6 +455,212 @@ class ChargePointProxy20 : public ICentralSystem20::IChargePoint20, public ocpp:
               std::string&                                     error,
               std::string&                                     message) override;
 
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::CancelReservationReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::CancelReservationConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::CancelReservationReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::CancelReservationConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::CertificateSignedReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::CertificateSignedConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::CertificateSignedReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::CertificateSignedConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::ChangeAvailabilityReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::ChangeAvailabilityConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::ChangeAvailabilityReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::ChangeAvailabilityConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::ClearCacheReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::ClearCacheConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::ClearCacheReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::ClearCacheConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::ClearChargingProfileReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::ClearChargingProfileConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::ClearChargingProfileReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::ClearChargingProfileConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::ClearDisplayMessageReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::ClearDisplayMessageConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::ClearDisplayMessageReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::ClearDisplayMessageConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::ClearVariableMonitoringReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::ClearVariableMonitoringConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::ClearVariableMonitoringReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::ClearVariableMonitoringConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::CustomerInformationReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::CustomerInformationConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::CustomerInformationReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::CustomerInformationConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::DataTransferReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::DataTransferConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::DataTransferReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::DataTransferConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::DeleteCertificateReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::DeleteCertificateConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::DeleteCertificateReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::DeleteCertificateConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::Get15118EVCertificateReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::Get15118EVCertificateConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::Get15118EVCertificateReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::Get15118EVCertificateConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::GetBaseReportReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::GetBaseReportConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::GetBaseReportReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::GetBaseReportConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::GetCertificateStatusReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::GetCertificateStatusConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::GetCertificateStatusReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::GetCertificateStatusConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::GetChargingProfilesReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::GetChargingProfilesConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::GetChargingProfilesReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::GetChargingProfilesConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::GetCompositeScheduleReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::GetCompositeScheduleConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::GetCompositeScheduleReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::GetCompositeScheduleConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::GetDisplayMessagesReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::GetDisplayMessagesConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::GetDisplayMessagesReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::GetDisplayMessagesConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::GetInstalledCertificateIdsReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::GetInstalledCertificateIdsConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::GetInstalledCertificateIdsReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::GetInstalledCertificateIdsConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::GetLocalListVersionReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::GetLocalListVersionConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::GetLocalListVersionReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::GetLocalListVersionConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::GetLogReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::GetLogConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::GetLogReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::GetLogConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::GetMonitoringReportReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::GetMonitoringReportConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::GetMonitoringReportReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::GetMonitoringReportConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::GetReportReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::GetReportConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::GetReportReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::GetReportConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::GetTransactionStatusReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::GetTransactionStatusConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::GetTransactionStatusReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::GetTransactionStatusConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::GetVariablesReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::GetVariablesConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::GetVariablesReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::GetVariablesConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::InstallCertificateReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::InstallCertificateConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::InstallCertificateReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::InstallCertificateConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::PublishFirmwareReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::PublishFirmwareConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::PublishFirmwareReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::PublishFirmwareConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::RequestStartTransactionReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::RequestStartTransactionConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::RequestStartTransactionReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::RequestStartTransactionConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::RequestStopTransactionReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::RequestStopTransactionConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::RequestStopTransactionReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::RequestStopTransactionConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::ReserveNowReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::ReserveNowConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::ReserveNowReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::ReserveNowConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::ResetReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::ResetConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::ResetReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::ResetConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::SendLocalListReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::SendLocalListConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::SendLocalListReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::SendLocalListConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::SetChargingProfileReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::SetChargingProfileConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::SetChargingProfileReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::SetChargingProfileConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::SetDisplayMessageReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::SetDisplayMessageConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::SetDisplayMessageReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::SetDisplayMessageConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::SetMonitoringBaseReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::SetMonitoringBaseConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::SetMonitoringBaseReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::SetMonitoringBaseConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::SetMonitoringLevelReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::SetMonitoringLevelConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::SetMonitoringLevelReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::SetMonitoringLevelConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::SetNetworkProfileReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::SetNetworkProfileConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::SetNetworkProfileReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::SetNetworkProfileConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::SetVariableMonitoringReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::SetVariableMonitoringConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::SetVariableMonitoringReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::SetVariableMonitoringConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::SetVariablesReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::SetVariablesConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::SetVariablesReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::SetVariablesConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::TriggerMessageReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::TriggerMessageConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::TriggerMessageReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::TriggerMessageConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::UnlockConnectorReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::UnlockConnectorConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::UnlockConnectorReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::UnlockConnectorConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::UnpublishFirmwareReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::UnpublishFirmwareConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::UnpublishFirmwareReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::UnpublishFirmwareConf> handler) override;
+    /** @copydoc bool ICentralSystem20::IChargePoint20::callAsync(
+                    const ocpp::messages::ocpp20::UpdateFirmwareReq&,
+                    ResponseHandler<ocpp::messages::ocpp20::UpdateFirmwareConf>) */
+    bool callAsync(const ocpp::messages::ocpp20::UpdateFirmwareReq&            request,
+                   ResponseHandler<ocpp::messages::ocpp20::UpdateFirmwareConf> handler) override;
+
     // IRpc::IListener interface
 
     /** @copydoc void IRpc::IListener::rpcDisconnected() */
@@ -474,6 +680,17 @@ class ChargePointProxy20 : public ICentralSystem20::IChargePoint20, public ocpp:
                          std::string&            error_code,
                          std::string&            error_message) override;
 
+    /** @copydoc bool IRpc::IListener::rpcRawCallReceived(const std::string&,
+                                                          char*,
+                                                          rapidjson::Document&,
+                                                          std::string&,
+                                                          std::string&) */
+    bool rpcRawCallReceived(const std::string&   action,
+                            char*                payload,
+                            rapidjson::Document& response,
+                            std::string&         error_code,
+                            std::string&         error_message) override;
+
     // IRpc::ISpy interface
 
     /** @copydoc void IRpc::ISpy::rcpMessageReceived(const std::string& msg) */
@@ -512,6 +729,44 @@ class ChargePointProxy20 : public ICentralSystem20::IChargePoint20, public ocpp:
     ocpp::messages::ocpp20::MessagesConverter20& m_messages_converter;
     /** @brief User request handler */
     IChargePointRequestHandler20* m_user_handler;
+
+    /**
+     * @brief Send an asynchronous request and trace its result
+     * @param action RPC action for the request
+     * @param request Request to send
+     * @param handler Handler to call when the response has been received or when the request has failed
+     * @return true if the request has been sent, false otherwise
+     */
+    template <typename RequestType, typename ResponseType>
+    bool doCallAsync(const std::string& action, const RequestType& request, ResponseHandler<ResponseType> handler)
+    {
+        LOG_INFO << "[" << m_identifier << "] - " << action << " (async)";
+
+        // Send request, the proxy may have been destroyed when the response is received
+        std::string identifier = m_identifier;
+        bool        ret        = m_msg_sender.callAsync<RequestType, ResponseType>(
+            action,
+            request,
+            [identifier, action, handler](
+                ocpp::messages::CallResult res, const ResponseType& response, const std::string& error, const std::string& message)
+            {
+                if (res == ocpp::messages::CallResult::Ok)
+                {
+                    LOG_INFO << "[" << identifier << "] - Call done : " << action;
+                }
+                else
+                {
+                    LOG_ERROR << "[" << identifier << "] - Call failed : " << ocpp::messages::CallResultHelper.toString(res);
+                }
+                handler((res == ocpp::messages::CallResult::Ok), response, error, message);
+            });
+        if (!ret)
+        {
+            LOG_ERROR << "[" << m_identifier << "] - Unable to send request : " << action;
+        }
+
+        return ret;
+    }
 };
 
 } // namespace ocpp20
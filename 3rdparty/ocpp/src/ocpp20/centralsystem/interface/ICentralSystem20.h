@@ -65,6 +65,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "UnpublishFirmware20.h"
 #include "UpdateFirmware20.h"
 
+#include <functional>
 #include <memory>
 
 namespace ocpp
@@ -188,6 +189,15 @@ class ICentralSystem20
         /** @brief Register the event handler */
         virtual void registerHandler(IChargePointRequestHandler20& handler) = 0;
 
+        /**
+         * @brief Handler called when an asynchronous request has completed
+         *        Parameters : true if a valid response has been received, received response,
+         *        error (CallError code, or failure cause ocpp::rpc::IRpc::RPC_FAILURE_* if no valid response has been received),
+         *        error message (Empty if no error)
+         */
+        template <typename ResponseType>
+        using ResponseHandler = std::function<void(bool, const ResponseType&, const std::string&, const std::string&)>;
+
         // OCPP operations
         /**
          * @brief Send a CancelReservation message to the charge point
@@ -681,6 +691,334 @@ class ICentralSystem20
                           ocpp::messages::ocpp20::UpdateFirmwareConf&      response,
                           std::string&                                     error,
                           std::string&                                     message) = 0;
+        /**
+         * @brief Send a CancelReservation message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::CancelReservationReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::CancelReservationConf> handler) = 0;
+        /**
+         * @brief Send a CertificateSigned message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::CertificateSignedReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::CertificateSignedConf> handler) = 0;
+        /**
+         * @brief Send a ChangeAvailability message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::ChangeAvailabilityReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::ChangeAvailabilityConf> handler) = 0;
+        /**
+         * @brief Send a ClearCache message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::ClearCacheReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::ClearCacheConf> handler) = 0;
+        /**
+         * @brief Send a ClearChargingProfile message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::ClearChargingProfileReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::ClearChargingProfileConf> handler) = 0;
+        /**
+         * @brief Send a ClearDisplayMessage message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::ClearDisplayMessageReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::ClearDisplayMessageConf> handler) = 0;
+        /**
+         * @brief Send a ClearVariableMonitoring message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::ClearVariableMonitoringReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::ClearVariableMonitoringConf> handler) = 0;
+        /**
+         * @brief Send a CustomerInformation message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::CustomerInformationReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::CustomerInformationConf> handler) = 0;
+        /**
+         * @brief Send a DataTransfer message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::DataTransferReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::DataTransferConf> handler) = 0;
+        /**
+         * @brief Send a DeleteCertificate message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::DeleteCertificateReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::DeleteCertificateConf> handler) = 0;
+        /**
+         * @brief Send a Get15118EVCertificate message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::Get15118EVCertificateReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::Get15118EVCertificateConf> handler) = 0;
+        /**
+         * @brief Send a GetBaseReport message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::GetBaseReportReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::GetBaseReportConf> handler) = 0;
+        /**
+         * @brief Send a GetCertificateStatus message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::GetCertificateStatusReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::GetCertificateStatusConf> handler) = 0;
+        /**
+         * @brief Send a GetChargingProfiles message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::GetChargingProfilesReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::GetChargingProfilesConf> handler) = 0;
+        /**
+         * @brief Send a GetCompositeSchedule message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::GetCompositeScheduleReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::GetCompositeScheduleConf> handler) = 0;
+        /**
+         * @brief Send a GetDisplayMessages message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::GetDisplayMessagesReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::GetDisplayMessagesConf> handler) = 0;
+        /**
+         * @brief Send a GetInstalledCertificateIds message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::GetInstalledCertificateIdsReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::GetInstalledCertificateIdsConf> handler) = 0;
+        /**
+         * @brief Send a GetLocalListVersion message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::GetLocalListVersionReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::GetLocalListVersionConf> handler) = 0;
+        /**
+         * @brief Send a GetLog message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::GetLogReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::GetLogConf> handler) = 0;
+        /**
+         * @brief Send a GetMonitoringReport message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::GetMonitoringReportReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::GetMonitoringReportConf> handler) = 0;
+        /**
+         * @brief Send a GetReport message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::GetReportReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::GetReportConf> handler) = 0;
+        /**
+         * @brief Send a GetTransactionStatus message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::GetTransactionStatusReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::GetTransactionStatusConf> handler) = 0;
+        /**
+         * @brief Send a GetVariables message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::GetVariablesReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::GetVariablesConf> handler) = 0;
+        /**
+         * @brief Send a InstallCertificate message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::InstallCertificateReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::InstallCertificateConf> handler) = 0;
+        /**
+         * @brief Send a PublishFirmware message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::PublishFirmwareReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::PublishFirmwareConf> handler) = 0;
+        /**
+         * @brief Send a RequestStartTransaction message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::RequestStartTransactionReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::RequestStartTransactionConf> handler) = 0;
+        /**
+         * @brief Send a RequestStopTransaction message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::RequestStopTransactionReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::RequestStopTransactionConf> handler) = 0;
+        /**
+         * @brief Send a ReserveNow message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::ReserveNowReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::ReserveNowConf> handler) = 0;
+        /**
+         * @brief Send a Reset message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::ResetReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::ResetConf> handler) = 0;
+        /**
+         * @brief Send a SendLocalList message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::SendLocalListReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::SendLocalListConf> handler) = 0;
+        /**
+         * @brief Send a SetChargingProfile message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::SetChargingProfileReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::SetChargingProfileConf> handler) = 0;
+        /**
+         * @brief Send a SetDisplayMessage message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::SetDisplayMessageReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::SetDisplayMessageConf> handler) = 0;
+        /**
+         * @brief Send a SetMonitoringBase message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::SetMonitoringBaseReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::SetMonitoringBaseConf> handler) = 0;
+        /**
+         * @brief Send a SetMonitoringLevel message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::SetMonitoringLevelReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::SetMonitoringLevelConf> handler) = 0;
+        /**
+         * @brief Send a SetNetworkProfile message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::SetNetworkProfileReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::SetNetworkProfileConf> handler) = 0;
+        /**
+         * @brief Send a SetVariableMonitoring message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::SetVariableMonitoringReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::SetVariableMonitoringConf> handler) = 0;
+        /**
+         * @brief Send a SetVariables message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::SetVariablesReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::SetVariablesConf> handler) = 0;
+        /**
+         * @brief Send a TriggerMessage message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::TriggerMessageReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::TriggerMessageConf> handler) = 0;
+        /**
+         * @brief Send a UnlockConnector message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::UnlockConnectorReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::UnlockConnectorConf> handler) = 0;
+        /**
+         * @brief Send a UnpublishFirmware message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::UnpublishFirmwareReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::UnpublishFirmwareConf> handler) = 0;
+        /**
+         * @brief Send a UpdateFirmware message to the charge point without waiting for its response
+         * @param request Request to send
+         * @param handler Handler to call when the response has been received or when the request has failed
+         * @return true if the request has been sent, false otherwise
+         */
+        virtual bool callAsync(const ocpp::messages::ocpp20::UpdateFirmwareReq&            request,
+                               ResponseHandler<ocpp::messages::ocpp20::UpdateFirmwareConf> handler) = 0;
     };
 };
 
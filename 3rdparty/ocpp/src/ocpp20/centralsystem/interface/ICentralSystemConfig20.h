@@ -38,7 +38,7 @@ class ICentralSystemConfig20
 
     /** @brief Path to the database to store persistent data */
     virtual std::string databasePath() const = 0;
-    /** @brief Path to the JSON schemas to validate the messages */
+    /** @brief Path to the JSON schemas to validate the messages (if empty, the messages are only checked by their converters) */
     virtual std::string jsonSchemasPath() const = 0;
 
     // Communication parameters
@@ -67,6 +67,24 @@ class ICentralSystemConfig20
     virtual std::string tlsServerCertificateCa() const = 0;
     /** @brief Enable client authentication using certificate */
     virtual bool tlsClientCertificateAuthent() const = 0;
+    /** @brief Number of threads servicing the websocket connections (0 = 1 thread) */
+    virtual unsigned int webSocketServiceThreadsCount() const = 0;
+    /** @brief Maximum number of messages waiting to be sent on a websocket connection (0 = default) */
+    virtual unsigned int webSocketSendQueueMaxMessages() const = 0;
+    /** @brief Maximum number of bytes waiting to be sent on a websocket connection (0 = no limit) */
+    virtual unsigned int webSocketSendQueueMaxBytes() const = 0;
+    /** @brief Enable the negotiation of the permessage-deflate compression on the websocket connections */
+    virtual bool webSocketCompression() const = 0;
+    /** @brief Only accept the compression if the server resets its compression context after each message */
+    virtual bool webSocketCompressionServerNoContextTakeover() const = 0;
+    /** @brief Only accept the compression if the client resets its compression context after each message */
+    virtual bool webSocketCompressionClientNoContextTakeover() const = 0;
+    /** @brief Size in bits of the server's compression window requested by the outgoing connections
+     *         (9 to 15, other values = 15, the server side always compresses with 15 bits) */
+    virtual unsigned int webSocketCompressionServerMaxWindowBits() const = 0;
+    /** @brief Size in bits of the client's compression window requested by the outgoing connections
+     *         (9 to 15, other values = 15) */
+    virtual unsigned int webSocketCompressionClientMaxWindowBits() const = 0;
 
     // Log
 
@@ -77,6 +95,9 @@ class ICentralSystemConfig20
 
     /** @brief Size of the thread pool to handle incoming requests from the Charge Points */
     virtual unsigned int incomingRequestsFromCpThreadPoolSize() const = 0;
+    /** @brief Size of the thread pool running the timer callbacks and the asynchronous jobs
+     *         (0 = number of CPU cores, at least 2) */
+    virtual unsigned int workerThreadPoolSize() const = 0;
 };
 
 } // namespace config
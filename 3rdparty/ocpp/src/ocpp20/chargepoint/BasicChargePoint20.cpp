@@ -547,7 +547,7 @@ void BasicChargePoint20::processUptime()
     // Save counters
     if ((m_uptime % 15u) == 0)
     {
-        m_worker_pool->run<void>(std::bind(&BasicChargePoint20::saveUptime, this));
+        m_worker_pool->post(std::bind(&BasicChargePoint20::saveUptime, this));
     }
 }
 
@@ -567,7 +567,7 @@ void BasicChargePoint20::scheduleReconnect()
     if (!m_reconnect_scheduled)
     {
         m_reconnect_scheduled = true;
-        m_worker_pool->run<void>(
+        m_worker_pool->post(
             [this]
             {
                 // Wait to let some time to configure other parameters
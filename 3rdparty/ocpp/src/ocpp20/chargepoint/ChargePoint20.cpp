@@ -1385,7 +1385,7 @@ void ChargePoint20::processUptime()
     // Save counters
     if ((m_uptime % 15u) == 0)
     {
-        m_worker_pool->run<void>(std::bind(&ChargePoint20::saveUptime, this));
+        m_worker_pool->post(std::bind(&ChargePoint20::saveUptime, this));
     }
 }
 
@@ -1405,7 +1405,7 @@ void ChargePoint20::scheduleReconnect()
     if (!m_reconnect_scheduled)
     {
         m_reconnect_scheduled = true;
-        m_worker_pool->run<void>(
+        m_worker_pool->post(
             [this]
             {
                 // Wait to let some time to configure other parameters
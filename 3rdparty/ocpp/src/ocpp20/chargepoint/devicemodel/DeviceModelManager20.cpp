@@ -76,16 +76,12 @@ bool DeviceModelManager::load(const std::string& device_model_file_path)
         if (error == rapidjson::ParseErrorCode ::kParseErrorNone)
         {
             // Validate schema
-            ret = m_validator.isValid(device_model_doc);
+            ret = m_validator.isValid(device_model_doc, m_last_error);
             if (ret)
             {
                 // Load the device model
                 loadDeviceModel(device_model_doc);
             }
-            else
-            {
-                m_last_error = m_validator.lastError();
-            }
         }
         else
         {
@@ -80,8 +80,8 @@ StatusManager::StatusManager(const ocpp::config::IChargePointConfig20& stack_con
     trigger_manager.registerHandler(MessageTriggerEnumType::StatusNotification, *this);
     trigger_manager.registerHandler(MessageTriggerEnumType::Heartbeat, *this);
 
-    m_boot_notification_timer.setCallback([this] { m_worker_pool.run<void>(std::bind(&StatusManager::bootNotificationProcess, this)); });
-    m_heartbeat_timer.setCallback([this] { m_worker_pool.run<void>(std::bind(&StatusManager::heartBeatProcess, this)); });
+    m_boot_notification_timer.setCallback([this] { m_worker_pool.post(std::bind(&StatusManager::bootNotificationProcess, this)); });
+    m_heartbeat_timer.setCallback([this] { m_worker_pool.post(std::bind(&StatusManager::heartBeatProcess, this)); });
 
     // Look for HeartBeatInterval variable in the device model
     GetVariableDataType var_req;
@@ -254,7 +254,7 @@ bool StatusManager::updateConnectorStatus(unsigned int
             if (m_registration_status == RegistrationStatusEnumType::Accepted)
             {
                 // Notify now
-                m_worker_pool.run<void>(std::bind(&StatusManager::statusNotificationProcess, this, evse_id, connector_id));
+                m_worker_pool.post(std::bind(&StatusManager::statusNotificationProcess, this, evse_id, connector_id));
             }
         }
         ret = true;
@@ -293,7 +293,7 @@ bool StatusManager::onTriggerMessage(ocpp::types::ocpp20::MessageTriggerEnumType
     {
         case MessageTriggerEnumType::BootNotification:
         {
-            m_worker_pool.run<void>(
+            m_worker_pool.post(
                 [this]
                 {
                     // To let some time for the trigger message reply
@@ -305,7 +305,7 @@ bool StatusManager::onTriggerMessage(ocpp::types::ocpp20::MessageTriggerEnumType
 
         case MessageTriggerEnumType::Heartbeat:
         {
-            m_worker_pool.run<void>(
+            m_worker_pool.post(
                 [this]
                 {
                     // To let some time for the trigger message reply
@@ -321,7 +321,7 @@ bool StatusManager::onTriggerMessage(ocpp::types::ocpp20::MessageTriggerEnumType
             {
                 if (evse.value().connectorId.isSet())
                 {
-                    m_worker_pool.run<void>(
+                    m_worker_pool.post(
                         [this, evse_id = evse.value().id, connector_id = evse.value().connectorId.value()]
                         {
                             // To let some time for the trigger message reply
@@ -336,7 +336,7 @@ bool StatusManager::onTriggerMessage(ocpp::types::ocpp20::MessageTriggerEnumType
                     {
                         for (const Connector* connector : req_evse->connectors)
                         {
-                            m_worker_pool.run<void>(
+                            m_worker_pool.post(
                                 [this, evse_id = req_evse->id, connector_id = connector->id]
                                 {
                                     // To let some time for the trigger message reply
@@ -353,7 +353,7 @@ bool StatusManager::onTriggerMessage(ocpp::types::ocpp20::MessageTriggerEnumType
                 {
                     for (const Connector* connector : evse->connectors)
                     {
-                        m_worker_pool.run<void>(
+                        m_worker_pool.post(
                             [this, evse_id = evse->id, connector_id = connector->id]
                             {
                                 // To let some time for the trigger message reply
@@ -46,7 +46,12 @@ CentralSystemProxy20::CentralSystemProxy20(const std::string&
                                            ocpp::rpc::RpcPool&                                rpc_pool)
     : m_identifier(identifier),
       m_stack_config(stack_config),
-      m_websocket(ocpp::websockets::WebsocketFactory::newClientFromPool()),
+      m_websocket(ocpp::websockets::WebsocketFactory::newClientFromPool(
+          ocpp::websockets::CompressionConfig(stack_config.centralSystemWebSocketCompression(),
+                                              stack_config.webSocketCompressionServerNoContextTakeover(),
+                                              stack_config.webSocketCompressionClientNoContextTakeover(),
+                                              stack_config.webSocketCompressionServerMaxWindowBits(),
+                                              stack_config.webSocketCompressionClientMaxWindowBits()))),
       m_rpc(*m_websocket, "ocpp2.0.1", &rpc_pool),
       m_messages_converter(messages_converter),
       m_msg_dispatcher(messages_validator),
@@ -39,6 +39,9 @@ class ILocalControllerConfig20 : public ICentralSystemConfig20
     virtual unsigned int incomingRequestsFromCsThreadPoolSize() const = 0;
     /** @brief Disconnect from Charge Point on Central System disconnection */
     virtual bool disconnectFromCpWhenCsDisconnected() const = 0;
+    /** @brief Enable the negotiation of the permessage-deflate compression on the connections to the Central System
+     *         (uses the same compression parameters as the Charge Point connections) */
+    virtual bool centralSystemWebSocketCompression() const = 0;
 };
 
 } // namespace config
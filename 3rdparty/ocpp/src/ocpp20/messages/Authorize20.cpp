@@ -33,33 +33,38 @@ namespace ocpp20
 {
 
 /** @brief Convert a AuthorizeReq from a JSON representation */
-bool AuthorizeReqConverter::fromJson(const rapidjson::Value& json, AuthorizeReq& data, std::string& error_code, std::string& error_message)
+bool AuthorizeReqConverter::fromJson(const rapidjson::Value& json,
+                                     AuthorizeReq&           data,
+                                     std::string&            error_code,
+                                     std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // idToken
     ocpp::types::ocpp20::IdTokenTypeConverter idToken_converter;
-    ret = ret && idToken_converter.fromJson(json["idToken"], data.idToken, error_code, error_message);
+    ret = ret && extract(json, "idToken", data.idToken, idToken_converter, error_code, error_message);
 
     // certificate
-    extract(json, "certificate", data.certificate);
+    ret = ret && extract(json, "certificate", data.certificate, error_message);
 
     // iso15118CertificateHashData
-    if (json.HasMember("iso15118CertificateHashData"))
+    ret = ret && checkArray(json, "iso15118CertificateHashData", false, 1u, 4u, error_message);
+    if (ret && json.HasMember("iso15118CertificateHashData"))
     {
         const rapidjson::Value&                           iso15118CertificateHashData_json = json["iso15118CertificateHashData"];
         ocpp::types::ocpp20::OCSPRequestDataTypeConverter iso15118CertificateHashData_converter;
         for (auto it = iso15118CertificateHashData_json.Begin(); ret && (it != iso15118CertificateHashData_json.End()); ++it)
         {
-            ocpp::types::ocpp20::OCSPRequestDataType& item = data.iso15118CertificateHashData.emplace_back();
-            ret = ret && iso15118CertificateHashData_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it,
+                          "iso15118CertificateHashData",
+                          data.iso15118CertificateHashData.emplace_back(),
+                          iso15118CertificateHashData_converter,
+                          error_code,
+                          error_message);
         }
     }
 
@@ -72,7 +77,7 @@ bool AuthorizeReqConverter::fromJson(const rapidjson::Value& json, AuthorizeReq&
 }
 
 /** @brief Convert a AuthorizeReq to a JSON representation */
-bool AuthorizeReqConverter::toJson(const AuthorizeReq& data, rapidjson::Document& json)
+bool AuthorizeReqConverter::toJson(const AuthorizeReq& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -80,21 +85,19 @@ bool AuthorizeReqConverter::toJson(const AuthorizeReq& data, rapidjson::Document
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // idToken
     ocpp::types::ocpp20::IdTokenTypeConverter idToken_converter;
-    idToken_converter.setAllocator(allocator);
-    rapidjson::Document idToken_doc(rapidjson::kObjectType);
-    ret = ret && idToken_converter.toJson(data.idToken, idToken_doc);
-    json.AddMember(rapidjson::StringRef("idToken"), idToken_doc.Move(), *allocator);
+    rapidjson::Value                          idToken_doc(rapidjson::kObjectType);
+    ret = ret && idToken_converter.toJson(data.idToken, idToken_doc, allocator);
+    json.AddMember(rapidjson::StringRef("idToken"), idToken_doc.Move(), allocator);
 
     // certificate
-    fill(json, "certificate", data.certificate);
+    fill(json, "certificate", data.certificate, allocator);
 
     // iso15118CertificateHashData
     if (!data.iso15118CertificateHashData.empty())
@@ -102,14 +105,13 @@ bool AuthorizeReqConverter::toJson(const AuthorizeReq& data, rapidjson::Document
 
         rapidjson::Value                                  iso15118CertificateHashData_json(rapidjson::kArrayType);
         ocpp::types::ocpp20::OCSPRequestDataTypeConverter iso15118CertificateHashData_converter;
-        iso15118CertificateHashData_converter.setAllocator(allocator);
         for (const ocpp::types::ocpp20::OCSPRequestDataType& item : data.iso15118CertificateHashData)
         {
-            rapidjson::Document item_doc(rapidjson::kObjectType);
-            ret = ret && iso15118CertificateHashData_converter.toJson(item, item_doc);
-            iso15118CertificateHashData_json.PushBack(item_doc.Move(), *allocator);
+            rapidjson::Value item_doc(rapidjson::kObjectType);
+            ret = ret && iso15118CertificateHashData_converter.toJson(item, item_doc, allocator);
+            iso15118CertificateHashData_json.PushBack(item_doc.Move(), allocator);
         }
-        json.AddMember(rapidjson::StringRef("iso15118CertificateHashData"), iso15118CertificateHashData_json.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("iso15118CertificateHashData"), iso15118CertificateHashData_json.Move(), allocator);
     }
 
     return ret;
@@ -119,27 +121,24 @@ bool AuthorizeReqConverter::toJson(const AuthorizeReq& data, rapidjson::Document
 bool AuthorizeConfConverter::fromJson(const rapidjson::Value& json,
                                       AuthorizeConf&          data,
                                       std::string&            error_code,
-                                      std::string&            error_message)
+                                      std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // idTokenInfo
     ocpp::types::ocpp20::IdTokenInfoTypeConverter idTokenInfo_converter;
-    ret = ret && idTokenInfo_converter.fromJson(json["idTokenInfo"], data.idTokenInfo, error_code, error_message);
+    ret = ret && extract(json, "idTokenInfo", data.idTokenInfo, idTokenInfo_converter, error_code, error_message);
 
     // certificateStatus
-    if (json.HasMember("certificateStatus"))
-    {
-        data.certificateStatus =
-            ocpp::types::ocpp20::AuthorizeCertificateStatusEnumTypeHelper.fromString(json["certificateStatus"].GetString());
-    }
+    ret = ret && extract(json,
+                         "certificateStatus",
+                         data.certificateStatus,
+                         ocpp::types::ocpp20::AuthorizeCertificateStatusEnumTypeHelper,
+                         error_message);
 
     if (!ret)
     {
@@ -150,7 +149,7 @@ bool AuthorizeConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a AuthorizeConf to a JSON representation */
-bool AuthorizeConfConverter::toJson(const AuthorizeConf& data, rapidjson::Document& json)
+bool AuthorizeConfConverter::toJson(const AuthorizeConf& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -158,23 +157,24 @@ bool AuthorizeConfConverter::toJson(const AuthorizeConf& data, rapidjson::Docume
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // idTokenInfo
     ocpp::types::ocpp20::IdTokenInfoTypeConverter idTokenInfo_converter;
-    idTokenInfo_converter.setAllocator(allocator);
-    rapidjson::Document idTokenInfo_doc(rapidjson::kObjectType);
-    ret = ret && idTokenInfo_converter.toJson(data.idTokenInfo, idTokenInfo_doc);
-    json.AddMember(rapidjson::StringRef("idTokenInfo"), idTokenInfo_doc.Move(), *allocator);
+    rapidjson::Value                              idTokenInfo_doc(rapidjson::kObjectType);
+    ret = ret && idTokenInfo_converter.toJson(data.idTokenInfo, idTokenInfo_doc, allocator);
+    json.AddMember(rapidjson::StringRef("idTokenInfo"), idTokenInfo_doc.Move(), allocator);
 
     // certificateStatus
     if (data.certificateStatus.isSet())
     {
-        fill(json, "certificateStatus", ocpp::types::ocpp20::AuthorizeCertificateStatusEnumTypeHelper.toString(data.certificateStatus));
+        fill(json,
+             "certificateStatus",
+             ocpp::types::ocpp20::AuthorizeCertificateStatusEnumTypeHelper.toString(data.certificateStatus),
+             allocator);
     }
 
     return ret;
@@ -36,23 +36,20 @@ namespace ocpp20
 bool BootNotificationReqConverter::fromJson(const rapidjson::Value& json,
                                             BootNotificationReq&    data,
                                             std::string&            error_code,
-                                            std::string&            error_message)
+                                            std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // chargingStation
     ocpp::types::ocpp20::ChargingStationTypeConverter chargingStation_converter;
-    ret = ret && chargingStation_converter.fromJson(json["chargingStation"], data.chargingStation, error_code, error_message);
+    ret = ret && extract(json, "chargingStation", data.chargingStation, chargingStation_converter, error_code, error_message);
 
     // reason
-    data.reason = ocpp::types::ocpp20::BootReasonEnumTypeHelper.fromString(json["reason"].GetString());
+    ret = ret && extract(json, "reason", data.reason, ocpp::types::ocpp20::BootReasonEnumTypeHelper, error_message);
 
     if (!ret)
     {
@@ -63,7 +60,9 @@ bool BootNotificationReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a BootNotificationReq to a JSON representation */
-bool BootNotificationReqConverter::toJson(const BootNotificationReq& data, rapidjson::Document& json)
+bool BootNotificationReqConverter::toJson(const BootNotificationReq&          data,
+                                          rapidjson::Value&                   json,
+                                          rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -71,21 +70,19 @@ bool BootNotificationReqConverter::toJson(const BootNotificationReq& data, rapid
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // chargingStation
     ocpp::types::ocpp20::ChargingStationTypeConverter chargingStation_converter;
-    chargingStation_converter.setAllocator(allocator);
-    rapidjson::Document chargingStation_doc(rapidjson::kObjectType);
-    ret = ret && chargingStation_converter.toJson(data.chargingStation, chargingStation_doc);
-    json.AddMember(rapidjson::StringRef("chargingStation"), chargingStation_doc.Move(), *allocator);
+    rapidjson::Value                                  chargingStation_doc(rapidjson::kObjectType);
+    ret = ret && chargingStation_converter.toJson(data.chargingStation, chargingStation_doc, allocator);
+    json.AddMember(rapidjson::StringRef("chargingStation"), chargingStation_doc.Move(), allocator);
 
     // reason
-    fill(json, "reason", ocpp::types::ocpp20::BootReasonEnumTypeHelper.toString(data.reason));
+    fill(json, "reason", ocpp::types::ocpp20::BootReasonEnumTypeHelper.toString(data.reason), allocator);
 
     return ret;
 }
@@ -94,32 +91,26 @@ bool BootNotificationReqConverter::toJson(const BootNotificationReq& data, rapid
 bool BootNotificationConfConverter::fromJson(const rapidjson::Value& json,
                                              BootNotificationConf&   data,
                                              std::string&            error_code,
-                                             std::string&            error_message)
+                                             std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // currentTime
     ret = ret && extract(json, "currentTime", data.currentTime, error_message);
 
     // interval
-    extract(json, "interval", data.interval);
+    ret = ret && extract(json, "interval", data.interval, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::RegistrationStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::RegistrationStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -130,7 +121,9 @@ bool BootNotificationConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a BootNotificationConf to a JSON representation */
-bool BootNotificationConfConverter::toJson(const BootNotificationConf& data, rapidjson::Document& json)
+bool BootNotificationConfConverter::toJson(const BootNotificationConf&         data,
+                                           rapidjson::Value&                   json,
+                                           rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -138,29 +131,27 @@ bool BootNotificationConfConverter::toJson(const BootNotificationConf& data, rap
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // currentTime
-    fill(json, "currentTime", data.currentTime);
+    fill(json, "currentTime", data.currentTime, allocator);
 
     // interval
-    fill(json, "interval", data.interval);
+    fill(json, "interval", data.interval, allocator);
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::RegistrationStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::RegistrationStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
@@ -36,19 +36,16 @@ namespace ocpp20
 bool CancelReservationReqConverter::fromJson(const rapidjson::Value& json,
                                              CancelReservationReq&   data,
                                              std::string&            error_code,
-                                             std::string&            error_message)
+                                             std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // reservationId
-    extract(json, "reservationId", data.reservationId);
+    ret = ret && extract(json, "reservationId", data.reservationId, error_message);
 
     if (!ret)
     {
@@ -59,7 +56,9 @@ bool CancelReservationReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a CancelReservationReq to a JSON representation */
-bool CancelReservationReqConverter::toJson(const CancelReservationReq& data, rapidjson::Document& json)
+bool CancelReservationReqConverter::toJson(const CancelReservationReq&         data,
+                                           rapidjson::Value&                   json,
+                                           rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -67,14 +66,13 @@ bool CancelReservationReqConverter::toJson(const CancelReservationReq& data, rap
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // reservationId
-    fill(json, "reservationId", data.reservationId);
+    fill(json, "reservationId", data.reservationId, allocator);
 
     return ret;
 }
@@ -83,26 +81,20 @@ bool CancelReservationReqConverter::toJson(const CancelReservationReq& data, rap
 bool CancelReservationConfConverter::fromJson(const rapidjson::Value& json,
                                               CancelReservationConf&  data,
                                               std::string&            error_code,
-                                              std::string&            error_message)
+                                              std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::CancelReservationStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::CancelReservationStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -113,7 +105,9 @@ bool CancelReservationConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a CancelReservationConf to a JSON representation */
-bool CancelReservationConfConverter::toJson(const CancelReservationConf& data, rapidjson::Document& json)
+bool CancelReservationConfConverter::toJson(const CancelReservationConf&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -121,23 +115,21 @@ bool CancelReservationConfConverter::toJson(const CancelReservationConf& data, r
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::CancelReservationStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::CancelReservationStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
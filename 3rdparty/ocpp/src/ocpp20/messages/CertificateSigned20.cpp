@@ -36,25 +36,20 @@ namespace ocpp20
 bool CertificateSignedReqConverter::fromJson(const rapidjson::Value& json,
                                              CertificateSignedReq&   data,
                                              std::string&            error_code,
-                                             std::string&            error_message)
+                                             std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // certificateChain
-    extract(json, "certificateChain", data.certificateChain);
+    ret = ret && extract(json, "certificateChain", data.certificateChain, error_message);
 
     // certificateType
-    if (json.HasMember("certificateType"))
-    {
-        data.certificateType = ocpp::types::ocpp20::CertificateSigningUseEnumTypeHelper.fromString(json["certificateType"].GetString());
-    }
+    ret = ret &&
+          extract(json, "certificateType", data.certificateType, ocpp::types::ocpp20::CertificateSigningUseEnumTypeHelper, error_message);
 
     if (!ret)
     {
@@ -65,7 +60,9 @@ bool CertificateSignedReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a CertificateSignedReq to a JSON representation */
-bool CertificateSignedReqConverter::toJson(const CertificateSignedReq& data, rapidjson::Document& json)
+bool CertificateSignedReqConverter::toJson(const CertificateSignedReq&         data,
+                                           rapidjson::Value&                   json,
+                                           rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -73,19 +70,18 @@ bool CertificateSignedReqConverter::toJson(const CertificateSignedReq& data, rap
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // certificateChain
-    fill(json, "certificateChain", data.certificateChain);
+    fill(json, "certificateChain", data.certificateChain, allocator);
 
     // certificateType
     if (data.certificateType.isSet())
     {
-        fill(json, "certificateType", ocpp::types::ocpp20::CertificateSigningUseEnumTypeHelper.toString(data.certificateType));
+        fill(json, "certificateType", ocpp::types::ocpp20::CertificateSigningUseEnumTypeHelper.toString(data.certificateType), allocator);
     }
 
     return ret;
@@ -95,26 +91,20 @@ bool CertificateSignedReqConverter::toJson(const CertificateSignedReq& data, rap
 bool CertificateSignedConfConverter::fromJson(const rapidjson::Value& json,
                                               CertificateSignedConf&  data,
                                               std::string&            error_code,
-                                              std::string&            error_message)
+                                              std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::CertificateSignedStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::CertificateSignedStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -125,7 +115,9 @@ bool CertificateSignedConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a CertificateSignedConf to a JSON representation */
-bool CertificateSignedConfConverter::toJson(const CertificateSignedConf& data, rapidjson::Document& json)
+bool CertificateSignedConfConverter::toJson(const CertificateSignedConf&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -133,23 +125,21 @@ bool CertificateSignedConfConverter::toJson(const CertificateSignedConf& data, r
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::CertificateSignedStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::CertificateSignedStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
@@ -36,26 +36,21 @@ namespace ocpp20
 bool ChangeAvailabilityReqConverter::fromJson(const rapidjson::Value& json,
                                               ChangeAvailabilityReq&  data,
                                               std::string&            error_code,
-                                              std::string&            error_message)
+                                              std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // evse
-    if (json.HasMember("evse"))
-    {
-        ocpp::types::ocpp20::EVSETypeConverter evse_converter;
-        ret = ret && evse_converter.fromJson(json["evse"], data.evse, error_code, error_message);
-    }
+    ocpp::types::ocpp20::EVSETypeConverter evse_converter;
+    ret = ret && extract(json, "evse", data.evse, evse_converter, error_code, error_message);
 
     // operationalStatus
-    data.operationalStatus = ocpp::types::ocpp20::OperationalStatusEnumTypeHelper.fromString(json["operationalStatus"].GetString());
+    ret = ret &&
+          extract(json, "operationalStatus", data.operationalStatus, ocpp::types::ocpp20::OperationalStatusEnumTypeHelper, error_message);
 
     if (!ret)
     {
@@ -66,7 +61,9 @@ bool ChangeAvailabilityReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a ChangeAvailabilityReq to a JSON representation */
-bool ChangeAvailabilityReqConverter::toJson(const ChangeAvailabilityReq& data, rapidjson::Document& json)
+bool ChangeAvailabilityReqConverter::toJson(const ChangeAvailabilityReq&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -74,24 +71,22 @@ bool ChangeAvailabilityReqConverter::toJson(const ChangeAvailabilityReq& data, r
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // evse
     if (data.evse.isSet())
     {
         ocpp::types::ocpp20::EVSETypeConverter evse_converter;
-        evse_converter.setAllocator(allocator);
-        rapidjson::Document evse_doc(rapidjson::kObjectType);
-        ret = ret && evse_converter.toJson(data.evse, evse_doc);
-        json.AddMember(rapidjson::StringRef("evse"), evse_doc.Move(), *allocator);
+        rapidjson::Value                       evse_doc(rapidjson::kObjectType);
+        ret = ret && evse_converter.toJson(data.evse, evse_doc, allocator);
+        json.AddMember(rapidjson::StringRef("evse"), evse_doc.Move(), allocator);
     }
 
     // operationalStatus
-    fill(json, "operationalStatus", ocpp::types::ocpp20::OperationalStatusEnumTypeHelper.toString(data.operationalStatus));
+    fill(json, "operationalStatus", ocpp::types::ocpp20::OperationalStatusEnumTypeHelper.toString(data.operationalStatus), allocator);
 
     return ret;
 }
@@ -100,26 +95,20 @@ bool ChangeAvailabilityReqConverter::toJson(const ChangeAvailabilityReq& data, r
 bool ChangeAvailabilityConfConverter::fromJson(const rapidjson::Value& json,
                                                ChangeAvailabilityConf& data,
                                                std::string&            error_code,
-                                               std::string&            error_message)
+                                               std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::ChangeAvailabilityStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::ChangeAvailabilityStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -130,7 +119,9 @@ bool ChangeAvailabilityConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a ChangeAvailabilityConf to a JSON representation */
-bool ChangeAvailabilityConfConverter::toJson(const ChangeAvailabilityConf& data, rapidjson::Document& json)
+bool ChangeAvailabilityConfConverter::toJson(const ChangeAvailabilityConf&       data,
+                                             rapidjson::Value&                   json,
+                                             rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -138,23 +129,21 @@ bool ChangeAvailabilityConfConverter::toJson(const ChangeAvailabilityConf& data,
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::ChangeAvailabilityStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::ChangeAvailabilityStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
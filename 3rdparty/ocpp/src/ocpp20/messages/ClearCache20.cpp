@@ -36,16 +36,13 @@ namespace ocpp20
 bool ClearCacheReqConverter::fromJson(const rapidjson::Value& json,
                                       ClearCacheReq&          data,
                                       std::string&            error_code,
-                                      std::string&            error_message)
+                                      std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -56,7 +53,7 @@ bool ClearCacheReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a ClearCacheReq to a JSON representation */
-bool ClearCacheReqConverter::toJson(const ClearCacheReq& data, rapidjson::Document& json)
+bool ClearCacheReqConverter::toJson(const ClearCacheReq& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -64,10 +61,9 @@ bool ClearCacheReqConverter::toJson(const ClearCacheReq& data, rapidjson::Docume
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     return ret;
@@ -77,26 +73,20 @@ bool ClearCacheReqConverter::toJson(const ClearCacheReq& data, rapidjson::Docume
 bool ClearCacheConfConverter::fromJson(const rapidjson::Value& json,
                                        ClearCacheConf&         data,
                                        std::string&            error_code,
-                                       std::string&            error_message)
+                                       std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::ClearCacheStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::ClearCacheStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -107,7 +97,9 @@ bool ClearCacheConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a ClearCacheConf to a JSON representation */
-bool ClearCacheConfConverter::toJson(const ClearCacheConf& data, rapidjson::Document& json)
+bool ClearCacheConfConverter::toJson(const ClearCacheConf&               data,
+                                     rapidjson::Value&                   json,
+                                     rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -115,23 +107,21 @@ bool ClearCacheConfConverter::toJson(const ClearCacheConf& data, rapidjson::Docu
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::ClearCacheStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::ClearCacheStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
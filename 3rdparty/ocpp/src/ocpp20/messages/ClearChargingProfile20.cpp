@@ -36,27 +36,25 @@ namespace ocpp20
 bool ClearChargingProfileReqConverter::fromJson(const rapidjson::Value&  json,
                                                 ClearChargingProfileReq& data,
                                                 std::string&             error_code,
-                                                std::string&             error_message)
+                                                std::string&             error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // chargingProfileId
-    extract(json, "chargingProfileId", data.chargingProfileId);
+    ret = ret && extract(json, "chargingProfileId", data.chargingProfileId, error_message);
 
     // chargingProfileCriteria
-    if (json.HasMember("chargingProfileCriteria"))
-    {
-        ocpp::types::ocpp20::ClearChargingProfileTypeConverter chargingProfileCriteria_converter;
-        ret = ret && chargingProfileCriteria_converter.fromJson(
-                         json["chargingProfileCriteria"], data.chargingProfileCriteria, error_code, error_message);
-    }
+    ocpp::types::ocpp20::ClearChargingProfileTypeConverter chargingProfileCriteria_converter;
+    ret = ret && extract(json,
+                         "chargingProfileCriteria",
+                         data.chargingProfileCriteria,
+                         chargingProfileCriteria_converter,
+                         error_code,
+                         error_message);
 
     if (!ret)
     {
@@ -67,7 +65,9 @@ bool ClearChargingProfileReqConverter::fromJson(const rapidjson::Value&  json,
 }
 
 /** @brief Convert a ClearChargingProfileReq to a JSON representation */
-bool ClearChargingProfileReqConverter::toJson(const ClearChargingProfileReq& data, rapidjson::Document& json)
+bool ClearChargingProfileReqConverter::toJson(const ClearChargingProfileReq&      data,
+                                              rapidjson::Value&                   json,
+                                              rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -75,23 +75,21 @@ bool ClearChargingProfileReqConverter::toJson(const ClearChargingProfileReq& dat
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // chargingProfileId
-    fill(json, "chargingProfileId", data.chargingProfileId);
+    fill(json, "chargingProfileId", data.chargingProfileId, allocator);
 
     // chargingProfileCriteria
     if (data.chargingProfileCriteria.isSet())
     {
         ocpp::types::ocpp20::ClearChargingProfileTypeConverter chargingProfileCriteria_converter;
-        chargingProfileCriteria_converter.setAllocator(allocator);
-        rapidjson::Document chargingProfileCriteria_doc(rapidjson::kObjectType);
-        ret = ret && chargingProfileCriteria_converter.toJson(data.chargingProfileCriteria, chargingProfileCriteria_doc);
-        json.AddMember(rapidjson::StringRef("chargingProfileCriteria"), chargingProfileCriteria_doc.Move(), *allocator);
+        rapidjson::Value                                       chargingProfileCriteria_doc(rapidjson::kObjectType);
+        ret = ret && chargingProfileCriteria_converter.toJson(data.chargingProfileCriteria, chargingProfileCriteria_doc, allocator);
+        json.AddMember(rapidjson::StringRef("chargingProfileCriteria"), chargingProfileCriteria_doc.Move(), allocator);
     }
 
     return ret;
@@ -101,26 +99,20 @@ bool ClearChargingProfileReqConverter::toJson(const ClearChargingProfileReq& dat
 bool ClearChargingProfileConfConverter::fromJson(const rapidjson::Value&   json,
                                                  ClearChargingProfileConf& data,
                                                  std::string&              error_code,
-                                                 std::string&              error_message)
+                                                 std::string&              error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::ClearChargingProfileStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::ClearChargingProfileStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -131,7 +123,9 @@ bool ClearChargingProfileConfConverter::fromJson(const rapidjson::Value&   json,
 }
 
 /** @brief Convert a ClearChargingProfileConf to a JSON representation */
-bool ClearChargingProfileConfConverter::toJson(const ClearChargingProfileConf& data, rapidjson::Document& json)
+bool ClearChargingProfileConfConverter::toJson(const ClearChargingProfileConf&     data,
+                                               rapidjson::Value&                   json,
+                                               rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -139,23 +133,21 @@ bool ClearChargingProfileConfConverter::toJson(const ClearChargingProfileConf& d
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::ClearChargingProfileStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::ClearChargingProfileStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
@@ -36,19 +36,16 @@ namespace ocpp20
 bool ClearDisplayMessageReqConverter::fromJson(const rapidjson::Value& json,
                                                ClearDisplayMessageReq& data,
                                                std::string&            error_code,
-                                               std::string&            error_message)
+                                               std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // id
-    extract(json, "id", data.id);
+    ret = ret && extract(json, "id", data.id, error_message);
 
     if (!ret)
     {
@@ -59,7 +56,9 @@ bool ClearDisplayMessageReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a ClearDisplayMessageReq to a JSON representation */
-bool ClearDisplayMessageReqConverter::toJson(const ClearDisplayMessageReq& data, rapidjson::Document& json)
+bool ClearDisplayMessageReqConverter::toJson(const ClearDisplayMessageReq&       data,
+                                             rapidjson::Value&                   json,
+                                             rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -67,14 +66,13 @@ bool ClearDisplayMessageReqConverter::toJson(const ClearDisplayMessageReq& data,
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // id
-    fill(json, "id", data.id);
+    fill(json, "id", data.id, allocator);
 
     return ret;
 }
@@ -83,26 +81,20 @@ bool ClearDisplayMessageReqConverter::toJson(const ClearDisplayMessageReq& data,
 bool ClearDisplayMessageConfConverter::fromJson(const rapidjson::Value&  json,
                                                 ClearDisplayMessageConf& data,
                                                 std::string&             error_code,
-                                                std::string&             error_message)
+                                                std::string&             error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::ClearMessageStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::ClearMessageStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -113,7 +105,9 @@ bool ClearDisplayMessageConfConverter::fromJson(const rapidjson::Value&  json,
 }
 
 /** @brief Convert a ClearDisplayMessageConf to a JSON representation */
-bool ClearDisplayMessageConfConverter::toJson(const ClearDisplayMessageConf& data, rapidjson::Document& json)
+bool ClearDisplayMessageConfConverter::toJson(const ClearDisplayMessageConf&      data,
+                                              rapidjson::Value&                   json,
+                                              rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -121,23 +115,21 @@ bool ClearDisplayMessageConfConverter::toJson(const ClearDisplayMessageConf& dat
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::ClearMessageStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::ClearMessageStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
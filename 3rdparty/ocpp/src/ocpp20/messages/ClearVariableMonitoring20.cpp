@@ -36,25 +36,22 @@ namespace ocpp20
 bool ClearVariableMonitoringReqConverter::fromJson(const rapidjson::Value&     json,
                                                    ClearVariableMonitoringReq& data,
                                                    std::string&                error_code,
-                                                   std::string&                error_message)
+                                                   std::string&                error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // id
-    if (json.HasMember("id"))
+    ret = ret && checkArray(json, "id", true, 1u, 0u, error_message);
+    if (ret && json.HasMember("id"))
     {
         const rapidjson::Value& id_json = json["id"];
         for (auto it = id_json.Begin(); ret && (it != id_json.End()); ++it)
         {
-            int& item = data.id.emplace_back();
-            item      = it->GetInt();
+            ret = convert(*it, "id", data.id.emplace_back(), error_message);
         }
     }
 
@@ -67,7 +64,9 @@ bool ClearVariableMonitoringReqConverter::fromJson(const rapidjson::Value&     j
 }
 
 /** @brief Convert a ClearVariableMonitoringReq to a JSON representation */
-bool ClearVariableMonitoringReqConverter::toJson(const ClearVariableMonitoringReq& data, rapidjson::Document& json)
+bool ClearVariableMonitoringReqConverter::toJson(const ClearVariableMonitoringReq&   data,
+                                                 rapidjson::Value&                   json,
+                                                 rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -75,10 +74,9 @@ bool ClearVariableMonitoringReqConverter::toJson(const ClearVariableMonitoringRe
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // id
@@ -86,9 +84,9 @@ bool ClearVariableMonitoringReqConverter::toJson(const ClearVariableMonitoringRe
     rapidjson::Value id_json(rapidjson::kArrayType);
     for (const int& item : data.id)
     {
-        id_json.PushBack(rapidjson::Value(item), *allocator);
+        id_json.PushBack(rapidjson::Value(item), allocator);
     }
-    json.AddMember(rapidjson::StringRef("id"), id_json.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("id"), id_json.Move(), allocator);
 
     return ret;
 }
@@ -97,26 +95,28 @@ bool ClearVariableMonitoringReqConverter::toJson(const ClearVariableMonitoringRe
 bool ClearVariableMonitoringConfConverter::fromJson(const rapidjson::Value&      json,
                                                     ClearVariableMonitoringConf& data,
                                                     std::string&                 error_code,
-                                                    std::string&                 error_message)
+                                                    std::string&                 error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // clearMonitoringResult
-    if (json.HasMember("clearMonitoringResult"))
+    ret = ret && checkArray(json, "clearMonitoringResult", true, 1u, 0u, error_message);
+    if (ret && json.HasMember("clearMonitoringResult"))
     {
         const rapidjson::Value&                                 clearMonitoringResult_json = json["clearMonitoringResult"];
         ocpp::types::ocpp20::ClearMonitoringResultTypeConverter clearMonitoringResult_converter;
         for (auto it = clearMonitoringResult_json.Begin(); ret && (it != clearMonitoringResult_json.End()); ++it)
         {
-            ocpp::types::ocpp20::ClearMonitoringResultType& item = data.clearMonitoringResult.emplace_back();
-            ret = ret && clearMonitoringResult_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it,
+                          "clearMonitoringResult",
+                          data.clearMonitoringResult.emplace_back(),
+                          clearMonitoringResult_converter,
+                          error_code,
+                          error_message);
         }
     }
 
@@ -129,7 +129,9 @@ bool ClearVariableMonitoringConfConverter::fromJson(const rapidjson::Value&
 }
 
 /** @brief Convert a ClearVariableMonitoringConf to a JSON representation */
-bool ClearVariableMonitoringConfConverter::toJson(const ClearVariableMonitoringConf& data, rapidjson::Document& json)
+bool ClearVariableMonitoringConfConverter::toJson(const ClearVariableMonitoringConf&  data,
+                                                  rapidjson::Value&                   json,
+                                                  rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -137,24 +139,22 @@ bool ClearVariableMonitoringConfConverter::toJson(const ClearVariableMonitoringC
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // clearMonitoringResult
 
     rapidjson::Value                                        clearMonitoringResult_json(rapidjson::kArrayType);
     ocpp::types::ocpp20::ClearMonitoringResultTypeConverter clearMonitoringResult_converter;
-    clearMonitoringResult_converter.setAllocator(allocator);
     for (const ocpp::types::ocpp20::ClearMonitoringResultType& item : data.clearMonitoringResult)
     {
-        rapidjson::Document item_doc(rapidjson::kObjectType);
-        ret = ret && clearMonitoringResult_converter.toJson(item, item_doc);
-        clearMonitoringResult_json.PushBack(item_doc.Move(), *allocator);
+        rapidjson::Value item_doc(rapidjson::kObjectType);
+        ret = ret && clearMonitoringResult_converter.toJson(item, item_doc, allocator);
+        clearMonitoringResult_json.PushBack(item_doc.Move(), allocator);
     }
-    json.AddMember(rapidjson::StringRef("clearMonitoringResult"), clearMonitoringResult_json.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("clearMonitoringResult"), clearMonitoringResult_json.Move(), allocator);
 
     return ret;
 }
@@ -36,22 +36,23 @@ namespace ocpp20
 bool ClearedChargingLimitReqConverter::fromJson(const rapidjson::Value&  json,
                                                 ClearedChargingLimitReq& data,
                                                 std::string&             error_code,
-                                                std::string&             error_message)
+                                                std::string&             error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // chargingLimitSource
-    data.chargingLimitSource = ocpp::types::ocpp20::ChargingLimitSourceEnumTypeHelper.fromString(json["chargingLimitSource"].GetString());
+    ret = ret && extract(json,
+                         "chargingLimitSource",
+                         data.chargingLimitSource,
+                         ocpp::types::ocpp20::ChargingLimitSourceEnumTypeHelper,
+                         error_message);
 
     // evseId
-    extract(json, "evseId", data.evseId);
+    ret = ret && extract(json, "evseId", data.evseId, error_message);
 
     if (!ret)
     {
@@ -62,7 +63,9 @@ bool ClearedChargingLimitReqConverter::fromJson(const rapidjson::Value&  json,
 }
 
 /** @brief Convert a ClearedChargingLimitReq to a JSON representation */
-bool ClearedChargingLimitReqConverter::toJson(const ClearedChargingLimitReq& data, rapidjson::Document& json)
+bool ClearedChargingLimitReqConverter::toJson(const ClearedChargingLimitReq&      data,
+                                              rapidjson::Value&                   json,
+                                              rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -70,17 +73,16 @@ bool ClearedChargingLimitReqConverter::toJson(const ClearedChargingLimitReq& dat
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // chargingLimitSource
-    fill(json, "chargingLimitSource", ocpp::types::ocpp20::ChargingLimitSourceEnumTypeHelper.toString(data.chargingLimitSource));
+    fill(json, "chargingLimitSource", ocpp::types::ocpp20::ChargingLimitSourceEnumTypeHelper.toString(data.chargingLimitSource), allocator);
 
     // evseId
-    fill(json, "evseId", data.evseId);
+    fill(json, "evseId", data.evseId, allocator);
 
     return ret;
 }
@@ -89,16 +91,13 @@ bool ClearedChargingLimitReqConverter::toJson(const ClearedChargingLimitReq& dat
 bool ClearedChargingLimitConfConverter::fromJson(const rapidjson::Value&   json,
                                                  ClearedChargingLimitConf& data,
                                                  std::string&              error_code,
-                                                 std::string&              error_message)
+                                                 std::string&              error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -109,7 +108,9 @@ bool ClearedChargingLimitConfConverter::fromJson(const rapidjson::Value&   json,
 }
 
 /** @brief Convert a ClearedChargingLimitConf to a JSON representation */
-bool ClearedChargingLimitConfConverter::toJson(const ClearedChargingLimitConf& data, rapidjson::Document& json)
+bool ClearedChargingLimitConfConverter::toJson(const ClearedChargingLimitConf&     data,
+                                               rapidjson::Value&                   json,
+                                               rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -117,10 +118,9 @@ bool ClearedChargingLimitConfConverter::toJson(const ClearedChargingLimitConf& d
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     return ret;
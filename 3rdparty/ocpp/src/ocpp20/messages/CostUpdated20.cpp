@@ -36,22 +36,19 @@ namespace ocpp20
 bool CostUpdatedReqConverter::fromJson(const rapidjson::Value& json,
                                        CostUpdatedReq&         data,
                                        std::string&            error_code,
-                                       std::string&            error_message)
+                                       std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // totalCost
-    extract(json, "totalCost", data.totalCost);
+    ret = ret && extract(json, "totalCost", data.totalCost, error_message);
 
     // transactionId
-    extract(json, "transactionId", data.transactionId);
+    ret = ret && extract(json, "transactionId", data.transactionId, error_message);
 
     if (!ret)
     {
@@ -62,7 +59,9 @@ bool CostUpdatedReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a CostUpdatedReq to a JSON representation */
-bool CostUpdatedReqConverter::toJson(const CostUpdatedReq& data, rapidjson::Document& json)
+bool CostUpdatedReqConverter::toJson(const CostUpdatedReq&               data,
+                                     rapidjson::Value&                   json,
+                                     rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -70,17 +69,16 @@ bool CostUpdatedReqConverter::toJson(const CostUpdatedReq& data, rapidjson::Docu
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // totalCost
-    fill(json, "totalCost", data.totalCost);
+    fill(json, "totalCost", data.totalCost, allocator);
 
     // transactionId
-    fill(json, "transactionId", data.transactionId);
+    fill(json, "transactionId", data.transactionId, allocator);
 
     return ret;
 }
@@ -89,16 +87,13 @@ bool CostUpdatedReqConverter::toJson(const CostUpdatedReq& data, rapidjson::Docu
 bool CostUpdatedConfConverter::fromJson(const rapidjson::Value& json,
                                         CostUpdatedConf&        data,
                                         std::string&            error_code,
-                                        std::string&            error_message)
+                                        std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -109,7 +104,9 @@ bool CostUpdatedConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a CostUpdatedConf to a JSON representation */
-bool CostUpdatedConfConverter::toJson(const CostUpdatedConf& data, rapidjson::Document& json)
+bool CostUpdatedConfConverter::toJson(const CostUpdatedConf&              data,
+                                      rapidjson::Value&                   json,
+                                      rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -117,10 +114,9 @@ bool CostUpdatedConfConverter::toJson(const CostUpdatedConf& data, rapidjson::Do
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     return ret;
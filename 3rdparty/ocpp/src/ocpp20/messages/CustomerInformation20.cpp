@@ -36,43 +36,33 @@ namespace ocpp20
 bool CustomerInformationReqConverter::fromJson(const rapidjson::Value& json,
                                                CustomerInformationReq& data,
                                                std::string&            error_code,
-                                               std::string&            error_message)
+                                               std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // customerCertificate
-    if (json.HasMember("customerCertificate"))
-    {
-        ocpp::types::ocpp20::CertificateHashDataTypeConverter customerCertificate_converter;
-        ret =
-            ret && customerCertificate_converter.fromJson(json["customerCertificate"], data.customerCertificate, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CertificateHashDataTypeConverter customerCertificate_converter;
+    ret = ret && extract(json, "customerCertificate", data.customerCertificate, customerCertificate_converter, error_code, error_message);
 
     // idToken
-    if (json.HasMember("idToken"))
-    {
-        ocpp::types::ocpp20::IdTokenTypeConverter idToken_converter;
-        ret = ret && idToken_converter.fromJson(json["idToken"], data.idToken, error_code, error_message);
-    }
+    ocpp::types::ocpp20::IdTokenTypeConverter idToken_converter;
+    ret = ret && extract(json, "idToken", data.idToken, idToken_converter, error_code, error_message);
 
     // requestId
-    extract(json, "requestId", data.requestId);
+    ret = ret && extract(json, "requestId", data.requestId, error_message);
 
     // report
-    extract(json, "report", data.report);
+    ret = ret && extract(json, "report", data.report, error_message);
 
     // clear
-    extract(json, "clear", data.clear);
+    ret = ret && extract(json, "clear", data.clear, error_message);
 
     // customerIdentifier
-    extract(json, "customerIdentifier", data.customerIdentifier);
+    ret = ret && extract(json, "customerIdentifier", data.customerIdentifier, error_message);
 
     if (!ret)
     {
@@ -83,7 +73,9 @@ bool CustomerInformationReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a CustomerInformationReq to a JSON representation */
-bool CustomerInformationReqConverter::toJson(const CustomerInformationReq& data, rapidjson::Document& json)
+bool CustomerInformationReqConverter::toJson(const CustomerInformationReq&       data,
+                                             rapidjson::Value&                   json,
+                                             rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -91,43 +83,40 @@ bool CustomerInformationReqConverter::toJson(const CustomerInformationReq& data,
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // customerCertificate
     if (data.customerCertificate.isSet())
     {
         ocpp::types::ocpp20::CertificateHashDataTypeConverter customerCertificate_converter;
-        customerCertificate_converter.setAllocator(allocator);
-        rapidjson::Document customerCertificate_doc(rapidjson::kObjectType);
-        ret = ret && customerCertificate_converter.toJson(data.customerCertificate, customerCertificate_doc);
-        json.AddMember(rapidjson::StringRef("customerCertificate"), customerCertificate_doc.Move(), *allocator);
+        rapidjson::Value                                      customerCertificate_doc(rapidjson::kObjectType);
+        ret = ret && customerCertificate_converter.toJson(data.customerCertificate, customerCertificate_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customerCertificate"), customerCertificate_doc.Move(), allocator);
     }
 
     // idToken
     if (data.idToken.isSet())
     {
         ocpp::types::ocpp20::IdTokenTypeConverter idToken_converter;
-        idToken_converter.setAllocator(allocator);
-        rapidjson::Document idToken_doc(rapidjson::kObjectType);
-        ret = ret && idToken_converter.toJson(data.idToken, idToken_doc);
-        json.AddMember(rapidjson::StringRef("idToken"), idToken_doc.Move(), *allocator);
+        rapidjson::Value                          idToken_doc(rapidjson::kObjectType);
+        ret = ret && idToken_converter.toJson(data.idToken, idToken_doc, allocator);
+        json.AddMember(rapidjson::StringRef("idToken"), idToken_doc.Move(), allocator);
     }
 
     // requestId
-    fill(json, "requestId", data.requestId);
+    fill(json, "requestId", data.requestId, allocator);
 
     // report
-    fill(json, "report", data.report);
+    fill(json, "report", data.report, allocator);
 
     // clear
-    fill(json, "clear", data.clear);
+    fill(json, "clear", data.clear, allocator);
 
     // customerIdentifier
-    fill(json, "customerIdentifier", data.customerIdentifier);
+    fill(json, "customerIdentifier", data.customerIdentifier, allocator);
 
     return ret;
 }
@@ -136,26 +125,20 @@ bool CustomerInformationReqConverter::toJson(const CustomerInformationReq& data,
 bool CustomerInformationConfConverter::fromJson(const rapidjson::Value&  json,
                                                 CustomerInformationConf& data,
                                                 std::string&             error_code,
-                                                std::string&             error_message)
+                                                std::string&             error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::CustomerInformationStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::CustomerInformationStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -166,7 +149,9 @@ bool CustomerInformationConfConverter::fromJson(const rapidjson::Value&  json,
 }
 
 /** @brief Convert a CustomerInformationConf to a JSON representation */
-bool CustomerInformationConfConverter::toJson(const CustomerInformationConf& data, rapidjson::Document& json)
+bool CustomerInformationConfConverter::toJson(const CustomerInformationConf&      data,
+                                              rapidjson::Value&                   json,
+                                              rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -174,23 +159,21 @@ bool CustomerInformationConfConverter::toJson(const CustomerInformationConf& dat
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::CustomerInformationStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::CustomerInformationStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
@@ -36,25 +36,22 @@ namespace ocpp20
 bool DataTransferReqConverter::fromJson(const rapidjson::Value& json,
                                         DataTransferReq&        data,
                                         std::string&            error_code,
-                                        std::string&            error_message)
+                                        std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // messageId
-    extract(json, "messageId", data.messageId);
+    ret = ret && extract(json, "messageId", data.messageId, error_message);
 
     // data
-    extract(json, "data", data.data);
+    ret = ret && extract(json, "data", data.data, error_message);
 
     // vendorId
-    extract(json, "vendorId", data.vendorId);
+    ret = ret && extract(json, "vendorId", data.vendorId, error_message);
 
     if (!ret)
     {
@@ -65,7 +62,9 @@ bool DataTransferReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a DataTransferReq to a JSON representation */
-bool DataTransferReqConverter::toJson(const DataTransferReq& data, rapidjson::Document& json)
+bool DataTransferReqConverter::toJson(const DataTransferReq&              data,
+                                      rapidjson::Value&                   json,
+                                      rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -73,20 +72,19 @@ bool DataTransferReqConverter::toJson(const DataTransferReq& data, rapidjson::Do
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // messageId
-    fill(json, "messageId", data.messageId);
+    fill(json, "messageId", data.messageId, allocator);
 
     // data
-    fill(json, "data", data.data);
+    fill(json, "data", data.data, allocator);
 
     // vendorId
-    fill(json, "vendorId", data.vendorId);
+    fill(json, "vendorId", data.vendorId, allocator);
 
     return ret;
 }
@@ -95,29 +93,23 @@ bool DataTransferReqConverter::toJson(const DataTransferReq& data, rapidjson::Do
 bool DataTransferConfConverter::fromJson(const rapidjson::Value& json,
                                          DataTransferConf&       data,
                                          std::string&            error_code,
-                                         std::string&            error_message)
+                                         std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::DataTransferStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::DataTransferStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     // data
-    extract(json, "data", data.data);
+    ret = ret && extract(json, "data", data.data, error_message);
 
     if (!ret)
     {
@@ -128,7 +120,9 @@ bool DataTransferConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a DataTransferConf to a JSON representation */
-bool DataTransferConfConverter::toJson(const DataTransferConf& data, rapidjson::Document& json)
+bool DataTransferConfConverter::toJson(const DataTransferConf&             data,
+                                       rapidjson::Value&                   json,
+                                       rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -136,27 +130,25 @@ bool DataTransferConfConverter::toJson(const DataTransferConf& data, rapidjson::
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::DataTransferStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::DataTransferStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     // data
-    fill(json, "data", data.data);
+    fill(json, "data", data.data, allocator);
 
     return ret;
 }
@@ -36,20 +36,17 @@ namespace ocpp20
 bool DeleteCertificateReqConverter::fromJson(const rapidjson::Value& json,
                                              DeleteCertificateReq&   data,
                                              std::string&            error_code,
-                                             std::string&            error_message)
+                                             std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // certificateHashData
     ocpp::types::ocpp20::CertificateHashDataTypeConverter certificateHashData_converter;
-    ret = ret && certificateHashData_converter.fromJson(json["certificateHashData"], data.certificateHashData, error_code, error_message);
+    ret = ret && extract(json, "certificateHashData", data.certificateHashData, certificateHashData_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -60,7 +57,9 @@ bool DeleteCertificateReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a DeleteCertificateReq to a JSON representation */
-bool DeleteCertificateReqConverter::toJson(const DeleteCertificateReq& data, rapidjson::Document& json)
+bool DeleteCertificateReqConverter::toJson(const DeleteCertificateReq&         data,
+                                           rapidjson::Value&                   json,
+                                           rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -68,18 +67,16 @@ bool DeleteCertificateReqConverter::toJson(const DeleteCertificateReq& data, rap
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // certificateHashData
     ocpp::types::ocpp20::CertificateHashDataTypeConverter certificateHashData_converter;
-    certificateHashData_converter.setAllocator(allocator);
-    rapidjson::Document certificateHashData_doc(rapidjson::kObjectType);
-    ret = ret && certificateHashData_converter.toJson(data.certificateHashData, certificateHashData_doc);
-    json.AddMember(rapidjson::StringRef("certificateHashData"), certificateHashData_doc.Move(), *allocator);
+    rapidjson::Value                                      certificateHashData_doc(rapidjson::kObjectType);
+    ret = ret && certificateHashData_converter.toJson(data.certificateHashData, certificateHashData_doc, allocator);
+    json.AddMember(rapidjson::StringRef("certificateHashData"), certificateHashData_doc.Move(), allocator);
 
     return ret;
 }
@@ -88,26 +85,20 @@ bool DeleteCertificateReqConverter::toJson(const DeleteCertificateReq& data, rap
 bool DeleteCertificateConfConverter::fromJson(const rapidjson::Value& json,
                                               DeleteCertificateConf&  data,
                                               std::string&            error_code,
-                                              std::string&            error_message)
+                                              std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::DeleteCertificateStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::DeleteCertificateStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -118,7 +109,9 @@ bool DeleteCertificateConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a DeleteCertificateConf to a JSON representation */
-bool DeleteCertificateConfConverter::toJson(const DeleteCertificateConf& data, rapidjson::Document& json)
+bool DeleteCertificateConfConverter::toJson(const DeleteCertificateConf&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -126,23 +119,21 @@ bool DeleteCertificateConfConverter::toJson(const DeleteCertificateConf& data, r
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::DeleteCertificateStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::DeleteCertificateStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
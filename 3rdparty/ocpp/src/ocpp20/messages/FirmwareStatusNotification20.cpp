@@ -36,22 +36,19 @@ namespace ocpp20
 bool FirmwareStatusNotificationReqConverter::fromJson(const rapidjson::Value&        json,
                                                       FirmwareStatusNotificationReq& data,
                                                       std::string&                   error_code,
-                                                      std::string&                   error_message)
+                                                      std::string&                   error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::FirmwareStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::FirmwareStatusEnumTypeHelper, error_message);
 
     // requestId
-    extract(json, "requestId", data.requestId);
+    ret = ret && extract(json, "requestId", data.requestId, error_message);
 
     if (!ret)
     {
@@ -62,7 +59,9 @@ bool FirmwareStatusNotificationReqConverter::fromJson(const rapidjson::Value&
 }
 
 /** @brief Convert a FirmwareStatusNotificationReq to a JSON representation */
-bool FirmwareStatusNotificationReqConverter::toJson(const FirmwareStatusNotificationReq& data, rapidjson::Document& json)
+bool FirmwareStatusNotificationReqConverter::toJson(const FirmwareStatusNotificationReq& data,
+                                                    rapidjson::Value&                    json,
+                                                    rapidjson::Document::AllocatorType&  allocator) const
 {
     bool ret = true;
 
@@ -70,17 +69,16 @@ bool FirmwareStatusNotificationReqConverter::toJson(const FirmwareStatusNotifica
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::FirmwareStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::FirmwareStatusEnumTypeHelper.toString(data.status), allocator);
 
     // requestId
-    fill(json, "requestId", data.requestId);
+    fill(json, "requestId", data.requestId, allocator);
 
     return ret;
 }
@@ -89,16 +87,13 @@ bool FirmwareStatusNotificationReqConverter::toJson(const FirmwareStatusNotifica
 bool FirmwareStatusNotificationConfConverter::fromJson(const rapidjson::Value&         json,
                                                        FirmwareStatusNotificationConf& data,
                                                        std::string&                    error_code,
-                                                       std::string&                    error_message)
+                                                       std::string&                    error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -109,7 +104,9 @@ bool FirmwareStatusNotificationConfConverter::fromJson(const rapidjson::Value&
 }
 
 /** @brief Convert a FirmwareStatusNotificationConf to a JSON representation */
-bool FirmwareStatusNotificationConfConverter::toJson(const FirmwareStatusNotificationConf& data, rapidjson::Document& json)
+bool FirmwareStatusNotificationConfConverter::toJson(const FirmwareStatusNotificationConf& data,
+                                                     rapidjson::Value&                     json,
+                                                     rapidjson::Document::AllocatorType&   allocator) const
 {
     bool ret = true;
 
@@ -117,10 +114,9 @@ bool FirmwareStatusNotificationConfConverter::toJson(const FirmwareStatusNotific
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     return ret;
@@ -36,25 +36,22 @@ namespace ocpp20
 bool Get15118EVCertificateReqConverter::fromJson(const rapidjson::Value&   json,
                                                  Get15118EVCertificateReq& data,
                                                  std::string&              error_code,
-                                                 std::string&              error_message)
+                                                 std::string&              error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // iso15118SchemaVersion
-    extract(json, "iso15118SchemaVersion", data.iso15118SchemaVersion);
+    ret = ret && extract(json, "iso15118SchemaVersion", data.iso15118SchemaVersion, error_message);
 
     // action
-    data.action = ocpp::types::ocpp20::CertificateActionEnumTypeHelper.fromString(json["action"].GetString());
+    ret = ret && extract(json, "action", data.action, ocpp::types::ocpp20::CertificateActionEnumTypeHelper, error_message);
 
     // exiRequest
-    extract(json, "exiRequest", data.exiRequest);
+    ret = ret && extract(json, "exiRequest", data.exiRequest, error_message);
 
     if (!ret)
     {
@@ -65,7 +62,9 @@ bool Get15118EVCertificateReqConverter::fromJson(const rapidjson::Value&   json,
 }
 
 /** @brief Convert a Get15118EVCertificateReq to a JSON representation */
-bool Get15118EVCertificateReqConverter::toJson(const Get15118EVCertificateReq& data, rapidjson::Document& json)
+bool Get15118EVCertificateReqConverter::toJson(const Get15118EVCertificateReq&     data,
+                                               rapidjson::Value&                   json,
+                                               rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -73,20 +72,19 @@ bool Get15118EVCertificateReqConverter::toJson(const Get15118EVCertificateReq& d
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // iso15118SchemaVersion
-    fill(json, "iso15118SchemaVersion", data.iso15118SchemaVersion);
+    fill(json, "iso15118SchemaVersion", data.iso15118SchemaVersion, allocator);
 
     // action
-    fill(json, "action", ocpp::types::ocpp20::CertificateActionEnumTypeHelper.toString(data.action));
+    fill(json, "action", ocpp::types::ocpp20::CertificateActionEnumTypeHelper.toString(data.action), allocator);
 
     // exiRequest
-    fill(json, "exiRequest", data.exiRequest);
+    fill(json, "exiRequest", data.exiRequest, allocator);
 
     return ret;
 }
@@ -95,29 +93,23 @@ bool Get15118EVCertificateReqConverter::toJson(const Get15118EVCertificateReq& d
 bool Get15118EVCertificateConfConverter::fromJson(const rapidjson::Value&    json,
                                                   Get15118EVCertificateConf& data,
                                                   std::string&               error_code,
-                                                  std::string&               error_message)
+                                                  std::string&               error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::Iso15118EVCertificateStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::Iso15118EVCertificateStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     // exiResponse
-    extract(json, "exiResponse", data.exiResponse);
+    ret = ret && extract(json, "exiResponse", data.exiResponse, error_message);
 
     if (!ret)
     {
@@ -128,7 +120,9 @@ bool Get15118EVCertificateConfConverter::fromJson(const rapidjson::Value&    jso
 }
 
 /** @brief Convert a Get15118EVCertificateConf to a JSON representation */
-bool Get15118EVCertificateConfConverter::toJson(const Get15118EVCertificateConf& data, rapidjson::Document& json)
+bool Get15118EVCertificateConfConverter::toJson(const Get15118EVCertificateConf&    data,
+                                                rapidjson::Value&                   json,
+                                                rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -136,27 +130,25 @@ bool Get15118EVCertificateConfConverter::toJson(const Get15118EVCertificateConf&
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::Iso15118EVCertificateStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::Iso15118EVCertificateStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     // exiResponse
-    fill(json, "exiResponse", data.exiResponse);
+    fill(json, "exiResponse", data.exiResponse, allocator);
 
     return ret;
 }
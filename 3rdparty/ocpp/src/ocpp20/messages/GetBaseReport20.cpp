@@ -36,22 +36,19 @@ namespace ocpp20
 bool GetBaseReportReqConverter::fromJson(const rapidjson::Value& json,
                                          GetBaseReportReq&       data,
                                          std::string&            error_code,
-                                         std::string&            error_message)
+                                         std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // requestId
-    extract(json, "requestId", data.requestId);
+    ret = ret && extract(json, "requestId", data.requestId, error_message);
 
     // reportBase
-    data.reportBase = ocpp::types::ocpp20::ReportBaseEnumTypeHelper.fromString(json["reportBase"].GetString());
+    ret = ret && extract(json, "reportBase", data.reportBase, ocpp::types::ocpp20::ReportBaseEnumTypeHelper, error_message);
 
     if (!ret)
     {
@@ -62,7 +59,9 @@ bool GetBaseReportReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a GetBaseReportReq to a JSON representation */
-bool GetBaseReportReqConverter::toJson(const GetBaseReportReq& data, rapidjson::Document& json)
+bool GetBaseReportReqConverter::toJson(const GetBaseReportReq&             data,
+                                       rapidjson::Value&                   json,
+                                       rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -70,17 +69,16 @@ bool GetBaseReportReqConverter::toJson(const GetBaseReportReq& data, rapidjson::
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // requestId
-    fill(json, "requestId", data.requestId);
+    fill(json, "requestId", data.requestId, allocator);
 
     // reportBase
-    fill(json, "reportBase", ocpp::types::ocpp20::ReportBaseEnumTypeHelper.toString(data.reportBase));
+    fill(json, "reportBase", ocpp::types::ocpp20::ReportBaseEnumTypeHelper.toString(data.reportBase), allocator);
 
     return ret;
 }
@@ -89,26 +87,20 @@ bool GetBaseReportReqConverter::toJson(const GetBaseReportReq& data, rapidjson::
 bool GetBaseReportConfConverter::fromJson(const rapidjson::Value& json,
                                           GetBaseReportConf&      data,
                                           std::string&            error_code,
-                                          std::string&            error_message)
+                                          std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::GenericDeviceModelStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::GenericDeviceModelStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -119,7 +111,9 @@ bool GetBaseReportConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a GetBaseReportConf to a JSON representation */
-bool GetBaseReportConfConverter::toJson(const GetBaseReportConf& data, rapidjson::Document& json)
+bool GetBaseReportConfConverter::toJson(const GetBaseReportConf&            data,
+                                        rapidjson::Value&                   json,
+                                        rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -127,23 +121,21 @@ bool GetBaseReportConfConverter::toJson(const GetBaseReportConf& data, rapidjson
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::GenericDeviceModelStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::GenericDeviceModelStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
@@ -36,20 +36,17 @@ namespace ocpp20
 bool GetCertificateStatusReqConverter::fromJson(const rapidjson::Value&  json,
                                                 GetCertificateStatusReq& data,
                                                 std::string&             error_code,
-                                                std::string&             error_message)
+                                                std::string&             error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // ocspRequestData
     ocpp::types::ocpp20::OCSPRequestDataTypeConverter ocspRequestData_converter;
-    ret = ret && ocspRequestData_converter.fromJson(json["ocspRequestData"], data.ocspRequestData, error_code, error_message);
+    ret = ret && extract(json, "ocspRequestData", data.ocspRequestData, ocspRequestData_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -60,7 +57,9 @@ bool GetCertificateStatusReqConverter::fromJson(const rapidjson::Value&  json,
 }
 
 /** @brief Convert a GetCertificateStatusReq to a JSON representation */
-bool GetCertificateStatusReqConverter::toJson(const GetCertificateStatusReq& data, rapidjson::Document& json)
+bool GetCertificateStatusReqConverter::toJson(const GetCertificateStatusReq&      data,
+                                              rapidjson::Value&                   json,
+                                              rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -68,18 +67,16 @@ bool GetCertificateStatusReqConverter::toJson(const GetCertificateStatusReq& dat
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // ocspRequestData
     ocpp::types::ocpp20::OCSPRequestDataTypeConverter ocspRequestData_converter;
-    ocspRequestData_converter.setAllocator(allocator);
-    rapidjson::Document ocspRequestData_doc(rapidjson::kObjectType);
-    ret = ret && ocspRequestData_converter.toJson(data.ocspRequestData, ocspRequestData_doc);
-    json.AddMember(rapidjson::StringRef("ocspRequestData"), ocspRequestData_doc.Move(), *allocator);
+    rapidjson::Value                                  ocspRequestData_doc(rapidjson::kObjectType);
+    ret = ret && ocspRequestData_converter.toJson(data.ocspRequestData, ocspRequestData_doc, allocator);
+    json.AddMember(rapidjson::StringRef("ocspRequestData"), ocspRequestData_doc.Move(), allocator);
 
     return ret;
 }
@@ -88,29 +85,23 @@ bool GetCertificateStatusReqConverter::toJson(const GetCertificateStatusReq& dat
 bool GetCertificateStatusConfConverter::fromJson(const rapidjson::Value&   json,
                                                  GetCertificateStatusConf& data,
                                                  std::string&              error_code,
-                                                 std::string&              error_message)
+                                                 std::string&              error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::GetCertificateStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::GetCertificateStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     // ocspResult
-    extract(json, "ocspResult", data.ocspResult);
+    ret = ret && extract(json, "ocspResult", data.ocspResult, error_message);
 
     if (!ret)
     {
@@ -121,7 +112,9 @@ bool GetCertificateStatusConfConverter::fromJson(const rapidjson::Value&   json,
 }
 
 /** @brief Convert a GetCertificateStatusConf to a JSON representation */
-bool GetCertificateStatusConfConverter::toJson(const GetCertificateStatusConf& data, rapidjson::Document& json)
+bool GetCertificateStatusConfConverter::toJson(const GetCertificateStatusConf&     data,
+                                               rapidjson::Value&                   json,
+                                               rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -129,27 +122,25 @@ bool GetCertificateStatusConfConverter::toJson(const GetCertificateStatusConf& d
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::GetCertificateStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::GetCertificateStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     // ocspResult
-    fill(json, "ocspResult", data.ocspResult);
+    fill(json, "ocspResult", data.ocspResult, allocator);
 
     return ret;
 }
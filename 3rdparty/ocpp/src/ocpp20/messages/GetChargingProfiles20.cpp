@@ -36,26 +36,23 @@ namespace ocpp20
 bool GetChargingProfilesReqConverter::fromJson(const rapidjson::Value& json,
                                                GetChargingProfilesReq& data,
                                                std::string&            error_code,
-                                               std::string&            error_message)
+                                               std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // requestId
-    extract(json, "requestId", data.requestId);
+    ret = ret && extract(json, "requestId", data.requestId, error_message);
 
     // evseId
-    extract(json, "evseId", data.evseId);
+    ret = ret && extract(json, "evseId", data.evseId, error_message);
 
     // chargingProfile
     ocpp::types::ocpp20::ChargingProfileCriterionTypeConverter chargingProfile_converter;
-    ret = ret && chargingProfile_converter.fromJson(json["chargingProfile"], data.chargingProfile, error_code, error_message);
+    ret = ret && extract(json, "chargingProfile", data.chargingProfile, chargingProfile_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -66,7 +63,9 @@ bool GetChargingProfilesReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a GetChargingProfilesReq to a JSON representation */
-bool GetChargingProfilesReqConverter::toJson(const GetChargingProfilesReq& data, rapidjson::Document& json)
+bool GetChargingProfilesReqConverter::toJson(const GetChargingProfilesReq&       data,
+                                             rapidjson::Value&                   json,
+                                             rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -74,24 +73,22 @@ bool GetChargingProfilesReqConverter::toJson(const GetChargingProfilesReq& data,
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // requestId
-    fill(json, "requestId", data.requestId);
+    fill(json, "requestId", data.requestId, allocator);
 
     // evseId
-    fill(json, "evseId", data.evseId);
+    fill(json, "evseId", data.evseId, allocator);
 
     // chargingProfile
     ocpp::types::ocpp20::ChargingProfileCriterionTypeConverter chargingProfile_converter;
-    chargingProfile_converter.setAllocator(allocator);
-    rapidjson::Document chargingProfile_doc(rapidjson::kObjectType);
-    ret = ret && chargingProfile_converter.toJson(data.chargingProfile, chargingProfile_doc);
-    json.AddMember(rapidjson::StringRef("chargingProfile"), chargingProfile_doc.Move(), *allocator);
+    rapidjson::Value                                           chargingProfile_doc(rapidjson::kObjectType);
+    ret = ret && chargingProfile_converter.toJson(data.chargingProfile, chargingProfile_doc, allocator);
+    json.AddMember(rapidjson::StringRef("chargingProfile"), chargingProfile_doc.Move(), allocator);
 
     return ret;
 }
@@ -100,26 +97,20 @@ bool GetChargingProfilesReqConverter::toJson(const GetChargingProfilesReq& data,
 bool GetChargingProfilesConfConverter::fromJson(const rapidjson::Value&  json,
                                                 GetChargingProfilesConf& data,
                                                 std::string&             error_code,
-                                                std::string&             error_message)
+                                                std::string&             error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::GetChargingProfileStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::GetChargingProfileStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -130,7 +121,9 @@ bool GetChargingProfilesConfConverter::fromJson(const rapidjson::Value&  json,
 }
 
 /** @brief Convert a GetChargingProfilesConf to a JSON representation */
-bool GetChargingProfilesConfConverter::toJson(const GetChargingProfilesConf& data, rapidjson::Document& json)
+bool GetChargingProfilesConfConverter::toJson(const GetChargingProfilesConf&      data,
+                                              rapidjson::Value&                   json,
+                                              rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -138,23 +131,21 @@ bool GetChargingProfilesConfConverter::toJson(const GetChargingProfilesConf& dat
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::GetChargingProfileStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::GetChargingProfileStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
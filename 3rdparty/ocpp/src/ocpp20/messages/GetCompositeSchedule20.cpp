@@ -36,28 +36,23 @@ namespace ocpp20
 bool GetCompositeScheduleReqConverter::fromJson(const rapidjson::Value&  json,
                                                 GetCompositeScheduleReq& data,
                                                 std::string&             error_code,
-                                                std::string&             error_message)
+                                                std::string&             error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // duration
-    extract(json, "duration", data.duration);
+    ret = ret && extract(json, "duration", data.duration, error_message);
 
     // chargingRateUnit
-    if (json.HasMember("chargingRateUnit"))
-    {
-        data.chargingRateUnit = ocpp::types::ocpp20::ChargingRateUnitEnumTypeHelper.fromString(json["chargingRateUnit"].GetString());
-    }
+    ret = ret &&
+          extract(json, "chargingRateUnit", data.chargingRateUnit, ocpp::types::ocpp20::ChargingRateUnitEnumTypeHelper, error_message);
 
     // evseId
-    extract(json, "evseId", data.evseId);
+    ret = ret && extract(json, "evseId", data.evseId, error_message);
 
     if (!ret)
     {
@@ -68,7 +63,9 @@ bool GetCompositeScheduleReqConverter::fromJson(const rapidjson::Value&  json,
 }
 
 /** @brief Convert a GetCompositeScheduleReq to a JSON representation */
-bool GetCompositeScheduleReqConverter::toJson(const GetCompositeScheduleReq& data, rapidjson::Document& json)
+bool GetCompositeScheduleReqConverter::toJson(const GetCompositeScheduleReq&      data,
+                                              rapidjson::Value&                   json,
+                                              rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -76,23 +73,22 @@ bool GetCompositeScheduleReqConverter::toJson(const GetCompositeScheduleReq& dat
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // duration
-    fill(json, "duration", data.duration);
+    fill(json, "duration", data.duration, allocator);
 
     // chargingRateUnit
     if (data.chargingRateUnit.isSet())
     {
-        fill(json, "chargingRateUnit", ocpp::types::ocpp20::ChargingRateUnitEnumTypeHelper.toString(data.chargingRateUnit));
+        fill(json, "chargingRateUnit", ocpp::types::ocpp20::ChargingRateUnitEnumTypeHelper.toString(data.chargingRateUnit), allocator);
     }
 
     // evseId
-    fill(json, "evseId", data.evseId);
+    fill(json, "evseId", data.evseId, allocator);
 
     return ret;
 }
@@ -101,33 +97,24 @@ bool GetCompositeScheduleReqConverter::toJson(const GetCompositeScheduleReq& dat
 bool GetCompositeScheduleConfConverter::fromJson(const rapidjson::Value&   json,
                                                  GetCompositeScheduleConf& data,
                                                  std::string&              error_code,
-                                                 std::string&              error_message)
+                                                 std::string&              error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::GenericStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::GenericStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     // schedule
-    if (json.HasMember("schedule"))
-    {
-        ocpp::types::ocpp20::CompositeScheduleTypeConverter schedule_converter;
-        ret = ret && schedule_converter.fromJson(json["schedule"], data.schedule, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CompositeScheduleTypeConverter schedule_converter;
+    ret = ret && extract(json, "schedule", data.schedule, schedule_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -138,7 +125,9 @@ bool GetCompositeScheduleConfConverter::fromJson(const rapidjson::Value&   json,
 }
 
 /** @brief Convert a GetCompositeScheduleConf to a JSON representation */
-bool GetCompositeScheduleConfConverter::toJson(const GetCompositeScheduleConf& data, rapidjson::Document& json)
+bool GetCompositeScheduleConfConverter::toJson(const GetCompositeScheduleConf&     data,
+                                               rapidjson::Value&                   json,
+                                               rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -146,33 +135,30 @@ bool GetCompositeScheduleConfConverter::toJson(const GetCompositeScheduleConf& d
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::GenericStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::GenericStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     // schedule
     if (data.schedule.isSet())
     {
         ocpp::types::ocpp20::CompositeScheduleTypeConverter schedule_converter;
-        schedule_converter.setAllocator(allocator);
-        rapidjson::Document schedule_doc(rapidjson::kObjectType);
-        ret = ret && schedule_converter.toJson(data.schedule, schedule_doc);
-        json.AddMember(rapidjson::StringRef("schedule"), schedule_doc.Move(), *allocator);
+        rapidjson::Value                                    schedule_doc(rapidjson::kObjectType);
+        ret = ret && schedule_converter.toJson(data.schedule, schedule_doc, allocator);
+        json.AddMember(rapidjson::StringRef("schedule"), schedule_doc.Move(), allocator);
     }
 
     return ret;
@@ -36,42 +36,33 @@ namespace ocpp20
 bool GetDisplayMessagesReqConverter::fromJson(const rapidjson::Value& json,
                                               GetDisplayMessagesReq&  data,
                                               std::string&            error_code,
-                                              std::string&            error_message)
+                                              std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // id
-    if (json.HasMember("id"))
+    ret = ret && checkArray(json, "id", false, 1u, 0u, error_message);
+    if (ret && json.HasMember("id"))
     {
         const rapidjson::Value& id_json = json["id"];
         for (auto it = id_json.Begin(); ret && (it != id_json.End()); ++it)
         {
-            int& item = data.id.emplace_back();
-            item      = it->GetInt();
+            ret = convert(*it, "id", data.id.emplace_back(), error_message);
         }
     }
 
     // requestId
-    extract(json, "requestId", data.requestId);
+    ret = ret && extract(json, "requestId", data.requestId, error_message);
 
     // priority
-    if (json.HasMember("priority"))
-    {
-        data.priority = ocpp::types::ocpp20::MessagePriorityEnumTypeHelper.fromString(json["priority"].GetString());
-    }
+    ret = ret && extract(json, "priority", data.priority, ocpp::types::ocpp20::MessagePriorityEnumTypeHelper, error_message);
 
     // state
-    if (json.HasMember("state"))
-    {
-        data.state = ocpp::types::ocpp20::MessageStateEnumTypeHelper.fromString(json["state"].GetString());
-    }
+    ret = ret && extract(json, "state", data.state, ocpp::types::ocpp20::MessageStateEnumTypeHelper, error_message);
 
     if (!ret)
     {
@@ -82,7 +73,9 @@ bool GetDisplayMessagesReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a GetDisplayMessagesReq to a JSON representation */
-bool GetDisplayMessagesReqConverter::toJson(const GetDisplayMessagesReq& data, rapidjson::Document& json)
+bool GetDisplayMessagesReqConverter::toJson(const GetDisplayMessagesReq&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -90,10 +83,9 @@ bool GetDisplayMessagesReqConverter::toJson(const GetDisplayMessagesReq& data, r
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // id
@@ -103,24 +95,24 @@ bool GetDisplayMessagesReqConverter::toJson(const GetDisplayMessagesReq& data, r
         rapidjson::Value id_json(rapidjson::kArrayType);
         for (const int& item : data.id)
         {
-            id_json.PushBack(rapidjson::Value(item), *allocator);
+            id_json.PushBack(rapidjson::Value(item), allocator);
         }
-        json.AddMember(rapidjson::StringRef("id"), id_json.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("id"), id_json.Move(), allocator);
     }
 
     // requestId
-    fill(json, "requestId", data.requestId);
+    fill(json, "requestId", data.requestId, allocator);
 
     // priority
     if (data.priority.isSet())
     {
-        fill(json, "priority", ocpp::types::ocpp20::MessagePriorityEnumTypeHelper.toString(data.priority));
+        fill(json, "priority", ocpp::types::ocpp20::MessagePriorityEnumTypeHelper.toString(data.priority), allocator);
     }
 
     // state
     if (data.state.isSet())
     {
-        fill(json, "state", ocpp::types::ocpp20::MessageStateEnumTypeHelper.toString(data.state));
+        fill(json, "state", ocpp::types::ocpp20::MessageStateEnumTypeHelper.toString(data.state), allocator);
     }
 
     return ret;
@@ -130,26 +122,20 @@ bool GetDisplayMessagesReqConverter::toJson(const GetDisplayMessagesReq& data, r
 bool GetDisplayMessagesConfConverter::fromJson(const rapidjson::Value& json,
                                                GetDisplayMessagesConf& data,
                                                std::string&            error_code,
-                                               std::string&            error_message)
+                                               std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::GetDisplayMessagesStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::GetDisplayMessagesStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -160,7 +146,9 @@ bool GetDisplayMessagesConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a GetDisplayMessagesConf to a JSON representation */
-bool GetDisplayMessagesConfConverter::toJson(const GetDisplayMessagesConf& data, rapidjson::Document& json)
+bool GetDisplayMessagesConfConverter::toJson(const GetDisplayMessagesConf&       data,
+                                             rapidjson::Value&                   json,
+                                             rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -168,23 +156,21 @@ bool GetDisplayMessagesConfConverter::toJson(const GetDisplayMessagesConf& data,
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::GetDisplayMessagesStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::GetDisplayMessagesStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
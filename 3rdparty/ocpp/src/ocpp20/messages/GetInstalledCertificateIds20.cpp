@@ -36,25 +36,26 @@ namespace ocpp20
 bool GetInstalledCertificateIdsReqConverter::fromJson(const rapidjson::Value&        json,
                                                       GetInstalledCertificateIdsReq& data,
                                                       std::string&                   error_code,
-                                                      std::string&                   error_message)
+                                                      std::string&                   error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // certificateType
-    if (json.HasMember("certificateType"))
+    ret = ret && checkArray(json, "certificateType", false, 1u, 0u, error_message);
+    if (ret && json.HasMember("certificateType"))
     {
         const rapidjson::Value& certificateType_json = json["certificateType"];
         for (auto it = certificateType_json.Begin(); ret && (it != certificateType_json.End()); ++it)
         {
-            ocpp::types::ocpp20::GetCertificateIdUseEnumType& item = data.certificateType.emplace_back();
-            item = ocpp::types::ocpp20::GetCertificateIdUseEnumTypeHelper.fromString(it->GetString());
+            ret = convert(*it,
+                          "certificateType",
+                          data.certificateType.emplace_back(),
+                          ocpp::types::ocpp20::GetCertificateIdUseEnumTypeHelper,
+                          error_message);
         }
     }
 
@@ -67,7 +68,9 @@ bool GetInstalledCertificateIdsReqConverter::fromJson(const rapidjson::Value&
 }
 
 /** @brief Convert a GetInstalledCertificateIdsReq to a JSON representation */
-bool GetInstalledCertificateIdsReqConverter::toJson(const GetInstalledCertificateIdsReq& data, rapidjson::Document& json)
+bool GetInstalledCertificateIdsReqConverter::toJson(const GetInstalledCertificateIdsReq& data,
+                                                    rapidjson::Value&                    json,
+                                                    rapidjson::Document::AllocatorType&  allocator) const
 {
     bool ret = true;
 
@@ -75,10 +78,9 @@ bool GetInstalledCertificateIdsReqConverter::toJson(const GetInstalledCertificat
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // certificateType
@@ -89,10 +91,10 @@ bool GetInstalledCertificateIdsReqConverter::toJson(const GetInstalledCertificat
         for (const ocpp::types::ocpp20::GetCertificateIdUseEnumType& item : data.certificateType)
         {
             certificateType_json.PushBack(
-                rapidjson::Value(ocpp::types::ocpp20::GetCertificateIdUseEnumTypeHelper.toString(item).c_str(), *allocator).Move(),
-                *allocator);
+                rapidjson::Value(ocpp::types::ocpp20::GetCertificateIdUseEnumTypeHelper.toString(item).c_str(), allocator).Move(),
+                allocator);
         }
-        json.AddMember(rapidjson::StringRef("certificateType"), certificateType_json.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("certificateType"), certificateType_json.Move(), allocator);
     }
 
     return ret;
@@ -102,36 +104,35 @@ bool GetInstalledCertificateIdsReqConverter::toJson(const GetInstalledCertificat
 bool GetInstalledCertificateIdsConfConverter::fromJson(const rapidjson::Value&         json,
                                                        GetInstalledCertificateIdsConf& data,
                                                        std::string&                    error_code,
-                                                       std::string&                    error_message)
+                                                       std::string&                    error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::GetInstalledCertificateStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::GetInstalledCertificateStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     // certificateHashDataChain
-    if (json.HasMember("certificateHashDataChain"))
+    ret = ret && checkArray(json, "certificateHashDataChain", false, 1u, 0u, error_message);
+    if (ret && json.HasMember("certificateHashDataChain"))
     {
         const rapidjson::Value&                                    certificateHashDataChain_json = json["certificateHashDataChain"];
         ocpp::types::ocpp20::CertificateHashDataChainTypeConverter certificateHashDataChain_converter;
         for (auto it = certificateHashDataChain_json.Begin(); ret && (it != certificateHashDataChain_json.End()); ++it)
         {
-            ocpp::types::ocpp20::CertificateHashDataChainType& item = data.certificateHashDataChain.emplace_back();
-            ret = ret && certificateHashDataChain_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it,
+                          "certificateHashDataChain",
+                          data.certificateHashDataChain.emplace_back(),
+                          certificateHashDataChain_converter,
+                          error_code,
+                          error_message);
         }
     }
 
@@ -144,7 +145,9 @@ bool GetInstalledCertificateIdsConfConverter::fromJson(const rapidjson::Value&
 }
 
 /** @brief Convert a GetInstalledCertificateIdsConf to a JSON representation */
-bool GetInstalledCertificateIdsConfConverter::toJson(const GetInstalledCertificateIdsConf& data, rapidjson::Document& json)
+bool GetInstalledCertificateIdsConfConverter::toJson(const GetInstalledCertificateIdsConf& data,
+                                                     rapidjson::Value&                     json,
+                                                     rapidjson::Document::AllocatorType&   allocator) const
 {
     bool ret = true;
 
@@ -152,23 +155,21 @@ bool GetInstalledCertificateIdsConfConverter::toJson(const GetInstalledCertifica
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::GetInstalledCertificateStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::GetInstalledCertificateStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     // certificateHashDataChain
@@ -177,14 +178,13 @@ bool GetInstalledCertificateIdsConfConverter::toJson(const GetInstalledCertifica
 
         rapidjson::Value                                           certificateHashDataChain_json(rapidjson::kArrayType);
         ocpp::types::ocpp20::CertificateHashDataChainTypeConverter certificateHashDataChain_converter;
-        certificateHashDataChain_converter.setAllocator(allocator);
         for (const ocpp::types::ocpp20::CertificateHashDataChainType& item : data.certificateHashDataChain)
         {
-            rapidjson::Document item_doc(rapidjson::kObjectType);
-            ret = ret && certificateHashDataChain_converter.toJson(item, item_doc);
-            certificateHashDataChain_json.PushBack(item_doc.Move(), *allocator);
+            rapidjson::Value item_doc(rapidjson::kObjectType);
+            ret = ret && certificateHashDataChain_converter.toJson(item, item_doc, allocator);
+            certificateHashDataChain_json.PushBack(item_doc.Move(), allocator);
         }
-        json.AddMember(rapidjson::StringRef("certificateHashDataChain"), certificateHashDataChain_json.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("certificateHashDataChain"), certificateHashDataChain_json.Move(), allocator);
     }
 
     return ret;
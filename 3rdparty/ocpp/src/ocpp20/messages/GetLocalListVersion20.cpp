@@ -36,16 +36,13 @@ namespace ocpp20
 bool GetLocalListVersionReqConverter::fromJson(const rapidjson::Value& json,
                                                GetLocalListVersionReq& data,
                                                std::string&            error_code,
-                                               std::string&            error_message)
+                                               std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -56,7 +53,9 @@ bool GetLocalListVersionReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a GetLocalListVersionReq to a JSON representation */
-bool GetLocalListVersionReqConverter::toJson(const GetLocalListVersionReq& data, rapidjson::Document& json)
+bool GetLocalListVersionReqConverter::toJson(const GetLocalListVersionReq&       data,
+                                             rapidjson::Value&                   json,
+                                             rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -64,10 +63,9 @@ bool GetLocalListVersionReqConverter::toJson(const GetLocalListVersionReq& data,
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     return ret;
@@ -77,19 +75,16 @@ bool GetLocalListVersionReqConverter::toJson(const GetLocalListVersionReq& data,
 bool GetLocalListVersionConfConverter::fromJson(const rapidjson::Value&  json,
                                                 GetLocalListVersionConf& data,
                                                 std::string&             error_code,
-                                                std::string&             error_message)
+                                                std::string&             error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // versionNumber
-    extract(json, "versionNumber", data.versionNumber);
+    ret = ret && extract(json, "versionNumber", data.versionNumber, error_message);
 
     if (!ret)
     {
@@ -100,7 +95,9 @@ bool GetLocalListVersionConfConverter::fromJson(const rapidjson::Value&  json,
 }
 
 /** @brief Convert a GetLocalListVersionConf to a JSON representation */
-bool GetLocalListVersionConfConverter::toJson(const GetLocalListVersionConf& data, rapidjson::Document& json)
+bool GetLocalListVersionConfConverter::toJson(const GetLocalListVersionConf&      data,
+                                              rapidjson::Value&                   json,
+                                              rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -108,14 +105,13 @@ bool GetLocalListVersionConfConverter::toJson(const GetLocalListVersionConf& dat
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // versionNumber
-    fill(json, "versionNumber", data.versionNumber);
+    fill(json, "versionNumber", data.versionNumber, allocator);
 
     return ret;
 }
@@ -33,32 +33,29 @@ namespace ocpp20
 {
 
 /** @brief Convert a GetLogReq from a JSON representation */
-bool GetLogReqConverter::fromJson(const rapidjson::Value& json, GetLogReq& data, std::string& error_code, std::string& error_message)
+bool GetLogReqConverter::fromJson(const rapidjson::Value& json, GetLogReq& data, std::string& error_code, std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // log
     ocpp::types::ocpp20::LogParametersTypeConverter log_converter;
-    ret = ret && log_converter.fromJson(json["log"], data.log, error_code, error_message);
+    ret = ret && extract(json, "log", data.log, log_converter, error_code, error_message);
 
     // logType
-    data.logType = ocpp::types::ocpp20::LogEnumTypeHelper.fromString(json["logType"].GetString());
+    ret = ret && extract(json, "logType", data.logType, ocpp::types::ocpp20::LogEnumTypeHelper, error_message);
 
     // requestId
-    extract(json, "requestId", data.requestId);
+    ret = ret && extract(json, "requestId", data.requestId, error_message);
 
     // retries
-    extract(json, "retries", data.retries);
+    ret = ret && extract(json, "retries", data.retries, error_message);
 
     // retryInterval
-    extract(json, "retryInterval", data.retryInterval);
+    ret = ret && extract(json, "retryInterval", data.retryInterval, error_message);
 
     if (!ret)
     {
@@ -69,7 +66,7 @@ bool GetLogReqConverter::fromJson(const rapidjson::Value& json, GetLogReq& data,
 }
 
 /** @brief Convert a GetLogReq to a JSON representation */
-bool GetLogReqConverter::toJson(const GetLogReq& data, rapidjson::Document& json)
+bool GetLogReqConverter::toJson(const GetLogReq& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -77,58 +74,53 @@ bool GetLogReqConverter::toJson(const GetLogReq& data, rapidjson::Document& json
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // log
     ocpp::types::ocpp20::LogParametersTypeConverter log_converter;
-    log_converter.setAllocator(allocator);
-    rapidjson::Document log_doc(rapidjson::kObjectType);
-    ret = ret && log_converter.toJson(data.log, log_doc);
-    json.AddMember(rapidjson::StringRef("log"), log_doc.Move(), *allocator);
+    rapidjson::Value                                log_doc(rapidjson::kObjectType);
+    ret = ret && log_converter.toJson(data.log, log_doc, allocator);
+    json.AddMember(rapidjson::StringRef("log"), log_doc.Move(), allocator);
 
     // logType
-    fill(json, "logType", ocpp::types::ocpp20::LogEnumTypeHelper.toString(data.logType));
+    fill(json, "logType", ocpp::types::ocpp20::LogEnumTypeHelper.toString(data.logType), allocator);
 
     // requestId
-    fill(json, "requestId", data.requestId);
+    fill(json, "requestId", data.requestId, allocator);
 
     // retries
-    fill(json, "retries", data.retries);
+    fill(json, "retries", data.retries, allocator);
 
     // retryInterval
-    fill(json, "retryInterval", data.retryInterval);
+    fill(json, "retryInterval", data.retryInterval, allocator);
 
     return ret;
 }
 
 /** @brief Convert a GetLogConf from a JSON representation */
-bool GetLogConfConverter::fromJson(const rapidjson::Value& json, GetLogConf& data, std::string& error_code, std::string& error_message)
+bool GetLogConfConverter::fromJson(const rapidjson::Value& json,
+                                   GetLogConf&             data,
+                                   std::string&            error_code,
+                                   std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::LogStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::LogStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     // filename
-    extract(json, "filename", data.filename);
+    ret = ret && extract(json, "filename", data.filename, error_message);
 
     if (!ret)
     {
@@ -139,7 +131,7 @@ bool GetLogConfConverter::fromJson(const rapidjson::Value& json, GetLogConf& dat
 }
 
 /** @brief Convert a GetLogConf to a JSON representation */
-bool GetLogConfConverter::toJson(const GetLogConf& data, rapidjson::Document& json)
+bool GetLogConfConverter::toJson(const GetLogConf& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -147,27 +139,25 @@ bool GetLogConfConverter::toJson(const GetLogConf& data, rapidjson::Document& js
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::LogStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::LogStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     // filename
-    fill(json, "filename", data.filename);
+    fill(json, "filename", data.filename, allocator);
 
     return ret;
 }
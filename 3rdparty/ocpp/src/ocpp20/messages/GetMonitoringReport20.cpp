@@ -36,40 +36,46 @@ namespace ocpp20
 bool GetMonitoringReportReqConverter::fromJson(const rapidjson::Value& json,
                                                GetMonitoringReportReq& data,
                                                std::string&            error_code,
-                                               std::string&            error_message)
+                                               std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // componentVariable
-    if (json.HasMember("componentVariable"))
+    ret = ret && checkArray(json, "componentVariable", false, 1u, 0u, error_message);
+    if (ret && json.HasMember("componentVariable"))
     {
         const rapidjson::Value&                             componentVariable_json = json["componentVariable"];
         ocpp::types::ocpp20::ComponentVariableTypeConverter componentVariable_converter;
         for (auto it = componentVariable_json.Begin(); ret && (it != componentVariable_json.End()); ++it)
         {
-            ocpp::types::ocpp20::ComponentVariableType& item = data.componentVariable.emplace_back();
-            ret = ret && componentVariable_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it,
+                          "componentVariable",
+                          data.componentVariable.emplace_back(),
+                          componentVariable_converter,
+                          error_code,
+                          error_message);
         }
     }
 
     // requestId
-    extract(json, "requestId", data.requestId);
+    ret = ret && extract(json, "requestId", data.requestId, error_message);
 
     // monitoringCriteria
-    if (json.HasMember("monitoringCriteria"))
+    ret = ret && checkArray(json, "monitoringCriteria", false, 1u, 3u, error_message);
+    if (ret && json.HasMember("monitoringCriteria"))
     {
         const rapidjson::Value& monitoringCriteria_json = json["monitoringCriteria"];
         for (auto it = monitoringCriteria_json.Begin(); ret && (it != monitoringCriteria_json.End()); ++it)
         {
-            ocpp::types::ocpp20::MonitoringCriterionEnumType& item = data.monitoringCriteria.emplace_back();
-            item = ocpp::types::ocpp20::MonitoringCriterionEnumTypeHelper.fromString(it->GetString());
+            ret = convert(*it,
+                          "monitoringCriteria",
+                          data.monitoringCriteria.emplace_back(),
+                          ocpp::types::ocpp20::MonitoringCriterionEnumTypeHelper,
+                          error_message);
         }
     }
 
@@ -82,7 +88,9 @@ bool GetMonitoringReportReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a GetMonitoringReportReq to a JSON representation */
-bool GetMonitoringReportReqConverter::toJson(const GetMonitoringReportReq& data, rapidjson::Document& json)
+bool GetMonitoringReportReqConverter::toJson(const GetMonitoringReportReq&       data,
+                                             rapidjson::Value&                   json,
+                                             rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -90,10 +98,9 @@ bool GetMonitoringReportReqConverter::toJson(const GetMonitoringReportReq& data,
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // componentVariable
@@ -102,18 +109,17 @@ bool GetMonitoringReportReqConverter::toJson(const GetMonitoringReportReq& data,
 
         rapidjson::Value                                    componentVariable_json(rapidjson::kArrayType);
         ocpp::types::ocpp20::ComponentVariableTypeConverter componentVariable_converter;
-        componentVariable_converter.setAllocator(allocator);
         for (const ocpp::types::ocpp20::ComponentVariableType& item : data.componentVariable)
         {
-            rapidjson::Document item_doc(rapidjson::kObjectType);
-            ret = ret && componentVariable_converter.toJson(item, item_doc);
-            componentVariable_json.PushBack(item_doc.Move(), *allocator);
+            rapidjson::Value item_doc(rapidjson::kObjectType);
+            ret = ret && componentVariable_converter.toJson(item, item_doc, allocator);
+            componentVariable_json.PushBack(item_doc.Move(), allocator);
         }
-        json.AddMember(rapidjson::StringRef("componentVariable"), componentVariable_json.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("componentVariable"), componentVariable_json.Move(), allocator);
     }
 
     // requestId
-    fill(json, "requestId", data.requestId);
+    fill(json, "requestId", data.requestId, allocator);
 
     // monitoringCriteria
     if (!data.monitoringCriteria.empty())
@@ -123,10 +129,10 @@ bool GetMonitoringReportReqConverter::toJson(const GetMonitoringReportReq& data,
         for (const ocpp::types::ocpp20::MonitoringCriterionEnumType& item : data.monitoringCriteria)
         {
             monitoringCriteria_json.PushBack(
-                rapidjson::Value(ocpp::types::ocpp20::MonitoringCriterionEnumTypeHelper.toString(item).c_str(), *allocator).Move(),
-                *allocator);
+                rapidjson::Value(ocpp::types::ocpp20::MonitoringCriterionEnumTypeHelper.toString(item).c_str(), allocator).Move(),
+                allocator);
         }
-        json.AddMember(rapidjson::StringRef("monitoringCriteria"), monitoringCriteria_json.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("monitoringCriteria"), monitoringCriteria_json.Move(), allocator);
     }
 
     return ret;
@@ -136,26 +142,20 @@ bool GetMonitoringReportReqConverter::toJson(const GetMonitoringReportReq& data,
 bool GetMonitoringReportConfConverter::fromJson(const rapidjson::Value&  json,
                                                 GetMonitoringReportConf& data,
                                                 std::string&             error_code,
-                                                std::string&             error_message)
+                                                std::string&             error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::GenericDeviceModelStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::GenericDeviceModelStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -166,7 +166,9 @@ bool GetMonitoringReportConfConverter::fromJson(const rapidjson::Value&  json,
 }
 
 /** @brief Convert a GetMonitoringReportConf to a JSON representation */
-bool GetMonitoringReportConfConverter::toJson(const GetMonitoringReportConf& data, rapidjson::Document& json)
+bool GetMonitoringReportConfConverter::toJson(const GetMonitoringReportConf&      data,
+                                              rapidjson::Value&                   json,
+                                              rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -174,23 +176,21 @@ bool GetMonitoringReportConfConverter::toJson(const GetMonitoringReportConf& dat
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::GenericDeviceModelStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::GenericDeviceModelStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
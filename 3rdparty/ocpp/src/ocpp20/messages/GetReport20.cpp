@@ -33,40 +33,49 @@ namespace ocpp20
 {
 
 /** @brief Convert a GetReportReq from a JSON representation */
-bool GetReportReqConverter::fromJson(const rapidjson::Value& json, GetReportReq& data, std::string& error_code, std::string& error_message)
+bool GetReportReqConverter::fromJson(const rapidjson::Value& json,
+                                     GetReportReq&           data,
+                                     std::string&            error_code,
+                                     std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // componentVariable
-    if (json.HasMember("componentVariable"))
+    ret = ret && checkArray(json, "componentVariable", false, 1u, 0u, error_message);
+    if (ret && json.HasMember("componentVariable"))
     {
         const rapidjson::Value&                             componentVariable_json = json["componentVariable"];
         ocpp::types::ocpp20::ComponentVariableTypeConverter componentVariable_converter;
         for (auto it = componentVariable_json.Begin(); ret && (it != componentVariable_json.End()); ++it)
         {
-            ocpp::types::ocpp20::ComponentVariableType& item = data.componentVariable.emplace_back();
-            ret = ret && componentVariable_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it,
+                          "componentVariable",
+                          data.componentVariable.emplace_back(),
+                          componentVariable_converter,
+                          error_code,
+                          error_message);
         }
     }
 
     // requestId
-    extract(json, "requestId", data.requestId);
+    ret = ret && extract(json, "requestId", data.requestId, error_message);
 
     // componentCriteria
-    if (json.HasMember("componentCriteria"))
+    ret = ret && checkArray(json, "componentCriteria", false, 1u, 4u, error_message);
+    if (ret && json.HasMember("componentCriteria"))
     {
         const rapidjson::Value& componentCriteria_json = json["componentCriteria"];
         for (auto it = componentCriteria_json.Begin(); ret && (it != componentCriteria_json.End()); ++it)
         {
-            ocpp::types::ocpp20::ComponentCriterionEnumType& item = data.componentCriteria.emplace_back();
-            item = ocpp::types::ocpp20::ComponentCriterionEnumTypeHelper.fromString(it->GetString());
+            ret = convert(*it,
+                          "componentCriteria",
+                          data.componentCriteria.emplace_back(),
+                          ocpp::types::ocpp20::ComponentCriterionEnumTypeHelper,
+                          error_message);
         }
     }
 
@@ -79,7 +88,7 @@ bool GetReportReqConverter::fromJson(const rapidjson::Value& json, GetReportReq&
 }
 
 /** @brief Convert a GetReportReq to a JSON representation */
-bool GetReportReqConverter::toJson(const GetReportReq& data, rapidjson::Document& json)
+bool GetReportReqConverter::toJson(const GetReportReq& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -87,10 +96,9 @@ bool GetReportReqConverter::toJson(const GetReportReq& data, rapidjson::Document
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // componentVariable
@@ -99,18 +107,17 @@ bool GetReportReqConverter::toJson(const GetReportReq& data, rapidjson::Document
 
         rapidjson::Value                                    componentVariable_json(rapidjson::kArrayType);
         ocpp::types::ocpp20::ComponentVariableTypeConverter componentVariable_converter;
-        componentVariable_converter.setAllocator(allocator);
         for (const ocpp::types::ocpp20::ComponentVariableType& item : data.componentVariable)
         {
-            rapidjson::Document item_doc(rapidjson::kObjectType);
-            ret = ret && componentVariable_converter.toJson(item, item_doc);
-            componentVariable_json.PushBack(item_doc.Move(), *allocator);
+            rapidjson::Value item_doc(rapidjson::kObjectType);
+            ret = ret && componentVariable_converter.toJson(item, item_doc, allocator);
+            componentVariable_json.PushBack(item_doc.Move(), allocator);
         }
-        json.AddMember(rapidjson::StringRef("componentVariable"), componentVariable_json.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("componentVariable"), componentVariable_json.Move(), allocator);
     }
 
     // requestId
-    fill(json, "requestId", data.requestId);
+    fill(json, "requestId", data.requestId, allocator);
 
     // componentCriteria
     if (!data.componentCriteria.empty())
@@ -120,10 +127,10 @@ bool GetReportReqConverter::toJson(const GetReportReq& data, rapidjson::Document
         for (const ocpp::types::ocpp20::ComponentCriterionEnumType& item : data.componentCriteria)
         {
             componentCriteria_json.PushBack(
-                rapidjson::Value(ocpp::types::ocpp20::ComponentCriterionEnumTypeHelper.toString(item).c_str(), *allocator).Move(),
-                *allocator);
+                rapidjson::Value(ocpp::types::ocpp20::ComponentCriterionEnumTypeHelper.toString(item).c_str(), allocator).Move(),
+                allocator);
         }
-        json.AddMember(rapidjson::StringRef("componentCriteria"), componentCriteria_json.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("componentCriteria"), componentCriteria_json.Move(), allocator);
     }
 
     return ret;
@@ -133,26 +140,20 @@ bool GetReportReqConverter::toJson(const GetReportReq& data, rapidjson::Document
 bool GetReportConfConverter::fromJson(const rapidjson::Value& json,
                                       GetReportConf&          data,
                                       std::string&            error_code,
-                                      std::string&            error_message)
+                                      std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::GenericDeviceModelStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::GenericDeviceModelStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -163,7 +164,7 @@ bool GetReportConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a GetReportConf to a JSON representation */
-bool GetReportConfConverter::toJson(const GetReportConf& data, rapidjson::Document& json)
+bool GetReportConfConverter::toJson(const GetReportConf& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -171,23 +172,21 @@ bool GetReportConfConverter::toJson(const GetReportConf& data, rapidjson::Docume
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::GenericDeviceModelStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::GenericDeviceModelStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
@@ -36,19 +36,16 @@ namespace ocpp20
 bool GetTransactionStatusReqConverter::fromJson(const rapidjson::Value&  json,
                                                 GetTransactionStatusReq& data,
                                                 std::string&             error_code,
-                                                std::string&             error_message)
+                                                std::string&             error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // transactionId
-    extract(json, "transactionId", data.transactionId);
+    ret = ret && extract(json, "transactionId", data.transactionId, error_message);
 
     if (!ret)
     {
@@ -59,7 +56,9 @@ bool GetTransactionStatusReqConverter::fromJson(const rapidjson::Value&  json,
 }
 
 /** @brief Convert a GetTransactionStatusReq to a JSON representation */
-bool GetTransactionStatusReqConverter::toJson(const GetTransactionStatusReq& data, rapidjson::Document& json)
+bool GetTransactionStatusReqConverter::toJson(const GetTransactionStatusReq&      data,
+                                              rapidjson::Value&                   json,
+                                              rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -67,14 +66,13 @@ bool GetTransactionStatusReqConverter::toJson(const GetTransactionStatusReq& dat
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // transactionId
-    fill(json, "transactionId", data.transactionId);
+    fill(json, "transactionId", data.transactionId, allocator);
 
     return ret;
 }
@@ -83,22 +81,19 @@ bool GetTransactionStatusReqConverter::toJson(const GetTransactionStatusReq& dat
 bool GetTransactionStatusConfConverter::fromJson(const rapidjson::Value&   json,
                                                  GetTransactionStatusConf& data,
                                                  std::string&              error_code,
-                                                 std::string&              error_message)
+                                                 std::string&              error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // ongoingIndicator
-    extract(json, "ongoingIndicator", data.ongoingIndicator);
+    ret = ret && extract(json, "ongoingIndicator", data.ongoingIndicator, error_message);
 
     // messagesInQueue
-    extract(json, "messagesInQueue", data.messagesInQueue);
+    ret = ret && extract(json, "messagesInQueue", data.messagesInQueue, error_message);
 
     if (!ret)
     {
@@ -109,7 +104,9 @@ bool GetTransactionStatusConfConverter::fromJson(const rapidjson::Value&   json,
 }
 
 /** @brief Convert a GetTransactionStatusConf to a JSON representation */
-bool GetTransactionStatusConfConverter::toJson(const GetTransactionStatusConf& data, rapidjson::Document& json)
+bool GetTransactionStatusConfConverter::toJson(const GetTransactionStatusConf&     data,
+                                               rapidjson::Value&                   json,
+                                               rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -117,17 +114,16 @@ bool GetTransactionStatusConfConverter::toJson(const GetTransactionStatusConf& d
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // ongoingIndicator
-    fill(json, "ongoingIndicator", data.ongoingIndicator);
+    fill(json, "ongoingIndicator", data.ongoingIndicator, allocator);
 
     // messagesInQueue
-    fill(json, "messagesInQueue", data.messagesInQueue);
+    fill(json, "messagesInQueue", data.messagesInQueue, allocator);
 
     return ret;
 }
@@ -36,26 +36,28 @@ namespace ocpp20
 bool GetVariablesReqConverter::fromJson(const rapidjson::Value& json,
                                         GetVariablesReq&        data,
                                         std::string&            error_code,
-                                        std::string&            error_message)
+                                        std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // getVariableData
-    if (json.HasMember("getVariableData"))
+    ret = ret && checkArray(json, "getVariableData", true, 1u, 0u, error_message);
+    if (ret && json.HasMember("getVariableData"))
     {
         const rapidjson::Value&                           getVariableData_json = json["getVariableData"];
         ocpp::types::ocpp20::GetVariableDataTypeConverter getVariableData_converter;
         for (auto it = getVariableData_json.Begin(); ret && (it != getVariableData_json.End()); ++it)
         {
-            ocpp::types::ocpp20::GetVariableDataType& item = data.getVariableData.emplace_back();
-            ret = ret && getVariableData_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it,
+                          "getVariableData",
+                          data.getVariableData.emplace_back(),
+                          getVariableData_converter,
+                          error_code,
+                          error_message);
         }
     }
 
@@ -68,7 +70,9 @@ bool GetVariablesReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a GetVariablesReq to a JSON representation */
-bool GetVariablesReqConverter::toJson(const GetVariablesReq& data, rapidjson::Document& json)
+bool GetVariablesReqConverter::toJson(const GetVariablesReq&              data,
+                                      rapidjson::Value&                   json,
+                                      rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -76,24 +80,22 @@ bool GetVariablesReqConverter::toJson(const GetVariablesReq& data, rapidjson::Do
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // getVariableData
 
     rapidjson::Value                                  getVariableData_json(rapidjson::kArrayType);
     ocpp::types::ocpp20::GetVariableDataTypeConverter getVariableData_converter;
-    getVariableData_converter.setAllocator(allocator);
     for (const ocpp::types::ocpp20::GetVariableDataType& item : data.getVariableData)
     {
-        rapidjson::Document item_doc(rapidjson::kObjectType);
-        ret = ret && getVariableData_converter.toJson(item, item_doc);
-        getVariableData_json.PushBack(item_doc.Move(), *allocator);
+        rapidjson::Value item_doc(rapidjson::kObjectType);
+        ret = ret && getVariableData_converter.toJson(item, item_doc, allocator);
+        getVariableData_json.PushBack(item_doc.Move(), allocator);
     }
-    json.AddMember(rapidjson::StringRef("getVariableData"), getVariableData_json.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("getVariableData"), getVariableData_json.Move(), allocator);
 
     return ret;
 }
@@ -102,26 +104,28 @@ bool GetVariablesReqConverter::toJson(const GetVariablesReq& data, rapidjson::Do
 bool GetVariablesConfConverter::fromJson(const rapidjson::Value& json,
                                          GetVariablesConf&       data,
                                          std::string&            error_code,
-                                         std::string&            error_message)
+                                         std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // getVariableResult
-    if (json.HasMember("getVariableResult"))
+    ret = ret && checkArray(json, "getVariableResult", true, 1u, 0u, error_message);
+    if (ret && json.HasMember("getVariableResult"))
     {
         const rapidjson::Value&                             getVariableResult_json = json["getVariableResult"];
         ocpp::types::ocpp20::GetVariableResultTypeConverter getVariableResult_converter;
         for (auto it = getVariableResult_json.Begin(); ret && (it != getVariableResult_json.End()); ++it)
         {
-            ocpp::types::ocpp20::GetVariableResultType& item = data.getVariableResult.emplace_back();
-            ret = ret && getVariableResult_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it,
+                          "getVariableResult",
+                          data.getVariableResult.emplace_back(),
+                          getVariableResult_converter,
+                          error_code,
+                          error_message);
         }
     }
 
@@ -134,7 +138,9 @@ bool GetVariablesConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a GetVariablesConf to a JSON representation */
-bool GetVariablesConfConverter::toJson(const GetVariablesConf& data, rapidjson::Document& json)
+bool GetVariablesConfConverter::toJson(const GetVariablesConf&             data,
+                                       rapidjson::Value&                   json,
+                                       rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -142,24 +148,22 @@ bool GetVariablesConfConverter::toJson(const GetVariablesConf& data, rapidjson::
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // getVariableResult
 
     rapidjson::Value                                    getVariableResult_json(rapidjson::kArrayType);
     ocpp::types::ocpp20::GetVariableResultTypeConverter getVariableResult_converter;
-    getVariableResult_converter.setAllocator(allocator);
     for (const ocpp::types::ocpp20::GetVariableResultType& item : data.getVariableResult)
     {
-        rapidjson::Document item_doc(rapidjson::kObjectType);
-        ret = ret && getVariableResult_converter.toJson(item, item_doc);
-        getVariableResult_json.PushBack(item_doc.Move(), *allocator);
+        rapidjson::Value item_doc(rapidjson::kObjectType);
+        ret = ret && getVariableResult_converter.toJson(item, item_doc, allocator);
+        getVariableResult_json.PushBack(item_doc.Move(), allocator);
     }
-    json.AddMember(rapidjson::StringRef("getVariableResult"), getVariableResult_json.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("getVariableResult"), getVariableResult_json.Move(), allocator);
 
     return ret;
 }
@@ -33,16 +33,16 @@ namespace ocpp20
 {
 
 /** @brief Convert a HeartbeatReq from a JSON representation */
-bool HeartbeatReqConverter::fromJson(const rapidjson::Value& json, HeartbeatReq& data, std::string& error_code, std::string& error_message)
+bool HeartbeatReqConverter::fromJson(const rapidjson::Value& json,
+                                     HeartbeatReq&           data,
+                                     std::string&            error_code,
+                                     std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -53,7 +53,7 @@ bool HeartbeatReqConverter::fromJson(const rapidjson::Value& json, HeartbeatReq&
 }
 
 /** @brief Convert a HeartbeatReq to a JSON representation */
-bool HeartbeatReqConverter::toJson(const HeartbeatReq& data, rapidjson::Document& json)
+bool HeartbeatReqConverter::toJson(const HeartbeatReq& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -61,10 +61,9 @@ bool HeartbeatReqConverter::toJson(const HeartbeatReq& data, rapidjson::Document
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     return ret;
@@ -74,16 +73,13 @@ bool HeartbeatReqConverter::toJson(const HeartbeatReq& data, rapidjson::Document
 bool HeartbeatConfConverter::fromJson(const rapidjson::Value& json,
                                       HeartbeatConf&          data,
                                       std::string&            error_code,
-                                      std::string&            error_message)
+                                      std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // currentTime
     ret = ret && extract(json, "currentTime", data.currentTime, error_message);
@@ -97,7 +93,7 @@ bool HeartbeatConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a HeartbeatConf to a JSON representation */
-bool HeartbeatConfConverter::toJson(const HeartbeatConf& data, rapidjson::Document& json)
+bool HeartbeatConfConverter::toJson(const HeartbeatConf& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -105,14 +101,13 @@ bool HeartbeatConfConverter::toJson(const HeartbeatConf& data, rapidjson::Docume
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // currentTime
-    fill(json, "currentTime", data.currentTime);
+    fill(json, "currentTime", data.currentTime, allocator);
 
     return ret;
 }
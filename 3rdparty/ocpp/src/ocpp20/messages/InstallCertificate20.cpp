@@ -36,22 +36,20 @@ namespace ocpp20
 bool InstallCertificateReqConverter::fromJson(const rapidjson::Value& json,
                                               InstallCertificateReq&  data,
                                               std::string&            error_code,
-                                              std::string&            error_message)
+                                              std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // certificateType
-    data.certificateType = ocpp::types::ocpp20::InstallCertificateUseEnumTypeHelper.fromString(json["certificateType"].GetString());
+    ret = ret &&
+          extract(json, "certificateType", data.certificateType, ocpp::types::ocpp20::InstallCertificateUseEnumTypeHelper, error_message);
 
     // certificate
-    extract(json, "certificate", data.certificate);
+    ret = ret && extract(json, "certificate", data.certificate, error_message);
 
     if (!ret)
     {
@@ -62,7 +60,9 @@ bool InstallCertificateReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a InstallCertificateReq to a JSON representation */
-bool InstallCertificateReqConverter::toJson(const InstallCertificateReq& data, rapidjson::Document& json)
+bool InstallCertificateReqConverter::toJson(const InstallCertificateReq&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -70,17 +70,16 @@ bool InstallCertificateReqConverter::toJson(const InstallCertificateReq& data, r
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // certificateType
-    fill(json, "certificateType", ocpp::types::ocpp20::InstallCertificateUseEnumTypeHelper.toString(data.certificateType));
+    fill(json, "certificateType", ocpp::types::ocpp20::InstallCertificateUseEnumTypeHelper.toString(data.certificateType), allocator);
 
     // certificate
-    fill(json, "certificate", data.certificate);
+    fill(json, "certificate", data.certificate, allocator);
 
     return ret;
 }
@@ -89,26 +88,20 @@ bool InstallCertificateReqConverter::toJson(const InstallCertificateReq& data, r
 bool InstallCertificateConfConverter::fromJson(const rapidjson::Value& json,
                                                InstallCertificateConf& data,
                                                std::string&            error_code,
-                                               std::string&            error_message)
+                                               std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::InstallCertificateStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::InstallCertificateStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -119,7 +112,9 @@ bool InstallCertificateConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a InstallCertificateConf to a JSON representation */
-bool InstallCertificateConfConverter::toJson(const InstallCertificateConf& data, rapidjson::Document& json)
+bool InstallCertificateConfConverter::toJson(const InstallCertificateConf&       data,
+                                             rapidjson::Value&                   json,
+                                             rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -127,23 +122,21 @@ bool InstallCertificateConfConverter::toJson(const InstallCertificateConf& data,
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::InstallCertificateStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::InstallCertificateStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
@@ -148,7 +148,6 @@ MessagesConverter20::MessagesConverter20()
     REGISTER_CONVERTER(Authorize);
     REGISTER_CONVERTER(ClearedChargingLimit);
     REGISTER_CONVERTER(CostUpdated);
-    REGISTER_CONVERTER(DataTransfer);
     REGISTER_CONVERTER(FirmwareStatusNotification);
     REGISTER_CONVERTER(Heartbeat);
     REGISTER_CONVERTER(LogStatusNotification);
@@ -218,7 +217,6 @@ MessagesConverter20::~MessagesConverter20()
     DELETE_CONVERTER(Authorize);
     DELETE_CONVERTER(ClearedChargingLimit);
     DELETE_CONVERTER(CostUpdated);
-    DELETE_CONVERTER(DataTransfer);
     DELETE_CONVERTER(FirmwareStatusNotification);
     DELETE_CONVERTER(Heartbeat);
     DELETE_CONVERTER(LogStatusNotification);
@@ -106,71 +106,78 @@ bool MessagesValidator20::load(const std::string& schemas_path)
     // Load validators for all the messages
     m_req_validators.clear();
     m_resp_validators.clear();
-    ret = addValidator(schemas_path, CANCELRESERVATION_ACTION) && ret;
-    ret = addValidator(schemas_path, CERTIFICATESIGNED_ACTION) && ret;
-    ret = addValidator(schemas_path, CHANGEAVAILABILITY_ACTION) && ret;
-    ret = addValidator(schemas_path, CLEARCACHE_ACTION) && ret;
-    ret = addValidator(schemas_path, CLEARCHARGINGPROFILE_ACTION) && ret;
-    ret = addValidator(schemas_path, CLEARDISPLAYMESSAGE_ACTION) && ret;
-    ret = addValidator(schemas_path, CLEARVARIABLEMONITORING_ACTION) && ret;
-    ret = addValidator(schemas_path, CUSTOMERINFORMATION_ACTION) && ret;
-    ret = addValidator(schemas_path, DATATRANSFER_ACTION) && ret;
-    ret = addValidator(schemas_path, DELETECERTIFICATE_ACTION) && ret;
-    ret = addValidator(schemas_path, GET15118EVCERTIFICATE_ACTION) && ret;
-    ret = addValidator(schemas_path, GETBASEREPORT_ACTION) && ret;
-    ret = addValidator(schemas_path, GETCERTIFICATESTATUS_ACTION) && ret;
-    ret = addValidator(schemas_path, GETCHARGINGPROFILES_ACTION) && ret;
-    ret = addValidator(schemas_path, GETCOMPOSITESCHEDULE_ACTION) && ret;
-    ret = addValidator(schemas_path, GETDISPLAYMESSAGES_ACTION) && ret;
-    ret = addValidator(schemas_path, GETINSTALLEDCERTIFICATEIDS_ACTION) && ret;
-    ret = addValidator(schemas_path, GETLOCALLISTVERSION_ACTION) && ret;
-    ret = addValidator(schemas_path, GETLOG_ACTION) && ret;
-    ret = addValidator(schemas_path, GETMONITORINGREPORT_ACTION) && ret;
-    ret = addValidator(schemas_path, GETREPORT_ACTION) && ret;
-    ret = addValidator(schemas_path, GETTRANSACTIONSTATUS_ACTION) && ret;
-    ret = addValidator(schemas_path, GETVARIABLES_ACTION) && ret;
-    ret = addValidator(schemas_path, INSTALLCERTIFICATE_ACTION) && ret;
-    ret = addValidator(schemas_path, PUBLISHFIRMWARE_ACTION) && ret;
-    ret = addValidator(schemas_path, REQUESTSTARTTRANSACTION_ACTION) && ret;
-    ret = addValidator(schemas_path, REQUESTSTOPTRANSACTION_ACTION) && ret;
-    ret = addValidator(schemas_path, RESERVENOW_ACTION) && ret;
-    ret = addValidator(schemas_path, RESET_ACTION) && ret;
-    ret = addValidator(schemas_path, SENDLOCALLIST_ACTION) && ret;
-    ret = addValidator(schemas_path, SETCHARGINGPROFILE_ACTION) && ret;
-    ret = addValidator(schemas_path, SETDISPLAYMESSAGE_ACTION) && ret;
-    ret = addValidator(schemas_path, SETMONITORINGBASE_ACTION) && ret;
-    ret = addValidator(schemas_path, SETMONITORINGLEVEL_ACTION) && ret;
-    ret = addValidator(schemas_path, SETNETWORKPROFILE_ACTION) && ret;
-    ret = addValidator(schemas_path, SETVARIABLEMONITORING_ACTION) && ret;
-    ret = addValidator(schemas_path, SETVARIABLES_ACTION) && ret;
-    ret = addValidator(schemas_path, TRIGGERMESSAGE_ACTION) && ret;
-    ret = addValidator(schemas_path, UNLOCKCONNECTOR_ACTION) && ret;
-    ret = addValidator(schemas_path, UNPUBLISHFIRMWARE_ACTION) && ret;
-    ret = addValidator(schemas_path, UPDATEFIRMWARE_ACTION) && ret;
-    ret = addValidator(schemas_path, BOOTNOTIFICATION_ACTION) && ret;
-    ret = addValidator(schemas_path, AUTHORIZE_ACTION) && ret;
-    ret = addValidator(schemas_path, CLEAREDCHARGINGLIMIT_ACTION) && ret;
-    ret = addValidator(schemas_path, COSTUPDATED_ACTION) && ret;
-    ret = addValidator(schemas_path, DATATRANSFER_ACTION) && ret;
-    ret = addValidator(schemas_path, FIRMWARESTATUSNOTIFICATION_ACTION) && ret;
-    ret = addValidator(schemas_path, HEARTBEAT_ACTION) && ret;
-    ret = addValidator(schemas_path, LOGSTATUSNOTIFICATION_ACTION) && ret;
-    ret = addValidator(schemas_path, METERVALUES_ACTION) && ret;
-    ret = addValidator(schemas_path, NOTIFYCHARGINGLIMIT_ACTION) && ret;
-    ret = addValidator(schemas_path, NOTIFYCUSTOMERINFORMATION_ACTION) && ret;
-    ret = addValidator(schemas_path, NOTIFYDISPLAYMESSAGES_ACTION) && ret;
-    ret = addValidator(schemas_path, NOTIFYEVCHARGINGNEEDS_ACTION) && ret;
-    ret = addValidator(schemas_path, NOTIFYEVCHARGINGSCHEDULE_ACTION) && ret;
-    ret = addValidator(schemas_path, NOTIFYEVENT_ACTION) && ret;
-    ret = addValidator(schemas_path, NOTIFYMONITORINGREPORT_ACTION) && ret;
-    ret = addValidator(schemas_path, NOTIFYREPORT_ACTION) && ret;
-    ret = addValidator(schemas_path, PUBLISHFIRMWARESTATUSNOTIFICATION_ACTION) && ret;
-    ret = addValidator(schemas_path, REPORTCHARGINGPROFILES_ACTION) && ret;
-    ret = addValidator(schemas_path, RESERVATIONSTATUSUPDATE_ACTION) && ret;
-    ret = addValidator(schemas_path, SECURITYEVENTNOTIFICATION_ACTION) && ret;
-    ret = addValidator(schemas_path, SIGNCERTIFICATE_ACTION) && ret;
-    ret = addValidator(schemas_path, STATUSNOTIFICATION_ACTION) && ret;
-    ret = addValidator(schemas_path, TRANSACTIONEVENT_ACTION) && ret;
+    if (!schemas_path.empty())
+    {
+        ret = addValidator(schemas_path, CANCELRESERVATION_ACTION) && ret;
+        ret = addValidator(schemas_path, CERTIFICATESIGNED_ACTION) && ret;
+        ret = addValidator(schemas_path, CHANGEAVAILABILITY_ACTION) && ret;
+        ret = addValidator(schemas_path, CLEARCACHE_ACTION) && ret;
+        ret = addValidator(schemas_path, CLEARCHARGINGPROFILE_ACTION) && ret;
+        ret = addValidator(schemas_path, CLEARDISPLAYMESSAGE_ACTION) && ret;
+        ret = addValidator(schemas_path, CLEARVARIABLEMONITORING_ACTION) && ret;
+        ret = addValidator(schemas_path, CUSTOMERINFORMATION_ACTION) && ret;
+        ret = addValidator(schemas_path, DATATRANSFER_ACTION) && ret;
+        ret = addValidator(schemas_path, DELETECERTIFICATE_ACTION) && ret;
+        ret = addValidator(schemas_path, GET15118EVCERTIFICATE_ACTION) && ret;
+        ret = addValidator(schemas_path, GETBASEREPORT_ACTION) && ret;
+        ret = addValidator(schemas_path, GETCERTIFICATESTATUS_ACTION) && ret;
+        ret = addValidator(schemas_path, GETCHARGINGPROFILES_ACTION) && ret;
+        ret = addValidator(schemas_path, GETCOMPOSITESCHEDULE_ACTION) && ret;
+        ret = addValidator(schemas_path, GETDISPLAYMESSAGES_ACTION) && ret;
+        ret = addValidator(schemas_path, GETINSTALLEDCERTIFICATEIDS_ACTION) && ret;
+        ret = addValidator(schemas_path, GETLOCALLISTVERSION_ACTION) && ret;
+        ret = addValidator(schemas_path, GETLOG_ACTION) && ret;
+        ret = addValidator(schemas_path, GETMONITORINGREPORT_ACTION) && ret;
+        ret = addValidator(schemas_path, GETREPORT_ACTION) && ret;
+        ret = addValidator(schemas_path, GETTRANSACTIONSTATUS_ACTION) && ret;
+        ret = addValidator(schemas_path, GETVARIABLES_ACTION) && ret;
+        ret = addValidator(schemas_path, INSTALLCERTIFICATE_ACTION) && ret;
+        ret = addValidator(schemas_path, PUBLISHFIRMWARE_ACTION) && ret;
+        ret = addValidator(schemas_path, REQUESTSTARTTRANSACTION_ACTION) && ret;
+        ret = addValidator(schemas_path, REQUESTSTOPTRANSACTION_ACTION) && ret;
+        ret = addValidator(schemas_path, RESERVENOW_ACTION) && ret;
+        ret = addValidator(schemas_path, RESET_ACTION) && ret;
+        ret = addValidator(schemas_path, SENDLOCALLIST_ACTION) && ret;
+        ret = addValidator(schemas_path, SETCHARGINGPROFILE_ACTION) && ret;
+        ret = addValidator(schemas_path, SETDISPLAYMESSAGE_ACTION) && ret;
+        ret = addValidator(schemas_path, SETMONITORINGBASE_ACTION) && ret;
+        ret = addValidator(schemas_path, SETMONITORINGLEVEL_ACTION) && ret;
+        ret = addValidator(schemas_path, SETNETWORKPROFILE_ACTION) && ret;
+        ret = addValidator(schemas_path, SETVARIABLEMONITORING_ACTION) && ret;
+        ret = addValidator(schemas_path, SETVARIABLES_ACTION) && ret;
+        ret = addValidator(schemas_path, TRIGGERMESSAGE_ACTION) && ret;
+        ret = addValidator(schemas_path, UNLOCKCONNECTOR_ACTION) && ret;
+        ret = addValidator(schemas_path, UNPUBLISHFIRMWARE_ACTION) && ret;
+        ret = addValidator(schemas_path, UPDATEFIRMWARE_ACTION) && ret;
+        ret = addValidator(schemas_path, BOOTNOTIFICATION_ACTION) && ret;
+        ret = addValidator(schemas_path, AUTHORIZE_ACTION) && ret;
+        ret = addValidator(schemas_path, CLEAREDCHARGINGLIMIT_ACTION) && ret;
+        ret = addValidator(schemas_path, COSTUPDATED_ACTION) && ret;
+        ret = addValidator(schemas_path, DATATRANSFER_ACTION) && ret;
+        ret = addValidator(schemas_path, FIRMWARESTATUSNOTIFICATION_ACTION) && ret;
+        ret = addValidator(schemas_path, HEARTBEAT_ACTION) && ret;
+        ret = addValidator(schemas_path, LOGSTATUSNOTIFICATION_ACTION) && ret;
+        ret = addValidator(schemas_path, METERVALUES_ACTION) && ret;
+        ret = addValidator(schemas_path, NOTIFYCHARGINGLIMIT_ACTION) && ret;
+        ret = addValidator(schemas_path, NOTIFYCUSTOMERINFORMATION_ACTION) && ret;
+        ret = addValidator(schemas_path, NOTIFYDISPLAYMESSAGES_ACTION) && ret;
+        ret = addValidator(schemas_path, NOTIFYEVCHARGINGNEEDS_ACTION) && ret;
+        ret = addValidator(schemas_path, NOTIFYEVCHARGINGSCHEDULE_ACTION) && ret;
+        ret = addValidator(schemas_path, NOTIFYEVENT_ACTION) && ret;
+        ret = addValidator(schemas_path, NOTIFYMONITORINGREPORT_ACTION) && ret;
+        ret = addValidator(schemas_path, NOTIFYREPORT_ACTION) && ret;
+        ret = addValidator(schemas_path, PUBLISHFIRMWARESTATUSNOTIFICATION_ACTION) && ret;
+        ret = addValidator(schemas_path, REPORTCHARGINGPROFILES_ACTION) && ret;
+        ret = addValidator(schemas_path, RESERVATIONSTATUSUPDATE_ACTION) && ret;
+        ret = addValidator(schemas_path, SECURITYEVENTNOTIFICATION_ACTION) && ret;
+        ret = addValidator(schemas_path, SIGNCERTIFICATE_ACTION) && ret;
+        ret = addValidator(schemas_path, STATUSNOTIFICATION_ACTION) && ret;
+        ret = addValidator(schemas_path, TRANSACTIONEVENT_ACTION) && ret;
+    }
+    else
+    {
+        LOG_INFO << "No JSON schemas path, messages will only be checked by their converters";
+    }
 
     return ret;
 }
@@ -196,6 +203,23 @@ ocpp::json::JsonValidator* MessagesValidator20::getValidator(const std::string&
     return validator;
 }
 
+/** @brief Get the message validator corresponding to a given action, shared with the caller */
+std::shared_ptr<ocpp::json::JsonValidator> MessagesValidator20::getSharedValidator(const std::string& action, bool is_req) const
+{
+    std::shared_ptr<ocpp::json::JsonValidator> validator;
+
+    // Get validators list
+    const auto& validators = (is_req ? m_req_validators : m_resp_validators);
+
+    auto iter = validators.find(action);
+    if (iter != validators.cend())
+    {
+        validator = iter->second;
+    }
+
+    return validator;
+}
+
 /** @brief Add a message validator for both request and response */
 bool MessagesValidator20::addValidator(const std::string& schemas_path, const std::string& action)
 {
@@ -43,6 +43,8 @@ class MessagesValidator20 : public IMessagesValidator
 
     /**
      * @brief Load the messages validators
+     * @param schemas_path Path to the JSON schemas of the messages, if empty no schema is loaded
+     *                     and the messages are only checked by their generated converters
      * @return true if all the messages validators have been loaded, false otherwise
      */
     bool load(const std::string& schemas_path);
@@ -50,6 +52,12 @@ class MessagesValidator20 : public IMessagesValidator
     /** @copydoc ocpp::json::JsonValidator* IMessagesValidator::getValidator(const std::string&, bool) const */
     ocpp::json::JsonValidator* getValidator(const std::string& action, bool is_req) const override;
 
+    /** @copydoc std::shared_ptr<ocpp::json::JsonValidator> IMessagesValidator::getSharedValidator(const std::string&, bool) const */
+    std::shared_ptr<ocpp::json::JsonValidator> getSharedValidator(const std::string& action, bool is_req) const override;
+
+    /** @copydoc bool IMessagesValidator::isSchemaValidationOptional() const */
+    bool isSchemaValidationOptional() const override { return true; }
+
   private:
     /** @brief Messages validators for requests */
     std::unordered_map<std::string, std::shared_ptr<ocpp::json::JsonValidator>> m_req_validators;
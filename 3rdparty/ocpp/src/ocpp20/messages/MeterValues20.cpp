@@ -36,29 +36,26 @@ namespace ocpp20
 bool MeterValuesReqConverter::fromJson(const rapidjson::Value& json,
                                        MeterValuesReq&         data,
                                        std::string&            error_code,
-                                       std::string&            error_message)
+                                       std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // evseId
-    extract(json, "evseId", data.evseId);
+    ret = ret && extract(json, "evseId", data.evseId, error_message);
 
     // meterValue
-    if (json.HasMember("meterValue"))
+    ret = ret && checkArray(json, "meterValue", true, 1u, 0u, error_message);
+    if (ret && json.HasMember("meterValue"))
     {
         const rapidjson::Value&                      meterValue_json = json["meterValue"];
         ocpp::types::ocpp20::MeterValueTypeConverter meterValue_converter;
         for (auto it = meterValue_json.Begin(); ret && (it != meterValue_json.End()); ++it)
         {
-            ocpp::types::ocpp20::MeterValueType& item = data.meterValue.emplace_back();
-            ret                                       = ret && meterValue_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it, "meterValue", data.meterValue.emplace_back(), meterValue_converter, error_code, error_message);
         }
     }
 
@@ -70,8 +67,60 @@ bool MeterValuesReqConverter::fromJson(const rapidjson::Value& json,
     return ret;
 }
 
+/** @brief Convert a MeterValuesReq from a JSON stream */
+bool MeterValuesReqConverter::fromJson(ocpp::json::JsonReader& reader,
+                                       MeterValuesReq&         data,
+                                       std::string&            error_code,
+                                       std::string&            error_message) const
+{
+    bool ret              = true;
+    bool evseId_found     = false;
+    bool meterValue_found = false;
+
+    while (ret && reader.nextMember())
+    {
+        if (reader.isMember("customData"))
+        {
+            ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+            ret = convert(reader, "customData", data.customData.value(), customData_converter, error_code, error_message);
+        }
+        else if (reader.isMember("evseId"))
+        {
+            ret          = convert(reader, "evseId", data.evseId, error_message);
+            evseId_found = true;
+        }
+        else if (reader.isMember("meterValue"))
+        {
+            ocpp::types::ocpp20::MeterValueTypeConverter meterValue_converter;
+            ret = checkArray(reader, "meterValue", error_message);
+            while (ret && reader.nextItem())
+            {
+                ret = convert(reader, "meterValue", data.meterValue.emplace_back(), meterValue_converter, error_code, error_message);
+            }
+            ret              = ret && checkItems("meterValue", data.meterValue.size(), 1u, 0u, error_message);
+            meterValue_found = true;
+        }
+        else
+        {
+            ret = reader.skip();
+        }
+    }
+    ret = ret && !reader.hasError();
+    ret = ret && checkRequired("evseId", evseId_found, error_message);
+    ret = ret && checkRequired("meterValue", meterValue_found, error_message);
+
+    if (!ret)
+    {
+        error_code = ocpp::rpc::IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
+    }
+
+    return ret;
+}
+
 /** @brief Convert a MeterValuesReq to a JSON representation */
-bool MeterValuesReqConverter::toJson(const MeterValuesReq& data, rapidjson::Document& json)
+bool MeterValuesReqConverter::toJson(const MeterValuesReq&               data,
+                                     rapidjson::Value&                   json,
+                                     rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -79,27 +128,25 @@ bool MeterValuesReqConverter::toJson(const MeterValuesReq& data, rapidjson::Docu
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // evseId
-    fill(json, "evseId", data.evseId);
+    fill(json, "evseId", data.evseId, allocator);
 
     // meterValue
 
     rapidjson::Value                             meterValue_json(rapidjson::kArrayType);
     ocpp::types::ocpp20::MeterValueTypeConverter meterValue_converter;
-    meterValue_converter.setAllocator(allocator);
     for (const ocpp::types::ocpp20::MeterValueType& item : data.meterValue)
     {
-        rapidjson::Document item_doc(rapidjson::kObjectType);
-        ret = ret && meterValue_converter.toJson(item, item_doc);
-        meterValue_json.PushBack(item_doc.Move(), *allocator);
+        rapidjson::Value item_doc(rapidjson::kObjectType);
+        ret = ret && meterValue_converter.toJson(item, item_doc, allocator);
+        meterValue_json.PushBack(item_doc.Move(), allocator);
     }
-    json.AddMember(rapidjson::StringRef("meterValue"), meterValue_json.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("meterValue"), meterValue_json.Move(), allocator);
 
     return ret;
 }
@@ -108,16 +155,13 @@ bool MeterValuesReqConverter::toJson(const MeterValuesReq& data, rapidjson::Docu
 bool MeterValuesConfConverter::fromJson(const rapidjson::Value& json,
                                         MeterValuesConf&        data,
                                         std::string&            error_code,
-                                        std::string&            error_message)
+                                        std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -128,7 +172,9 @@ bool MeterValuesConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a MeterValuesConf to a JSON representation */
-bool MeterValuesConfConverter::toJson(const MeterValuesConf& data, rapidjson::Document& json)
+bool MeterValuesConfConverter::toJson(const MeterValuesConf&              data,
+                                      rapidjson::Value&                   json,
+                                      rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -136,10 +182,9 @@ bool MeterValuesConfConverter::toJson(const MeterValuesConf& data, rapidjson::Do
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     return ret;
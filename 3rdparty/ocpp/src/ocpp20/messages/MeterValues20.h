@@ -60,7 +60,7 @@ struct MeterValuesConf
 };
 
 // Message converters
-MESSAGE_CONVERTERS(MeterValues)
+STREAMED_MESSAGE_CONVERTERS(MeterValues)
 
 } // namespace ocpp20
 } // namespace messages
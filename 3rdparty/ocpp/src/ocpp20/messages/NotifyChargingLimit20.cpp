@@ -36,35 +36,37 @@ namespace ocpp20
 bool NotifyChargingLimitReqConverter::fromJson(const rapidjson::Value& json,
                                                NotifyChargingLimitReq& data,
                                                std::string&            error_code,
-                                               std::string&            error_message)
+                                               std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // chargingSchedule
-    if (json.HasMember("chargingSchedule"))
+    ret = ret && checkArray(json, "chargingSchedule", false, 1u, 0u, error_message);
+    if (ret && json.HasMember("chargingSchedule"))
     {
         const rapidjson::Value&                            chargingSchedule_json = json["chargingSchedule"];
         ocpp::types::ocpp20::ChargingScheduleTypeConverter chargingSchedule_converter;
         for (auto it = chargingSchedule_json.Begin(); ret && (it != chargingSchedule_json.End()); ++it)
         {
-            ocpp::types::ocpp20::ChargingScheduleType& item = data.chargingSchedule.emplace_back();
-            ret = ret && chargingSchedule_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it,
+                          "chargingSchedule",
+                          data.chargingSchedule.emplace_back(),
+                          chargingSchedule_converter,
+                          error_code,
+                          error_message);
         }
     }
 
     // evseId
-    extract(json, "evseId", data.evseId);
+    ret = ret && extract(json, "evseId", data.evseId, error_message);
 
     // chargingLimit
     ocpp::types::ocpp20::ChargingLimitTypeConverter chargingLimit_converter;
-    ret = ret && chargingLimit_converter.fromJson(json["chargingLimit"], data.chargingLimit, error_code, error_message);
+    ret = ret && extract(json, "chargingLimit", data.chargingLimit, chargingLimit_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -75,7 +77,9 @@ bool NotifyChargingLimitReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a NotifyChargingLimitReq to a JSON representation */
-bool NotifyChargingLimitReqConverter::toJson(const NotifyChargingLimitReq& data, rapidjson::Document& json)
+bool NotifyChargingLimitReqConverter::toJson(const NotifyChargingLimitReq&       data,
+                                             rapidjson::Value&                   json,
+                                             rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -83,10 +87,9 @@ bool NotifyChargingLimitReqConverter::toJson(const NotifyChargingLimitReq& data,
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // chargingSchedule
@@ -95,25 +98,23 @@ bool NotifyChargingLimitReqConverter::toJson(const NotifyChargingLimitReq& data,
 
         rapidjson::Value                                   chargingSchedule_json(rapidjson::kArrayType);
         ocpp::types::ocpp20::ChargingScheduleTypeConverter chargingSchedule_converter;
-        chargingSchedule_converter.setAllocator(allocator);
         for (const ocpp::types::ocpp20::ChargingScheduleType& item : data.chargingSchedule)
         {
-            rapidjson::Document item_doc(rapidjson::kObjectType);
-            ret = ret && chargingSchedule_converter.toJson(item, item_doc);
-            chargingSchedule_json.PushBack(item_doc.Move(), *allocator);
+            rapidjson::Value item_doc(rapidjson::kObjectType);
+            ret = ret && chargingSchedule_converter.toJson(item, item_doc, allocator);
+            chargingSchedule_json.PushBack(item_doc.Move(), allocator);
         }
-        json.AddMember(rapidjson::StringRef("chargingSchedule"), chargingSchedule_json.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("chargingSchedule"), chargingSchedule_json.Move(), allocator);
     }
 
     // evseId
-    fill(json, "evseId", data.evseId);
+    fill(json, "evseId", data.evseId, allocator);
 
     // chargingLimit
     ocpp::types::ocpp20::ChargingLimitTypeConverter chargingLimit_converter;
-    chargingLimit_converter.setAllocator(allocator);
-    rapidjson::Document chargingLimit_doc(rapidjson::kObjectType);
-    ret = ret && chargingLimit_converter.toJson(data.chargingLimit, chargingLimit_doc);
-    json.AddMember(rapidjson::StringRef("chargingLimit"), chargingLimit_doc.Move(), *allocator);
+    rapidjson::Value                                chargingLimit_doc(rapidjson::kObjectType);
+    ret = ret && chargingLimit_converter.toJson(data.chargingLimit, chargingLimit_doc, allocator);
+    json.AddMember(rapidjson::StringRef("chargingLimit"), chargingLimit_doc.Move(), allocator);
 
     return ret;
 }
@@ -122,16 +123,13 @@ bool NotifyChargingLimitReqConverter::toJson(const NotifyChargingLimitReq& data,
 bool NotifyChargingLimitConfConverter::fromJson(const rapidjson::Value&  json,
                                                 NotifyChargingLimitConf& data,
                                                 std::string&             error_code,
-                                                std::string&             error_message)
+                                                std::string&             error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -142,7 +140,9 @@ bool NotifyChargingLimitConfConverter::fromJson(const rapidjson::Value&  json,
 }
 
 /** @brief Convert a NotifyChargingLimitConf to a JSON representation */
-bool NotifyChargingLimitConfConverter::toJson(const NotifyChargingLimitConf& data, rapidjson::Document& json)
+bool NotifyChargingLimitConfConverter::toJson(const NotifyChargingLimitConf&      data,
+                                              rapidjson::Value&                   json,
+                                              rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -150,10 +150,9 @@ bool NotifyChargingLimitConfConverter::toJson(const NotifyChargingLimitConf& dat
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     return ret;
@@ -36,31 +36,28 @@ namespace ocpp20
 bool NotifyCustomerInformationReqConverter::fromJson(const rapidjson::Value&       json,
                                                      NotifyCustomerInformationReq& data,
                                                      std::string&                  error_code,
-                                                     std::string&                  error_message)
+                                                     std::string&                  error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // data
-    extract(json, "data", data.data);
+    ret = ret && extract(json, "data", data.data, error_message);
 
     // tbc
-    extract(json, "tbc", data.tbc);
+    ret = ret && extract(json, "tbc", data.tbc, error_message);
 
     // seqNo
-    extract(json, "seqNo", data.seqNo);
+    ret = ret && extract(json, "seqNo", data.seqNo, error_message);
 
     // generatedAt
     ret = ret && extract(json, "generatedAt", data.generatedAt, error_message);
 
     // requestId
-    extract(json, "requestId", data.requestId);
+    ret = ret && extract(json, "requestId", data.requestId, error_message);
 
     if (!ret)
     {
@@ -71,7 +68,9 @@ bool NotifyCustomerInformationReqConverter::fromJson(const rapidjson::Value&
 }
 
 /** @brief Convert a NotifyCustomerInformationReq to a JSON representation */
-bool NotifyCustomerInformationReqConverter::toJson(const NotifyCustomerInformationReq& data, rapidjson::Document& json)
+bool NotifyCustomerInformationReqConverter::toJson(const NotifyCustomerInformationReq& data,
+                                                   rapidjson::Value&                   json,
+                                                   rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -79,26 +78,25 @@ bool NotifyCustomerInformationReqConverter::toJson(const NotifyCustomerInformati
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // data
-    fill(json, "data", data.data);
+    fill(json, "data", data.data, allocator);
 
     // tbc
-    fill(json, "tbc", data.tbc);
+    fill(json, "tbc", data.tbc, allocator);
 
     // seqNo
-    fill(json, "seqNo", data.seqNo);
+    fill(json, "seqNo", data.seqNo, allocator);
 
     // generatedAt
-    fill(json, "generatedAt", data.generatedAt);
+    fill(json, "generatedAt", data.generatedAt, allocator);
 
     // requestId
-    fill(json, "requestId", data.requestId);
+    fill(json, "requestId", data.requestId, allocator);
 
     return ret;
 }
@@ -107,16 +105,13 @@ bool NotifyCustomerInformationReqConverter::toJson(const NotifyCustomerInformati
 bool NotifyCustomerInformationConfConverter::fromJson(const rapidjson::Value&        json,
                                                       NotifyCustomerInformationConf& data,
                                                       std::string&                   error_code,
-                                                      std::string&                   error_message)
+                                                      std::string&                   error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -127,7 +122,9 @@ bool NotifyCustomerInformationConfConverter::fromJson(const rapidjson::Value&
 }
 
 /** @brief Convert a NotifyCustomerInformationConf to a JSON representation */
-bool NotifyCustomerInformationConfConverter::toJson(const NotifyCustomerInformationConf& data, rapidjson::Document& json)
+bool NotifyCustomerInformationConfConverter::toJson(const NotifyCustomerInformationConf& data,
+                                                    rapidjson::Value&                    json,
+                                                    rapidjson::Document::AllocatorType&  allocator) const
 {
     bool ret = true;
 
@@ -135,10 +132,9 @@ bool NotifyCustomerInformationConfConverter::toJson(const NotifyCustomerInformat
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     return ret;
@@ -36,34 +36,31 @@ namespace ocpp20
 bool NotifyDisplayMessagesReqConverter::fromJson(const rapidjson::Value&   json,
                                                  NotifyDisplayMessagesReq& data,
                                                  std::string&              error_code,
-                                                 std::string&              error_message)
+                                                 std::string&              error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // messageInfo
-    if (json.HasMember("messageInfo"))
+    ret = ret && checkArray(json, "messageInfo", false, 1u, 0u, error_message);
+    if (ret && json.HasMember("messageInfo"))
     {
         const rapidjson::Value&                       messageInfo_json = json["messageInfo"];
         ocpp::types::ocpp20::MessageInfoTypeConverter messageInfo_converter;
         for (auto it = messageInfo_json.Begin(); ret && (it != messageInfo_json.End()); ++it)
         {
-            ocpp::types::ocpp20::MessageInfoType& item = data.messageInfo.emplace_back();
-            ret                                        = ret && messageInfo_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it, "messageInfo", data.messageInfo.emplace_back(), messageInfo_converter, error_code, error_message);
         }
     }
 
     // requestId
-    extract(json, "requestId", data.requestId);
+    ret = ret && extract(json, "requestId", data.requestId, error_message);
 
     // tbc
-    extract(json, "tbc", data.tbc);
+    ret = ret && extract(json, "tbc", data.tbc, error_message);
 
     if (!ret)
     {
@@ -74,7 +71,9 @@ bool NotifyDisplayMessagesReqConverter::fromJson(const rapidjson::Value&   json,
 }
 
 /** @brief Convert a NotifyDisplayMessagesReq to a JSON representation */
-bool NotifyDisplayMessagesReqConverter::toJson(const NotifyDisplayMessagesReq& data, rapidjson::Document& json)
+bool NotifyDisplayMessagesReqConverter::toJson(const NotifyDisplayMessagesReq&     data,
+                                               rapidjson::Value&                   json,
+                                               rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -82,10 +81,9 @@ bool NotifyDisplayMessagesReqConverter::toJson(const NotifyDisplayMessagesReq& d
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // messageInfo
@@ -94,21 +92,20 @@ bool NotifyDisplayMessagesReqConverter::toJson(const NotifyDisplayMessagesReq& d
 
         rapidjson::Value                              messageInfo_json(rapidjson::kArrayType);
         ocpp::types::ocpp20::MessageInfoTypeConverter messageInfo_converter;
-        messageInfo_converter.setAllocator(allocator);
         for (const ocpp::types::ocpp20::MessageInfoType& item : data.messageInfo)
         {
-            rapidjson::Document item_doc(rapidjson::kObjectType);
-            ret = ret && messageInfo_converter.toJson(item, item_doc);
-            messageInfo_json.PushBack(item_doc.Move(), *allocator);
+            rapidjson::Value item_doc(rapidjson::kObjectType);
+            ret = ret && messageInfo_converter.toJson(item, item_doc, allocator);
+            messageInfo_json.PushBack(item_doc.Move(), allocator);
         }
-        json.AddMember(rapidjson::StringRef("messageInfo"), messageInfo_json.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("messageInfo"), messageInfo_json.Move(), allocator);
     }
 
     // requestId
-    fill(json, "requestId", data.requestId);
+    fill(json, "requestId", data.requestId, allocator);
 
     // tbc
-    fill(json, "tbc", data.tbc);
+    fill(json, "tbc", data.tbc, allocator);
 
     return ret;
 }
@@ -117,16 +114,13 @@ bool NotifyDisplayMessagesReqConverter::toJson(const NotifyDisplayMessagesReq& d
 bool NotifyDisplayMessagesConfConverter::fromJson(const rapidjson::Value&    json,
                                                   NotifyDisplayMessagesConf& data,
                                                   std::string&               error_code,
-                                                  std::string&               error_message)
+                                                  std::string&               error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -137,7 +131,9 @@ bool NotifyDisplayMessagesConfConverter::fromJson(const rapidjson::Value&    jso
 }
 
 /** @brief Convert a NotifyDisplayMessagesConf to a JSON representation */
-bool NotifyDisplayMessagesConfConverter::toJson(const NotifyDisplayMessagesConf& data, rapidjson::Document& json)
+bool NotifyDisplayMessagesConfConverter::toJson(const NotifyDisplayMessagesConf&    data,
+                                                rapidjson::Value&                   json,
+                                                rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -145,10 +141,9 @@ bool NotifyDisplayMessagesConfConverter::toJson(const NotifyDisplayMessagesConf&
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     return ret;
@@ -36,26 +36,23 @@ namespace ocpp20
 bool NotifyEVChargingNeedsReqConverter::fromJson(const rapidjson::Value&   json,
                                                  NotifyEVChargingNeedsReq& data,
                                                  std::string&              error_code,
-                                                 std::string&              error_message)
+                                                 std::string&              error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // maxScheduleTuples
-    extract(json, "maxScheduleTuples", data.maxScheduleTuples);
+    ret = ret && extract(json, "maxScheduleTuples", data.maxScheduleTuples, error_message);
 
     // chargingNeeds
     ocpp::types::ocpp20::ChargingNeedsTypeConverter chargingNeeds_converter;
-    ret = ret && chargingNeeds_converter.fromJson(json["chargingNeeds"], data.chargingNeeds, error_code, error_message);
+    ret = ret && extract(json, "chargingNeeds", data.chargingNeeds, chargingNeeds_converter, error_code, error_message);
 
     // evseId
-    extract(json, "evseId", data.evseId);
+    ret = ret && extract(json, "evseId", data.evseId, error_message);
 
     if (!ret)
     {
@@ -66,7 +63,9 @@ bool NotifyEVChargingNeedsReqConverter::fromJson(const rapidjson::Value&   json,
 }
 
 /** @brief Convert a NotifyEVChargingNeedsReq to a JSON representation */
-bool NotifyEVChargingNeedsReqConverter::toJson(const NotifyEVChargingNeedsReq& data, rapidjson::Document& json)
+bool NotifyEVChargingNeedsReqConverter::toJson(const NotifyEVChargingNeedsReq&     data,
+                                               rapidjson::Value&                   json,
+                                               rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -74,24 +73,22 @@ bool NotifyEVChargingNeedsReqConverter::toJson(const NotifyEVChargingNeedsReq& d
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // maxScheduleTuples
-    fill(json, "maxScheduleTuples", data.maxScheduleTuples);
+    fill(json, "maxScheduleTuples", data.maxScheduleTuples, allocator);
 
     // chargingNeeds
     ocpp::types::ocpp20::ChargingNeedsTypeConverter chargingNeeds_converter;
-    chargingNeeds_converter.setAllocator(allocator);
-    rapidjson::Document chargingNeeds_doc(rapidjson::kObjectType);
-    ret = ret && chargingNeeds_converter.toJson(data.chargingNeeds, chargingNeeds_doc);
-    json.AddMember(rapidjson::StringRef("chargingNeeds"), chargingNeeds_doc.Move(), *allocator);
+    rapidjson::Value                                chargingNeeds_doc(rapidjson::kObjectType);
+    ret = ret && chargingNeeds_converter.toJson(data.chargingNeeds, chargingNeeds_doc, allocator);
+    json.AddMember(rapidjson::StringRef("chargingNeeds"), chargingNeeds_doc.Move(), allocator);
 
     // evseId
-    fill(json, "evseId", data.evseId);
+    fill(json, "evseId", data.evseId, allocator);
 
     return ret;
 }
@@ -100,26 +97,20 @@ bool NotifyEVChargingNeedsReqConverter::toJson(const NotifyEVChargingNeedsReq& d
 bool NotifyEVChargingNeedsConfConverter::fromJson(const rapidjson::Value&    json,
                                                   NotifyEVChargingNeedsConf& data,
                                                   std::string&               error_code,
-                                                  std::string&               error_message)
+                                                  std::string&               error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::NotifyEVChargingNeedsStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::NotifyEVChargingNeedsStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -130,7 +121,9 @@ bool NotifyEVChargingNeedsConfConverter::fromJson(const rapidjson::Value&    jso
 }
 
 /** @brief Convert a NotifyEVChargingNeedsConf to a JSON representation */
-bool NotifyEVChargingNeedsConfConverter::toJson(const NotifyEVChargingNeedsConf& data, rapidjson::Document& json)
+bool NotifyEVChargingNeedsConfConverter::toJson(const NotifyEVChargingNeedsConf&    data,
+                                                rapidjson::Value&                   json,
+                                                rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -138,23 +131,21 @@ bool NotifyEVChargingNeedsConfConverter::toJson(const NotifyEVChargingNeedsConf&
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::NotifyEVChargingNeedsStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::NotifyEVChargingNeedsStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
@@ -36,26 +36,23 @@ namespace ocpp20
 bool NotifyEVChargingScheduleReqConverter::fromJson(const rapidjson::Value&      json,
                                                     NotifyEVChargingScheduleReq& data,
                                                     std::string&                 error_code,
-                                                    std::string&                 error_message)
+                                                    std::string&                 error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // timeBase
     ret = ret && extract(json, "timeBase", data.timeBase, error_message);
 
     // chargingSchedule
     ocpp::types::ocpp20::ChargingScheduleTypeConverter chargingSchedule_converter;
-    ret = ret && chargingSchedule_converter.fromJson(json["chargingSchedule"], data.chargingSchedule, error_code, error_message);
+    ret = ret && extract(json, "chargingSchedule", data.chargingSchedule, chargingSchedule_converter, error_code, error_message);
 
     // evseId
-    extract(json, "evseId", data.evseId);
+    ret = ret && extract(json, "evseId", data.evseId, error_message);
 
     if (!ret)
     {
@@ -66,7 +63,9 @@ bool NotifyEVChargingScheduleReqConverter::fromJson(const rapidjson::Value&
 }
 
 /** @brief Convert a NotifyEVChargingScheduleReq to a JSON representation */
-bool NotifyEVChargingScheduleReqConverter::toJson(const NotifyEVChargingScheduleReq& data, rapidjson::Document& json)
+bool NotifyEVChargingScheduleReqConverter::toJson(const NotifyEVChargingScheduleReq&  data,
+                                                  rapidjson::Value&                   json,
+                                                  rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -74,24 +73,22 @@ bool NotifyEVChargingScheduleReqConverter::toJson(const NotifyEVChargingSchedule
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // timeBase
-    fill(json, "timeBase", data.timeBase);
+    fill(json, "timeBase", data.timeBase, allocator);
 
     // chargingSchedule
     ocpp::types::ocpp20::ChargingScheduleTypeConverter chargingSchedule_converter;
-    chargingSchedule_converter.setAllocator(allocator);
-    rapidjson::Document chargingSchedule_doc(rapidjson::kObjectType);
-    ret = ret && chargingSchedule_converter.toJson(data.chargingSchedule, chargingSchedule_doc);
-    json.AddMember(rapidjson::StringRef("chargingSchedule"), chargingSchedule_doc.Move(), *allocator);
+    rapidjson::Value                                   chargingSchedule_doc(rapidjson::kObjectType);
+    ret = ret && chargingSchedule_converter.toJson(data.chargingSchedule, chargingSchedule_doc, allocator);
+    json.AddMember(rapidjson::StringRef("chargingSchedule"), chargingSchedule_doc.Move(), allocator);
 
     // evseId
-    fill(json, "evseId", data.evseId);
+    fill(json, "evseId", data.evseId, allocator);
 
     return ret;
 }
@@ -100,26 +97,20 @@ bool NotifyEVChargingScheduleReqConverter::toJson(const NotifyEVChargingSchedule
 bool NotifyEVChargingScheduleConfConverter::fromJson(const rapidjson::Value&       json,
                                                      NotifyEVChargingScheduleConf& data,
                                                      std::string&                  error_code,
-                                                     std::string&                  error_message)
+                                                     std::string&                  error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::GenericStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::GenericStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -130,7 +121,9 @@ bool NotifyEVChargingScheduleConfConverter::fromJson(const rapidjson::Value&
 }
 
 /** @brief Convert a NotifyEVChargingScheduleConf to a JSON representation */
-bool NotifyEVChargingScheduleConfConverter::toJson(const NotifyEVChargingScheduleConf& data, rapidjson::Document& json)
+bool NotifyEVChargingScheduleConfConverter::toJson(const NotifyEVChargingScheduleConf& data,
+                                                   rapidjson::Value&                   json,
+                                                   rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -138,23 +131,21 @@ bool NotifyEVChargingScheduleConfConverter::toJson(const NotifyEVChargingSchedul
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::GenericStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::GenericStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
@@ -36,35 +36,32 @@ namespace ocpp20
 bool NotifyEventReqConverter::fromJson(const rapidjson::Value& json,
                                        NotifyEventReq&         data,
                                        std::string&            error_code,
-                                       std::string&            error_message)
+                                       std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // generatedAt
     ret = ret && extract(json, "generatedAt", data.generatedAt, error_message);
 
     // tbc
-    extract(json, "tbc", data.tbc);
+    ret = ret && extract(json, "tbc", data.tbc, error_message);
 
     // seqNo
-    extract(json, "seqNo", data.seqNo);
+    ret = ret && extract(json, "seqNo", data.seqNo, error_message);
 
     // eventData
-    if (json.HasMember("eventData"))
+    ret = ret && checkArray(json, "eventData", true, 1u, 0u, error_message);
+    if (ret && json.HasMember("eventData"))
     {
         const rapidjson::Value&                     eventData_json = json["eventData"];
         ocpp::types::ocpp20::EventDataTypeConverter eventData_converter;
         for (auto it = eventData_json.Begin(); ret && (it != eventData_json.End()); ++it)
         {
-            ocpp::types::ocpp20::EventDataType& item = data.eventData.emplace_back();
-            ret                                      = ret && eventData_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it, "eventData", data.eventData.emplace_back(), eventData_converter, error_code, error_message);
         }
     }
 
@@ -77,7 +74,9 @@ bool NotifyEventReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a NotifyEventReq to a JSON representation */
-bool NotifyEventReqConverter::toJson(const NotifyEventReq& data, rapidjson::Document& json)
+bool NotifyEventReqConverter::toJson(const NotifyEventReq&               data,
+                                     rapidjson::Value&                   json,
+                                     rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -85,33 +84,31 @@ bool NotifyEventReqConverter::toJson(const NotifyEventReq& data, rapidjson::Docu
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // generatedAt
-    fill(json, "generatedAt", data.generatedAt);
+    fill(json, "generatedAt", data.generatedAt, allocator);
 
     // tbc
-    fill(json, "tbc", data.tbc);
+    fill(json, "tbc", data.tbc, allocator);
 
     // seqNo
-    fill(json, "seqNo", data.seqNo);
+    fill(json, "seqNo", data.seqNo, allocator);
 
     // eventData
 
     rapidjson::Value                            eventData_json(rapidjson::kArrayType);
     ocpp::types::ocpp20::EventDataTypeConverter eventData_converter;
-    eventData_converter.setAllocator(allocator);
     for (const ocpp::types::ocpp20::EventDataType& item : data.eventData)
     {
-        rapidjson::Document item_doc(rapidjson::kObjectType);
-        ret = ret && eventData_converter.toJson(item, item_doc);
-        eventData_json.PushBack(item_doc.Move(), *allocator);
+        rapidjson::Value item_doc(rapidjson::kObjectType);
+        ret = ret && eventData_converter.toJson(item, item_doc, allocator);
+        eventData_json.PushBack(item_doc.Move(), allocator);
     }
-    json.AddMember(rapidjson::StringRef("eventData"), eventData_json.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("eventData"), eventData_json.Move(), allocator);
 
     return ret;
 }
@@ -120,16 +117,13 @@ bool NotifyEventReqConverter::toJson(const NotifyEventReq& data, rapidjson::Docu
 bool NotifyEventConfConverter::fromJson(const rapidjson::Value& json,
                                         NotifyEventConf&        data,
                                         std::string&            error_code,
-                                        std::string&            error_message)
+                                        std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -140,7 +134,9 @@ bool NotifyEventConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a NotifyEventConf to a JSON representation */
-bool NotifyEventConfConverter::toJson(const NotifyEventConf& data, rapidjson::Document& json)
+bool NotifyEventConfConverter::toJson(const NotifyEventConf&              data,
+                                      rapidjson::Value&                   json,
+                                      rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -148,10 +144,9 @@ bool NotifyEventConfConverter::toJson(const NotifyEventConf& data, rapidjson::Do
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     return ret;
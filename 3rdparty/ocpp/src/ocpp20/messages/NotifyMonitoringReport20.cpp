@@ -36,37 +36,34 @@ namespace ocpp20
 bool NotifyMonitoringReportReqConverter::fromJson(const rapidjson::Value&    json,
                                                   NotifyMonitoringReportReq& data,
                                                   std::string&               error_code,
-                                                  std::string&               error_message)
+                                                  std::string&               error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // monitor
-    if (json.HasMember("monitor"))
+    ret = ret && checkArray(json, "monitor", false, 1u, 0u, error_message);
+    if (ret && json.HasMember("monitor"))
     {
         const rapidjson::Value&                          monitor_json = json["monitor"];
         ocpp::types::ocpp20::MonitoringDataTypeConverter monitor_converter;
         for (auto it = monitor_json.Begin(); ret && (it != monitor_json.End()); ++it)
         {
-            ocpp::types::ocpp20::MonitoringDataType& item = data.monitor.emplace_back();
-            ret                                           = ret && monitor_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it, "monitor", data.monitor.emplace_back(), monitor_converter, error_code, error_message);
         }
     }
 
     // requestId
-    extract(json, "requestId", data.requestId);
+    ret = ret && extract(json, "requestId", data.requestId, error_message);
 
     // tbc
-    extract(json, "tbc", data.tbc);
+    ret = ret && extract(json, "tbc", data.tbc, error_message);
 
     // seqNo
-    extract(json, "seqNo", data.seqNo);
+    ret = ret && extract(json, "seqNo", data.seqNo, error_message);
 
     // generatedAt
     ret = ret && extract(json, "generatedAt", data.generatedAt, error_message);
@@ -80,7 +77,9 @@ bool NotifyMonitoringReportReqConverter::fromJson(const rapidjson::Value&    jso
 }
 
 /** @brief Convert a NotifyMonitoringReportReq to a JSON representation */
-bool NotifyMonitoringReportReqConverter::toJson(const NotifyMonitoringReportReq& data, rapidjson::Document& json)
+bool NotifyMonitoringReportReqConverter::toJson(const NotifyMonitoringReportReq&    data,
+                                                rapidjson::Value&                   json,
+                                                rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -88,10 +87,9 @@ bool NotifyMonitoringReportReqConverter::toJson(const NotifyMonitoringReportReq&
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // monitor
@@ -100,27 +98,26 @@ bool NotifyMonitoringReportReqConverter::toJson(const NotifyMonitoringReportReq&
 
         rapidjson::Value                                 monitor_json(rapidjson::kArrayType);
         ocpp::types::ocpp20::MonitoringDataTypeConverter monitor_converter;
-        monitor_converter.setAllocator(allocator);
         for (const ocpp::types::ocpp20::MonitoringDataType& item : data.monitor)
         {
-            rapidjson::Document item_doc(rapidjson::kObjectType);
-            ret = ret && monitor_converter.toJson(item, item_doc);
-            monitor_json.PushBack(item_doc.Move(), *allocator);
+            rapidjson::Value item_doc(rapidjson::kObjectType);
+            ret = ret && monitor_converter.toJson(item, item_doc, allocator);
+            monitor_json.PushBack(item_doc.Move(), allocator);
         }
-        json.AddMember(rapidjson::StringRef("monitor"), monitor_json.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("monitor"), monitor_json.Move(), allocator);
     }
 
     // requestId
-    fill(json, "requestId", data.requestId);
+    fill(json, "requestId", data.requestId, allocator);
 
     // tbc
-    fill(json, "tbc", data.tbc);
+    fill(json, "tbc", data.tbc, allocator);
 
     // seqNo
-    fill(json, "seqNo", data.seqNo);
+    fill(json, "seqNo", data.seqNo, allocator);
 
     // generatedAt
-    fill(json, "generatedAt", data.generatedAt);
+    fill(json, "generatedAt", data.generatedAt, allocator);
 
     return ret;
 }
@@ -129,16 +126,13 @@ bool NotifyMonitoringReportReqConverter::toJson(const NotifyMonitoringReportReq&
 bool NotifyMonitoringReportConfConverter::fromJson(const rapidjson::Value&     json,
                                                    NotifyMonitoringReportConf& data,
                                                    std::string&                error_code,
-                                                   std::string&                error_message)
+                                                   std::string&                error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -149,7 +143,9 @@ bool NotifyMonitoringReportConfConverter::fromJson(const rapidjson::Value&     j
 }
 
 /** @brief Convert a NotifyMonitoringReportConf to a JSON representation */
-bool NotifyMonitoringReportConfConverter::toJson(const NotifyMonitoringReportConf& data, rapidjson::Document& json)
+bool NotifyMonitoringReportConfConverter::toJson(const NotifyMonitoringReportConf&   data,
+                                                 rapidjson::Value&                   json,
+                                                 rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -157,10 +153,9 @@ bool NotifyMonitoringReportConfConverter::toJson(const NotifyMonitoringReportCon
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     return ret;
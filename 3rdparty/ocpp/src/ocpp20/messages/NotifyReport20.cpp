@@ -36,40 +36,37 @@ namespace ocpp20
 bool NotifyReportReqConverter::fromJson(const rapidjson::Value& json,
                                         NotifyReportReq&        data,
                                         std::string&            error_code,
-                                        std::string&            error_message)
+                                        std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // requestId
-    extract(json, "requestId", data.requestId);
+    ret = ret && extract(json, "requestId", data.requestId, error_message);
 
     // generatedAt
     ret = ret && extract(json, "generatedAt", data.generatedAt, error_message);
 
     // reportData
-    if (json.HasMember("reportData"))
+    ret = ret && checkArray(json, "reportData", false, 1u, 0u, error_message);
+    if (ret && json.HasMember("reportData"))
     {
         const rapidjson::Value&                      reportData_json = json["reportData"];
         ocpp::types::ocpp20::ReportDataTypeConverter reportData_converter;
         for (auto it = reportData_json.Begin(); ret && (it != reportData_json.End()); ++it)
         {
-            ocpp::types::ocpp20::ReportDataType& item = data.reportData.emplace_back();
-            ret                                       = ret && reportData_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it, "reportData", data.reportData.emplace_back(), reportData_converter, error_code, error_message);
         }
     }
 
     // tbc
-    extract(json, "tbc", data.tbc);
+    ret = ret && extract(json, "tbc", data.tbc, error_message);
 
     // seqNo
-    extract(json, "seqNo", data.seqNo);
+    ret = ret && extract(json, "seqNo", data.seqNo, error_message);
 
     if (!ret)
     {
@@ -80,7 +77,9 @@ bool NotifyReportReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a NotifyReportReq to a JSON representation */
-bool NotifyReportReqConverter::toJson(const NotifyReportReq& data, rapidjson::Document& json)
+bool NotifyReportReqConverter::toJson(const NotifyReportReq&              data,
+                                      rapidjson::Value&                   json,
+                                      rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -88,17 +87,16 @@ bool NotifyReportReqConverter::toJson(const NotifyReportReq& data, rapidjson::Do
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // requestId
-    fill(json, "requestId", data.requestId);
+    fill(json, "requestId", data.requestId, allocator);
 
     // generatedAt
-    fill(json, "generatedAt", data.generatedAt);
+    fill(json, "generatedAt", data.generatedAt, allocator);
 
     // reportData
     if (!data.reportData.empty())
@@ -106,21 +104,20 @@ bool NotifyReportReqConverter::toJson(const NotifyReportReq& data, rapidjson::Do
 
         rapidjson::Value                             reportData_json(rapidjson::kArrayType);
         ocpp::types::ocpp20::ReportDataTypeConverter reportData_converter;
-        reportData_converter.setAllocator(allocator);
         for (const ocpp::types::ocpp20::ReportDataType& item : data.reportData)
         {
-            rapidjson::Document item_doc(rapidjson::kObjectType);
-            ret = ret && reportData_converter.toJson(item, item_doc);
-            reportData_json.PushBack(item_doc.Move(), *allocator);
+            rapidjson::Value item_doc(rapidjson::kObjectType);
+            ret = ret && reportData_converter.toJson(item, item_doc, allocator);
+            reportData_json.PushBack(item_doc.Move(), allocator);
         }
-        json.AddMember(rapidjson::StringRef("reportData"), reportData_json.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("reportData"), reportData_json.Move(), allocator);
     }
 
     // tbc
-    fill(json, "tbc", data.tbc);
+    fill(json, "tbc", data.tbc, allocator);
 
     // seqNo
-    fill(json, "seqNo", data.seqNo);
+    fill(json, "seqNo", data.seqNo, allocator);
 
     return ret;
 }
@@ -129,16 +126,13 @@ bool NotifyReportReqConverter::toJson(const NotifyReportReq& data, rapidjson::Do
 bool NotifyReportConfConverter::fromJson(const rapidjson::Value& json,
                                          NotifyReportConf&       data,
                                          std::string&            error_code,
-                                         std::string&            error_message)
+                                         std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -149,7 +143,9 @@ bool NotifyReportConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a NotifyReportConf to a JSON representation */
-bool NotifyReportConfConverter::toJson(const NotifyReportConf& data, rapidjson::Document& json)
+bool NotifyReportConfConverter::toJson(const NotifyReportConf&             data,
+                                       rapidjson::Value&                   json,
+                                       rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -157,10 +153,9 @@ bool NotifyReportConfConverter::toJson(const NotifyReportConf& data, rapidjson::
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     return ret;
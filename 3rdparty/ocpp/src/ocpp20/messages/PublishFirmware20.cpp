@@ -36,31 +36,28 @@ namespace ocpp20
 bool PublishFirmwareReqConverter::fromJson(const rapidjson::Value& json,
                                            PublishFirmwareReq&     data,
                                            std::string&            error_code,
-                                           std::string&            error_message)
+                                           std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // location
-    extract(json, "location", data.location);
+    ret = ret && extract(json, "location", data.location, error_message);
 
     // retries
-    extract(json, "retries", data.retries);
+    ret = ret && extract(json, "retries", data.retries, error_message);
 
     // checksum
-    extract(json, "checksum", data.checksum);
+    ret = ret && extract(json, "checksum", data.checksum, error_message);
 
     // requestId
-    extract(json, "requestId", data.requestId);
+    ret = ret && extract(json, "requestId", data.requestId, error_message);
 
     // retryInterval
-    extract(json, "retryInterval", data.retryInterval);
+    ret = ret && extract(json, "retryInterval", data.retryInterval, error_message);
 
     if (!ret)
     {
@@ -71,7 +68,9 @@ bool PublishFirmwareReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a PublishFirmwareReq to a JSON representation */
-bool PublishFirmwareReqConverter::toJson(const PublishFirmwareReq& data, rapidjson::Document& json)
+bool PublishFirmwareReqConverter::toJson(const PublishFirmwareReq&           data,
+                                         rapidjson::Value&                   json,
+                                         rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -79,26 +78,25 @@ bool PublishFirmwareReqConverter::toJson(const PublishFirmwareReq& data, rapidjs
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // location
-    fill(json, "location", data.location);
+    fill(json, "location", data.location, allocator);
 
     // retries
-    fill(json, "retries", data.retries);
+    fill(json, "retries", data.retries, allocator);
 
     // checksum
-    fill(json, "checksum", data.checksum);
+    fill(json, "checksum", data.checksum, allocator);
 
     // requestId
-    fill(json, "requestId", data.requestId);
+    fill(json, "requestId", data.requestId, allocator);
 
     // retryInterval
-    fill(json, "retryInterval", data.retryInterval);
+    fill(json, "retryInterval", data.retryInterval, allocator);
 
     return ret;
 }
@@ -107,26 +105,20 @@ bool PublishFirmwareReqConverter::toJson(const PublishFirmwareReq& data, rapidjs
 bool PublishFirmwareConfConverter::fromJson(const rapidjson::Value& json,
                                             PublishFirmwareConf&    data,
                                             std::string&            error_code,
-                                            std::string&            error_message)
+                                            std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::GenericStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::GenericStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -137,7 +129,9 @@ bool PublishFirmwareConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a PublishFirmwareConf to a JSON representation */
-bool PublishFirmwareConfConverter::toJson(const PublishFirmwareConf& data, rapidjson::Document& json)
+bool PublishFirmwareConfConverter::toJson(const PublishFirmwareConf&          data,
+                                          rapidjson::Value&                   json,
+                                          rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -145,23 +139,21 @@ bool PublishFirmwareConfConverter::toJson(const PublishFirmwareConf& data, rapid
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::GenericStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::GenericStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
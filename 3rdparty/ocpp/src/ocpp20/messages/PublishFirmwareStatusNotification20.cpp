@@ -36,33 +36,30 @@ namespace ocpp20
 bool PublishFirmwareStatusNotificationReqConverter::fromJson(const rapidjson::Value&               json,
                                                              PublishFirmwareStatusNotificationReq& data,
                                                              std::string&                          error_code,
-                                                             std::string&                          error_message)
+                                                             std::string&                          error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::PublishFirmwareStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::PublishFirmwareStatusEnumTypeHelper, error_message);
 
     // location
-    if (json.HasMember("location"))
+    ret = ret && checkArray(json, "location", false, 1u, 0u, error_message);
+    if (ret && json.HasMember("location"))
     {
         const rapidjson::Value& location_json = json["location"];
         for (auto it = location_json.Begin(); ret && (it != location_json.End()); ++it)
         {
-            std::string& item = data.location.emplace_back();
-            item              = it->GetString();
+            ret = convert(*it, "location", data.location.emplace_back(), error_message);
         }
     }
 
     // requestId
-    extract(json, "requestId", data.requestId);
+    ret = ret && extract(json, "requestId", data.requestId, error_message);
 
     if (!ret)
     {
@@ -73,7 +70,9 @@ bool PublishFirmwareStatusNotificationReqConverter::fromJson(const rapidjson::Va
 }
 
 /** @brief Convert a PublishFirmwareStatusNotificationReq to a JSON representation */
-bool PublishFirmwareStatusNotificationReqConverter::toJson(const PublishFirmwareStatusNotificationReq& data, rapidjson::Document& json)
+bool PublishFirmwareStatusNotificationReqConverter::toJson(const PublishFirmwareStatusNotificationReq& data,
+                                                           rapidjson::Value&                           json,
+                                                           rapidjson::Document::AllocatorType&         allocator) const
 {
     bool ret = true;
 
@@ -81,14 +80,13 @@ bool PublishFirmwareStatusNotificationReqConverter::toJson(const PublishFirmware
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::PublishFirmwareStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::PublishFirmwareStatusEnumTypeHelper.toString(data.status), allocator);
 
     // location
     if (!data.location.empty())
@@ -97,13 +95,13 @@ bool PublishFirmwareStatusNotificationReqConverter::toJson(const PublishFirmware
         rapidjson::Value location_json(rapidjson::kArrayType);
         for (const std::string& item : data.location)
         {
-            location_json.PushBack(rapidjson::Value(item.c_str(), *allocator).Move(), *allocator);
+            location_json.PushBack(rapidjson::Value(item.c_str(), allocator).Move(), allocator);
         }
-        json.AddMember(rapidjson::StringRef("location"), location_json.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("location"), location_json.Move(), allocator);
     }
 
     // requestId
-    fill(json, "requestId", data.requestId);
+    fill(json, "requestId", data.requestId, allocator);
 
     return ret;
 }
@@ -112,16 +110,13 @@ bool PublishFirmwareStatusNotificationReqConverter::toJson(const PublishFirmware
 bool PublishFirmwareStatusNotificationConfConverter::fromJson(const rapidjson::Value&                json,
                                                               PublishFirmwareStatusNotificationConf& data,
                                                               std::string&                           error_code,
-                                                              std::string&                           error_message)
+                                                              std::string&                           error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -132,7 +127,9 @@ bool PublishFirmwareStatusNotificationConfConverter::fromJson(const rapidjson::V
 }
 
 /** @brief Convert a PublishFirmwareStatusNotificationConf to a JSON representation */
-bool PublishFirmwareStatusNotificationConfConverter::toJson(const PublishFirmwareStatusNotificationConf& data, rapidjson::Document& json)
+bool PublishFirmwareStatusNotificationConfConverter::toJson(const PublishFirmwareStatusNotificationConf& data,
+                                                            rapidjson::Value&                            json,
+                                                            rapidjson::Document::AllocatorType&          allocator) const
 {
     bool ret = true;
 
@@ -140,10 +137,9 @@ bool PublishFirmwareStatusNotificationConfConverter::toJson(const PublishFirmwar
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     return ret;
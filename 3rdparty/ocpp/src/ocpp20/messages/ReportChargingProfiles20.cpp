@@ -36,40 +36,46 @@ namespace ocpp20
 bool ReportChargingProfilesReqConverter::fromJson(const rapidjson::Value&    json,
                                                   ReportChargingProfilesReq& data,
                                                   std::string&               error_code,
-                                                  std::string&               error_message)
+                                                  std::string&               error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // requestId
-    extract(json, "requestId", data.requestId);
+    ret = ret && extract(json, "requestId", data.requestId, error_message);
 
     // chargingLimitSource
-    data.chargingLimitSource = ocpp::types::ocpp20::ChargingLimitSourceEnumTypeHelper.fromString(json["chargingLimitSource"].GetString());
+    ret = ret && extract(json,
+                         "chargingLimitSource",
+                         data.chargingLimitSource,
+                         ocpp::types::ocpp20::ChargingLimitSourceEnumTypeHelper,
+                         error_message);
 
     // chargingProfile
-    if (json.HasMember("chargingProfile"))
+    ret = ret && checkArray(json, "chargingProfile", true, 1u, 0u, error_message);
+    if (ret && json.HasMember("chargingProfile"))
     {
         const rapidjson::Value&                           chargingProfile_json = json["chargingProfile"];
         ocpp::types::ocpp20::ChargingProfileTypeConverter chargingProfile_converter;
         for (auto it = chargingProfile_json.Begin(); ret && (it != chargingProfile_json.End()); ++it)
         {
-            ocpp::types::ocpp20::ChargingProfileType& item = data.chargingProfile.emplace_back();
-            ret = ret && chargingProfile_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it,
+                          "chargingProfile",
+                          data.chargingProfile.emplace_back(),
+                          chargingProfile_converter,
+                          error_code,
+                          error_message);
         }
     }
 
     // tbc
-    extract(json, "tbc", data.tbc);
+    ret = ret && extract(json, "tbc", data.tbc, error_message);
 
     // evseId
-    extract(json, "evseId", data.evseId);
+    ret = ret && extract(json, "evseId", data.evseId, error_message);
 
     if (!ret)
     {
@@ -80,7 +86,9 @@ bool ReportChargingProfilesReqConverter::fromJson(const rapidjson::Value&    jso
 }
 
 /** @brief Convert a ReportChargingProfilesReq to a JSON representation */
-bool ReportChargingProfilesReqConverter::toJson(const ReportChargingProfilesReq& data, rapidjson::Document& json)
+bool ReportChargingProfilesReqConverter::toJson(const ReportChargingProfilesReq&    data,
+                                                rapidjson::Value&                   json,
+                                                rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -88,36 +96,34 @@ bool ReportChargingProfilesReqConverter::toJson(const ReportChargingProfilesReq&
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // requestId
-    fill(json, "requestId", data.requestId);
+    fill(json, "requestId", data.requestId, allocator);
 
     // chargingLimitSource
-    fill(json, "chargingLimitSource", ocpp::types::ocpp20::ChargingLimitSourceEnumTypeHelper.toString(data.chargingLimitSource));
+    fill(json, "chargingLimitSource", ocpp::types::ocpp20::ChargingLimitSourceEnumTypeHelper.toString(data.chargingLimitSource), allocator);
 
     // chargingProfile
 
     rapidjson::Value                                  chargingProfile_json(rapidjson::kArrayType);
     ocpp::types::ocpp20::ChargingProfileTypeConverter chargingProfile_converter;
-    chargingProfile_converter.setAllocator(allocator);
     for (const ocpp::types::ocpp20::ChargingProfileType& item : data.chargingProfile)
     {
-        rapidjson::Document item_doc(rapidjson::kObjectType);
-        ret = ret && chargingProfile_converter.toJson(item, item_doc);
-        chargingProfile_json.PushBack(item_doc.Move(), *allocator);
+        rapidjson::Value item_doc(rapidjson::kObjectType);
+        ret = ret && chargingProfile_converter.toJson(item, item_doc, allocator);
+        chargingProfile_json.PushBack(item_doc.Move(), allocator);
     }
-    json.AddMember(rapidjson::StringRef("chargingProfile"), chargingProfile_json.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("chargingProfile"), chargingProfile_json.Move(), allocator);
 
     // tbc
-    fill(json, "tbc", data.tbc);
+    fill(json, "tbc", data.tbc, allocator);
 
     // evseId
-    fill(json, "evseId", data.evseId);
+    fill(json, "evseId", data.evseId, allocator);
 
     return ret;
 }
@@ -126,16 +132,13 @@ bool ReportChargingProfilesReqConverter::toJson(const ReportChargingProfilesReq&
 bool ReportChargingProfilesConfConverter::fromJson(const rapidjson::Value&     json,
                                                    ReportChargingProfilesConf& data,
                                                    std::string&                error_code,
-                                                   std::string&                error_message)
+                                                   std::string&                error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -146,7 +149,9 @@ bool ReportChargingProfilesConfConverter::fromJson(const rapidjson::Value&     j
 }
 
 /** @brief Convert a ReportChargingProfilesConf to a JSON representation */
-bool ReportChargingProfilesConfConverter::toJson(const ReportChargingProfilesConf& data, rapidjson::Document& json)
+bool ReportChargingProfilesConfConverter::toJson(const ReportChargingProfilesConf&   data,
+                                                 rapidjson::Value&                   json,
+                                                 rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -154,10 +159,9 @@ bool ReportChargingProfilesConfConverter::toJson(const ReportChargingProfilesCon
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     return ret;
@@ -36,40 +36,31 @@ namespace ocpp20
 bool RequestStartTransactionReqConverter::fromJson(const rapidjson::Value&     json,
                                                    RequestStartTransactionReq& data,
                                                    std::string&                error_code,
-                                                   std::string&                error_message)
+                                                   std::string&                error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // evseId
-    extract(json, "evseId", data.evseId);
+    ret = ret && extract(json, "evseId", data.evseId, error_message);
 
     // groupIdToken
-    if (json.HasMember("groupIdToken"))
-    {
-        ocpp::types::ocpp20::IdTokenTypeConverter groupIdToken_converter;
-        ret = ret && groupIdToken_converter.fromJson(json["groupIdToken"], data.groupIdToken, error_code, error_message);
-    }
+    ocpp::types::ocpp20::IdTokenTypeConverter groupIdToken_converter;
+    ret = ret && extract(json, "groupIdToken", data.groupIdToken, groupIdToken_converter, error_code, error_message);
 
     // idToken
     ocpp::types::ocpp20::IdTokenTypeConverter idToken_converter;
-    ret = ret && idToken_converter.fromJson(json["idToken"], data.idToken, error_code, error_message);
+    ret = ret && extract(json, "idToken", data.idToken, idToken_converter, error_code, error_message);
 
     // remoteStartId
-    extract(json, "remoteStartId", data.remoteStartId);
+    ret = ret && extract(json, "remoteStartId", data.remoteStartId, error_message);
 
     // chargingProfile
-    if (json.HasMember("chargingProfile"))
-    {
-        ocpp::types::ocpp20::ChargingProfileTypeConverter chargingProfile_converter;
-        ret = ret && chargingProfile_converter.fromJson(json["chargingProfile"], data.chargingProfile, error_code, error_message);
-    }
+    ocpp::types::ocpp20::ChargingProfileTypeConverter chargingProfile_converter;
+    ret = ret && extract(json, "chargingProfile", data.chargingProfile, chargingProfile_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -80,7 +71,9 @@ bool RequestStartTransactionReqConverter::fromJson(const rapidjson::Value&     j
 }
 
 /** @brief Convert a RequestStartTransactionReq to a JSON representation */
-bool RequestStartTransactionReqConverter::toJson(const RequestStartTransactionReq& data, rapidjson::Document& json)
+bool RequestStartTransactionReqConverter::toJson(const RequestStartTransactionReq&   data,
+                                                 rapidjson::Value&                   json,
+                                                 rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -88,43 +81,39 @@ bool RequestStartTransactionReqConverter::toJson(const RequestStartTransactionRe
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // evseId
-    fill(json, "evseId", data.evseId);
+    fill(json, "evseId", data.evseId, allocator);
 
     // groupIdToken
     if (data.groupIdToken.isSet())
     {
         ocpp::types::ocpp20::IdTokenTypeConverter groupIdToken_converter;
-        groupIdToken_converter.setAllocator(allocator);
-        rapidjson::Document groupIdToken_doc(rapidjson::kObjectType);
-        ret = ret && groupIdToken_converter.toJson(data.groupIdToken, groupIdToken_doc);
-        json.AddMember(rapidjson::StringRef("groupIdToken"), groupIdToken_doc.Move(), *allocator);
+        rapidjson::Value                          groupIdToken_doc(rapidjson::kObjectType);
+        ret = ret && groupIdToken_converter.toJson(data.groupIdToken, groupIdToken_doc, allocator);
+        json.AddMember(rapidjson::StringRef("groupIdToken"), groupIdToken_doc.Move(), allocator);
     }
 
     // idToken
     ocpp::types::ocpp20::IdTokenTypeConverter idToken_converter;
-    idToken_converter.setAllocator(allocator);
-    rapidjson::Document idToken_doc(rapidjson::kObjectType);
-    ret = ret && idToken_converter.toJson(data.idToken, idToken_doc);
-    json.AddMember(rapidjson::StringRef("idToken"), idToken_doc.Move(), *allocator);
+    rapidjson::Value                          idToken_doc(rapidjson::kObjectType);
+    ret = ret && idToken_converter.toJson(data.idToken, idToken_doc, allocator);
+    json.AddMember(rapidjson::StringRef("idToken"), idToken_doc.Move(), allocator);
 
     // remoteStartId
-    fill(json, "remoteStartId", data.remoteStartId);
+    fill(json, "remoteStartId", data.remoteStartId, allocator);
 
     // chargingProfile
     if (data.chargingProfile.isSet())
     {
         ocpp::types::ocpp20::ChargingProfileTypeConverter chargingProfile_converter;
-        chargingProfile_converter.setAllocator(allocator);
-        rapidjson::Document chargingProfile_doc(rapidjson::kObjectType);
-        ret = ret && chargingProfile_converter.toJson(data.chargingProfile, chargingProfile_doc);
-        json.AddMember(rapidjson::StringRef("chargingProfile"), chargingProfile_doc.Move(), *allocator);
+        rapidjson::Value                                  chargingProfile_doc(rapidjson::kObjectType);
+        ret = ret && chargingProfile_converter.toJson(data.chargingProfile, chargingProfile_doc, allocator);
+        json.AddMember(rapidjson::StringRef("chargingProfile"), chargingProfile_doc.Move(), allocator);
     }
 
     return ret;
@@ -134,29 +123,23 @@ bool RequestStartTransactionReqConverter::toJson(const RequestStartTransactionRe
 bool RequestStartTransactionConfConverter::fromJson(const rapidjson::Value&      json,
                                                     RequestStartTransactionConf& data,
                                                     std::string&                 error_code,
-                                                    std::string&                 error_message)
+                                                    std::string&                 error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::RequestStartStopStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::RequestStartStopStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     // transactionId
-    extract(json, "transactionId", data.transactionId);
+    ret = ret && extract(json, "transactionId", data.transactionId, error_message);
 
     if (!ret)
     {
@@ -167,7 +150,9 @@ bool RequestStartTransactionConfConverter::fromJson(const rapidjson::Value&
 }
 
 /** @brief Convert a RequestStartTransactionConf to a JSON representation */
-bool RequestStartTransactionConfConverter::toJson(const RequestStartTransactionConf& data, rapidjson::Document& json)
+bool RequestStartTransactionConfConverter::toJson(const RequestStartTransactionConf&  data,
+                                                  rapidjson::Value&                   json,
+                                                  rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -175,27 +160,25 @@ bool RequestStartTransactionConfConverter::toJson(const RequestStartTransactionC
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::RequestStartStopStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::RequestStartStopStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     // transactionId
-    fill(json, "transactionId", data.transactionId);
+    fill(json, "transactionId", data.transactionId, allocator);
 
     return ret;
 }
@@ -36,23 +36,23 @@ namespace ocpp20
 bool ReservationStatusUpdateReqConverter::fromJson(const rapidjson::Value&     json,
                                                    ReservationStatusUpdateReq& data,
                                                    std::string&                error_code,
-                                                   std::string&                error_message)
+                                                   std::string&                error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // reservationId
-    extract(json, "reservationId", data.reservationId);
+    ret = ret && extract(json, "reservationId", data.reservationId, error_message);
 
     // reservationUpdateStatus
-    data.reservationUpdateStatus =
-        ocpp::types::ocpp20::ReservationUpdateStatusEnumTypeHelper.fromString(json["reservationUpdateStatus"].GetString());
+    ret = ret && extract(json,
+                         "reservationUpdateStatus",
+                         data.reservationUpdateStatus,
+                         ocpp::types::ocpp20::ReservationUpdateStatusEnumTypeHelper,
+                         error_message);
 
     if (!ret)
     {
@@ -63,7 +63,9 @@ bool ReservationStatusUpdateReqConverter::fromJson(const rapidjson::Value&     j
 }
 
 /** @brief Convert a ReservationStatusUpdateReq to a JSON representation */
-bool ReservationStatusUpdateReqConverter::toJson(const ReservationStatusUpdateReq& data, rapidjson::Document& json)
+bool ReservationStatusUpdateReqConverter::toJson(const ReservationStatusUpdateReq&   data,
+                                                 rapidjson::Value&                   json,
+                                                 rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -71,18 +73,19 @@ bool ReservationStatusUpdateReqConverter::toJson(const ReservationStatusUpdateRe
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // reservationId
-    fill(json, "reservationId", data.reservationId);
+    fill(json, "reservationId", data.reservationId, allocator);
 
     // reservationUpdateStatus
-    fill(
-        json, "reservationUpdateStatus", ocpp::types::ocpp20::ReservationUpdateStatusEnumTypeHelper.toString(data.reservationUpdateStatus));
+    fill(json,
+         "reservationUpdateStatus",
+         ocpp::types::ocpp20::ReservationUpdateStatusEnumTypeHelper.toString(data.reservationUpdateStatus),
+         allocator);
 
     return ret;
 }
@@ -91,16 +94,13 @@ bool ReservationStatusUpdateReqConverter::toJson(const ReservationStatusUpdateRe
 bool ReservationStatusUpdateConfConverter::fromJson(const rapidjson::Value&      json,
                                                     ReservationStatusUpdateConf& data,
                                                     std::string&                 error_code,
-                                                    std::string&                 error_message)
+                                                    std::string&                 error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -111,7 +111,9 @@ bool ReservationStatusUpdateConfConverter::fromJson(const rapidjson::Value&
 }
 
 /** @brief Convert a ReservationStatusUpdateConf to a JSON representation */
-bool ReservationStatusUpdateConfConverter::toJson(const ReservationStatusUpdateConf& data, rapidjson::Document& json)
+bool ReservationStatusUpdateConfConverter::toJson(const ReservationStatusUpdateConf&  data,
+                                                  rapidjson::Value&                   json,
+                                                  rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -119,10 +121,9 @@ bool ReservationStatusUpdateConfConverter::toJson(const ReservationStatusUpdateC
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     return ret;
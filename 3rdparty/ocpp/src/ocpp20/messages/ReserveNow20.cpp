@@ -36,42 +36,33 @@ namespace ocpp20
 bool ReserveNowReqConverter::fromJson(const rapidjson::Value& json,
                                       ReserveNowReq&          data,
                                       std::string&            error_code,
-                                      std::string&            error_message)
+                                      std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // id
-    extract(json, "id", data.id);
+    ret = ret && extract(json, "id", data.id, error_message);
 
     // expiryDateTime
     ret = ret && extract(json, "expiryDateTime", data.expiryDateTime, error_message);
 
     // connectorType
-    if (json.HasMember("connectorType"))
-    {
-        data.connectorType = ocpp::types::ocpp20::ConnectorEnumTypeHelper.fromString(json["connectorType"].GetString());
-    }
+    ret = ret && extract(json, "connectorType", data.connectorType, ocpp::types::ocpp20::ConnectorEnumTypeHelper, error_message);
 
     // idToken
     ocpp::types::ocpp20::IdTokenTypeConverter idToken_converter;
-    ret = ret && idToken_converter.fromJson(json["idToken"], data.idToken, error_code, error_message);
+    ret = ret && extract(json, "idToken", data.idToken, idToken_converter, error_code, error_message);
 
     // evseId
-    extract(json, "evseId", data.evseId);
+    ret = ret && extract(json, "evseId", data.evseId, error_message);
 
     // groupIdToken
-    if (json.HasMember("groupIdToken"))
-    {
-        ocpp::types::ocpp20::IdTokenTypeConverter groupIdToken_converter;
-        ret = ret && groupIdToken_converter.fromJson(json["groupIdToken"], data.groupIdToken, error_code, error_message);
-    }
+    ocpp::types::ocpp20::IdTokenTypeConverter groupIdToken_converter;
+    ret = ret && extract(json, "groupIdToken", data.groupIdToken, groupIdToken_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -82,7 +73,7 @@ bool ReserveNowReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a ReserveNowReq to a JSON representation */
-bool ReserveNowReqConverter::toJson(const ReserveNowReq& data, rapidjson::Document& json)
+bool ReserveNowReqConverter::toJson(const ReserveNowReq& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -90,42 +81,39 @@ bool ReserveNowReqConverter::toJson(const ReserveNowReq& data, rapidjson::Docume
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // id
-    fill(json, "id", data.id);
+    fill(json, "id", data.id, allocator);
 
     // expiryDateTime
-    fill(json, "expiryDateTime", data.expiryDateTime);
+    fill(json, "expiryDateTime", data.expiryDateTime, allocator);
 
     // connectorType
     if (data.connectorType.isSet())
     {
-        fill(json, "connectorType", ocpp::types::ocpp20::ConnectorEnumTypeHelper.toString(data.connectorType));
+        fill(json, "connectorType", ocpp::types::ocpp20::ConnectorEnumTypeHelper.toString(data.connectorType), allocator);
     }
 
     // idToken
     ocpp::types::ocpp20::IdTokenTypeConverter idToken_converter;
-    idToken_converter.setAllocator(allocator);
-    rapidjson::Document idToken_doc(rapidjson::kObjectType);
-    ret = ret && idToken_converter.toJson(data.idToken, idToken_doc);
-    json.AddMember(rapidjson::StringRef("idToken"), idToken_doc.Move(), *allocator);
+    rapidjson::Value                          idToken_doc(rapidjson::kObjectType);
+    ret = ret && idToken_converter.toJson(data.idToken, idToken_doc, allocator);
+    json.AddMember(rapidjson::StringRef("idToken"), idToken_doc.Move(), allocator);
 
     // evseId
-    fill(json, "evseId", data.evseId);
+    fill(json, "evseId", data.evseId, allocator);
 
     // groupIdToken
     if (data.groupIdToken.isSet())
     {
         ocpp::types::ocpp20::IdTokenTypeConverter groupIdToken_converter;
-        groupIdToken_converter.setAllocator(allocator);
-        rapidjson::Document groupIdToken_doc(rapidjson::kObjectType);
-        ret = ret && groupIdToken_converter.toJson(data.groupIdToken, groupIdToken_doc);
-        json.AddMember(rapidjson::StringRef("groupIdToken"), groupIdToken_doc.Move(), *allocator);
+        rapidjson::Value                          groupIdToken_doc(rapidjson::kObjectType);
+        ret = ret && groupIdToken_converter.toJson(data.groupIdToken, groupIdToken_doc, allocator);
+        json.AddMember(rapidjson::StringRef("groupIdToken"), groupIdToken_doc.Move(), allocator);
     }
 
     return ret;
@@ -135,26 +123,20 @@ bool ReserveNowReqConverter::toJson(const ReserveNowReq& data, rapidjson::Docume
 bool ReserveNowConfConverter::fromJson(const rapidjson::Value& json,
                                        ReserveNowConf&         data,
                                        std::string&            error_code,
-                                       std::string&            error_message)
+                                       std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::ReserveNowStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::ReserveNowStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -165,7 +147,9 @@ bool ReserveNowConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a ReserveNowConf to a JSON representation */
-bool ReserveNowConfConverter::toJson(const ReserveNowConf& data, rapidjson::Document& json)
+bool ReserveNowConfConverter::toJson(const ReserveNowConf&               data,
+                                     rapidjson::Value&                   json,
+                                     rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -173,23 +157,21 @@ bool ReserveNowConfConverter::toJson(const ReserveNowConf& data, rapidjson::Docu
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::ReserveNowStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::ReserveNowStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
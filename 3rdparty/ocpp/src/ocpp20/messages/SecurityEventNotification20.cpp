@@ -36,25 +36,22 @@ namespace ocpp20
 bool SecurityEventNotificationReqConverter::fromJson(const rapidjson::Value&       json,
                                                      SecurityEventNotificationReq& data,
                                                      std::string&                  error_code,
-                                                     std::string&                  error_message)
+                                                     std::string&                  error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // type
-    extract(json, "type", data.type);
+    ret = ret && extract(json, "type", data.type, error_message);
 
     // timestamp
     ret = ret && extract(json, "timestamp", data.timestamp, error_message);
 
     // techInfo
-    extract(json, "techInfo", data.techInfo);
+    ret = ret && extract(json, "techInfo", data.techInfo, error_message);
 
     if (!ret)
     {
@@ -65,7 +62,9 @@ bool SecurityEventNotificationReqConverter::fromJson(const rapidjson::Value&
 }
 
 /** @brief Convert a SecurityEventNotificationReq to a JSON representation */
-bool SecurityEventNotificationReqConverter::toJson(const SecurityEventNotificationReq& data, rapidjson::Document& json)
+bool SecurityEventNotificationReqConverter::toJson(const SecurityEventNotificationReq& data,
+                                                   rapidjson::Value&                   json,
+                                                   rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -73,20 +72,19 @@ bool SecurityEventNotificationReqConverter::toJson(const SecurityEventNotificati
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // type
-    fill(json, "type", data.type);
+    fill(json, "type", data.type, allocator);
 
     // timestamp
-    fill(json, "timestamp", data.timestamp);
+    fill(json, "timestamp", data.timestamp, allocator);
 
     // techInfo
-    fill(json, "techInfo", data.techInfo);
+    fill(json, "techInfo", data.techInfo, allocator);
 
     return ret;
 }
@@ -95,16 +93,13 @@ bool SecurityEventNotificationReqConverter::toJson(const SecurityEventNotificati
 bool SecurityEventNotificationConfConverter::fromJson(const rapidjson::Value&        json,
                                                       SecurityEventNotificationConf& data,
                                                       std::string&                   error_code,
-                                                      std::string&                   error_message)
+                                                      std::string&                   error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -115,7 +110,9 @@ bool SecurityEventNotificationConfConverter::fromJson(const rapidjson::Value&
 }
 
 /** @brief Convert a SecurityEventNotificationConf to a JSON representation */
-bool SecurityEventNotificationConfConverter::toJson(const SecurityEventNotificationConf& data, rapidjson::Document& json)
+bool SecurityEventNotificationConfConverter::toJson(const SecurityEventNotificationConf& data,
+                                                    rapidjson::Value&                    json,
+                                                    rapidjson::Document::AllocatorType&  allocator) const
 {
     bool ret = true;
 
@@ -123,10 +120,9 @@ bool SecurityEventNotificationConfConverter::toJson(const SecurityEventNotificat
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     return ret;
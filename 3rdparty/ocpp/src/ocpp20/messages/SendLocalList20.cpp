@@ -36,34 +36,36 @@ namespace ocpp20
 bool SendLocalListReqConverter::fromJson(const rapidjson::Value& json,
                                          SendLocalListReq&       data,
                                          std::string&            error_code,
-                                         std::string&            error_message)
+                                         std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // localAuthorizationList
-    if (json.HasMember("localAuthorizationList"))
+    ret = ret && checkArray(json, "localAuthorizationList", false, 1u, 0u, error_message);
+    if (ret && json.HasMember("localAuthorizationList"))
     {
         const rapidjson::Value&                         localAuthorizationList_json = json["localAuthorizationList"];
         ocpp::types::ocpp20::AuthorizationDataConverter localAuthorizationList_converter;
         for (auto it = localAuthorizationList_json.Begin(); ret && (it != localAuthorizationList_json.End()); ++it)
         {
-            ocpp::types::ocpp20::AuthorizationData& item = data.localAuthorizationList.emplace_back();
-            ret = ret && localAuthorizationList_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it,
+                          "localAuthorizationList",
+                          data.localAuthorizationList.emplace_back(),
+                          localAuthorizationList_converter,
+                          error_code,
+                          error_message);
         }
     }
 
     // versionNumber
-    extract(json, "versionNumber", data.versionNumber);
+    ret = ret && extract(json, "versionNumber", data.versionNumber, error_message);
 
     // updateType
-    data.updateType = ocpp::types::ocpp20::UpdateEnumTypeHelper.fromString(json["updateType"].GetString());
+    ret = ret && extract(json, "updateType", data.updateType, ocpp::types::ocpp20::UpdateEnumTypeHelper, error_message);
 
     if (!ret)
     {
@@ -74,7 +76,9 @@ bool SendLocalListReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a SendLocalListReq to a JSON representation */
-bool SendLocalListReqConverter::toJson(const SendLocalListReq& data, rapidjson::Document& json)
+bool SendLocalListReqConverter::toJson(const SendLocalListReq&             data,
+                                       rapidjson::Value&                   json,
+                                       rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -82,10 +86,9 @@ bool SendLocalListReqConverter::toJson(const SendLocalListReq& data, rapidjson::
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // localAuthorizationList
@@ -94,21 +97,20 @@ bool SendLocalListReqConverter::toJson(const SendLocalListReq& data, rapidjson::
 
         rapidjson::Value                                localAuthorizationList_json(rapidjson::kArrayType);
         ocpp::types::ocpp20::AuthorizationDataConverter localAuthorizationList_converter;
-        localAuthorizationList_converter.setAllocator(allocator);
         for (const ocpp::types::ocpp20::AuthorizationData& item : data.localAuthorizationList)
         {
-            rapidjson::Document item_doc(rapidjson::kObjectType);
-            ret = ret && localAuthorizationList_converter.toJson(item, item_doc);
-            localAuthorizationList_json.PushBack(item_doc.Move(), *allocator);
+            rapidjson::Value item_doc(rapidjson::kObjectType);
+            ret = ret && localAuthorizationList_converter.toJson(item, item_doc, allocator);
+            localAuthorizationList_json.PushBack(item_doc.Move(), allocator);
         }
-        json.AddMember(rapidjson::StringRef("localAuthorizationList"), localAuthorizationList_json.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("localAuthorizationList"), localAuthorizationList_json.Move(), allocator);
     }
 
     // versionNumber
-    fill(json, "versionNumber", data.versionNumber);
+    fill(json, "versionNumber", data.versionNumber, allocator);
 
     // updateType
-    fill(json, "updateType", ocpp::types::ocpp20::UpdateEnumTypeHelper.toString(data.updateType));
+    fill(json, "updateType", ocpp::types::ocpp20::UpdateEnumTypeHelper.toString(data.updateType), allocator);
 
     return ret;
 }
@@ -117,26 +119,20 @@ bool SendLocalListReqConverter::toJson(const SendLocalListReq& data, rapidjson::
 bool SendLocalListConfConverter::fromJson(const rapidjson::Value& json,
                                           SendLocalListConf&      data,
                                           std::string&            error_code,
-                                          std::string&            error_message)
+                                          std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::SendLocalListStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::SendLocalListStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -147,7 +143,9 @@ bool SendLocalListConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a SendLocalListConf to a JSON representation */
-bool SendLocalListConfConverter::toJson(const SendLocalListConf& data, rapidjson::Document& json)
+bool SendLocalListConfConverter::toJson(const SendLocalListConf&            data,
+                                        rapidjson::Value&                   json,
+                                        rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -155,23 +153,21 @@ bool SendLocalListConfConverter::toJson(const SendLocalListConf& data, rapidjson
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::SendLocalListStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::SendLocalListStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
@@ -36,23 +36,20 @@ namespace ocpp20
 bool SetChargingProfileReqConverter::fromJson(const rapidjson::Value& json,
                                               SetChargingProfileReq&  data,
                                               std::string&            error_code,
-                                              std::string&            error_message)
+                                              std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // evseId
-    extract(json, "evseId", data.evseId);
+    ret = ret && extract(json, "evseId", data.evseId, error_message);
 
     // chargingProfile
     ocpp::types::ocpp20::ChargingProfileTypeConverter chargingProfile_converter;
-    ret = ret && chargingProfile_converter.fromJson(json["chargingProfile"], data.chargingProfile, error_code, error_message);
+    ret = ret && extract(json, "chargingProfile", data.chargingProfile, chargingProfile_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -63,7 +60,9 @@ bool SetChargingProfileReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a SetChargingProfileReq to a JSON representation */
-bool SetChargingProfileReqConverter::toJson(const SetChargingProfileReq& data, rapidjson::Document& json)
+bool SetChargingProfileReqConverter::toJson(const SetChargingProfileReq&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -71,21 +70,19 @@ bool SetChargingProfileReqConverter::toJson(const SetChargingProfileReq& data, r
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // evseId
-    fill(json, "evseId", data.evseId);
+    fill(json, "evseId", data.evseId, allocator);
 
     // chargingProfile
     ocpp::types::ocpp20::ChargingProfileTypeConverter chargingProfile_converter;
-    chargingProfile_converter.setAllocator(allocator);
-    rapidjson::Document chargingProfile_doc(rapidjson::kObjectType);
-    ret = ret && chargingProfile_converter.toJson(data.chargingProfile, chargingProfile_doc);
-    json.AddMember(rapidjson::StringRef("chargingProfile"), chargingProfile_doc.Move(), *allocator);
+    rapidjson::Value                                  chargingProfile_doc(rapidjson::kObjectType);
+    ret = ret && chargingProfile_converter.toJson(data.chargingProfile, chargingProfile_doc, allocator);
+    json.AddMember(rapidjson::StringRef("chargingProfile"), chargingProfile_doc.Move(), allocator);
 
     return ret;
 }
@@ -94,26 +91,20 @@ bool SetChargingProfileReqConverter::toJson(const SetChargingProfileReq& data, r
 bool SetChargingProfileConfConverter::fromJson(const rapidjson::Value& json,
                                                SetChargingProfileConf& data,
                                                std::string&            error_code,
-                                               std::string&            error_message)
+                                               std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::ChargingProfileStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::ChargingProfileStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -124,7 +115,9 @@ bool SetChargingProfileConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a SetChargingProfileConf to a JSON representation */
-bool SetChargingProfileConfConverter::toJson(const SetChargingProfileConf& data, rapidjson::Document& json)
+bool SetChargingProfileConfConverter::toJson(const SetChargingProfileConf&       data,
+                                             rapidjson::Value&                   json,
+                                             rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -132,23 +125,21 @@ bool SetChargingProfileConfConverter::toJson(const SetChargingProfileConf& data,
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::ChargingProfileStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::ChargingProfileStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
@@ -36,20 +36,17 @@ namespace ocpp20
 bool SetDisplayMessageReqConverter::fromJson(const rapidjson::Value& json,
                                              SetDisplayMessageReq&   data,
                                              std::string&            error_code,
-                                             std::string&            error_message)
+                                             std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // message
     ocpp::types::ocpp20::MessageInfoTypeConverter message_converter;
-    ret = ret && message_converter.fromJson(json["message"], data.message, error_code, error_message);
+    ret = ret && extract(json, "message", data.message, message_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -60,7 +57,9 @@ bool SetDisplayMessageReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a SetDisplayMessageReq to a JSON representation */
-bool SetDisplayMessageReqConverter::toJson(const SetDisplayMessageReq& data, rapidjson::Document& json)
+bool SetDisplayMessageReqConverter::toJson(const SetDisplayMessageReq&         data,
+                                           rapidjson::Value&                   json,
+                                           rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -68,18 +67,16 @@ bool SetDisplayMessageReqConverter::toJson(const SetDisplayMessageReq& data, rap
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // message
     ocpp::types::ocpp20::MessageInfoTypeConverter message_converter;
-    message_converter.setAllocator(allocator);
-    rapidjson::Document message_doc(rapidjson::kObjectType);
-    ret = ret && message_converter.toJson(data.message, message_doc);
-    json.AddMember(rapidjson::StringRef("message"), message_doc.Move(), *allocator);
+    rapidjson::Value                              message_doc(rapidjson::kObjectType);
+    ret = ret && message_converter.toJson(data.message, message_doc, allocator);
+    json.AddMember(rapidjson::StringRef("message"), message_doc.Move(), allocator);
 
     return ret;
 }
@@ -88,26 +85,20 @@ bool SetDisplayMessageReqConverter::toJson(const SetDisplayMessageReq& data, rap
 bool SetDisplayMessageConfConverter::fromJson(const rapidjson::Value& json,
                                               SetDisplayMessageConf&  data,
                                               std::string&            error_code,
-                                              std::string&            error_message)
+                                              std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::DisplayMessageStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::DisplayMessageStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -118,7 +109,9 @@ bool SetDisplayMessageConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a SetDisplayMessageConf to a JSON representation */
-bool SetDisplayMessageConfConverter::toJson(const SetDisplayMessageConf& data, rapidjson::Document& json)
+bool SetDisplayMessageConfConverter::toJson(const SetDisplayMessageConf&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -126,23 +119,21 @@ bool SetDisplayMessageConfConverter::toJson(const SetDisplayMessageConf& data, r
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::DisplayMessageStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::DisplayMessageStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
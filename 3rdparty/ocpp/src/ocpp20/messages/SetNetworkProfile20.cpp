@@ -36,23 +36,20 @@ namespace ocpp20
 bool SetNetworkProfileReqConverter::fromJson(const rapidjson::Value& json,
                                              SetNetworkProfileReq&   data,
                                              std::string&            error_code,
-                                             std::string&            error_message)
+                                             std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // configurationSlot
-    extract(json, "configurationSlot", data.configurationSlot);
+    ret = ret && extract(json, "configurationSlot", data.configurationSlot, error_message);
 
     // connectionData
     ocpp::types::ocpp20::NetworkConnectionProfileTypeConverter connectionData_converter;
-    ret = ret && connectionData_converter.fromJson(json["connectionData"], data.connectionData, error_code, error_message);
+    ret = ret && extract(json, "connectionData", data.connectionData, connectionData_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -63,7 +60,9 @@ bool SetNetworkProfileReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a SetNetworkProfileReq to a JSON representation */
-bool SetNetworkProfileReqConverter::toJson(const SetNetworkProfileReq& data, rapidjson::Document& json)
+bool SetNetworkProfileReqConverter::toJson(const SetNetworkProfileReq&         data,
+                                           rapidjson::Value&                   json,
+                                           rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -71,21 +70,19 @@ bool SetNetworkProfileReqConverter::toJson(const SetNetworkProfileReq& data, rap
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // configurationSlot
-    fill(json, "configurationSlot", data.configurationSlot);
+    fill(json, "configurationSlot", data.configurationSlot, allocator);
 
     // connectionData
     ocpp::types::ocpp20::NetworkConnectionProfileTypeConverter connectionData_converter;
-    connectionData_converter.setAllocator(allocator);
-    rapidjson::Document connectionData_doc(rapidjson::kObjectType);
-    ret = ret && connectionData_converter.toJson(data.connectionData, connectionData_doc);
-    json.AddMember(rapidjson::StringRef("connectionData"), connectionData_doc.Move(), *allocator);
+    rapidjson::Value                                           connectionData_doc(rapidjson::kObjectType);
+    ret = ret && connectionData_converter.toJson(data.connectionData, connectionData_doc, allocator);
+    json.AddMember(rapidjson::StringRef("connectionData"), connectionData_doc.Move(), allocator);
 
     return ret;
 }
@@ -94,26 +91,20 @@ bool SetNetworkProfileReqConverter::toJson(const SetNetworkProfileReq& data, rap
 bool SetNetworkProfileConfConverter::fromJson(const rapidjson::Value& json,
                                               SetNetworkProfileConf&  data,
                                               std::string&            error_code,
-                                              std::string&            error_message)
+                                              std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::SetNetworkProfileStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::SetNetworkProfileStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -124,7 +115,9 @@ bool SetNetworkProfileConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a SetNetworkProfileConf to a JSON representation */
-bool SetNetworkProfileConfConverter::toJson(const SetNetworkProfileConf& data, rapidjson::Document& json)
+bool SetNetworkProfileConfConverter::toJson(const SetNetworkProfileConf&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -132,23 +125,21 @@ bool SetNetworkProfileConfConverter::toJson(const SetNetworkProfileConf& data, r
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::SetNetworkProfileStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::SetNetworkProfileStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
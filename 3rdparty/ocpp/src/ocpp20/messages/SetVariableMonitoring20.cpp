@@ -36,26 +36,28 @@ namespace ocpp20
 bool SetVariableMonitoringReqConverter::fromJson(const rapidjson::Value&   json,
                                                  SetVariableMonitoringReq& data,
                                                  std::string&              error_code,
-                                                 std::string&              error_message)
+                                                 std::string&              error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // setMonitoringData
-    if (json.HasMember("setMonitoringData"))
+    ret = ret && checkArray(json, "setMonitoringData", true, 1u, 0u, error_message);
+    if (ret && json.HasMember("setMonitoringData"))
     {
         const rapidjson::Value&                             setMonitoringData_json = json["setMonitoringData"];
         ocpp::types::ocpp20::SetMonitoringDataTypeConverter setMonitoringData_converter;
         for (auto it = setMonitoringData_json.Begin(); ret && (it != setMonitoringData_json.End()); ++it)
         {
-            ocpp::types::ocpp20::SetMonitoringDataType& item = data.setMonitoringData.emplace_back();
-            ret = ret && setMonitoringData_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it,
+                          "setMonitoringData",
+                          data.setMonitoringData.emplace_back(),
+                          setMonitoringData_converter,
+                          error_code,
+                          error_message);
         }
     }
 
@@ -68,7 +70,9 @@ bool SetVariableMonitoringReqConverter::fromJson(const rapidjson::Value&   json,
 }
 
 /** @brief Convert a SetVariableMonitoringReq to a JSON representation */
-bool SetVariableMonitoringReqConverter::toJson(const SetVariableMonitoringReq& data, rapidjson::Document& json)
+bool SetVariableMonitoringReqConverter::toJson(const SetVariableMonitoringReq&     data,
+                                               rapidjson::Value&                   json,
+                                               rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -76,24 +80,22 @@ bool SetVariableMonitoringReqConverter::toJson(const SetVariableMonitoringReq& d
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // setMonitoringData
 
     rapidjson::Value                                    setMonitoringData_json(rapidjson::kArrayType);
     ocpp::types::ocpp20::SetMonitoringDataTypeConverter setMonitoringData_converter;
-    setMonitoringData_converter.setAllocator(allocator);
     for (const ocpp::types::ocpp20::SetMonitoringDataType& item : data.setMonitoringData)
     {
-        rapidjson::Document item_doc(rapidjson::kObjectType);
-        ret = ret && setMonitoringData_converter.toJson(item, item_doc);
-        setMonitoringData_json.PushBack(item_doc.Move(), *allocator);
+        rapidjson::Value item_doc(rapidjson::kObjectType);
+        ret = ret && setMonitoringData_converter.toJson(item, item_doc, allocator);
+        setMonitoringData_json.PushBack(item_doc.Move(), allocator);
     }
-    json.AddMember(rapidjson::StringRef("setMonitoringData"), setMonitoringData_json.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("setMonitoringData"), setMonitoringData_json.Move(), allocator);
 
     return ret;
 }
@@ -102,26 +104,28 @@ bool SetVariableMonitoringReqConverter::toJson(const SetVariableMonitoringReq& d
 bool SetVariableMonitoringConfConverter::fromJson(const rapidjson::Value&    json,
                                                   SetVariableMonitoringConf& data,
                                                   std::string&               error_code,
-                                                  std::string&               error_message)
+                                                  std::string&               error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // setMonitoringResult
-    if (json.HasMember("setMonitoringResult"))
+    ret = ret && checkArray(json, "setMonitoringResult", true, 1u, 0u, error_message);
+    if (ret && json.HasMember("setMonitoringResult"))
     {
         const rapidjson::Value&                               setMonitoringResult_json = json["setMonitoringResult"];
         ocpp::types::ocpp20::SetMonitoringResultTypeConverter setMonitoringResult_converter;
         for (auto it = setMonitoringResult_json.Begin(); ret && (it != setMonitoringResult_json.End()); ++it)
         {
-            ocpp::types::ocpp20::SetMonitoringResultType& item = data.setMonitoringResult.emplace_back();
-            ret = ret && setMonitoringResult_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it,
+                          "setMonitoringResult",
+                          data.setMonitoringResult.emplace_back(),
+                          setMonitoringResult_converter,
+                          error_code,
+                          error_message);
         }
     }
 
@@ -134,7 +138,9 @@ bool SetVariableMonitoringConfConverter::fromJson(const rapidjson::Value&    jso
 }
 
 /** @brief Convert a SetVariableMonitoringConf to a JSON representation */
-bool SetVariableMonitoringConfConverter::toJson(const SetVariableMonitoringConf& data, rapidjson::Document& json)
+bool SetVariableMonitoringConfConverter::toJson(const SetVariableMonitoringConf&    data,
+                                                rapidjson::Value&                   json,
+                                                rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -142,24 +148,22 @@ bool SetVariableMonitoringConfConverter::toJson(const SetVariableMonitoringConf&
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // setMonitoringResult
 
     rapidjson::Value                                      setMonitoringResult_json(rapidjson::kArrayType);
     ocpp::types::ocpp20::SetMonitoringResultTypeConverter setMonitoringResult_converter;
-    setMonitoringResult_converter.setAllocator(allocator);
     for (const ocpp::types::ocpp20::SetMonitoringResultType& item : data.setMonitoringResult)
     {
-        rapidjson::Document item_doc(rapidjson::kObjectType);
-        ret = ret && setMonitoringResult_converter.toJson(item, item_doc);
-        setMonitoringResult_json.PushBack(item_doc.Move(), *allocator);
+        rapidjson::Value item_doc(rapidjson::kObjectType);
+        ret = ret && setMonitoringResult_converter.toJson(item, item_doc, allocator);
+        setMonitoringResult_json.PushBack(item_doc.Move(), allocator);
     }
-    json.AddMember(rapidjson::StringRef("setMonitoringResult"), setMonitoringResult_json.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("setMonitoringResult"), setMonitoringResult_json.Move(), allocator);
 
     return ret;
 }
@@ -36,26 +36,28 @@ namespace ocpp20
 bool SetVariablesReqConverter::fromJson(const rapidjson::Value& json,
                                         SetVariablesReq&        data,
                                         std::string&            error_code,
-                                        std::string&            error_message)
+                                        std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // setVariableData
-    if (json.HasMember("setVariableData"))
+    ret = ret && checkArray(json, "setVariableData", true, 1u, 0u, error_message);
+    if (ret && json.HasMember("setVariableData"))
     {
         const rapidjson::Value&                           setVariableData_json = json["setVariableData"];
         ocpp::types::ocpp20::SetVariableDataTypeConverter setVariableData_converter;
         for (auto it = setVariableData_json.Begin(); ret && (it != setVariableData_json.End()); ++it)
         {
-            ocpp::types::ocpp20::SetVariableDataType& item = data.setVariableData.emplace_back();
-            ret = ret && setVariableData_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it,
+                          "setVariableData",
+                          data.setVariableData.emplace_back(),
+                          setVariableData_converter,
+                          error_code,
+                          error_message);
         }
     }
 
@@ -68,7 +70,9 @@ bool SetVariablesReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a SetVariablesReq to a JSON representation */
-bool SetVariablesReqConverter::toJson(const SetVariablesReq& data, rapidjson::Document& json)
+bool SetVariablesReqConverter::toJson(const SetVariablesReq&              data,
+                                      rapidjson::Value&                   json,
+                                      rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -76,24 +80,22 @@ bool SetVariablesReqConverter::toJson(const SetVariablesReq& data, rapidjson::Do
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // setVariableData
 
     rapidjson::Value                                  setVariableData_json(rapidjson::kArrayType);
     ocpp::types::ocpp20::SetVariableDataTypeConverter setVariableData_converter;
-    setVariableData_converter.setAllocator(allocator);
     for (const ocpp::types::ocpp20::SetVariableDataType& item : data.setVariableData)
     {
-        rapidjson::Document item_doc(rapidjson::kObjectType);
-        ret = ret && setVariableData_converter.toJson(item, item_doc);
-        setVariableData_json.PushBack(item_doc.Move(), *allocator);
+        rapidjson::Value item_doc(rapidjson::kObjectType);
+        ret = ret && setVariableData_converter.toJson(item, item_doc, allocator);
+        setVariableData_json.PushBack(item_doc.Move(), allocator);
     }
-    json.AddMember(rapidjson::StringRef("setVariableData"), setVariableData_json.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("setVariableData"), setVariableData_json.Move(), allocator);
 
     return ret;
 }
@@ -102,26 +104,28 @@ bool SetVariablesReqConverter::toJson(const SetVariablesReq& data, rapidjson::Do
 bool SetVariablesConfConverter::fromJson(const rapidjson::Value& json,
                                          SetVariablesConf&       data,
                                          std::string&            error_code,
-                                         std::string&            error_message)
+                                         std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // setVariableResult
-    if (json.HasMember("setVariableResult"))
+    ret = ret && checkArray(json, "setVariableResult", true, 1u, 0u, error_message);
+    if (ret && json.HasMember("setVariableResult"))
     {
         const rapidjson::Value&                             setVariableResult_json = json["setVariableResult"];
         ocpp::types::ocpp20::SetVariableResultTypeConverter setVariableResult_converter;
         for (auto it = setVariableResult_json.Begin(); ret && (it != setVariableResult_json.End()); ++it)
         {
-            ocpp::types::ocpp20::SetVariableResultType& item = data.setVariableResult.emplace_back();
-            ret = ret && setVariableResult_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it,
+                          "setVariableResult",
+                          data.setVariableResult.emplace_back(),
+                          setVariableResult_converter,
+                          error_code,
+                          error_message);
         }
     }
 
@@ -134,7 +138,9 @@ bool SetVariablesConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a SetVariablesConf to a JSON representation */
-bool SetVariablesConfConverter::toJson(const SetVariablesConf& data, rapidjson::Document& json)
+bool SetVariablesConfConverter::toJson(const SetVariablesConf&             data,
+                                       rapidjson::Value&                   json,
+                                       rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -142,24 +148,22 @@ bool SetVariablesConfConverter::toJson(const SetVariablesConf& data, rapidjson::
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // setVariableResult
 
     rapidjson::Value                                    setVariableResult_json(rapidjson::kArrayType);
     ocpp::types::ocpp20::SetVariableResultTypeConverter setVariableResult_converter;
-    setVariableResult_converter.setAllocator(allocator);
     for (const ocpp::types::ocpp20::SetVariableResultType& item : data.setVariableResult)
     {
-        rapidjson::Document item_doc(rapidjson::kObjectType);
-        ret = ret && setVariableResult_converter.toJson(item, item_doc);
-        setVariableResult_json.PushBack(item_doc.Move(), *allocator);
+        rapidjson::Value item_doc(rapidjson::kObjectType);
+        ret = ret && setVariableResult_converter.toJson(item, item_doc, allocator);
+        setVariableResult_json.PushBack(item_doc.Move(), allocator);
     }
-    json.AddMember(rapidjson::StringRef("setVariableResult"), setVariableResult_json.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("setVariableResult"), setVariableResult_json.Move(), allocator);
 
     return ret;
 }
@@ -36,28 +36,87 @@ namespace ocpp20
 bool StatusNotificationReqConverter::fromJson(const rapidjson::Value& json,
                                               StatusNotificationReq&  data,
                                               std::string&            error_code,
-                                              std::string&            error_message)
+                                              std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // timestamp
     ret = ret && extract(json, "timestamp", data.timestamp, error_message);
 
     // connectorStatus
-    data.connectorStatus = ocpp::types::ocpp20::ConnectorStatusEnumTypeHelper.fromString(json["connectorStatus"].GetString());
+    ret = ret && extract(json, "connectorStatus", data.connectorStatus, ocpp::types::ocpp20::ConnectorStatusEnumTypeHelper, error_message);
 
     // evseId
-    extract(json, "evseId", data.evseId);
+    ret = ret && extract(json, "evseId", data.evseId, error_message);
 
     // connectorId
-    extract(json, "connectorId", data.connectorId);
+    ret = ret && extract(json, "connectorId", data.connectorId, error_message);
+
+    if (!ret)
+    {
+        error_code = ocpp::rpc::IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
+    }
+
+    return ret;
+}
+
+/** @brief Convert a StatusNotificationReq from a JSON stream */
+bool StatusNotificationReqConverter::fromJson(ocpp::json::JsonReader& reader,
+                                              StatusNotificationReq&  data,
+                                              std::string&            error_code,
+                                              std::string&            error_message) const
+{
+    bool ret                   = true;
+    bool timestamp_found       = false;
+    bool connectorStatus_found = false;
+    bool evseId_found          = false;
+    bool connectorId_found     = false;
+
+    while (ret && reader.nextMember())
+    {
+        if (reader.isMember("customData"))
+        {
+            ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+            ret = convert(reader, "customData", data.customData.value(), customData_converter, error_code, error_message);
+        }
+        else if (reader.isMember("timestamp"))
+        {
+            ret             = convert(reader, "timestamp", data.timestamp, error_message);
+            timestamp_found = true;
+        }
+        else if (reader.isMember("connectorStatus"))
+        {
+            ret                   = convert(reader,
+                                            "connectorStatus",
+                                            data.connectorStatus,
+                                            ocpp::types::ocpp20::ConnectorStatusEnumTypeHelper,
+                                            error_message);
+            connectorStatus_found = true;
+        }
+        else if (reader.isMember("evseId"))
+        {
+            ret          = convert(reader, "evseId", data.evseId, error_message);
+            evseId_found = true;
+        }
+        else if (reader.isMember("connectorId"))
+        {
+            ret               = convert(reader, "connectorId", data.connectorId, error_message);
+            connectorId_found = true;
+        }
+        else
+        {
+            ret = reader.skip();
+        }
+    }
+    ret = ret && !reader.hasError();
+    ret = ret && checkRequired("timestamp", timestamp_found, error_message);
+    ret = ret && checkRequired("connectorStatus", connectorStatus_found, error_message);
+    ret = ret && checkRequired("evseId", evseId_found, error_message);
+    ret = ret && checkRequired("connectorId", connectorId_found, error_message);
 
     if (!ret)
     {
@@ -68,7 +127,9 @@ bool StatusNotificationReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a StatusNotificationReq to a JSON representation */
-bool StatusNotificationReqConverter::toJson(const StatusNotificationReq& data, rapidjson::Document& json)
+bool StatusNotificationReqConverter::toJson(const StatusNotificationReq&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -76,23 +137,22 @@ bool StatusNotificationReqConverter::toJson(const StatusNotificationReq& data, r
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // timestamp
-    fill(json, "timestamp", data.timestamp);
+    fill(json, "timestamp", data.timestamp, allocator);
 
     // connectorStatus
-    fill(json, "connectorStatus", ocpp::types::ocpp20::ConnectorStatusEnumTypeHelper.toString(data.connectorStatus));
+    fill(json, "connectorStatus", ocpp::types::ocpp20::ConnectorStatusEnumTypeHelper.toString(data.connectorStatus), allocator);
 
     // evseId
-    fill(json, "evseId", data.evseId);
+    fill(json, "evseId", data.evseId, allocator);
 
     // connectorId
-    fill(json, "connectorId", data.connectorId);
+    fill(json, "connectorId", data.connectorId, allocator);
 
     return ret;
 }
@@ -101,16 +161,13 @@ bool StatusNotificationReqConverter::toJson(const StatusNotificationReq& data, r
 bool StatusNotificationConfConverter::fromJson(const rapidjson::Value& json,
                                                StatusNotificationConf& data,
                                                std::string&            error_code,
-                                               std::string&            error_message)
+                                               std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -121,7 +178,9 @@ bool StatusNotificationConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a StatusNotificationConf to a JSON representation */
-bool StatusNotificationConfConverter::toJson(const StatusNotificationConf& data, rapidjson::Document& json)
+bool StatusNotificationConfConverter::toJson(const StatusNotificationConf&       data,
+                                             rapidjson::Value&                   json,
+                                             rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -129,10 +188,9 @@ bool StatusNotificationConfConverter::toJson(const StatusNotificationConf& data,
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     return ret;
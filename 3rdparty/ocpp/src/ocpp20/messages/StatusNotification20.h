@@ -62,7 +62,7 @@ struct StatusNotificationConf
 };
 
 // Message converters
-MESSAGE_CONVERTERS(StatusNotification)
+STREAMED_MESSAGE_CONVERTERS(StatusNotification)
 
 } // namespace ocpp20
 } // namespace messages
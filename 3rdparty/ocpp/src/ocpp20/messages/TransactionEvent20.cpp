@@ -36,29 +36,26 @@ namespace ocpp20
 bool TransactionEventReqConverter::fromJson(const rapidjson::Value& json,
                                             TransactionEventReq&    data,
                                             std::string&            error_code,
-                                            std::string&            error_message)
+                                            std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // eventType
-    data.eventType = ocpp::types::ocpp20::TransactionEventEnumTypeHelper.fromString(json["eventType"].GetString());
+    ret = ret && extract(json, "eventType", data.eventType, ocpp::types::ocpp20::TransactionEventEnumTypeHelper, error_message);
 
     // meterValue
-    if (json.HasMember("meterValue"))
+    ret = ret && checkArray(json, "meterValue", false, 1u, 0u, error_message);
+    if (ret && json.HasMember("meterValue"))
     {
         const rapidjson::Value&                      meterValue_json = json["meterValue"];
         ocpp::types::ocpp20::MeterValueTypeConverter meterValue_converter;
         for (auto it = meterValue_json.Begin(); ret && (it != meterValue_json.End()); ++it)
         {
-            ocpp::types::ocpp20::MeterValueType& item = data.meterValue.emplace_back();
-            ret                                       = ret && meterValue_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it, "meterValue", data.meterValue.emplace_back(), meterValue_converter, error_code, error_message);
         }
     }
 
@@ -66,40 +63,149 @@ bool TransactionEventReqConverter::fromJson(const rapidjson::Value& json,
     ret = ret && extract(json, "timestamp", data.timestamp, error_message);
 
     // triggerReason
-    data.triggerReason = ocpp::types::ocpp20::TriggerReasonEnumTypeHelper.fromString(json["triggerReason"].GetString());
+    ret = ret && extract(json, "triggerReason", data.triggerReason, ocpp::types::ocpp20::TriggerReasonEnumTypeHelper, error_message);
 
     // seqNo
-    extract(json, "seqNo", data.seqNo);
+    ret = ret && extract(json, "seqNo", data.seqNo, error_message);
 
     // offline
-    extract(json, "offline", data.offline);
+    ret = ret && extract(json, "offline", data.offline, error_message);
 
     // numberOfPhasesUsed
-    extract(json, "numberOfPhasesUsed", data.numberOfPhasesUsed);
+    ret = ret && extract(json, "numberOfPhasesUsed", data.numberOfPhasesUsed, error_message);
 
     // cableMaxCurrent
-    extract(json, "cableMaxCurrent", data.cableMaxCurrent);
+    ret = ret && extract(json, "cableMaxCurrent", data.cableMaxCurrent, error_message);
 
     // reservationId
-    extract(json, "reservationId", data.reservationId);
+    ret = ret && extract(json, "reservationId", data.reservationId, error_message);
 
     // transactionInfo
     ocpp::types::ocpp20::TransactionTypeConverter transactionInfo_converter;
-    ret = ret && transactionInfo_converter.fromJson(json["transactionInfo"], data.transactionInfo, error_code, error_message);
+    ret = ret && extract(json, "transactionInfo", data.transactionInfo, transactionInfo_converter, error_code, error_message);
 
     // evse
-    if (json.HasMember("evse"))
+    ocpp::types::ocpp20::EVSETypeConverter evse_converter;
+    ret = ret && extract(json, "evse", data.evse, evse_converter, error_code, error_message);
+
+    // idToken
+    ocpp::types::ocpp20::IdTokenTypeConverter idToken_converter;
+    ret = ret && extract(json, "idToken", data.idToken, idToken_converter, error_code, error_message);
+
+    if (!ret)
     {
-        ocpp::types::ocpp20::EVSETypeConverter evse_converter;
-        ret = ret && evse_converter.fromJson(json["evse"], data.evse, error_code, error_message);
+        error_code = ocpp::rpc::IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
     }
 
-    // idToken
-    if (json.HasMember("idToken"))
+    return ret;
+}
+
+/** @brief Convert a TransactionEventReq from a JSON stream */
+bool TransactionEventReqConverter::fromJson(ocpp::json::JsonReader& reader,
+                                            TransactionEventReq&    data,
+                                            std::string&            error_code,
+                                            std::string&            error_message) const
+{
+    bool ret                   = true;
+    bool eventType_found       = false;
+    bool timestamp_found       = false;
+    bool triggerReason_found   = false;
+    bool seqNo_found           = false;
+    bool transactionInfo_found = false;
+
+    while (ret && reader.nextMember())
     {
-        ocpp::types::ocpp20::IdTokenTypeConverter idToken_converter;
-        ret = ret && idToken_converter.fromJson(json["idToken"], data.idToken, error_code, error_message);
+        if (reader.isMember("customData"))
+        {
+            ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+            ret = convert(reader, "customData", data.customData.value(), customData_converter, error_code, error_message);
+        }
+        else if (reader.isMember("eventType"))
+        {
+            ret             = convert(reader,
+                                      "eventType",
+                                      data.eventType,
+                                      ocpp::types::ocpp20::TransactionEventEnumTypeHelper,
+                                      error_message);
+            eventType_found = true;
+        }
+        else if (reader.isMember("meterValue"))
+        {
+            ocpp::types::ocpp20::MeterValueTypeConverter meterValue_converter;
+            ret = checkArray(reader, "meterValue", error_message);
+            while (ret && reader.nextItem())
+            {
+                ret = convert(reader, "meterValue", data.meterValue.emplace_back(), meterValue_converter, error_code, error_message);
+            }
+            ret = ret && checkItems("meterValue", data.meterValue.size(), 1u, 0u, error_message);
+        }
+        else if (reader.isMember("timestamp"))
+        {
+            ret             = convert(reader, "timestamp", data.timestamp, error_message);
+            timestamp_found = true;
+        }
+        else if (reader.isMember("triggerReason"))
+        {
+            ret                 = convert(reader,
+                                          "triggerReason",
+                                          data.triggerReason,
+                                          ocpp::types::ocpp20::TriggerReasonEnumTypeHelper,
+                                          error_message);
+            triggerReason_found = true;
+        }
+        else if (reader.isMember("seqNo"))
+        {
+            ret         = convert(reader, "seqNo", data.seqNo, error_message);
+            seqNo_found = true;
+        }
+        else if (reader.isMember("offline"))
+        {
+            ret = convert(reader, "offline", data.offline.value(), error_message);
+        }
+        else if (reader.isMember("numberOfPhasesUsed"))
+        {
+            ret = convert(reader, "numberOfPhasesUsed", data.numberOfPhasesUsed.value(), error_message);
+        }
+        else if (reader.isMember("cableMaxCurrent"))
+        {
+            ret = convert(reader, "cableMaxCurrent", data.cableMaxCurrent.value(), error_message);
+        }
+        else if (reader.isMember("reservationId"))
+        {
+            ret = convert(reader, "reservationId", data.reservationId.value(), error_message);
+        }
+        else if (reader.isMember("transactionInfo"))
+        {
+            ocpp::types::ocpp20::TransactionTypeConverter transactionInfo_converter;
+            ret                   = convert(reader,
+                                            "transactionInfo",
+                                            data.transactionInfo,
+                                            transactionInfo_converter,
+                                            error_code,
+                                            error_message);
+            transactionInfo_found = true;
+        }
+        else if (reader.isMember("evse"))
+        {
+            ocpp::types::ocpp20::EVSETypeConverter evse_converter;
+            ret = convert(reader, "evse", data.evse.value(), evse_converter, error_code, error_message);
+        }
+        else if (reader.isMember("idToken"))
+        {
+            ocpp::types::ocpp20::IdTokenTypeConverter idToken_converter;
+            ret = convert(reader, "idToken", data.idToken.value(), idToken_converter, error_code, error_message);
+        }
+        else
+        {
+            ret = reader.skip();
+        }
     }
+    ret = ret && !reader.hasError();
+    ret = ret && checkRequired("eventType", eventType_found, error_message);
+    ret = ret && checkRequired("timestamp", timestamp_found, error_message);
+    ret = ret && checkRequired("triggerReason", triggerReason_found, error_message);
+    ret = ret && checkRequired("seqNo", seqNo_found, error_message);
+    ret = ret && checkRequired("transactionInfo", transactionInfo_found, error_message);
 
     if (!ret)
     {
@@ -110,7 +216,9 @@ bool TransactionEventReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a TransactionEventReq to a JSON representation */
-bool TransactionEventReqConverter::toJson(const TransactionEventReq& data, rapidjson::Document& json)
+bool TransactionEventReqConverter::toJson(const TransactionEventReq&          data,
+                                          rapidjson::Value&                   json,
+                                          rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -118,14 +226,13 @@ bool TransactionEventReqConverter::toJson(const TransactionEventReq& data, rapid
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // eventType
-    fill(json, "eventType", ocpp::types::ocpp20::TransactionEventEnumTypeHelper.toString(data.eventType));
+    fill(json, "eventType", ocpp::types::ocpp20::TransactionEventEnumTypeHelper.toString(data.eventType), allocator);
 
     // meterValue
     if (!data.meterValue.empty())
@@ -133,62 +240,58 @@ bool TransactionEventReqConverter::toJson(const TransactionEventReq& data, rapid
 
         rapidjson::Value                             meterValue_json(rapidjson::kArrayType);
         ocpp::types::ocpp20::MeterValueTypeConverter meterValue_converter;
-        meterValue_converter.setAllocator(allocator);
         for (const ocpp::types::ocpp20::MeterValueType& item : data.meterValue)
         {
-            rapidjson::Document item_doc(rapidjson::kObjectType);
-            ret = ret && meterValue_converter.toJson(item, item_doc);
-            meterValue_json.PushBack(item_doc.Move(), *allocator);
+            rapidjson::Value item_doc(rapidjson::kObjectType);
+            ret = ret && meterValue_converter.toJson(item, item_doc, allocator);
+            meterValue_json.PushBack(item_doc.Move(), allocator);
         }
-        json.AddMember(rapidjson::StringRef("meterValue"), meterValue_json.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("meterValue"), meterValue_json.Move(), allocator);
     }
 
     // timestamp
-    fill(json, "timestamp", data.timestamp);
+    fill(json, "timestamp", data.timestamp, allocator);
 
     // triggerReason
-    fill(json, "triggerReason", ocpp::types::ocpp20::TriggerReasonEnumTypeHelper.toString(data.triggerReason));
+    fill(json, "triggerReason", ocpp::types::ocpp20::TriggerReasonEnumTypeHelper.toString(data.triggerReason), allocator);
 
     // seqNo
-    fill(json, "seqNo", data.seqNo);
+    fill(json, "seqNo", data.seqNo, allocator);
 
     // offline
-    fill(json, "offline", data.offline);
+    fill(json, "offline", data.offline, allocator);
 
     // numberOfPhasesUsed
-    fill(json, "numberOfPhasesUsed", data.numberOfPhasesUsed);
+    fill(json, "numberOfPhasesUsed", data.numberOfPhasesUsed, allocator);
 
     // cableMaxCurrent
-    fill(json, "cableMaxCurrent", data.cableMaxCurrent);
+    fill(json, "cableMaxCurrent", data.cableMaxCurrent, allocator);
 
     // reservationId
-    fill(json, "reservationId", data.reservationId);
+    fill(json, "reservationId", data.reservationId, allocator);
 
     // transactionInfo
     ocpp::types::ocpp20::TransactionTypeConverter transactionInfo_converter;
-    transactionInfo_converter.setAllocator(allocator);
-    rapidjson::Document transactionInfo_doc(rapidjson::kObjectType);
-    ret = ret && transactionInfo_converter.toJson(data.transactionInfo, transactionInfo_doc);
-    json.AddMember(rapidjson::StringRef("transactionInfo"), transactionInfo_doc.Move(), *allocator);
+    rapidjson::Value                              transactionInfo_doc(rapidjson::kObjectType);
+    ret = ret && transactionInfo_converter.toJson(data.transactionInfo, transactionInfo_doc, allocator);
+    json.AddMember(rapidjson::StringRef("transactionInfo"), transactionInfo_doc.Move(), allocator);
 
     // evse
     if (data.evse.isSet())
     {
         ocpp::types::ocpp20::EVSETypeConverter evse_converter;
-        evse_converter.setAllocator(allocator);
-        rapidjson::Document evse_doc(rapidjson::kObjectType);
-        ret = ret && evse_converter.toJson(data.evse, evse_doc);
-        json.AddMember(rapidjson::StringRef("evse"), evse_doc.Move(), *allocator);
+        rapidjson::Value                       evse_doc(rapidjson::kObjectType);
+        ret = ret && evse_converter.toJson(data.evse, evse_doc, allocator);
+        json.AddMember(rapidjson::StringRef("evse"), evse_doc.Move(), allocator);
     }
 
     // idToken
     if (data.idToken.isSet())
     {
         ocpp::types::ocpp20::IdTokenTypeConverter idToken_converter;
-        idToken_converter.setAllocator(allocator);
-        rapidjson::Document idToken_doc(rapidjson::kObjectType);
-        ret = ret && idToken_converter.toJson(data.idToken, idToken_doc);
-        json.AddMember(rapidjson::StringRef("idToken"), idToken_doc.Move(), *allocator);
+        rapidjson::Value                          idToken_doc(rapidjson::kObjectType);
+        ret = ret && idToken_converter.toJson(data.idToken, idToken_doc, allocator);
+        json.AddMember(rapidjson::StringRef("idToken"), idToken_doc.Move(), allocator);
     }
 
     return ret;
@@ -198,37 +301,28 @@ bool TransactionEventReqConverter::toJson(const TransactionEventReq& data, rapid
 bool TransactionEventConfConverter::fromJson(const rapidjson::Value& json,
                                              TransactionEventConf&   data,
                                              std::string&            error_code,
-                                             std::string&            error_message)
+                                             std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // totalCost
-    extract(json, "totalCost", data.totalCost);
+    ret = ret && extract(json, "totalCost", data.totalCost, error_message);
 
     // chargingPriority
-    extract(json, "chargingPriority", data.chargingPriority);
+    ret = ret && extract(json, "chargingPriority", data.chargingPriority, error_message);
 
     // idTokenInfo
-    if (json.HasMember("idTokenInfo"))
-    {
-        ocpp::types::ocpp20::IdTokenInfoTypeConverter idTokenInfo_converter;
-        ret = ret && idTokenInfo_converter.fromJson(json["idTokenInfo"], data.idTokenInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::IdTokenInfoTypeConverter idTokenInfo_converter;
+    ret = ret && extract(json, "idTokenInfo", data.idTokenInfo, idTokenInfo_converter, error_code, error_message);
 
     // updatedPersonalMessage
-    if (json.HasMember("updatedPersonalMessage"))
-    {
-        ocpp::types::ocpp20::MessageContentTypeConverter updatedPersonalMessage_converter;
-        ret = ret && updatedPersonalMessage_converter.fromJson(
-                         json["updatedPersonalMessage"], data.updatedPersonalMessage, error_code, error_message);
-    }
+    ocpp::types::ocpp20::MessageContentTypeConverter updatedPersonalMessage_converter;
+    ret = ret &&
+          extract(json, "updatedPersonalMessage", data.updatedPersonalMessage, updatedPersonalMessage_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -239,7 +333,9 @@ bool TransactionEventConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a TransactionEventConf to a JSON representation */
-bool TransactionEventConfConverter::toJson(const TransactionEventConf& data, rapidjson::Document& json)
+bool TransactionEventConfConverter::toJson(const TransactionEventConf&         data,
+                                           rapidjson::Value&                   json,
+                                           rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -247,36 +343,33 @@ bool TransactionEventConfConverter::toJson(const TransactionEventConf& data, rap
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // totalCost
-    fill(json, "totalCost", data.totalCost);
+    fill(json, "totalCost", data.totalCost, allocator);
 
     // chargingPriority
-    fill(json, "chargingPriority", data.chargingPriority);
+    fill(json, "chargingPriority", data.chargingPriority, allocator);
 
     // idTokenInfo
     if (data.idTokenInfo.isSet())
     {
         ocpp::types::ocpp20::IdTokenInfoTypeConverter idTokenInfo_converter;
-        idTokenInfo_converter.setAllocator(allocator);
-        rapidjson::Document idTokenInfo_doc(rapidjson::kObjectType);
-        ret = ret && idTokenInfo_converter.toJson(data.idTokenInfo, idTokenInfo_doc);
-        json.AddMember(rapidjson::StringRef("idTokenInfo"), idTokenInfo_doc.Move(), *allocator);
+        rapidjson::Value                              idTokenInfo_doc(rapidjson::kObjectType);
+        ret = ret && idTokenInfo_converter.toJson(data.idTokenInfo, idTokenInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("idTokenInfo"), idTokenInfo_doc.Move(), allocator);
     }
 
     // updatedPersonalMessage
     if (data.updatedPersonalMessage.isSet())
     {
         ocpp::types::ocpp20::MessageContentTypeConverter updatedPersonalMessage_converter;
-        updatedPersonalMessage_converter.setAllocator(allocator);
-        rapidjson::Document updatedPersonalMessage_doc(rapidjson::kObjectType);
-        ret = ret && updatedPersonalMessage_converter.toJson(data.updatedPersonalMessage, updatedPersonalMessage_doc);
-        json.AddMember(rapidjson::StringRef("updatedPersonalMessage"), updatedPersonalMessage_doc.Move(), *allocator);
+        rapidjson::Value                                 updatedPersonalMessage_doc(rapidjson::kObjectType);
+        ret = ret && updatedPersonalMessage_converter.toJson(data.updatedPersonalMessage, updatedPersonalMessage_doc, allocator);
+        json.AddMember(rapidjson::StringRef("updatedPersonalMessage"), updatedPersonalMessage_doc.Move(), allocator);
     }
 
     return ret;
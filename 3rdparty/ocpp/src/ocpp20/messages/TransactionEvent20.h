@@ -93,7 +93,7 @@ struct TransactionEventConf
 };
 
 // Message converters
-MESSAGE_CONVERTERS(TransactionEvent)
+STREAMED_MESSAGE_CONVERTERS(TransactionEvent)
 
 } // namespace ocpp20
 } // namespace messages
@@ -36,26 +36,20 @@ namespace ocpp20
 bool TriggerMessageReqConverter::fromJson(const rapidjson::Value& json,
                                           TriggerMessageReq&      data,
                                           std::string&            error_code,
-                                          std::string&            error_message)
+                                          std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // evse
-    if (json.HasMember("evse"))
-    {
-        ocpp::types::ocpp20::EVSETypeConverter evse_converter;
-        ret = ret && evse_converter.fromJson(json["evse"], data.evse, error_code, error_message);
-    }
+    ocpp::types::ocpp20::EVSETypeConverter evse_converter;
+    ret = ret && extract(json, "evse", data.evse, evse_converter, error_code, error_message);
 
     // requestedMessage
-    data.requestedMessage = ocpp::types::ocpp20::MessageTriggerEnumTypeHelper.fromString(json["requestedMessage"].GetString());
+    ret = ret && extract(json, "requestedMessage", data.requestedMessage, ocpp::types::ocpp20::MessageTriggerEnumTypeHelper, error_message);
 
     if (!ret)
     {
@@ -66,7 +60,9 @@ bool TriggerMessageReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a TriggerMessageReq to a JSON representation */
-bool TriggerMessageReqConverter::toJson(const TriggerMessageReq& data, rapidjson::Document& json)
+bool TriggerMessageReqConverter::toJson(const TriggerMessageReq&            data,
+                                        rapidjson::Value&                   json,
+                                        rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -74,24 +70,22 @@ bool TriggerMessageReqConverter::toJson(const TriggerMessageReq& data, rapidjson
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // evse
     if (data.evse.isSet())
     {
         ocpp::types::ocpp20::EVSETypeConverter evse_converter;
-        evse_converter.setAllocator(allocator);
-        rapidjson::Document evse_doc(rapidjson::kObjectType);
-        ret = ret && evse_converter.toJson(data.evse, evse_doc);
-        json.AddMember(rapidjson::StringRef("evse"), evse_doc.Move(), *allocator);
+        rapidjson::Value                       evse_doc(rapidjson::kObjectType);
+        ret = ret && evse_converter.toJson(data.evse, evse_doc, allocator);
+        json.AddMember(rapidjson::StringRef("evse"), evse_doc.Move(), allocator);
     }
 
     // requestedMessage
-    fill(json, "requestedMessage", ocpp::types::ocpp20::MessageTriggerEnumTypeHelper.toString(data.requestedMessage));
+    fill(json, "requestedMessage", ocpp::types::ocpp20::MessageTriggerEnumTypeHelper.toString(data.requestedMessage), allocator);
 
     return ret;
 }
@@ -100,26 +94,20 @@ bool TriggerMessageReqConverter::toJson(const TriggerMessageReq& data, rapidjson
 bool TriggerMessageConfConverter::fromJson(const rapidjson::Value& json,
                                            TriggerMessageConf&     data,
                                            std::string&            error_code,
-                                           std::string&            error_message)
+                                           std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::TriggerMessageStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::TriggerMessageStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -130,7 +118,9 @@ bool TriggerMessageConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a TriggerMessageConf to a JSON representation */
-bool TriggerMessageConfConverter::toJson(const TriggerMessageConf& data, rapidjson::Document& json)
+bool TriggerMessageConfConverter::toJson(const TriggerMessageConf&           data,
+                                         rapidjson::Value&                   json,
+                                         rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -138,23 +128,21 @@ bool TriggerMessageConfConverter::toJson(const TriggerMessageConf& data, rapidjs
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::TriggerMessageStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::TriggerMessageStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
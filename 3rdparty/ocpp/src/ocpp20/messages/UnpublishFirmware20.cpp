@@ -36,19 +36,16 @@ namespace ocpp20
 bool UnpublishFirmwareReqConverter::fromJson(const rapidjson::Value& json,
                                              UnpublishFirmwareReq&   data,
                                              std::string&            error_code,
-                                             std::string&            error_message)
+                                             std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // checksum
-    extract(json, "checksum", data.checksum);
+    ret = ret && extract(json, "checksum", data.checksum, error_message);
 
     if (!ret)
     {
@@ -59,7 +56,9 @@ bool UnpublishFirmwareReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a UnpublishFirmwareReq to a JSON representation */
-bool UnpublishFirmwareReqConverter::toJson(const UnpublishFirmwareReq& data, rapidjson::Document& json)
+bool UnpublishFirmwareReqConverter::toJson(const UnpublishFirmwareReq&         data,
+                                           rapidjson::Value&                   json,
+                                           rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -67,14 +66,13 @@ bool UnpublishFirmwareReqConverter::toJson(const UnpublishFirmwareReq& data, rap
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // checksum
-    fill(json, "checksum", data.checksum);
+    fill(json, "checksum", data.checksum, allocator);
 
     return ret;
 }
@@ -83,19 +81,16 @@ bool UnpublishFirmwareReqConverter::toJson(const UnpublishFirmwareReq& data, rap
 bool UnpublishFirmwareConfConverter::fromJson(const rapidjson::Value& json,
                                               UnpublishFirmwareConf&  data,
                                               std::string&            error_code,
-                                              std::string&            error_message)
+                                              std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::UnpublishFirmwareStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::UnpublishFirmwareStatusEnumTypeHelper, error_message);
 
     if (!ret)
     {
@@ -106,7 +101,9 @@ bool UnpublishFirmwareConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a UnpublishFirmwareConf to a JSON representation */
-bool UnpublishFirmwareConfConverter::toJson(const UnpublishFirmwareConf& data, rapidjson::Document& json)
+bool UnpublishFirmwareConfConverter::toJson(const UnpublishFirmwareConf&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -114,14 +111,13 @@ bool UnpublishFirmwareConfConverter::toJson(const UnpublishFirmwareConf& data, r
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::UnpublishFirmwareStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::UnpublishFirmwareStatusEnumTypeHelper.toString(data.status), allocator);
 
     return ret;
 }
@@ -36,29 +36,26 @@ namespace ocpp20
 bool UpdateFirmwareReqConverter::fromJson(const rapidjson::Value& json,
                                           UpdateFirmwareReq&      data,
                                           std::string&            error_code,
-                                          std::string&            error_message)
+                                          std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // retries
-    extract(json, "retries", data.retries);
+    ret = ret && extract(json, "retries", data.retries, error_message);
 
     // retryInterval
-    extract(json, "retryInterval", data.retryInterval);
+    ret = ret && extract(json, "retryInterval", data.retryInterval, error_message);
 
     // requestId
-    extract(json, "requestId", data.requestId);
+    ret = ret && extract(json, "requestId", data.requestId, error_message);
 
     // firmware
     ocpp::types::ocpp20::FirmwareTypeConverter firmware_converter;
-    ret = ret && firmware_converter.fromJson(json["firmware"], data.firmware, error_code, error_message);
+    ret = ret && extract(json, "firmware", data.firmware, firmware_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -69,7 +66,9 @@ bool UpdateFirmwareReqConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a UpdateFirmwareReq to a JSON representation */
-bool UpdateFirmwareReqConverter::toJson(const UpdateFirmwareReq& data, rapidjson::Document& json)
+bool UpdateFirmwareReqConverter::toJson(const UpdateFirmwareReq&            data,
+                                        rapidjson::Value&                   json,
+                                        rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -77,27 +76,25 @@ bool UpdateFirmwareReqConverter::toJson(const UpdateFirmwareReq& data, rapidjson
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // retries
-    fill(json, "retries", data.retries);
+    fill(json, "retries", data.retries, allocator);
 
     // retryInterval
-    fill(json, "retryInterval", data.retryInterval);
+    fill(json, "retryInterval", data.retryInterval, allocator);
 
     // requestId
-    fill(json, "requestId", data.requestId);
+    fill(json, "requestId", data.requestId, allocator);
 
     // firmware
     ocpp::types::ocpp20::FirmwareTypeConverter firmware_converter;
-    firmware_converter.setAllocator(allocator);
-    rapidjson::Document firmware_doc(rapidjson::kObjectType);
-    ret = ret && firmware_converter.toJson(data.firmware, firmware_doc);
-    json.AddMember(rapidjson::StringRef("firmware"), firmware_doc.Move(), *allocator);
+    rapidjson::Value                           firmware_doc(rapidjson::kObjectType);
+    ret = ret && firmware_converter.toJson(data.firmware, firmware_doc, allocator);
+    json.AddMember(rapidjson::StringRef("firmware"), firmware_doc.Move(), allocator);
 
     return ret;
 }
@@ -106,26 +103,20 @@ bool UpdateFirmwareReqConverter::toJson(const UpdateFirmwareReq& data, rapidjson
 bool UpdateFirmwareConfConverter::fromJson(const rapidjson::Value& json,
                                            UpdateFirmwareConf&     data,
                                            std::string&            error_code,
-                                           std::string&            error_message)
+                                           std::string&            error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ocpp::types::ocpp20::UpdateFirmwareStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ocpp::types::ocpp20::UpdateFirmwareStatusEnumTypeHelper, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -136,7 +127,9 @@ bool UpdateFirmwareConfConverter::fromJson(const rapidjson::Value& json,
 }
 
 /** @brief Convert a UpdateFirmwareConf to a JSON representation */
-bool UpdateFirmwareConfConverter::toJson(const UpdateFirmwareConf& data, rapidjson::Document& json)
+bool UpdateFirmwareConfConverter::toJson(const UpdateFirmwareConf&           data,
+                                         rapidjson::Value&                   json,
+                                         rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -144,23 +137,21 @@ bool UpdateFirmwareConfConverter::toJson(const UpdateFirmwareConf& data, rapidjs
     if (data.customData.isSet())
     {
         ocpp::types::ocpp20::CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value                             customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ocpp::types::ocpp20::UpdateFirmwareStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ocpp::types::ocpp20::UpdateFirmwareStatusEnumTypeHelper.toString(data.status), allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         ocpp::types::ocpp20::StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value                             statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
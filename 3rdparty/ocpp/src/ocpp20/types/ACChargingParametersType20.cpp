@@ -36,28 +36,25 @@ namespace ocpp20
 bool ACChargingParametersTypeConverter::fromJson(const rapidjson::Value&       json,
                                                  ACChargingParametersType&     data,
                                                  std::string&                  error_code,
-                                                 [[maybe_unused]] std::string& error_message)
+                                                 [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // energyAmount
-    extract(json, "energyAmount", data.energyAmount);
+    ret = ret && extract(json, "energyAmount", data.energyAmount, error_message);
 
     // evMinCurrent
-    extract(json, "evMinCurrent", data.evMinCurrent);
+    ret = ret && extract(json, "evMinCurrent", data.evMinCurrent, error_message);
 
     // evMaxCurrent
-    extract(json, "evMaxCurrent", data.evMaxCurrent);
+    ret = ret && extract(json, "evMaxCurrent", data.evMaxCurrent, error_message);
 
     // evMaxVoltage
-    extract(json, "evMaxVoltage", data.evMaxVoltage);
+    ret = ret && extract(json, "evMaxVoltage", data.evMaxVoltage, error_message);
 
     if (!ret)
     {
@@ -68,7 +65,9 @@ bool ACChargingParametersTypeConverter::fromJson(const rapidjson::Value&       j
 }
 
 /** @brief Convert a ACChargingParametersType to a JSON representation */
-bool ACChargingParametersTypeConverter::toJson(const ACChargingParametersType& data, rapidjson::Document& json)
+bool ACChargingParametersTypeConverter::toJson(const ACChargingParametersType&     data,
+                                               rapidjson::Value&                   json,
+                                               rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -76,23 +75,22 @@ bool ACChargingParametersTypeConverter::toJson(const ACChargingParametersType& d
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // energyAmount
-    fill(json, "energyAmount", data.energyAmount);
+    fill(json, "energyAmount", data.energyAmount, allocator);
 
     // evMinCurrent
-    fill(json, "evMinCurrent", data.evMinCurrent);
+    fill(json, "evMinCurrent", data.evMinCurrent, allocator);
 
     // evMaxCurrent
-    fill(json, "evMaxCurrent", data.evMaxCurrent);
+    fill(json, "evMaxCurrent", data.evMaxCurrent, allocator);
 
     // evMaxVoltage
-    fill(json, "evMaxVoltage", data.evMaxVoltage);
+    fill(json, "evMaxVoltage", data.evMaxVoltage, allocator);
 
     return ret;
 }
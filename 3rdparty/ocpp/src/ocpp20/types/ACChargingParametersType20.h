@@ -67,17 +67,14 @@ Maximum voltage supported by the electric vehicle */
 class ACChargingParametersTypeConverter : public ocpp::messages::IMessageConverter<ACChargingParametersType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<ACChargingParametersType>* clone() const override { return new ACChargingParametersTypeConverter(); }
-
     /** @brief Convert a ACChargingParametersType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   ACChargingParametersType&     data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a ACChargingParametersType to a JSON representation */
-    bool toJson(const ACChargingParametersType& data, rapidjson::Document& json) override;
+    bool toJson(const ACChargingParametersType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,37 +36,34 @@ namespace ocpp20
 bool APNTypeConverter::fromJson(const rapidjson::Value&       json,
                                 APNType&                      data,
                                 std::string&                  error_code,
-                                [[maybe_unused]] std::string& error_message)
+                                [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // apn
-    extract(json, "apn", data.apn);
+    ret = ret && extract(json, "apn", data.apn, error_message);
 
     // apnUserName
-    extract(json, "apnUserName", data.apnUserName);
+    ret = ret && extract(json, "apnUserName", data.apnUserName, error_message);
 
     // apnPassword
-    extract(json, "apnPassword", data.apnPassword);
+    ret = ret && extract(json, "apnPassword", data.apnPassword, error_message);
 
     // simPin
-    extract(json, "simPin", data.simPin);
+    ret = ret && extract(json, "simPin", data.simPin, error_message);
 
     // preferredNetwork
-    extract(json, "preferredNetwork", data.preferredNetwork);
+    ret = ret && extract(json, "preferredNetwork", data.preferredNetwork, error_message);
 
     // useOnlyPreferredNetwork
-    extract(json, "useOnlyPreferredNetwork", data.useOnlyPreferredNetwork);
+    ret = ret && extract(json, "useOnlyPreferredNetwork", data.useOnlyPreferredNetwork, error_message);
 
     // apnAuthentication
-    data.apnAuthentication = APNAuthenticationEnumTypeHelper.fromString(json["apnAuthentication"].GetString());
+    ret = ret && extract(json, "apnAuthentication", data.apnAuthentication, APNAuthenticationEnumTypeHelper, error_message);
 
     if (!ret)
     {
@@ -77,7 +74,7 @@ bool APNTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a APNType to a JSON representation */
-bool APNTypeConverter::toJson(const APNType& data, rapidjson::Document& json)
+bool APNTypeConverter::toJson(const APNType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -85,32 +82,31 @@ bool APNTypeConverter::toJson(const APNType& data, rapidjson::Document& json)
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // apn
-    fill(json, "apn", data.apn);
+    fill(json, "apn", data.apn, allocator);
 
     // apnUserName
-    fill(json, "apnUserName", data.apnUserName);
+    fill(json, "apnUserName", data.apnUserName, allocator);
 
     // apnPassword
-    fill(json, "apnPassword", data.apnPassword);
+    fill(json, "apnPassword", data.apnPassword, allocator);
 
     // simPin
-    fill(json, "simPin", data.simPin);
+    fill(json, "simPin", data.simPin, allocator);
 
     // preferredNetwork
-    fill(json, "preferredNetwork", data.preferredNetwork);
+    fill(json, "preferredNetwork", data.preferredNetwork, allocator);
 
     // useOnlyPreferredNetwork
-    fill(json, "useOnlyPreferredNetwork", data.useOnlyPreferredNetwork);
+    fill(json, "useOnlyPreferredNetwork", data.useOnlyPreferredNetwork, allocator);
 
     // apnAuthentication
-    fill(json, "apnAuthentication", APNAuthenticationEnumTypeHelper.toString(data.apnAuthentication));
+    fill(json, "apnAuthentication", APNAuthenticationEnumTypeHelper.toString(data.apnAuthentication), allocator);
 
     return ret;
 }
@@ -81,17 +81,14 @@ not dial in when not available. See Note. */
 class APNTypeConverter : public ocpp::messages::IMessageConverter<APNType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<APNType>* clone() const override { return new APNTypeConverter(); }
-
     /** @brief Convert a APNType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   APNType&                      data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a APNType to a JSON representation */
-    bool toJson(const APNType& data, rapidjson::Document& json) override;
+    bool toJson(const APNType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,22 +36,63 @@ namespace ocpp20
 bool AdditionalInfoTypeConverter::fromJson(const rapidjson::Value&       json,
                                            AdditionalInfoType&           data,
                                            std::string&                  error_code,
-                                           [[maybe_unused]] std::string& error_message)
+                                           [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // additionalIdToken
-    extract(json, "additionalIdToken", data.additionalIdToken);
+    ret = ret && extract(json, "additionalIdToken", data.additionalIdToken, error_message);
 
     // type
-    extract(json, "type", data.type);
+    ret = ret && extract(json, "type", data.type, error_message);
+
+    if (!ret)
+    {
+        error_code = ocpp::rpc::IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
+    }
+
+    return ret;
+}
+
+/** @brief Convert a AdditionalInfoType from a JSON stream */
+bool AdditionalInfoTypeConverter::fromJson(ocpp::json::JsonReader&       reader,
+                                           AdditionalInfoType&           data,
+                                           std::string&                  error_code,
+                                           [[maybe_unused]] std::string& error_message) const
+{
+    bool ret                     = true;
+    bool additionalIdToken_found = false;
+    bool type_found              = false;
+
+    while (ret && reader.nextMember())
+    {
+        if (reader.isMember("customData"))
+        {
+            CustomDataTypeConverter customData_converter;
+            ret = convert(reader, "customData", data.customData.value(), customData_converter, error_code, error_message);
+        }
+        else if (reader.isMember("additionalIdToken"))
+        {
+            ret                     = convert(reader, "additionalIdToken", data.additionalIdToken, error_message);
+            additionalIdToken_found = true;
+        }
+        else if (reader.isMember("type"))
+        {
+            ret        = convert(reader, "type", data.type, error_message);
+            type_found = true;
+        }
+        else
+        {
+            ret = reader.skip();
+        }
+    }
+    ret = ret && !reader.hasError();
+    ret = ret && checkRequired("additionalIdToken", additionalIdToken_found, error_message);
+    ret = ret && checkRequired("type", type_found, error_message);
 
     if (!ret)
     {
@@ -62,7 +103,9 @@ bool AdditionalInfoTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a AdditionalInfoType to a JSON representation */
-bool AdditionalInfoTypeConverter::toJson(const AdditionalInfoType& data, rapidjson::Document& json)
+bool AdditionalInfoTypeConverter::toJson(const AdditionalInfoType&           data,
+                                         rapidjson::Value&                   json,
+                                         rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -70,17 +113,16 @@ bool AdditionalInfoTypeConverter::toJson(const AdditionalInfoType& data, rapidjs
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // additionalIdToken
-    fill(json, "additionalIdToken", data.additionalIdToken);
+    fill(json, "additionalIdToken", data.additionalIdToken, allocator);
 
     // type
-    fill(json, "type", data.type);
+    fill(json, "type", data.type, allocator);
 
     return ret;
 }
@@ -53,17 +53,20 @@ struct AdditionalInfoType
 class AdditionalInfoTypeConverter : public ocpp::messages::IMessageConverter<AdditionalInfoType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<AdditionalInfoType>* clone() const override { return new AdditionalInfoTypeConverter(); }
-
     /** @brief Convert a AdditionalInfoType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   AdditionalInfoType&           data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
+
+    /** @brief Convert a AdditionalInfoType from a JSON stream */
+    bool fromJson(ocpp::json::JsonReader&       reader,
+                  AdditionalInfoType&           data,
+                  std::string&                  error_code,
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a AdditionalInfoType to a JSON representation */
-    bool toJson(const AdditionalInfoType& data, rapidjson::Document& json) override;
+    bool toJson(const AdditionalInfoType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
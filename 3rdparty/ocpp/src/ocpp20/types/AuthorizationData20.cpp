@@ -36,27 +36,21 @@ namespace ocpp20
 bool AuthorizationDataConverter::fromJson(const rapidjson::Value&       json,
                                           AuthorizationData&            data,
                                           std::string&                  error_code,
-                                          [[maybe_unused]] std::string& error_message)
+                                          [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // idToken
     IdTokenTypeConverter idToken_converter;
-    ret = ret && idToken_converter.fromJson(json["idToken"], data.idToken, error_code, error_message);
+    ret = ret && extract(json, "idToken", data.idToken, idToken_converter, error_code, error_message);
 
     // idTokenInfo
-    if (json.HasMember("idTokenInfo"))
-    {
-        IdTokenInfoTypeConverter idTokenInfo_converter;
-        ret = ret && idTokenInfo_converter.fromJson(json["idTokenInfo"], data.idTokenInfo, error_code, error_message);
-    }
+    IdTokenInfoTypeConverter idTokenInfo_converter;
+    ret = ret && extract(json, "idTokenInfo", data.idTokenInfo, idTokenInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -67,7 +61,9 @@ bool AuthorizationDataConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a AuthorizationData to a JSON representation */
-bool AuthorizationDataConverter::toJson(const AuthorizationData& data, rapidjson::Document& json)
+bool AuthorizationDataConverter::toJson(const AuthorizationData&            data,
+                                        rapidjson::Value&                   json,
+                                        rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -75,27 +71,24 @@ bool AuthorizationDataConverter::toJson(const AuthorizationData& data, rapidjson
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // idToken
     IdTokenTypeConverter idToken_converter;
-    idToken_converter.setAllocator(allocator);
-    rapidjson::Document idToken_doc(rapidjson::kObjectType);
-    ret = ret && idToken_converter.toJson(data.idToken, idToken_doc);
-    json.AddMember(rapidjson::StringRef("idToken"), idToken_doc.Move(), *allocator);
+    rapidjson::Value     idToken_doc(rapidjson::kObjectType);
+    ret = ret && idToken_converter.toJson(data.idToken, idToken_doc, allocator);
+    json.AddMember(rapidjson::StringRef("idToken"), idToken_doc.Move(), allocator);
 
     // idTokenInfo
     if (data.idTokenInfo.isSet())
     {
         IdTokenInfoTypeConverter idTokenInfo_converter;
-        idTokenInfo_converter.setAllocator(allocator);
-        rapidjson::Document idTokenInfo_doc(rapidjson::kObjectType);
-        ret = ret && idTokenInfo_converter.toJson(data.idTokenInfo, idTokenInfo_doc);
-        json.AddMember(rapidjson::StringRef("idTokenInfo"), idTokenInfo_doc.Move(), *allocator);
+        rapidjson::Value         idTokenInfo_doc(rapidjson::kObjectType);
+        ret = ret && idTokenInfo_converter.toJson(data.idTokenInfo, idTokenInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("idTokenInfo"), idTokenInfo_doc.Move(), allocator);
     }
 
     return ret;
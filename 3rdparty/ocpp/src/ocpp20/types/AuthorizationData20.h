@@ -54,17 +54,14 @@ struct AuthorizationData
 class AuthorizationDataConverter : public ocpp::messages::IMessageConverter<AuthorizationData>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<AuthorizationData>* clone() const override { return new AuthorizationDataConverter(); }
-
     /** @brief Convert a AuthorizationData from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   AuthorizationData&            data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a AuthorizationData to a JSON representation */
-    bool toJson(const AuthorizationData& data, rapidjson::Document& json) override;
+    bool toJson(const AuthorizationData& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
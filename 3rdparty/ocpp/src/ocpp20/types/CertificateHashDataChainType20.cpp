@@ -36,33 +36,35 @@ namespace ocpp20
 bool CertificateHashDataChainTypeConverter::fromJson(const rapidjson::Value&       json,
                                                      CertificateHashDataChainType& data,
                                                      std::string&                  error_code,
-                                                     [[maybe_unused]] std::string& error_message)
+                                                     [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // certificateHashData
     CertificateHashDataTypeConverter certificateHashData_converter;
-    ret = ret && certificateHashData_converter.fromJson(json["certificateHashData"], data.certificateHashData, error_code, error_message);
+    ret = ret && extract(json, "certificateHashData", data.certificateHashData, certificateHashData_converter, error_code, error_message);
 
     // certificateType
-    data.certificateType = GetCertificateIdUseEnumTypeHelper.fromString(json["certificateType"].GetString());
+    ret = ret && extract(json, "certificateType", data.certificateType, GetCertificateIdUseEnumTypeHelper, error_message);
 
     // childCertificateHashData
-    if (json.HasMember("childCertificateHashData"))
+    ret = ret && checkArray(json, "childCertificateHashData", false, 1u, 4u, error_message);
+    if (ret && json.HasMember("childCertificateHashData"))
     {
         const rapidjson::Value&          childCertificateHashData_json = json["childCertificateHashData"];
         CertificateHashDataTypeConverter childCertificateHashData_converter;
         for (auto it = childCertificateHashData_json.Begin(); ret && (it != childCertificateHashData_json.End()); ++it)
         {
-            CertificateHashDataType& item = data.childCertificateHashData.emplace_back();
-            ret                           = ret && childCertificateHashData_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it,
+                          "childCertificateHashData",
+                          data.childCertificateHashData.emplace_back(),
+                          childCertificateHashData_converter,
+                          error_code,
+                          error_message);
         }
     }
 
@@ -75,7 +77,9 @@ bool CertificateHashDataChainTypeConverter::fromJson(const rapidjson::Value&
 }
 
 /** @brief Convert a CertificateHashDataChainType to a JSON representation */
-bool CertificateHashDataChainTypeConverter::toJson(const CertificateHashDataChainType& data, rapidjson::Document& json)
+bool CertificateHashDataChainTypeConverter::toJson(const CertificateHashDataChainType& data,
+                                                   rapidjson::Value&                   json,
+                                                   rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -83,21 +87,19 @@ bool CertificateHashDataChainTypeConverter::toJson(const CertificateHashDataChai
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // certificateHashData
     CertificateHashDataTypeConverter certificateHashData_converter;
-    certificateHashData_converter.setAllocator(allocator);
-    rapidjson::Document certificateHashData_doc(rapidjson::kObjectType);
-    ret = ret && certificateHashData_converter.toJson(data.certificateHashData, certificateHashData_doc);
-    json.AddMember(rapidjson::StringRef("certificateHashData"), certificateHashData_doc.Move(), *allocator);
+    rapidjson::Value                 certificateHashData_doc(rapidjson::kObjectType);
+    ret = ret && certificateHashData_converter.toJson(data.certificateHashData, certificateHashData_doc, allocator);
+    json.AddMember(rapidjson::StringRef("certificateHashData"), certificateHashData_doc.Move(), allocator);
 
     // certificateType
-    fill(json, "certificateType", GetCertificateIdUseEnumTypeHelper.toString(data.certificateType));
+    fill(json, "certificateType", GetCertificateIdUseEnumTypeHelper.toString(data.certificateType), allocator);
 
     // childCertificateHashData
     if (!data.childCertificateHashData.empty())
@@ -105,14 +107,13 @@ bool CertificateHashDataChainTypeConverter::toJson(const CertificateHashDataChai
 
         rapidjson::Value                 childCertificateHashData_json(rapidjson::kArrayType);
         CertificateHashDataTypeConverter childCertificateHashData_converter;
-        childCertificateHashData_converter.setAllocator(allocator);
         for (const CertificateHashDataType& item : data.childCertificateHashData)
         {
-            rapidjson::Document item_doc(rapidjson::kObjectType);
-            ret = ret && childCertificateHashData_converter.toJson(item, item_doc);
-            childCertificateHashData_json.PushBack(item_doc.Move(), *allocator);
+            rapidjson::Value item_doc(rapidjson::kObjectType);
+            ret = ret && childCertificateHashData_converter.toJson(item, item_doc, allocator);
+            childCertificateHashData_json.PushBack(item_doc.Move(), allocator);
         }
-        json.AddMember(rapidjson::StringRef("childCertificateHashData"), childCertificateHashData_json.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("childCertificateHashData"), childCertificateHashData_json.Move(), allocator);
     }
 
     return ret;
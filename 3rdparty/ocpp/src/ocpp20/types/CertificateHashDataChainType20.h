@@ -56,20 +56,16 @@ struct CertificateHashDataChainType
 class CertificateHashDataChainTypeConverter : public ocpp::messages::IMessageConverter<CertificateHashDataChainType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<CertificateHashDataChainType>* clone() const override
-    {
-        return new CertificateHashDataChainTypeConverter();
-    }
-
     /** @brief Convert a CertificateHashDataChainType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   CertificateHashDataChainType& data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a CertificateHashDataChainType to a JSON representation */
-    bool toJson(const CertificateHashDataChainType& data, rapidjson::Document& json) override;
+    bool toJson(const CertificateHashDataChainType& data,
+                rapidjson::Value&                   json,
+                rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
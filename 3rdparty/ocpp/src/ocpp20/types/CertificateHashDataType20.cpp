@@ -36,28 +36,25 @@ namespace ocpp20
 bool CertificateHashDataTypeConverter::fromJson(const rapidjson::Value&       json,
                                                 CertificateHashDataType&      data,
                                                 std::string&                  error_code,
-                                                [[maybe_unused]] std::string& error_message)
+                                                [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // hashAlgorithm
-    data.hashAlgorithm = HashAlgorithmEnumTypeHelper.fromString(json["hashAlgorithm"].GetString());
+    ret = ret && extract(json, "hashAlgorithm", data.hashAlgorithm, HashAlgorithmEnumTypeHelper, error_message);
 
     // issuerNameHash
-    extract(json, "issuerNameHash", data.issuerNameHash);
+    ret = ret && extract(json, "issuerNameHash", data.issuerNameHash, error_message);
 
     // issuerKeyHash
-    extract(json, "issuerKeyHash", data.issuerKeyHash);
+    ret = ret && extract(json, "issuerKeyHash", data.issuerKeyHash, error_message);
 
     // serialNumber
-    extract(json, "serialNumber", data.serialNumber);
+    ret = ret && extract(json, "serialNumber", data.serialNumber, error_message);
 
     if (!ret)
     {
@@ -68,7 +65,9 @@ bool CertificateHashDataTypeConverter::fromJson(const rapidjson::Value&       js
 }
 
 /** @brief Convert a CertificateHashDataType to a JSON representation */
-bool CertificateHashDataTypeConverter::toJson(const CertificateHashDataType& data, rapidjson::Document& json)
+bool CertificateHashDataTypeConverter::toJson(const CertificateHashDataType&      data,
+                                              rapidjson::Value&                   json,
+                                              rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -76,23 +75,22 @@ bool CertificateHashDataTypeConverter::toJson(const CertificateHashDataType& dat
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // hashAlgorithm
-    fill(json, "hashAlgorithm", HashAlgorithmEnumTypeHelper.toString(data.hashAlgorithm));
+    fill(json, "hashAlgorithm", HashAlgorithmEnumTypeHelper.toString(data.hashAlgorithm), allocator);
 
     // issuerNameHash
-    fill(json, "issuerNameHash", data.issuerNameHash);
+    fill(json, "issuerNameHash", data.issuerNameHash, allocator);
 
     // issuerKeyHash
-    fill(json, "issuerKeyHash", data.issuerKeyHash);
+    fill(json, "issuerKeyHash", data.issuerKeyHash, allocator);
 
     // serialNumber
-    fill(json, "serialNumber", data.serialNumber);
+    fill(json, "serialNumber", data.serialNumber, allocator);
 
     return ret;
 }
@@ -57,17 +57,14 @@ struct CertificateHashDataType
 class CertificateHashDataTypeConverter : public ocpp::messages::IMessageConverter<CertificateHashDataType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<CertificateHashDataType>* clone() const override { return new CertificateHashDataTypeConverter(); }
-
     /** @brief Convert a CertificateHashDataType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   CertificateHashDataType&      data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a CertificateHashDataType to a JSON representation */
-    bool toJson(const CertificateHashDataType& data, rapidjson::Document& json) override;
+    bool toJson(const CertificateHashDataType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
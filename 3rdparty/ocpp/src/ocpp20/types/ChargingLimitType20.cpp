@@ -36,22 +36,19 @@ namespace ocpp20
 bool ChargingLimitTypeConverter::fromJson(const rapidjson::Value&       json,
                                           ChargingLimitType&            data,
                                           std::string&                  error_code,
-                                          [[maybe_unused]] std::string& error_message)
+                                          [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // chargingLimitSource
-    data.chargingLimitSource = ChargingLimitSourceEnumTypeHelper.fromString(json["chargingLimitSource"].GetString());
+    ret = ret && extract(json, "chargingLimitSource", data.chargingLimitSource, ChargingLimitSourceEnumTypeHelper, error_message);
 
     // isGridCritical
-    extract(json, "isGridCritical", data.isGridCritical);
+    ret = ret && extract(json, "isGridCritical", data.isGridCritical, error_message);
 
     if (!ret)
     {
@@ -62,7 +59,9 @@ bool ChargingLimitTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a ChargingLimitType to a JSON representation */
-bool ChargingLimitTypeConverter::toJson(const ChargingLimitType& data, rapidjson::Document& json)
+bool ChargingLimitTypeConverter::toJson(const ChargingLimitType&            data,
+                                        rapidjson::Value&                   json,
+                                        rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -70,17 +69,16 @@ bool ChargingLimitTypeConverter::toJson(const ChargingLimitType& data, rapidjson
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // chargingLimitSource
-    fill(json, "chargingLimitSource", ChargingLimitSourceEnumTypeHelper.toString(data.chargingLimitSource));
+    fill(json, "chargingLimitSource", ChargingLimitSourceEnumTypeHelper.toString(data.chargingLimitSource), allocator);
 
     // isGridCritical
-    fill(json, "isGridCritical", data.isGridCritical);
+    fill(json, "isGridCritical", data.isGridCritical, allocator);
 
     return ret;
 }
@@ -56,17 +56,14 @@ Indicates whether the charging limit is critical for the grid. */
 class ChargingLimitTypeConverter : public ocpp::messages::IMessageConverter<ChargingLimitType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<ChargingLimitType>* clone() const override { return new ChargingLimitTypeConverter(); }
-
     /** @brief Convert a ChargingLimitType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   ChargingLimitType&            data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a ChargingLimitType to a JSON representation */
-    bool toJson(const ChargingLimitType& data, rapidjson::Document& json) override;
+    bool toJson(const ChargingLimitType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,35 +36,26 @@ namespace ocpp20
 bool ChargingNeedsTypeConverter::fromJson(const rapidjson::Value&       json,
                                           ChargingNeedsType&            data,
                                           std::string&                  error_code,
-                                          [[maybe_unused]] std::string& error_message)
+                                          [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // acChargingParameters
-    if (json.HasMember("acChargingParameters"))
-    {
-        ACChargingParametersTypeConverter acChargingParameters_converter;
-        ret = ret &&
-              acChargingParameters_converter.fromJson(json["acChargingParameters"], data.acChargingParameters, error_code, error_message);
-    }
+    ACChargingParametersTypeConverter acChargingParameters_converter;
+    ret = ret &&
+          extract(json, "acChargingParameters", data.acChargingParameters, acChargingParameters_converter, error_code, error_message);
 
     // dcChargingParameters
-    if (json.HasMember("dcChargingParameters"))
-    {
-        DCChargingParametersTypeConverter dcChargingParameters_converter;
-        ret = ret &&
-              dcChargingParameters_converter.fromJson(json["dcChargingParameters"], data.dcChargingParameters, error_code, error_message);
-    }
+    DCChargingParametersTypeConverter dcChargingParameters_converter;
+    ret = ret &&
+          extract(json, "dcChargingParameters", data.dcChargingParameters, dcChargingParameters_converter, error_code, error_message);
 
     // requestedEnergyTransfer
-    data.requestedEnergyTransfer = EnergyTransferModeEnumTypeHelper.fromString(json["requestedEnergyTransfer"].GetString());
+    ret = ret && extract(json, "requestedEnergyTransfer", data.requestedEnergyTransfer, EnergyTransferModeEnumTypeHelper, error_message);
 
     // departureTime
     ret = ret && extract(json, "departureTime", data.departureTime, error_message);
@@ -78,7 +69,9 @@ bool ChargingNeedsTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a ChargingNeedsType to a JSON representation */
-bool ChargingNeedsTypeConverter::toJson(const ChargingNeedsType& data, rapidjson::Document& json)
+bool ChargingNeedsTypeConverter::toJson(const ChargingNeedsType&            data,
+                                        rapidjson::Value&                   json,
+                                        rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -86,37 +79,34 @@ bool ChargingNeedsTypeConverter::toJson(const ChargingNeedsType& data, rapidjson
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // acChargingParameters
     if (data.acChargingParameters.isSet())
     {
         ACChargingParametersTypeConverter acChargingParameters_converter;
-        acChargingParameters_converter.setAllocator(allocator);
-        rapidjson::Document acChargingParameters_doc(rapidjson::kObjectType);
-        ret = ret && acChargingParameters_converter.toJson(data.acChargingParameters, acChargingParameters_doc);
-        json.AddMember(rapidjson::StringRef("acChargingParameters"), acChargingParameters_doc.Move(), *allocator);
+        rapidjson::Value                  acChargingParameters_doc(rapidjson::kObjectType);
+        ret = ret && acChargingParameters_converter.toJson(data.acChargingParameters, acChargingParameters_doc, allocator);
+        json.AddMember(rapidjson::StringRef("acChargingParameters"), acChargingParameters_doc.Move(), allocator);
     }
 
     // dcChargingParameters
     if (data.dcChargingParameters.isSet())
     {
         DCChargingParametersTypeConverter dcChargingParameters_converter;
-        dcChargingParameters_converter.setAllocator(allocator);
-        rapidjson::Document dcChargingParameters_doc(rapidjson::kObjectType);
-        ret = ret && dcChargingParameters_converter.toJson(data.dcChargingParameters, dcChargingParameters_doc);
-        json.AddMember(rapidjson::StringRef("dcChargingParameters"), dcChargingParameters_doc.Move(), *allocator);
+        rapidjson::Value                  dcChargingParameters_doc(rapidjson::kObjectType);
+        ret = ret && dcChargingParameters_converter.toJson(data.dcChargingParameters, dcChargingParameters_doc, allocator);
+        json.AddMember(rapidjson::StringRef("dcChargingParameters"), dcChargingParameters_doc.Move(), allocator);
     }
 
     // requestedEnergyTransfer
-    fill(json, "requestedEnergyTransfer", EnergyTransferModeEnumTypeHelper.toString(data.requestedEnergyTransfer));
+    fill(json, "requestedEnergyTransfer", EnergyTransferModeEnumTypeHelper.toString(data.requestedEnergyTransfer), allocator);
 
     // departureTime
-    fill(json, "departureTime", data.departureTime);
+    fill(json, "departureTime", data.departureTime, allocator);
 
     return ret;
 }
@@ -63,17 +63,14 @@ Estimated departure time of the EV. */
 class ChargingNeedsTypeConverter : public ocpp::messages::IMessageConverter<ChargingNeedsType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<ChargingNeedsType>* clone() const override { return new ChargingNeedsTypeConverter(); }
-
     /** @brief Convert a ChargingNeedsType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   ChargingNeedsType&            data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a ChargingNeedsType to a JSON representation */
-    bool toJson(const ChargingNeedsType& data, rapidjson::Document& json) override;
+    bool toJson(const ChargingNeedsType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
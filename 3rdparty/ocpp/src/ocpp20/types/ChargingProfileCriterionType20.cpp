@@ -36,45 +36,43 @@ namespace ocpp20
 bool ChargingProfileCriterionTypeConverter::fromJson(const rapidjson::Value&       json,
                                                      ChargingProfileCriterionType& data,
                                                      std::string&                  error_code,
-                                                     [[maybe_unused]] std::string& error_message)
+                                                     [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // chargingProfilePurpose
-    if (json.HasMember("chargingProfilePurpose"))
-    {
-        data.chargingProfilePurpose = ChargingProfilePurposeEnumTypeHelper.fromString(json["chargingProfilePurpose"].GetString());
-    }
+    ret = ret && extract(json, "chargingProfilePurpose", data.chargingProfilePurpose, ChargingProfilePurposeEnumTypeHelper, error_message);
 
     // stackLevel
-    extract(json, "stackLevel", data.stackLevel);
+    ret = ret && extract(json, "stackLevel", data.stackLevel, error_message);
 
     // chargingProfileId
-    if (json.HasMember("chargingProfileId"))
+    ret = ret && checkArray(json, "chargingProfileId", false, 1u, 0u, error_message);
+    if (ret && json.HasMember("chargingProfileId"))
     {
         const rapidjson::Value& chargingProfileId_json = json["chargingProfileId"];
         for (auto it = chargingProfileId_json.Begin(); ret && (it != chargingProfileId_json.End()); ++it)
         {
-            int& item = data.chargingProfileId.emplace_back();
-            item      = it->GetInt();
+            ret = convert(*it, "chargingProfileId", data.chargingProfileId.emplace_back(), error_message);
         }
     }
 
     // chargingLimitSource
-    if (json.HasMember("chargingLimitSource"))
+    ret = ret && checkArray(json, "chargingLimitSource", false, 1u, 4u, error_message);
+    if (ret && json.HasMember("chargingLimitSource"))
     {
         const rapidjson::Value& chargingLimitSource_json = json["chargingLimitSource"];
         for (auto it = chargingLimitSource_json.Begin(); ret && (it != chargingLimitSource_json.End()); ++it)
         {
-            ChargingLimitSourceEnumType& item = data.chargingLimitSource.emplace_back();
-            item                              = ChargingLimitSourceEnumTypeHelper.fromString(it->GetString());
+            ret = convert(*it,
+                          "chargingLimitSource",
+                          data.chargingLimitSource.emplace_back(),
+                          ChargingLimitSourceEnumTypeHelper,
+                          error_message);
         }
     }
 
@@ -87,7 +85,9 @@ bool ChargingProfileCriterionTypeConverter::fromJson(const rapidjson::Value&
 }
 
 /** @brief Convert a ChargingProfileCriterionType to a JSON representation */
-bool ChargingProfileCriterionTypeConverter::toJson(const ChargingProfileCriterionType& data, rapidjson::Document& json)
+bool ChargingProfileCriterionTypeConverter::toJson(const ChargingProfileCriterionType& data,
+                                                   rapidjson::Value&                   json,
+                                                   rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -95,20 +95,19 @@ bool ChargingProfileCriterionTypeConverter::toJson(const ChargingProfileCriterio
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // chargingProfilePurpose
     if (data.chargingProfilePurpose.isSet())
     {
-        fill(json, "chargingProfilePurpose", ChargingProfilePurposeEnumTypeHelper.toString(data.chargingProfilePurpose));
+        fill(json, "chargingProfilePurpose", ChargingProfilePurposeEnumTypeHelper.toString(data.chargingProfilePurpose), allocator);
     }
 
     // stackLevel
-    fill(json, "stackLevel", data.stackLevel);
+    fill(json, "stackLevel", data.stackLevel, allocator);
 
     // chargingProfileId
     if (!data.chargingProfileId.empty())
@@ -117,9 +116,9 @@ bool ChargingProfileCriterionTypeConverter::toJson(const ChargingProfileCriterio
         rapidjson::Value chargingProfileId_json(rapidjson::kArrayType);
         for (const int& item : data.chargingProfileId)
         {
-            chargingProfileId_json.PushBack(rapidjson::Value(item), *allocator);
+            chargingProfileId_json.PushBack(rapidjson::Value(item), allocator);
         }
-        json.AddMember(rapidjson::StringRef("chargingProfileId"), chargingProfileId_json.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("chargingProfileId"), chargingProfileId_json.Move(), allocator);
     }
 
     // chargingLimitSource
@@ -129,10 +128,10 @@ bool ChargingProfileCriterionTypeConverter::toJson(const ChargingProfileCriterio
         rapidjson::Value chargingLimitSource_json(rapidjson::kArrayType);
         for (const ChargingLimitSourceEnumType& item : data.chargingLimitSource)
         {
-            chargingLimitSource_json.PushBack(rapidjson::Value(ChargingLimitSourceEnumTypeHelper.toString(item).c_str(), *allocator).Move(),
-                                              *allocator);
+            chargingLimitSource_json.PushBack(rapidjson::Value(ChargingLimitSourceEnumTypeHelper.toString(item).c_str(), allocator).Move(),
+                                              allocator);
         }
-        json.AddMember(rapidjson::StringRef("chargingLimitSource"), chargingLimitSource_json.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("chargingLimitSource"), chargingLimitSource_json.Move(), allocator);
     }
 
     return ret;
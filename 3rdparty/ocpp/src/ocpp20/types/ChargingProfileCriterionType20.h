@@ -63,20 +63,16 @@ Value determining level in hierarchy stack of profiles. Higher values have prece
 class ChargingProfileCriterionTypeConverter : public ocpp::messages::IMessageConverter<ChargingProfileCriterionType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<ChargingProfileCriterionType>* clone() const override
-    {
-        return new ChargingProfileCriterionTypeConverter();
-    }
-
     /** @brief Convert a ChargingProfileCriterionType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   ChargingProfileCriterionType& data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a ChargingProfileCriterionType to a JSON representation */
-    bool toJson(const ChargingProfileCriterionType& data, rapidjson::Document& json) override;
+    bool toJson(const ChargingProfileCriterionType& data,
+                rapidjson::Value&                   json,
+                rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,34 +36,28 @@ namespace ocpp20
 bool ChargingProfileTypeConverter::fromJson(const rapidjson::Value&       json,
                                             ChargingProfileType&          data,
                                             std::string&                  error_code,
-                                            [[maybe_unused]] std::string& error_message)
+                                            [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // id
-    extract(json, "id", data.id);
+    ret = ret && extract(json, "id", data.id, error_message);
 
     // stackLevel
-    extract(json, "stackLevel", data.stackLevel);
+    ret = ret && extract(json, "stackLevel", data.stackLevel, error_message);
 
     // chargingProfilePurpose
-    data.chargingProfilePurpose = ChargingProfilePurposeEnumTypeHelper.fromString(json["chargingProfilePurpose"].GetString());
+    ret = ret && extract(json, "chargingProfilePurpose", data.chargingProfilePurpose, ChargingProfilePurposeEnumTypeHelper, error_message);
 
     // chargingProfileKind
-    data.chargingProfileKind = ChargingProfileKindEnumTypeHelper.fromString(json["chargingProfileKind"].GetString());
+    ret = ret && extract(json, "chargingProfileKind", data.chargingProfileKind, ChargingProfileKindEnumTypeHelper, error_message);
 
     // recurrencyKind
-    if (json.HasMember("recurrencyKind"))
-    {
-        data.recurrencyKind = RecurrencyKindEnumTypeHelper.fromString(json["recurrencyKind"].GetString());
-    }
+    ret = ret && extract(json, "recurrencyKind", data.recurrencyKind, RecurrencyKindEnumTypeHelper, error_message);
 
     // validFrom
     ret = ret && extract(json, "validFrom", data.validFrom, error_message);
@@ -72,19 +66,24 @@ bool ChargingProfileTypeConverter::fromJson(const rapidjson::Value&       json,
     ret = ret && extract(json, "validTo", data.validTo, error_message);
 
     // chargingSchedule
-    if (json.HasMember("chargingSchedule"))
+    ret = ret && checkArray(json, "chargingSchedule", true, 1u, 3u, error_message);
+    if (ret && json.HasMember("chargingSchedule"))
     {
         const rapidjson::Value&       chargingSchedule_json = json["chargingSchedule"];
         ChargingScheduleTypeConverter chargingSchedule_converter;
         for (auto it = chargingSchedule_json.Begin(); ret && (it != chargingSchedule_json.End()); ++it)
         {
-            ChargingScheduleType& item = data.chargingSchedule.emplace_back();
-            ret                        = ret && chargingSchedule_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it,
+                          "chargingSchedule",
+                          data.chargingSchedule.emplace_back(),
+                          chargingSchedule_converter,
+                          error_code,
+                          error_message);
         }
     }
 
     // transactionId
-    extract(json, "transactionId", data.transactionId);
+    ret = ret && extract(json, "transactionId", data.transactionId, error_message);
 
     if (!ret)
     {
@@ -95,7 +94,9 @@ bool ChargingProfileTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a ChargingProfileType to a JSON representation */
-bool ChargingProfileTypeConverter::toJson(const ChargingProfileType& data, rapidjson::Document& json)
+bool ChargingProfileTypeConverter::toJson(const ChargingProfileType&          data,
+                                          rapidjson::Value&                   json,
+                                          rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -103,51 +104,49 @@ bool ChargingProfileTypeConverter::toJson(const ChargingProfileType& data, rapid
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // id
-    fill(json, "id", data.id);
+    fill(json, "id", data.id, allocator);
 
     // stackLevel
-    fill(json, "stackLevel", data.stackLevel);
+    fill(json, "stackLevel", data.stackLevel, allocator);
 
     // chargingProfilePurpose
-    fill(json, "chargingProfilePurpose", ChargingProfilePurposeEnumTypeHelper.toString(data.chargingProfilePurpose));
+    fill(json, "chargingProfilePurpose", ChargingProfilePurposeEnumTypeHelper.toString(data.chargingProfilePurpose), allocator);
 
     // chargingProfileKind
-    fill(json, "chargingProfileKind", ChargingProfileKindEnumTypeHelper.toString(data.chargingProfileKind));
+    fill(json, "chargingProfileKind", ChargingProfileKindEnumTypeHelper.toString(data.chargingProfileKind), allocator);
 
     // recurrencyKind
     if (data.recurrencyKind.isSet())
     {
-        fill(json, "recurrencyKind", RecurrencyKindEnumTypeHelper.toString(data.recurrencyKind));
+        fill(json, "recurrencyKind", RecurrencyKindEnumTypeHelper.toString(data.recurrencyKind), allocator);
     }
 
     // validFrom
-    fill(json, "validFrom", data.validFrom);
+    fill(json, "validFrom", data.validFrom, allocator);
 
     // validTo
-    fill(json, "validTo", data.validTo);
+    fill(json, "validTo", data.validTo, allocator);
 
     // chargingSchedule
 
     rapidjson::Value              chargingSchedule_json(rapidjson::kArrayType);
     ChargingScheduleTypeConverter chargingSchedule_converter;
-    chargingSchedule_converter.setAllocator(allocator);
     for (const ChargingScheduleType& item : data.chargingSchedule)
     {
-        rapidjson::Document item_doc(rapidjson::kObjectType);
-        ret = ret && chargingSchedule_converter.toJson(item, item_doc);
-        chargingSchedule_json.PushBack(item_doc.Move(), *allocator);
+        rapidjson::Value item_doc(rapidjson::kObjectType);
+        ret = ret && chargingSchedule_converter.toJson(item, item_doc, allocator);
+        chargingSchedule_json.PushBack(item_doc.Move(), allocator);
     }
-    json.AddMember(rapidjson::StringRef("chargingSchedule"), chargingSchedule_json.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("chargingSchedule"), chargingSchedule_json.Move(), allocator);
 
     // transactionId
-    fill(json, "transactionId", data.transactionId);
+    fill(json, "transactionId", data.transactionId, allocator);
 
     return ret;
 }
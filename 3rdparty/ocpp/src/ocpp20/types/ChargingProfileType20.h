@@ -83,17 +83,14 @@ Point in time at which the profile stops to be valid. If absent, the profile is
 class ChargingProfileTypeConverter : public ocpp::messages::IMessageConverter<ChargingProfileType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<ChargingProfileType>* clone() const override { return new ChargingProfileTypeConverter(); }
-
     /** @brief Convert a ChargingProfileType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   ChargingProfileType&          data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a ChargingProfileType to a JSON representation */
-    bool toJson(const ChargingProfileType& data, rapidjson::Document& json) override;
+    bool toJson(const ChargingProfileType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
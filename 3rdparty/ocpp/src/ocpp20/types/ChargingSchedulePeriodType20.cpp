@@ -36,28 +36,25 @@ namespace ocpp20
 bool ChargingSchedulePeriodTypeConverter::fromJson(const rapidjson::Value&       json,
                                                    ChargingSchedulePeriodType&   data,
                                                    std::string&                  error_code,
-                                                   [[maybe_unused]] std::string& error_message)
+                                                   [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // startPeriod
-    extract(json, "startPeriod", data.startPeriod);
+    ret = ret && extract(json, "startPeriod", data.startPeriod, error_message);
 
     // limit
-    extract(json, "limit", data.limit);
+    ret = ret && extract(json, "limit", data.limit, error_message);
 
     // numberPhases
-    extract(json, "numberPhases", data.numberPhases);
+    ret = ret && extract(json, "numberPhases", data.numberPhases, error_message);
 
     // phaseToUse
-    extract(json, "phaseToUse", data.phaseToUse);
+    ret = ret && extract(json, "phaseToUse", data.phaseToUse, error_message);
 
     if (!ret)
     {
@@ -68,7 +65,9 @@ bool ChargingSchedulePeriodTypeConverter::fromJson(const rapidjson::Value&
 }
 
 /** @brief Convert a ChargingSchedulePeriodType to a JSON representation */
-bool ChargingSchedulePeriodTypeConverter::toJson(const ChargingSchedulePeriodType& data, rapidjson::Document& json)
+bool ChargingSchedulePeriodTypeConverter::toJson(const ChargingSchedulePeriodType&   data,
+                                                 rapidjson::Value&                   json,
+                                                 rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -76,23 +75,22 @@ bool ChargingSchedulePeriodTypeConverter::toJson(const ChargingSchedulePeriodTyp
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // startPeriod
-    fill(json, "startPeriod", data.startPeriod);
+    fill(json, "startPeriod", data.startPeriod, allocator);
 
     // limit
-    fill(json, "limit", data.limit);
+    fill(json, "limit", data.limit, allocator);
 
     // numberPhases
-    fill(json, "numberPhases", data.numberPhases);
+    fill(json, "numberPhases", data.numberPhases, allocator);
 
     // phaseToUse
-    fill(json, "phaseToUse", data.phaseToUse);
+    fill(json, "phaseToUse", data.phaseToUse, allocator);
 
     return ret;
 }
@@ -64,20 +64,16 @@ The number of phases that can be used for charging. If a number of phases is nee
 class ChargingSchedulePeriodTypeConverter : public ocpp::messages::IMessageConverter<ChargingSchedulePeriodType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<ChargingSchedulePeriodType>* clone() const override
-    {
-        return new ChargingSchedulePeriodTypeConverter();
-    }
-
     /** @brief Convert a ChargingSchedulePeriodType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   ChargingSchedulePeriodType&   data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a ChargingSchedulePeriodType to a JSON representation */
-    bool toJson(const ChargingSchedulePeriodType& data, rapidjson::Document& json) override;
+    bool toJson(const ChargingSchedulePeriodType&   data,
+                rapidjson::Value&                   json,
+                rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,50 +36,49 @@ namespace ocpp20
 bool ChargingScheduleTypeConverter::fromJson(const rapidjson::Value&       json,
                                              ChargingScheduleType&         data,
                                              std::string&                  error_code,
-                                             [[maybe_unused]] std::string& error_message)
+                                             [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // id
-    extract(json, "id", data.id);
+    ret = ret && extract(json, "id", data.id, error_message);
 
     // startSchedule
     ret = ret && extract(json, "startSchedule", data.startSchedule, error_message);
 
     // duration
-    extract(json, "duration", data.duration);
+    ret = ret && extract(json, "duration", data.duration, error_message);
 
     // chargingRateUnit
-    data.chargingRateUnit = ChargingRateUnitEnumTypeHelper.fromString(json["chargingRateUnit"].GetString());
+    ret = ret && extract(json, "chargingRateUnit", data.chargingRateUnit, ChargingRateUnitEnumTypeHelper, error_message);
 
     // chargingSchedulePeriod
-    if (json.HasMember("chargingSchedulePeriod"))
+    ret = ret && checkArray(json, "chargingSchedulePeriod", true, 1u, 1024u, error_message);
+    if (ret && json.HasMember("chargingSchedulePeriod"))
     {
         const rapidjson::Value&             chargingSchedulePeriod_json = json["chargingSchedulePeriod"];
         ChargingSchedulePeriodTypeConverter chargingSchedulePeriod_converter;
         for (auto it = chargingSchedulePeriod_json.Begin(); ret && (it != chargingSchedulePeriod_json.End()); ++it)
         {
-            ChargingSchedulePeriodType& item = data.chargingSchedulePeriod.emplace_back();
-            ret                              = ret && chargingSchedulePeriod_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it,
+                          "chargingSchedulePeriod",
+                          data.chargingSchedulePeriod.emplace_back(),
+                          chargingSchedulePeriod_converter,
+                          error_code,
+                          error_message);
         }
     }
 
     // minChargingRate
-    extract(json, "minChargingRate", data.minChargingRate);
+    ret = ret && extract(json, "minChargingRate", data.minChargingRate, error_message);
 
     // salesTariff
-    if (json.HasMember("salesTariff"))
-    {
-        SalesTariffTypeConverter salesTariff_converter;
-        ret = ret && salesTariff_converter.fromJson(json["salesTariff"], data.salesTariff, error_code, error_message);
-    }
+    SalesTariffTypeConverter salesTariff_converter;
+    ret = ret && extract(json, "salesTariff", data.salesTariff, salesTariff_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -90,7 +89,9 @@ bool ChargingScheduleTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a ChargingScheduleType to a JSON representation */
-bool ChargingScheduleTypeConverter::toJson(const ChargingScheduleType& data, rapidjson::Document& json)
+bool ChargingScheduleTypeConverter::toJson(const ChargingScheduleType&         data,
+                                           rapidjson::Value&                   json,
+                                           rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -98,48 +99,45 @@ bool ChargingScheduleTypeConverter::toJson(const ChargingScheduleType& data, rap
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // id
-    fill(json, "id", data.id);
+    fill(json, "id", data.id, allocator);
 
     // startSchedule
-    fill(json, "startSchedule", data.startSchedule);
+    fill(json, "startSchedule", data.startSchedule, allocator);
 
     // duration
-    fill(json, "duration", data.duration);
+    fill(json, "duration", data.duration, allocator);
 
     // chargingRateUnit
-    fill(json, "chargingRateUnit", ChargingRateUnitEnumTypeHelper.toString(data.chargingRateUnit));
+    fill(json, "chargingRateUnit", ChargingRateUnitEnumTypeHelper.toString(data.chargingRateUnit), allocator);
 
     // chargingSchedulePeriod
 
     rapidjson::Value                    chargingSchedulePeriod_json(rapidjson::kArrayType);
     ChargingSchedulePeriodTypeConverter chargingSchedulePeriod_converter;
-    chargingSchedulePeriod_converter.setAllocator(allocator);
     for (const ChargingSchedulePeriodType& item : data.chargingSchedulePeriod)
     {
-        rapidjson::Document item_doc(rapidjson::kObjectType);
-        ret = ret && chargingSchedulePeriod_converter.toJson(item, item_doc);
-        chargingSchedulePeriod_json.PushBack(item_doc.Move(), *allocator);
+        rapidjson::Value item_doc(rapidjson::kObjectType);
+        ret = ret && chargingSchedulePeriod_converter.toJson(item, item_doc, allocator);
+        chargingSchedulePeriod_json.PushBack(item_doc.Move(), allocator);
     }
-    json.AddMember(rapidjson::StringRef("chargingSchedulePeriod"), chargingSchedulePeriod_json.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("chargingSchedulePeriod"), chargingSchedulePeriod_json.Move(), allocator);
 
     // minChargingRate
-    fill(json, "minChargingRate", data.minChargingRate);
+    fill(json, "minChargingRate", data.minChargingRate, allocator);
 
     // salesTariff
     if (data.salesTariff.isSet())
     {
         SalesTariffTypeConverter salesTariff_converter;
-        salesTariff_converter.setAllocator(allocator);
-        rapidjson::Document salesTariff_doc(rapidjson::kObjectType);
-        ret = ret && salesTariff_converter.toJson(data.salesTariff, salesTariff_doc);
-        json.AddMember(rapidjson::StringRef("salesTariff"), salesTariff_doc.Move(), *allocator);
+        rapidjson::Value         salesTariff_doc(rapidjson::kObjectType);
+        ret = ret && salesTariff_converter.toJson(data.salesTariff, salesTariff_doc, allocator);
+        json.AddMember(rapidjson::StringRef("salesTariff"), salesTariff_doc.Move(), allocator);
     }
 
     return ret;
@@ -75,17 +75,14 @@ Minimum charging rate supported by the EV. The unit of measure is defined by the
 class ChargingScheduleTypeConverter : public ocpp::messages::IMessageConverter<ChargingScheduleType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<ChargingScheduleType>* clone() const override { return new ChargingScheduleTypeConverter(); }
-
     /** @brief Convert a ChargingScheduleType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   ChargingScheduleType&         data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a ChargingScheduleType to a JSON representation */
-    bool toJson(const ChargingScheduleType& data, rapidjson::Document& json) override;
+    bool toJson(const ChargingScheduleType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
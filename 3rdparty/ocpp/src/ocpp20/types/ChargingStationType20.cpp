@@ -36,35 +36,29 @@ namespace ocpp20
 bool ChargingStationTypeConverter::fromJson(const rapidjson::Value&       json,
                                             ChargingStationType&          data,
                                             std::string&                  error_code,
-                                            [[maybe_unused]] std::string& error_message)
+                                            [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // serialNumber
-    extract(json, "serialNumber", data.serialNumber);
+    ret = ret && extract(json, "serialNumber", data.serialNumber, error_message);
 
     // model
-    extract(json, "model", data.model);
+    ret = ret && extract(json, "model", data.model, error_message);
 
     // modem
-    if (json.HasMember("modem"))
-    {
-        ModemTypeConverter modem_converter;
-        ret = ret && modem_converter.fromJson(json["modem"], data.modem, error_code, error_message);
-    }
+    ModemTypeConverter modem_converter;
+    ret = ret && extract(json, "modem", data.modem, modem_converter, error_code, error_message);
 
     // vendorName
-    extract(json, "vendorName", data.vendorName);
+    ret = ret && extract(json, "vendorName", data.vendorName, error_message);
 
     // firmwareVersion
-    extract(json, "firmwareVersion", data.firmwareVersion);
+    ret = ret && extract(json, "firmwareVersion", data.firmwareVersion, error_message);
 
     if (!ret)
     {
@@ -75,7 +69,9 @@ bool ChargingStationTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a ChargingStationType to a JSON representation */
-bool ChargingStationTypeConverter::toJson(const ChargingStationType& data, rapidjson::Document& json)
+bool ChargingStationTypeConverter::toJson(const ChargingStationType&          data,
+                                          rapidjson::Value&                   json,
+                                          rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -83,33 +79,31 @@ bool ChargingStationTypeConverter::toJson(const ChargingStationType& data, rapid
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // serialNumber
-    fill(json, "serialNumber", data.serialNumber);
+    fill(json, "serialNumber", data.serialNumber, allocator);
 
     // model
-    fill(json, "model", data.model);
+    fill(json, "model", data.model, allocator);
 
     // modem
     if (data.modem.isSet())
     {
         ModemTypeConverter modem_converter;
-        modem_converter.setAllocator(allocator);
-        rapidjson::Document modem_doc(rapidjson::kObjectType);
-        ret = ret && modem_converter.toJson(data.modem, modem_doc);
-        json.AddMember(rapidjson::StringRef("modem"), modem_doc.Move(), *allocator);
+        rapidjson::Value   modem_doc(rapidjson::kObjectType);
+        ret = ret && modem_converter.toJson(data.modem, modem_doc, allocator);
+        json.AddMember(rapidjson::StringRef("modem"), modem_doc.Move(), allocator);
     }
 
     // vendorName
-    fill(json, "vendorName", data.vendorName);
+    fill(json, "vendorName", data.vendorName, allocator);
 
     // firmwareVersion
-    fill(json, "firmwareVersion", data.firmwareVersion);
+    fill(json, "firmwareVersion", data.firmwareVersion, allocator);
 
     return ret;
 }
@@ -66,17 +66,14 @@ Defines the model of the device. */
 class ChargingStationTypeConverter : public ocpp::messages::IMessageConverter<ChargingStationType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<ChargingStationType>* clone() const override { return new ChargingStationTypeConverter(); }
-
     /** @brief Convert a ChargingStationType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   ChargingStationType&          data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a ChargingStationType to a JSON representation */
-    bool toJson(const ChargingStationType& data, rapidjson::Document& json) override;
+    bool toJson(const ChargingStationType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
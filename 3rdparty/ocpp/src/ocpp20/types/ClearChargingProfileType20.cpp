@@ -36,28 +36,22 @@ namespace ocpp20
 bool ClearChargingProfileTypeConverter::fromJson(const rapidjson::Value&       json,
                                                  ClearChargingProfileType&     data,
                                                  std::string&                  error_code,
-                                                 [[maybe_unused]] std::string& error_message)
+                                                 [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // evseId
-    extract(json, "evseId", data.evseId);
+    ret = ret && extract(json, "evseId", data.evseId, error_message);
 
     // chargingProfilePurpose
-    if (json.HasMember("chargingProfilePurpose"))
-    {
-        data.chargingProfilePurpose = ChargingProfilePurposeEnumTypeHelper.fromString(json["chargingProfilePurpose"].GetString());
-    }
+    ret = ret && extract(json, "chargingProfilePurpose", data.chargingProfilePurpose, ChargingProfilePurposeEnumTypeHelper, error_message);
 
     // stackLevel
-    extract(json, "stackLevel", data.stackLevel);
+    ret = ret && extract(json, "stackLevel", data.stackLevel, error_message);
 
     if (!ret)
     {
@@ -68,7 +62,9 @@ bool ClearChargingProfileTypeConverter::fromJson(const rapidjson::Value&       j
 }
 
 /** @brief Convert a ClearChargingProfileType to a JSON representation */
-bool ClearChargingProfileTypeConverter::toJson(const ClearChargingProfileType& data, rapidjson::Document& json)
+bool ClearChargingProfileTypeConverter::toJson(const ClearChargingProfileType&     data,
+                                               rapidjson::Value&                   json,
+                                               rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -76,23 +72,22 @@ bool ClearChargingProfileTypeConverter::toJson(const ClearChargingProfileType& d
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // evseId
-    fill(json, "evseId", data.evseId);
+    fill(json, "evseId", data.evseId, allocator);
 
     // chargingProfilePurpose
     if (data.chargingProfilePurpose.isSet())
     {
-        fill(json, "chargingProfilePurpose", ChargingProfilePurposeEnumTypeHelper.toString(data.chargingProfilePurpose));
+        fill(json, "chargingProfilePurpose", ChargingProfilePurposeEnumTypeHelper.toString(data.chargingProfilePurpose), allocator);
     }
 
     // stackLevel
-    fill(json, "stackLevel", data.stackLevel);
+    fill(json, "stackLevel", data.stackLevel, allocator);
 
     return ret;
 }
@@ -61,17 +61,14 @@ Specifies the stackLevel for which charging profiles will be cleared, if they me
 class ClearChargingProfileTypeConverter : public ocpp::messages::IMessageConverter<ClearChargingProfileType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<ClearChargingProfileType>* clone() const override { return new ClearChargingProfileTypeConverter(); }
-
     /** @brief Convert a ClearChargingProfileType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   ClearChargingProfileType&     data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a ClearChargingProfileType to a JSON representation */
-    bool toJson(const ClearChargingProfileType& data, rapidjson::Document& json) override;
+    bool toJson(const ClearChargingProfileType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
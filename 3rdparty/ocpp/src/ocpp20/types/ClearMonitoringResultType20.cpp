@@ -36,29 +36,23 @@ namespace ocpp20
 bool ClearMonitoringResultTypeConverter::fromJson(const rapidjson::Value&       json,
                                                   ClearMonitoringResultType&    data,
                                                   std::string&                  error_code,
-                                                  [[maybe_unused]] std::string& error_message)
+                                                  [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = ClearMonitoringStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, ClearMonitoringStatusEnumTypeHelper, error_message);
 
     // id
-    extract(json, "id", data.id);
+    ret = ret && extract(json, "id", data.id, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -69,7 +63,9 @@ bool ClearMonitoringResultTypeConverter::fromJson(const rapidjson::Value&
 }
 
 /** @brief Convert a ClearMonitoringResultType to a JSON representation */
-bool ClearMonitoringResultTypeConverter::toJson(const ClearMonitoringResultType& data, rapidjson::Document& json)
+bool ClearMonitoringResultTypeConverter::toJson(const ClearMonitoringResultType&    data,
+                                                rapidjson::Value&                   json,
+                                                rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -77,26 +73,24 @@ bool ClearMonitoringResultTypeConverter::toJson(const ClearMonitoringResultType&
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", ClearMonitoringStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", ClearMonitoringStatusEnumTypeHelper.toString(data.status), allocator);
 
     // id
-    fill(json, "id", data.id);
+    fill(json, "id", data.id, allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value        statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     return ret;
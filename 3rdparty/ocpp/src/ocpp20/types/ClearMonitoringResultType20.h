@@ -55,20 +55,16 @@ struct ClearMonitoringResultType
 class ClearMonitoringResultTypeConverter : public ocpp::messages::IMessageConverter<ClearMonitoringResultType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<ClearMonitoringResultType>* clone() const override
-    {
-        return new ClearMonitoringResultTypeConverter();
-    }
-
     /** @brief Convert a ClearMonitoringResultType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   ClearMonitoringResultType&    data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a ClearMonitoringResultType to a JSON representation */
-    bool toJson(const ClearMonitoringResultType& data, rapidjson::Document& json) override;
+    bool toJson(const ClearMonitoringResultType&    data,
+                rapidjson::Value&                   json,
+                rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,29 +36,23 @@ namespace ocpp20
 bool ComponentTypeConverter::fromJson(const rapidjson::Value&       json,
                                       ComponentType&                data,
                                       std::string&                  error_code,
-                                      [[maybe_unused]] std::string& error_message)
+                                      [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // evse
-    if (json.HasMember("evse"))
-    {
-        EVSETypeConverter evse_converter;
-        ret = ret && evse_converter.fromJson(json["evse"], data.evse, error_code, error_message);
-    }
+    EVSETypeConverter evse_converter;
+    ret = ret && extract(json, "evse", data.evse, evse_converter, error_code, error_message);
 
     // name
-    extract(json, "name", data.name);
+    ret = ret && extract(json, "name", data.name, error_message);
 
     // instance
-    extract(json, "instance", data.instance);
+    ret = ret && extract(json, "instance", data.instance, error_message);
 
     if (!ret)
     {
@@ -69,7 +63,7 @@ bool ComponentTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a ComponentType to a JSON representation */
-bool ComponentTypeConverter::toJson(const ComponentType& data, rapidjson::Document& json)
+bool ComponentTypeConverter::toJson(const ComponentType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -77,27 +71,25 @@ bool ComponentTypeConverter::toJson(const ComponentType& data, rapidjson::Docume
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // evse
     if (data.evse.isSet())
     {
         EVSETypeConverter evse_converter;
-        evse_converter.setAllocator(allocator);
-        rapidjson::Document evse_doc(rapidjson::kObjectType);
-        ret = ret && evse_converter.toJson(data.evse, evse_doc);
-        json.AddMember(rapidjson::StringRef("evse"), evse_doc.Move(), *allocator);
+        rapidjson::Value  evse_doc(rapidjson::kObjectType);
+        ret = ret && evse_converter.toJson(data.evse, evse_doc, allocator);
+        json.AddMember(rapidjson::StringRef("evse"), evse_doc.Move(), allocator);
     }
 
     // name
-    fill(json, "name", data.name);
+    fill(json, "name", data.name, allocator);
 
     // instance
-    fill(json, "instance", data.instance);
+    fill(json, "instance", data.instance, allocator);
 
     return ret;
 }
@@ -56,17 +56,14 @@ struct ComponentType
 class ComponentTypeConverter : public ocpp::messages::IMessageConverter<ComponentType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<ComponentType>* clone() const override { return new ComponentTypeConverter(); }
-
     /** @brief Convert a ComponentType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   ComponentType&                data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a ComponentType to a JSON representation */
-    bool toJson(const ComponentType& data, rapidjson::Document& json) override;
+    bool toJson(const ComponentType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
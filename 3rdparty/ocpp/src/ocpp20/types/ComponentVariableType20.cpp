@@ -36,27 +36,21 @@ namespace ocpp20
 bool ComponentVariableTypeConverter::fromJson(const rapidjson::Value&       json,
                                               ComponentVariableType&        data,
                                               std::string&                  error_code,
-                                              [[maybe_unused]] std::string& error_message)
+                                              [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // component
     ComponentTypeConverter component_converter;
-    ret = ret && component_converter.fromJson(json["component"], data.component, error_code, error_message);
+    ret = ret && extract(json, "component", data.component, component_converter, error_code, error_message);
 
     // variable
-    if (json.HasMember("variable"))
-    {
-        VariableTypeConverter variable_converter;
-        ret = ret && variable_converter.fromJson(json["variable"], data.variable, error_code, error_message);
-    }
+    VariableTypeConverter variable_converter;
+    ret = ret && extract(json, "variable", data.variable, variable_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -67,7 +61,9 @@ bool ComponentVariableTypeConverter::fromJson(const rapidjson::Value&       json
 }
 
 /** @brief Convert a ComponentVariableType to a JSON representation */
-bool ComponentVariableTypeConverter::toJson(const ComponentVariableType& data, rapidjson::Document& json)
+bool ComponentVariableTypeConverter::toJson(const ComponentVariableType&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -75,27 +71,24 @@ bool ComponentVariableTypeConverter::toJson(const ComponentVariableType& data, r
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // component
     ComponentTypeConverter component_converter;
-    component_converter.setAllocator(allocator);
-    rapidjson::Document component_doc(rapidjson::kObjectType);
-    ret = ret && component_converter.toJson(data.component, component_doc);
-    json.AddMember(rapidjson::StringRef("component"), component_doc.Move(), *allocator);
+    rapidjson::Value       component_doc(rapidjson::kObjectType);
+    ret = ret && component_converter.toJson(data.component, component_doc, allocator);
+    json.AddMember(rapidjson::StringRef("component"), component_doc.Move(), allocator);
 
     // variable
     if (data.variable.isSet())
     {
         VariableTypeConverter variable_converter;
-        variable_converter.setAllocator(allocator);
-        rapidjson::Document variable_doc(rapidjson::kObjectType);
-        ret = ret && variable_converter.toJson(data.variable, variable_doc);
-        json.AddMember(rapidjson::StringRef("variable"), variable_doc.Move(), *allocator);
+        rapidjson::Value      variable_doc(rapidjson::kObjectType);
+        ret = ret && variable_converter.toJson(data.variable, variable_doc, allocator);
+        json.AddMember(rapidjson::StringRef("variable"), variable_doc.Move(), allocator);
     }
 
     return ret;
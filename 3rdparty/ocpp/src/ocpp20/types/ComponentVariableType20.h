@@ -54,17 +54,14 @@ struct ComponentVariableType
 class ComponentVariableTypeConverter : public ocpp::messages::IMessageConverter<ComponentVariableType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<ComponentVariableType>* clone() const override { return new ComponentVariableTypeConverter(); }
-
     /** @brief Convert a ComponentVariableType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   ComponentVariableType&        data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a ComponentVariableType to a JSON representation */
-    bool toJson(const ComponentVariableType& data, rapidjson::Document& json) override;
+    bool toJson(const ComponentVariableType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,40 +36,42 @@ namespace ocpp20
 bool CompositeScheduleTypeConverter::fromJson(const rapidjson::Value&       json,
                                               CompositeScheduleType&        data,
                                               std::string&                  error_code,
-                                              [[maybe_unused]] std::string& error_message)
+                                              [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // chargingSchedulePeriod
-    if (json.HasMember("chargingSchedulePeriod"))
+    ret = ret && checkArray(json, "chargingSchedulePeriod", true, 1u, 0u, error_message);
+    if (ret && json.HasMember("chargingSchedulePeriod"))
     {
         const rapidjson::Value&             chargingSchedulePeriod_json = json["chargingSchedulePeriod"];
         ChargingSchedulePeriodTypeConverter chargingSchedulePeriod_converter;
         for (auto it = chargingSchedulePeriod_json.Begin(); ret && (it != chargingSchedulePeriod_json.End()); ++it)
         {
-            ChargingSchedulePeriodType& item = data.chargingSchedulePeriod.emplace_back();
-            ret                              = ret && chargingSchedulePeriod_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it,
+                          "chargingSchedulePeriod",
+                          data.chargingSchedulePeriod.emplace_back(),
+                          chargingSchedulePeriod_converter,
+                          error_code,
+                          error_message);
         }
     }
 
     // evseId
-    extract(json, "evseId", data.evseId);
+    ret = ret && extract(json, "evseId", data.evseId, error_message);
 
     // duration
-    extract(json, "duration", data.duration);
+    ret = ret && extract(json, "duration", data.duration, error_message);
 
     // scheduleStart
     ret = ret && extract(json, "scheduleStart", data.scheduleStart, error_message);
 
     // chargingRateUnit
-    data.chargingRateUnit = ChargingRateUnitEnumTypeHelper.fromString(json["chargingRateUnit"].GetString());
+    ret = ret && extract(json, "chargingRateUnit", data.chargingRateUnit, ChargingRateUnitEnumTypeHelper, error_message);
 
     if (!ret)
     {
@@ -80,7 +82,9 @@ bool CompositeScheduleTypeConverter::fromJson(const rapidjson::Value&       json
 }
 
 /** @brief Convert a CompositeScheduleType to a JSON representation */
-bool CompositeScheduleTypeConverter::toJson(const CompositeScheduleType& data, rapidjson::Document& json)
+bool CompositeScheduleTypeConverter::toJson(const CompositeScheduleType&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -88,36 +92,34 @@ bool CompositeScheduleTypeConverter::toJson(const CompositeScheduleType& data, r
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // chargingSchedulePeriod
 
     rapidjson::Value                    chargingSchedulePeriod_json(rapidjson::kArrayType);
     ChargingSchedulePeriodTypeConverter chargingSchedulePeriod_converter;
-    chargingSchedulePeriod_converter.setAllocator(allocator);
     for (const ChargingSchedulePeriodType& item : data.chargingSchedulePeriod)
     {
-        rapidjson::Document item_doc(rapidjson::kObjectType);
-        ret = ret && chargingSchedulePeriod_converter.toJson(item, item_doc);
-        chargingSchedulePeriod_json.PushBack(item_doc.Move(), *allocator);
+        rapidjson::Value item_doc(rapidjson::kObjectType);
+        ret = ret && chargingSchedulePeriod_converter.toJson(item, item_doc, allocator);
+        chargingSchedulePeriod_json.PushBack(item_doc.Move(), allocator);
     }
-    json.AddMember(rapidjson::StringRef("chargingSchedulePeriod"), chargingSchedulePeriod_json.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("chargingSchedulePeriod"), chargingSchedulePeriod_json.Move(), allocator);
 
     // evseId
-    fill(json, "evseId", data.evseId);
+    fill(json, "evseId", data.evseId, allocator);
 
     // duration
-    fill(json, "duration", data.duration);
+    fill(json, "duration", data.duration, allocator);
 
     // scheduleStart
-    fill(json, "scheduleStart", data.scheduleStart);
+    fill(json, "scheduleStart", data.scheduleStart, allocator);
 
     // chargingRateUnit
-    fill(json, "chargingRateUnit", ChargingRateUnitEnumTypeHelper.toString(data.chargingRateUnit));
+    fill(json, "chargingRateUnit", ChargingRateUnitEnumTypeHelper.toString(data.chargingRateUnit), allocator);
 
     return ret;
 }
@@ -68,17 +68,14 @@ Date and time at which the schedule becomes active. All time measurements within
 class CompositeScheduleTypeConverter : public ocpp::messages::IMessageConverter<CompositeScheduleType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<CompositeScheduleType>* clone() const override { return new CompositeScheduleTypeConverter(); }
-
     /** @brief Convert a CompositeScheduleType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   CompositeScheduleType&        data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a CompositeScheduleType to a JSON representation */
-    bool toJson(const CompositeScheduleType& data, rapidjson::Document& json) override;
+    bool toJson(const CompositeScheduleType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,29 +36,26 @@ namespace ocpp20
 bool ConsumptionCostTypeConverter::fromJson(const rapidjson::Value&       json,
                                             ConsumptionCostType&          data,
                                             std::string&                  error_code,
-                                            [[maybe_unused]] std::string& error_message)
+                                            [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // startValue
-    extract(json, "startValue", data.startValue);
+    ret = ret && extract(json, "startValue", data.startValue, error_message);
 
     // cost
-    if (json.HasMember("cost"))
+    ret = ret && checkArray(json, "cost", true, 1u, 3u, error_message);
+    if (ret && json.HasMember("cost"))
     {
         const rapidjson::Value& cost_json = json["cost"];
         CostTypeConverter       cost_converter;
         for (auto it = cost_json.Begin(); ret && (it != cost_json.End()); ++it)
         {
-            CostType& item = data.cost.emplace_back();
-            ret            = ret && cost_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it, "cost", data.cost.emplace_back(), cost_converter, error_code, error_message);
         }
     }
 
@@ -71,7 +68,9 @@ bool ConsumptionCostTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a ConsumptionCostType to a JSON representation */
-bool ConsumptionCostTypeConverter::toJson(const ConsumptionCostType& data, rapidjson::Document& json)
+bool ConsumptionCostTypeConverter::toJson(const ConsumptionCostType&          data,
+                                          rapidjson::Value&                   json,
+                                          rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -79,27 +78,25 @@ bool ConsumptionCostTypeConverter::toJson(const ConsumptionCostType& data, rapid
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // startValue
-    fill(json, "startValue", data.startValue);
+    fill(json, "startValue", data.startValue, allocator);
 
     // cost
 
     rapidjson::Value  cost_json(rapidjson::kArrayType);
     CostTypeConverter cost_converter;
-    cost_converter.setAllocator(allocator);
     for (const CostType& item : data.cost)
     {
-        rapidjson::Document item_doc(rapidjson::kObjectType);
-        ret = ret && cost_converter.toJson(item, item_doc);
-        cost_json.PushBack(item_doc.Move(), *allocator);
+        rapidjson::Value item_doc(rapidjson::kObjectType);
+        ret = ret && cost_converter.toJson(item, item_doc, allocator);
+        cost_json.PushBack(item_doc.Move(), allocator);
     }
-    json.AddMember(rapidjson::StringRef("cost"), cost_json.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("cost"), cost_json.Move(), allocator);
 
     return ret;
 }
@@ -57,17 +57,14 @@ The lowest level of consumption that defines the starting point of this consumpt
 class ConsumptionCostTypeConverter : public ocpp::messages::IMessageConverter<ConsumptionCostType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<ConsumptionCostType>* clone() const override { return new ConsumptionCostTypeConverter(); }
-
     /** @brief Convert a ConsumptionCostType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   ConsumptionCostType&          data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a ConsumptionCostType to a JSON representation */
-    bool toJson(const ConsumptionCostType& data, rapidjson::Document& json) override;
+    bool toJson(const ConsumptionCostType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
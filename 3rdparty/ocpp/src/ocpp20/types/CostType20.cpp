@@ -36,25 +36,22 @@ namespace ocpp20
 bool CostTypeConverter::fromJson(const rapidjson::Value&       json,
                                  CostType&                     data,
                                  std::string&                  error_code,
-                                 [[maybe_unused]] std::string& error_message)
+                                 [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // costKind
-    data.costKind = CostKindEnumTypeHelper.fromString(json["costKind"].GetString());
+    ret = ret && extract(json, "costKind", data.costKind, CostKindEnumTypeHelper, error_message);
 
     // amount
-    extract(json, "amount", data.amount);
+    ret = ret && extract(json, "amount", data.amount, error_message);
 
     // amountMultiplier
-    extract(json, "amountMultiplier", data.amountMultiplier);
+    ret = ret && extract(json, "amountMultiplier", data.amountMultiplier, error_message);
 
     if (!ret)
     {
@@ -65,7 +62,7 @@ bool CostTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a CostType to a JSON representation */
-bool CostTypeConverter::toJson(const CostType& data, rapidjson::Document& json)
+bool CostTypeConverter::toJson(const CostType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -73,20 +70,19 @@ bool CostTypeConverter::toJson(const CostType& data, rapidjson::Document& json)
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // costKind
-    fill(json, "costKind", CostKindEnumTypeHelper.toString(data.costKind));
+    fill(json, "costKind", CostKindEnumTypeHelper.toString(data.costKind), allocator);
 
     // amount
-    fill(json, "amount", data.amount);
+    fill(json, "amount", data.amount, allocator);
 
     // amountMultiplier
-    fill(json, "amountMultiplier", data.amountMultiplier);
+    fill(json, "amountMultiplier", data.amountMultiplier, allocator);
 
     return ret;
 }
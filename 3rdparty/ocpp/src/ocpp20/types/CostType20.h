@@ -60,17 +60,14 @@ Values: -3..3, The amountMultiplier defines the exponent to base 10 (dec). The f
 class CostTypeConverter : public ocpp::messages::IMessageConverter<CostType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<CostType>* clone() const override { return new CostTypeConverter(); }
-
     /** @brief Convert a CostType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   CostType&                     data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a CostType to a JSON representation */
-    bool toJson(const CostType& data, rapidjson::Document& json) override;
+    bool toJson(const CostType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,12 +36,44 @@ namespace ocpp20
 bool CustomDataTypeConverter::fromJson(const rapidjson::Value&       json,
                                        CustomDataType&               data,
                                        std::string&                  error_code,
-                                       [[maybe_unused]] std::string& error_message)
+                                       [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // vendorId
-    extract(json, "vendorId", data.vendorId);
+    ret = ret && extract(json, "vendorId", data.vendorId, error_message);
+
+    if (!ret)
+    {
+        error_code = ocpp::rpc::IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
+    }
+
+    return ret;
+}
+
+/** @brief Convert a CustomDataType from a JSON stream */
+bool CustomDataTypeConverter::fromJson(ocpp::json::JsonReader&       reader,
+                                       CustomDataType&               data,
+                                       std::string&                  error_code,
+                                       [[maybe_unused]] std::string& error_message) const
+{
+    bool ret            = true;
+    bool vendorId_found = false;
+
+    while (ret && reader.nextMember())
+    {
+        if (reader.isMember("vendorId"))
+        {
+            ret            = convert(reader, "vendorId", data.vendorId, error_message);
+            vendorId_found = true;
+        }
+        else
+        {
+            ret = reader.skip();
+        }
+    }
+    ret = ret && !reader.hasError();
+    ret = ret && checkRequired("vendorId", vendorId_found, error_message);
 
     if (!ret)
     {
@@ -52,12 +84,14 @@ bool CustomDataTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a CustomDataType to a JSON representation */
-bool CustomDataTypeConverter::toJson(const CustomDataType& data, rapidjson::Document& json)
+bool CustomDataTypeConverter::toJson(const CustomDataType&               data,
+                                     rapidjson::Value&                   json,
+                                     rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
     // vendorId
-    fill(json, "vendorId", data.vendorId);
+    fill(json, "vendorId", data.vendorId, allocator);
 
     return ret;
 }
@@ -45,17 +45,20 @@ struct CustomDataType
 class CustomDataTypeConverter : public ocpp::messages::IMessageConverter<CustomDataType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<CustomDataType>* clone() const override { return new CustomDataTypeConverter(); }
-
     /** @brief Convert a CustomDataType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   CustomDataType&               data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
+
+    /** @brief Convert a CustomDataType from a JSON stream */
+    bool fromJson(ocpp::json::JsonReader&       reader,
+                  CustomDataType&               data,
+                  std::string&                  error_code,
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a CustomDataType to a JSON representation */
-    bool toJson(const CustomDataType& data, rapidjson::Document& json) override;
+    bool toJson(const CustomDataType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,40 +36,37 @@ namespace ocpp20
 bool DCChargingParametersTypeConverter::fromJson(const rapidjson::Value&       json,
                                                  DCChargingParametersType&     data,
                                                  std::string&                  error_code,
-                                                 [[maybe_unused]] std::string& error_message)
+                                                 [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // evMaxCurrent
-    extract(json, "evMaxCurrent", data.evMaxCurrent);
+    ret = ret && extract(json, "evMaxCurrent", data.evMaxCurrent, error_message);
 
     // evMaxVoltage
-    extract(json, "evMaxVoltage", data.evMaxVoltage);
+    ret = ret && extract(json, "evMaxVoltage", data.evMaxVoltage, error_message);
 
     // energyAmount
-    extract(json, "energyAmount", data.energyAmount);
+    ret = ret && extract(json, "energyAmount", data.energyAmount, error_message);
 
     // evMaxPower
-    extract(json, "evMaxPower", data.evMaxPower);
+    ret = ret && extract(json, "evMaxPower", data.evMaxPower, error_message);
 
     // stateOfCharge
-    extract(json, "stateOfCharge", data.stateOfCharge);
+    ret = ret && extract(json, "stateOfCharge", data.stateOfCharge, 0, 100, error_message);
 
     // evEnergyCapacity
-    extract(json, "evEnergyCapacity", data.evEnergyCapacity);
+    ret = ret && extract(json, "evEnergyCapacity", data.evEnergyCapacity, error_message);
 
     // fullSoC
-    extract(json, "fullSoC", data.fullSoC);
+    ret = ret && extract(json, "fullSoC", data.fullSoC, 0, 100, error_message);
 
     // bulkSoC
-    extract(json, "bulkSoC", data.bulkSoC);
+    ret = ret && extract(json, "bulkSoC", data.bulkSoC, 0, 100, error_message);
 
     if (!ret)
     {
@@ -80,7 +77,9 @@ bool DCChargingParametersTypeConverter::fromJson(const rapidjson::Value&       j
 }
 
 /** @brief Convert a DCChargingParametersType to a JSON representation */
-bool DCChargingParametersTypeConverter::toJson(const DCChargingParametersType& data, rapidjson::Document& json)
+bool DCChargingParametersTypeConverter::toJson(const DCChargingParametersType&     data,
+                                               rapidjson::Value&                   json,
+                                               rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -88,35 +87,34 @@ bool DCChargingParametersTypeConverter::toJson(const DCChargingParametersType& d
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // evMaxCurrent
-    fill(json, "evMaxCurrent", data.evMaxCurrent);
+    fill(json, "evMaxCurrent", data.evMaxCurrent, allocator);
 
     // evMaxVoltage
-    fill(json, "evMaxVoltage", data.evMaxVoltage);
+    fill(json, "evMaxVoltage", data.evMaxVoltage, allocator);
 
     // energyAmount
-    fill(json, "energyAmount", data.energyAmount);
+    fill(json, "energyAmount", data.energyAmount, allocator);
 
     // evMaxPower
-    fill(json, "evMaxPower", data.evMaxPower);
+    fill(json, "evMaxPower", data.evMaxPower, allocator);
 
     // stateOfCharge
-    fill(json, "stateOfCharge", data.stateOfCharge);
+    fill(json, "stateOfCharge", data.stateOfCharge, allocator);
 
     // evEnergyCapacity
-    fill(json, "evEnergyCapacity", data.evEnergyCapacity);
+    fill(json, "evEnergyCapacity", data.evEnergyCapacity, allocator);
 
     // fullSoC
-    fill(json, "fullSoC", data.fullSoC);
+    fill(json, "fullSoC", data.fullSoC, allocator);
 
     // bulkSoC
-    fill(json, "bulkSoC", data.bulkSoC);
+    fill(json, "bulkSoC", data.bulkSoC, allocator);
 
     return ret;
 }
@@ -84,17 +84,14 @@ Percentage of SoC at which the EV considers a fast charging process to end. (pos
 class DCChargingParametersTypeConverter : public ocpp::messages::IMessageConverter<DCChargingParametersType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<DCChargingParametersType>* clone() const override { return new DCChargingParametersTypeConverter(); }
-
     /** @brief Convert a DCChargingParametersType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   DCChargingParametersType&     data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a DCChargingParametersType to a JSON representation */
-    bool toJson(const DCChargingParametersType& data, rapidjson::Document& json) override;
+    bool toJson(const DCChargingParametersType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,22 +36,60 @@ namespace ocpp20
 bool EVSETypeConverter::fromJson(const rapidjson::Value&       json,
                                  EVSEType&                     data,
                                  std::string&                  error_code,
-                                 [[maybe_unused]] std::string& error_message)
+                                 [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // id
-    extract(json, "id", data.id);
+    ret = ret && extract(json, "id", data.id, error_message);
 
     // connectorId
-    extract(json, "connectorId", data.connectorId);
+    ret = ret && extract(json, "connectorId", data.connectorId, error_message);
+
+    if (!ret)
+    {
+        error_code = ocpp::rpc::IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
+    }
+
+    return ret;
+}
+
+/** @brief Convert a EVSEType from a JSON stream */
+bool EVSETypeConverter::fromJson(ocpp::json::JsonReader&       reader,
+                                 EVSEType&                     data,
+                                 std::string&                  error_code,
+                                 [[maybe_unused]] std::string& error_message) const
+{
+    bool ret      = true;
+    bool id_found = false;
+
+    while (ret && reader.nextMember())
+    {
+        if (reader.isMember("customData"))
+        {
+            CustomDataTypeConverter customData_converter;
+            ret = convert(reader, "customData", data.customData.value(), customData_converter, error_code, error_message);
+        }
+        else if (reader.isMember("id"))
+        {
+            ret      = convert(reader, "id", data.id, error_message);
+            id_found = true;
+        }
+        else if (reader.isMember("connectorId"))
+        {
+            ret = convert(reader, "connectorId", data.connectorId.value(), error_message);
+        }
+        else
+        {
+            ret = reader.skip();
+        }
+    }
+    ret = ret && !reader.hasError();
+    ret = ret && checkRequired("id", id_found, error_message);
 
     if (!ret)
     {
@@ -62,7 +100,7 @@ bool EVSETypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a EVSEType to a JSON representation */
-bool EVSETypeConverter::toJson(const EVSEType& data, rapidjson::Document& json)
+bool EVSETypeConverter::toJson(const EVSEType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -70,17 +108,16 @@ bool EVSETypeConverter::toJson(const EVSEType& data, rapidjson::Document& json)
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // id
-    fill(json, "id", data.id);
+    fill(json, "id", data.id, allocator);
 
     // connectorId
-    fill(json, "connectorId", data.connectorId);
+    fill(json, "connectorId", data.connectorId, allocator);
 
     return ret;
 }
@@ -56,17 +56,20 @@ EVSE Identifier. This contains a number (&gt; 0) designating an EVSE of the Char
 class EVSETypeConverter : public ocpp::messages::IMessageConverter<EVSEType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<EVSEType>* clone() const override { return new EVSETypeConverter(); }
-
     /** @brief Convert a EVSEType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   EVSEType&                     data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
+
+    /** @brief Convert a EVSEType from a JSON stream */
+    bool fromJson(ocpp::json::JsonReader&       reader,
+                  EVSEType&                     data,
+                  std::string&                  error_code,
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a EVSEType to a JSON representation */
-    bool toJson(const EVSEType& data, rapidjson::Document& json) override;
+    bool toJson(const EVSEType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,57 +36,54 @@ namespace ocpp20
 bool EventDataTypeConverter::fromJson(const rapidjson::Value&       json,
                                       EventDataType&                data,
                                       std::string&                  error_code,
-                                      [[maybe_unused]] std::string& error_message)
+                                      [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // eventId
-    extract(json, "eventId", data.eventId);
+    ret = ret && extract(json, "eventId", data.eventId, error_message);
 
     // timestamp
     ret = ret && extract(json, "timestamp", data.timestamp, error_message);
 
     // trigger
-    data.trigger = EventTriggerEnumTypeHelper.fromString(json["trigger"].GetString());
+    ret = ret && extract(json, "trigger", data.trigger, EventTriggerEnumTypeHelper, error_message);
 
     // cause
-    extract(json, "cause", data.cause);
+    ret = ret && extract(json, "cause", data.cause, error_message);
 
     // actualValue
-    extract(json, "actualValue", data.actualValue);
+    ret = ret && extract(json, "actualValue", data.actualValue, error_message);
 
     // techCode
-    extract(json, "techCode", data.techCode);
+    ret = ret && extract(json, "techCode", data.techCode, error_message);
 
     // techInfo
-    extract(json, "techInfo", data.techInfo);
+    ret = ret && extract(json, "techInfo", data.techInfo, error_message);
 
     // cleared
-    extract(json, "cleared", data.cleared);
+    ret = ret && extract(json, "cleared", data.cleared, error_message);
 
     // transactionId
-    extract(json, "transactionId", data.transactionId);
+    ret = ret && extract(json, "transactionId", data.transactionId, error_message);
 
     // component
     ComponentTypeConverter component_converter;
-    ret = ret && component_converter.fromJson(json["component"], data.component, error_code, error_message);
+    ret = ret && extract(json, "component", data.component, component_converter, error_code, error_message);
 
     // variableMonitoringId
-    extract(json, "variableMonitoringId", data.variableMonitoringId);
+    ret = ret && extract(json, "variableMonitoringId", data.variableMonitoringId, error_message);
 
     // eventNotificationType
-    data.eventNotificationType = EventNotificationEnumTypeHelper.fromString(json["eventNotificationType"].GetString());
+    ret = ret && extract(json, "eventNotificationType", data.eventNotificationType, EventNotificationEnumTypeHelper, error_message);
 
     // variable
     VariableTypeConverter variable_converter;
-    ret = ret && variable_converter.fromJson(json["variable"], data.variable, error_code, error_message);
+    ret = ret && extract(json, "variable", data.variable, variable_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -97,7 +94,7 @@ bool EventDataTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a EventDataType to a JSON representation */
-bool EventDataTypeConverter::toJson(const EventDataType& data, rapidjson::Document& json)
+bool EventDataTypeConverter::toJson(const EventDataType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -105,58 +102,55 @@ bool EventDataTypeConverter::toJson(const EventDataType& data, rapidjson::Docume
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // eventId
-    fill(json, "eventId", data.eventId);
+    fill(json, "eventId", data.eventId, allocator);
 
     // timestamp
-    fill(json, "timestamp", data.timestamp);
+    fill(json, "timestamp", data.timestamp, allocator);
 
     // trigger
-    fill(json, "trigger", EventTriggerEnumTypeHelper.toString(data.trigger));
+    fill(json, "trigger", EventTriggerEnumTypeHelper.toString(data.trigger), allocator);
 
     // cause
-    fill(json, "cause", data.cause);
+    fill(json, "cause", data.cause, allocator);
 
     // actualValue
-    fill(json, "actualValue", data.actualValue);
+    fill(json, "actualValue", data.actualValue, allocator);
 
     // techCode
-    fill(json, "techCode", data.techCode);
+    fill(json, "techCode", data.techCode, allocator);
 
     // techInfo
-    fill(json, "techInfo", data.techInfo);
+    fill(json, "techInfo", data.techInfo, allocator);
 
     // cleared
-    fill(json, "cleared", data.cleared);
+    fill(json, "cleared", data.cleared, allocator);
 
     // transactionId
-    fill(json, "transactionId", data.transactionId);
+    fill(json, "transactionId", data.transactionId, allocator);
 
     // component
     ComponentTypeConverter component_converter;
-    component_converter.setAllocator(allocator);
-    rapidjson::Document component_doc(rapidjson::kObjectType);
-    ret = ret && component_converter.toJson(data.component, component_doc);
-    json.AddMember(rapidjson::StringRef("component"), component_doc.Move(), *allocator);
+    rapidjson::Value       component_doc(rapidjson::kObjectType);
+    ret = ret && component_converter.toJson(data.component, component_doc, allocator);
+    json.AddMember(rapidjson::StringRef("component"), component_doc.Move(), allocator);
 
     // variableMonitoringId
-    fill(json, "variableMonitoringId", data.variableMonitoringId);
+    fill(json, "variableMonitoringId", data.variableMonitoringId, allocator);
 
     // eventNotificationType
-    fill(json, "eventNotificationType", EventNotificationEnumTypeHelper.toString(data.eventNotificationType));
+    fill(json, "eventNotificationType", EventNotificationEnumTypeHelper.toString(data.eventNotificationType), allocator);
 
     // variable
     VariableTypeConverter variable_converter;
-    variable_converter.setAllocator(allocator);
-    rapidjson::Document variable_doc(rapidjson::kObjectType);
-    ret = ret && variable_converter.toJson(data.variable, variable_doc);
-    json.AddMember(rapidjson::StringRef("variable"), variable_doc.Move(), *allocator);
+    rapidjson::Value      variable_doc(rapidjson::kObjectType);
+    ret = ret && variable_converter.toJson(data.variable, variable_doc, allocator);
+    json.AddMember(rapidjson::StringRef("variable"), variable_doc.Move(), allocator);
 
     return ret;
 }
@@ -82,17 +82,14 @@ The Configuration Variable &lt;&lt;configkey-reporting-value-size,ReportingValue
 class EventDataTypeConverter : public ocpp::messages::IMessageConverter<EventDataType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<EventDataType>* clone() const override { return new EventDataTypeConverter(); }
-
     /** @brief Convert a EventDataType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   EventDataType&                data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a EventDataType to a JSON representation */
-    bool toJson(const EventDataType& data, rapidjson::Document& json) override;
+    bool toJson(const EventDataType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
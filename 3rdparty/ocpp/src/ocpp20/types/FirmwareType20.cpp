@@ -36,19 +36,16 @@ namespace ocpp20
 bool FirmwareTypeConverter::fromJson(const rapidjson::Value&       json,
                                      FirmwareType&                 data,
                                      std::string&                  error_code,
-                                     [[maybe_unused]] std::string& error_message)
+                                     [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // location
-    extract(json, "location", data.location);
+    ret = ret && extract(json, "location", data.location, error_message);
 
     // retrieveDateTime
     ret = ret && extract(json, "retrieveDateTime", data.retrieveDateTime, error_message);
@@ -57,10 +54,10 @@ bool FirmwareTypeConverter::fromJson(const rapidjson::Value&       json,
     ret = ret && extract(json, "installDateTime", data.installDateTime, error_message);
 
     // signingCertificate
-    extract(json, "signingCertificate", data.signingCertificate);
+    ret = ret && extract(json, "signingCertificate", data.signingCertificate, error_message);
 
     // signature
-    extract(json, "signature", data.signature);
+    ret = ret && extract(json, "signature", data.signature, error_message);
 
     if (!ret)
     {
@@ -71,7 +68,7 @@ bool FirmwareTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a FirmwareType to a JSON representation */
-bool FirmwareTypeConverter::toJson(const FirmwareType& data, rapidjson::Document& json)
+bool FirmwareTypeConverter::toJson(const FirmwareType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -79,26 +76,25 @@ bool FirmwareTypeConverter::toJson(const FirmwareType& data, rapidjson::Document
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // location
-    fill(json, "location", data.location);
+    fill(json, "location", data.location, allocator);
 
     // retrieveDateTime
-    fill(json, "retrieveDateTime", data.retrieveDateTime);
+    fill(json, "retrieveDateTime", data.retrieveDateTime, allocator);
 
     // installDateTime
-    fill(json, "installDateTime", data.installDateTime);
+    fill(json, "installDateTime", data.installDateTime, allocator);
 
     // signingCertificate
-    fill(json, "signingCertificate", data.signingCertificate);
+    fill(json, "signingCertificate", data.signingCertificate, allocator);
 
     // signature
-    fill(json, "signature", data.signature);
+    fill(json, "signature", data.signature, allocator);
 
     return ret;
 }
@@ -71,17 +71,14 @@ Base64 encoded firmware signature. */
 class FirmwareTypeConverter : public ocpp::messages::IMessageConverter<FirmwareType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<FirmwareType>* clone() const override { return new FirmwareTypeConverter(); }
-
     /** @brief Convert a FirmwareType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   FirmwareType&                 data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a FirmwareType to a JSON representation */
-    bool toJson(const FirmwareType& data, rapidjson::Document& json) override;
+    bool toJson(const FirmwareType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
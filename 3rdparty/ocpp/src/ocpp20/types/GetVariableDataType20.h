@@ -57,17 +57,14 @@ struct GetVariableDataType
 class GetVariableDataTypeConverter : public ocpp::messages::IMessageConverter<GetVariableDataType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<GetVariableDataType>* clone() const override { return new GetVariableDataTypeConverter(); }
-
     /** @brief Convert a GetVariableDataType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   GetVariableDataType&          data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a GetVariableDataType to a JSON representation */
-    bool toJson(const GetVariableDataType& data, rapidjson::Document& json) override;
+    bool toJson(const GetVariableDataType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,44 +36,34 @@ namespace ocpp20
 bool GetVariableResultTypeConverter::fromJson(const rapidjson::Value&       json,
                                               GetVariableResultType&        data,
                                               std::string&                  error_code,
-                                              [[maybe_unused]] std::string& error_message)
+                                              [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // attributeStatusInfo
-    if (json.HasMember("attributeStatusInfo"))
-    {
-        StatusInfoTypeConverter attributeStatusInfo_converter;
-        ret =
-            ret && attributeStatusInfo_converter.fromJson(json["attributeStatusInfo"], data.attributeStatusInfo, error_code, error_message);
-    }
+    StatusInfoTypeConverter attributeStatusInfo_converter;
+    ret = ret && extract(json, "attributeStatusInfo", data.attributeStatusInfo, attributeStatusInfo_converter, error_code, error_message);
 
     // attributeStatus
-    data.attributeStatus = GetVariableStatusEnumTypeHelper.fromString(json["attributeStatus"].GetString());
+    ret = ret && extract(json, "attributeStatus", data.attributeStatus, GetVariableStatusEnumTypeHelper, error_message);
 
     // attributeType
-    if (json.HasMember("attributeType"))
-    {
-        data.attributeType = AttributeEnumTypeHelper.fromString(json["attributeType"].GetString());
-    }
+    ret = ret && extract(json, "attributeType", data.attributeType, AttributeEnumTypeHelper, error_message);
 
     // attributeValue
-    extract(json, "attributeValue", data.attributeValue);
+    ret = ret && extract(json, "attributeValue", data.attributeValue, error_message);
 
     // component
     ComponentTypeConverter component_converter;
-    ret = ret && component_converter.fromJson(json["component"], data.component, error_code, error_message);
+    ret = ret && extract(json, "component", data.component, component_converter, error_code, error_message);
 
     // variable
     VariableTypeConverter variable_converter;
-    ret = ret && variable_converter.fromJson(json["variable"], data.variable, error_code, error_message);
+    ret = ret && extract(json, "variable", data.variable, variable_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -84,7 +74,9 @@ bool GetVariableResultTypeConverter::fromJson(const rapidjson::Value&       json
 }
 
 /** @brief Convert a GetVariableResultType to a JSON representation */
-bool GetVariableResultTypeConverter::toJson(const GetVariableResultType& data, rapidjson::Document& json)
+bool GetVariableResultTypeConverter::toJson(const GetVariableResultType&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -92,47 +84,43 @@ bool GetVariableResultTypeConverter::toJson(const GetVariableResultType& data, r
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // attributeStatusInfo
     if (data.attributeStatusInfo.isSet())
     {
         StatusInfoTypeConverter attributeStatusInfo_converter;
-        attributeStatusInfo_converter.setAllocator(allocator);
-        rapidjson::Document attributeStatusInfo_doc(rapidjson::kObjectType);
-        ret = ret && attributeStatusInfo_converter.toJson(data.attributeStatusInfo, attributeStatusInfo_doc);
-        json.AddMember(rapidjson::StringRef("attributeStatusInfo"), attributeStatusInfo_doc.Move(), *allocator);
+        rapidjson::Value        attributeStatusInfo_doc(rapidjson::kObjectType);
+        ret = ret && attributeStatusInfo_converter.toJson(data.attributeStatusInfo, attributeStatusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("attributeStatusInfo"), attributeStatusInfo_doc.Move(), allocator);
     }
 
     // attributeStatus
-    fill(json, "attributeStatus", GetVariableStatusEnumTypeHelper.toString(data.attributeStatus));
+    fill(json, "attributeStatus", GetVariableStatusEnumTypeHelper.toString(data.attributeStatus), allocator);
 
     // attributeType
     if (data.attributeType.isSet())
     {
-        fill(json, "attributeType", AttributeEnumTypeHelper.toString(data.attributeType));
+        fill(json, "attributeType", AttributeEnumTypeHelper.toString(data.attributeType), allocator);
     }
 
     // attributeValue
-    fill(json, "attributeValue", data.attributeValue);
+    fill(json, "attributeValue", data.attributeValue, allocator);
 
     // component
     ComponentTypeConverter component_converter;
-    component_converter.setAllocator(allocator);
-    rapidjson::Document component_doc(rapidjson::kObjectType);
-    ret = ret && component_converter.toJson(data.component, component_doc);
-    json.AddMember(rapidjson::StringRef("component"), component_doc.Move(), *allocator);
+    rapidjson::Value       component_doc(rapidjson::kObjectType);
+    ret = ret && component_converter.toJson(data.component, component_doc, allocator);
+    json.AddMember(rapidjson::StringRef("component"), component_doc.Move(), allocator);
 
     // variable
     VariableTypeConverter variable_converter;
-    variable_converter.setAllocator(allocator);
-    rapidjson::Document variable_doc(rapidjson::kObjectType);
-    ret = ret && variable_converter.toJson(data.variable, variable_doc);
-    json.AddMember(rapidjson::StringRef("variable"), variable_doc.Move(), *allocator);
+    rapidjson::Value      variable_doc(rapidjson::kObjectType);
+    ret = ret && variable_converter.toJson(data.variable, variable_doc, allocator);
+    json.AddMember(rapidjson::StringRef("variable"), variable_doc.Move(), allocator);
 
     return ret;
 }
@@ -68,17 +68,14 @@ The Configuration Variable &lt;&lt;configkey-reporting-value-size,ReportingValue
 class GetVariableResultTypeConverter : public ocpp::messages::IMessageConverter<GetVariableResultType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<GetVariableResultType>* clone() const override { return new GetVariableResultTypeConverter(); }
-
     /** @brief Convert a GetVariableResultType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   GetVariableResultType&        data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a GetVariableResultType to a JSON representation */
-    bool toJson(const GetVariableResultType& data, rapidjson::Document& json) override;
+    bool toJson(const GetVariableResultType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
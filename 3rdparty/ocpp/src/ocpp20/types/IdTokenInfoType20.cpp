@@ -36,56 +36,47 @@ namespace ocpp20
 bool IdTokenInfoTypeConverter::fromJson(const rapidjson::Value&       json,
                                         IdTokenInfoType&              data,
                                         std::string&                  error_code,
-                                        [[maybe_unused]] std::string& error_message)
+                                        [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // status
-    data.status = AuthorizationStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, AuthorizationStatusEnumTypeHelper, error_message);
 
     // cacheExpiryDateTime
     ret = ret && extract(json, "cacheExpiryDateTime", data.cacheExpiryDateTime, error_message);
 
     // chargingPriority
-    extract(json, "chargingPriority", data.chargingPriority);
+    ret = ret && extract(json, "chargingPriority", data.chargingPriority, error_message);
 
     // language1
-    extract(json, "language1", data.language1);
+    ret = ret && extract(json, "language1", data.language1, error_message);
 
     // evseId
-    if (json.HasMember("evseId"))
+    ret = ret && checkArray(json, "evseId", false, 1u, 0u, error_message);
+    if (ret && json.HasMember("evseId"))
     {
         const rapidjson::Value& evseId_json = json["evseId"];
         for (auto it = evseId_json.Begin(); ret && (it != evseId_json.End()); ++it)
         {
-            int& item = data.evseId.emplace_back();
-            item      = it->GetInt();
+            ret = convert(*it, "evseId", data.evseId.emplace_back(), error_message);
         }
     }
 
     // groupIdToken
-    if (json.HasMember("groupIdToken"))
-    {
-        IdTokenTypeConverter groupIdToken_converter;
-        ret = ret && groupIdToken_converter.fromJson(json["groupIdToken"], data.groupIdToken, error_code, error_message);
-    }
+    IdTokenTypeConverter groupIdToken_converter;
+    ret = ret && extract(json, "groupIdToken", data.groupIdToken, groupIdToken_converter, error_code, error_message);
 
     // language2
-    extract(json, "language2", data.language2);
+    ret = ret && extract(json, "language2", data.language2, error_message);
 
     // personalMessage
-    if (json.HasMember("personalMessage"))
-    {
-        MessageContentTypeConverter personalMessage_converter;
-        ret = ret && personalMessage_converter.fromJson(json["personalMessage"], data.personalMessage, error_code, error_message);
-    }
+    MessageContentTypeConverter personalMessage_converter;
+    ret = ret && extract(json, "personalMessage", data.personalMessage, personalMessage_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -96,7 +87,9 @@ bool IdTokenInfoTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a IdTokenInfoType to a JSON representation */
-bool IdTokenInfoTypeConverter::toJson(const IdTokenInfoType& data, rapidjson::Document& json)
+bool IdTokenInfoTypeConverter::toJson(const IdTokenInfoType&              data,
+                                      rapidjson::Value&                   json,
+                                      rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -104,23 +97,22 @@ bool IdTokenInfoTypeConverter::toJson(const IdTokenInfoType& data, rapidjson::Do
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", AuthorizationStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", AuthorizationStatusEnumTypeHelper.toString(data.status), allocator);
 
     // cacheExpiryDateTime
-    fill(json, "cacheExpiryDateTime", data.cacheExpiryDateTime);
+    fill(json, "cacheExpiryDateTime", data.cacheExpiryDateTime, allocator);
 
     // chargingPriority
-    fill(json, "chargingPriority", data.chargingPriority);
+    fill(json, "chargingPriority", data.chargingPriority, allocator);
 
     // language1
-    fill(json, "language1", data.language1);
+    fill(json, "language1", data.language1, allocator);
 
     // evseId
     if (!data.evseId.empty())
@@ -129,32 +121,30 @@ bool IdTokenInfoTypeConverter::toJson(const IdTokenInfoType& data, rapidjson::Do
         rapidjson::Value evseId_json(rapidjson::kArrayType);
         for (const int& item : data.evseId)
         {
-            evseId_json.PushBack(rapidjson::Value(item), *allocator);
+            evseId_json.PushBack(rapidjson::Value(item), allocator);
         }
-        json.AddMember(rapidjson::StringRef("evseId"), evseId_json.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("evseId"), evseId_json.Move(), allocator);
     }
 
     // groupIdToken
     if (data.groupIdToken.isSet())
     {
         IdTokenTypeConverter groupIdToken_converter;
-        groupIdToken_converter.setAllocator(allocator);
-        rapidjson::Document groupIdToken_doc(rapidjson::kObjectType);
-        ret = ret && groupIdToken_converter.toJson(data.groupIdToken, groupIdToken_doc);
-        json.AddMember(rapidjson::StringRef("groupIdToken"), groupIdToken_doc.Move(), *allocator);
+        rapidjson::Value     groupIdToken_doc(rapidjson::kObjectType);
+        ret = ret && groupIdToken_converter.toJson(data.groupIdToken, groupIdToken_doc, allocator);
+        json.AddMember(rapidjson::StringRef("groupIdToken"), groupIdToken_doc.Move(), allocator);
     }
 
     // language2
-    fill(json, "language2", data.language2);
+    fill(json, "language2", data.language2, allocator);
 
     // personalMessage
     if (data.personalMessage.isSet())
     {
         MessageContentTypeConverter personalMessage_converter;
-        personalMessage_converter.setAllocator(allocator);
-        rapidjson::Document personalMessage_doc(rapidjson::kObjectType);
-        ret = ret && personalMessage_converter.toJson(data.personalMessage, personalMessage_doc);
-        json.AddMember(rapidjson::StringRef("personalMessage"), personalMessage_doc.Move(), *allocator);
+        rapidjson::Value            personalMessage_doc(rapidjson::kObjectType);
+        ret = ret && personalMessage_converter.toJson(data.personalMessage, personalMessage_doc, allocator);
+        json.AddMember(rapidjson::StringRef("personalMessage"), personalMessage_doc.Move(), allocator);
     }
 
     return ret;
@@ -79,17 +79,14 @@ Second preferred user interface language of identifier user. Don’t use when la
 class IdTokenInfoTypeConverter : public ocpp::messages::IMessageConverter<IdTokenInfoType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<IdTokenInfoType>* clone() const override { return new IdTokenInfoTypeConverter(); }
-
     /** @brief Convert a IdTokenInfoType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   IdTokenInfoType&              data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a IdTokenInfoType to a JSON representation */
-    bool toJson(const IdTokenInfoType& data, rapidjson::Document& json) override;
+    bool toJson(const IdTokenInfoType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
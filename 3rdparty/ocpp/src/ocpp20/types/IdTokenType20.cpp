@@ -36,34 +36,90 @@ namespace ocpp20
 bool IdTokenTypeConverter::fromJson(const rapidjson::Value&       json,
                                     IdTokenType&                  data,
                                     std::string&                  error_code,
-                                    [[maybe_unused]] std::string& error_message)
+                                    [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // additionalInfo
-    if (json.HasMember("additionalInfo"))
+    ret = ret && checkArray(json, "additionalInfo", false, 1u, 0u, error_message);
+    if (ret && json.HasMember("additionalInfo"))
     {
         const rapidjson::Value&     additionalInfo_json = json["additionalInfo"];
         AdditionalInfoTypeConverter additionalInfo_converter;
         for (auto it = additionalInfo_json.Begin(); ret && (it != additionalInfo_json.End()); ++it)
         {
-            AdditionalInfoType& item = data.additionalInfo.emplace_back();
-            ret                      = ret && additionalInfo_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it, "additionalInfo", data.additionalInfo.emplace_back(), additionalInfo_converter, error_code, error_message);
         }
     }
 
     // idToken
-    extract(json, "idToken", data.idToken);
+    ret = ret && extract(json, "idToken", data.idToken, error_message);
 
     // type
-    data.type = IdTokenEnumTypeHelper.fromString(json["type"].GetString());
+    ret = ret && extract(json, "type", data.type, IdTokenEnumTypeHelper, error_message);
+
+    if (!ret)
+    {
+        error_code = ocpp::rpc::IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
+    }
+
+    return ret;
+}
+
+/** @brief Convert a IdTokenType from a JSON stream */
+bool IdTokenTypeConverter::fromJson(ocpp::json::JsonReader&       reader,
+                                    IdTokenType&                  data,
+                                    std::string&                  error_code,
+                                    [[maybe_unused]] std::string& error_message) const
+{
+    bool ret           = true;
+    bool idToken_found = false;
+    bool type_found    = false;
+
+    while (ret && reader.nextMember())
+    {
+        if (reader.isMember("customData"))
+        {
+            CustomDataTypeConverter customData_converter;
+            ret = convert(reader, "customData", data.customData.value(), customData_converter, error_code, error_message);
+        }
+        else if (reader.isMember("additionalInfo"))
+        {
+            AdditionalInfoTypeConverter additionalInfo_converter;
+            ret = checkArray(reader, "additionalInfo", error_message);
+            while (ret && reader.nextItem())
+            {
+                ret = convert(reader,
+                              "additionalInfo",
+                              data.additionalInfo.emplace_back(),
+                              additionalInfo_converter,
+                              error_code,
+                              error_message);
+            }
+            ret = ret && checkItems("additionalInfo", data.additionalInfo.size(), 1u, 0u, error_message);
+        }
+        else if (reader.isMember("idToken"))
+        {
+            ret           = convert(reader, "idToken", data.idToken, error_message);
+            idToken_found = true;
+        }
+        else if (reader.isMember("type"))
+        {
+            ret        = convert(reader, "type", data.type, IdTokenEnumTypeHelper, error_message);
+            type_found = true;
+        }
+        else
+        {
+            ret = reader.skip();
+        }
+    }
+    ret = ret && !reader.hasError();
+    ret = ret && checkRequired("idToken", idToken_found, error_message);
+    ret = ret && checkRequired("type", type_found, error_message);
 
     if (!ret)
     {
@@ -74,7 +130,7 @@ bool IdTokenTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a IdTokenType to a JSON representation */
-bool IdTokenTypeConverter::toJson(const IdTokenType& data, rapidjson::Document& json)
+bool IdTokenTypeConverter::toJson(const IdTokenType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -82,10 +138,9 @@ bool IdTokenTypeConverter::toJson(const IdTokenType& data, rapidjson::Document&
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // additionalInfo
@@ -94,21 +149,20 @@ bool IdTokenTypeConverter::toJson(const IdTokenType& data, rapidjson::Document&
 
         rapidjson::Value            additionalInfo_json(rapidjson::kArrayType);
         AdditionalInfoTypeConverter additionalInfo_converter;
-        additionalInfo_converter.setAllocator(allocator);
         for (const AdditionalInfoType& item : data.additionalInfo)
         {
-            rapidjson::Document item_doc(rapidjson::kObjectType);
-            ret = ret && additionalInfo_converter.toJson(item, item_doc);
-            additionalInfo_json.PushBack(item_doc.Move(), *allocator);
+            rapidjson::Value item_doc(rapidjson::kObjectType);
+            ret = ret && additionalInfo_converter.toJson(item, item_doc, allocator);
+            additionalInfo_json.PushBack(item_doc.Move(), allocator);
         }
-        json.AddMember(rapidjson::StringRef("additionalInfo"), additionalInfo_json.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("additionalInfo"), additionalInfo_json.Move(), allocator);
     }
 
     // idToken
-    fill(json, "idToken", data.idToken);
+    fill(json, "idToken", data.idToken, allocator);
 
     // type
-    fill(json, "type", IdTokenEnumTypeHelper.toString(data.type));
+    fill(json, "type", IdTokenEnumTypeHelper.toString(data.type), allocator);
 
     return ret;
 }
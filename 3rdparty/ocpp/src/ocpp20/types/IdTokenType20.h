@@ -58,17 +58,20 @@ struct IdTokenType
 class IdTokenTypeConverter : public ocpp::messages::IMessageConverter<IdTokenType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<IdTokenType>* clone() const override { return new IdTokenTypeConverter(); }
-
     /** @brief Convert a IdTokenType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   IdTokenType&                  data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
+
+    /** @brief Convert a IdTokenType from a JSON stream */
+    bool fromJson(ocpp::json::JsonReader&       reader,
+                  IdTokenType&                  data,
+                  std::string&                  error_code,
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a IdTokenType to a JSON representation */
-    bool toJson(const IdTokenType& data, rapidjson::Document& json) override;
+    bool toJson(const IdTokenType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,19 +36,16 @@ namespace ocpp20
 bool LogParametersTypeConverter::fromJson(const rapidjson::Value&       json,
                                           LogParametersType&            data,
                                           std::string&                  error_code,
-                                          [[maybe_unused]] std::string& error_message)
+                                          [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // remoteLocation
-    extract(json, "remoteLocation", data.remoteLocation);
+    ret = ret && extract(json, "remoteLocation", data.remoteLocation, error_message);
 
     // oldestTimestamp
     ret = ret && extract(json, "oldestTimestamp", data.oldestTimestamp, error_message);
@@ -65,7 +62,9 @@ bool LogParametersTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a LogParametersType to a JSON representation */
-bool LogParametersTypeConverter::toJson(const LogParametersType& data, rapidjson::Document& json)
+bool LogParametersTypeConverter::toJson(const LogParametersType&            data,
+                                        rapidjson::Value&                   json,
+                                        rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -73,20 +72,19 @@ bool LogParametersTypeConverter::toJson(const LogParametersType& data, rapidjson
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // remoteLocation
-    fill(json, "remoteLocation", data.remoteLocation);
+    fill(json, "remoteLocation", data.remoteLocation, allocator);
 
     // oldestTimestamp
-    fill(json, "oldestTimestamp", data.oldestTimestamp);
+    fill(json, "oldestTimestamp", data.oldestTimestamp, allocator);
 
     // latestTimestamp
-    fill(json, "latestTimestamp", data.latestTimestamp);
+    fill(json, "latestTimestamp", data.latestTimestamp, allocator);
 
     return ret;
 }
@@ -64,17 +64,14 @@ This contains the date and time of the latest logging information to include in
 class LogParametersTypeConverter : public ocpp::messages::IMessageConverter<LogParametersType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<LogParametersType>* clone() const override { return new LogParametersTypeConverter(); }
-
     /** @brief Convert a LogParametersType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   LogParametersType&            data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a LogParametersType to a JSON representation */
-    bool toJson(const LogParametersType& data, rapidjson::Document& json) override;
+    bool toJson(const LogParametersType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,25 +36,22 @@ namespace ocpp20
 bool MessageContentTypeConverter::fromJson(const rapidjson::Value&       json,
                                            MessageContentType&           data,
                                            std::string&                  error_code,
-                                           [[maybe_unused]] std::string& error_message)
+                                           [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // format
-    data.format = MessageFormatEnumTypeHelper.fromString(json["format"].GetString());
+    ret = ret && extract(json, "format", data.format, MessageFormatEnumTypeHelper, error_message);
 
     // language
-    extract(json, "language", data.language);
+    ret = ret && extract(json, "language", data.language, error_message);
 
     // content
-    extract(json, "content", data.content);
+    ret = ret && extract(json, "content", data.content, error_message);
 
     if (!ret)
     {
@@ -65,7 +62,9 @@ bool MessageContentTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a MessageContentType to a JSON representation */
-bool MessageContentTypeConverter::toJson(const MessageContentType& data, rapidjson::Document& json)
+bool MessageContentTypeConverter::toJson(const MessageContentType&           data,
+                                         rapidjson::Value&                   json,
+                                         rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -73,20 +72,19 @@ bool MessageContentTypeConverter::toJson(const MessageContentType& data, rapidjs
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // format
-    fill(json, "format", MessageFormatEnumTypeHelper.toString(data.format));
+    fill(json, "format", MessageFormatEnumTypeHelper.toString(data.format), allocator);
 
     // language
-    fill(json, "language", data.language);
+    fill(json, "language", data.language, allocator);
 
     // content
-    fill(json, "content", data.content);
+    fill(json, "content", data.content, allocator);
 
     return ret;
 }
@@ -63,17 +63,14 @@ Message contents. */
 class MessageContentTypeConverter : public ocpp::messages::IMessageConverter<MessageContentType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<MessageContentType>* clone() const override { return new MessageContentTypeConverter(); }
-
     /** @brief Convert a MessageContentType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   MessageContentType&           data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a MessageContentType to a JSON representation */
-    bool toJson(const MessageContentType& data, rapidjson::Document& json) override;
+    bool toJson(const MessageContentType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,35 +36,26 @@ namespace ocpp20
 bool MessageInfoTypeConverter::fromJson(const rapidjson::Value&       json,
                                         MessageInfoType&              data,
                                         std::string&                  error_code,
-                                        [[maybe_unused]] std::string& error_message)
+                                        [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // display
-    if (json.HasMember("display"))
-    {
-        ComponentTypeConverter display_converter;
-        ret = ret && display_converter.fromJson(json["display"], data.display, error_code, error_message);
-    }
+    ComponentTypeConverter display_converter;
+    ret = ret && extract(json, "display", data.display, display_converter, error_code, error_message);
 
     // id
-    extract(json, "id", data.id);
+    ret = ret && extract(json, "id", data.id, error_message);
 
     // priority
-    data.priority = MessagePriorityEnumTypeHelper.fromString(json["priority"].GetString());
+    ret = ret && extract(json, "priority", data.priority, MessagePriorityEnumTypeHelper, error_message);
 
     // state
-    if (json.HasMember("state"))
-    {
-        data.state = MessageStateEnumTypeHelper.fromString(json["state"].GetString());
-    }
+    ret = ret && extract(json, "state", data.state, MessageStateEnumTypeHelper, error_message);
 
     // startDateTime
     ret = ret && extract(json, "startDateTime", data.startDateTime, error_message);
@@ -73,11 +64,11 @@ bool MessageInfoTypeConverter::fromJson(const rapidjson::Value&       json,
     ret = ret && extract(json, "endDateTime", data.endDateTime, error_message);
 
     // transactionId
-    extract(json, "transactionId", data.transactionId);
+    ret = ret && extract(json, "transactionId", data.transactionId, error_message);
 
     // message
     MessageContentTypeConverter message_converter;
-    ret = ret && message_converter.fromJson(json["message"], data.message, error_code, error_message);
+    ret = ret && extract(json, "message", data.message, message_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -88,7 +79,9 @@ bool MessageInfoTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a MessageInfoType to a JSON representation */
-bool MessageInfoTypeConverter::toJson(const MessageInfoType& data, rapidjson::Document& json)
+bool MessageInfoTypeConverter::toJson(const MessageInfoType&              data,
+                                      rapidjson::Value&                   json,
+                                      rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -96,49 +89,46 @@ bool MessageInfoTypeConverter::toJson(const MessageInfoType& data, rapidjson::Do
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // display
     if (data.display.isSet())
     {
         ComponentTypeConverter display_converter;
-        display_converter.setAllocator(allocator);
-        rapidjson::Document display_doc(rapidjson::kObjectType);
-        ret = ret && display_converter.toJson(data.display, display_doc);
-        json.AddMember(rapidjson::StringRef("display"), display_doc.Move(), *allocator);
+        rapidjson::Value       display_doc(rapidjson::kObjectType);
+        ret = ret && display_converter.toJson(data.display, display_doc, allocator);
+        json.AddMember(rapidjson::StringRef("display"), display_doc.Move(), allocator);
     }
 
     // id
-    fill(json, "id", data.id);
+    fill(json, "id", data.id, allocator);
 
     // priority
-    fill(json, "priority", MessagePriorityEnumTypeHelper.toString(data.priority));
+    fill(json, "priority", MessagePriorityEnumTypeHelper.toString(data.priority), allocator);
 
     // state
     if (data.state.isSet())
     {
-        fill(json, "state", MessageStateEnumTypeHelper.toString(data.state));
+        fill(json, "state", MessageStateEnumTypeHelper.toString(data.state), allocator);
     }
 
     // startDateTime
-    fill(json, "startDateTime", data.startDateTime);
+    fill(json, "startDateTime", data.startDateTime, allocator);
 
     // endDateTime
-    fill(json, "endDateTime", data.endDateTime);
+    fill(json, "endDateTime", data.endDateTime, allocator);
 
     // transactionId
-    fill(json, "transactionId", data.transactionId);
+    fill(json, "transactionId", data.transactionId, allocator);
 
     // message
     MessageContentTypeConverter message_converter;
-    message_converter.setAllocator(allocator);
-    rapidjson::Document message_doc(rapidjson::kObjectType);
-    ret = ret && message_converter.toJson(data.message, message_doc);
-    json.AddMember(rapidjson::StringRef("message"), message_doc.Move(), *allocator);
+    rapidjson::Value            message_doc(rapidjson::kObjectType);
+    ret = ret && message_converter.toJson(data.message, message_doc, allocator);
+    json.AddMember(rapidjson::StringRef("message"), message_doc.Move(), allocator);
 
     return ret;
 }
@@ -80,17 +80,14 @@ ended. */
 class MessageInfoTypeConverter : public ocpp::messages::IMessageConverter<MessageInfoType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<MessageInfoType>* clone() const override { return new MessageInfoTypeConverter(); }
-
     /** @brief Convert a MessageInfoType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   MessageInfoType&              data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a MessageInfoType to a JSON representation */
-    bool toJson(const MessageInfoType& data, rapidjson::Document& json) override;
+    bool toJson(const MessageInfoType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
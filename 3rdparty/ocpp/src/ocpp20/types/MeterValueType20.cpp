@@ -36,26 +36,23 @@ namespace ocpp20
 bool MeterValueTypeConverter::fromJson(const rapidjson::Value&       json,
                                        MeterValueType&               data,
                                        std::string&                  error_code,
-                                       [[maybe_unused]] std::string& error_message)
+                                       [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // sampledValue
-    if (json.HasMember("sampledValue"))
+    ret = ret && checkArray(json, "sampledValue", true, 1u, 0u, error_message);
+    if (ret && json.HasMember("sampledValue"))
     {
         const rapidjson::Value&   sampledValue_json = json["sampledValue"];
         SampledValueTypeConverter sampledValue_converter;
         for (auto it = sampledValue_json.Begin(); ret && (it != sampledValue_json.End()); ++it)
         {
-            SampledValueType& item = data.sampledValue.emplace_back();
-            ret                    = ret && sampledValue_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it, "sampledValue", data.sampledValue.emplace_back(), sampledValue_converter, error_code, error_message);
         }
     }
 
@@ -70,8 +67,60 @@ bool MeterValueTypeConverter::fromJson(const rapidjson::Value&       json,
     return ret;
 }
 
+/** @brief Convert a MeterValueType from a JSON stream */
+bool MeterValueTypeConverter::fromJson(ocpp::json::JsonReader&       reader,
+                                       MeterValueType&               data,
+                                       std::string&                  error_code,
+                                       [[maybe_unused]] std::string& error_message) const
+{
+    bool ret                = true;
+    bool sampledValue_found = false;
+    bool timestamp_found    = false;
+
+    while (ret && reader.nextMember())
+    {
+        if (reader.isMember("customData"))
+        {
+            CustomDataTypeConverter customData_converter;
+            ret = convert(reader, "customData", data.customData.value(), customData_converter, error_code, error_message);
+        }
+        else if (reader.isMember("sampledValue"))
+        {
+            SampledValueTypeConverter sampledValue_converter;
+            ret = checkArray(reader, "sampledValue", error_message);
+            while (ret && reader.nextItem())
+            {
+                ret = convert(reader, "sampledValue", data.sampledValue.emplace_back(), sampledValue_converter, error_code, error_message);
+            }
+            ret                = ret && checkItems("sampledValue", data.sampledValue.size(), 1u, 0u, error_message);
+            sampledValue_found = true;
+        }
+        else if (reader.isMember("timestamp"))
+        {
+            ret             = convert(reader, "timestamp", data.timestamp, error_message);
+            timestamp_found = true;
+        }
+        else
+        {
+            ret = reader.skip();
+        }
+    }
+    ret = ret && !reader.hasError();
+    ret = ret && checkRequired("sampledValue", sampledValue_found, error_message);
+    ret = ret && checkRequired("timestamp", timestamp_found, error_message);
+
+    if (!ret)
+    {
+        error_code = ocpp::rpc::IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
+    }
+
+    return ret;
+}
+
 /** @brief Convert a MeterValueType to a JSON representation */
-bool MeterValueTypeConverter::toJson(const MeterValueType& data, rapidjson::Document& json)
+bool MeterValueTypeConverter::toJson(const MeterValueType&               data,
+                                     rapidjson::Value&                   json,
+                                     rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -79,27 +128,25 @@ bool MeterValueTypeConverter::toJson(const MeterValueType& data, rapidjson::Docu
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // sampledValue
 
     rapidjson::Value          sampledValue_json(rapidjson::kArrayType);
     SampledValueTypeConverter sampledValue_converter;
-    sampledValue_converter.setAllocator(allocator);
     for (const SampledValueType& item : data.sampledValue)
     {
-        rapidjson::Document item_doc(rapidjson::kObjectType);
-        ret = ret && sampledValue_converter.toJson(item, item_doc);
-        sampledValue_json.PushBack(item_doc.Move(), *allocator);
+        rapidjson::Value item_doc(rapidjson::kObjectType);
+        ret = ret && sampledValue_converter.toJson(item, item_doc, allocator);
+        sampledValue_json.PushBack(item_doc.Move(), allocator);
     }
-    json.AddMember(rapidjson::StringRef("sampledValue"), sampledValue_json.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("sampledValue"), sampledValue_json.Move(), allocator);
 
     // timestamp
-    fill(json, "timestamp", data.timestamp);
+    fill(json, "timestamp", data.timestamp, allocator);
 
     return ret;
 }
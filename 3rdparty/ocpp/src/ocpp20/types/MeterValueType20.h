@@ -59,17 +59,20 @@ Timestamp for measured value(s). */
 class MeterValueTypeConverter : public ocpp::messages::IMessageConverter<MeterValueType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<MeterValueType>* clone() const override { return new MeterValueTypeConverter(); }
-
     /** @brief Convert a MeterValueType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   MeterValueType&               data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
+
+    /** @brief Convert a MeterValueType from a JSON stream */
+    bool fromJson(ocpp::json::JsonReader&       reader,
+                  MeterValueType&               data,
+                  std::string&                  error_code,
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a MeterValueType to a JSON representation */
-    bool toJson(const MeterValueType& data, rapidjson::Document& json) override;
+    bool toJson(const MeterValueType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
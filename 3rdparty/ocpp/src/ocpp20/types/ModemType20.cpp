@@ -36,22 +36,19 @@ namespace ocpp20
 bool ModemTypeConverter::fromJson(const rapidjson::Value&       json,
                                   ModemType&                    data,
                                   std::string&                  error_code,
-                                  [[maybe_unused]] std::string& error_message)
+                                  [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // iccid
-    extract(json, "iccid", data.iccid);
+    ret = ret && extract(json, "iccid", data.iccid, error_message);
 
     // imsi
-    extract(json, "imsi", data.imsi);
+    ret = ret && extract(json, "imsi", data.imsi, error_message);
 
     if (!ret)
     {
@@ -62,7 +59,7 @@ bool ModemTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a ModemType to a JSON representation */
-bool ModemTypeConverter::toJson(const ModemType& data, rapidjson::Document& json)
+bool ModemTypeConverter::toJson(const ModemType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -70,17 +67,16 @@ bool ModemTypeConverter::toJson(const ModemType& data, rapidjson::Document& json
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // iccid
-    fill(json, "iccid", data.iccid);
+    fill(json, "iccid", data.iccid, allocator);
 
     // imsi
-    fill(json, "imsi", data.imsi);
+    fill(json, "imsi", data.imsi, allocator);
 
     return ret;
 }
@@ -59,17 +59,14 @@ This contains the IMSI of the modem’s SIM card. */
 class ModemTypeConverter : public ocpp::messages::IMessageConverter<ModemType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<ModemType>* clone() const override { return new ModemTypeConverter(); }
-
     /** @brief Convert a ModemType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   ModemType&                    data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a ModemType to a JSON representation */
-    bool toJson(const ModemType& data, rapidjson::Document& json) override;
+    bool toJson(const ModemType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
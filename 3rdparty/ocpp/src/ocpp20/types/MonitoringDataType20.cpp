@@ -36,34 +36,36 @@ namespace ocpp20
 bool MonitoringDataTypeConverter::fromJson(const rapidjson::Value&       json,
                                            MonitoringDataType&           data,
                                            std::string&                  error_code,
-                                           [[maybe_unused]] std::string& error_message)
+                                           [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // component
     ComponentTypeConverter component_converter;
-    ret = ret && component_converter.fromJson(json["component"], data.component, error_code, error_message);
+    ret = ret && extract(json, "component", data.component, component_converter, error_code, error_message);
 
     // variable
     VariableTypeConverter variable_converter;
-    ret = ret && variable_converter.fromJson(json["variable"], data.variable, error_code, error_message);
+    ret = ret && extract(json, "variable", data.variable, variable_converter, error_code, error_message);
 
     // variableMonitoring
-    if (json.HasMember("variableMonitoring"))
+    ret = ret && checkArray(json, "variableMonitoring", true, 1u, 0u, error_message);
+    if (ret && json.HasMember("variableMonitoring"))
     {
         const rapidjson::Value&         variableMonitoring_json = json["variableMonitoring"];
         VariableMonitoringTypeConverter variableMonitoring_converter;
         for (auto it = variableMonitoring_json.Begin(); ret && (it != variableMonitoring_json.End()); ++it)
         {
-            VariableMonitoringType& item = data.variableMonitoring.emplace_back();
-            ret                          = ret && variableMonitoring_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it,
+                          "variableMonitoring",
+                          data.variableMonitoring.emplace_back(),
+                          variableMonitoring_converter,
+                          error_code,
+                          error_message);
         }
     }
 
@@ -76,7 +78,9 @@ bool MonitoringDataTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a MonitoringDataType to a JSON representation */
-bool MonitoringDataTypeConverter::toJson(const MonitoringDataType& data, rapidjson::Document& json)
+bool MonitoringDataTypeConverter::toJson(const MonitoringDataType&           data,
+                                         rapidjson::Value&                   json,
+                                         rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -84,38 +88,34 @@ bool MonitoringDataTypeConverter::toJson(const MonitoringDataType& data, rapidjs
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // component
     ComponentTypeConverter component_converter;
-    component_converter.setAllocator(allocator);
-    rapidjson::Document component_doc(rapidjson::kObjectType);
-    ret = ret && component_converter.toJson(data.component, component_doc);
-    json.AddMember(rapidjson::StringRef("component"), component_doc.Move(), *allocator);
+    rapidjson::Value       component_doc(rapidjson::kObjectType);
+    ret = ret && component_converter.toJson(data.component, component_doc, allocator);
+    json.AddMember(rapidjson::StringRef("component"), component_doc.Move(), allocator);
 
     // variable
     VariableTypeConverter variable_converter;
-    variable_converter.setAllocator(allocator);
-    rapidjson::Document variable_doc(rapidjson::kObjectType);
-    ret = ret && variable_converter.toJson(data.variable, variable_doc);
-    json.AddMember(rapidjson::StringRef("variable"), variable_doc.Move(), *allocator);
+    rapidjson::Value      variable_doc(rapidjson::kObjectType);
+    ret = ret && variable_converter.toJson(data.variable, variable_doc, allocator);
+    json.AddMember(rapidjson::StringRef("variable"), variable_doc.Move(), allocator);
 
     // variableMonitoring
 
     rapidjson::Value                variableMonitoring_json(rapidjson::kArrayType);
     VariableMonitoringTypeConverter variableMonitoring_converter;
-    variableMonitoring_converter.setAllocator(allocator);
     for (const VariableMonitoringType& item : data.variableMonitoring)
     {
-        rapidjson::Document item_doc(rapidjson::kObjectType);
-        ret = ret && variableMonitoring_converter.toJson(item, item_doc);
-        variableMonitoring_json.PushBack(item_doc.Move(), *allocator);
+        rapidjson::Value item_doc(rapidjson::kObjectType);
+        ret = ret && variableMonitoring_converter.toJson(item, item_doc, allocator);
+        variableMonitoring_json.PushBack(item_doc.Move(), allocator);
     }
-    json.AddMember(rapidjson::StringRef("variableMonitoring"), variableMonitoring_json.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("variableMonitoring"), variableMonitoring_json.Move(), allocator);
 
     return ret;
 }
@@ -58,17 +58,14 @@ struct MonitoringDataType
 class MonitoringDataTypeConverter : public ocpp::messages::IMessageConverter<MonitoringDataType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<MonitoringDataType>* clone() const override { return new MonitoringDataTypeConverter(); }
-
     /** @brief Convert a MonitoringDataType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   MonitoringDataType&           data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a MonitoringDataType to a JSON representation */
-    bool toJson(const MonitoringDataType& data, rapidjson::Document& json) override;
+    bool toJson(const MonitoringDataType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
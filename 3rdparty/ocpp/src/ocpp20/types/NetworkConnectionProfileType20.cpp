@@ -36,48 +36,39 @@ namespace ocpp20
 bool NetworkConnectionProfileTypeConverter::fromJson(const rapidjson::Value&       json,
                                                      NetworkConnectionProfileType& data,
                                                      std::string&                  error_code,
-                                                     [[maybe_unused]] std::string& error_message)
+                                                     [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // apn
-    if (json.HasMember("apn"))
-    {
-        APNTypeConverter apn_converter;
-        ret = ret && apn_converter.fromJson(json["apn"], data.apn, error_code, error_message);
-    }
+    APNTypeConverter apn_converter;
+    ret = ret && extract(json, "apn", data.apn, apn_converter, error_code, error_message);
 
     // ocppVersion
-    data.ocppVersion = OCPPVersionEnumTypeHelper.fromString(json["ocppVersion"].GetString());
+    ret = ret && extract(json, "ocppVersion", data.ocppVersion, OCPPVersionEnumTypeHelper, error_message);
 
     // ocppTransport
-    data.ocppTransport = OCPPTransportEnumTypeHelper.fromString(json["ocppTransport"].GetString());
+    ret = ret && extract(json, "ocppTransport", data.ocppTransport, OCPPTransportEnumTypeHelper, error_message);
 
     // ocppCsmsUrl
-    extract(json, "ocppCsmsUrl", data.ocppCsmsUrl);
+    ret = ret && extract(json, "ocppCsmsUrl", data.ocppCsmsUrl, error_message);
 
     // messageTimeout
-    extract(json, "messageTimeout", data.messageTimeout);
+    ret = ret && extract(json, "messageTimeout", data.messageTimeout, error_message);
 
     // securityProfile
-    extract(json, "securityProfile", data.securityProfile);
+    ret = ret && extract(json, "securityProfile", data.securityProfile, error_message);
 
     // ocppInterface
-    data.ocppInterface = OCPPInterfaceEnumTypeHelper.fromString(json["ocppInterface"].GetString());
+    ret = ret && extract(json, "ocppInterface", data.ocppInterface, OCPPInterfaceEnumTypeHelper, error_message);
 
     // vpn
-    if (json.HasMember("vpn"))
-    {
-        VPNTypeConverter vpn_converter;
-        ret = ret && vpn_converter.fromJson(json["vpn"], data.vpn, error_code, error_message);
-    }
+    VPNTypeConverter vpn_converter;
+    ret = ret && extract(json, "vpn", data.vpn, vpn_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -88,7 +79,9 @@ bool NetworkConnectionProfileTypeConverter::fromJson(const rapidjson::Value&
 }
 
 /** @brief Convert a NetworkConnectionProfileType to a JSON representation */
-bool NetworkConnectionProfileTypeConverter::toJson(const NetworkConnectionProfileType& data, rapidjson::Document& json)
+bool NetworkConnectionProfileTypeConverter::toJson(const NetworkConnectionProfileType& data,
+                                                   rapidjson::Value&                   json,
+                                                   rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -96,48 +89,45 @@ bool NetworkConnectionProfileTypeConverter::toJson(const NetworkConnectionProfil
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // apn
     if (data.apn.isSet())
     {
         APNTypeConverter apn_converter;
-        apn_converter.setAllocator(allocator);
-        rapidjson::Document apn_doc(rapidjson::kObjectType);
-        ret = ret && apn_converter.toJson(data.apn, apn_doc);
-        json.AddMember(rapidjson::StringRef("apn"), apn_doc.Move(), *allocator);
+        rapidjson::Value apn_doc(rapidjson::kObjectType);
+        ret = ret && apn_converter.toJson(data.apn, apn_doc, allocator);
+        json.AddMember(rapidjson::StringRef("apn"), apn_doc.Move(), allocator);
     }
 
     // ocppVersion
-    fill(json, "ocppVersion", OCPPVersionEnumTypeHelper.toString(data.ocppVersion));
+    fill(json, "ocppVersion", OCPPVersionEnumTypeHelper.toString(data.ocppVersion), allocator);
 
     // ocppTransport
-    fill(json, "ocppTransport", OCPPTransportEnumTypeHelper.toString(data.ocppTransport));
+    fill(json, "ocppTransport", OCPPTransportEnumTypeHelper.toString(data.ocppTransport), allocator);
 
     // ocppCsmsUrl
-    fill(json, "ocppCsmsUrl", data.ocppCsmsUrl);
+    fill(json, "ocppCsmsUrl", data.ocppCsmsUrl, allocator);
 
     // messageTimeout
-    fill(json, "messageTimeout", data.messageTimeout);
+    fill(json, "messageTimeout", data.messageTimeout, allocator);
 
     // securityProfile
-    fill(json, "securityProfile", data.securityProfile);
+    fill(json, "securityProfile", data.securityProfile, allocator);
 
     // ocppInterface
-    fill(json, "ocppInterface", OCPPInterfaceEnumTypeHelper.toString(data.ocppInterface));
+    fill(json, "ocppInterface", OCPPInterfaceEnumTypeHelper.toString(data.ocppInterface), allocator);
 
     // vpn
     if (data.vpn.isSet())
     {
         VPNTypeConverter vpn_converter;
-        vpn_converter.setAllocator(allocator);
-        rapidjson::Document vpn_doc(rapidjson::kObjectType);
-        ret = ret && vpn_converter.toJson(data.vpn, vpn_doc);
-        json.AddMember(rapidjson::StringRef("vpn"), vpn_doc.Move(), *allocator);
+        rapidjson::Value vpn_doc(rapidjson::kObjectType);
+        ret = ret && vpn_converter.toJson(data.vpn, vpn_doc, allocator);
+        json.AddMember(rapidjson::StringRef("vpn"), vpn_doc.Move(), allocator);
     }
 
     return ret;
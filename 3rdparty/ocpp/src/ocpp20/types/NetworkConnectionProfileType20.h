@@ -76,20 +76,16 @@ If you are looking for a some guideline: use 30 seconds as a starting point. */
 class NetworkConnectionProfileTypeConverter : public ocpp::messages::IMessageConverter<NetworkConnectionProfileType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<NetworkConnectionProfileType>* clone() const override
-    {
-        return new NetworkConnectionProfileTypeConverter();
-    }
-
     /** @brief Convert a NetworkConnectionProfileType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   NetworkConnectionProfileType& data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a NetworkConnectionProfileType to a JSON representation */
-    bool toJson(const NetworkConnectionProfileType& data, rapidjson::Document& json) override;
+    bool toJson(const NetworkConnectionProfileType& data,
+                rapidjson::Value&                   json,
+                rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
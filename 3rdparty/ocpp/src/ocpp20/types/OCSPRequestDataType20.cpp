@@ -36,31 +36,28 @@ namespace ocpp20
 bool OCSPRequestDataTypeConverter::fromJson(const rapidjson::Value&       json,
                                             OCSPRequestDataType&          data,
                                             std::string&                  error_code,
-                                            [[maybe_unused]] std::string& error_message)
+                                            [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // hashAlgorithm
-    data.hashAlgorithm = HashAlgorithmEnumTypeHelper.fromString(json["hashAlgorithm"].GetString());
+    ret = ret && extract(json, "hashAlgorithm", data.hashAlgorithm, HashAlgorithmEnumTypeHelper, error_message);
 
     // issuerNameHash
-    extract(json, "issuerNameHash", data.issuerNameHash);
+    ret = ret && extract(json, "issuerNameHash", data.issuerNameHash, error_message);
 
     // issuerKeyHash
-    extract(json, "issuerKeyHash", data.issuerKeyHash);
+    ret = ret && extract(json, "issuerKeyHash", data.issuerKeyHash, error_message);
 
     // serialNumber
-    extract(json, "serialNumber", data.serialNumber);
+    ret = ret && extract(json, "serialNumber", data.serialNumber, error_message);
 
     // responderURL
-    extract(json, "responderURL", data.responderURL);
+    ret = ret && extract(json, "responderURL", data.responderURL, error_message);
 
     if (!ret)
     {
@@ -71,7 +68,9 @@ bool OCSPRequestDataTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a OCSPRequestDataType to a JSON representation */
-bool OCSPRequestDataTypeConverter::toJson(const OCSPRequestDataType& data, rapidjson::Document& json)
+bool OCSPRequestDataTypeConverter::toJson(const OCSPRequestDataType&          data,
+                                          rapidjson::Value&                   json,
+                                          rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -79,26 +78,25 @@ bool OCSPRequestDataTypeConverter::toJson(const OCSPRequestDataType& data, rapid
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // hashAlgorithm
-    fill(json, "hashAlgorithm", HashAlgorithmEnumTypeHelper.toString(data.hashAlgorithm));
+    fill(json, "hashAlgorithm", HashAlgorithmEnumTypeHelper.toString(data.hashAlgorithm), allocator);
 
     // issuerNameHash
-    fill(json, "issuerNameHash", data.issuerNameHash);
+    fill(json, "issuerNameHash", data.issuerNameHash, allocator);
 
     // issuerKeyHash
-    fill(json, "issuerKeyHash", data.issuerKeyHash);
+    fill(json, "issuerKeyHash", data.issuerKeyHash, allocator);
 
     // serialNumber
-    fill(json, "serialNumber", data.serialNumber);
+    fill(json, "serialNumber", data.serialNumber, allocator);
 
     // responderURL
-    fill(json, "responderURL", data.responderURL);
+    fill(json, "responderURL", data.responderURL, allocator);
 
     return ret;
 }
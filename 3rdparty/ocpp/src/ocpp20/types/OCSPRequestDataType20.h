@@ -59,17 +59,14 @@ struct OCSPRequestDataType
 class OCSPRequestDataTypeConverter : public ocpp::messages::IMessageConverter<OCSPRequestDataType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<OCSPRequestDataType>* clone() const override { return new OCSPRequestDataTypeConverter(); }
-
     /** @brief Convert a OCSPRequestDataType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   OCSPRequestDataType&          data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a OCSPRequestDataType to a JSON representation */
-    bool toJson(const OCSPRequestDataType& data, rapidjson::Document& json) override;
+    bool toJson(const OCSPRequestDataType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,22 +36,19 @@ namespace ocpp20
 bool RelativeTimeIntervalTypeConverter::fromJson(const rapidjson::Value&       json,
                                                  RelativeTimeIntervalType&     data,
                                                  std::string&                  error_code,
-                                                 [[maybe_unused]] std::string& error_message)
+                                                 [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // start
-    extract(json, "start", data.start);
+    ret = ret && extract(json, "start", data.start, error_message);
 
     // duration
-    extract(json, "duration", data.duration);
+    ret = ret && extract(json, "duration", data.duration, error_message);
 
     if (!ret)
     {
@@ -62,7 +59,9 @@ bool RelativeTimeIntervalTypeConverter::fromJson(const rapidjson::Value&       j
 }
 
 /** @brief Convert a RelativeTimeIntervalType to a JSON representation */
-bool RelativeTimeIntervalTypeConverter::toJson(const RelativeTimeIntervalType& data, rapidjson::Document& json)
+bool RelativeTimeIntervalTypeConverter::toJson(const RelativeTimeIntervalType&     data,
+                                               rapidjson::Value&                   json,
+                                               rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -70,17 +69,16 @@ bool RelativeTimeIntervalTypeConverter::toJson(const RelativeTimeIntervalType& d
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // start
-    fill(json, "start", data.start);
+    fill(json, "start", data.start, allocator);
 
     // duration
-    fill(json, "duration", data.duration);
+    fill(json, "duration", data.duration, allocator);
 
     return ret;
 }
@@ -57,17 +57,14 @@ Duration of the interval, in seconds. */
 class RelativeTimeIntervalTypeConverter : public ocpp::messages::IMessageConverter<RelativeTimeIntervalType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<RelativeTimeIntervalType>* clone() const override { return new RelativeTimeIntervalTypeConverter(); }
-
     /** @brief Convert a RelativeTimeIntervalType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   RelativeTimeIntervalType&     data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a RelativeTimeIntervalType to a JSON representation */
-    bool toJson(const RelativeTimeIntervalType& data, rapidjson::Document& json) override;
+    bool toJson(const RelativeTimeIntervalType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,44 +36,47 @@ namespace ocpp20
 bool ReportDataTypeConverter::fromJson(const rapidjson::Value&       json,
                                        ReportDataType&               data,
                                        std::string&                  error_code,
-                                       [[maybe_unused]] std::string& error_message)
+                                       [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // component
     ComponentTypeConverter component_converter;
-    ret = ret && component_converter.fromJson(json["component"], data.component, error_code, error_message);
+    ret = ret && extract(json, "component", data.component, component_converter, error_code, error_message);
 
     // variable
     VariableTypeConverter variable_converter;
-    ret = ret && variable_converter.fromJson(json["variable"], data.variable, error_code, error_message);
+    ret = ret && extract(json, "variable", data.variable, variable_converter, error_code, error_message);
 
     // variableAttribute
-    if (json.HasMember("variableAttribute"))
+    ret = ret && checkArray(json, "variableAttribute", true, 1u, 4u, error_message);
+    if (ret && json.HasMember("variableAttribute"))
     {
         const rapidjson::Value&        variableAttribute_json = json["variableAttribute"];
         VariableAttributeTypeConverter variableAttribute_converter;
         for (auto it = variableAttribute_json.Begin(); ret && (it != variableAttribute_json.End()); ++it)
         {
-            VariableAttributeType& item = data.variableAttribute.emplace_back();
-            ret                         = ret && variableAttribute_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it,
+                          "variableAttribute",
+                          data.variableAttribute.emplace_back(),
+                          variableAttribute_converter,
+                          error_code,
+                          error_message);
         }
     }
 
     // variableCharacteristics
-    if (json.HasMember("variableCharacteristics"))
-    {
-        VariableCharacteristicsTypeConverter variableCharacteristics_converter;
-        ret = ret && variableCharacteristics_converter.fromJson(
-                         json["variableCharacteristics"], data.variableCharacteristics, error_code, error_message);
-    }
+    VariableCharacteristicsTypeConverter variableCharacteristics_converter;
+    ret = ret && extract(json,
+                         "variableCharacteristics",
+                         data.variableCharacteristics,
+                         variableCharacteristics_converter,
+                         error_code,
+                         error_message);
 
     if (!ret)
     {
@@ -84,7 +87,9 @@ bool ReportDataTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a ReportDataType to a JSON representation */
-bool ReportDataTypeConverter::toJson(const ReportDataType& data, rapidjson::Document& json)
+bool ReportDataTypeConverter::toJson(const ReportDataType&               data,
+                                     rapidjson::Value&                   json,
+                                     rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -92,47 +97,42 @@ bool ReportDataTypeConverter::toJson(const ReportDataType& data, rapidjson::Docu
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // component
     ComponentTypeConverter component_converter;
-    component_converter.setAllocator(allocator);
-    rapidjson::Document component_doc(rapidjson::kObjectType);
-    ret = ret && component_converter.toJson(data.component, component_doc);
-    json.AddMember(rapidjson::StringRef("component"), component_doc.Move(), *allocator);
+    rapidjson::Value       component_doc(rapidjson::kObjectType);
+    ret = ret && component_converter.toJson(data.component, component_doc, allocator);
+    json.AddMember(rapidjson::StringRef("component"), component_doc.Move(), allocator);
 
     // variable
     VariableTypeConverter variable_converter;
-    variable_converter.setAllocator(allocator);
-    rapidjson::Document variable_doc(rapidjson::kObjectType);
-    ret = ret && variable_converter.toJson(data.variable, variable_doc);
-    json.AddMember(rapidjson::StringRef("variable"), variable_doc.Move(), *allocator);
+    rapidjson::Value      variable_doc(rapidjson::kObjectType);
+    ret = ret && variable_converter.toJson(data.variable, variable_doc, allocator);
+    json.AddMember(rapidjson::StringRef("variable"), variable_doc.Move(), allocator);
 
     // variableAttribute
 
     rapidjson::Value               variableAttribute_json(rapidjson::kArrayType);
     VariableAttributeTypeConverter variableAttribute_converter;
-    variableAttribute_converter.setAllocator(allocator);
     for (const VariableAttributeType& item : data.variableAttribute)
     {
-        rapidjson::Document item_doc(rapidjson::kObjectType);
-        ret = ret && variableAttribute_converter.toJson(item, item_doc);
-        variableAttribute_json.PushBack(item_doc.Move(), *allocator);
+        rapidjson::Value item_doc(rapidjson::kObjectType);
+        ret = ret && variableAttribute_converter.toJson(item, item_doc, allocator);
+        variableAttribute_json.PushBack(item_doc.Move(), allocator);
     }
-    json.AddMember(rapidjson::StringRef("variableAttribute"), variableAttribute_json.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("variableAttribute"), variableAttribute_json.Move(), allocator);
 
     // variableCharacteristics
     if (data.variableCharacteristics.isSet())
     {
         VariableCharacteristicsTypeConverter variableCharacteristics_converter;
-        variableCharacteristics_converter.setAllocator(allocator);
-        rapidjson::Document variableCharacteristics_doc(rapidjson::kObjectType);
-        ret = ret && variableCharacteristics_converter.toJson(data.variableCharacteristics, variableCharacteristics_doc);
-        json.AddMember(rapidjson::StringRef("variableCharacteristics"), variableCharacteristics_doc.Move(), *allocator);
+        rapidjson::Value                     variableCharacteristics_doc(rapidjson::kObjectType);
+        ret = ret && variableCharacteristics_converter.toJson(data.variableCharacteristics, variableCharacteristics_doc, allocator);
+        json.AddMember(rapidjson::StringRef("variableCharacteristics"), variableCharacteristics_doc.Move(), allocator);
     }
 
     return ret;
@@ -61,17 +61,14 @@ struct ReportDataType
 class ReportDataTypeConverter : public ocpp::messages::IMessageConverter<ReportDataType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<ReportDataType>* clone() const override { return new ReportDataTypeConverter(); }
-
     /** @brief Convert a ReportDataType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   ReportDataType&               data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a ReportDataType to a JSON representation */
-    bool toJson(const ReportDataType& data, rapidjson::Document& json) override;
+    bool toJson(const ReportDataType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,34 +36,36 @@ namespace ocpp20
 bool SalesTariffEntryTypeConverter::fromJson(const rapidjson::Value&       json,
                                              SalesTariffEntryType&         data,
                                              std::string&                  error_code,
-                                             [[maybe_unused]] std::string& error_message)
+                                             [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // relativeTimeInterval
     RelativeTimeIntervalTypeConverter relativeTimeInterval_converter;
-    ret =
-        ret && relativeTimeInterval_converter.fromJson(json["relativeTimeInterval"], data.relativeTimeInterval, error_code, error_message);
+    ret = ret &&
+          extract(json, "relativeTimeInterval", data.relativeTimeInterval, relativeTimeInterval_converter, error_code, error_message);
 
     // ePriceLevel
-    extract(json, "ePriceLevel", data.ePriceLevel);
+    ret = ret && extract(json, "ePriceLevel", data.ePriceLevel, 0, std::numeric_limits<int>::max(), error_message);
 
     // consumptionCost
-    if (json.HasMember("consumptionCost"))
+    ret = ret && checkArray(json, "consumptionCost", false, 1u, 3u, error_message);
+    if (ret && json.HasMember("consumptionCost"))
     {
         const rapidjson::Value&      consumptionCost_json = json["consumptionCost"];
         ConsumptionCostTypeConverter consumptionCost_converter;
         for (auto it = consumptionCost_json.Begin(); ret && (it != consumptionCost_json.End()); ++it)
         {
-            ConsumptionCostType& item = data.consumptionCost.emplace_back();
-            ret                       = ret && consumptionCost_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it,
+                          "consumptionCost",
+                          data.consumptionCost.emplace_back(),
+                          consumptionCost_converter,
+                          error_code,
+                          error_message);
         }
     }
 
@@ -76,7 +78,9 @@ bool SalesTariffEntryTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a SalesTariffEntryType to a JSON representation */
-bool SalesTariffEntryTypeConverter::toJson(const SalesTariffEntryType& data, rapidjson::Document& json)
+bool SalesTariffEntryTypeConverter::toJson(const SalesTariffEntryType&         data,
+                                           rapidjson::Value&                   json,
+                                           rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -84,21 +88,19 @@ bool SalesTariffEntryTypeConverter::toJson(const SalesTariffEntryType& data, rap
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // relativeTimeInterval
     RelativeTimeIntervalTypeConverter relativeTimeInterval_converter;
-    relativeTimeInterval_converter.setAllocator(allocator);
-    rapidjson::Document relativeTimeInterval_doc(rapidjson::kObjectType);
-    ret = ret && relativeTimeInterval_converter.toJson(data.relativeTimeInterval, relativeTimeInterval_doc);
-    json.AddMember(rapidjson::StringRef("relativeTimeInterval"), relativeTimeInterval_doc.Move(), *allocator);
+    rapidjson::Value                  relativeTimeInterval_doc(rapidjson::kObjectType);
+    ret = ret && relativeTimeInterval_converter.toJson(data.relativeTimeInterval, relativeTimeInterval_doc, allocator);
+    json.AddMember(rapidjson::StringRef("relativeTimeInterval"), relativeTimeInterval_doc.Move(), allocator);
 
     // ePriceLevel
-    fill(json, "ePriceLevel", data.ePriceLevel);
+    fill(json, "ePriceLevel", data.ePriceLevel, allocator);
 
     // consumptionCost
     if (!data.consumptionCost.empty())
@@ -106,14 +108,13 @@ bool SalesTariffEntryTypeConverter::toJson(const SalesTariffEntryType& data, rap
 
         rapidjson::Value             consumptionCost_json(rapidjson::kArrayType);
         ConsumptionCostTypeConverter consumptionCost_converter;
-        consumptionCost_converter.setAllocator(allocator);
         for (const ConsumptionCostType& item : data.consumptionCost)
         {
-            rapidjson::Document item_doc(rapidjson::kObjectType);
-            ret = ret && consumptionCost_converter.toJson(item, item_doc);
-            consumptionCost_json.PushBack(item_doc.Move(), *allocator);
+            rapidjson::Value item_doc(rapidjson::kObjectType);
+            ret = ret && consumptionCost_converter.toJson(item, item_doc, allocator);
+            consumptionCost_json.PushBack(item_doc.Move(), allocator);
         }
-        json.AddMember(rapidjson::StringRef("consumptionCost"), consumptionCost_json.Move(), *allocator);
+        json.AddMember(rapidjson::StringRef("consumptionCost"), consumptionCost_json.Move(), allocator);
     }
 
     return ret;
@@ -60,17 +60,14 @@ Defines the price level of this SalesTariffEntry (referring to NumEPriceLevels).
 class SalesTariffEntryTypeConverter : public ocpp::messages::IMessageConverter<SalesTariffEntryType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<SalesTariffEntryType>* clone() const override { return new SalesTariffEntryTypeConverter(); }
-
     /** @brief Convert a SalesTariffEntryType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   SalesTariffEntryType&         data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a SalesTariffEntryType to a JSON representation */
-    bool toJson(const SalesTariffEntryType& data, rapidjson::Document& json) override;
+    bool toJson(const SalesTariffEntryType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,35 +36,37 @@ namespace ocpp20
 bool SalesTariffTypeConverter::fromJson(const rapidjson::Value&       json,
                                         SalesTariffType&              data,
                                         std::string&                  error_code,
-                                        [[maybe_unused]] std::string& error_message)
+                                        [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // id
-    extract(json, "id", data.id);
+    ret = ret && extract(json, "id", data.id, error_message);
 
     // salesTariffDescription
-    extract(json, "salesTariffDescription", data.salesTariffDescription);
+    ret = ret && extract(json, "salesTariffDescription", data.salesTariffDescription, error_message);
 
     // numEPriceLevels
-    extract(json, "numEPriceLevels", data.numEPriceLevels);
+    ret = ret && extract(json, "numEPriceLevels", data.numEPriceLevels, error_message);
 
     // salesTariffEntry
-    if (json.HasMember("salesTariffEntry"))
+    ret = ret && checkArray(json, "salesTariffEntry", true, 1u, 1024u, error_message);
+    if (ret && json.HasMember("salesTariffEntry"))
     {
         const rapidjson::Value&       salesTariffEntry_json = json["salesTariffEntry"];
         SalesTariffEntryTypeConverter salesTariffEntry_converter;
         for (auto it = salesTariffEntry_json.Begin(); ret && (it != salesTariffEntry_json.End()); ++it)
         {
-            SalesTariffEntryType& item = data.salesTariffEntry.emplace_back();
-            ret                        = ret && salesTariffEntry_converter.fromJson(*it, item, error_code, error_message);
+            ret = convert(*it,
+                          "salesTariffEntry",
+                          data.salesTariffEntry.emplace_back(),
+                          salesTariffEntry_converter,
+                          error_code,
+                          error_message);
         }
     }
 
@@ -77,7 +79,9 @@ bool SalesTariffTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a SalesTariffType to a JSON representation */
-bool SalesTariffTypeConverter::toJson(const SalesTariffType& data, rapidjson::Document& json)
+bool SalesTariffTypeConverter::toJson(const SalesTariffType&              data,
+                                      rapidjson::Value&                   json,
+                                      rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -85,33 +89,31 @@ bool SalesTariffTypeConverter::toJson(const SalesTariffType& data, rapidjson::Do
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // id
-    fill(json, "id", data.id);
+    fill(json, "id", data.id, allocator);
 
     // salesTariffDescription
-    fill(json, "salesTariffDescription", data.salesTariffDescription);
+    fill(json, "salesTariffDescription", data.salesTariffDescription, allocator);
 
     // numEPriceLevels
-    fill(json, "numEPriceLevels", data.numEPriceLevels);
+    fill(json, "numEPriceLevels", data.numEPriceLevels, allocator);
 
     // salesTariffEntry
 
     rapidjson::Value              salesTariffEntry_json(rapidjson::kArrayType);
     SalesTariffEntryTypeConverter salesTariffEntry_converter;
-    salesTariffEntry_converter.setAllocator(allocator);
     for (const SalesTariffEntryType& item : data.salesTariffEntry)
     {
-        rapidjson::Document item_doc(rapidjson::kObjectType);
-        ret = ret && salesTariffEntry_converter.toJson(item, item_doc);
-        salesTariffEntry_json.PushBack(item_doc.Move(), *allocator);
+        rapidjson::Value item_doc(rapidjson::kObjectType);
+        ret = ret && salesTariffEntry_converter.toJson(item, item_doc, allocator);
+        salesTariffEntry_json.PushBack(item_doc.Move(), allocator);
     }
-    json.AddMember(rapidjson::StringRef("salesTariffEntry"), salesTariffEntry_json.Move(), *allocator);
+    json.AddMember(rapidjson::StringRef("salesTariffEntry"), salesTariffEntry_json.Move(), allocator);
 
     return ret;
 }
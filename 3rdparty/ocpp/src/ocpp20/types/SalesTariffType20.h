@@ -67,17 +67,14 @@ Defines the overall number of distinct price levels used across all provided Sal
 class SalesTariffTypeConverter : public ocpp::messages::IMessageConverter<SalesTariffType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<SalesTariffType>* clone() const override { return new SalesTariffTypeConverter(); }
-
     /** @brief Convert a SalesTariffType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   SalesTariffType&              data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a SalesTariffType to a JSON representation */
-    bool toJson(const SalesTariffType& data, rapidjson::Document& json) override;
+    bool toJson(const SalesTariffType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
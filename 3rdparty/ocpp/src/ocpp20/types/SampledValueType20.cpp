@@ -36,57 +36,99 @@ namespace ocpp20
 bool SampledValueTypeConverter::fromJson(const rapidjson::Value&       json,
                                          SampledValueType&             data,
                                          std::string&                  error_code,
-                                         [[maybe_unused]] std::string& error_message)
+                                         [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // value
-    extract(json, "value", data.value);
+    ret = ret && extract(json, "value", data.value, error_message);
 
     // context
-    if (json.HasMember("context"))
-    {
-        data.context = ReadingContextEnumTypeHelper.fromString(json["context"].GetString());
-    }
+    ret = ret && extract(json, "context", data.context, ReadingContextEnumTypeHelper, error_message);
 
     // measurand
-    if (json.HasMember("measurand"))
-    {
-        data.measurand = MeasurandEnumTypeHelper.fromString(json["measurand"].GetString());
-    }
+    ret = ret && extract(json, "measurand", data.measurand, MeasurandEnumTypeHelper, error_message);
 
     // phase
-    if (json.HasMember("phase"))
-    {
-        data.phase = PhaseEnumTypeHelper.fromString(json["phase"].GetString());
-    }
+    ret = ret && extract(json, "phase", data.phase, PhaseEnumTypeHelper, error_message);
 
     // location
-    if (json.HasMember("location"))
-    {
-        data.location = LocationEnumTypeHelper.fromString(json["location"].GetString());
-    }
+    ret = ret && extract(json, "location", data.location, LocationEnumTypeHelper, error_message);
 
     // signedMeterValue
-    if (json.HasMember("signedMeterValue"))
+    SignedMeterValueTypeConverter signedMeterValue_converter;
+    ret = ret && extract(json, "signedMeterValue", data.signedMeterValue, signedMeterValue_converter, error_code, error_message);
+
+    // unitOfMeasure
+    UnitOfMeasureTypeConverter unitOfMeasure_converter;
+    ret = ret && extract(json, "unitOfMeasure", data.unitOfMeasure, unitOfMeasure_converter, error_code, error_message);
+
+    if (!ret)
     {
-        SignedMeterValueTypeConverter signedMeterValue_converter;
-        ret = ret && signedMeterValue_converter.fromJson(json["signedMeterValue"], data.signedMeterValue, error_code, error_message);
+        error_code = ocpp::rpc::IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
     }
 
-    // unitOfMeasure
-    if (json.HasMember("unitOfMeasure"))
+    return ret;
+}
+
+/** @brief Convert a SampledValueType from a JSON stream */
+bool SampledValueTypeConverter::fromJson(ocpp::json::JsonReader&       reader,
+                                         SampledValueType&             data,
+                                         std::string&                  error_code,
+                                         [[maybe_unused]] std::string& error_message) const
+{
+    bool ret         = true;
+    bool value_found = false;
+
+    while (ret && reader.nextMember())
     {
-        UnitOfMeasureTypeConverter unitOfMeasure_converter;
-        ret = ret && unitOfMeasure_converter.fromJson(json["unitOfMeasure"], data.unitOfMeasure, error_code, error_message);
+        if (reader.isMember("customData"))
+        {
+            CustomDataTypeConverter customData_converter;
+            ret = convert(reader, "customData", data.customData.value(), customData_converter, error_code, error_message);
+        }
+        else if (reader.isMember("value"))
+        {
+            ret         = convert(reader, "value", data.value, error_message);
+            value_found = true;
+        }
+        else if (reader.isMember("context"))
+        {
+            ret = convert(reader, "context", data.context.value(), ReadingContextEnumTypeHelper, error_message);
+        }
+        else if (reader.isMember("measurand"))
+        {
+            ret = convert(reader, "measurand", data.measurand.value(), MeasurandEnumTypeHelper, error_message);
+        }
+        else if (reader.isMember("phase"))
+        {
+            ret = convert(reader, "phase", data.phase.value(), PhaseEnumTypeHelper, error_message);
+        }
+        else if (reader.isMember("location"))
+        {
+            ret = convert(reader, "location", data.location.value(), LocationEnumTypeHelper, error_message);
+        }
+        else if (reader.isMember("signedMeterValue"))
+        {
+            SignedMeterValueTypeConverter signedMeterValue_converter;
+            ret = convert(reader, "signedMeterValue", data.signedMeterValue.value(), signedMeterValue_converter, error_code, error_message);
+        }
+        else if (reader.isMember("unitOfMeasure"))
+        {
+            UnitOfMeasureTypeConverter unitOfMeasure_converter;
+            ret = convert(reader, "unitOfMeasure", data.unitOfMeasure.value(), unitOfMeasure_converter, error_code, error_message);
+        }
+        else
+        {
+            ret = reader.skip();
+        }
     }
+    ret = ret && !reader.hasError();
+    ret = ret && checkRequired("value", value_found, error_message);
 
     if (!ret)
     {
@@ -97,7 +139,9 @@ bool SampledValueTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a SampledValueType to a JSON representation */
-bool SampledValueTypeConverter::toJson(const SampledValueType& data, rapidjson::Document& json)
+bool SampledValueTypeConverter::toJson(const SampledValueType&             data,
+                                       rapidjson::Value&                   json,
+                                       rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -105,57 +149,54 @@ bool SampledValueTypeConverter::toJson(const SampledValueType& data, rapidjson::
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // value
-    fill(json, "value", data.value);
+    fill(json, "value", data.value, allocator);
 
     // context
     if (data.context.isSet())
     {
-        fill(json, "context", ReadingContextEnumTypeHelper.toString(data.context));
+        fill(json, "context", ReadingContextEnumTypeHelper.toString(data.context), allocator);
     }
 
     // measurand
     if (data.measurand.isSet())
     {
-        fill(json, "measurand", MeasurandEnumTypeHelper.toString(data.measurand));
+        fill(json, "measurand", MeasurandEnumTypeHelper.toString(data.measurand), allocator);
     }
 
     // phase
     if (data.phase.isSet())
     {
-        fill(json, "phase", PhaseEnumTypeHelper.toString(data.phase));
+        fill(json, "phase", PhaseEnumTypeHelper.toString(data.phase), allocator);
     }
 
     // location
     if (data.location.isSet())
     {
-        fill(json, "location", LocationEnumTypeHelper.toString(data.location));
+        fill(json, "location", LocationEnumTypeHelper.toString(data.location), allocator);
     }
 
     // signedMeterValue
     if (data.signedMeterValue.isSet())
     {
         SignedMeterValueTypeConverter signedMeterValue_converter;
-        signedMeterValue_converter.setAllocator(allocator);
-        rapidjson::Document signedMeterValue_doc(rapidjson::kObjectType);
-        ret = ret && signedMeterValue_converter.toJson(data.signedMeterValue, signedMeterValue_doc);
-        json.AddMember(rapidjson::StringRef("signedMeterValue"), signedMeterValue_doc.Move(), *allocator);
+        rapidjson::Value              signedMeterValue_doc(rapidjson::kObjectType);
+        ret = ret && signedMeterValue_converter.toJson(data.signedMeterValue, signedMeterValue_doc, allocator);
+        json.AddMember(rapidjson::StringRef("signedMeterValue"), signedMeterValue_doc.Move(), allocator);
     }
 
     // unitOfMeasure
     if (data.unitOfMeasure.isSet())
     {
         UnitOfMeasureTypeConverter unitOfMeasure_converter;
-        unitOfMeasure_converter.setAllocator(allocator);
-        rapidjson::Document unitOfMeasure_doc(rapidjson::kObjectType);
-        ret = ret && unitOfMeasure_converter.toJson(data.unitOfMeasure, unitOfMeasure_doc);
-        json.AddMember(rapidjson::StringRef("unitOfMeasure"), unitOfMeasure_doc.Move(), *allocator);
+        rapidjson::Value           unitOfMeasure_doc(rapidjson::kObjectType);
+        ret = ret && unitOfMeasure_converter.toJson(data.unitOfMeasure, unitOfMeasure_doc, allocator);
+        json.AddMember(rapidjson::StringRef("unitOfMeasure"), unitOfMeasure_doc.Move(), allocator);
     }
 
     return ret;
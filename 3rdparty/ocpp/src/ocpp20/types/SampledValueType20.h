@@ -74,17 +74,20 @@ Indicates the measured value. */
 class SampledValueTypeConverter : public ocpp::messages::IMessageConverter<SampledValueType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<SampledValueType>* clone() const override { return new SampledValueTypeConverter(); }
-
     /** @brief Convert a SampledValueType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   SampledValueType&             data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
+
+    /** @brief Convert a SampledValueType from a JSON stream */
+    bool fromJson(ocpp::json::JsonReader&       reader,
+                  SampledValueType&             data,
+                  std::string&                  error_code,
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a SampledValueType to a JSON representation */
-    bool toJson(const SampledValueType& data, rapidjson::Document& json) override;
+    bool toJson(const SampledValueType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,39 +36,36 @@ namespace ocpp20
 bool SetMonitoringDataTypeConverter::fromJson(const rapidjson::Value&       json,
                                               SetMonitoringDataType&        data,
                                               std::string&                  error_code,
-                                              [[maybe_unused]] std::string& error_message)
+                                              [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // id
-    extract(json, "id", data.id);
+    ret = ret && extract(json, "id", data.id, error_message);
 
     // transaction
-    extract(json, "transaction", data.transaction);
+    ret = ret && extract(json, "transaction", data.transaction, error_message);
 
     // value
-    extract(json, "value", data.value);
+    ret = ret && extract(json, "value", data.value, error_message);
 
     // type
-    data.type = MonitorEnumTypeHelper.fromString(json["type"].GetString());
+    ret = ret && extract(json, "type", data.type, MonitorEnumTypeHelper, error_message);
 
     // severity
-    extract(json, "severity", data.severity);
+    ret = ret && extract(json, "severity", data.severity, error_message);
 
     // component
     ComponentTypeConverter component_converter;
-    ret = ret && component_converter.fromJson(json["component"], data.component, error_code, error_message);
+    ret = ret && extract(json, "component", data.component, component_converter, error_code, error_message);
 
     // variable
     VariableTypeConverter variable_converter;
-    ret = ret && variable_converter.fromJson(json["variable"], data.variable, error_code, error_message);
+    ret = ret && extract(json, "variable", data.variable, variable_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -79,7 +76,9 @@ bool SetMonitoringDataTypeConverter::fromJson(const rapidjson::Value&       json
 }
 
 /** @brief Convert a SetMonitoringDataType to a JSON representation */
-bool SetMonitoringDataTypeConverter::toJson(const SetMonitoringDataType& data, rapidjson::Document& json)
+bool SetMonitoringDataTypeConverter::toJson(const SetMonitoringDataType&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -87,40 +86,37 @@ bool SetMonitoringDataTypeConverter::toJson(const SetMonitoringDataType& data, r
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // id
-    fill(json, "id", data.id);
+    fill(json, "id", data.id, allocator);
 
     // transaction
-    fill(json, "transaction", data.transaction);
+    fill(json, "transaction", data.transaction, allocator);
 
     // value
-    fill(json, "value", data.value);
+    fill(json, "value", data.value, allocator);
 
     // type
-    fill(json, "type", MonitorEnumTypeHelper.toString(data.type));
+    fill(json, "type", MonitorEnumTypeHelper.toString(data.type), allocator);
 
     // severity
-    fill(json, "severity", data.severity);
+    fill(json, "severity", data.severity, allocator);
 
     // component
     ComponentTypeConverter component_converter;
-    component_converter.setAllocator(allocator);
-    rapidjson::Document component_doc(rapidjson::kObjectType);
-    ret = ret && component_converter.toJson(data.component, component_doc);
-    json.AddMember(rapidjson::StringRef("component"), component_doc.Move(), *allocator);
+    rapidjson::Value       component_doc(rapidjson::kObjectType);
+    ret = ret && component_converter.toJson(data.component, component_doc, allocator);
+    json.AddMember(rapidjson::StringRef("component"), component_doc.Move(), allocator);
 
     // variable
     VariableTypeConverter variable_converter;
-    variable_converter.setAllocator(allocator);
-    rapidjson::Document variable_doc(rapidjson::kObjectType);
-    ret = ret && variable_converter.toJson(data.variable, variable_doc);
-    json.AddMember(rapidjson::StringRef("variable"), variable_doc.Move(), *allocator);
+    rapidjson::Value      variable_doc(rapidjson::kObjectType);
+    ret = ret && variable_converter.toJson(data.variable, variable_doc, allocator);
+    json.AddMember(rapidjson::StringRef("variable"), variable_doc.Move(), allocator);
 
     return ret;
 }
@@ -88,17 +88,14 @@ Indicates information useful to developers for debugging, not useful during oper
 class SetMonitoringDataTypeConverter : public ocpp::messages::IMessageConverter<SetMonitoringDataType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<SetMonitoringDataType>* clone() const override { return new SetMonitoringDataTypeConverter(); }
-
     /** @brief Convert a SetMonitoringDataType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   SetMonitoringDataType&        data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a SetMonitoringDataType to a JSON representation */
-    bool toJson(const SetMonitoringDataType& data, rapidjson::Document& json) override;
+    bool toJson(const SetMonitoringDataType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
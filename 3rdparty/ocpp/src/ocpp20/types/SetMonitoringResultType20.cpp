@@ -36,43 +36,37 @@ namespace ocpp20
 bool SetMonitoringResultTypeConverter::fromJson(const rapidjson::Value&       json,
                                                 SetMonitoringResultType&      data,
                                                 std::string&                  error_code,
-                                                [[maybe_unused]] std::string& error_message)
+                                                [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // id
-    extract(json, "id", data.id);
+    ret = ret && extract(json, "id", data.id, error_message);
 
     // statusInfo
-    if (json.HasMember("statusInfo"))
-    {
-        StatusInfoTypeConverter statusInfo_converter;
-        ret = ret && statusInfo_converter.fromJson(json["statusInfo"], data.statusInfo, error_code, error_message);
-    }
+    StatusInfoTypeConverter statusInfo_converter;
+    ret = ret && extract(json, "statusInfo", data.statusInfo, statusInfo_converter, error_code, error_message);
 
     // status
-    data.status = SetMonitoringStatusEnumTypeHelper.fromString(json["status"].GetString());
+    ret = ret && extract(json, "status", data.status, SetMonitoringStatusEnumTypeHelper, error_message);
 
     // type
-    data.type = MonitorEnumTypeHelper.fromString(json["type"].GetString());
+    ret = ret && extract(json, "type", data.type, MonitorEnumTypeHelper, error_message);
 
     // component
     ComponentTypeConverter component_converter;
-    ret = ret && component_converter.fromJson(json["component"], data.component, error_code, error_message);
+    ret = ret && extract(json, "component", data.component, component_converter, error_code, error_message);
 
     // variable
     VariableTypeConverter variable_converter;
-    ret = ret && variable_converter.fromJson(json["variable"], data.variable, error_code, error_message);
+    ret = ret && extract(json, "variable", data.variable, variable_converter, error_code, error_message);
 
     // severity
-    extract(json, "severity", data.severity);
+    ret = ret && extract(json, "severity", data.severity, error_message);
 
     if (!ret)
     {
@@ -83,7 +77,9 @@ bool SetMonitoringResultTypeConverter::fromJson(const rapidjson::Value&       js
 }
 
 /** @brief Convert a SetMonitoringResultType to a JSON representation */
-bool SetMonitoringResultTypeConverter::toJson(const SetMonitoringResultType& data, rapidjson::Document& json)
+bool SetMonitoringResultTypeConverter::toJson(const SetMonitoringResultType&      data,
+                                              rapidjson::Value&                   json,
+                                              rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -91,47 +87,43 @@ bool SetMonitoringResultTypeConverter::toJson(const SetMonitoringResultType& dat
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // id
-    fill(json, "id", data.id);
+    fill(json, "id", data.id, allocator);
 
     // statusInfo
     if (data.statusInfo.isSet())
     {
         StatusInfoTypeConverter statusInfo_converter;
-        statusInfo_converter.setAllocator(allocator);
-        rapidjson::Document statusInfo_doc(rapidjson::kObjectType);
-        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc);
-        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), *allocator);
+        rapidjson::Value        statusInfo_doc(rapidjson::kObjectType);
+        ret = ret && statusInfo_converter.toJson(data.statusInfo, statusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("statusInfo"), statusInfo_doc.Move(), allocator);
     }
 
     // status
-    fill(json, "status", SetMonitoringStatusEnumTypeHelper.toString(data.status));
+    fill(json, "status", SetMonitoringStatusEnumTypeHelper.toString(data.status), allocator);
 
     // type
-    fill(json, "type", MonitorEnumTypeHelper.toString(data.type));
+    fill(json, "type", MonitorEnumTypeHelper.toString(data.type), allocator);
 
     // component
     ComponentTypeConverter component_converter;
-    component_converter.setAllocator(allocator);
-    rapidjson::Document component_doc(rapidjson::kObjectType);
-    ret = ret && component_converter.toJson(data.component, component_doc);
-    json.AddMember(rapidjson::StringRef("component"), component_doc.Move(), *allocator);
+    rapidjson::Value       component_doc(rapidjson::kObjectType);
+    ret = ret && component_converter.toJson(data.component, component_doc, allocator);
+    json.AddMember(rapidjson::StringRef("component"), component_doc.Move(), allocator);
 
     // variable
     VariableTypeConverter variable_converter;
-    variable_converter.setAllocator(allocator);
-    rapidjson::Document variable_doc(rapidjson::kObjectType);
-    ret = ret && variable_converter.toJson(data.variable, variable_doc);
-    json.AddMember(rapidjson::StringRef("variable"), variable_doc.Move(), *allocator);
+    rapidjson::Value      variable_doc(rapidjson::kObjectType);
+    ret = ret && variable_converter.toJson(data.variable, variable_doc, allocator);
+    json.AddMember(rapidjson::StringRef("variable"), variable_doc.Move(), allocator);
 
     // severity
-    fill(json, "severity", data.severity);
+    fill(json, "severity", data.severity, allocator);
 
     return ret;
 }
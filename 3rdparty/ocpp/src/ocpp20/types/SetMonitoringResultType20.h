@@ -89,17 +89,14 @@ Indicates information useful to developers for debugging, not useful during oper
 class SetMonitoringResultTypeConverter : public ocpp::messages::IMessageConverter<SetMonitoringResultType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<SetMonitoringResultType>* clone() const override { return new SetMonitoringResultTypeConverter(); }
-
     /** @brief Convert a SetMonitoringResultType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   SetMonitoringResultType&      data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a SetMonitoringResultType to a JSON representation */
-    bool toJson(const SetMonitoringResultType& data, rapidjson::Document& json) override;
+    bool toJson(const SetMonitoringResultType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
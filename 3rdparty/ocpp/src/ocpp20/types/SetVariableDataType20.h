@@ -61,17 +61,14 @@ The Configuration Variable &lt;&lt;configkey-configuration-value-size,Configurat
 class SetVariableDataTypeConverter : public ocpp::messages::IMessageConverter<SetVariableDataType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<SetVariableDataType>* clone() const override { return new SetVariableDataTypeConverter(); }
-
     /** @brief Convert a SetVariableDataType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   SetVariableDataType&          data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a SetVariableDataType to a JSON representation */
-    bool toJson(const SetVariableDataType& data, rapidjson::Document& json) override;
+    bool toJson(const SetVariableDataType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,41 +36,31 @@ namespace ocpp20
 bool SetVariableResultTypeConverter::fromJson(const rapidjson::Value&       json,
                                               SetVariableResultType&        data,
                                               std::string&                  error_code,
-                                              [[maybe_unused]] std::string& error_message)
+                                              [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // attributeType
-    if (json.HasMember("attributeType"))
-    {
-        data.attributeType = AttributeEnumTypeHelper.fromString(json["attributeType"].GetString());
-    }
+    ret = ret && extract(json, "attributeType", data.attributeType, AttributeEnumTypeHelper, error_message);
 
     // attributeStatus
-    data.attributeStatus = SetVariableStatusEnumTypeHelper.fromString(json["attributeStatus"].GetString());
+    ret = ret && extract(json, "attributeStatus", data.attributeStatus, SetVariableStatusEnumTypeHelper, error_message);
 
     // attributeStatusInfo
-    if (json.HasMember("attributeStatusInfo"))
-    {
-        StatusInfoTypeConverter attributeStatusInfo_converter;
-        ret =
-            ret && attributeStatusInfo_converter.fromJson(json["attributeStatusInfo"], data.attributeStatusInfo, error_code, error_message);
-    }
+    StatusInfoTypeConverter attributeStatusInfo_converter;
+    ret = ret && extract(json, "attributeStatusInfo", data.attributeStatusInfo, attributeStatusInfo_converter, error_code, error_message);
 
     // component
     ComponentTypeConverter component_converter;
-    ret = ret && component_converter.fromJson(json["component"], data.component, error_code, error_message);
+    ret = ret && extract(json, "component", data.component, component_converter, error_code, error_message);
 
     // variable
     VariableTypeConverter variable_converter;
-    ret = ret && variable_converter.fromJson(json["variable"], data.variable, error_code, error_message);
+    ret = ret && extract(json, "variable", data.variable, variable_converter, error_code, error_message);
 
     if (!ret)
     {
@@ -81,7 +71,9 @@ bool SetVariableResultTypeConverter::fromJson(const rapidjson::Value&       json
 }
 
 /** @brief Convert a SetVariableResultType to a JSON representation */
-bool SetVariableResultTypeConverter::toJson(const SetVariableResultType& data, rapidjson::Document& json)
+bool SetVariableResultTypeConverter::toJson(const SetVariableResultType&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -89,44 +81,40 @@ bool SetVariableResultTypeConverter::toJson(const SetVariableResultType& data, r
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // attributeType
     if (data.attributeType.isSet())
     {
-        fill(json, "attributeType", AttributeEnumTypeHelper.toString(data.attributeType));
+        fill(json, "attributeType", AttributeEnumTypeHelper.toString(data.attributeType), allocator);
     }
 
     // attributeStatus
-    fill(json, "attributeStatus", SetVariableStatusEnumTypeHelper.toString(data.attributeStatus));
+    fill(json, "attributeStatus", SetVariableStatusEnumTypeHelper.toString(data.attributeStatus), allocator);
 
     // attributeStatusInfo
     if (data.attributeStatusInfo.isSet())
     {
         StatusInfoTypeConverter attributeStatusInfo_converter;
-        attributeStatusInfo_converter.setAllocator(allocator);
-        rapidjson::Document attributeStatusInfo_doc(rapidjson::kObjectType);
-        ret = ret && attributeStatusInfo_converter.toJson(data.attributeStatusInfo, attributeStatusInfo_doc);
-        json.AddMember(rapidjson::StringRef("attributeStatusInfo"), attributeStatusInfo_doc.Move(), *allocator);
+        rapidjson::Value        attributeStatusInfo_doc(rapidjson::kObjectType);
+        ret = ret && attributeStatusInfo_converter.toJson(data.attributeStatusInfo, attributeStatusInfo_doc, allocator);
+        json.AddMember(rapidjson::StringRef("attributeStatusInfo"), attributeStatusInfo_doc.Move(), allocator);
     }
 
     // component
     ComponentTypeConverter component_converter;
-    component_converter.setAllocator(allocator);
-    rapidjson::Document component_doc(rapidjson::kObjectType);
-    ret = ret && component_converter.toJson(data.component, component_doc);
-    json.AddMember(rapidjson::StringRef("component"), component_doc.Move(), *allocator);
+    rapidjson::Value       component_doc(rapidjson::kObjectType);
+    ret = ret && component_converter.toJson(data.component, component_doc, allocator);
+    json.AddMember(rapidjson::StringRef("component"), component_doc.Move(), allocator);
 
     // variable
     VariableTypeConverter variable_converter;
-    variable_converter.setAllocator(allocator);
-    rapidjson::Document variable_doc(rapidjson::kObjectType);
-    ret = ret && variable_converter.toJson(data.variable, variable_doc);
-    json.AddMember(rapidjson::StringRef("variable"), variable_doc.Move(), *allocator);
+    rapidjson::Value      variable_doc(rapidjson::kObjectType);
+    ret = ret && variable_converter.toJson(data.variable, variable_doc, allocator);
+    json.AddMember(rapidjson::StringRef("variable"), variable_doc.Move(), allocator);
 
     return ret;
 }
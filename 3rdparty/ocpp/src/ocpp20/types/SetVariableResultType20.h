@@ -62,17 +62,14 @@ struct SetVariableResultType
 class SetVariableResultTypeConverter : public ocpp::messages::IMessageConverter<SetVariableResultType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<SetVariableResultType>* clone() const override { return new SetVariableResultTypeConverter(); }
-
     /** @brief Convert a SetVariableResultType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   SetVariableResultType&        data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a SetVariableResultType to a JSON representation */
-    bool toJson(const SetVariableResultType& data, rapidjson::Document& json) override;
+    bool toJson(const SetVariableResultType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
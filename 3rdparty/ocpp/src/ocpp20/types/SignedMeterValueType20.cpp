@@ -36,28 +36,83 @@ namespace ocpp20
 bool SignedMeterValueTypeConverter::fromJson(const rapidjson::Value&       json,
                                              SignedMeterValueType&         data,
                                              std::string&                  error_code,
-                                             [[maybe_unused]] std::string& error_message)
+                                             [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // signedMeterData
-    extract(json, "signedMeterData", data.signedMeterData);
+    ret = ret && extract(json, "signedMeterData", data.signedMeterData, error_message);
 
     // signingMethod
-    extract(json, "signingMethod", data.signingMethod);
+    ret = ret && extract(json, "signingMethod", data.signingMethod, error_message);
 
     // encodingMethod
-    extract(json, "encodingMethod", data.encodingMethod);
+    ret = ret && extract(json, "encodingMethod", data.encodingMethod, error_message);
 
     // publicKey
-    extract(json, "publicKey", data.publicKey);
+    ret = ret && extract(json, "publicKey", data.publicKey, error_message);
+
+    if (!ret)
+    {
+        error_code = ocpp::rpc::IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
+    }
+
+    return ret;
+}
+
+/** @brief Convert a SignedMeterValueType from a JSON stream */
+bool SignedMeterValueTypeConverter::fromJson(ocpp::json::JsonReader&       reader,
+                                             SignedMeterValueType&         data,
+                                             std::string&                  error_code,
+                                             [[maybe_unused]] std::string& error_message) const
+{
+    bool ret                   = true;
+    bool signedMeterData_found = false;
+    bool signingMethod_found   = false;
+    bool encodingMethod_found  = false;
+    bool publicKey_found       = false;
+
+    while (ret && reader.nextMember())
+    {
+        if (reader.isMember("customData"))
+        {
+            CustomDataTypeConverter customData_converter;
+            ret = convert(reader, "customData", data.customData.value(), customData_converter, error_code, error_message);
+        }
+        else if (reader.isMember("signedMeterData"))
+        {
+            ret                   = convert(reader, "signedMeterData", data.signedMeterData, error_message);
+            signedMeterData_found = true;
+        }
+        else if (reader.isMember("signingMethod"))
+        {
+            ret                 = convert(reader, "signingMethod", data.signingMethod, error_message);
+            signingMethod_found = true;
+        }
+        else if (reader.isMember("encodingMethod"))
+        {
+            ret                  = convert(reader, "encodingMethod", data.encodingMethod, error_message);
+            encodingMethod_found = true;
+        }
+        else if (reader.isMember("publicKey"))
+        {
+            ret             = convert(reader, "publicKey", data.publicKey, error_message);
+            publicKey_found = true;
+        }
+        else
+        {
+            ret = reader.skip();
+        }
+    }
+    ret = ret && !reader.hasError();
+    ret = ret && checkRequired("signedMeterData", signedMeterData_found, error_message);
+    ret = ret && checkRequired("signingMethod", signingMethod_found, error_message);
+    ret = ret && checkRequired("encodingMethod", encodingMethod_found, error_message);
+    ret = ret && checkRequired("publicKey", publicKey_found, error_message);
 
     if (!ret)
     {
@@ -68,7 +123,9 @@ bool SignedMeterValueTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a SignedMeterValueType to a JSON representation */
-bool SignedMeterValueTypeConverter::toJson(const SignedMeterValueType& data, rapidjson::Document& json)
+bool SignedMeterValueTypeConverter::toJson(const SignedMeterValueType&         data,
+                                           rapidjson::Value&                   json,
+                                           rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -76,23 +133,22 @@ bool SignedMeterValueTypeConverter::toJson(const SignedMeterValueType& data, rap
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // signedMeterData
-    fill(json, "signedMeterData", data.signedMeterData);
+    fill(json, "signedMeterData", data.signedMeterData, allocator);
 
     // signingMethod
-    fill(json, "signingMethod", data.signingMethod);
+    fill(json, "signingMethod", data.signingMethod, allocator);
 
     // encodingMethod
-    fill(json, "encodingMethod", data.encodingMethod);
+    fill(json, "encodingMethod", data.encodingMethod, allocator);
 
     // publicKey
-    fill(json, "publicKey", data.publicKey);
+    fill(json, "publicKey", data.publicKey, allocator);
 
     return ret;
 }
@@ -57,17 +57,20 @@ struct SignedMeterValueType
 class SignedMeterValueTypeConverter : public ocpp::messages::IMessageConverter<SignedMeterValueType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<SignedMeterValueType>* clone() const override { return new SignedMeterValueTypeConverter(); }
-
     /** @brief Convert a SignedMeterValueType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   SignedMeterValueType&         data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
+
+    /** @brief Convert a SignedMeterValueType from a JSON stream */
+    bool fromJson(ocpp::json::JsonReader&       reader,
+                  SignedMeterValueType&         data,
+                  std::string&                  error_code,
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a SignedMeterValueType to a JSON representation */
-    bool toJson(const SignedMeterValueType& data, rapidjson::Document& json) override;
+    bool toJson(const SignedMeterValueType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,22 +36,19 @@ namespace ocpp20
 bool StatusInfoTypeConverter::fromJson(const rapidjson::Value&       json,
                                        StatusInfoType&               data,
                                        std::string&                  error_code,
-                                       [[maybe_unused]] std::string& error_message)
+                                       [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // reasonCode
-    extract(json, "reasonCode", data.reasonCode);
+    ret = ret && extract(json, "reasonCode", data.reasonCode, error_message);
 
     // additionalInfo
-    extract(json, "additionalInfo", data.additionalInfo);
+    ret = ret && extract(json, "additionalInfo", data.additionalInfo, error_message);
 
     if (!ret)
     {
@@ -62,7 +59,9 @@ bool StatusInfoTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a StatusInfoType to a JSON representation */
-bool StatusInfoTypeConverter::toJson(const StatusInfoType& data, rapidjson::Document& json)
+bool StatusInfoTypeConverter::toJson(const StatusInfoType&               data,
+                                     rapidjson::Value&                   json,
+                                     rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -70,17 +69,16 @@ bool StatusInfoTypeConverter::toJson(const StatusInfoType& data, rapidjson::Docu
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // reasonCode
-    fill(json, "reasonCode", data.reasonCode);
+    fill(json, "reasonCode", data.reasonCode, allocator);
 
     // additionalInfo
-    fill(json, "additionalInfo", data.additionalInfo);
+    fill(json, "additionalInfo", data.additionalInfo, allocator);
 
     return ret;
 }
@@ -53,17 +53,14 @@ struct StatusInfoType
 class StatusInfoTypeConverter : public ocpp::messages::IMessageConverter<StatusInfoType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<StatusInfoType>* clone() const override { return new StatusInfoTypeConverter(); }
-
     /** @brief Convert a StatusInfoType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   StatusInfoType&               data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a StatusInfoType to a JSON representation */
-    bool toJson(const StatusInfoType& data, rapidjson::Document& json) override;
+    bool toJson(const StatusInfoType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,37 +36,81 @@ namespace ocpp20
 bool TransactionTypeConverter::fromJson(const rapidjson::Value&       json,
                                         TransactionType&              data,
                                         std::string&                  error_code,
-                                        [[maybe_unused]] std::string& error_message)
+                                        [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // transactionId
-    extract(json, "transactionId", data.transactionId);
+    ret = ret && extract(json, "transactionId", data.transactionId, error_message);
 
     // chargingState
-    if (json.HasMember("chargingState"))
-    {
-        data.chargingState = ChargingStateEnumTypeHelper.fromString(json["chargingState"].GetString());
-    }
+    ret = ret && extract(json, "chargingState", data.chargingState, ChargingStateEnumTypeHelper, error_message);
 
     // timeSpentCharging
-    extract(json, "timeSpentCharging", data.timeSpentCharging);
+    ret = ret && extract(json, "timeSpentCharging", data.timeSpentCharging, error_message);
 
     // stoppedReason
-    if (json.HasMember("stoppedReason"))
+    ret = ret && extract(json, "stoppedReason", data.stoppedReason, ReasonEnumTypeHelper, error_message);
+
+    // remoteStartId
+    ret = ret && extract(json, "remoteStartId", data.remoteStartId, error_message);
+
+    if (!ret)
     {
-        data.stoppedReason = ReasonEnumTypeHelper.fromString(json["stoppedReason"].GetString());
+        error_code = ocpp::rpc::IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
     }
 
-    // remoteStartId
-    extract(json, "remoteStartId", data.remoteStartId);
+    return ret;
+}
+
+/** @brief Convert a TransactionType from a JSON stream */
+bool TransactionTypeConverter::fromJson(ocpp::json::JsonReader&       reader,
+                                        TransactionType&              data,
+                                        std::string&                  error_code,
+                                        [[maybe_unused]] std::string& error_message) const
+{
+    bool ret                 = true;
+    bool transactionId_found = false;
+
+    while (ret && reader.nextMember())
+    {
+        if (reader.isMember("customData"))
+        {
+            CustomDataTypeConverter customData_converter;
+            ret = convert(reader, "customData", data.customData.value(), customData_converter, error_code, error_message);
+        }
+        else if (reader.isMember("transactionId"))
+        {
+            ret                 = convert(reader, "transactionId", data.transactionId, error_message);
+            transactionId_found = true;
+        }
+        else if (reader.isMember("chargingState"))
+        {
+            ret = convert(reader, "chargingState", data.chargingState.value(), ChargingStateEnumTypeHelper, error_message);
+        }
+        else if (reader.isMember("timeSpentCharging"))
+        {
+            ret = convert(reader, "timeSpentCharging", data.timeSpentCharging.value(), error_message);
+        }
+        else if (reader.isMember("stoppedReason"))
+        {
+            ret = convert(reader, "stoppedReason", data.stoppedReason.value(), ReasonEnumTypeHelper, error_message);
+        }
+        else if (reader.isMember("remoteStartId"))
+        {
+            ret = convert(reader, "remoteStartId", data.remoteStartId.value(), error_message);
+        }
+        else
+        {
+            ret = reader.skip();
+        }
+    }
+    ret = ret && !reader.hasError();
+    ret = ret && checkRequired("transactionId", transactionId_found, error_message);
 
     if (!ret)
     {
@@ -77,7 +121,9 @@ bool TransactionTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a TransactionType to a JSON representation */
-bool TransactionTypeConverter::toJson(const TransactionType& data, rapidjson::Document& json)
+bool TransactionTypeConverter::toJson(const TransactionType&              data,
+                                      rapidjson::Value&                   json,
+                                      rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -85,32 +131,31 @@ bool TransactionTypeConverter::toJson(const TransactionType& data, rapidjson::Do
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // transactionId
-    fill(json, "transactionId", data.transactionId);
+    fill(json, "transactionId", data.transactionId, allocator);
 
     // chargingState
     if (data.chargingState.isSet())
     {
-        fill(json, "chargingState", ChargingStateEnumTypeHelper.toString(data.chargingState));
+        fill(json, "chargingState", ChargingStateEnumTypeHelper.toString(data.chargingState), allocator);
     }
 
     // timeSpentCharging
-    fill(json, "timeSpentCharging", data.timeSpentCharging);
+    fill(json, "timeSpentCharging", data.timeSpentCharging, allocator);
 
     // stoppedReason
     if (data.stoppedReason.isSet())
     {
-        fill(json, "stoppedReason", ReasonEnumTypeHelper.toString(data.stoppedReason));
+        fill(json, "stoppedReason", ReasonEnumTypeHelper.toString(data.stoppedReason), allocator);
     }
 
     // remoteStartId
-    fill(json, "remoteStartId", data.remoteStartId);
+    fill(json, "remoteStartId", data.remoteStartId, allocator);
 
     return ret;
 }
@@ -64,17 +64,20 @@ Contains the total time that energy flowed from EVSE to EV during the transactio
 class TransactionTypeConverter : public ocpp::messages::IMessageConverter<TransactionType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<TransactionType>* clone() const override { return new TransactionTypeConverter(); }
-
     /** @brief Convert a TransactionType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   TransactionType&              data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
+
+    /** @brief Convert a TransactionType from a JSON stream */
+    bool fromJson(ocpp::json::JsonReader&       reader,
+                  TransactionType&              data,
+                  std::string&                  error_code,
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a TransactionType to a JSON representation */
-    bool toJson(const TransactionType& data, rapidjson::Document& json) override;
+    bool toJson(const TransactionType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
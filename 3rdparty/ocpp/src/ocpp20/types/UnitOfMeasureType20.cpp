@@ -36,22 +36,57 @@ namespace ocpp20
 bool UnitOfMeasureTypeConverter::fromJson(const rapidjson::Value&       json,
                                           UnitOfMeasureType&            data,
                                           std::string&                  error_code,
-                                          [[maybe_unused]] std::string& error_message)
+                                          [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // unit
-    extract(json, "unit", data.unit);
+    ret = ret && extract(json, "unit", data.unit, error_message);
 
     // multiplier
-    extract(json, "multiplier", data.multiplier);
+    ret = ret && extract(json, "multiplier", data.multiplier, error_message);
+
+    if (!ret)
+    {
+        error_code = ocpp::rpc::IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
+    }
+
+    return ret;
+}
+
+/** @brief Convert a UnitOfMeasureType from a JSON stream */
+bool UnitOfMeasureTypeConverter::fromJson(ocpp::json::JsonReader&       reader,
+                                          UnitOfMeasureType&            data,
+                                          std::string&                  error_code,
+                                          [[maybe_unused]] std::string& error_message) const
+{
+    bool ret = true;
+
+    while (ret && reader.nextMember())
+    {
+        if (reader.isMember("customData"))
+        {
+            CustomDataTypeConverter customData_converter;
+            ret = convert(reader, "customData", data.customData.value(), customData_converter, error_code, error_message);
+        }
+        else if (reader.isMember("unit"))
+        {
+            ret = convert(reader, "unit", data.unit.value(), error_message);
+        }
+        else if (reader.isMember("multiplier"))
+        {
+            ret = convert(reader, "multiplier", data.multiplier.value(), error_message);
+        }
+        else
+        {
+            ret = reader.skip();
+        }
+    }
+    ret = ret && !reader.hasError();
 
     if (!ret)
     {
@@ -62,7 +97,9 @@ bool UnitOfMeasureTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a UnitOfMeasureType to a JSON representation */
-bool UnitOfMeasureTypeConverter::toJson(const UnitOfMeasureType& data, rapidjson::Document& json)
+bool UnitOfMeasureTypeConverter::toJson(const UnitOfMeasureType&            data,
+                                        rapidjson::Value&                   json,
+                                        rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -70,17 +107,16 @@ bool UnitOfMeasureTypeConverter::toJson(const UnitOfMeasureType& data, rapidjson
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // unit
-    fill(json, "unit", data.unit);
+    fill(json, "unit", data.unit, allocator);
 
     // multiplier
-    fill(json, "multiplier", data.multiplier);
+    fill(json, "multiplier", data.multiplier, allocator);
 
     return ret;
 }
@@ -55,17 +55,20 @@ If an applicable unit is available in that list, otherwise a "custom" unit might
 class UnitOfMeasureTypeConverter : public ocpp::messages::IMessageConverter<UnitOfMeasureType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<UnitOfMeasureType>* clone() const override { return new UnitOfMeasureTypeConverter(); }
-
     /** @brief Convert a UnitOfMeasureType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   UnitOfMeasureType&            data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
+
+    /** @brief Convert a UnitOfMeasureType from a JSON stream */
+    bool fromJson(ocpp::json::JsonReader&       reader,
+                  UnitOfMeasureType&            data,
+                  std::string&                  error_code,
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a UnitOfMeasureType to a JSON representation */
-    bool toJson(const UnitOfMeasureType& data, rapidjson::Document& json) override;
+    bool toJson(const UnitOfMeasureType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,34 +36,31 @@ namespace ocpp20
 bool VPNTypeConverter::fromJson(const rapidjson::Value&       json,
                                 VPNType&                      data,
                                 std::string&                  error_code,
-                                [[maybe_unused]] std::string& error_message)
+                                [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // server
-    extract(json, "server", data.server);
+    ret = ret && extract(json, "server", data.server, error_message);
 
     // user
-    extract(json, "user", data.user);
+    ret = ret && extract(json, "user", data.user, error_message);
 
     // group
-    extract(json, "group", data.group);
+    ret = ret && extract(json, "group", data.group, error_message);
 
     // password
-    extract(json, "password", data.password);
+    ret = ret && extract(json, "password", data.password, error_message);
 
     // key
-    extract(json, "key", data.key);
+    ret = ret && extract(json, "key", data.key, error_message);
 
     // type
-    data.type = VPNEnumTypeHelper.fromString(json["type"].GetString());
+    ret = ret && extract(json, "type", data.type, VPNEnumTypeHelper, error_message);
 
     if (!ret)
     {
@@ -74,7 +71,7 @@ bool VPNTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a VPNType to a JSON representation */
-bool VPNTypeConverter::toJson(const VPNType& data, rapidjson::Document& json)
+bool VPNTypeConverter::toJson(const VPNType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -82,29 +79,28 @@ bool VPNTypeConverter::toJson(const VPNType& data, rapidjson::Document& json)
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // server
-    fill(json, "server", data.server);
+    fill(json, "server", data.server, allocator);
 
     // user
-    fill(json, "user", data.user);
+    fill(json, "user", data.user, allocator);
 
     // group
-    fill(json, "group", data.group);
+    fill(json, "group", data.group, allocator);
 
     // password
-    fill(json, "password", data.password);
+    fill(json, "password", data.password, allocator);
 
     // key
-    fill(json, "key", data.key);
+    fill(json, "key", data.key, allocator);
 
     // type
-    fill(json, "type", VPNEnumTypeHelper.toString(data.type));
+    fill(json, "type", VPNEnumTypeHelper.toString(data.type), allocator);
 
     return ret;
 }
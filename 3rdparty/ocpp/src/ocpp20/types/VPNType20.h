@@ -74,17 +74,14 @@ VPN shared secret. */
 class VPNTypeConverter : public ocpp::messages::IMessageConverter<VPNType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<VPNType>* clone() const override { return new VPNTypeConverter(); }
-
     /** @brief Convert a VPNType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   VPNType&                      data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a VPNType to a JSON representation */
-    bool toJson(const VPNType& data, rapidjson::Document& json) override;
+    bool toJson(const VPNType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
@@ -36,37 +36,28 @@ namespace ocpp20
 bool VariableAttributeTypeConverter::fromJson(const rapidjson::Value&       json,
                                               VariableAttributeType&        data,
                                               std::string&                  error_code,
-                                              [[maybe_unused]] std::string& error_message)
+                                              [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // type
-    if (json.HasMember("type"))
-    {
-        data.type = AttributeEnumTypeHelper.fromString(json["type"].GetString());
-    }
+    ret = ret && extract(json, "type", data.type, AttributeEnumTypeHelper, error_message);
 
     // value
-    extract(json, "value", data.value);
+    ret = ret && extract(json, "value", data.value, error_message);
 
     // mutability
-    if (json.HasMember("mutability"))
-    {
-        data.mutability = MutabilityEnumTypeHelper.fromString(json["mutability"].GetString());
-    }
+    ret = ret && extract(json, "mutability", data.mutability, MutabilityEnumTypeHelper, error_message);
 
     // persistent
-    extract(json, "persistent", data.persistent);
+    ret = ret && extract(json, "persistent", data.persistent, error_message);
 
     // constant
-    extract(json, "constant", data.constant);
+    ret = ret && extract(json, "constant", data.constant, error_message);
 
     if (!ret)
     {
@@ -77,7 +68,9 @@ bool VariableAttributeTypeConverter::fromJson(const rapidjson::Value&       json
 }
 
 /** @brief Convert a VariableAttributeType to a JSON representation */
-bool VariableAttributeTypeConverter::toJson(const VariableAttributeType& data, rapidjson::Document& json)
+bool VariableAttributeTypeConverter::toJson(const VariableAttributeType&        data,
+                                            rapidjson::Value&                   json,
+                                            rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -85,32 +78,31 @@ bool VariableAttributeTypeConverter::toJson(const VariableAttributeType& data, r
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // type
     if (data.type.isSet())
     {
-        fill(json, "type", AttributeEnumTypeHelper.toString(data.type));
+        fill(json, "type", AttributeEnumTypeHelper.toString(data.type), allocator);
     }
 
     // value
-    fill(json, "value", data.value);
+    fill(json, "value", data.value, allocator);
 
     // mutability
     if (data.mutability.isSet())
     {
-        fill(json, "mutability", MutabilityEnumTypeHelper.toString(data.mutability));
+        fill(json, "mutability", MutabilityEnumTypeHelper.toString(data.mutability), allocator);
     }
 
     // persistent
-    fill(json, "persistent", data.persistent);
+    fill(json, "persistent", data.persistent, allocator);
 
     // constant
-    fill(json, "constant", data.constant);
+    fill(json, "constant", data.constant, allocator);
 
     return ret;
 }
@@ -63,17 +63,14 @@ The Configuration Variable &lt;&lt;configkey-reporting-value-size,ReportingValue
 class VariableAttributeTypeConverter : public ocpp::messages::IMessageConverter<VariableAttributeType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<VariableAttributeType>* clone() const override { return new VariableAttributeTypeConverter(); }
-
     /** @brief Convert a VariableAttributeType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   VariableAttributeType&        data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a VariableAttributeType to a JSON representation */
-    bool toJson(const VariableAttributeType& data, rapidjson::Document& json) override;
+    bool toJson(const VariableAttributeType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
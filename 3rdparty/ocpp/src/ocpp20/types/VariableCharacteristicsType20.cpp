@@ -36,34 +36,31 @@ namespace ocpp20
 bool VariableCharacteristicsTypeConverter::fromJson(const rapidjson::Value&       json,
                                                     VariableCharacteristicsType&  data,
                                                     std::string&                  error_code,
-                                                    [[maybe_unused]] std::string& error_message)
+                                                    [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // unit
-    extract(json, "unit", data.unit);
+    ret = ret && extract(json, "unit", data.unit, error_message);
 
     // dataType
-    data.dataType = DataEnumTypeHelper.fromString(json["dataType"].GetString());
+    ret = ret && extract(json, "dataType", data.dataType, DataEnumTypeHelper, error_message);
 
     // minLimit
-    extract(json, "minLimit", data.minLimit);
+    ret = ret && extract(json, "minLimit", data.minLimit, error_message);
 
     // maxLimit
-    extract(json, "maxLimit", data.maxLimit);
+    ret = ret && extract(json, "maxLimit", data.maxLimit, error_message);
 
     // valuesList
-    extract(json, "valuesList", data.valuesList);
+    ret = ret && extract(json, "valuesList", data.valuesList, error_message);
 
     // supportsMonitoring
-    extract(json, "supportsMonitoring", data.supportsMonitoring);
+    ret = ret && extract(json, "supportsMonitoring", data.supportsMonitoring, error_message);
 
     if (!ret)
     {
@@ -74,7 +71,9 @@ bool VariableCharacteristicsTypeConverter::fromJson(const rapidjson::Value&
 }
 
 /** @brief Convert a VariableCharacteristicsType to a JSON representation */
-bool VariableCharacteristicsTypeConverter::toJson(const VariableCharacteristicsType& data, rapidjson::Document& json)
+bool VariableCharacteristicsTypeConverter::toJson(const VariableCharacteristicsType&  data,
+                                                  rapidjson::Value&                   json,
+                                                  rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -82,29 +81,28 @@ bool VariableCharacteristicsTypeConverter::toJson(const VariableCharacteristicsT
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // unit
-    fill(json, "unit", data.unit);
+    fill(json, "unit", data.unit, allocator);
 
     // dataType
-    fill(json, "dataType", DataEnumTypeHelper.toString(data.dataType));
+    fill(json, "dataType", DataEnumTypeHelper.toString(data.dataType), allocator);
 
     // minLimit
-    fill(json, "minLimit", data.minLimit);
+    fill(json, "minLimit", data.minLimit, allocator);
 
     // maxLimit
-    fill(json, "maxLimit", data.maxLimit);
+    fill(json, "maxLimit", data.maxLimit, allocator);
 
     // valuesList
-    fill(json, "valuesList", data.valuesList);
+    fill(json, "valuesList", data.valuesList, allocator);
 
     // supportsMonitoring
-    fill(json, "supportsMonitoring", data.supportsMonitoring);
+    fill(json, "supportsMonitoring", data.supportsMonitoring, allocator);
 
     return ret;
 }
@@ -72,20 +72,16 @@ The Configuration Variable &lt;&lt;configkey-configuration-value-size,Configurat
 class VariableCharacteristicsTypeConverter : public ocpp::messages::IMessageConverter<VariableCharacteristicsType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<VariableCharacteristicsType>* clone() const override
-    {
-        return new VariableCharacteristicsTypeConverter();
-    }
-
     /** @brief Convert a VariableCharacteristicsType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   VariableCharacteristicsType&  data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a VariableCharacteristicsType to a JSON representation */
-    bool toJson(const VariableCharacteristicsType& data, rapidjson::Document& json) override;
+    bool toJson(const VariableCharacteristicsType&  data,
+                rapidjson::Value&                   json,
+                rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
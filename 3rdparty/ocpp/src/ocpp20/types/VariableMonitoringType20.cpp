@@ -36,31 +36,28 @@ namespace ocpp20
 bool VariableMonitoringTypeConverter::fromJson(const rapidjson::Value&       json,
                                                VariableMonitoringType&       data,
                                                std::string&                  error_code,
-                                               [[maybe_unused]] std::string& error_message)
+                                               [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // id
-    extract(json, "id", data.id);
+    ret = ret && extract(json, "id", data.id, error_message);
 
     // transaction
-    extract(json, "transaction", data.transaction);
+    ret = ret && extract(json, "transaction", data.transaction, error_message);
 
     // value
-    extract(json, "value", data.value);
+    ret = ret && extract(json, "value", data.value, error_message);
 
     // type
-    data.type = MonitorEnumTypeHelper.fromString(json["type"].GetString());
+    ret = ret && extract(json, "type", data.type, MonitorEnumTypeHelper, error_message);
 
     // severity
-    extract(json, "severity", data.severity);
+    ret = ret && extract(json, "severity", data.severity, error_message);
 
     if (!ret)
     {
@@ -71,7 +68,9 @@ bool VariableMonitoringTypeConverter::fromJson(const rapidjson::Value&       jso
 }
 
 /** @brief Convert a VariableMonitoringType to a JSON representation */
-bool VariableMonitoringTypeConverter::toJson(const VariableMonitoringType& data, rapidjson::Document& json)
+bool VariableMonitoringTypeConverter::toJson(const VariableMonitoringType&       data,
+                                             rapidjson::Value&                   json,
+                                             rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -79,26 +78,25 @@ bool VariableMonitoringTypeConverter::toJson(const VariableMonitoringType& data,
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // id
-    fill(json, "id", data.id);
+    fill(json, "id", data.id, allocator);
 
     // transaction
-    fill(json, "transaction", data.transaction);
+    fill(json, "transaction", data.transaction, allocator);
 
     // value
-    fill(json, "value", data.value);
+    fill(json, "value", data.value, allocator);
 
     // type
-    fill(json, "type", MonitorEnumTypeHelper.toString(data.type));
+    fill(json, "type", MonitorEnumTypeHelper.toString(data.type), allocator);
 
     // severity
-    fill(json, "severity", data.severity);
+    fill(json, "severity", data.severity, allocator);
 
     return ret;
 }
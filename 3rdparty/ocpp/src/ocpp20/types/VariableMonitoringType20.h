@@ -82,17 +82,14 @@ Indicates information useful to developers for debugging, not useful during oper
 class VariableMonitoringTypeConverter : public ocpp::messages::IMessageConverter<VariableMonitoringType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<VariableMonitoringType>* clone() const override { return new VariableMonitoringTypeConverter(); }
-
     /** @brief Convert a VariableMonitoringType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   VariableMonitoringType&       data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a VariableMonitoringType to a JSON representation */
-    bool toJson(const VariableMonitoringType& data, rapidjson::Document& json) override;
+    bool toJson(const VariableMonitoringType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
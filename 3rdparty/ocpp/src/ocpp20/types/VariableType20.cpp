@@ -36,22 +36,19 @@ namespace ocpp20
 bool VariableTypeConverter::fromJson(const rapidjson::Value&       json,
                                      VariableType&                 data,
                                      std::string&                  error_code,
-                                     [[maybe_unused]] std::string& error_message)
+                                     [[maybe_unused]] std::string& error_message) const
 {
     bool ret = true;
 
     // customData
-    if (json.HasMember("customData"))
-    {
-        CustomDataTypeConverter customData_converter;
-        ret = ret && customData_converter.fromJson(json["customData"], data.customData, error_code, error_message);
-    }
+    CustomDataTypeConverter customData_converter;
+    ret = ret && extract(json, "customData", data.customData, customData_converter, error_code, error_message);
 
     // name
-    extract(json, "name", data.name);
+    ret = ret && extract(json, "name", data.name, error_message);
 
     // instance
-    extract(json, "instance", data.instance);
+    ret = ret && extract(json, "instance", data.instance, error_message);
 
     if (!ret)
     {
@@ -62,7 +59,7 @@ bool VariableTypeConverter::fromJson(const rapidjson::Value&       json,
 }
 
 /** @brief Convert a VariableType to a JSON representation */
-bool VariableTypeConverter::toJson(const VariableType& data, rapidjson::Document& json)
+bool VariableTypeConverter::toJson(const VariableType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const
 {
     bool ret = true;
 
@@ -70,17 +67,16 @@ bool VariableTypeConverter::toJson(const VariableType& data, rapidjson::Document
     if (data.customData.isSet())
     {
         CustomDataTypeConverter customData_converter;
-        customData_converter.setAllocator(allocator);
-        rapidjson::Document customData_doc(rapidjson::kObjectType);
-        ret = ret && customData_converter.toJson(data.customData, customData_doc);
-        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), *allocator);
+        rapidjson::Value        customData_doc(rapidjson::kObjectType);
+        ret = ret && customData_converter.toJson(data.customData, customData_doc, allocator);
+        json.AddMember(rapidjson::StringRef("customData"), customData_doc.Move(), allocator);
     }
 
     // name
-    fill(json, "name", data.name);
+    fill(json, "name", data.name, allocator);
 
     // instance
-    fill(json, "instance", data.instance);
+    fill(json, "instance", data.instance, allocator);
 
     return ret;
 }
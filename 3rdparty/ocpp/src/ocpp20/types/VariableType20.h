@@ -53,17 +53,14 @@ struct VariableType
 class VariableTypeConverter : public ocpp::messages::IMessageConverter<VariableType>
 {
   public:
-    /** @brief Clone the converter */
-    ocpp::messages::IMessageConverter<VariableType>* clone() const override { return new VariableTypeConverter(); }
-
     /** @brief Convert a VariableType from a JSON representation */
     bool fromJson(const rapidjson::Value&       json,
                   VariableType&                 data,
                   std::string&                  error_code,
-                  [[maybe_unused]] std::string& error_message) override;
+                  [[maybe_unused]] std::string& error_message) const override;
 
     /** @brief Convert a VariableType to a JSON representation */
-    bool toJson(const VariableType& data, rapidjson::Document& json) override;
+    bool toJson(const VariableType& data, rapidjson::Value& json, rapidjson::Document::AllocatorType& allocator) const override;
 };
 
 } // namespace ocpp20
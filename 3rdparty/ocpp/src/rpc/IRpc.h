@@ -22,6 +22,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "json.h"
 
 #include <chrono>
+#include <functional>
 #include <string>
 
 namespace ocpp
@@ -37,6 +38,18 @@ class IRpc
     class IListener;
     class ISpy;
 
+    /**
+     * @brief Handler called when an asynchronous call has completed
+     * @param received true if a response has been received, false if the call has timed out or the connection has been lost
+     * @param rpc_frame Full JSON response received
+     * @param response JSON response received
+     * @param error Error code (empty if no error), failure cause (RPC_FAILURE_*) if no response has been received
+     * @param message Error message (empty if no error)
+     */
+    typedef std::function<void(
+        bool received, rapidjson::Document& rpc_frame, rapidjson::Value& response, const std::string& error, const std::string& message)>
+        CallCompletionHandler;
+
     /** @brief Destructor */
     virtual ~IRpc() { }
 
@@ -50,7 +63,7 @@ class IRpc
      * @brief Call a remote action and wait for its response
      * @param action Remote action
      * @param payload JSON payload for the action
-     * @param rpc_frame Full JSON response received
+     * @param rpc_frame JSON document holding the memory of the response
      * @param response JSON response received
      * @param error Error code (empty if no error)
      * @param message Error message (empty if no error)
@@ -65,6 +78,21 @@ class IRpc
                       std::string&               message,
                       std::chrono::milliseconds  timeout = std::chrono::seconds(2)) = 0;
 
+    /**
+     * @brief Call a remote action without waiting for its response
+     *        Multiple asynchronous calls can be pending at the same time on a connection
+     * @param action Remote action
+     * @param payload JSON payload for the action
+     * @param handler Handler to call when the response has been received or when the call has failed,
+     *                it is called exactly once if the request has been sent
+     * @param timeout Response timeout
+     * @return true if the request has been sent, false otherwise
+     */
+    virtual bool callAsync(const std::string&         action,
+                           const rapidjson::Document& payload,
+                           CallCompletionHandler      handler,
+                           std::chrono::milliseconds  timeout = std::chrono::seconds(2)) = 0;
+
     /**
      * @brief Register a listener to the RPC events
      * @param listener Listener object
@@ -110,6 +138,38 @@ class IRpc
                                      rapidjson::Document&    response,
                                      std::string&            error_code,
                                      std::string&            error_message) = 0;
+
+        /**
+         * @brief Called when a CALL message has been received with its payload not parsed yet
+         *        (default implementation parses the payload and calls the rpcCallReceived() method,
+         *         listeners can override it to convert the payload directly while parsing it)
+         * @param action Action
+         * @param payload Null terminated JSON payload for the action, it can be modified during its parsing
+         * @param response JSON response to send
+         * @param error_code Standard error code, empty if no error
+         * @param error_msg Additionnal error message, empty if no error
+         * @return true if the call is accepted, false otherwise
+         */
+        virtual bool rpcRawCallReceived(const std::string&   action,
+                                        char*                payload,
+                                        rapidjson::Document& response,
+                                        std::string&         error_code,
+                                        std::string&         error_message)
+        {
+            bool                ret = false;
+            rapidjson::Document json_payload;
+            json_payload.ParseInsitu(payload);
+            if (!json_payload.HasParseError() && json_payload.IsObject())
+            {
+                ret = rpcCallReceived(action, json_payload, response, error_code, error_message);
+            }
+            else
+            {
+                error_code    = RPC_ERROR_PROTOCOL;
+                error_message = "Invalid JSON payload";
+            }
+            return ret;
+        }
     };
 
     /** @brief Interface for the RPC clients spies */
@@ -152,6 +212,15 @@ class IRpc
     static constexpr const char* RPC_ERROR_TYPE_CONSTRAINT_VIOLATION = "TypeConstraintViolation";
     /** @brief RPC error code : GenericError */
     static constexpr const char* RPC_ERROR_GENERIC = "GenericError";
+
+    /** @brief Asynchronous call failure cause : no response has been received before the timeout */
+    static constexpr const char* RPC_FAILURE_TIMEOUT = "Timeout";
+    /** @brief Asynchronous call failure cause : the connection has been lost before the response */
+    static constexpr const char* RPC_FAILURE_DISCONNECTED = "Disconnected";
+    /** @brief Asynchronous call failure cause : the RPC endpoint or its pool has been stopped before the response */
+    static constexpr const char* RPC_FAILURE_STOPPED = "Stopped";
+    /** @brief Asynchronous call failure cause : the received response is not valid */
+    static constexpr const char* RPC_FAILURE_INVALID_RESPONSE = "InvalidResponse";
 };
 
 } // namespace rpc
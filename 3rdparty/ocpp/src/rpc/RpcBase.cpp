@@ -19,20 +19,27 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "RpcBase.h"
 #include "RpcPool.h"
 
+#include <algorithm>
 #include <functional>
-#include <sstream>
+#include <iterator>
+#include <limits>
+#include <vector>
 
 namespace ocpp
 {
 namespace rpc
 {
 
-/** @brief RPC call type */
-static constexpr const char* CALL = "2";
-/** @brief RPC call result type */
-static constexpr const char* CALLRESULT = "3";
-/** @brief RPC call error type */
-static constexpr const char* CALLERROR = "4";
+/** @brief Writer used to serialize the messages directly inside the frames to send */
+typedef rapidjson::Writer<ocpp::websockets::SendFrame, rapidjson::UTF8<>, rapidjson::UTF8<>, rapidjson::MemoryPoolAllocator<>> FrameWriter;
+/** @brief Size of the stack buffer used by the frame writer to store its nesting levels */
+static constexpr size_t FRAME_WRITER_STACK_SIZE = 1024u;
+
+/** @brief Indicate if a character is a JSON whitespace */
+static bool isJsonWhitespace(char c)
+{
+    return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r');
+}
 
 /** @brief Constructor */
 RpcBase::RpcBase(RpcPool* pool)
@@ -40,9 +47,8 @@ RpcBase::RpcBase(RpcPool* pool)
       m_rpc_listener(nullptr),
       m_spies(),
       m_transaction_id(0),
-      m_call_mutex(),
-      m_requests_queue(),
-      m_results_queue(),
+      m_requests_queue(pool ? nullptr : new ocpp::helpers::LockFreeQueue<std::shared_ptr<RpcMessage>>()),
+      m_pending_calls(std::make_shared<PendingCalls>()),
       m_rx_thread(nullptr),
       m_rpc_owner()
 {
@@ -69,66 +75,34 @@ bool RpcBase::call(const std::string&         action,
     // Check connection state
     if (isConnected())
     {
-        // Only one RPC request/response at a time
-        std::lock_guard<std::mutex> call_lock(m_call_mutex);
-
         // Serialize message
-        rapidjson::StringBuffer                    buffer;
-        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-        writer.SetMaxDecimalPlaces(1); // OCPP decimals have 1 digit precision
-        payload.Accept(writer);
-
-        std::stringstream serialized_message;
-        serialized_message << "[";
-        serialized_message << CALL << ", ";
-        serialized_message << "\"" << m_transaction_id << "\", ";
-        serialized_message << "\"" << action << "\", ";
-        serialized_message << buffer.GetString();
-        serialized_message << "]";
-
-        // Initialize call context
-        std::stringstream id;
-        id << m_transaction_id;
+        std::string                 unique_id = std::to_string(m_transaction_id++);
+        ocpp::websockets::SendFrame msg       = serializeCall(unique_id, action, payload);
 
-        // Send message
-        std::string msg = serialized_message.str();
-        if (send(msg))
+        // Register call before sending since the response may be received before the end of the send operation
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        if (registerCall(unique_id, deadline, IRpc::CallCompletionHandler()))
         {
+            // Send message
+            bool sent = send(msg);
+
             // Wait for response
-            std::stringstream expected_id;
-            expected_id << m_transaction_id;
-            std::shared_ptr<RpcMessage> rpc_message;
-            auto                        wait_time = std::chrono::steady_clock().now() + timeout;
-            do
+            std::unique_lock<std::mutex> lock(m_pending_calls->mutex);
+            PendingCall&                 pending_call = m_pending_calls->calls[unique_id];
+            if (sent)
             {
-                // Compute timeout
-                auto now       = std::chrono::steady_clock().now();
-                auto left_time = std::chrono::duration_cast<std::chrono::milliseconds>(wait_time - now);
-                if (left_time.count() >= 0)
-                {
-                    // Wait for a message
-                    ret = m_results_queue.pop(rpc_message, static_cast<unsigned int>(left_time.count()));
-                    if (ret)
-                    {
-                        // Check id
-                        if (rpc_message->unique_id != expected_id.str())
-                        {
-                            // Wrong message
-                            rpc_message.reset();
-                        }
-                    }
-                }
-                else
-                {
-                    ret = false;
-                }
-            } while (ret && !rpc_message);
+                m_pending_calls->cond.wait_until(lock, deadline, [&pending_call] { return pending_call.completed; });
+            }
 
             // Extract response
+            std::shared_ptr<RpcMessage> rpc_message = std::move(pending_call.response);
+            m_pending_calls->calls.erase(unique_id);
+            lock.unlock();
             if (rpc_message)
             {
-                rpc_frame.Swap(rpc_message->rpc_frame);
-                response.Swap(rpc_message->payload);
+                // The received frame has been parsed in-situ and its buffer is released with the message
+                // => copy the response into the caller's document
+                response.CopyFrom(rpc_message->payload, rpc_frame.GetAllocator(), true);
                 error.clear();
                 message.clear();
                 if (!rpc_message->error.IsNull())
@@ -139,16 +113,61 @@ bool RpcBase::call(const std::string&         action,
                 {
                     message = rpc_message->message.GetString();
                 }
-                rpc_message.reset();
+                ret = true;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/** @copydoc bool IRpc::callAsync(const std::string&, const rapidjson::Document&, CallCompletionHandler, std::chrono::milliseconds) */
+bool RpcBase::callAsync(const std::string&          action,
+                        const rapidjson::Document&  payload,
+                        IRpc::CallCompletionHandler handler,
+                        std::chrono::milliseconds   timeout)
+{
+    bool ret = false;
+
+    // Check connection state
+    if (isConnected() && handler)
+    {
+        // Serialize message
+        std::string                 unique_id = std::to_string(m_transaction_id++);
+        ocpp::websockets::SendFrame msg       = serializeCall(unique_id, action, payload);
+
+        // Register call before sending since the response may be received before the end of the send operation
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        if (registerCall(unique_id, deadline, std::move(handler)))
+        {
+            // Arm the deadline
+            if (m_pool)
+            {
+                m_pool->watchDeadline(m_pending_calls, unique_id, deadline);
             }
             else
             {
-                ret = false;
+                // Wakeup reception thread to take into account the new deadline
+                m_requests_queue->wakeup();
             }
-        }
 
-        // Update transaction id
-        m_transaction_id++;
+            // Send message
+            ret = send(msg);
+            if (!ret)
+            {
+                // Cancel the call if it has not already been completed
+                std::lock_guard<std::mutex> lock(m_pending_calls->mutex);
+                auto                        it = m_pending_calls->calls.find(unique_id);
+                if (it != m_pending_calls->calls.end())
+                {
+                    removeAsyncCall(it);
+                }
+                else
+                {
+                    ret = true;
+                }
+            }
+        }
     }
 
     return ret;
@@ -181,23 +200,13 @@ void RpcBase::processIncomingRequest(std::shared_ptr<RpcMessage>& rpc_message)
     rapidjson::Document response(rapidjson::kObjectType);
     std::string         error;
     std::string         error_code;
-    if (m_rpc_listener->rpcCallReceived(rpc_message->action, rpc_message->payload, response, error_code, error))
+    if (m_rpc_listener->rpcRawCallReceived(rpc_message->action, rpc_message->raw_payload, response, error_code, error))
     {
         // Serialize message
-        rapidjson::StringBuffer                    buffer;
-        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-        writer.SetMaxDecimalPlaces(1); // OCPP decimals have 1 digit precision
-        response.Accept(writer);
-
-        std::stringstream serialized_message;
-        serialized_message << "[";
-        serialized_message << CALLRESULT << ", ";
-        serialized_message << "\"" << rpc_message->unique_id << "\", ";
-        serialized_message << buffer.GetString();
-        serialized_message << "]";
+        ocpp::websockets::SendFrame msg =
+            serializeMessage(MessageType::CALLRESULT, rpc_message->unique_id, [&response](auto& writer) { response.Accept(writer); });
 
         // Send message
-        std::string msg = serialized_message.str();
         send(msg);
     }
     else
@@ -213,6 +222,93 @@ void RpcBase::processIncomingRequest(std::shared_ptr<RpcMessage>& rpc_message)
     rpc_message.reset();
 }
 
+/** @brief Notify the completion of an asynchronous call to its handler */
+void RpcBase::processCallCompletion(std::shared_ptr<RpcMessage>& rpc_message)
+{
+    // Extract error
+    std::string error;
+    std::string message;
+    if (!rpc_message->error.IsNull())
+    {
+        error = rpc_message->error.GetString();
+    }
+    if (!rpc_message->message.IsNull())
+    {
+        message = rpc_message->message.GetString();
+    }
+
+    // Notify handler
+    rpc_message->handler(rpc_message->received, rpc_message->rpc_frame, rpc_message->payload, error, message);
+
+    // Free resources
+    rpc_message.reset();
+}
+
+/** @brief Complete the asynchronous calls which have reached their deadline */
+std::chrono::steady_clock::time_point RpcBase::expirePendingCalls(PendingCalls& pending_calls, RpcPool* pool)
+{
+    auto                                     now           = std::chrono::steady_clock::now();
+    auto                                     next_deadline = std::chrono::steady_clock::time_point::max();
+    std::vector<std::shared_ptr<RpcMessage>> expired_calls;
+
+    // Look for expired asynchronous calls in deadline order, synchronous calls are handled by their caller
+    {
+        std::lock_guard<std::mutex> lock(pending_calls.mutex);
+        while (!pending_calls.deadlines.empty() && (pending_calls.deadlines.begin()->first <= now))
+        {
+            auto it = pending_calls.calls.find(pending_calls.deadlines.begin()->second);
+            if (it != pending_calls.calls.end())
+            {
+                expired_calls.push_back(std::make_shared<RpcMessage>(it->first, std::move(it->second.handler), RPC_FAILURE_TIMEOUT));
+                pending_calls.calls.erase(it);
+            }
+            pending_calls.deadlines.erase(pending_calls.deadlines.begin());
+        }
+        if (!pending_calls.deadlines.empty())
+        {
+            next_deadline = pending_calls.deadlines.begin()->first;
+        }
+    }
+
+    // Notify timeouts
+    for (auto& rpc_message : expired_calls)
+    {
+        if (pool)
+        {
+            pool->dispatchCompletion(std::move(rpc_message));
+        }
+        else
+        {
+            processCallCompletion(rpc_message);
+        }
+    }
+
+    return next_deadline;
+}
+
+/** @brief Complete an asynchronous call if it has reached its deadline */
+void RpcBase::expirePendingCall(PendingCalls& pending_calls, const std::string& unique_id, RpcPool* pool, bool force)
+{
+    std::shared_ptr<RpcMessage> expired_call;
+    {
+        std::lock_guard<std::mutex> lock(pending_calls.mutex);
+        auto                        it = pending_calls.calls.find(unique_id);
+        if ((it != pending_calls.calls.end()) && it->second.handler && (force || (it->second.deadline <= std::chrono::steady_clock::now())))
+        {
+            pending_calls.deadlines.erase(std::make_pair(it->second.deadline, unique_id));
+            const char* failure = (force ? RPC_FAILURE_STOPPED : RPC_FAILURE_TIMEOUT);
+            expired_call        = std::make_shared<RpcMessage>(it->first, std::move(it->second.handler), failure);
+            pending_calls.calls.erase(it);
+        }
+    }
+
+    // Notify timeout
+    if (expired_call)
+    {
+        pool->dispatchCompletion(std::move(expired_call));
+    }
+}
+
 /** @brief Start RPC operations */
 void RpcBase::start()
 {
@@ -220,11 +316,17 @@ void RpcBase::start()
     if (!m_rx_thread && !m_rpc_owner)
     {
         // Initialize transaction id sequence
-        m_transaction_id = std::rand();
+        m_transaction_id = static_cast<unsigned int>(std::rand());
 
         // Start queues
-        m_requests_queue.setEnable(true);
-        m_results_queue.setEnable(true);
+        if (m_requests_queue)
+        {
+            m_requests_queue->setEnable(true);
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_pending_calls->mutex);
+            m_pending_calls->enabled = true;
+        }
 
         // Check if a pool has been configured
         if (m_pool)
@@ -247,8 +349,10 @@ void RpcBase::stop()
     if (m_rx_thread || m_rpc_owner)
     {
         // Stop queues
-        m_results_queue.setEnable(false);
-        m_requests_queue.setEnable(false);
+        if (m_requests_queue)
+        {
+            m_requests_queue->setEnable(false);
+        }
 
         // Check if a pool has been configured
         if (m_pool)
@@ -269,9 +373,23 @@ void RpcBase::stop()
             m_rx_thread = nullptr;
         }
 
-        // Flush queues
-        m_requests_queue.clear();
-        m_results_queue.clear();
+        // Flush queues : notify the queued asynchronous call results so that no handler is lost,
+        // the queued requests are dropped
+        if (m_requests_queue)
+        {
+            std::shared_ptr<RpcMessage> rpc_message;
+            while (m_requests_queue->tryPop(rpc_message))
+            {
+                if (rpc_message && rpc_message->handler)
+                {
+                    processCallCompletion(rpc_message);
+                }
+                rpc_message.reset();
+            }
+        }
+
+        // Abort pending calls
+        failPendingCalls(RPC_FAILURE_STOPPED);
     }
 }
 
@@ -279,8 +397,13 @@ void RpcBase::stop()
 void RpcBase::processDisconnected()
 {
     // Disable queues
-    m_requests_queue.setEnable(false);
-    m_results_queue.setEnable(false);
+    if (m_requests_queue)
+    {
+        m_requests_queue->setEnable(false);
+    }
+
+    // Abort pending calls
+    failPendingCalls(RPC_FAILURE_DISCONNECTED);
 
     // Check if a pool has been configured
     if (m_pool)
@@ -293,76 +416,92 @@ void RpcBase::processDisconnected()
 }
 
 /** @brief Process received data */
-void RpcBase::processReceivedData(const void* data, size_t size)
+void RpcBase::processReceivedData(std::unique_ptr<char[]> data, size_t size)
 {
-    // Decode received data
-    std::string received_data(reinterpret_cast<const char*>(data), size);
-    for (ISpy* spy : m_spies)
+    // Notify spies before the in-situ parsing modifies the data
+    if (!m_spies.empty())
     {
-        spy->rcpMessageReceived(received_data);
+        std::string received_data(data.get(), size);
+        for (ISpy* spy : m_spies)
+        {
+            spy->rcpMessageReceived(received_data);
+        }
     }
 
     // RPC frame must be a JSON array
-    bool                valid = false;
-    rapidjson::Document rpc_frame;
-    try
-    {
-        rpc_frame.Parse(received_data.c_str());
-        valid = !rpc_frame.HasParseError();
-    }
-    catch (const std::exception&)
+    // => The payload of the CALL messages is parsed later by their listener directly from the
+    //    frame buffer, so only the header of the frame is read here
+    ocpp::json::JsonReader header(data.get());
+    if (header.next() && header.IsArray() && header.next() && header.IsUint() &&
+        (header.GetUint() == static_cast<unsigned int>(MessageType::CALL)))
     {
+        if (!decodeCall(header, data, size))
+        {
+            sendCallError("", RPC_ERROR_PROTOCOL, "");
+        }
     }
-    if (valid && rpc_frame.IsArray() && (rpc_frame.Size() >= 3))
+    else
     {
-        // Extract message type
-        const rapidjson::Value& msg_type_value = rpc_frame[0];
-        if (msg_type_value.IsUint())
-        {
-            // Check message type
-            MessageType  msg_type     = MessageType::INVALID;
-            unsigned int msg_type_int = msg_type_value.GetUint();
-            switch (msg_type_int)
-            {
-                case static_cast<unsigned int>(MessageType::CALL):
-                    msg_type = MessageType::CALL;
-                    valid    = (rpc_frame.Size() == 4u);
-                    break;
-                case static_cast<unsigned int>(MessageType::CALLRESULT):
-                    msg_type = MessageType::CALLRESULT;
-                    valid    = (rpc_frame.Size() == 3u);
-                    break;
-                case static_cast<unsigned int>(MessageType::CALLERROR):
-                    msg_type = MessageType::CALLERROR;
-                    valid    = (rpc_frame.Size() == 5u);
-                    break;
-                default:
-                    // Unknown type
-                    valid = false;
-                    break;
-            }
-            if (valid)
+        // Parse in-situ so that the strings are not copied
+        // => Reading the header did not modify the frame since it contains no strings
+        bool                valid = false;
+        rapidjson::Document rpc_frame;
+        try
+        {
+            rpc_frame.ParseInsitu(data.get());
+            valid = !rpc_frame.HasParseError();
+        }
+        catch (const std::exception&)
+        {
+        }
+        if (valid && rpc_frame.IsArray() && (rpc_frame.Size() >= 3))
+        {
+            // Extract message type
+            const rapidjson::Value& msg_type_value = rpc_frame[0];
+            if (msg_type_value.IsUint())
             {
-                // Extract unique identifier
-                const rapidjson::Value& unique_id_value = rpc_frame[1];
-                if (unique_id_value.IsString())
+                // Check message type
+                MessageType  msg_type     = MessageType::INVALID;
+                unsigned int msg_type_int = msg_type_value.GetUint();
+                switch (msg_type_int)
+                {
+                    case static_cast<unsigned int>(MessageType::CALLRESULT):
+                        msg_type = MessageType::CALLRESULT;
+                        valid    = (rpc_frame.Size() == 3u);
+                        break;
+                    case static_cast<unsigned int>(MessageType::CALLERROR):
+                        msg_type = MessageType::CALLERROR;
+                        valid    = (rpc_frame.Size() == 5u);
+                        break;
+                    default:
+                        // Unknown type
+                        valid = false;
+                        break;
+                }
+                if (valid)
                 {
-                    // Decode message
-                    std::string unique_id = unique_id_value.GetString();
-                    switch (msg_type)
+                    // Extract unique identifier
+                    const rapidjson::Value& unique_id_value = rpc_frame[1];
+                    if (unique_id_value.IsString())
                     {
-                        case MessageType::CALL:
-                            valid = decodeCall(unique_id, rpc_frame, rpc_frame[2], rpc_frame[3]);
-                            break;
-                        case MessageType::CALLRESULT:
-                            valid = decodeCallResult(unique_id, rpc_frame, rpc_frame[2]);
-                            break;
-                        case MessageType::CALLERROR:
-                        default:
-                            valid = decodeCallError(unique_id, rpc_frame, rpc_frame[2], rpc_frame[3], rpc_frame[4]);
-                            break;
+                        // Decode message
+                        std::string unique_id = unique_id_value.GetString();
+                        switch (msg_type)
+                        {
+                            case MessageType::CALLRESULT:
+                                valid = decodeCallResult(unique_id, data, rpc_frame, rpc_frame[2]);
+                                break;
+                            case MessageType::CALLERROR:
+                            default:
+                                valid = decodeCallError(unique_id, data, rpc_frame, rpc_frame[2], rpc_frame[3], rpc_frame[4]);
+                                break;
+                        }
+                        if (!valid)
+                        {
+                            sendCallError("", RPC_ERROR_PROTOCOL, "");
+                        }
                     }
-                    if (!valid)
+                    else
                     {
                         sendCallError("", RPC_ERROR_PROTOCOL, "");
                     }
@@ -382,69 +521,255 @@ void RpcBase::processReceivedData(const void* data, size_t size)
             sendCallError("", RPC_ERROR_PROTOCOL, "");
         }
     }
-    else
-    {
-        sendCallError("", RPC_ERROR_PROTOCOL, "");
-    }
 }
 
 /** @brief Send a message throug the websocket connection */
-bool RpcBase::send(const std::string& msg)
+bool RpcBase::send(ocpp::websockets::SendFrame& frame)
 {
     // Notify spy
-    for (ISpy* spy : m_spies)
+    if (!m_spies.empty())
     {
-        spy->rcpMessageSent(msg);
+        std::string msg(frame.payload(), frame.size());
+        for (ISpy* spy : m_spies)
+        {
+            spy->rcpMessageSent(msg);
+        }
     }
 
     // Send message
-    return doSend(msg);
+    return doSend(std::move(frame));
+}
+
+/** @brief Serialize a message directly inside a frame to send, the content is written after the message type and unique identifier */
+template <typename ContentWriter>
+ocpp::websockets::SendFrame RpcBase::serializeMessage(MessageType type, const std::string& unique_id, ContentWriter write_content)
+{
+    // The nesting levels of the writer are stored on the stack
+    // so that the frame buffer is the only heap allocation
+    char                             stack_buffer[FRAME_WRITER_STACK_SIZE];
+    rapidjson::MemoryPoolAllocator<> stack_allocator(stack_buffer, sizeof(stack_buffer));
+
+    ocpp::websockets::SendFrame frame;
+    FrameWriter                 writer(frame, &stack_allocator);
+    writer.SetMaxDecimalPlaces(1); // OCPP decimals have 1 digit precision
+    writer.StartArray();
+    writer.Uint(static_cast<unsigned int>(type));
+    writer.String(unique_id.c_str(), static_cast<rapidjson::SizeType>(unique_id.size()));
+    write_content(writer);
+    writer.EndArray();
+
+    return frame;
+}
+
+/** @brief Serialize a CALL message */
+ocpp::websockets::SendFrame RpcBase::serializeCall(const std::string&         unique_id,
+                                                   const std::string&         action,
+                                                   const rapidjson::Document& payload)
+{
+    return serializeMessage(MessageType::CALL,
+                            unique_id,
+                            [&action, &payload](auto& writer)
+                            {
+                                writer.String(action.c_str(), static_cast<rapidjson::SizeType>(action.size()));
+                                payload.Accept(writer);
+                            });
 }
 
-/** @brief Decode a CALL message */
-bool RpcBase::decodeCall(const std::string&      unique_id,
-                         rapidjson::Document&    rpc_frame,
-                         const rapidjson::Value& action,
-                         rapidjson::Value&       payload)
+/** @brief Register a pending call */
+bool RpcBase::registerCall(const std::string&                    unique_id,
+                           std::chrono::steady_clock::time_point deadline,
+                           IRpc::CallCompletionHandler           handler)
 {
     bool ret = false;
 
-    // Check types
-    if (action.IsString() && payload.IsObject())
+    std::lock_guard<std::mutex> lock(m_pending_calls->mutex);
+    if (m_pending_calls->enabled)
+    {
+        PendingCall& pending_call = m_pending_calls->calls[unique_id];
+        pending_call.deadline     = deadline;
+        pending_call.handler      = std::move(handler);
+        pending_call.response.reset();
+        pending_call.completed = false;
+        if (pending_call.handler)
+        {
+            m_pending_calls->deadlines.emplace(deadline, unique_id);
+        }
+        ret = true;
+    }
+
+    return ret;
+}
+
+/** @brief Match a received CALLRESULT or CALLERROR message with its pending call */
+void RpcBase::processCallResponse(std::shared_ptr<RpcMessage>&& rpc_message)
+{
+    std::unique_lock<std::mutex> lock(m_pending_calls->mutex);
+
+    // Look for the corresponding call, responses to unknown or timed out calls are dropped
+    auto it = m_pending_calls->calls.find(rpc_message->unique_id);
+    if (it != m_pending_calls->calls.end())
     {
-        // Create request
-        auto msg = std::make_shared<RpcMessage>(unique_id, action.GetString(), rpc_frame, payload);
+        PendingCall& pending_call = it->second;
+        if (pending_call.handler)
+        {
+            // Asynchronous call, notify completion outside of the reception context
+            rpc_message->handler = removeAsyncCall(it);
+            lock.unlock();
 
-        // Check if a pool has been configured
+            if (m_pool)
+            {
+                m_pool->dispatchCompletion(std::move(rpc_message));
+            }
+            else
+            {
+                if (!m_requests_queue->push(std::move(rpc_message)))
+                {
+                    // Queue is full or stopped, notify completion immediately
+                    processCallCompletion(rpc_message);
+                }
+            }
+        }
+        else
+        {
+            // Synchronous call, wakeup caller
+            pending_call.response  = std::move(rpc_message);
+            pending_call.completed = true;
+            m_pending_calls->cond.notify_all();
+        }
+    }
+}
+
+/** @brief Remove an asynchronous call from the pending calls (pending calls mutex must be held) */
+IRpc::CallCompletionHandler RpcBase::removeAsyncCall(std::unordered_map<std::string, PendingCall>::iterator it)
+{
+    PendingCall& pending_call = it->second;
+    m_pending_calls->deadlines.erase(std::make_pair(pending_call.deadline, it->first));
+    if (m_pool)
+    {
+        m_pool->cancelDeadline(*m_pending_calls, it->first, pending_call.deadline);
+    }
+    IRpc::CallCompletionHandler handler = std::move(pending_call.handler);
+    m_pending_calls->calls.erase(it);
+    return handler;
+}
+
+/** @brief Complete all the pending calls without response */
+void RpcBase::failPendingCalls(const char* failure)
+{
+    std::vector<std::shared_ptr<RpcMessage>> aborted_calls;
+
+    // Disable call registration and complete pending calls
+    {
+        std::lock_guard<std::mutex> lock(m_pending_calls->mutex);
+        m_pending_calls->enabled = false;
+        for (auto it = m_pending_calls->calls.begin(); it != m_pending_calls->calls.end();)
+        {
+            PendingCall& pending_call = it->second;
+            if (pending_call.handler)
+            {
+                auto        next      = std::next(it);
+                std::string unique_id = it->first;
+                aborted_calls.push_back(std::make_shared<RpcMessage>(unique_id, removeAsyncCall(it), failure));
+                it = next;
+            }
+            else
+            {
+                // Synchronous caller will remove its call
+                pending_call.completed = true;
+                ++it;
+            }
+        }
+        m_pending_calls->cond.notify_all();
+    }
+
+    // Notify failures
+    for (auto& rpc_message : aborted_calls)
+    {
         if (m_pool)
         {
-            // Add request to the pool
-            msg->owner = m_rpc_owner;
-            m_pool->getRequestQueue().push(std::move(msg));
+            m_pool->dispatchCompletion(std::move(rpc_message));
         }
         else
         {
-            // Add request to the queue
-            m_requests_queue.push(std::move(msg));
+            processCallCompletion(rpc_message);
         }
+    }
+}
 
-        ret = true;
+/** @brief Decode a CALL message from its header, the reader is positioned on the message type */
+bool RpcBase::decodeCall(ocpp::json::JsonReader& header, std::unique_ptr<char[]>& frame_buffer, size_t size)
+{
+    bool ret = false;
+
+    // Extract unique identifier and action
+    if (header.next() && header.IsString())
+    {
+        std::string unique_id(header.GetString(), header.GetStringLength());
+        if (header.next() && header.IsString())
+        {
+            // Payload is the end of the frame between the separator following the action
+            // and the closing bracket of the RPC array which is replaced by a null terminator
+            const char* action = header.GetString();
+            char*       frame  = frame_buffer.get();
+            size_t      start  = header.offset();
+            size_t      end    = size;
+            while ((start < end) && isJsonWhitespace(frame[start]))
+            {
+                start++;
+            }
+            while ((end > start) && isJsonWhitespace(frame[end - 1u]))
+            {
+                end--;
+            }
+            if ((start < end) && (frame[start] == ',') && (frame[end - 1u] == ']'))
+            {
+                frame[end - 1u] = 0;
+
+                // Create request
+                auto msg = std::make_shared<RpcMessage>(unique_id, action, frame_buffer, &frame[start + 1u]);
+
+                // Check if a pool has been configured
+                if (m_pool)
+                {
+                    // Add request to the pool
+                    if (!m_pool->dispatchRequest(m_rpc_owner, std::move(msg)))
+                    {
+                        // Too many pending requests
+                        sendCallError(unique_id, RPC_ERROR_INTERNAL, "Too many pending requests");
+                    }
+                }
+                else
+                {
+                    // Add request to the queue
+                    if (!m_requests_queue->push(std::move(msg)) && m_requests_queue->isEnabled())
+                    {
+                        // Too many pending requests
+                        sendCallError(unique_id, RPC_ERROR_INTERNAL, "Too many pending requests");
+                    }
+                }
+
+                ret = true;
+            }
+        }
     }
 
     return ret;
 }
 
 /** @brief Decode a CALLRESULT message */
-bool RpcBase::decodeCallResult(const std::string& unique_id, rapidjson::Document& rpc_frame, rapidjson::Value& payload)
+bool RpcBase::decodeCallResult(const std::string&       unique_id,
+                               std::unique_ptr<char[]>& frame_buffer,
+                               rapidjson::Document&     rpc_frame,
+                               rapidjson::Value&        payload)
 {
     bool ret = false;
 
     // Check types
     if (payload.IsObject())
     {
-        // Add result to the queue
-        auto msg = std::make_shared<RpcMessage>(unique_id, rpc_frame, payload);
-        m_results_queue.push(std::move(msg));
+        // Notify result
+        auto msg = std::make_shared<RpcMessage>(unique_id, frame_buffer, rpc_frame, payload);
+        processCallResponse(std::move(msg));
 
         ret = true;
     }
@@ -453,20 +778,21 @@ bool RpcBase::decodeCallResult(const std::string& unique_id, rapidjson::Document
 }
 
 /** @brief Decode a CALLERROR message */
-bool RpcBase::decodeCallError(const std::string&   unique_id,
-                              rapidjson::Document& rpc_frame,
-                              rapidjson::Value&    error,
-                              rapidjson::Value&    message,
-                              rapidjson::Value&    payload)
+bool RpcBase::decodeCallError(const std::string&       unique_id,
+                              std::unique_ptr<char[]>& frame_buffer,
+                              rapidjson::Document&     rpc_frame,
+                              rapidjson::Value&        error,
+                              rapidjson::Value&        message,
+                              rapidjson::Value&        payload)
 {
     bool ret = false;
 
     // Check types
     if (error.IsString() && message.IsString() && payload.IsObject())
     {
-        // Add error to the queue
-        auto msg = std::make_shared<RpcMessage>(unique_id, rpc_frame, payload, &error, &message);
-        m_results_queue.push(std::move(msg));
+        // Notify error
+        auto msg = std::make_shared<RpcMessage>(unique_id, frame_buffer, rpc_frame, payload, &error, &message);
+        processCallResponse(std::move(msg));
 
         ret = true;
     }
@@ -478,17 +804,17 @@ bool RpcBase::decodeCallError(const std::string&   unique_id,
 void RpcBase::sendCallError(const std::string& unique_id, const char* error, const std::string& message)
 {
     // Serialize message
-    std::stringstream serialized_message;
-    serialized_message << "[";
-    serialized_message << CALLERROR << ", ";
-    serialized_message << "\"" << unique_id << "\", ";
-    serialized_message << "\"" << error << "\", ";
-    serialized_message << "\"" << message << "\", ";
-    serialized_message << "{}";
-    serialized_message << "]";
+    ocpp::websockets::SendFrame msg = serializeMessage(MessageType::CALLERROR,
+                                                       unique_id,
+                                                       [error, &message](auto& writer)
+                                                       {
+                                                           writer.String(error);
+                                                           writer.String(message.c_str(), static_cast<rapidjson::SizeType>(message.size()));
+                                                           writer.StartObject();
+                                                           writer.EndObject();
+                                                       });
 
     // Send message
-    std::string msg = serialized_message.str();
     send(msg);
 }
 
@@ -497,10 +823,38 @@ void RpcBase::rxThread()
 {
     // Thread loop
     std::shared_ptr<RpcMessage> rpc_message;
-    while (m_requests_queue.pop(rpc_message))
+    bool                        running = true;
+    while (running)
     {
-        // Process request
-        processIncomingRequest(rpc_message);
+        // Wait for a message until the next asynchronous call deadline
+        auto         next_deadline = expirePendingCalls(*m_pending_calls, nullptr);
+        unsigned int timeout       = std::numeric_limits<unsigned int>::max();
+        if (next_deadline != std::chrono::steady_clock::time_point::max())
+        {
+            auto left_time = std::chrono::duration_cast<std::chrono::milliseconds>(next_deadline - std::chrono::steady_clock::now());
+            timeout        = static_cast<unsigned int>(std::max(left_time.count(), static_cast<decltype(left_time.count())>(0)));
+        }
+        if (m_requests_queue->pop(rpc_message, timeout))
+        {
+            if (rpc_message)
+            {
+                if (rpc_message->handler)
+                {
+                    // Process asynchronous call result
+                    processCallCompletion(rpc_message);
+                }
+                else
+                {
+                    // Process request
+                    processIncomingRequest(rpc_message);
+                }
+            }
+        }
+        else
+        {
+            // Timeout, wakeup for a new deadline or stop
+            running = m_requests_queue->isEnabled();
+        }
     }
 }
 
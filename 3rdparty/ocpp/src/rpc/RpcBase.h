@@ -20,12 +20,18 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #define OPENOCPP_RPCBASE_H
 
 #include "IRpc.h"
-#include "Queue.h"
+#include "JsonReader.h"
+#include "LockFreeQueue.h"
+#include "SendFrame.h"
 
+#include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <thread>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace ocpp
@@ -57,6 +63,12 @@ class RpcBase : public IRpc
               std::string&               message,
               std::chrono::milliseconds  timeout = std::chrono::seconds(2)) override;
 
+    /** @copydoc bool IRpc::callAsync(const std::string&, const rapidjson::Document&, CallCompletionHandler, std::chrono::milliseconds) */
+    bool callAsync(const std::string&         action,
+                   const rapidjson::Document& payload,
+                   CallCompletionHandler      handler,
+                   std::chrono::milliseconds  timeout = std::chrono::seconds(2)) override;
+
     /** @copydoc void IRpc::registerListener(IListener&) */
     void registerListener(IRpc::IListener& listener) override;
 
@@ -66,33 +78,63 @@ class RpcBase : public IRpc
     /** @copydoc void IRpc::unregisterSpy(ISpy&) */
     void unregisterSpy(IRpc::ISpy& spy) override;
 
-    /** @brief RPC message owner */
+    // Forward declaration
+    struct RpcMessage;
+
+    /** @brief RPC message owner, its requests are processed in order by at most one thread of the pool at a time */
     struct RpcMessageOwner
     {
         /** @brief Constructor */
-        RpcMessageOwner(RpcBase& _rpc_base) : rpc_base(_rpc_base), is_operational(true) { }
-        /** @brief Lock associated to the owner */
+        RpcMessageOwner(RpcBase& _rpc_base)
+            : lock(), rpc_base(_rpc_base), is_operational(true), requests_mutex(), requests(), scheduled(false)
+        {
+        }
+        /** @brief Lock associated to the owner, held while one of its requests is processed */
         std::mutex lock;
         /** @brief Underlying RPC handler */
         RpcBase& rpc_base;
         /** @brief Indicate if the owner is operational to handle the message */
         bool is_operational;
+        /** @brief Mutex for concurrent access to the pending requests */
+        std::mutex requests_mutex;
+        /** @brief Pending requests */
+        std::deque<std::shared_ptr<RpcMessage>> requests;
+        /** @brief Indicate if the owner is waiting in the run queue of the pool or is being processed */
+        bool scheduled;
     };
 
     /** @brief RPC message */
     struct RpcMessage
     {
-        RpcMessage(const std::string& _unique_id, const char* _action, rapidjson::Document& _rpc_frame, rapidjson::Value& _payload)
-            : unique_id(_unique_id), action(_action), rpc_frame(std::move(_rpc_frame)), payload(), error(), message()
+        RpcMessage(const std::string& _unique_id, const char* _action, std::unique_ptr<char[]>& _frame_buffer, char* _raw_payload)
+            : unique_id(_unique_id),
+              action(_action),
+              frame_buffer(std::move(_frame_buffer)),
+              raw_payload(_raw_payload),
+              rpc_frame(),
+              payload(),
+              error(),
+              message(),
+              handler(),
+              received(false)
         {
-            payload.Swap(_payload);
         }
-        RpcMessage(const std::string&   _unique_id,
-                   rapidjson::Document& _rpc_frame,
-                   rapidjson::Value&    _payload,
-                   rapidjson::Value*    _error   = nullptr,
-                   rapidjson::Value*    _message = nullptr)
-            : unique_id(_unique_id), action(), rpc_frame(std::move(_rpc_frame)), payload(), error(), message()
+        RpcMessage(const std::string&       _unique_id,
+                   std::unique_ptr<char[]>& _frame_buffer,
+                   rapidjson::Document&     _rpc_frame,
+                   rapidjson::Value&        _payload,
+                   rapidjson::Value*        _error   = nullptr,
+                   rapidjson::Value*        _message = nullptr)
+            : unique_id(_unique_id),
+              action(),
+              frame_buffer(std::move(_frame_buffer)),
+              raw_payload(nullptr),
+              rpc_frame(std::move(_rpc_frame)),
+              payload(),
+              error(),
+              message(),
+              handler(),
+              received(true)
         {
             payload.Swap(_payload);
             if (_error)
@@ -104,13 +146,63 @@ class RpcBase : public IRpc
                 message.Swap(*_message);
             }
         }
-        const std::string              unique_id;
-        const std::string              action;
-        rapidjson::Document            rpc_frame;
-        rapidjson::Value               payload;
-        rapidjson::Value               error;
-        rapidjson::Value               message;
-        std::weak_ptr<RpcMessageOwner> owner;
+        RpcMessage(const std::string& _unique_id, IRpc::CallCompletionHandler _handler, const char* _failure)
+            : unique_id(_unique_id),
+              action(),
+              frame_buffer(),
+              raw_payload(nullptr),
+              rpc_frame(),
+              payload(),
+              error(rapidjson::StringRef(_failure)),
+              message(),
+              handler(std::move(_handler)),
+              received(false)
+        {
+        }
+        const std::string       unique_id;
+        const std::string       action;
+        /** @brief Received frame buffer, parsed in-situ so the JSON strings of the frame are pointing into it */
+        std::unique_ptr<char[]> frame_buffer;
+        /** @brief Null terminated JSON payload of a CALL message, pointing into the frame buffer and parsed by the listener */
+        char*                   raw_payload;
+        rapidjson::Document     rpc_frame;
+        rapidjson::Value        payload;
+        rapidjson::Value        error;
+        rapidjson::Value        message;
+        /** @brief Completion handler when the message is the result of an asynchronous call */
+        IRpc::CallCompletionHandler handler;
+        /** @brief Indicate if a response has been received for the asynchronous call */
+        bool received;
+    };
+
+    /** @brief Pending call waiting for its response */
+    struct PendingCall
+    {
+        /** @brief Response deadline */
+        std::chrono::steady_clock::time_point deadline;
+        /** @brief Completion handler (asynchronous calls only) */
+        IRpc::CallCompletionHandler handler;
+        /** @brief Received response (synchronous calls only) */
+        std::shared_ptr<RpcMessage> response;
+        /** @brief Indicate if the call has completed (synchronous calls only) */
+        bool completed;
+    };
+
+    /** @brief Table of the pending calls of a connection indexed by message unique identifier */
+    struct PendingCalls
+    {
+        /** @brief Constructor */
+        PendingCalls() : mutex(), cond(), calls(), deadlines(), enabled(false) { }
+        /** @brief Mutex for concurrent access */
+        std::mutex mutex;
+        /** @brief Condition variable to wakeup synchronous callers */
+        std::condition_variable cond;
+        /** @brief Pending calls */
+        std::unordered_map<std::string, PendingCall> calls;
+        /** @brief Deadlines of the pending asynchronous calls with their message unique identifier, earliest first */
+        std::set<std::pair<std::chrono::steady_clock::time_point, std::string>> deadlines;
+        /** @brief Indicate if new calls can be registered */
+        bool enabled;
     };
 
     /** 
@@ -119,6 +211,29 @@ class RpcBase : public IRpc
      */
     void processIncomingRequest(std::shared_ptr<RpcMessage>& rpc_message);
 
+    /**
+     * @brief Notify the completion of an asynchronous call to its handler
+     * @param rpc_message Completed call
+     */
+    static void processCallCompletion(std::shared_ptr<RpcMessage>& rpc_message);
+
+    /**
+     * @brief Complete the asynchronous calls which have reached their deadline
+     * @param pending_calls Pending calls of a connection
+     * @param pool Pool which will execute the completion handlers, nullptr to execute them immediately
+     * @return Earliest deadline of the remaining asynchronous calls
+     */
+    static std::chrono::steady_clock::time_point expirePendingCalls(PendingCalls& pending_calls, RpcPool* pool);
+
+    /**
+     * @brief Complete an asynchronous call if it has reached its deadline
+     * @param pending_calls Pending calls of a connection
+     * @param unique_id Unique identifier of the call message
+     * @param pool Pool which will execute the completion handler
+     * @param force Complete the call even if its deadline has not been reached yet (pool is stopping)
+     */
+    static void expirePendingCall(PendingCalls& pending_calls, const std::string& unique_id, RpcPool* pool, bool force = false);
+
   protected:
     /** @brief Start RPC operations */
     void start();
@@ -126,17 +241,18 @@ class RpcBase : public IRpc
     void stop();
     /** @brief Process the websocket disconnection event */
     void processDisconnected();
-    /** @brief Process received data */
-    void processReceivedData(const void* data, size_t size);
+    /** @brief Process received data (the data buffer is parsed in-situ and kept alive by the decoded message,
+     *         only the header of the CALL messages is parsed, their payload is parsed by the listener) */
+    void processReceivedData(std::unique_ptr<char[]> data, size_t size);
     /** @brief Get the RPC listener */
     IRpc::IListener* rpcListener() { return m_rpc_listener; }
 
     /**
      * @brief Send data through the websocket connection
-     * @param msg Message to send
+     * @param frame Frame to send, the websocket takes the ownership of its buffer
      * @return true if the message has been sent, false otherwise
      */
-    virtual bool doSend(const std::string& msg) = 0;
+    virtual bool doSend(ocpp::websockets::SendFrame&& frame) = 0;
 
   private:
     /** @brief Message types */
@@ -155,36 +271,60 @@ class RpcBase : public IRpc
     /** @brief RPC spies */
     std::unordered_set<IRpc::ISpy*> m_spies;
     /** @brief Transaction id */
-    int m_transaction_id;
-    /** @brief Mutex for concurrent call access */
-    std::mutex m_call_mutex;
-    /** @brief Queue for incomming call requests */
-    ocpp::helpers::Queue<std::shared_ptr<RpcMessage>> m_requests_queue;
-    /** @brief Queue for incomming call results */
-    ocpp::helpers::Queue<std::shared_ptr<RpcMessage>> m_results_queue;
+    std::atomic<unsigned int> m_transaction_id;
+    /** @brief Queue for incomming call requests and asynchronous call results,
+     *         only allocated when no pool has been configured (processed by the reception thread) */
+    std::unique_ptr<ocpp::helpers::LockFreeQueue<std::shared_ptr<RpcMessage>>> m_requests_queue;
+    /** @brief Pending calls */
+    std::shared_ptr<PendingCalls> m_pending_calls;
     /** @brief Reception thread */
     std::thread* m_rx_thread;
     /** @brief RPC message owner */
     std::shared_ptr<RpcMessageOwner> m_rpc_owner;
 
     /** @brief Send a message through the websocket connection */
-    bool send(const std::string& msg);
+    bool send(ocpp::websockets::SendFrame& frame);
+
+    /** @brief Serialize a message directly inside a frame to send, the content is written after the message type and unique identifier */
+    template <typename ContentWriter>
+    static ocpp::websockets::SendFrame serializeMessage(MessageType type, const std::string& unique_id, ContentWriter write_content);
+
+    /** @brief Serialize a CALL message */
+    static ocpp::websockets::SendFrame serializeCall(const std::string&         unique_id,
+                                                     const std::string&         action,
+                                                     const rapidjson::Document& payload);
+
+    /** @brief Register a pending call */
+    bool registerCall(const std::string& unique_id, std::chrono::steady_clock::time_point deadline, IRpc::CallCompletionHandler handler);
+
+    /** @brief Match a received CALLRESULT or CALLERROR message with its pending call */
+    void processCallResponse(std::shared_ptr<RpcMessage>&& rpc_message);
+
+    /** @brief Remove an asynchronous call from the pending calls (pending calls mutex must be held) */
+    IRpc::CallCompletionHandler removeAsyncCall(std::unordered_map<std::string, PendingCall>::iterator it);
+
+    /**
+     * @brief Complete all the pending calls without response
+     * @param failure Failure cause given to the asynchronous calls handlers (IRpc::RPC_FAILURE_*)
+     */
+    void failPendingCalls(const char* failure);
 
-    /** @brief Decode a CALL message */
-    bool decodeCall(const std::string&      unique_id,
-                    rapidjson::Document&    rpc_frame,
-                    const rapidjson::Value& action,
-                    rapidjson::Value&       payload);
+    /** @brief Decode a CALL message from its header, the reader is positioned on the message type */
+    bool decodeCall(ocpp::json::JsonReader& header, std::unique_ptr<char[]>& frame_buffer, size_t size);
 
     /** @brief Decode a CALLRESULT message */
-    bool decodeCallResult(const std::string& unique_id, rapidjson::Document& rpc_frame, rapidjson::Value& payload);
+    bool decodeCallResult(const std::string&       unique_id,
+                          std::unique_ptr<char[]>& frame_buffer,
+                          rapidjson::Document&     rpc_frame,
+                          rapidjson::Value&        payload);
 
     /** @brief Decode a CALLERROR message */
-    bool decodeCallError(const std::string&   unique_id,
-                         rapidjson::Document& rpc_frame,
-                         rapidjson::Value&    error,
-                         rapidjson::Value&    message,
-                         rapidjson::Value&    payload);
+    bool decodeCallError(const std::string&       unique_id,
+                         std::unique_ptr<char[]>& frame_buffer,
+                         rapidjson::Document&     rpc_frame,
+                         rapidjson::Value&        error,
+                         rapidjson::Value&        message,
+                         rapidjson::Value&        payload);
 
     /** @brief Send a CALLERROR message */
     void sendCallError(const std::string& unique_id, const char* error, const std::string& message);
@@ -98,6 +98,12 @@ void RpcClient::registerClientListener(IListener& listener)
     m_listener = &listener;
 }
 
+/** @brief Get the permessage-deflate compression statistics of the websocket connection */
+ocpp::websockets::CompressionStats RpcClient::compressionStats() const
+{
+    return m_websocket.compressionStats();
+}
+
 // IRpc interface
 
 /** @copydoc bool IRpc::isConnected() */
@@ -132,20 +138,20 @@ void RpcClient::wsClientError()
     rpcListener()->rpcError();
 }
 
-/** @copydoc void IWebsocketClient::IListener::wsClientDataReceived(const void*, size_t) */
-void RpcClient::wsClientDataReceived(const void* data, size_t size)
+/** @copydoc void IWebsocketClient::IListener::wsClientDataReceived(std::unique_ptr<char[]>, size_t) */
+void RpcClient::wsClientDataReceived(std::unique_ptr<char[]> data, size_t size)
 {
     // Process data
-    processReceivedData(data, size);
+    processReceivedData(std::move(data), size);
 }
 
 // RpcBase interface
 
-/** @copydoc bool RpcBase::doSend(const std::string&) */
-bool RpcClient::doSend(const std::string& msg)
+/** @copydoc bool RpcBase::doSend(ocpp::websockets::SendFrame&&) */
+bool RpcClient::doSend(ocpp::websockets::SendFrame&& frame)
 {
     // Send message
-    return m_websocket.send(msg.c_str(), msg.size());
+    return m_websocket.send(std::move(frame));
 }
 
 } // namespace rpc
@@ -68,6 +68,12 @@ class RpcClient : public RpcBase, public ocpp::websockets::IWebsocketClient::ILi
      */
     void registerClientListener(IListener& listener);
 
+    /**
+     * @brief Get the permessage-deflate compression statistics of the websocket connection
+     * @return Compression statistics
+     */
+    ocpp::websockets::CompressionStats compressionStats() const;
+
     // IRpc interface
 
     /** @copydoc bool IRpc::isConnected() */
@@ -87,8 +93,8 @@ class RpcClient : public RpcBase, public ocpp::websockets::IWebsocketClient::ILi
     /** @copydoc void IWebsocketClient::IListener::wsClientError() */
     void wsClientError() override;
 
-    /** @copydoc void IWebsocketClient::IListener::wsClientDataReceived(const void*, size_t) */
-    void wsClientDataReceived(const void* data, size_t size) override;
+    /** @copydoc void IWebsocketClient::IListener::wsClientDataReceived(std::unique_ptr<char[]>, size_t) */
+    void wsClientDataReceived(std::unique_ptr<char[]> data, size_t size) override;
 
     /** @brief Interface for the RPC client listeners */
     class IListener
@@ -105,8 +111,8 @@ class RpcClient : public RpcBase, public ocpp::websockets::IWebsocketClient::ILi
     };
 
   protected:
-    /** @copydoc bool RpcBase::doSend(const std::string&) */
-    bool doSend(const std::string& msg) override;
+    /** @copydoc bool RpcBase::doSend(ocpp::websockets::SendFrame&&) */
+    bool doSend(ocpp::websockets::SendFrame&& frame) override;
 
   private:
     /** @brief Protocol version */
@@ -18,13 +18,18 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include "RpcPool.h"
 
+#include <functional>
+
 namespace ocpp
 {
 namespace rpc
 {
 
 /** @brief Constructor */
-RpcPool::RpcPool() : m_requests_queue(), m_pool(), m_waiters() { }
+RpcPool::RpcPool()
+    : m_jobs(), m_pool(), m_waiters(), m_deadlines_mutex(), m_deadlines_cond(), m_deadlines(), m_deadlines_running(false)
+{
+}
 
 /** @brief Destructor */
 RpcPool::~RpcPool()
@@ -43,37 +48,20 @@ bool RpcPool::start(unsigned int thread_count)
         // Check params
         if (thread_count > 0)
         {
-            // Instanciate the thread pool
-            m_pool = std::make_unique<ocpp::helpers::WorkerThreadPool>(thread_count);
+            // Instanciate the thread pool, with an extra thread for the calls deadlines
+            m_pool = std::make_unique<ocpp::helpers::WorkerThreadPool>(thread_count + 1u);
 
             // Enable message queue
-            m_requests_queue.setEnable(true);
+            m_jobs.setEnable(true);
+
+            // Start deadline processing
+            m_deadlines_running = true;
+            m_waiters.push_back(m_pool->run<void>(std::bind(&RpcPool::processDeadlines, this)));
 
             // Start threads
             for (unsigned int i = 0; i < thread_count; i++)
             {
-                auto waiter = m_pool->run<void>(
-                    [this]
-                    {
-                        // Wait for a message
-                        std::shared_ptr<RpcBase::RpcMessage> rpc_message;
-                        while (m_requests_queue.pop(rpc_message))
-                        {
-                            // Get owner
-                            auto owner = rpc_message->owner.lock();
-                            if (owner)
-                            {
-                                // Lock owner
-                                std::lock_guard<std::mutex> lock(owner->lock);
-                                if (owner->is_operational)
-                                {
-                                    // Process request
-                                    owner->rpc_base.processIncomingRequest(rpc_message);
-                                }
-                            }
-                        }
-                    });
-                m_waiters.push_back(std::move(waiter));
+                m_waiters.push_back(m_pool->run<void>(std::bind(&RpcPool::processJobs, this)));
             }
 
             ret = true;
@@ -92,7 +80,16 @@ bool RpcPool::stop()
     if (m_pool)
     {
         // Disable message queue
-        m_requests_queue.setEnable(false);
+        m_jobs.setEnable(false);
+
+        // Stop deadline processing
+        std::map<DeadlineKey, std::weak_ptr<RpcBase::PendingCalls>> deadlines;
+        {
+            std::lock_guard<std::mutex> lock(m_deadlines_mutex);
+            m_deadlines_running = false;
+            deadlines.swap(m_deadlines);
+            m_deadlines_cond.notify_all();
+        }
 
         // Wait for threads termination
         for (auto& waiter : m_waiters)
@@ -102,9 +99,36 @@ bool RpcPool::stop()
 
         // Release pool
         m_pool.reset();
+        m_waiters.clear();
+
+        // Fail the watched asynchronous calls since nothing will expire them anymore
+        // => the message queue is disabled so their completions are executed here
+        for (auto& deadline : deadlines)
+        {
+            auto pending_calls = deadline.second.lock();
+            if (pending_calls)
+            {
+                RpcBase::expirePendingCall(*pending_calls, std::get<2>(deadline.first), this, true);
+            }
+        }
 
-        // Flush queue
-        m_requests_queue.clear();
+        // Flush queue : execute the queued completions so that no handler is lost,
+        // the queued requests are dropped
+        Job job;
+        while (m_jobs.tryPop(job))
+        {
+            if (job.completion)
+            {
+                RpcBase::processCallCompletion(job.completion);
+            }
+            else
+            {
+                std::lock_guard<std::mutex> lock(job.owner->requests_mutex);
+                job.owner->requests.clear();
+                job.owner->scheduled = false;
+            }
+            job = Job();
+        }
 
         ret = true;
     }
@@ -112,5 +136,198 @@ bool RpcPool::stop()
     return ret;
 }
 
+/** @brief Queue an incoming request */
+bool RpcPool::dispatchRequest(const std::shared_ptr<RpcBase::RpcMessageOwner>& owner, std::shared_ptr<RpcBase::RpcMessage>&& rpc_message)
+{
+    bool ret = true;
+
+    // Add the request to the pending requests of its owner
+    bool do_schedule = false;
+    if (owner)
+    {
+        std::lock_guard<std::mutex> lock(owner->requests_mutex);
+        owner->requests.push_back(std::move(rpc_message));
+        if (!owner->scheduled)
+        {
+            owner->scheduled = true;
+            do_schedule      = true;
+        }
+    }
+
+    // Schedule the owner if it is not already waiting or being processed,
+    // the caller is never blocked : the request is rejected if the run queue is full
+    if (do_schedule && !m_jobs.push(Job{owner, nullptr}))
+    {
+        // Pool is not running or is overloaded, drop the requests
+        std::lock_guard<std::mutex> lock(owner->requests_mutex);
+        owner->requests.clear();
+        owner->scheduled = false;
+        ret              = !m_jobs.isEnabled();
+    }
+
+    return ret;
+}
+
+/** @brief Queue the completion of an asynchronous call */
+void RpcPool::dispatchCompletion(std::shared_ptr<RpcBase::RpcMessage>&& rpc_message)
+{
+    Job job{nullptr, std::move(rpc_message)};
+    if (!m_jobs.push(std::move(job)))
+    {
+        // Pool is not running or its run queue is full, notify the completion immediately
+        RpcBase::processCallCompletion(job.completion);
+    }
+}
+
+/** @brief Watch the deadline of an asynchronous call */
+void RpcPool::watchDeadline(const std::shared_ptr<RpcBase::PendingCalls>& pending_calls,
+                            const std::string&                            unique_id,
+                            std::chrono::steady_clock::time_point         deadline)
+{
+    std::lock_guard<std::mutex> lock(m_deadlines_mutex);
+    if (m_deadlines_running)
+    {
+        // Wakeup processing only if the deadline is the new earliest one
+        bool earliest = (m_deadlines.empty() || (deadline < std::get<0>(m_deadlines.begin()->first)));
+        m_deadlines[DeadlineKey(deadline, reinterpret_cast<uintptr_t>(pending_calls.get()), unique_id)] = pending_calls;
+        if (earliest)
+        {
+            m_deadlines_cond.notify_one();
+        }
+    }
+}
+
+/** @brief Stop watching the deadline of a completed asynchronous call */
+void RpcPool::cancelDeadline(const RpcBase::PendingCalls& pending_calls, const std::string& unique_id, std::chrono::steady_clock::time_point deadline)
+{
+    std::lock_guard<std::mutex> lock(m_deadlines_mutex);
+    m_deadlines.erase(DeadlineKey(deadline, reinterpret_cast<uintptr_t>(&pending_calls), unique_id));
+}
+
+/** @brief Worker thread loop */
+void RpcPool::processJobs()
+{
+    // Wait for a job
+    Job job;
+    while (m_jobs.pop(job))
+    {
+        // Check if it is an asynchronous call result
+        if (job.completion)
+        {
+            // Notify completion
+            RpcBase::processCallCompletion(job.completion);
+        }
+        else
+        {
+            // Process requests
+            processRequests(job.owner);
+        }
+
+        // Release the references before waiting for the next job
+        job = Job();
+    }
+}
+
+/** @brief Process the pending requests of an owner */
+void RpcPool::processRequests(const std::shared_ptr<RpcBase::RpcMessageOwner>& owner)
+{
+    bool pending = true;
+    while (pending)
+    {
+        // Process a limited number of requests to be fair with the other owners
+        unsigned int count = 0;
+        while (pending && (count < REQUESTS_BATCH_SIZE))
+        {
+            // Get the next request
+            std::shared_ptr<RpcBase::RpcMessage> rpc_message;
+            {
+                std::lock_guard<std::mutex> lock(owner->requests_mutex);
+                if (owner->requests.empty())
+                {
+                    owner->scheduled = false;
+                    pending          = false;
+                }
+                else
+                {
+                    rpc_message = std::move(owner->requests.front());
+                    owner->requests.pop_front();
+                }
+            }
+            if (rpc_message)
+            {
+                // Lock owner
+                std::lock_guard<std::mutex> lock(owner->lock);
+                if (owner->is_operational)
+                {
+                    // Process request
+                    owner->rpc_base.processIncomingRequest(rpc_message);
+                }
+                count++;
+            }
+        }
+
+        // Put the owner back at the end of the run queue if it still has pending requests
+        if (pending)
+        {
+            {
+                std::lock_guard<std::mutex> lock(owner->requests_mutex);
+                if (owner->requests.empty())
+                {
+                    owner->scheduled = false;
+                    pending          = false;
+                }
+            }
+
+            // If the run queue is full, keep on processing the owner instead of waiting
+            // for room since the workers must never wait on the run queue
+            pending = pending && !m_jobs.push(Job{owner, nullptr});
+        }
+    }
+}
+
+/** @brief Deadline processing loop */
+void RpcPool::processDeadlines()
+{
+    std::unique_lock<std::mutex> lock(m_deadlines_mutex);
+    while (m_deadlines_running)
+    {
+        if (m_deadlines.empty())
+        {
+            // Wait for a deadline
+            m_deadlines_cond.wait(lock);
+        }
+        else
+        {
+            // Wait for the earliest deadline
+            auto deadline = std::get<0>(m_deadlines.begin()->first);
+            if (m_deadlines_cond.wait_until(lock, deadline) == std::cv_status::timeout)
+            {
+                // Extract all the elapsed deadlines
+                auto                                                                   now = std::chrono::steady_clock::now();
+                std::vector<std::pair<std::weak_ptr<RpcBase::PendingCalls>, std::string>> elapsed;
+                while (!m_deadlines.empty() && (std::get<0>(m_deadlines.begin()->first) <= now))
+                {
+                    auto it = m_deadlines.begin();
+                    elapsed.emplace_back(std::move(it->second), std::get<2>(it->first));
+                    m_deadlines.erase(it);
+                }
+                lock.unlock();
+
+                // Complete the expired calls of the still alive connections
+                for (auto& call : elapsed)
+                {
+                    auto pending_calls = call.first.lock();
+                    if (pending_calls)
+                    {
+                        RpcBase::expirePendingCall(*pending_calls, call.second, this);
+                    }
+                }
+
+                lock.lock();
+            }
+        }
+    }
+}
+
 } // namespace rpc
 } // namespace ocpp
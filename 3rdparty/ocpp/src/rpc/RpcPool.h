@@ -22,6 +22,13 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "RpcBase.h"
 #include "WorkerThreadPool.h"
 
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
 #include <vector>
 
 namespace ocpp
@@ -47,21 +54,84 @@ class RpcPool
     bool start(unsigned int thread_count);
 
     /** 
-     * @brief Stop the pool
+     * @brief Stop the pool, the queued completions and the watched asynchronous calls are completed
+     *        on the calling thread (watched calls with a failure status)
      * @return true if the pool has been stopped, false otherwise
      */
     bool stop();
 
-    /** @brief Get the request queue for incoming calls */
-    ocpp::helpers::Queue<std::shared_ptr<RpcBase::RpcMessage>>& getRequestQueue() { return m_requests_queue; }
+    /**
+     * @brief Queue an incoming request, the requests of a same owner are processed in their reception order
+     *        and by at most one thread at a time so that the other threads remain available for the other owners
+     * @param owner Owner of the request
+     * @param rpc_message Request to process
+     * @return false if the request has been rejected because the run queue is full, true otherwise
+     */
+    bool dispatchRequest(const std::shared_ptr<RpcBase::RpcMessageOwner>& owner, std::shared_ptr<RpcBase::RpcMessage>&& rpc_message);
+
+    /**
+     * @brief Queue the completion of an asynchronous call, it is executed on the calling thread if the pool is not running
+     *        or if its run queue is full
+     * @param rpc_message Completed call
+     */
+    void dispatchCompletion(std::shared_ptr<RpcBase::RpcMessage>&& rpc_message);
+
+    /**
+     * @brief Watch the deadline of an asynchronous call
+     * @param pending_calls Pending calls of the connection which issued the call
+     * @param unique_id Unique identifier of the call message
+     * @param deadline Response deadline of the call
+     */
+    void watchDeadline(const std::shared_ptr<RpcBase::PendingCalls>& pending_calls,
+                       const std::string&                            unique_id,
+                       std::chrono::steady_clock::time_point         deadline);
+
+    /**
+     * @brief Stop watching the deadline of a completed asynchronous call
+     * @param pending_calls Pending calls of the connection which issued the call
+     * @param unique_id Unique identifier of the call message
+     * @param deadline Response deadline of the call
+     */
+    void cancelDeadline(const RpcBase::PendingCalls& pending_calls, const std::string& unique_id, std::chrono::steady_clock::time_point deadline);
+
+    /** @brief Maximum number of requests of an owner processed in a row before letting the other owners being processed */
+    static constexpr unsigned int REQUESTS_BATCH_SIZE = 4u;
+    /** @brief Maximum number of jobs in the run queue (each owner has at most one job in the queue) */
+    static constexpr size_t RUN_QUEUE_SIZE = 65536u;
 
   protected:
-    /** @brief Queue for incomming call requests */
-    ocpp::helpers::Queue<std::shared_ptr<RpcBase::RpcMessage>> m_requests_queue;
+    /** @brief Job executed by the threads of the pool */
+    struct Job
+    {
+        /** @brief Owner whose pending requests must be processed */
+        std::shared_ptr<RpcBase::RpcMessageOwner> owner;
+        /** @brief Completed asynchronous call to notify */
+        std::shared_ptr<RpcBase::RpcMessage> completion;
+    };
+
+    /** @brief Run queue of the jobs to execute */
+    ocpp::helpers::LockFreeQueue<Job, RUN_QUEUE_SIZE> m_jobs;
     /** @brief Thread pool to handle requests */
     std::unique_ptr<ocpp::helpers::WorkerThreadPool> m_pool;
     /** @brief Waiters to synchronize with the end of the processsing */
     std::vector<ocpp::helpers::Waiter<void>> m_waiters;
+    /** @brief Mutex for concurrent access to the deadlines */
+    std::mutex m_deadlines_mutex;
+    /** @brief Condition variable to wakeup the deadline processing */
+    std::condition_variable m_deadlines_cond;
+    /** @brief Deadline of an asynchronous call : deadline, connection and message unique identifier */
+    typedef std::tuple<std::chrono::steady_clock::time_point, uintptr_t, std::string> DeadlineKey;
+    /** @brief Deadlines of the asynchronous calls, earliest first */
+    std::map<DeadlineKey, std::weak_ptr<RpcBase::PendingCalls>> m_deadlines;
+    /** @brief Indicate if the deadline processing is running */
+    bool m_deadlines_running;
+
+    /** @brief Worker thread loop */
+    void processJobs();
+    /** @brief Process the pending requests of an owner */
+    void processRequests(const std::shared_ptr<RpcBase::RpcMessageOwner>& owner);
+    /** @brief Deadline processing loop */
+    void processDeadlines();
 };
 
 } // namespace rpc
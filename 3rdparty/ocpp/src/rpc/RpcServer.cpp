@@ -137,7 +137,7 @@ void RpcServer::wsServerError()
 
 /** @brief Constructor */
 RpcServer::Client::Client(std::shared_ptr<ocpp::websockets::IWebsocketServer::IClient> websocket, RpcPool& pool)
-    : RpcBase(&pool), m_websocket(websocket)
+    : RpcBase(&pool), m_websocket(websocket), m_writable_handler_mutex(), m_writable_handler()
 {
     // Start processing
     m_websocket->registerListener(*this);
@@ -166,6 +166,31 @@ bool RpcServer::Client::disconnect(bool notify_disconnected)
     return m_websocket->disconnect(notify_disconnected);
 }
 
+/** @brief Register the handler called when the connection can send data again */
+void RpcServer::Client::setWritableHandler(WritableHandler handler)
+{
+    std::lock_guard<std::mutex> lock(m_writable_handler_mutex);
+    m_writable_handler = std::move(handler);
+}
+
+/** @brief Get the number of frames which have been dropped by the websocket connection */
+uint64_t RpcServer::Client::droppedFramesCount() const
+{
+    return m_websocket->droppedFramesCount();
+}
+
+/** @brief Get the number of frames which have been deferred by the websocket connection */
+uint64_t RpcServer::Client::deferredFramesCount() const
+{
+    return m_websocket->deferredFramesCount();
+}
+
+/** @brief Get the permessage-deflate compression statistics of the websocket connection */
+ocpp::websockets::CompressionStats RpcServer::Client::compressionStats() const
+{
+    return m_websocket->compressionStats();
+}
+
 // IRpc interface
 
 /** @copydoc bool IRpc::isConnected() */
@@ -192,20 +217,37 @@ void RpcServer::Client::wsClientError()
     rpcListener()->rpcError();
 }
 
-/** @brief void IWebsocketServer::IClient::IListener::wsClientDataReceived(const void*, size_t) */
-void RpcServer::Client::wsClientDataReceived(const void* data, size_t size)
+/** @brief void IWebsocketServer::IClient::IListener::wsClientDataReceived(std::unique_ptr<char[]>, size_t) */
+void RpcServer::Client::wsClientDataReceived(std::unique_ptr<char[]> data, size_t size)
 {
     // Process data
-    processReceivedData(data, size);
+    processReceivedData(std::move(data), size);
+}
+
+/** @brief void IWebsocketServer::IClient::IListener::wsClientWritable() */
+void RpcServer::Client::wsClientWritable()
+{
+    // Notify handler
+    WritableHandler handler;
+    {
+        std::lock_guard<std::mutex> lock(m_writable_handler_mutex);
+        handler = m_writable_handler;
+    }
+    if (handler)
+    {
+        handler();
+    }
 }
 
 // RpxBase interface
 
-/** @copydoc bool RpcBase::doSend(const std::string&) */
-bool RpcServer::Client::doSend(const std::string& msg)
+/** @copydoc bool RpcBase::doSend(ocpp::websockets::SendFrame&&) */
+bool RpcServer::Client::doSend(ocpp::websockets::SendFrame&& frame)
 {
     // Send message
-    return m_websocket->send(msg.c_str(), msg.size());
+    // => A message rejected because the send queue is full is reported as a send failure,
+    //    the writable handler is notified when the queue has drained
+    return (m_websocket->send(std::move(frame)) == ocpp::websockets::IWebsocketServer::IClient::SendResult::SENT);
 }
 
 } // namespace rpc
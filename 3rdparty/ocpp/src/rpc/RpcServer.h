@@ -24,6 +24,9 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "RpcBase.h"
 #include "RpcPool.h"
 
+#include <functional>
+#include <mutex>
+
 namespace ocpp
 {
 namespace rpc
@@ -128,6 +131,9 @@ class RpcServer : public ocpp::websockets::IWebsocketServer::IListener
     class Client : public RpcBase, public ocpp::websockets::IWebsocketServer::IClient::IListener
     {
       public:
+        /** @brief Handler called when the connection can send data again after a send has been rejected because its send queue was full */
+        typedef std::function<void()> WritableHandler;
+
         /** @brief Constructor */
         Client(std::shared_ptr<ocpp::websockets::IWebsocketServer::IClient> websocket, RpcPool& pool);
         /** @brief Destructor */
@@ -146,6 +152,31 @@ class RpcServer : public ocpp::websockets::IWebsocketServer::IListener
          */
         bool disconnect(bool notify_disconnected = true);
 
+        /**
+         * @brief Register the handler called when the connection can send data again
+         *        after a send has been rejected because its send queue was full
+         * @param handler Handler to call (empty handler = no notification)
+         */
+        void setWritableHandler(WritableHandler handler);
+
+        /**
+         * @brief Get the number of frames which have been dropped by the websocket connection
+         * @return Number of dropped frames
+         */
+        uint64_t droppedFramesCount() const;
+
+        /**
+         * @brief Get the number of frames which have been deferred by the websocket connection
+         * @return Number of deferred frames
+         */
+        uint64_t deferredFramesCount() const;
+
+        /**
+         * @brief Get the permessage-deflate compression statistics of the websocket connection
+         * @return Compression statistics
+         */
+        ocpp::websockets::CompressionStats compressionStats() const;
+
         // IRpc interface
 
         /** @copydoc bool IRpc::isConnected() */
@@ -159,16 +190,23 @@ class RpcServer : public ocpp::websockets::IWebsocketServer::IListener
         /** @brief void IWebsocketServer::IClient::IListener::wsClientError() */
         void wsClientError() override;
 
-        /** @brief void IWebsocketServer::IClient::IListener::wsClientDataReceived(const void*, size_t) */
-        void wsClientDataReceived(const void* data, size_t size) override;
+        /** @brief void IWebsocketServer::IClient::IListener::wsClientDataReceived(std::unique_ptr<char[]>, size_t) */
+        void wsClientDataReceived(std::unique_ptr<char[]> data, size_t size) override;
+
+        /** @brief void IWebsocketServer::IClient::IListener::wsClientWritable() */
+        void wsClientWritable() override;
 
       protected:
-        /** @copydoc bool RpcBase::doSend(const std::string&) */
-        bool doSend(const std::string& msg) override;
+        /** @copydoc bool RpcBase::doSend(ocpp::websockets::SendFrame&&) */
+        bool doSend(ocpp::websockets::SendFrame&& frame) override;
 
       private:
         /** @brief Websocket connection */
         std::shared_ptr<ocpp::websockets::IWebsocketServer::IClient> m_websocket;
+        /** @brief Mutex for concurrent access to the writable handler */
+        std::mutex m_writable_handler_mutex;
+        /** @brief Handler called when the connection can send data again */
+        WritableHandler m_writable_handler;
     };
 
   private:
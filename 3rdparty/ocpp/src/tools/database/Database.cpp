@@ -20,33 +20,105 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "sqlite3.h"
 
 #include <cstring>
+#include <list>
+#include <unordered_map>
 
 namespace ocpp
 {
 namespace database
 {
 
+/** @brief Connection state shared between the database and its queries */
+struct Database::Context
+{
+    /** @brief Constructor */
+    Context()
+        : db(nullptr), wal(false), mutex(), transaction_depth(0), rollback_only(false), cache_mutex(), cache_size(0), cache(), cache_index()
+    {
+    }
+
+    /** @brief Database handle, nullptr once the database has been closed */
+    sqlite3* db;
+    /** @brief Indicate if the database is in WAL journal mode */
+    bool wal;
+
+    /** @brief Mutex to serialize the executions against the pending transaction */
+    std::recursive_mutex mutex;
+    /** @brief Nesting depth of the pending transaction */
+    unsigned int transaction_depth;
+    /** @brief Indicate if a nested transaction has been rolled back */
+    bool rollback_only;
+
+    /** @brief Mutex to protect concurrent accesses to the statement cache */
+    std::mutex cache_mutex;
+    /** @brief Maximum number of statements in the cache */
+    size_t cache_size;
+    /** @brief Cached statements, most recently used first */
+    std::list<std::pair<std::string, sqlite3_stmt*>> cache;
+    /** @brief Cached statements indexed by their SQL text */
+    std::unordered_map<std::string, std::list<std::pair<std::string, sqlite3_stmt*>>::iterator> cache_index;
+};
+
 /** @brief Constructor */
-Database::Database() : m_db(nullptr) { }
+Database::Database() : m_context(std::make_shared<Context>()) { }
 /** @brief Destructor */
 Database::~Database()
 {
     close();
 }
 
-/** @brief Open a database */
+/** @brief Open a database with the default settings */
 bool Database::open(const std::string& database_path)
+{
+    return open(database_path, Settings());
+}
+
+/** @brief Open a database */
+bool Database::open(const std::string& database_path, const Settings& settings)
 {
     bool ret = false;
 
     // Check if the database is opened
-    if (!m_db)
+    if (!m_context->db)
     {
         // Open database
-        if (sqlite3_open_v2(database_path.c_str(), &m_db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_FULLMUTEX, nullptr) ==
+        sqlite3* db = nullptr;
+        if (sqlite3_open_v2(database_path.c_str(), &db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_FULLMUTEX, nullptr) ==
             SQLITE_OK)
         {
-            ret = true;
+            // Apply settings, failures are not fatal : the database stays in its current mode
+            if (!settings.journal_mode.empty())
+            {
+                std::string pragma = "PRAGMA journal_mode=" + settings.journal_mode + ";";
+                sqlite3_exec(db, pragma.c_str(), nullptr, nullptr, nullptr);
+            }
+            if (!settings.synchronous.empty())
+            {
+                std::string pragma = "PRAGMA synchronous=" + settings.synchronous + ";";
+                sqlite3_exec(db, pragma.c_str(), nullptr, nullptr, nullptr);
+            }
+
+            // Check the resulting journal mode
+            sqlite3_stmt* stmt = nullptr;
+            if (sqlite3_prepare_v2(db, "PRAGMA journal_mode;", -1, &stmt, nullptr) == SQLITE_OK)
+            {
+                if (sqlite3_step(stmt) == SQLITE_ROW)
+                {
+                    const char* mode = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+                    m_context->wal   = (mode && (sqlite3_stricmp(mode, "wal") == 0));
+                }
+            }
+            sqlite3_finalize(stmt);
+
+            std::lock_guard<std::mutex> lock(m_context->cache_mutex);
+            m_context->cache_size = settings.statement_cache_size;
+            m_context->db         = db;
+            ret                   = true;
+        }
+        else
+        {
+            // Free resources
+            sqlite3_close_v2(db);
         }
     }
 
@@ -59,12 +131,37 @@ bool Database::close()
     bool ret = false;
 
     // Check if the database is opened
-    if (m_db)
+    std::shared_ptr<Context>              context = m_context;
+    std::lock_guard<std::recursive_mutex> lock(context->mutex);
+    if (context->db)
     {
+        // Release cached statements, queries still alive will finalize their statement on destruction
+        sqlite3* db = nullptr;
+        {
+            std::lock_guard<std::mutex> cache_lock(context->cache_mutex);
+            for (auto& cached : context->cache)
+            {
+                sqlite3_finalize(cached.second);
+            }
+            context->cache.clear();
+            context->cache_index.clear();
+            db          = context->db;
+            context->db = nullptr;
+        }
+
+        // Leave WAL mode so that the database file is self-contained
+        // (WAL and shared memory files are checkpointed and deleted)
+        if (context->wal)
+        {
+            sqlite3_exec(db, "PRAGMA journal_mode=DELETE;", nullptr, nullptr, nullptr);
+        }
+
         // Close and free resources
-        sqlite3_close_v2(m_db);
-        m_db = nullptr;
-        ret  = true;
+        sqlite3_close_v2(db);
+        ret = true;
+
+        // New connection state for the next opening
+        m_context = std::make_shared<Context>();
     }
 
     return ret;
@@ -75,15 +172,35 @@ std::unique_ptr<Database::Query> Database::query(const std::string& sql)
 {
     std::unique_ptr<Database::Query> query(nullptr);
 
+    // Look for a cached statement
+    sqlite3*      db   = nullptr;
+    sqlite3_stmt* stmt = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_context->cache_mutex);
+        db = m_context->db;
+
+        auto iter = m_context->cache_index.find(sql);
+        if (iter != m_context->cache_index.end())
+        {
+            stmt = iter->second->second;
+            m_context->cache.erase(iter->second);
+            m_context->cache_index.erase(iter);
+        }
+    }
+
     // Check if the database is opened
-    if (m_db)
+    if (stmt)
+    {
+        // Allocate new query
+        query = std::make_unique<Database::Query>(*this, m_context, stmt, sql);
+    }
+    else if (db)
     {
         // Create new statement
-        sqlite3_stmt* stmt = nullptr;
-        if (sqlite3_prepare_v2(m_db, sql.c_str(), static_cast<int>(sql.size()) + 1, &stmt, nullptr) == SQLITE_OK)
+        if (sqlite3_prepare_v2(db, sql.c_str(), static_cast<int>(sql.size()) + 1, &stmt, nullptr) == SQLITE_OK)
         {
             // Allocate new query
-            query = std::make_unique<Database::Query>(*this, stmt);
+            query = std::make_unique<Database::Query>(*this, m_context, stmt, sql);
         }
         else
         {
@@ -102,9 +219,9 @@ std::unique_ptr<Database::Query> Database::query(const std::string& sql)
 std::string Database::lastError() const
 {
     std::string error;
-    if (m_db)
+    if (m_context->db)
     {
-        error = sqlite3_errmsg(m_db);
+        error = sqlite3_errmsg(m_context->db);
     }
     return error;
 }
@@ -112,11 +229,41 @@ std::string Database::lastError() const
 // Database::Query
 
 /** @brief Constructor */
-Database::Query::Query(Database& database, sqlite3_stmt* stmt) : m_database(database), m_stmt(stmt), m_has_rows(false) { }
+Database::Query::Query(Database& database, const std::shared_ptr<Context>& context, sqlite3_stmt* stmt, const std::string& sql)
+    : m_database(database), m_context(context), m_stmt(stmt), m_sql(sql), m_has_rows(false)
+{
+}
 /** @brief Destructor */
 Database::Query::~Query()
 {
-    sqlite3_finalize(m_stmt);
+    bool cached = false;
+
+    // Give back the statement to the cache if the database is still opened
+    // and no other statement with the same SQL text is already cached
+    {
+        std::lock_guard<std::mutex> lock(m_context->cache_mutex);
+        if (m_context->db && (m_context->cache_size != 0) && (m_context->cache_index.find(m_sql) == m_context->cache_index.end()))
+        {
+            sqlite3_reset(m_stmt);
+            sqlite3_clear_bindings(m_stmt);
+            m_context->cache.emplace_front(m_sql, m_stmt);
+            m_context->cache_index[m_sql] = m_context->cache.begin();
+            cached                        = true;
+
+            // Evict the least recently used statement
+            if (m_context->cache.size() > m_context->cache_size)
+            {
+                auto& lru = m_context->cache.back();
+                sqlite3_finalize(lru.second);
+                m_context->cache_index.erase(lru.first);
+                m_context->cache.pop_back();
+            }
+        }
+    }
+    if (!cached)
+    {
+        sqlite3_finalize(m_stmt);
+    }
 }
 
 /** @brief Reset the query so it can be reused for another execution */
@@ -249,7 +396,8 @@ bool Database::Query::exec()
     m_has_rows = false;
 
     // Execute query
-    int result = sqlite3_step(m_stmt);
+    std::lock_guard<std::recursive_mutex> lock(m_context->mutex);
+    int                                   result = sqlite3_step(m_stmt);
     if (result == SQLITE_DONE)
     {
         ret = true;
@@ -265,6 +413,7 @@ bool Database::Query::exec()
 
     return ret;
 }
+
 /** @brief Indicate if the query result has rows to extract data */
 bool Database::Query::hasRows() const
 {
@@ -277,7 +426,8 @@ bool Database::Query::next()
     bool ret = false;
 
     // Execute next step
-    int result = sqlite3_step(m_stmt);
+    std::lock_guard<std::recursive_mutex> lock(m_context->mutex);
+    int                                   result = sqlite3_step(m_stmt);
     if (result == SQLITE_ROW)
     {
         ret = true;
@@ -358,5 +508,97 @@ std::string Database::Query::getString(int column) const
     return value;
 }
 
+// Database::Transaction
+
+/** @brief Constructor */
+Database::Transaction::Transaction(Database& database) : m_context(database.m_context), m_lock(m_context->mutex), m_active(false)
+{
+    // Check if the database is opened
+    if (m_context->db)
+    {
+        // Only the outermost transaction starts a new SQLite transaction
+        if (m_context->transaction_depth == 0)
+        {
+            if (sqlite3_exec(m_context->db, "BEGIN IMMEDIATE;", nullptr, nullptr, nullptr) == SQLITE_OK)
+            {
+                m_context->rollback_only = false;
+                m_active                 = true;
+            }
+        }
+        else
+        {
+            m_active = true;
+        }
+    }
+    if (m_active)
+    {
+        m_context->transaction_depth++;
+    }
+    else
+    {
+        m_lock.unlock();
+    }
+}
+
+/** @brief Destructor */
+Database::Transaction::~Transaction()
+{
+    end(false);
+}
+
+/** @brief Commit the transaction */
+bool Database::Transaction::commit()
+{
+    return end(true);
+}
+
+/** @brief Rollback the transaction */
+void Database::Transaction::rollback()
+{
+    end(false);
+}
+
+/** @brief End the transaction */
+bool Database::Transaction::end(bool commit)
+{
+    bool ret = false;
+
+    if (m_active)
+    {
+        m_active = false;
+        m_context->transaction_depth--;
+        if (!commit)
+        {
+            m_context->rollback_only = true;
+        }
+
+        if (m_context->transaction_depth == 0)
+        {
+            // Outermost transaction
+            if (m_context->db)
+            {
+                if (!m_context->rollback_only)
+                {
+                    ret = (sqlite3_exec(m_context->db, "COMMIT;", nullptr, nullptr, nullptr) == SQLITE_OK);
+                }
+                if (!ret)
+                {
+                    sqlite3_exec(m_context->db, "ROLLBACK;", nullptr, nullptr, nullptr);
+                }
+            }
+            m_context->rollback_only = false;
+        }
+        else
+        {
+            // Nested transaction, the outermost one decides
+            ret = commit;
+        }
+
+        m_lock.unlock();
+    }
+
+    return ret;
+}
+
 } // namespace database
 } // namespace ocpp
@@ -21,6 +21,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -37,8 +38,25 @@ namespace database
 class Database
 {
   public:
-    // Forward declaration
+    // Forward declarations
     class Query;
+    class Transaction;
+
+    /** @brief Database tuning settings applied when opening the database */
+    struct Settings
+    {
+        /** @brief Constructor with the default settings */
+        Settings() : journal_mode("WAL"), synchronous("FULL"), statement_cache_size(32u) { }
+
+        /** @brief Journal mode (PRAGMA journal_mode : DELETE, TRUNCATE, PERSIST, MEMORY, WAL, OFF),
+         *         empty to keep the SQLite default */
+        std::string journal_mode;
+        /** @brief Synchronization level (PRAGMA synchronous : OFF, NORMAL, FULL, EXTRA),
+         *         empty to keep the SQLite default */
+        std::string synchronous;
+        /** @brief Maximum number of prepared statements kept for reuse, 0 to disable the cache */
+        size_t statement_cache_size;
+    };
 
     /** @brief Constructor */
     Database();
@@ -46,12 +64,20 @@ class Database
     virtual ~Database();
 
     /**
-     * @brief Open a database
+     * @brief Open a database with the default settings
      * @param database_path Path to the database file
      * @return true if the database exists, false otherwise
      */
     bool open(const std::string& database_path);
 
+    /**
+     * @brief Open a database
+     * @param database_path Path to the database file
+     * @param settings Database tuning settings
+     * @return true if the database exists, false otherwise
+     */
+    bool open(const std::string& database_path, const Settings& settings);
+
     /**
      * @brief Close the database
      * @return true if the database exists, false otherwise
@@ -60,6 +86,8 @@ class Database
 
     /**
      * @brief Create a new query to be executed on the database
+     *        (the prepared statement is taken from the statement cache when available
+     *         and given back to it when the query is destroyed)
      * @param sql SQL query to execute
      * @return Created query object if the database is opened and the query is valid, nullptr otherwise
      */
@@ -71,12 +99,15 @@ class Database
      */
     std::string lastError() const;
 
+    /** @brief Connection state shared between the database and its queries */
+    struct Context;
+
     /** @brief Represent a query to be executed on the database */
     class Query
     {
       public:
         /** @brief Constructor */
-        Query(Database& database, sqlite3_stmt* stmt);
+        Query(Database& database, const std::shared_ptr<Context>& context, sqlite3_stmt* stmt, const std::string& sql);
         /** @brief Destructor */
         virtual ~Query();
 
@@ -252,15 +283,66 @@ class Database
       private:
         /** @brief Associated database */
         Database& m_database;
+        /** @brief Connection state */
+        std::shared_ptr<Context> m_context;
         /** @brief Statement handle */
         sqlite3_stmt* m_stmt;
+        /** @brief SQL text of the statement */
+        std::string m_sql;
         /** @brief Indicate if the query result has rows to extract data */
         bool m_has_rows;
     };
 
+    /**
+     * @brief Scoped transaction on the database : BEGIN IMMEDIATE on construction, ROLLBACK on destruction
+     *        if it has not been commited.
+     *        The database is reserved to the owning thread for the lifetime of the transaction,
+     *        queries from other threads wait for its end.
+     *        Nested transactions join the outermost one : a rollback of a nested transaction
+     *        makes the outermost one rollback on commit.
+     */
+    class Transaction
+    {
+      public:
+        /** @brief Constructor */
+        Transaction(Database& database);
+        /** @brief Destructor */
+        virtual ~Transaction();
+
+        // Non copyable
+        Transaction(const Transaction&)            = delete;
+        Transaction& operator=(const Transaction&) = delete;
+
+        /**
+         * @brief Indicate if the transaction has been started and is still pending
+         * @return true if the transaction is pending, false otherwise
+         */
+        bool isActive() const { return m_active; }
+
+        /**
+         * @brief Commit the transaction
+         * @return true if the changes have been commited (or will be commited by the outermost transaction), false otherwise
+         */
+        bool commit();
+
+        /** @brief Rollback the transaction */
+        void rollback();
+
+      private:
+        /** @brief Connection state */
+        std::shared_ptr<Context> m_context;
+        /** @brief Lock reserving the database for the transaction */
+        std::unique_lock<std::recursive_mutex> m_lock;
+        /** @brief Indicate if the transaction is pending */
+        bool m_active;
+
+        /** @brief End the transaction */
+        bool end(bool commit);
+    };
+
   private:
-    /** @brief Database handle */
-    sqlite3* m_db;
+    /** @brief Connection state */
+    std::shared_ptr<Context> m_context;
 };
 
 } // namespace database
@@ -57,6 +57,11 @@ class ITimerPool
      * @param timer Timer to register
      */
     virtual void registerTimer(Timer* timer) = 0;
+    /**
+     * @brief Unregister a timer from the timer pool
+     * @param timer Timer to unregister
+     */
+    virtual void unregisterTimer(Timer* timer) = 0;
     /** @brief Lock access to the timers */
     virtual void lock() = 0;
     /** @brief Unlock access to the timers */
@@ -0,0 +1,325 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef OPENOCPP_LOCKFREEQUEUE_H
+#define OPENOCPP_LOCKFREEQUEUE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+
+namespace ocpp
+{
+namespace helpers
+{
+
+/** @brief Bounded lock-free multi-producers / multi-consumers queue for inter-thread communication
+ *
+ *  Items are exchanged through a ring of slots whose sequence numbers tell the producers and the consumers
+ *  when a slot can be written or read, so that push and pop operations never take a lock.
+ *  The mutex and condition variable are only used to park the consumers waiting for an item :
+ *  the producers notify them only when at least one of them is parked.
+ *
+ *  It provides the same API as the Queue class.
+ */
+template <typename ItemType, size_t CAPACITY = 1024u>
+class LockFreeQueue
+{
+    static_assert((CAPACITY >= 2u) && ((CAPACITY & (CAPACITY - 1u)) == 0), "CAPACITY must be a power of 2");
+
+  public:
+    /** @brief Constructor */
+    LockFreeQueue()
+        : m_slots(new Slot[CAPACITY]),
+          m_enqueue_pos(0),
+          m_dequeue_pos(0),
+          m_enabled(true),
+          m_wakeup(false),
+          m_waiters(0),
+          m_mutex(),
+          m_cond_var()
+    {
+        for (size_t i = 0; i < CAPACITY; i++)
+        {
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+    /** @brief Destructor */
+    virtual ~LockFreeQueue() { }
+
+    /**
+     * @brief Get the maximum number of items in the queue
+     * @return Maximum number of items in the queue
+     */
+    size_t capacity() const { return CAPACITY; }
+
+    /**
+     * @brief Get the number of items in the queue
+     * @return Number of items in the queue
+     */
+    size_t size() const
+    {
+        size_t dequeue_pos = m_dequeue_pos.load(std::memory_order_acquire);
+        size_t enqueue_pos = m_enqueue_pos.load(std::memory_order_acquire);
+        return (enqueue_pos > dequeue_pos) ? (enqueue_pos - dequeue_pos) : 0;
+    }
+
+    /**
+     * @brief Indicate if the queue is empty
+     * @return true if the queue is empty, false otherwise
+     */
+    bool empty() const { return (size() == 0); }
+
+    /**
+     * @brief Indicate if the queue is full
+     * @return true if the queue is full, false otherwise
+     */
+    bool full() const { return (size() >= CAPACITY); }
+
+    /**
+     * @brief Get the number of items in the queue
+     * @return Number of items in the queue
+     */
+    size_t count() const { return size(); }
+
+    /**
+     * @brief Adds an item to the queue
+     * @param item Item to add
+     * @return true if the item has been added, false if the queue is disabled or if the maximum capacity has been reached
+     */
+    bool push(const ItemType& item)
+    {
+        ItemType copy(item);
+        return push(std::move(copy));
+    }
+
+    /**
+     * @brief Adds an item to the queue
+     * @param item Item to add, left unchanged if it has not been added
+     * @return true if the item has been added, false if the queue is disabled or if the maximum capacity has been reached
+     */
+    bool push(ItemType&& item)
+    {
+        bool ret = false;
+
+        // Reserve a free slot
+        size_t pos  = 0;
+        Slot*  slot = (m_enabled ? reserve(m_enqueue_pos, pos, 0) : nullptr);
+        if (slot)
+        {
+            // Add item
+            slot->item = std::move(item);
+            slot->sequence.store(pos + 1u, std::memory_order_release);
+
+            // Wakeup waiting thread
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (m_waiters.load(std::memory_order_relaxed) != 0)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_cond_var.notify_one();
+            }
+            ret = true;
+        }
+
+        return ret;
+    }
+
+    /**
+     * @brief Get an item from the queue
+     * @param item Item retrieved from the queue
+     * @param ms_timeout Max wait time in milliseconds
+     * @return true if the item has been retrieved, false if the timeout has been reached or on wakeup()
+     */
+    bool pop(ItemType& item, unsigned int ms_timeout = std::numeric_limits<unsigned int>::max())
+    {
+        bool ret = false;
+
+        if (m_enabled)
+        {
+            // Try without waiting
+            ret = tryPop(item);
+            if (!ret && (ms_timeout != 0) && !m_wakeup.exchange(false))
+            {
+                // Park until an item is available
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_waiters++;
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                m_cond_var.wait_for(lock,
+                                    std::chrono::milliseconds(ms_timeout),
+                                    [&] { return (!m_enabled || (ret = tryPop(item)) || m_wakeup.exchange(false)); });
+                m_waiters--;
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     * @brief Make a consumer return from pop() without adding an item to the queue,
+     *        if no consumer is waiting the next call to pop() returns immediately.
+     *        Unlike a push, it never fails when the queue is full.
+     */
+    void wakeup()
+    {
+        m_wakeup.store(true);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_waiters.load(std::memory_order_relaxed) != 0)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_cond_var.notify_one();
+        }
+    }
+
+    /**
+     * @brief Get an item from the queue without waiting, even if the queue is disabled
+     * @param item Item retrieved from the queue
+     * @return true if the item has been retrieved, false if the queue is empty
+     */
+    bool tryPop(ItemType& item)
+    {
+        bool ret = false;
+
+        // Reserve a filled slot
+        size_t pos  = 0;
+        Slot*  slot = reserve(m_dequeue_pos, pos, 1u);
+        if (slot)
+        {
+            // Retrieve item, the slot must not keep any reference on it
+            item       = std::move(slot->item);
+            slot->item = ItemType();
+            slot->sequence.store(pos + CAPACITY, std::memory_order_release);
+            ret = true;
+        }
+
+        return ret;
+    }
+
+    /** @brief Clear the contents of the queue */
+    void clear()
+    {
+        ItemType item;
+        while (tryPop(item))
+        {
+        }
+    }
+
+    /**
+     * @brief Update the state of the queue
+     * @param enabled If true messages can be received,
+     *                if false abort current waiting operation
+     *                and disable further message reception
+     */
+    void setEnable(bool enabled)
+    {
+        // Update state
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_enabled = enabled;
+        }
+
+        // Wakeup waiting threads
+        m_cond_var.notify_all();
+    }
+
+    /**
+     * @brief Indicate if the queue is enabled
+     * @return true if the queue is enabled, false otherwise
+     */
+    bool isEnabled() const { return m_enabled; }
+
+  private:
+    /** @brief Slot of the ring */
+    struct Slot
+    {
+        /** @brief Sequence number of the slot :
+         *         - equal to its position when it is free for a producer
+         *         - equal to its position + 1 when it holds an item for a consumer */
+        std::atomic<size_t> sequence;
+        /** @brief Item */
+        ItemType item;
+    };
+
+    /** @brief Ring of slots */
+    std::unique_ptr<Slot[]> m_slots;
+    /** @brief Position of the next slot to write */
+    alignas(64) std::atomic<size_t> m_enqueue_pos;
+    /** @brief Position of the next slot to read */
+    alignas(64) std::atomic<size_t> m_dequeue_pos;
+    /** @brief Indicate that the queue is enabled */
+    alignas(64) std::atomic<bool> m_enabled;
+    /** @brief Indicate that a consumer must return from pop() without item */
+    std::atomic<bool> m_wakeup;
+    /** @brief Number of parked consumers */
+    std::atomic<unsigned int> m_waiters;
+    /** @brief Mutex to park the consumers */
+    std::mutex m_mutex;
+    /** @brief Condition variable to park the consumers */
+    std::condition_variable m_cond_var;
+
+    /**
+     * @brief Reserve the slot at the given position
+     * @param position Position to advance (m_enqueue_pos for the producers, m_dequeue_pos for the consumers)
+     * @param pos Reserved position
+     * @param offset Offset of the sequence number of a slot available for the operation at its position
+     * @return Reserved slot, nullptr if the queue is full (producers) or empty (consumers)
+     */
+    Slot* reserve(std::atomic<size_t>& position, size_t& pos, size_t offset)
+    {
+        Slot* slot = nullptr;
+        bool  done = false;
+
+        pos = position.load(std::memory_order_relaxed);
+        while (!done)
+        {
+            Slot&     candidate = m_slots[pos & (CAPACITY - 1u)];
+            size_t    sequence  = candidate.sequence.load(std::memory_order_acquire);
+            ptrdiff_t diff      = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(pos + offset);
+            if (diff == 0)
+            {
+                // Slot is available, try to reserve it
+                if (position.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed))
+                {
+                    slot = &candidate;
+                    done = true;
+                }
+            }
+            else if (diff < 0)
+            {
+                // Queue is full or empty
+                done = true;
+            }
+            else
+            {
+                // Another thread has reserved the slot
+                pos = position.load(std::memory_order_relaxed);
+            }
+        }
+
+        return slot;
+    }
+};
+
+} // namespace helpers
+} // namespace ocpp
+
+#endif // OPENOCPP_LOCKFREEQUEUE_H
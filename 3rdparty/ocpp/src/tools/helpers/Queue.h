@@ -43,10 +43,24 @@ class Queue
     virtual ~Queue() { }
 
     /**
-     * @brief Get the size of the queue
-     * @return Size of the queue in number of items
+     * @brief Get the maximum number of items in the queue
+     * @return Maximum number of items in the queue
      */
-    size_t size() const { return MAX_SIZE; }
+    size_t capacity() const { return MAX_SIZE; }
+
+    /**
+     * @brief Get the number of items in the queue
+     * @return Number of items in the queue
+     */
+    size_t size() const
+    {
+        // Lock queue
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        // Get item count
+        size_t ret = m_queue.size();
+        return ret;
+    }
 
     /**
      * @brief Indicate if the queue is empty
@@ -201,6 +215,12 @@ class Queue
         m_cond_var.notify_all();
     }
 
+    /**
+     * @brief Indicate if the queue is enabled
+     * @return true if the queue is enabled, false otherwise
+     */
+    bool isEnabled() const { return m_enabled; }
+
   private:
     /** @brief Mutex for concurrent access */
     mutable std::mutex m_mutex;
@@ -32,7 +32,10 @@ Timer::Timer(ITimerPool& pool, const char* name)
       m_interval(std::chrono::milliseconds(0)),
       m_wake_up_time_point(std::chrono::time_point<std::chrono::steady_clock>::min()),
       m_started(false),
-      m_callback()
+      m_callback(),
+      m_heap_index(0),
+      m_name_entry(),
+      m_wakeup_pass(0)
 {
     m_pool.registerTimer(this);
 }
@@ -41,6 +44,7 @@ Timer::Timer(ITimerPool& pool, const char* name)
 Timer::~Timer()
 {
     stop();
+    m_pool.unregisterTimer(this);
 }
 
 /** @brief Start the timer with the specified interval */
@@ -20,7 +20,9 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #define OPENOCPP_TIMER_H
 
 #include <chrono>
+#include <cstddef>
 #include <functional>
+#include <list>
 #include <string>
 namespace ocpp
 {
@@ -118,6 +120,12 @@ class Timer
     bool m_started;
     /** @brief Callback */
     std::function<void()> m_callback;
+    /** @brief Position in the pool's heap of active timers (only used by the pool) */
+    size_t m_heap_index;
+    /** @brief Position in the pool's list of timers with the same name (only used by the pool) */
+    std::list<Timer*>::iterator m_name_entry;
+    /** @brief Last wakeup pass of the pool which has handled the timer (only used by the pool) */
+    unsigned int m_wakeup_pass;
 };
 
 } // namespace helpers
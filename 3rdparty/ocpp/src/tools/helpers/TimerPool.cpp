@@ -19,6 +19,8 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "TimerPool.h"
 #include "Timer.h"
 
+#include <algorithm>
+
 namespace ocpp
 {
 namespace helpers
@@ -33,7 +35,8 @@ TimerPool::TimerPool()
       m_wake_up_time_point(std::chrono::steady_clock::now() + std::chrono::hours(2400u)),
       m_thread(std::bind(&TimerPool::threadLoop, this)),
       m_timers(),
-      m_active_timers()
+      m_active_timers(),
+      m_wakeup_pass(0)
 {
 }
 
@@ -58,13 +61,10 @@ Timer* TimerPool::getTimer(const std::string& timer_name)
     Timer* timer = nullptr;
 
     std::lock_guard<std::mutex> lock(m_wakeup_mutex);
-    for (Timer* t : m_timers)
+    auto                        it = m_timers.find(timer_name);
+    if (it != m_timers.end())
     {
-        if (t->m_name == timer_name)
-        {
-            timer = t;
-            break;
-        }
+        timer = it->second.front();
     }
     return timer;
 }
@@ -90,27 +90,39 @@ void TimerPool::threadLoop()
         }
         else
         {
-            // Timer has elapsed
-            Timer* timer = m_active_timers.front();
-            if (timer->m_single_shot)
+            // Handle all the timers which have elapsed, a periodic timer which is late by more than one
+            // interval is handled at most once per pass : the pass ends when it comes back at the top
+            // of the heap and its next occurrences are handled by the following passes which start
+            // immediately since the wakeup time point has already elapsed
+            auto now = std::chrono::steady_clock::now();
+            m_wakeup_pass++;
+            while (!m_active_timers.empty() && (m_active_timers.front()->m_wake_up_time_point <= now) &&
+                   (m_active_timers.front()->m_wakeup_pass != m_wakeup_pass))
             {
-                // Single shot : remove timer from the list
-                m_active_timers.pop_front();
+                Timer* timer         = m_active_timers.front();
+                timer->m_wakeup_pass = m_wakeup_pass;
+                if (timer->m_single_shot)
+                {
+                    // Single shot : remove timer from the heap
+                    removeTimer(timer);
 
-                // Timer is now stopped
-                timer->m_started = false;
-            }
-            else
-            {
-                // Periodic : compute next wakeup time point
-                timer->m_wake_up_time_point += timer->m_interval;
+                    // Timer is now stopped
+                    timer->m_started = false;
+                }
+                else
+                {
+                    // Periodic : compute next wakeup time point
+                    timer->m_wake_up_time_point += timer->m_interval;
+                    heapSiftDown(0);
+                }
+
+                // Notify user, the callback may start, stop or destroy any timer
+                timer->m_callback();
             }
 
             // New wakeup time point
             computeNextWakeupTimepoint();
-
-            // Notify user
-            timer->m_callback();
+            m_update_wakeup_time = false;
         }
     }
 }
@@ -126,17 +138,90 @@ void TimerPool::computeNextWakeupTimepoint()
     }
     else
     {
-        // Re-order timer list
-        m_active_timers.sort([](const Timer* a, const Timer* b) { return (a->m_wake_up_time_point < b->m_wake_up_time_point); });
+        // First timer of the heap is the next to wakeup
         m_wake_up_time_point = m_active_timers.front()->m_wake_up_time_point;
     }
 }
 
-/** @copydoc void ITimerPool::addTimer(Timer*) */
+/** @brief Move a timer up in the heap until its parent wakes up before it */
+void TimerPool::heapSiftUp(size_t index)
+{
+    Timer* timer = m_active_timers[index];
+    while (index != 0)
+    {
+        size_t parent = (index - 1u) / 4u;
+        if (!(timer->m_wake_up_time_point < m_active_timers[parent]->m_wake_up_time_point))
+        {
+            break;
+        }
+        heapSet(index, m_active_timers[parent]);
+        index = parent;
+    }
+    heapSet(index, timer);
+}
+
+/** @brief Move a timer down in the heap until its children wake up after it */
+void TimerPool::heapSiftDown(size_t index)
+{
+    Timer* timer = m_active_timers[index];
+    size_t count = m_active_timers.size();
+    while (true)
+    {
+        // Earliest child
+        size_t first = 4u * index + 1u;
+        if (first >= count)
+        {
+            break;
+        }
+        size_t last     = std::min(first + 4u, count);
+        size_t earliest = first;
+        for (size_t child = first + 1u; child < last; child++)
+        {
+            if (m_active_timers[child]->m_wake_up_time_point < m_active_timers[earliest]->m_wake_up_time_point)
+            {
+                earliest = child;
+            }
+        }
+        if (!(m_active_timers[earliest]->m_wake_up_time_point < timer->m_wake_up_time_point))
+        {
+            break;
+        }
+        heapSet(index, m_active_timers[earliest]);
+        index = earliest;
+    }
+    heapSet(index, timer);
+}
+
+/** @brief Place a timer in the heap */
+void TimerPool::heapSet(size_t index, Timer* timer)
+{
+    m_active_timers[index] = timer;
+    timer->m_heap_index    = index;
+}
+
+/** @copydoc void ITimerPool::registerTimer(Timer*) */
 void TimerPool::registerTimer(Timer* timer)
 {
-    std::lock_guard<std::mutex> lock(m_wakeup_mutex);
-    m_timers.push_back(timer);
+    lock();
+    auto& timers        = m_timers[timer->m_name];
+    timer->m_name_entry = timers.insert(timers.end(), timer);
+    unlock();
+}
+
+/** @copydoc void ITimerPool::unregisterTimer(Timer*) */
+void TimerPool::unregisterTimer(Timer* timer)
+{
+    lock();
+    auto it = m_timers.find(timer->m_name);
+    if (it != m_timers.end())
+    {
+        it->second.erase(timer->m_name_entry);
+        if (it->second.empty())
+        {
+            m_timers.erase(it);
+        }
+    }
+    unlock();
 }
 
 /** @copydoc void ITimerPool::lock() */
@@ -160,6 +245,10 @@ void TimerPool::unlock()
 /** @copydoc void ITimerPool::addTimer(Timer*) */
 void TimerPool::addTimer(Timer* timer)
 {
+    // Add timer to the heap
+    m_active_timers.push_back(timer);
+    heapSiftUp(m_active_timers.size() - 1u);
+
     // Check if the timer shall wakeup before
     // next programmed wakeup timepoint
     if (timer->m_wake_up_time_point < m_wake_up_time_point)
@@ -168,24 +257,35 @@ void TimerPool::addTimer(Timer* timer)
         m_update_wakeup_time = true;
         m_wakeup_cond.notify_one();
     }
-
-    // Add timer to the list
-    m_active_timers.push_back(timer);
 }
 
 /** @copydoc void ITimerPool::removeTimer(Timer*) */
 void TimerPool::removeTimer(Timer* timer)
 {
     // Check if the timer is the next timer to wakeup
-    if (timer == m_active_timers.front())
+    size_t index = timer->m_heap_index;
+    if (index == 0)
     {
         // Trigger update of wakeup timepoint
         m_update_wakeup_time = true;
         m_wakeup_cond.notify_one();
     }
 
-    // Remove timer from the list
-    m_active_timers.remove(timer);
+    // Replace the timer by the last timer of the heap
+    Timer* last = m_active_timers.back();
+    m_active_timers.pop_back();
+    if (last != timer)
+    {
+        heapSet(index, last);
+        if ((index != 0) && (last->m_wake_up_time_point < m_active_timers[(index - 1u) / 4u]->m_wake_up_time_point))
+        {
+            heapSiftUp(index);
+        }
+        else
+        {
+            heapSiftDown(index);
+        }
+    }
 }
 
 } // namespace helpers
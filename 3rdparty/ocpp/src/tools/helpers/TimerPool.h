@@ -27,7 +27,10 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include <functional>
 #include <list>
 #include <mutex>
+#include <string>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace ocpp
 {
@@ -36,7 +39,12 @@ namespace helpers
 
 class Timer;
 
-/** @brief Handle a pool of timers */
+/** @brief Handle a pool of timers
+ *
+ *  Active timers are kept in a 4-ary min-heap ordered by wakeup time point, each timer
+ *  stores its position in the heap so that it can be started and stopped in O(log n).
+ *  All the timers which have elapsed at a wakeup are handled in the same pass.
+ */
 class TimerPool : public ITimerPool
 {
     friend class Timer;
@@ -66,18 +74,28 @@ class TimerPool : public ITimerPool
     std::chrono::time_point<std::chrono::steady_clock> m_wake_up_time_point;
     /** @brief Timers thread */
     std::thread m_thread;
-    /** @brief List of registered timers */
-    std::list<Timer*> m_timers;
-    /** @brief List of active timers */
-    std::list<Timer*> m_active_timers;
+    /** @brief Registered timers by name, in registration order */
+    std::unordered_map<std::string, std::list<Timer*>> m_timers;
+    /** @brief Heap of active timers */
+    std::vector<Timer*> m_active_timers;
+    /** @brief Number of the current wakeup pass */
+    unsigned int m_wakeup_pass;
 
     /** @brief Timers thread loop */
     void threadLoop();
     /** @brief Compute next wakeup time point */
     void computeNextWakeupTimepoint();
-
-    /** @copydoc void ITimerPool::addTimer(Timer*) */
+    /** @brief Move a timer up in the heap until its parent wakes up before it */
+    void heapSiftUp(size_t index);
+    /** @brief Move a timer down in the heap until its children wake up after it */
+    void heapSiftDown(size_t index);
+    /** @brief Place a timer in the heap */
+    void heapSet(size_t index, Timer* timer);
+
+    /** @copydoc void ITimerPool::registerTimer(Timer*) */
     void registerTimer(Timer* timer) override;
+    /** @copydoc void ITimerPool::unregisterTimer(Timer*) */
+    void unregisterTimer(Timer* timer) override;
     /** @copydoc void ITimerPool::lock() */
     void lock() override;
     /** @copydoc void ITimerPool::unlock() */
@@ -23,13 +23,32 @@ namespace ocpp
 namespace helpers
 {
 
+/** @brief Pool of the current worker thread */
+static thread_local const WorkerThreadPool* s_current_pool = nullptr;
+/** @brief Index of the current worker thread in its pool */
+static thread_local size_t s_current_index = 0;
+
 /** @brief Constructor */
-WorkerThreadPool::WorkerThreadPool(size_t thread_count) : m_stop(false), m_threads(), m_job_queue()
+WorkerThreadPool::WorkerThreadPool(size_t thread_count)
+    : m_stop(false),
+      m_queues(),
+      m_threads(),
+      m_next_queue(0),
+      m_pending(0),
+      m_sleeping(0),
+      m_sleep_mutex(),
+      m_sleep_cond()
 {
-    // Create thread
+    // Create queues before the threads since a thread can steal tasks from any queue
+    for (size_t i = 0; i < thread_count; i++)
+    {
+        m_queues.emplace_back(new WorkerQueue());
+    }
+
+    // Create threads
     for (size_t i = 0; i < thread_count; i++)
     {
-        m_threads.push_back(new std::thread(std::bind(&WorkerThreadPool::workerThread, this)));
+        m_threads.emplace_back(&WorkerThreadPool::workerThread, this, i);
     }
 }
 
@@ -37,35 +56,113 @@ WorkerThreadPool::WorkerThreadPool(size_t thread_count) : m_stop(false), m_threa
 WorkerThreadPool::~WorkerThreadPool()
 {
     // Stop threads
-    m_stop = true;
-    m_job_queue.setEnable(false);
+    {
+        std::lock_guard<std::mutex> lock(m_sleep_mutex);
+        m_stop = true;
+    }
+    m_sleep_cond.notify_all();
 
-    // Wait end of thread an release resources
-    for (std::thread* thread : m_threads)
+    // Wait end of thread, the tasks which have not been executed are released with the queues
+    for (std::thread& thread : m_threads)
     {
-        thread->join();
-        delete thread;
+        thread.join();
     }
 }
 
+/** @brief Add a task to a queue */
+void WorkerThreadPool::push(Task&& task)
+{
+    if (m_queues.empty())
+    {
+        return;
+    }
+
+    // A worker thread keeps its own tasks, the others are distributed
+    size_t index;
+    if (s_current_pool == this)
+    {
+        index = s_current_index;
+    }
+    else
+    {
+        index = m_next_queue.fetch_add(1u, std::memory_order_relaxed) % m_queues.size();
+    }
+    {
+        WorkerQueue&                queue = *m_queues[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+
+    // Wake up a sleeping thread
+    m_pending++;
+    if (m_sleeping != 0)
+    {
+        std::lock_guard<std::mutex> lock(m_sleep_mutex);
+        m_sleep_cond.notify_one();
+    }
+}
+
+/** @brief Get a task from the queue of a worker thread or steal it from the other queues */
+bool WorkerThreadPool::pop(size_t index, Task& task)
+{
+    bool ret = false;
+
+    for (size_t i = 0; (i < m_queues.size()) && !ret; i++)
+    {
+        WorkerQueue&                queue = *m_queues[(index + i) % m_queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty())
+        {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            ret = true;
+        }
+    }
+    if (ret)
+    {
+        m_pending--;
+    }
+
+    return ret;
+}
+
 /** @brief Worker thread */
-void WorkerThreadPool::workerThread()
+void WorkerThreadPool::workerThread(size_t index)
 {
-    std::shared_ptr<IJob> job;
+    s_current_pool  = this;
+    s_current_index = index;
+
+    Task task;
 
     // Thread loop
     while (!m_stop)
     {
-        // Wait for a job
-        if (m_job_queue.pop(job))
+        // Look for a job
+        if (pop(index, task))
         {
             // Execute job
-            job->run();
+            try
+            {
+                task();
+            }
+            catch (...)
+            {
+            }
 
             // Release resources
-            job.reset();
+            task.reset();
+        }
+        else
+        {
+            // Wait for a job
+            std::unique_lock<std::mutex> lock(m_sleep_mutex);
+            m_sleeping++;
+            m_sleep_cond.wait(lock, [this] { return (m_stop || (m_pending != 0)); });
+            m_sleeping--;
         }
     }
+
+    s_current_pool = nullptr;
 }
 
 } // namespace helpers
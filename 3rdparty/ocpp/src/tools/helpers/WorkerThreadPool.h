@@ -19,17 +19,18 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #ifndef OPENOCPP_WORKERTHREADPOOL_H
 #define OPENOCPP_WORKERTHREADPOOL_H
 
-#include "Queue.h"
-
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstddef>
+#include <deque>
 #include <functional>
-#include <list>
 #include <memory>
 #include <mutex>
-#include <optional>
+#include <new>
 #include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace ocpp
@@ -37,114 +38,191 @@ namespace ocpp
 namespace helpers
 {
 
-/** @brief Interface for job for a worker thread implementations */
-class IJob
-{
-  public:
-    /** @brief Destructor */
-    virtual ~IJob() { }
-    /** @brief Run the job */
-    virtual void run() = 0;
-};
-
-/** @brief Base class for a job for a worker thread */
-template <typename ReturnType>
-class JobBase : public IJob
+/** @brief Function to execute in a worker thread, small functions are stored without dynamic allocation */
+class Task
 {
   public:
-    /** @brief Constructor */
-    JobBase(const std::function<ReturnType()>& func) : success(true), end_of_job_mutex(), end_of_job_var(), end(false), function(func) { }
+    /** @brief Size of the storage for the functions stored without dynamic allocation */
+    static constexpr size_t INLINE_SIZE = 64u;
 
-    /** @brief Destructor */
-    virtual ~JobBase() { }
+    /** @brief Constructor for an empty task */
+    Task() noexcept : m_ops(nullptr) { }
 
-    /** @brief Indicate the job did execute without uncatched exception */
-    bool success;
-    /** @brief Mutex for end of job synchronization */
-    std::mutex end_of_job_mutex;
-    /** @brief Condition variable for end of job synchronization */
-    std::condition_variable end_of_job_var;
-    /** @brief Indicate end of job */
-    std::atomic<bool> end;
-    /** @brief Function to execute */
-    std::function<ReturnType()> function;
-};
-
-/** @brief Job for a worker thread */
-template <typename ReturnType>
-class Job : public JobBase<ReturnType>
-{
-    // Needed to protect instanciation outside of WorkerThreadPool class
-    friend class WorkerThreadPool;
-
-  public:
-    /** @brief Destructor */
-    virtual ~Job() { }
-
-    /** @brief Run the job */
-    void run() override
+    /** @brief Constructor from a function */
+    template <typename Func, typename = typename std::enable_if<!std::is_same<typename std::decay<Func>::type, Task>::value>::type>
+    Task(Func&& func) : m_ops(nullptr)
     {
-        try
+        using FuncType = typename std::decay<Func>::type;
+        if ((sizeof(FuncType) <= INLINE_SIZE) && (alignof(FuncType) <= alignof(std::max_align_t)) &&
+            std::is_nothrow_move_constructible<FuncType>::value)
         {
-            // Execute the job and store the returned value
-            ret_value = this->function();
+            new (m_storage) FuncType(std::forward<Func>(func));
+            m_ops = &InlineOps<FuncType>::ops;
         }
-        catch (...)
+        else
+        {
+            new (m_storage) FuncType*(new FuncType(std::forward<Func>(func)));
+            m_ops = &HeapOps<FuncType>::ops;
+        }
+    }
+
+    /** @brief Move constructor */
+    Task(Task&& other) noexcept : m_ops(other.m_ops)
+    {
+        if (m_ops)
         {
-            this->success = false;
+            m_ops->move(m_storage, other.m_storage);
+            other.m_ops = nullptr;
         }
+    }
 
-        // Notify end of job
+    /** @brief Move assignment */
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other)
         {
-            std::lock_guard<std::mutex> lock(this->end_of_job_mutex);
-            this->end = true;
+            reset();
+            m_ops = other.m_ops;
+            if (m_ops)
+            {
+                m_ops->move(m_storage, other.m_storage);
+                other.m_ops = nullptr;
+            }
         }
-        this->end_of_job_var.notify_all();
+        return *this;
     }
 
-    /** @brief Returned value */
-    ReturnType ret_value;
+    Task(const Task&)            = delete;
+    Task& operator=(const Task&) = delete;
+
+    /** @brief Destructor */
+    ~Task() { reset(); }
+
+    /** @brief Indicate if the task contains a function */
+    explicit operator bool() const { return (m_ops != nullptr); }
+
+    /** @brief Execute the function */
+    void operator()() { m_ops->invoke(m_storage); }
+
+    /** @brief Release the function */
+    void reset() noexcept
+    {
+        if (m_ops)
+        {
+            m_ops->destroy(m_storage);
+            m_ops = nullptr;
+        }
+    }
 
   private:
-    /** @brief Constructor */
-    Job(const std::function<ReturnType()>& func) : JobBase<ReturnType>(func), ret_value() { }
+    /** @brief Operations on the stored function */
+    struct Ops
+    {
+        /** @brief Execute the function */
+        void (*invoke)(void* storage);
+        /** @brief Move the function to another storage */
+        void (*move)(void* dst, void* src) noexcept;
+        /** @brief Destroy the function */
+        void (*destroy)(void* storage) noexcept;
+    };
+
+    /** @brief Operations on a function stored in the task */
+    template <typename FuncType>
+    struct InlineOps
+    {
+        static void invoke(void* storage) { (*static_cast<FuncType*>(storage))(); }
+        static void move(void* dst, void* src) noexcept
+        {
+            new (dst) FuncType(std::move(*static_cast<FuncType*>(src)));
+            static_cast<FuncType*>(src)->~FuncType();
+        }
+        static void destroy(void* storage) noexcept { static_cast<FuncType*>(storage)->~FuncType(); }
+        static constexpr Ops ops = {&invoke, &move, &destroy};
+    };
+
+    /** @brief Operations on a function allocated on the heap */
+    template <typename FuncType>
+    struct HeapOps
+    {
+        static void invoke(void* storage) { (**static_cast<FuncType**>(storage))(); }
+        static void move(void* dst, void* src) noexcept { new (dst) FuncType*(*static_cast<FuncType**>(src)); }
+        static void destroy(void* storage) noexcept { delete *static_cast<FuncType**>(storage); }
+        static constexpr Ops ops = {&invoke, &move, &destroy};
+    };
+
+    /** @brief Storage for the function or the pointer to the function */
+    alignas(std::max_align_t) unsigned char m_storage[INLINE_SIZE];
+    /** @brief Operations on the stored function (nullptr = empty task) */
+    const Ops* m_ops;
 };
 
-/** @brief Job for a worker thread without return value */
-template <>
-class Job<void> : public JobBase<void>
-{
-    // Needed to protect instanciation outside of WorkerThreadPool class
-    friend class WorkerThreadPool;
+template <typename FuncType>
+constexpr Task::Ops Task::InlineOps<FuncType>::ops;
+template <typename FuncType>
+constexpr Task::Ops Task::HeapOps<FuncType>::ops;
 
+/** @brief End of job notification, the waiting synchronization objects are only used if someone waits */
+class JobCompletion
+{
   public:
-    /** @brief Destructor */
-    virtual ~Job() { }
+    /** @brief Constructor */
+    JobCompletion() : m_done(false), m_waiters(0), m_mutex(), m_cond() { }
 
-    /** @brief Run the job */
-    void run() override
+    /** @brief Indicate if the job has ended */
+    bool done() const { return m_done.load(std::memory_order_acquire); }
+
+    /** @brief Notify the end of the job */
+    void notify()
     {
-        try
-        {
-            // Execute the job and store the returned value
-            this->function();
-        }
-        catch (...)
+        m_done.store(true);
+        if (m_waiters.load() != 0)
         {
-            this->success = false;
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_cond.notify_all();
         }
+    }
 
-        // Notify end of job
+    /** @brief Wait for the end of the job */
+    bool wait(std::chrono::milliseconds timeout)
+    {
+        bool ret = done();
+        if (!ret)
         {
-            std::lock_guard<std::mutex> lock(this->end_of_job_mutex);
-            this->end = true;
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_waiters++;
+            ret = m_cond.wait_for(lock, timeout, [this] { return m_done.load(); });
+            m_waiters--;
         }
-        this->end_of_job_var.notify_all();
+        return ret;
     }
 
   private:
-    /** @brief Constructor */
-    Job(const std::function<void()>& func) : JobBase<void>(func) { }
+    /** @brief Indicate end of job */
+    std::atomic<bool> m_done;
+    /** @brief Number of threads waiting for the end of the job */
+    std::atomic<unsigned int> m_waiters;
+    /** @brief Mutex for end of job synchronization */
+    std::mutex m_mutex;
+    /** @brief Condition variable for end of job synchronization */
+    std::condition_variable m_cond;
+};
+
+/** @brief State of a job shared between the worker thread and the waiter */
+template <typename ReturnType>
+struct JobState : public JobCompletion
+{
+    /** @brief Indicate the job did execute without uncatched exception */
+    bool success = true;
+    /** @brief Returned value */
+    ReturnType ret_value{};
+};
+
+/** @brief State of a job without return value shared between the worker thread and the waiter */
+template <>
+struct JobState<void> : public JobCompletion
+{
+    /** @brief Indicate the job did execute without uncatched exception */
+    bool success = true;
 };
 
 /** @brief Allow to wait on asynchronous execution of a function */
@@ -156,25 +234,20 @@ class Waiter
 
   public:
     /** @brief Get the returned value */
-    const ReturnType& value() const { return (dynamic_cast<Job<ReturnType>*>(m_job.get()))->ret_value; }
+    const ReturnType& value() const { return m_job->ret_value; }
 
     /** @brief Indicate the job did execute without uncatched exception */
-    bool success() { return (dynamic_cast<Job<ReturnType>*>(m_job.get()))->success; }
+    bool success() { return m_job->success; }
 
     /** @brief Wait for completion */
-    bool wait(std::chrono::milliseconds timeout = std::chrono::hours(24))
-    {
-        Job<ReturnType>*             job = dynamic_cast<Job<ReturnType>*>(m_job.get());
-        std::unique_lock<std::mutex> lock(job->end_of_job_mutex);
-        return job->end_of_job_var.wait_for(lock, timeout, [job] { return job->end.operator bool(); });
-    }
+    bool wait(std::chrono::milliseconds timeout = std::chrono::hours(24)) { return m_job->wait(timeout); }
 
   private:
     /** @brief Constructor */
-    Waiter(const std::shared_ptr<IJob>& job) : m_job(job) { }
+    Waiter(const std::shared_ptr<JobState<ReturnType>>& job) : m_job(job) { }
 
     /** @brief Associated job */
-    std::shared_ptr<IJob> m_job;
+    std::shared_ptr<JobState<ReturnType>> m_job;
 };
 
 /** @brief Allow to wait on asynchronous execution of a function withour return value */
@@ -186,25 +259,25 @@ class Waiter<void>
 
   public:
     /** @brief Indicate the job did execute without uncatched exception */
-    bool success() { return (dynamic_cast<Job<void>*>(m_job.get()))->success; }
+    bool success() { return m_job->success; }
 
     /** @brief Wait for completion */
-    bool wait(std::chrono::milliseconds timeout = std::chrono::hours(24))
-    {
-        Job<void>*                   job = dynamic_cast<Job<void>*>(m_job.get());
-        std::unique_lock<std::mutex> lock(job->end_of_job_mutex);
-        return job->end_of_job_var.wait_for(lock, timeout, [job] { return job->end.operator bool(); });
-    }
+    bool wait(std::chrono::milliseconds timeout = std::chrono::hours(24)) { return m_job->wait(timeout); }
 
   private:
     /** @brief Constructor */
-    Waiter(const std::shared_ptr<IJob>& job) : m_job(job) { }
+    Waiter(const std::shared_ptr<JobState<void>>& job) : m_job(job) { }
 
     /** @brief Associated job */
-    std::shared_ptr<IJob> m_job;
+    std::shared_ptr<JobState<void>> m_job;
 };
 
-/** @brief Handle a pool of worker threads */
+/** @brief Handle a pool of worker threads
+ *
+ *  Each worker thread owns a queue of tasks, the tasks posted from a worker thread go to its own queue
+ *  and the others are distributed between the queues. A worker thread without task steals the oldest
+ *  task of the other queues before going to sleep.
+ */
 class WorkerThreadPool
 {
   public:
@@ -220,30 +293,91 @@ class WorkerThreadPool
     template <typename ReturnType>
     Waiter<ReturnType> run(std::function<ReturnType()> func)
     {
-        // Create job
-        std::shared_ptr<IJob> job(new Job<ReturnType>(func));
+        // Create job state
+        auto job = std::make_shared<JobState<ReturnType>>();
 
         // Add the job to the queue
-        queue(job);
+        post(
+            [job, func = std::move(func)]
+            {
+                execute(*job, func);
+                job->notify();
+            });
 
         // Create the waiter object
         return Waiter<ReturnType>(job);
     }
 
-  protected:
-    /** @brief Add a job to the queue */
-    virtual void queue(const std::shared_ptr<IJob>& job) { m_job_queue.push(job); }
+    /** @brief Run a function in a worker thread without waiting for its completion */
+    template <typename Func>
+    void post(Func&& func)
+    {
+        push(Task(std::forward<Func>(func)));
+    }
+
+    /** @brief Get the number of worker threads */
+    size_t size() const { return m_threads.size(); }
 
   private:
+    /** @brief Queue of a worker thread */
+    struct WorkerQueue
+    {
+        /** @brief Mutex to protect the tasks */
+        std::mutex mutex;
+        /** @brief Tasks */
+        std::deque<Task> tasks;
+    };
+
     /** @brief Indicate that the threads must stop */
     std::atomic<bool> m_stop;
+    /** @brief Queues of the worker threads */
+    std::vector<std::unique_ptr<WorkerQueue>> m_queues;
     /** @brief Worker threads */
-    std::vector<std::thread*> m_threads;
-    /** @brief Job queue */
-    Queue<std::shared_ptr<IJob>> m_job_queue;
-
+    std::vector<std::thread> m_threads;
+    /** @brief Queue for the next task posted from outside the worker threads */
+    std::atomic<size_t> m_next_queue;
+    /** @brief Number of tasks waiting in the queues */
+    std::atomic<size_t> m_pending;
+    /** @brief Number of sleeping worker threads */
+    std::atomic<size_t> m_sleeping;
+    /** @brief Mutex for the sleeping worker threads */
+    std::mutex m_sleep_mutex;
+    /** @brief Condition variable to wake up the sleeping worker threads */
+    std::condition_variable m_sleep_cond;
+
+    /** @brief Add a task to a queue */
+    void push(Task&& task);
+    /** @brief Get a task from the queue of a worker thread or steal it from the other queues */
+    bool pop(size_t index, Task& task);
     /** @brief Worker thread */
-    void workerThread();
+    void workerThread(size_t index);
+
+    /** @brief Execute a job and store its returned value */
+    template <typename ReturnType>
+    static void execute(JobState<ReturnType>& job, const std::function<ReturnType()>& func)
+    {
+        try
+        {
+            job.ret_value = func();
+        }
+        catch (...)
+        {
+            job.success = false;
+        }
+    }
+
+    /** @brief Execute a job without return value */
+    static void execute(JobState<void>& job, const std::function<void()>& func)
+    {
+        try
+        {
+            func();
+        }
+        catch (...)
+        {
+            job.success = false;
+        }
+    }
 };
 
 } // namespace helpers
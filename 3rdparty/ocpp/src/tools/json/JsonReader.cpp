@@ -0,0 +1,338 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "JsonReader.h"
+
+namespace ocpp
+{
+namespace json
+{
+
+/** @brief Parse flags, the text is parsed in-situ so that the strings are not copied */
+static constexpr unsigned int PARSE_FLAGS = rapidjson::kParseInsituFlag;
+
+/** @brief Generator replaying the tokens of the current value to a DOM */
+struct JsonReader::DocumentGenerator
+{
+    /** @brief Constructor */
+    DocumentGenerator(JsonReader& _reader) : reader(_reader) { }
+
+    /** @brief Replay the tokens to the document */
+    bool operator()(rapidjson::Document& document)
+    {
+        bool   ret   = true;
+        size_t depth = 0;
+        do
+        {
+            switch (reader.m_token)
+            {
+                case Token::NULL_VALUE:
+                    ret = document.Null();
+                    break;
+                case Token::BOOL:
+                    ret = document.Bool(reader.m_bool);
+                    break;
+                case Token::INT:
+                    ret = document.Int(reader.m_int);
+                    break;
+                case Token::UINT:
+                    ret = document.Uint(reader.m_uint);
+                    break;
+                case Token::INT64:
+                    ret = document.Int64(reader.m_int64);
+                    break;
+                case Token::UINT64:
+                    ret = document.Uint64(reader.m_uint64);
+                    break;
+                case Token::DOUBLE:
+                    ret = document.Double(reader.m_double);
+                    break;
+                case Token::STRING:
+                    ret = document.String(reader.m_string, reader.m_length, false);
+                    break;
+                case Token::KEY:
+                    ret = document.Key(reader.m_string, reader.m_length, false);
+                    break;
+                case Token::START_OBJECT:
+                    ret = document.StartObject();
+                    depth++;
+                    break;
+                case Token::END_OBJECT:
+                    ret = document.EndObject(reader.m_length);
+                    depth--;
+                    break;
+                case Token::START_ARRAY:
+                    ret = document.StartArray();
+                    depth++;
+                    break;
+                case Token::END_ARRAY:
+                    ret = document.EndArray(reader.m_length);
+                    depth--;
+                    break;
+                case Token::NONE:
+                default:
+                    ret = false;
+                    break;
+            }
+        } while (ret && (depth != 0) && reader.next());
+
+        return ret && !reader.hasError();
+    }
+
+    /** @brief Reader */
+    JsonReader& reader;
+};
+
+/** @brief Constructor */
+JsonReader::JsonReader(char* text)
+    : m_stream(text),
+      m_reader(),
+      m_handler(*this),
+      m_token(Token::NONE),
+      m_bool(false),
+      m_int(0),
+      m_uint(0),
+      m_int64(0),
+      m_uint64(0),
+      m_double(0.),
+      m_string(""),
+      m_length(0),
+      m_key("")
+{
+    m_reader.IterativeParseInit();
+}
+
+/** @brief Destructor */
+JsonReader::~JsonReader() { }
+
+/** @brief Read the next token */
+bool JsonReader::next()
+{
+    bool ret = false;
+
+    m_token = Token::NONE;
+    if (!m_reader.IterativeParseComplete())
+    {
+        try
+        {
+            ret = m_reader.IterativeParseNext<PARSE_FLAGS>(m_stream, m_handler) && (m_token != Token::NONE);
+        }
+        catch (const std::exception&)
+        {
+        }
+    }
+
+    return ret;
+}
+
+/** @brief Read the next member of the current object and move to the first token of its value */
+bool JsonReader::nextMember()
+{
+    bool ret = next() && (m_token == Token::KEY);
+    if (ret)
+    {
+        m_key = m_string;
+        ret   = next();
+    }
+    return ret;
+}
+
+/** @brief Move to the first token of the next item of the current array */
+bool JsonReader::nextItem()
+{
+    return next() && (m_token != Token::END_ARRAY);
+}
+
+/** @brief Skip the current value, the reader is then positioned on its last token */
+bool JsonReader::skip()
+{
+    bool   ret   = true;
+    size_t depth = 0;
+    do
+    {
+        if ((m_token == Token::START_OBJECT) || (m_token == Token::START_ARRAY))
+        {
+            depth++;
+        }
+        else if ((m_token == Token::END_OBJECT) || (m_token == Token::END_ARRAY))
+        {
+            depth--;
+        }
+        if (depth != 0)
+        {
+            ret = next();
+        }
+    } while (ret && (depth != 0));
+
+    return ret;
+}
+
+/** @brief Build a DOM representation of the current value */
+bool JsonReader::parse(rapidjson::Document& document)
+{
+    DocumentGenerator generator(*this);
+    document.Populate(generator);
+    return !hasError() && !document.IsNull();
+}
+
+/** @brief Get the message associated to the parse error */
+std::string JsonReader::errorMessage() const
+{
+    std::string message;
+    if (hasError())
+    {
+        message = rapidjson::GetParseError_En(m_reader.GetParseErrorCode());
+        message += " (offset : ";
+        message += std::to_string(m_reader.GetErrorOffset());
+        message += ")";
+    }
+    else
+    {
+        message = "Unexpected end of JSON text";
+    }
+    return message;
+}
+
+/** @brief Get the current number value as a double */
+double JsonReader::GetDouble() const
+{
+    double value = 0.;
+    switch (m_token)
+    {
+        case Token::INT:
+            value = static_cast<double>(m_int);
+            break;
+        case Token::UINT:
+            value = static_cast<double>(m_uint);
+            break;
+        case Token::INT64:
+            value = static_cast<double>(m_int64);
+            break;
+        case Token::UINT64:
+            value = static_cast<double>(m_uint64);
+            break;
+        case Token::DOUBLE:
+        default:
+            value = m_double;
+            break;
+    }
+    return value;
+}
+
+// JsonReader::Handler
+
+bool JsonReader::Handler::Null()
+{
+    reader.m_token = Token::NULL_VALUE;
+    return true;
+}
+
+bool JsonReader::Handler::Bool(bool b)
+{
+    reader.m_token = Token::BOOL;
+    reader.m_bool  = b;
+    return true;
+}
+
+bool JsonReader::Handler::Int(int i)
+{
+    reader.m_token = Token::INT;
+    reader.m_int   = i;
+    return true;
+}
+
+bool JsonReader::Handler::Uint(unsigned u)
+{
+    reader.m_token = Token::UINT;
+    reader.m_uint  = u;
+    return true;
+}
+
+bool JsonReader::Handler::Int64(int64_t i)
+{
+    reader.m_token = Token::INT64;
+    reader.m_int64 = i;
+    return true;
+}
+
+bool JsonReader::Handler::Uint64(uint64_t u)
+{
+    reader.m_token  = Token::UINT64;
+    reader.m_uint64 = u;
+    return true;
+}
+
+bool JsonReader::Handler::Double(double d)
+{
+    reader.m_token  = Token::DOUBLE;
+    reader.m_double = d;
+    return true;
+}
+
+bool JsonReader::Handler::RawNumber(const char* str, rapidjson::SizeType length, bool copy)
+{
+    // Not used since the kParseNumbersAsStringsFlag is not set
+    return String(str, length, copy);
+}
+
+bool JsonReader::Handler::String(const char* str, rapidjson::SizeType length, bool copy)
+{
+    (void)copy;
+    reader.m_token  = Token::STRING;
+    reader.m_string = str;
+    reader.m_length = length;
+    return true;
+}
+
+bool JsonReader::Handler::Key(const char* str, rapidjson::SizeType length, bool copy)
+{
+    (void)copy;
+    reader.m_token  = Token::KEY;
+    reader.m_string = str;
+    reader.m_length = length;
+    return true;
+}
+
+bool JsonReader::Handler::StartObject()
+{
+    reader.m_token = Token::START_OBJECT;
+    return true;
+}
+
+bool JsonReader::Handler::EndObject(rapidjson::SizeType member_count)
+{
+    reader.m_token  = Token::END_OBJECT;
+    reader.m_length = member_count;
+    return true;
+}
+
+bool JsonReader::Handler::StartArray()
+{
+    reader.m_token = Token::START_ARRAY;
+    return true;
+}
+
+bool JsonReader::Handler::EndArray(rapidjson::SizeType element_count)
+{
+    reader.m_token  = Token::END_ARRAY;
+    reader.m_length = element_count;
+    return true;
+}
+
+} // namespace json
+} // namespace ocpp
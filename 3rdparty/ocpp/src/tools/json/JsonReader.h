@@ -0,0 +1,206 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_JSONREADER_H
+#define OPENOCPP_JSONREADER_H
+
+#include "json.h"
+
+#include <cstring>
+#include <limits>
+#include <string>
+
+namespace ocpp
+{
+namespace json
+{
+
+/** @brief Pull parser reading a JSON text token by token without building any DOM.
+ *         The text is parsed in-situ : it is modified while being read and must outlive the reader.
+ *         The accessors of the current value are named as their rapidjson::Value counterparts
+ *         so that the same conversion helpers can be used on both */
+class JsonReader
+{
+  public:
+    /**
+     * @brief Constructor
+     * @param text Null terminated JSON text to read
+     */
+    JsonReader(char* text);
+
+    /** @brief Destructor */
+    virtual ~JsonReader();
+
+    /**
+     * @brief Read the next token
+     * @return true if a token has been read, false on a parse error or at the end of the text
+     */
+    bool next();
+
+    /**
+     * @brief Read the next member of the current object and move to the first token of its value
+     * @return true if a member has been read, false at the end of the object or on a parse error
+     */
+    bool nextMember();
+
+    /**
+     * @brief Move to the first token of the next item of the current array
+     * @return true if an item has been read, false at the end of the array or on a parse error
+     */
+    bool nextItem();
+
+    /**
+     * @brief Skip the current value, the reader is then positioned on its last token
+     * @return true if the value has been skipped, false on a parse error
+     */
+    bool skip();
+
+    /**
+     * @brief Build a DOM representation of the current value, the reader is then positioned on its last token
+     *        (the strings of the DOM are pointing into the text)
+     * @param document Document to fill
+     * @return true if the document has been filled, false on a parse error
+     */
+    bool parse(rapidjson::Document& document);
+
+    /** @brief Offset in the text of the first character which has not been read yet */
+    size_t offset() const { return static_cast<size_t>(m_stream.src_ - m_stream.head_); }
+
+    /** @brief Indicate if a parse error has occured */
+    bool hasError() const { return m_reader.HasParseError(); }
+
+    /** @brief Get the message associated to the parse error */
+    std::string errorMessage() const;
+
+    /** @brief Indicate if the current member has the given name */
+    bool isMember(const char* name) const { return (strcmp(m_key, name) == 0); }
+
+    /** @brief Name of the current member */
+    const char* memberName() const { return m_key; }
+
+    /** @brief Indicate if the current value is null */
+    bool IsNull() const { return (m_token == Token::NULL_VALUE); }
+    /** @brief Indicate if the current value is a boolean */
+    bool IsBool() const { return (m_token == Token::BOOL); }
+    /** @brief Indicate if the current value is a number */
+    bool IsNumber() const { return (m_token >= Token::INT) && (m_token <= Token::DOUBLE); }
+    /** @brief Indicate if the current value is an integer */
+    bool IsInt() const
+    {
+        return (m_token == Token::INT) || ((m_token == Token::UINT) && (m_uint <= static_cast<unsigned int>(std::numeric_limits<int>::max())));
+    }
+    /** @brief Indicate if the current value is an unsigned integer */
+    bool IsUint() const { return (m_token == Token::UINT); }
+    /** @brief Indicate if the current value is a string */
+    bool IsString() const { return (m_token == Token::STRING); }
+    /** @brief Indicate if the current value is an object */
+    bool IsObject() const { return (m_token == Token::START_OBJECT); }
+    /** @brief Indicate if the current value is an array */
+    bool IsArray() const { return (m_token == Token::START_ARRAY); }
+
+    /** @brief Get the current boolean value */
+    bool GetBool() const { return m_bool; }
+    /** @brief Get the current integer value */
+    int GetInt() const { return (m_token == Token::INT) ? m_int : static_cast<int>(m_uint); }
+    /** @brief Get the current unsigned integer value */
+    unsigned int GetUint() const { return m_uint; }
+    /** @brief Get the current number value as a double */
+    double GetDouble() const;
+    /** @brief Get the current number value as a float */
+    float GetFloat() const { return static_cast<float>(GetDouble()); }
+    /** @brief Get the current string value */
+    const char* GetString() const { return m_string; }
+    /** @brief Get the length in bytes of the current string value */
+    rapidjson::SizeType GetStringLength() const { return m_length; }
+
+  private:
+    /** @brief JSON tokens */
+    enum class Token
+    {
+        NONE,
+        NULL_VALUE,
+        BOOL,
+        INT,
+        UINT,
+        INT64,
+        UINT64,
+        DOUBLE,
+        STRING,
+        KEY,
+        START_OBJECT,
+        END_OBJECT,
+        START_ARRAY,
+        END_ARRAY
+    };
+
+    /** @brief Handler storing the token emitted by the parser */
+    struct Handler
+    {
+        Handler(JsonReader& _reader) : reader(_reader) { }
+        bool Null();
+        bool Bool(bool b);
+        bool Int(int i);
+        bool Uint(unsigned u);
+        bool Int64(int64_t i);
+        bool Uint64(uint64_t u);
+        bool Double(double d);
+        bool RawNumber(const char* str, rapidjson::SizeType length, bool copy);
+        bool String(const char* str, rapidjson::SizeType length, bool copy);
+        bool Key(const char* str, rapidjson::SizeType length, bool copy);
+        bool StartObject();
+        bool EndObject(rapidjson::SizeType member_count);
+        bool StartArray();
+        bool EndArray(rapidjson::SizeType element_count);
+        JsonReader& reader;
+    };
+
+    /** @brief Generator replaying the tokens of the current value to a DOM */
+    struct DocumentGenerator;
+
+    /** @brief Input stream */
+    rapidjson::InsituStringStream m_stream;
+    /** @brief Underlying parser */
+    rapidjson::Reader m_reader;
+    /** @brief Handler of the parser */
+    Handler m_handler;
+    /** @brief Current token */
+    Token m_token;
+    /** @brief Current boolean value */
+    bool m_bool;
+    /** @brief Current integer value */
+    int m_int;
+    /** @brief Current unsigned integer value */
+    unsigned int m_uint;
+    /** @brief Current 64 bits integer value */
+    int64_t m_int64;
+    /** @brief Current 64 bits unsigned integer value */
+    uint64_t m_uint64;
+    /** @brief Current double value */
+    double m_double;
+    /** @brief Current string value */
+    const char* m_string;
+    /** @brief Length of the current string value */
+    rapidjson::SizeType m_length;
+    /** @brief Name of the current member */
+    const char* m_key;
+};
+
+} // namespace json
+} // namespace ocpp
+
+#endif // OPENOCPP_JSONREADER_H
@@ -26,7 +26,7 @@ namespace json
 {
 
 /** @brief Constructor */
-JsonValidator::JsonValidator() : m_schema(nullptr), m_last_error() { }
+JsonValidator::JsonValidator() : m_schema(nullptr), m_last_error(), m_validators_mutex(), m_validators() { }
 
 /** @brief Destructor */
 JsonValidator::~JsonValidator() { }
@@ -49,6 +49,8 @@ bool JsonValidator::init(const std::string& schema_file)
         if (error == rapidjson::ParseErrorCode ::kParseErrorNone)
         {
             // Instanciate validator
+            // => Validators from the pool are bound to the previous schema
+            m_validators.clear();
             m_schema     = std::make_unique<rapidjson::SchemaDocument>(schema_doc);
             m_last_error = "";
             ret          = true;
@@ -67,24 +69,41 @@ bool JsonValidator::init(const std::string& schema_file)
 }
 
 /** @brief Validate a JSON document according to the schema file */
-bool JsonValidator::isValid(const rapidjson::Value& json_document)
+bool JsonValidator::isValid(const rapidjson::Value& json_document, std::string& error)
 {
     bool ret = false;
 
-    // Instanciate validator
-    rapidjson::SchemaValidator validator(*(m_schema.get()));
+    // Get a validator from the pool or instanciate a new one
+    std::unique_ptr<rapidjson::SchemaValidator> validator;
+    {
+        std::lock_guard<std::mutex> lock(m_validators_mutex);
+        if (!m_validators.empty())
+        {
+            validator = std::move(m_validators.back());
+            m_validators.pop_back();
+        }
+    }
+    if (!validator)
+    {
+        validator = std::make_unique<rapidjson::SchemaValidator>(*(m_schema.get()));
+    }
 
     // Validate document
-    ret = json_document.Accept(validator);
+    ret = json_document.Accept(*validator);
     if (!ret)
     {
-        m_last_error = GetValidateError_En(validator.GetInvalidSchemaCode());
+        error = GetValidateError_En(validator->GetInvalidSchemaCode());
     }
 
+    // Give back the validator to the pool
+    validator->Reset();
+    std::lock_guard<std::mutex> lock(m_validators_mutex);
+    m_validators.push_back(std::move(validator));
+
     return ret;
 }
 
-/** @brief Get the last error message */
+/** @brief Get the last initialization error message */
 const std::string& JsonValidator::lastError() const
 {
     return m_last_error;
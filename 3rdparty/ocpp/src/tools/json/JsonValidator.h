@@ -22,14 +22,16 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "json.h"
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 namespace ocpp
 {
 namespace json
 {
 
-/** @brief Helper class to validate JSON schemas */
+/** @brief Helper class to validate JSON schemas, the validation can be done concurrently from multiple threads */
 class JsonValidator
 {
   public:
@@ -42,17 +44,26 @@ class JsonValidator
     /** @brief Initialize the validator with a specific JSON schema file */
     bool init(const std::string& schema_file);
 
-    /** @brief Validate a JSON document according to the schema file */
-    bool isValid(const rapidjson::Value& json_document);
+    /**
+     * @brief Validate a JSON document according to the schema file
+     * @param json_document JSON document to validate
+     * @param error Error message if the document is not valid
+     * @return true if the document is valid, false otherwise
+     */
+    bool isValid(const rapidjson::Value& json_document, std::string& error);
 
-    /** @brief Get the last error message */
+    /** @brief Get the last initialization error message */
     const std::string& lastError() const;
 
   private:
     /** @brief Schema document */
     std::unique_ptr<rapidjson::SchemaDocument> m_schema;
-    /** @brief Last error message */
+    /** @brief Last initialization error message */
     std::string m_last_error;
+    /** @brief Mutex to protect the pool of schema validators */
+    std::mutex m_validators_mutex;
+    /** @brief Pool of schema validators ready to be reused */
+    std::vector<std::unique_ptr<rapidjson::SchemaValidator>> m_validators;
 };
 
 } // namespace json
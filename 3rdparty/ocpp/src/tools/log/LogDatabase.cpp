@@ -17,7 +17,9 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "LogDatabase.h"
+#include "FilenameMacro.h"
 
+#include <functional>
 #include <sstream>
 
 using namespace ocpp::database;
@@ -29,31 +31,83 @@ namespace log
 
 /** @brief Constructor */
 LogDatabase::LogDatabase(ocpp::database::Database& database, const std::string& table_name, unsigned int max_entries)
-    : m_database(database), m_insert_query()
+    : m_database(database),
+      m_max_entries(max_entries),
+      m_entries(),
+      m_dropped_count(0),
+      m_reported_dropped_count(0),
+      m_next_seq(0),
+      m_stop(false),
+      m_wakeup_mutex(),
+      m_wakeup_cond(),
+      m_thread(),
+      m_insert_query()
 {
-    initDatabaseTable(table_name, max_entries);
+    initDatabaseTable(table_name);
+
+    // Start the writer thread
+    if (m_insert_query && (m_max_entries != 0))
+    {
+        m_thread = std::thread(std::bind(&LogDatabase::threadLoop, this));
+    }
 }
 
 /** @brief Destructor */
-LogDatabase::~LogDatabase() { }
+LogDatabase::~LogDatabase()
+{
+    // Stop thread, the pending entries are written before it exits
+    if (m_thread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_wakeup_mutex);
+            m_stop = true;
+        }
+        m_wakeup_cond.notify_one();
+        m_thread.join();
+    }
+}
 
 /** @brief Add a log entry */
 void LogDatabase::log(std::time_t timestamp, unsigned int level, const std::string& file, const std::string& message)
 {
-    if (m_insert_query)
+    if (m_thread.joinable())
     {
-        m_insert_query->bind(0, static_cast<int64_t>(timestamp));
-        m_insert_query->bind(1, level);
-        m_insert_query->bind(2, file);
-        m_insert_query->bind(3, message);
-        m_insert_query->exec();
-        m_insert_query->reset();
+        // Hand over the entry to the writer thread
+        Entry entry;
+        entry.timestamp = timestamp;
+        entry.level     = level;
+        entry.file      = file;
+        entry.message   = message;
+        if (!m_entries.push(std::move(entry)))
+        {
+            // Queue is full
+            m_dropped_count++;
+        }
+        else if (m_entries.size() >= (QUEUE_SIZE / 2u))
+        {
+            // Wake up the writer thread before the queue gets full
+            m_wakeup_cond.notify_one();
+        }
     }
 }
 
 /** @brief Initialize the database table */
-void LogDatabase::initDatabaseTable(const std::string& table_name, unsigned int max_entries)
+void LogDatabase::initDatabaseTable(const std::string& table_name)
 {
+    // Check if the table has been created with the previous layout (count based retention trigger)
+    bool migrate = false;
+    auto query   = m_database.query("SELECT [seq] FROM " + table_name + " LIMIT 1;");
+    if (!query)
+    {
+        query = m_database.query("DROP TRIGGER IF EXISTS delete_oldest_" + table_name + ";");
+        if (query)
+        {
+            query->exec();
+        }
+        query   = m_database.query("ALTER TABLE " + table_name + " RENAME TO " + table_name + "_old;");
+        migrate = (query && query->exec());
+    }
+
     // Create database
     std::stringstream create_query;
     create_query << "CREATE TABLE IF NOT EXISTS " << table_name
@@ -63,27 +117,130 @@ void LogDatabase::initDatabaseTable(const std::string& table_name, unsigned int
                     "[level] INT UNSIGNED,"
                     "[file] VARCHAR(64),"
                     "[message] VARCHAR(1024),"
-                    "PRIMARY KEY([id] AUTOINCREMENT));";
-    auto query = m_database.query(create_query.str());
-    if (query.get())
+                    "[seq] BIGINT,"
+                    "PRIMARY KEY([id]));";
+    query = m_database.query(create_query.str());
+    if (query)
     {
         query->exec();
     }
-    std::stringstream trigger_query;
-    trigger_query << "CREATE TRIGGER delete_oldest_" << table_name << " AFTER INSERT ON " << table_name << " WHEN ((SELECT count() FROM "
-                  << table_name << ") > " << max_entries << ") BEGIN DELETE FROM " << table_name << " WHERE ROWID IN (SELECT ROWID FROM "
-                  << table_name << " LIMIT 1);END;";
-    query = m_database.query(trigger_query.str());
-    if (query.get())
+
+    if (m_max_entries != 0)
     {
-        query->exec();
+        // Keep the most recent entries of the previous layout
+        if (migrate)
+        {
+            std::stringstream migrate_query;
+            migrate_query << "INSERT OR IGNORE INTO " << table_name << " SELECT ([id] % " << m_max_entries
+                          << "), [timestamp], [level], [file], [message], [id] FROM " << table_name << "_old ORDER BY [id] DESC LIMIT "
+                          << m_max_entries << ";";
+            query = m_database.query(migrate_query.str());
+            if (query)
+            {
+                query->exec();
+            }
+        }
+
+        // Remove the entries which are out of the ring if the maximum number of entries has been reduced
+        std::stringstream delete_query;
+        delete_query << "DELETE FROM " << table_name << " WHERE [id] >= " << m_max_entries << ";";
+        query = m_database.query(delete_query.str());
+        if (query)
+        {
+            query->exec();
+        }
+    }
+    if (migrate)
+    {
+        query = m_database.query("DROP TABLE " + table_name + "_old;");
+        if (query)
+        {
+            query->exec();
+        }
+    }
+
+    // Restart the sequence after the most recent entry
+    query = m_database.query("SELECT MAX([seq]) FROM " + table_name + ";");
+    if (query && query->exec() && query->hasRows() && !query->isNull(0))
+    {
+        m_next_seq = query->getInt64(0) + 1;
     }
 
     // Create parametrized queries
     std::stringstream insert_query;
-    insert_query << "INSERT INTO " << table_name << " VALUES (NULL, ?, ?, ?, ?);";
+    insert_query << "INSERT OR REPLACE INTO " << table_name << " VALUES (?, ?, ?, ?, ?, ?);";
     m_insert_query = m_database.query(insert_query.str());
 }
 
+/** @brief Writer thread loop */
+void LogDatabase::threadLoop()
+{
+    while (!m_stop)
+    {
+        // Wait for entries
+        {
+            std::unique_lock<std::mutex> lock(m_wakeup_mutex);
+            if (!m_stop)
+            {
+                m_wakeup_cond.wait_for(lock, std::chrono::milliseconds(FLUSH_PERIOD_MS));
+            }
+        }
+
+        // Write them to the database
+        flush(false);
+    }
+
+    // Write the last entries
+    flush(true);
+}
+
+/** @brief Write all the pending entries to the database */
+void LogDatabase::flush(bool last)
+{
+    uint64_t dropped_count = m_dropped_count;
+    if ((dropped_count != m_reported_dropped_count) || !m_entries.empty())
+    {
+        // Write all the entries in a single transaction, the database connection is shared with the stack
+        // => if the transaction can't be started, the entries are kept in the queue until the next flush
+        Database::Transaction transaction(m_database);
+        if (!transaction.isActive() && !last)
+        {
+            return;
+        }
+
+        // Report the dropped entries
+        if (dropped_count != m_reported_dropped_count)
+        {
+            std::stringstream message;
+            message << (dropped_count - m_reported_dropped_count) << " log entries have been dropped";
+            insert(std::chrono::system_clock::to_time_t(std::chrono::system_clock::now()), 3u, __FILENAME__, message.str());
+            m_reported_dropped_count = dropped_count;
+        }
+
+        // Write the available entries
+        Entry entry;
+        while (m_entries.tryPop(entry))
+        {
+            insert(entry.timestamp, entry.level, entry.file, entry.message);
+        }
+
+        transaction.commit();
+    }
+}
+
+/** @brief Insert an entry in the table */
+void LogDatabase::insert(std::time_t timestamp, unsigned int level, const std::string& file, const std::string& message)
+{
+    m_insert_query->bind(0, m_next_seq % static_cast<int64_t>(m_max_entries));
+    m_insert_query->bind(1, static_cast<int64_t>(timestamp));
+    m_insert_query->bind(2, level);
+    m_insert_query->bind(3, file);
+    m_insert_query->bind(4, message);
+    m_insert_query->bind(5, m_next_seq);
+    m_insert_query->exec();
+    m_insert_query->reset();
+    m_next_seq++;
+}
+
 } // namespace log
 } // namespace ocpp
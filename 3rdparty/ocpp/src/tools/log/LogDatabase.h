@@ -20,26 +20,47 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #define OPENOCPP_LOGDATABASE_H
 
 #include "Database.h"
+#include "LockFreeQueue.h"
 
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 
 namespace ocpp
 {
 namespace log
 {
 
-/** @brief Handle persistency of logs */
+/** @brief Handle persistency of logs
+ *
+ *  Log entries are pushed without locking into a bounded lock-free queue and written
+ *  to the database by a background thread in batched transactions so that the
+ *  logging threads never wait for the database.
+ *  The table is used as a ring of max_entries rows : an entry is stored at the
+ *  row whose id is its sequence number modulo max_entries, replacing the oldest one.
+ */
 class LogDatabase
 {
   public:
+    /** @brief Number of entries of the queue (must be a power of 2) */
+    static constexpr size_t QUEUE_SIZE = 4096u;
+    /** @brief Maximum delay in milliseconds before a log entry is written to the database */
+    static constexpr unsigned int FLUSH_PERIOD_MS = 250u;
+
     /** @brief Constructor */
     LogDatabase(ocpp::database::Database& database, const std::string& table_name, unsigned int max_entries);
 
-    /** @brief Destructor */
+    /** @brief Destructor (the pending entries are written before returning) */
     virtual ~LogDatabase();
 
     /**
-     * @brief Add a log entry
+     * @brief Add a log entry, the entry is dropped if the queue is full
      * @param timestamp Timestamp in UNIX format of the entry
      * @param level Log level
      * @param file File which generated the log
@@ -47,15 +68,64 @@ class LogDatabase
      */
     void log(std::time_t timestamp, unsigned int level, const std::string& file, const std::string& message);
 
+    /**
+     * @brief Get the number of entries which have been dropped because the queue was full
+     * @return Number of dropped entries
+     */
+    uint64_t droppedCount() const { return m_dropped_count; }
+
   private:
+    /** @brief Entry of the queue */
+    struct Entry
+    {
+        /** @brief Timestamp in UNIX format of the entry */
+        std::time_t timestamp = 0;
+        /** @brief Log level */
+        unsigned int level = 0;
+        /** @brief File which generated the log */
+        std::string file;
+        /** @brief Log message */
+        std::string message;
+    };
+
     /** @brief Database to store the logs */
     ocpp::database::Database& m_database;
+    /** @brief Maximum number of entries in the table */
+    const unsigned int m_max_entries;
+
+    /** @brief Entries waiting to be written */
+    ocpp::helpers::LockFreeQueue<Entry, QUEUE_SIZE> m_entries;
+    /** @brief Number of dropped entries */
+    std::atomic<uint64_t> m_dropped_count;
+    /** @brief Number of dropped entries which have already been reported in the database */
+    uint64_t m_reported_dropped_count;
+    /** @brief Sequence number of the next entry to store in the table */
+    int64_t m_next_seq;
+
+    /** @brief Indicate that the writer thread must stop */
+    std::atomic<bool> m_stop;
+    /** @brief Mutex for wakeup condition */
+    std::mutex m_wakeup_mutex;
+    /** @brief Wakeup condition */
+    std::condition_variable m_wakeup_cond;
+    /** @brief Writer thread */
+    std::thread m_thread;
 
     /** @brief Query to insert a log */
     std::unique_ptr<ocpp::database::Database::Query> m_insert_query;
 
     /** @brief Initialize the database table */
-    void initDatabaseTable(const std::string& table_name, unsigned int max_entries);
+    void initDatabaseTable(const std::string& table_name);
+    /** @brief Writer thread loop */
+    void threadLoop();
+    /**
+     * @brief Write all the pending entries to the database
+     * @param last Indicate that it is the last flush before stopping, the entries are written
+     *             even if the database transaction could not be started
+     */
+    void flush(bool last);
+    /** @brief Insert an entry in the table */
+    void insert(std::time_t timestamp, unsigned int level, const std::string& file, const std::string& message);
 };
 
 } // namespace log
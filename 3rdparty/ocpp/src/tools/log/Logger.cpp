@@ -69,11 +69,12 @@ Logger::~Logger()
 #endif // _MSC_VER
         LOG_OUTPUT << m_level_str << " - [" << std::put_time(&now_tm, "%Y-%m-%dT%T") << "] - " << file_line.str() << " - "
                    << m_log_output.str() << std::endl;
+    }
 
-        if (m_log_database)
-        {
-            m_log_database->log(now, m_level, file_line.str(), m_log_output.str());
-        }
+    // Log database is lock free
+    if (m_log_database)
+    {
+        m_log_database->log(now, m_level, file_line.str(), m_log_output.str());
     }
 }
 
@@ -94,6 +95,7 @@ void Logger::unregisterDefaultLogger()
     auto iter = m_loggers.find(DEFAULT_LOG_NAME);
     if (iter != m_loggers.end())
     {
+        m_default_logger = nullptr;
         m_loggers.erase(iter);
     }
 }
@@ -19,6 +19,8 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #ifndef OPENOCPP_OPTIONAL_H
 #define OPENOCPP_OPTIONAL_H
 
+#include <utility>
+
 namespace ocpp
 {
 namespace types
@@ -0,0 +1,105 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_COMPRESSION_H
+#define OPENOCPP_COMPRESSION_H
+
+#include <cstdint>
+
+namespace ocpp
+{
+namespace websockets
+{
+
+/** @brief permessage-deflate compression parameters (RFC 7692) */
+struct CompressionConfig
+{
+    /** @brief Default constructor (compression disabled) */
+    CompressionConfig()
+        : enabled(false),
+          server_no_context_takeover(false),
+          client_no_context_takeover(false),
+          server_max_window_bits(MAX_WINDOW_BITS),
+          client_max_window_bits(MAX_WINDOW_BITS)
+    {
+    }
+
+    /** @brief Constructor */
+    CompressionConfig(bool         _enabled,
+                      bool         _server_no_context_takeover,
+                      bool         _client_no_context_takeover,
+                      unsigned int _server_max_window_bits,
+                      unsigned int _client_max_window_bits)
+        : enabled(_enabled),
+          server_no_context_takeover(_server_no_context_takeover),
+          client_no_context_takeover(_client_no_context_takeover),
+          server_max_window_bits(_server_max_window_bits),
+          client_max_window_bits(_client_max_window_bits)
+    {
+    }
+
+    /** @brief Smallest allowed LZ77 window size in bits */
+    static constexpr unsigned int MIN_WINDOW_BITS = 9u;
+    /** @brief Biggest allowed LZ77 window size in bits */
+    static constexpr unsigned int MAX_WINDOW_BITS = 15u;
+
+    /** @brief Enable the negotiation of the permessage-deflate extension */
+    bool enabled;
+    /** @brief The server resets its compression context after each message */
+    bool server_no_context_takeover;
+    /** @brief The client resets its compression context after each message */
+    bool client_no_context_takeover;
+    /** @brief Size in bits of the LZ77 window used by the server to compress (9 to 15, other values = 15) */
+    unsigned int server_max_window_bits;
+    /** @brief Size in bits of the LZ77 window used by the client to compress (9 to 15, other values = 15) */
+    unsigned int client_max_window_bits;
+};
+
+/** @brief Compression statistics of a connection, only the messages going through
+ *         the permessage-deflate extension are accounted */
+struct CompressionStats
+{
+    /** @brief Constructor */
+    CompressionStats() : tx_uncompressed_bytes(0), tx_compressed_bytes(0), rx_compressed_bytes(0), rx_uncompressed_bytes(0) { }
+
+    /** @brief Number of bytes given to the compressor */
+    uint64_t tx_uncompressed_bytes;
+    /** @brief Number of compressed bytes sent */
+    uint64_t tx_compressed_bytes;
+    /** @brief Number of compressed bytes received */
+    uint64_t rx_compressed_bytes;
+    /** @brief Number of bytes produced by the decompressor */
+    uint64_t rx_uncompressed_bytes;
+
+    /** @brief Compression ratio of the sent data (uncompressed size / compressed size, 0 if nothing has been compressed) */
+    double txRatio() const
+    {
+        return (tx_compressed_bytes != 0) ? (static_cast<double>(tx_uncompressed_bytes) / static_cast<double>(tx_compressed_bytes)) : 0.;
+    }
+
+    /** @brief Compression ratio of the received data (uncompressed size / compressed size, 0 if nothing has been decompressed) */
+    double rxRatio() const
+    {
+        return (rx_compressed_bytes != 0) ? (static_cast<double>(rx_uncompressed_bytes) / static_cast<double>(rx_compressed_bytes)) : 0.;
+    }
+};
+
+} // namespace websockets
+} // namespace ocpp
+
+#endif // OPENOCPP_COMPRESSION_H
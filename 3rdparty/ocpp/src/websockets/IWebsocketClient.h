@@ -19,7 +19,11 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #ifndef OPENOCPP_IWEBSOCKETCLIENT_H
 #define OPENOCPP_IWEBSOCKETCLIENT_H
 
+#include "Compression.h"
+#include "SendFrame.h"
+
 #include <chrono>
+#include <memory>
 #include <string>
 
 namespace ocpp
@@ -75,6 +79,19 @@ class IWebsocketClient
      */
     virtual bool send(const void* data, size_t size) = 0;
 
+    /**
+     * @brief Send a frame through the websocket connection
+     * @param frame Frame to send, the websocket takes the ownership of its buffer
+     * @return true is the data has been sent, false otherwise
+     */
+    virtual bool send(SendFrame&& frame) = 0;
+
+    /**
+     * @brief Get the permessage-deflate compression statistics of the connection
+     * @return Compression statistics (all zeros if the compression has not been negotiated)
+     */
+    virtual CompressionStats compressionStats() const = 0;
+
     /**
      * @brief Register a listener to the websocket events
      * @param listener Listener object
@@ -102,10 +119,11 @@ class IWebsocketClient
 
         /**
          * @brief Call when data has been received
-         * @param buffer Buffer containing received data
-         * @param size Size of the buffer in bytes
+         * @param data Null terminated buffer containing received data, the listener takes its ownership
+         *             and is allowed to modify it (in-situ parsing)
+         * @param size Size of the received data in bytes (without the null terminating character)
          */
-        virtual void wsClientDataReceived(const void* data, size_t size) = 0;
+        virtual void wsClientDataReceived(std::unique_ptr<char[]> data, size_t size) = 0;
     };
 
     /** @brief Connection credentials */
@@ -19,7 +19,11 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #ifndef OPENOCPP_IWEBSOCKETSERVER_H
 #define OPENOCPP_IWEBSOCKETSERVER_H
 
+#include "Compression.h"
+#include "SendFrame.h"
+
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -65,7 +69,11 @@ class IWebsocketServer
      */
     virtual void registerListener(IListener& listener) = 0;
 
-    /** @brief Interface for the websocket server listeners */
+    /** @brief Interface for the websocket server listeners
+     *
+     *  The notifications may come from several service threads but they are serialized : an implementation doesn't need
+     *  to protect the state only accessed by these notifications.
+     */
     class IListener
     {
       public:
@@ -134,13 +142,52 @@ class IWebsocketServer
          */
         virtual bool isConnected() = 0;
 
+        /** @brief Result of a send operation */
+        enum class SendResult
+        {
+            /** @brief Data has been queued for sending */
+            SENT,
+            /** @brief Data has been dropped because the send queue of the connection is full,
+             *         the listener will be notified when the connection is writable again */
+            WOULD_BLOCK,
+            /** @brief Data has been dropped because the connection is closed */
+            FAILED
+        };
+
         /**
          * @brief Send data through the websocket connection
          * @param buffer Buffer containing the data to send
          * @param size Size of the buffer in bytes
-         * @return true is the data has been sent, false otherwise
+         * @return Result of the send operation
          */
-        virtual bool send(const void* data, size_t size) = 0;
+        virtual SendResult send(const void* data, size_t size) = 0;
+
+        /**
+         * @brief Send a frame through the websocket connection
+         * @param frame Frame to send, the websocket takes the ownership of its buffer
+         * @return Result of the send operation
+         */
+        virtual SendResult send(SendFrame&& frame) = 0;
+
+        /**
+         * @brief Get the number of frames which have been dropped because the send queue was full
+         *        or because the connection has been closed before they were sent
+         * @return Number of dropped frames
+         */
+        virtual uint64_t droppedFramesCount() const = 0;
+
+        /**
+         * @brief Get the number of frames which have been queued while the connection was choked
+         *        and thus could not be sent immediately
+         * @return Number of deferred frames
+         */
+        virtual uint64_t deferredFramesCount() const = 0;
+
+        /**
+         * @brief Get the permessage-deflate compression statistics of the connection
+         * @return Compression statistics (all zeros if the compression has not been negotiated)
+         */
+        virtual CompressionStats compressionStats() const = 0;
 
         /**
          * @brief Register a listener to the websocket events
@@ -148,7 +195,11 @@ class IWebsocketServer
          */
         virtual void registerListener(IListener& listener) = 0;
 
-        /** @brief Interface for the websocket clients listeners */
+        /** @brief Interface for the websocket clients listeners
+         *
+         *  The notifications of a client come from a single service thread, the notifications of different clients
+         *  may run concurrently : a state shared between the clients must be protected by the implementation.
+         */
         class IListener
         {
           public:
@@ -163,10 +214,14 @@ class IWebsocketServer
 
             /**
              * @brief Call when data has been received
-             * @param buffer Buffer containing received data
-             * @param size Size of the buffer in bytes
+             * @param data Null terminated buffer containing received data, the listener takes its ownership
+             *             and is allowed to modify it (in-situ parsing)
+             * @param size Size of the received data in bytes (without the null terminating character)
              */
-            virtual void wsClientDataReceived(const void* data, size_t size) = 0;
+            virtual void wsClientDataReceived(std::unique_ptr<char[]> data, size_t size) = 0;
+
+            /** @brief Called when the send queue has drained after a send operation has returned SendResult::WOULD_BLOCK */
+            virtual void wsClientWritable() = 0;
         };
     };
 
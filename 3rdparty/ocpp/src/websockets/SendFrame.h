@@ -0,0 +1,153 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_SENDFRAME_H
+#define OPENOCPP_SENDFRAME_H
+
+#include <cstddef>
+#include <cstring>
+
+namespace ocpp
+{
+namespace websockets
+{
+
+/** @brief Buffer of a frame to send, with room reserved in front of the payload for the websocket frame header.
+ *         It can be used directly as a RapidJSON output stream so that messages are serialized in place
+ *         and the buffer is then handed over to the websocket without any copy */
+class SendFrame
+{
+  public:
+    /** @brief Character type (RapidJSON output stream concept) */
+    typedef char Ch;
+
+    /** @brief Size in bytes reserved in front of the payload for the websocket frame header */
+    static constexpr size_t HEADER_SIZE = 16u;
+    /** @brief Default payload capacity in bytes */
+    static constexpr size_t DEFAULT_CAPACITY = 512u;
+
+    /**
+     * @brief Constructor
+     * @param capacity Initial payload capacity in bytes
+     */
+    SendFrame(size_t capacity = DEFAULT_CAPACITY)
+        : m_buffer(new unsigned char[HEADER_SIZE + capacity]), m_payload(&m_buffer[HEADER_SIZE]), m_size(0), m_capacity(capacity)
+    {
+    }
+    /** @brief Move constructor */
+    SendFrame(SendFrame&& other) : m_buffer(other.m_buffer), m_payload(other.m_payload), m_size(other.m_size), m_capacity(other.m_capacity)
+    {
+        other.m_buffer   = nullptr;
+        other.m_payload  = nullptr;
+        other.m_size     = 0;
+        other.m_capacity = 0;
+    }
+    /** @brief Copy constructor (deleted) */
+    SendFrame(const SendFrame&) = delete;
+    /** @brief Copy operator (deleted) */
+    SendFrame& operator=(const SendFrame&) = delete;
+    /** @brief Destructor */
+    virtual ~SendFrame() { delete[] m_buffer; }
+
+    /**
+     * @brief Append data to the payload
+     * @param data Data to append
+     * @param size Size of the data in bytes
+     */
+    void append(const void* data, size_t size)
+    {
+        reserve(size);
+        memcpy(&m_payload[m_size], data, size);
+        m_size += size;
+    }
+
+    /** @brief Append a character to the payload (RapidJSON output stream concept) */
+    void Put(Ch c)
+    {
+        reserve(1u);
+        m_payload[m_size++] = static_cast<unsigned char>(c);
+    }
+
+    /** @brief Flush the stream (RapidJSON output stream concept) */
+    void Flush() { }
+
+    /**
+     * @brief Get the payload
+     * @return Payload
+     */
+    const char* payload() const { return reinterpret_cast<const char*>(m_payload); }
+
+    /**
+     * @brief Get the size of the payload
+     * @return Size of the payload in bytes
+     */
+    size_t size() const { return m_size; }
+
+    /**
+     * @brief Transfer the ownership of the buffer, the payload starts at HEADER_SIZE bytes from its beginning
+     *        (the frame is empty after this call)
+     * @return Buffer to release with delete[]
+     */
+    unsigned char* release()
+    {
+        unsigned char* buffer = m_buffer;
+        m_buffer              = nullptr;
+        m_payload             = nullptr;
+        m_size                = 0;
+        m_capacity            = 0;
+        return buffer;
+    }
+
+  private:
+    /** @brief Buffer including the room for the header */
+    unsigned char* m_buffer;
+    /** @brief Payload start */
+    unsigned char* m_payload;
+    /** @brief Size of the payload in bytes */
+    size_t m_size;
+    /** @brief Capacity of the payload in bytes */
+    size_t m_capacity;
+
+    /** @brief Ensure that the given number of bytes can be appended to the payload */
+    void reserve(size_t size)
+    {
+        if ((m_size + size) > m_capacity)
+        {
+            // Grow by half of the current capacity as RapidJSON does for its buffers
+            size_t new_capacity = m_capacity + (m_capacity + 1u) / 2u;
+            if (new_capacity < (m_size + size))
+            {
+                new_capacity = m_size + size;
+            }
+            unsigned char* new_buffer = new unsigned char[HEADER_SIZE + new_capacity];
+            if (m_buffer)
+            {
+                memcpy(&new_buffer[HEADER_SIZE], m_payload, m_size);
+            }
+            delete[] m_buffer;
+            m_buffer   = new_buffer;
+            m_payload  = &m_buffer[HEADER_SIZE];
+            m_capacity = new_capacity;
+        }
+    }
+};
+
+} // namespace websockets
+} // namespace ocpp
+
+#endif // OPENOCPP_SENDFRAME_H
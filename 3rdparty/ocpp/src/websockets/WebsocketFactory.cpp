@@ -50,8 +50,9 @@ IWebsocketClient* WebsocketFactory::newClient()
     }
 }
 
-/** @brief Instanciate a client websocket from the pool (the pool must be started first) */
-IWebsocketClient* WebsocketFactory::newClientFromPool()
+/** @brief Instanciate a client websocket from the pool (the pool must be started first)
+ *         with the given permessage-deflate compression parameters */
+IWebsocketClient* WebsocketFactory::newClientFromPool(const CompressionConfig& compression)
 {
     IWebsocketClient*           ret = nullptr;
     std::lock_guard<std::mutex> lock(s_client_pools_mutex);
@@ -66,15 +67,20 @@ IWebsocketClient* WebsocketFactory::newClientFromPool()
                 selected_pool = &pool;
             }
         }
-        ret = (*selected_pool)->newClient();
+        ret = (*selected_pool)->newClient(compression);
     }
     return ret;
 }
 
-/** @brief Instanciate a server websocket */
-IWebsocketServer* WebsocketFactory::newServer()
+/** @brief Instanciate a server websocket using the given number of service threads (0 = 1 thread),
+ *         the given limits for the data waiting to be sent on each connection (0 = default)
+ *         and the given permessage-deflate compression parameters */
+IWebsocketServer* WebsocketFactory::newServer(unsigned int             service_threads_count,
+                                              size_t                   send_queue_max_msgs,
+                                              size_t                   send_queue_max_bytes,
+                                              const CompressionConfig& compression)
 {
-    return new LibWebsocketServer();
+    return new LibWebsocketServer(service_threads_count, send_queue_max_msgs, send_queue_max_bytes, compression);
 }
 
 /** @brief Set the number of client pools (can only be done once) */
@@ -33,10 +33,16 @@ class WebsocketFactory
   public:
     /** @brief Instanciate a client websocket */
     static IWebsocketClient* newClient();
-    /** @brief Instanciate a client websocket from the pool (the pool must be started first) */
-    static IWebsocketClient* newClientFromPool();
-    /** @brief Instanciate a server websocket */
-    static IWebsocketServer* newServer();
+    /** @brief Instanciate a client websocket from the pool (the pool must be started first)
+     *         with the given permessage-deflate compression parameters */
+    static IWebsocketClient* newClientFromPool(const CompressionConfig& compression = CompressionConfig());
+    /** @brief Instanciate a server websocket using the given number of service threads (0 = 1 thread),
+     *         the given limits for the data waiting to be sent on each connection (0 = default)
+     *         and the given permessage-deflate compression parameters */
+    static IWebsocketServer* newServer(unsigned int             service_threads_count = 1u,
+                                       size_t                   send_queue_max_msgs   = 0u,
+                                       size_t                   send_queue_max_bytes  = 0u,
+                                       const CompressionConfig& compression           = CompressionConfig());
 
     /** @brief Set the number of client pools (can only be done once) */
     static bool setClientPoolCount(size_t count);
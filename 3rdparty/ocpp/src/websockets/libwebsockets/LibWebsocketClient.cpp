@@ -242,6 +242,14 @@ bool LibWebsocketClient::isConnected()
 
 /** @copydoc bool IWebsocketClient::send(const void*, size_t) */
 bool LibWebsocketClient::send(const void* data, size_t size)
+{
+    SendFrame frame(size);
+    frame.append(data, size);
+    return send(std::move(frame));
+}
+
+/** @copydoc bool IWebsocketClient::send(SendFrame&&) */
+bool LibWebsocketClient::send(SendFrame&& frame)
 {
     bool ret = false;
 
@@ -249,8 +257,13 @@ bool LibWebsocketClient::send(const void* data, size_t size)
     if (m_connected)
     {
         // Prepare data to send
-        SendMsg* msg = new SendMsg(data, size);
+        SendMsg* msg = new SendMsg(frame);
         ret          = m_send_msgs.push(msg);
+        if (!ret)
+        {
+            // Too many messages waiting to be sent
+            delete msg;
+        }
 
         // Schedule a send
         lws_cancel_service(m_context);
@@ -307,8 +320,10 @@ void LibWebsocketClient::beginFragmentedFrame(size_t frame_size)
     releaseFragmentedFrame();
 
     // Allocate new buffer
-    m_fragmented_frame      = new uint8_t[frame_size];
-    m_fragmented_frame_size = frame_size;
+    // => Null terminated to allow in-situ parsing by the listener
+    m_fragmented_frame             = new char[frame_size + 1u];
+    m_fragmented_frame[frame_size] = 0;
+    m_fragmented_frame_size        = frame_size;
 }
 
 /** @brief Append data to the fragmented frame */
@@ -332,6 +347,15 @@ void LibWebsocketClient::releaseFragmentedFrame()
     m_fragmented_frame_index = 0;
 }
 
+/** @brief Transfer the ownership of the fragmented frame */
+std::unique_ptr<char[]> LibWebsocketClient::detachFragmentedFrame()
+{
+    std::unique_ptr<char[]> frame(m_fragmented_frame);
+    m_fragmented_frame = nullptr;
+    releaseFragmentedFrame();
+    return frame;
+}
+
 /** @brief libwebsockets connection callback */
 void LibWebsocketClient::connectCallback(struct lws_sorted_usec_list* sul) noexcept
 {
@@ -469,7 +493,10 @@ int LibWebsocketClient::eventCallback(struct lws* wsi, enum lws_callback_reasons
                 if (is_first && is_last)
                 {
                     // Notify client
-                    client->m_listener->wsClientDataReceived(in, len);
+                    // => The listener takes the ownership of a copy of the frame
+                    client->beginFragmentedFrame(len);
+                    client->appendFragmentedData(in, len);
+                    client->m_listener->wsClientDataReceived(client->detachFragmentedFrame(), len);
                 }
                 else if (is_first)
                 {
@@ -484,10 +511,9 @@ int LibWebsocketClient::eventCallback(struct lws* wsi, enum lws_callback_reasons
                     if (is_last)
                     {
                         // Notify client
-                        client->m_listener->wsClientDataReceived(client->m_fragmented_frame, client->m_fragmented_frame_size);
-
-                        // Release resources
-                        client->releaseFragmentedFrame();
+                        // => The listener takes the ownership of the reassembled frame, no copy needed
+                        size_t frame_size = client->m_fragmented_frame_size;
+                        client->m_listener->wsClientDataReceived(client->detachFragmentedFrame(), frame_size);
                     }
                 }
             }
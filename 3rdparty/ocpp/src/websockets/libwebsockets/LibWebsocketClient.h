@@ -20,7 +20,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #define OPENOCPP_LIBWEBSOCKETCLIENT_H
 
 #include "IWebsocketClient.h"
-#include "Queue.h"
+#include "LockFreeQueue.h"
 #include "Url.h"
 #include "websockets.h"
 
@@ -60,6 +60,12 @@ class LibWebsocketClient : public IWebsocketClient
     /** @copydoc bool IWebsocketClient::send(const void*, size_t) */
     bool send(const void* data, size_t size) override;
 
+    /** @copydoc bool IWebsocketClient::send(SendFrame&&) */
+    bool send(SendFrame&& frame) override;
+
+    /** @copydoc CompressionStats IWebsocketClient::compressionStats() const */
+    CompressionStats compressionStats() const override { return CompressionStats(); }
+
     /** @copydoc void IWebsocketClient::registerListener(IListener&) */
     void registerListener(IListener& listener) override;
 
@@ -67,13 +73,12 @@ class LibWebsocketClient : public IWebsocketClient
     /** @brief Message to send */
     struct SendMsg
     {
-        /** @brief Constructor */
-        SendMsg(const void* _data, size_t _size)
+        /** @brief Constructor, takes the ownership of the frame buffer */
+        SendMsg(SendFrame& frame)
         {
-            data    = new unsigned char[LWS_PRE + _size];
-            size    = _size;
-            payload = &data[LWS_PRE];
-            memcpy(payload, _data, size);
+            size    = frame.size();
+            data    = frame.release();
+            payload = &data[SendFrame::HEADER_SIZE];
         }
         /** @brief Destructor */
         virtual ~SendMsg() { delete[] data; }
@@ -86,6 +91,9 @@ class LibWebsocketClient : public IWebsocketClient
         size_t size;
     };
 
+    /** @brief Maximum number of messages waiting to be sent on a connection */
+    static constexpr size_t SEND_QUEUE_SIZE = 256u;
+
     /** @brief Listener */
     IListener* m_listener;
     /** @brief Internal thread */
@@ -121,10 +129,10 @@ class LibWebsocketClient : public IWebsocketClient
     uint16_t m_retry_count;
 
     /** @brief Queue of messages to send */
-    ocpp::helpers::Queue<SendMsg*> m_send_msgs;
+    ocpp::helpers::LockFreeQueue<SendMsg*, SEND_QUEUE_SIZE> m_send_msgs;
 
     /** @brief Buffer to store fragmented frames */
-    uint8_t* m_fragmented_frame;
+    char* m_fragmented_frame;
     /** @brief Size of the fragmented frame */
     size_t m_fragmented_frame_size;
     /** @brief Current index in the fragmented frame */
@@ -139,6 +147,8 @@ class LibWebsocketClient : public IWebsocketClient
     void appendFragmentedData(const void* data, size_t size);
     /** @brief Release the memory associated with the fragmented frame */
     void releaseFragmentedFrame();
+    /** @brief Transfer the ownership of the fragmented frame */
+    std::unique_ptr<char[]> detachFragmentedFrame();
 
     /** @brief libwebsockets connection callback */
     static void connectCallback(struct lws_sorted_usec_list* sul) noexcept;
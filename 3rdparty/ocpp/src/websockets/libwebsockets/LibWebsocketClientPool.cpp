@@ -18,6 +18,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include "LibWebsocketClientPool.h"
 
+#include <algorithm>
 #include <csignal>
 #include <cstdint>
 #include <functional>
@@ -121,10 +122,10 @@ size_t LibWebsocketClientPool::getClientsCount() const
     return m_clients_count;
 }
 
-/** @brief Instanciate a client websocket */
-IWebsocketClient* LibWebsocketClientPool::newClient()
+/** @brief Instanciate a client websocket with the given permessage-deflate compression parameters */
+IWebsocketClient* LibWebsocketClientPool::newClient(const CompressionConfig& compression)
 {
-    return new Client(*this);
+    return new Client(*this, compression);
 }
 
 /** @brief Internal thread */
@@ -235,7 +236,7 @@ int LibWebsocketClientPool::eventCallback(struct lws* wsi, enum lws_callback_rea
 }
 
 /** @brief Constructor */
-LibWebsocketClientPool::Client::Client(LibWebsocketClientPool& pool)
+LibWebsocketClientPool::Client::Client(LibWebsocketClientPool& pool, const CompressionConfig& compression)
     : IWebsocketClient(),
       m_pool(pool),
       m_listener(nullptr),
@@ -258,6 +259,8 @@ LibWebsocketClientPool::Client::Client(LibWebsocketClientPool& pool)
       m_retry_count(0),
       m_schedule_data(),
       m_send_msgs(),
+      m_deflate(compression, &LibWebsocketClientPool::Client::extensionCallback),
+      m_deflate_counters(),
       m_fragmented_frame(nullptr),
       m_fragmented_frame_size(0),
       m_fragmented_frame_index(0)
@@ -383,6 +386,14 @@ bool LibWebsocketClientPool::Client::isConnected()
 
 /** @copydoc bool IWebsocketClient::send(const void*, size_t) */
 bool LibWebsocketClientPool::Client::send(const void* data, size_t size)
+{
+    SendFrame frame(size);
+    frame.append(data, size);
+    return send(std::move(frame));
+}
+
+/** @copydoc bool IWebsocketClient::send(SendFrame&&) */
+bool LibWebsocketClientPool::Client::send(SendFrame&& frame)
 {
     bool ret = false;
 
@@ -392,8 +403,13 @@ bool LibWebsocketClientPool::Client::send(const void* data, size_t size)
     if (m_connected)
     {
         // Prepare data to send
-        SendMsg* msg = new SendMsg(data, size);
+        SendMsg* msg = new SendMsg(frame);
         ret          = m_send_msgs.push(msg);
+        if (!ret)
+        {
+            // Too many messages waiting to be sent
+            delete msg;
+        }
 
         // Schedule a send
         m_pool.m_waiting_send_queue.push(this);
@@ -416,20 +432,29 @@ void LibWebsocketClientPool::Client::beginFragmentedFrame(size_t frame_size)
     releaseFragmentedFrame();
 
     // Allocate new buffer
-    m_fragmented_frame      = new uint8_t[frame_size];
-    m_fragmented_frame_size = frame_size;
+    // => Null terminated to allow in-situ parsing by the listener
+    m_fragmented_frame             = new char[frame_size + 1u];
+    m_fragmented_frame[frame_size] = 0;
+    m_fragmented_frame_size        = frame_size;
 }
 
 /** @brief Append data to the fragmented frame */
 void LibWebsocketClientPool::Client::appendFragmentedData(const void* data, size_t size)
 {
-    size_t copy_len = size;
-    if ((m_fragmented_frame_index + size) >= m_fragmented_frame_size)
+    // Grow the buffer if needed
+    // => The remaining payload length announced at the beginning of a compressed frame
+    //    is the compressed one, the decompressed data can be bigger
+    if ((m_fragmented_frame_index + size) > m_fragmented_frame_size)
     {
-        copy_len = m_fragmented_frame_size - m_fragmented_frame_index;
+        size_t frame_size = std::max(2u * m_fragmented_frame_size, m_fragmented_frame_index + size);
+        char*  frame      = new char[frame_size + 1u];
+        memcpy(frame, m_fragmented_frame, m_fragmented_frame_index);
+        delete[] m_fragmented_frame;
+        m_fragmented_frame      = frame;
+        m_fragmented_frame_size = frame_size;
     }
-    memcpy(&m_fragmented_frame[m_fragmented_frame_index], data, copy_len);
-    m_fragmented_frame_index += copy_len;
+    memcpy(&m_fragmented_frame[m_fragmented_frame_index], data, size);
+    m_fragmented_frame_index += size;
 }
 
 /** @brief Release the memory associated with the fragmented frame */
@@ -441,6 +466,16 @@ void LibWebsocketClientPool::Client::releaseFragmentedFrame()
     m_fragmented_frame_index = 0;
 }
 
+/** @brief Transfer the ownership of the fragmented frame */
+std::unique_ptr<char[]> LibWebsocketClientPool::Client::detachFragmentedFrame()
+{
+    m_fragmented_frame[m_fragmented_frame_index] = 0;
+    std::unique_ptr<char[]> frame(m_fragmented_frame);
+    m_fragmented_frame = nullptr;
+    releaseFragmentedFrame();
+    return frame;
+}
+
 /** @brief libwebsockets connection callback */
 void LibWebsocketClientPool::Client::connectCallback(struct lws_sorted_usec_list* sul) noexcept
 {
@@ -470,6 +505,7 @@ void LibWebsocketClientPool::Client::connectCallback(struct lws_sorted_usec_list
                 vhost_info.timeout_secs         = client->m_connect_timeout;
                 vhost_info.connect_timeout_secs = client->m_connect_timeout;
                 vhost_info.protocols            = protocols;
+                vhost_info.extensions           = client->m_deflate.extensions();
                 vhost_info.log_cx               = &pool->m_logs_context;
                 if (client->m_url.protocol() == "wss")
                 {
@@ -643,6 +679,10 @@ int LibWebsocketClientPool::Client::eventCallback(
             break;
         }
 
+        case LWS_CALLBACK_CLIENT_CONFIRM_EXTENSION_SUPPORTED:
+            // Offer the extensions configured on the vhost
+            return 0;
+
         case LWS_CALLBACK_CLIENT_ESTABLISHED:
         {
             client->m_connected = true;
@@ -661,7 +701,10 @@ int LibWebsocketClientPool::Client::eventCallback(
                 if (is_first && is_last)
                 {
                     // Notify client
-                    client->m_listener->wsClientDataReceived(in, len);
+                    // => The listener takes the ownership of a copy of the frame
+                    client->beginFragmentedFrame(len);
+                    client->appendFragmentedData(in, len);
+                    client->m_listener->wsClientDataReceived(client->detachFragmentedFrame(), len);
                 }
                 else if (is_first)
                 {
@@ -676,10 +719,9 @@ int LibWebsocketClientPool::Client::eventCallback(
                     if (is_last)
                     {
                         // Notify client
-                        client->m_listener->wsClientDataReceived(client->m_fragmented_frame, client->m_fragmented_frame_size);
-
-                        // Release resources
-                        client->releaseFragmentedFrame();
+                        // => The listener takes the ownership of the reassembled frame, no copy needed
+                        size_t frame_size = client->m_fragmented_frame_index;
+                        client->m_listener->wsClientDataReceived(client->detachFragmentedFrame(), frame_size);
                     }
                 }
             }
@@ -689,9 +731,14 @@ int LibWebsocketClientPool::Client::eventCallback(
         case LWS_CALLBACK_CLIENT_WRITEABLE:
         {
             // Send data if any ready
-            bool     error = false;
-            SendMsg* msg   = nullptr;
-            while (client->m_send_msgs.pop(msg, 0) && !error)
+            // => Stop when the socket is choked to not let libwebsockets buffer the remaining data
+            // => Only one message at a time when compressing since the extension may need
+            //    further writable events to flush a message
+            bool     error   = false;
+            bool     written = false;
+            bool     choked  = (lws_send_pipe_choked(wsi) != 0);
+            SendMsg* msg     = nullptr;
+            while (!error && !choked && !(client->m_deflate.isEnabled() && written) && client->m_send_msgs.pop(msg, 0))
             {
                 if (lws_write(wsi, msg->payload, msg->size, LWS_WRITE_TEXT) < static_cast<int>(msg->size))
                 {
@@ -701,11 +748,19 @@ int LibWebsocketClientPool::Client::eventCallback(
 
                 // Free message memory
                 delete msg;
+
+                choked  = (lws_send_pipe_choked(wsi) != 0);
+                written = true;
             }
             if (error)
             {
                 return -1;
             }
+            if (!client->m_send_msgs.empty())
+            {
+                // Wait for the socket to be writable again
+                lws_callback_on_writable(wsi);
+            }
         }
         break;
 
@@ -749,5 +804,20 @@ int LibWebsocketClientPool::Client::eventCallback(
     return ret;
 }
 
+/** @brief libwebsockets extension callback */
+int LibWebsocketClientPool::Client::extensionCallback(struct lws_context*                context,
+                                                      const struct lws_extension*        ext,
+                                                      struct lws*                        wsi,
+                                                      enum lws_extension_callback_reasons reason,
+                                                      void*                              user,
+                                                      void*                              in,
+                                                      size_t                             len) noexcept
+{
+    // Get corresponding client
+    Client* client = (wsi ? reinterpret_cast<Client*>(lws_wsi_user(wsi)) : nullptr);
+
+    return LibWebsocketDeflate::process(client ? &client->m_deflate_counters : nullptr, context, ext, wsi, reason, user, in, len);
+}
+
 } // namespace websockets
 } // namespace ocpp
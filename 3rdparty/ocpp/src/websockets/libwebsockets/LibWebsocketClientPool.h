@@ -20,6 +20,8 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #define OPENOCPP_LIBWEBSOCKETCLIENTPOOL_H
 
 #include "IWebsocketClient.h"
+#include "LibWebsocketDeflate.h"
+#include "LockFreeQueue.h"
 #include "Queue.h"
 #include "Url.h"
 #include "websockets.h"
@@ -53,8 +55,8 @@ class LibWebsocketClientPool
     /** @brief Get the number of clients */
     size_t getClientsCount() const;
 
-    /** @brief Instanciate a client websocket */
-    IWebsocketClient* newClient();
+    /** @brief Instanciate a client websocket with the given permessage-deflate compression parameters */
+    IWebsocketClient* newClient(const CompressionConfig& compression = CompressionConfig());
 
   private:
     /** @brief Websocket context */
@@ -90,7 +92,7 @@ class LibWebsocketClientPool
 
       public:
         /** @brief Constructor */
-        Client(LibWebsocketClientPool& pool);
+        Client(LibWebsocketClientPool& pool, const CompressionConfig& compression);
         /** @brief Destructor */
         virtual ~Client();
 
@@ -112,6 +114,12 @@ class LibWebsocketClientPool
         /** @copydoc bool IWebsocketClient::send(const void*, size_t) */
         bool send(const void* data, size_t size) override;
 
+        /** @copydoc bool IWebsocketClient::send(SendFrame&&) */
+        bool send(SendFrame&& frame) override;
+
+        /** @copydoc CompressionStats IWebsocketClient::compressionStats() const */
+        CompressionStats compressionStats() const override { return m_deflate_counters.stats(); }
+
         /** @copydoc void IWebsocketClient::registerListener(IListener&) */
         void registerListener(IListener& listener) override;
 
@@ -119,13 +127,12 @@ class LibWebsocketClientPool
         /** @brief Message to send */
         struct SendMsg
         {
-            /** @brief Constructor */
-            SendMsg(const void* _data, size_t _size)
+            /** @brief Constructor, takes the ownership of the frame buffer */
+            SendMsg(SendFrame& frame)
             {
-                data    = new unsigned char[LWS_PRE + _size];
-                size    = _size;
-                payload = &data[LWS_PRE];
-                memcpy(payload, _data, size);
+                size    = frame.size();
+                data    = frame.release();
+                payload = &data[SendFrame::HEADER_SIZE];
             }
             /** @brief Destructor */
             virtual ~SendMsg() { delete[] data; }
@@ -138,6 +145,9 @@ class LibWebsocketClientPool
             size_t size;
         };
 
+        /** @brief Maximum number of messages waiting to be sent on a connection */
+        static constexpr size_t SEND_QUEUE_SIZE = 256u;
+
         /** @brief Schedule data */
         struct ScheduleData
         {
@@ -190,10 +200,15 @@ class LibWebsocketClientPool
         struct ScheduleData m_schedule_data;
 
         /** @brief Queue of messages to send */
-        ocpp::helpers::Queue<SendMsg*> m_send_msgs;
+        ocpp::helpers::LockFreeQueue<SendMsg*, SEND_QUEUE_SIZE> m_send_msgs;
+
+        /** @brief permessage-deflate extension */
+        LibWebsocketDeflate m_deflate;
+        /** @brief Compression counters */
+        LibWebsocketDeflate::Counters m_deflate_counters;
 
         /** @brief Buffer to store fragmented frames */
-        uint8_t* m_fragmented_frame;
+        char* m_fragmented_frame;
         /** @brief Size of the fragmented frame */
         size_t m_fragmented_frame_size;
         /** @brief Current index in the fragmented frame */
@@ -205,11 +220,21 @@ class LibWebsocketClientPool
         void appendFragmentedData(const void* data, size_t size);
         /** @brief Release the memory associated with the fragmented frame */
         void releaseFragmentedFrame();
+        /** @brief Transfer the ownership of the fragmented frame */
+        std::unique_ptr<char[]> detachFragmentedFrame();
 
         /** @brief libwebsockets connection callback */
         static void connectCallback(struct lws_sorted_usec_list* sul) noexcept;
         /** @brief libwebsockets event callback */
         static int eventCallback(struct lws* wsi, enum lws_callback_reasons reason, void* user, void* in, size_t len) noexcept;
+        /** @brief libwebsockets extension callback */
+        static int extensionCallback(struct lws_context*                context,
+                                     const struct lws_extension*        ext,
+                                     struct lws*                        wsi,
+                                     enum lws_extension_callback_reasons reason,
+                                     void*                              user,
+                                     void*                              in,
+                                     size_t                             len) noexcept;
     };
 };
 
@@ -0,0 +1,207 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "LibWebsocketDeflate.h"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace ocpp
+{
+namespace websockets
+{
+
+/** @brief Name of the extension */
+static const char PERMESSAGE_DEFLATE[] = "permessage-deflate";
+
+/** @brief Buffers given to the extension on payload events
+ *         (same layout as the lws_ext_pm_deflate_rx_ebufs structure which is private to libwebsockets) */
+struct DeflateBuffers
+{
+    /** @brief Input buffer */
+    struct lws_tokens eb_in;
+    /** @brief Output buffer */
+    struct lws_tokens eb_out;
+};
+
+/** @brief Get a snapshot of the counters */
+CompressionStats LibWebsocketDeflate::Counters::stats() const
+{
+    CompressionStats stats;
+    stats.tx_uncompressed_bytes = tx_uncompressed_bytes;
+    stats.tx_compressed_bytes   = tx_compressed_bytes;
+    stats.rx_compressed_bytes   = rx_compressed_bytes;
+    stats.rx_uncompressed_bytes = rx_uncompressed_bytes;
+    return stats;
+}
+
+/** @brief Constructor */
+LibWebsocketDeflate::LibWebsocketDeflate(const CompressionConfig& config, lws_extension_callback_function* callback)
+    : m_config(config),
+#ifndef LWS_WITHOUT_EXTENSIONS
+      m_enabled(config.enabled),
+#else
+      m_enabled(false),
+#endif // LWS_WITHOUT_EXTENSIONS
+      m_client_offer(PERMESSAGE_DEFLATE),
+      m_extensions()
+{
+    // Build the offer of the clients
+    if (m_config.server_no_context_takeover)
+    {
+        m_client_offer += "; server_no_context_takeover";
+    }
+    if (m_config.client_no_context_takeover)
+    {
+        m_client_offer += "; client_no_context_takeover";
+    }
+    if ((m_config.server_max_window_bits >= CompressionConfig::MIN_WINDOW_BITS) &&
+        (m_config.server_max_window_bits < CompressionConfig::MAX_WINDOW_BITS))
+    {
+        m_client_offer += "; server_max_window_bits=" + std::to_string(m_config.server_max_window_bits);
+    }
+    if ((m_config.client_max_window_bits >= CompressionConfig::MIN_WINDOW_BITS) &&
+        (m_config.client_max_window_bits < CompressionConfig::MAX_WINDOW_BITS))
+    {
+        m_client_offer += "; client_max_window_bits=" + std::to_string(m_config.client_max_window_bits);
+    }
+    else
+    {
+        m_client_offer += "; client_max_window_bits";
+    }
+
+    // Extensions list
+    m_extensions[0] = {PERMESSAGE_DEFLATE, callback, m_client_offer.c_str()};
+    m_extensions[1] = {nullptr, nullptr, nullptr};
+}
+
+/** @brief Destructor */
+LibWebsocketDeflate::~LibWebsocketDeflate() { }
+
+/** @brief Check if the permessage-deflate offer of a client connecting to the server can be accepted */
+bool LibWebsocketDeflate::acceptOffer(struct lws* wsi) const
+{
+    bool ret = false;
+
+    // Get the offered extensions
+    int offers_size = lws_hdr_total_length(wsi, WSI_TOKEN_EXTENSIONS);
+    if (offers_size > 0)
+    {
+        std::string offers(static_cast<size_t>(offers_size) + 1u, '\0');
+        if (lws_hdr_copy(wsi, &offers[0], offers_size + 1, WSI_TOKEN_EXTENSIONS) > 0)
+        {
+            // libwebsockets only takes into account the first option set of the extension
+            size_t start = offers.find(PERMESSAGE_DEFLATE);
+            if (start != std::string::npos)
+            {
+                size_t      end     = offers.find(',', start);
+                std::string options = offers.substr(start, (end == std::string::npos) ? std::string::npos : (end - start));
+
+                bool   server_no_context_takeover = (options.find("server_no_context_takeover") != std::string::npos);
+                bool   client_no_context_takeover = (options.find("client_no_context_takeover") != std::string::npos);
+                size_t server_max_window_bits_pos = options.find("server_max_window_bits=");
+
+                // The required parameters must be offered
+                ret = (!m_config.server_no_context_takeover || server_no_context_takeover) &&
+                      (!m_config.client_no_context_takeover || client_no_context_takeover);
+
+                // libwebsockets resets its decompression context after each message when the server doesn't take over
+                // its context, so the client must also reset its compression context
+                ret = ret && (!server_no_context_takeover || client_no_context_takeover);
+
+                // libwebsockets always compresses with the biggest window on the server side
+                if (server_max_window_bits_pos != std::string::npos)
+                {
+                    const char*   value = &options[server_max_window_bits_pos + strlen("server_max_window_bits=")];
+                    unsigned long bits  = strtoul(value, nullptr, 10);
+                    ret                 = ret && (bits >= CompressionConfig::MAX_WINDOW_BITS);
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+/** @brief Process an extension event and update the counters of the connection */
+int LibWebsocketDeflate::process(Counters*                          counters,
+                                 struct lws_context*                context,
+                                 const struct lws_extension*        ext,
+                                 struct lws*                        wsi,
+                                 enum lws_extension_callback_reasons reason,
+                                 void*                              user,
+                                 void*                              in,
+                                 size_t                             len)
+{
+    int ret = 0;
+
+#ifndef LWS_WITHOUT_EXTENSIONS
+    // Save the input buffer before it is consumed
+    DeflateBuffers* buffers  = reinterpret_cast<DeflateBuffers*>(in);
+    bool            payload  = counters && buffers && ((reason == LWS_EXT_CB_PAYLOAD_TX) || (reason == LWS_EXT_CB_PAYLOAD_RX));
+    unsigned char*  in_token = nullptr;
+    int             in_len   = 0;
+    if (payload)
+    {
+        in_token = buffers->eb_in.token;
+        in_len   = buffers->eb_in.len;
+    }
+
+    // Process event
+    ret = lws_extension_callback_pm_deflate(context, ext, wsi, reason, user, in, len);
+
+    // Update counters
+    // => New input is always entirely taken by the extension, it is then given back
+    //    or flushed with empty buffers until it has been processed
+    if (payload && (ret >= 0))
+    {
+        if (reason == LWS_EXT_CB_PAYLOAD_TX)
+        {
+            if (in_token)
+            {
+                counters->tx_uncompressed_bytes += static_cast<uint64_t>(in_len);
+            }
+            counters->tx_compressed_bytes += static_cast<uint64_t>(buffers->eb_out.len);
+        }
+        else if (buffers->eb_out.token != in_token)
+        {
+            // Output is only redirected to the decompression buffer for compressed frames
+            if (in_token && (counters->rx_pending_bytes == 0))
+            {
+                counters->rx_compressed_bytes += static_cast<uint64_t>(in_len);
+            }
+            counters->rx_pending_bytes = buffers->eb_in.len;
+            counters->rx_uncompressed_bytes += static_cast<uint64_t>(buffers->eb_out.len);
+        }
+    }
+#else
+    (void)counters;
+    (void)context;
+    (void)ext;
+    (void)wsi;
+    (void)reason;
+    (void)user;
+    (void)in;
+    (void)len;
+#endif // LWS_WITHOUT_EXTENSIONS
+
+    return ret;
+}
+
+} // namespace websockets
+} // namespace ocpp
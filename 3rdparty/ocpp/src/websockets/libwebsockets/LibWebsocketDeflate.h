@@ -0,0 +1,114 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_LIBWEBSOCKETDEFLATE_H
+#define OPENOCPP_LIBWEBSOCKETDEFLATE_H
+
+#include "Compression.h"
+#include "websockets.h"
+
+#include <array>
+#include <atomic>
+#include <string>
+
+namespace ocpp
+{
+namespace websockets
+{
+
+/** @brief permessage-deflate extension of libwebsockets shared by the server and the clients,
+ *         the owner provides a callback which finds the counters of the connection and forwards
+ *         the extension events to the process() method */
+class LibWebsocketDeflate
+{
+  public:
+    /** @brief Compression counters of a connection */
+    struct Counters
+    {
+        /** @brief Constructor */
+        Counters() : tx_uncompressed_bytes(0), tx_compressed_bytes(0), rx_compressed_bytes(0), rx_uncompressed_bytes(0), rx_pending_bytes(0)
+        {
+        }
+
+        /** @brief Number of bytes given to the compressor */
+        std::atomic<uint64_t> tx_uncompressed_bytes;
+        /** @brief Number of compressed bytes sent */
+        std::atomic<uint64_t> tx_compressed_bytes;
+        /** @brief Number of compressed bytes received */
+        std::atomic<uint64_t> rx_compressed_bytes;
+        /** @brief Number of bytes produced by the decompressor */
+        std::atomic<uint64_t> rx_uncompressed_bytes;
+        /** @brief Number of received bytes still waiting in the decompressor (only accessed by the service thread) */
+        int rx_pending_bytes;
+
+        /** @brief Get a snapshot of the counters */
+        CompressionStats stats() const;
+    };
+
+    /**
+     * @brief Constructor
+     * @param config Compression parameters
+     * @param callback Extension callback of the owner
+     */
+    LibWebsocketDeflate(const CompressionConfig& config, lws_extension_callback_function* callback);
+
+    /** @brief Destructor */
+    virtual ~LibWebsocketDeflate();
+
+    /** @brief Indicate if the compression is enabled and supported by the libwebsockets library */
+    bool isEnabled() const { return m_enabled; }
+
+    /** @brief Get the extensions list to give to libwebsockets (nullptr if the compression is disabled) */
+    const struct lws_extension* extensions() const { return (m_enabled ? &m_extensions[0] : nullptr); }
+
+    /**
+     * @brief Check if the permessage-deflate offer of a client connecting to the server can be accepted
+     * @param wsi Client socket
+     * @return true if the offer can be accepted, false if the connection must not be compressed
+     */
+    bool acceptOffer(struct lws* wsi) const;
+
+    /**
+     * @brief Process an extension event and update the counters of the connection
+     * @param counters Counters of the connection (can be nullptr)
+     * @return Result of the libwebsockets permessage-deflate extension
+     */
+    static int process(Counters*                          counters,
+                       struct lws_context*                context,
+                       const struct lws_extension*        ext,
+                       struct lws*                        wsi,
+                       enum lws_extension_callback_reasons reason,
+                       void*                              user,
+                       void*                              in,
+                       size_t                             len);
+
+  private:
+    /** @brief Compression parameters */
+    const CompressionConfig m_config;
+    /** @brief Indicate if the compression is enabled */
+    const bool m_enabled;
+    /** @brief Extension offer of the clients */
+    std::string m_client_offer;
+    /** @brief Extensions list */
+    std::array<struct lws_extension, 2u> m_extensions;
+};
+
+} // namespace websockets
+} // namespace ocpp
+
+#endif // OPENOCPP_LIBWEBSOCKETDEFLATE_H
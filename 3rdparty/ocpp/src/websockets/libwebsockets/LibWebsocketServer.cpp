@@ -18,6 +18,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include "LibWebsocketServer.h"
 
+#include <algorithm>
 #include <csignal>
 #include <cstdint>
 #include <functional>
@@ -30,23 +31,33 @@ namespace websockets
 
 /** @brief Thread local server instance used when callbacks doesn't provide user data */
 thread_local LibWebsocketServer* server;
+/** @brief IP address of the client currently connecting on the service thread */
+thread_local char* connecting_ip_address;
 
 /** @brief Constructor */
-LibWebsocketServer::LibWebsocketServer()
+LibWebsocketServer::LibWebsocketServer(unsigned int             service_threads_count,
+                                       size_t                   send_queue_max_msgs,
+                                       size_t                   send_queue_max_bytes,
+                                       const CompressionConfig& compression)
     : IWebsocketServer(),
       m_listener(nullptr),
+      m_listener_mutex(),
       m_thread(nullptr),
+      m_stopped_thread(nullptr),
       m_end(false),
+      m_service_threads_count(service_threads_count),
+      m_send_queue_max_msgs(((send_queue_max_msgs == 0) || (send_queue_max_msgs > SEND_QUEUE_SIZE)) ? SEND_QUEUE_SIZE : send_queue_max_msgs),
+      m_send_queue_max_bytes(send_queue_max_bytes),
       m_url(),
       m_protocol(""),
       m_credentials(),
+      m_deflate(compression, &LibWebsocketServer::extensionCallback),
       m_context(nullptr),
       m_logs_context(),
       m_wsi(nullptr),
       m_retry_policy(),
       m_protocols(),
-      m_connecting_ip_address(nullptr),
-      m_clients()
+      m_service_contexts()
 {
 }
 /** @brief Destructor */
@@ -54,6 +65,12 @@ LibWebsocketServer::~LibWebsocketServer()
 {
     // To prevent keeping a started server in background
     stop();
+    if (!joinStoppedThread())
+    {
+        // Destroyed from a service thread, the internal thread will end on its own
+        m_stopped_thread->detach();
+        delete m_stopped_thread;
+    }
 }
 
 /** @copydoc bool IWebsocketServer::start(const std::string&, const std::string&, const Credentials&,
@@ -65,8 +82,8 @@ bool LibWebsocketServer::start(const std::string&        url,
 {
     bool ret = false;
 
-    // Check if thread is alive and if a listener has been registered
-    if (!m_thread && m_listener)
+    // Check if thread is alive, if a previous stop has completed and if a listener has been registered
+    if (!m_thread && joinStoppedThread() && m_listener)
     {
         // Check URL
         m_url = url;
@@ -102,7 +119,8 @@ bool LibWebsocketServer::start(const std::string&        url,
             memset(&info, 0, sizeof info);
             info.options = LWS_SERVER_OPTION_DO_SSL_GLOBAL_INIT | LWS_SERVER_OPTION_SKIP_SERVER_CANONICAL_NAME |
                            LWS_SERVER_OPTION_HTTP_HEADERS_SECURITY_BEST_PRACTICES_ENFORCE;
-            info.log_cx = &m_logs_context;
+            info.log_cx        = &m_logs_context;
+            info.count_threads = m_service_threads_count;
             if (m_url.port() != 0)
             {
                 info.port = static_cast<int>(m_url.port());
@@ -121,6 +139,7 @@ bool LibWebsocketServer::start(const std::string&        url,
             }
             info.protocols             = &m_protocols[0];
             info.retry_and_idle_policy = &m_retry_policy;
+            info.extensions            = m_deflate.extensions();
             m_credentials              = credentials;
             if (m_url.protocol() == "wss")
             {
@@ -186,6 +205,14 @@ bool LibWebsocketServer::start(const std::string&        url,
             m_context = lws_create_context(&info);
             if (m_context)
             {
+                // Allocate a context for each service thread
+                // => libwebsockets may have limited the number of service threads
+                m_service_contexts.clear();
+                for (int tsi = 0; tsi < lws_get_count_threads(m_context); tsi++)
+                {
+                    m_service_contexts.emplace_back(new ServiceContext(tsi));
+                }
+
                 // Start server
                 m_end    = false;
                 m_thread = new std::thread(std::bind(&LibWebsocketServer::process, this));
@@ -208,15 +235,18 @@ bool LibWebsocketServer::stop()
         // Stop thread
         m_end = true;
         lws_cancel_service(m_context);
-        if (std::this_thread::get_id() != m_thread->get_id())
+        if (server != this)
         {
             m_thread->join();
+            delete m_thread;
         }
         else
         {
-            m_thread->detach();
+            // Called from a service thread (listener callback or service error) :
+            // the internal thread waits for all the service threads to end so it can't be joined here,
+            // it will be joined by the next start or by the destructor
+            m_stopped_thread = m_thread;
         }
-        delete m_thread;
         m_thread = nullptr;
         ret      = true;
     }
@@ -230,8 +260,61 @@ void LibWebsocketServer::registerListener(IListener& listener)
     m_listener = &listener;
 }
 
+/** @brief Join the internal thread of a server stopped from one of its service threads */
+bool LibWebsocketServer::joinStoppedThread()
+{
+    bool ret = true;
+
+    if (m_stopped_thread)
+    {
+        if (server != this)
+        {
+            m_stopped_thread->join();
+            delete m_stopped_thread;
+            m_stopped_thread = nullptr;
+        }
+        else
+        {
+            ret = false;
+        }
+    }
+
+    return ret;
+}
+
 /** @brief Internal thread */
 void LibWebsocketServer::process()
+{
+    // Start the additional service threads
+    for (size_t i = 1u; i < m_service_contexts.size(); i++)
+    {
+        ServiceContext& service_context = *m_service_contexts[i];
+        service_context.thread          = new std::thread(std::bind(&LibWebsocketServer::service, this, std::ref(service_context)));
+    }
+
+    // Event loop of the first service thread
+    service(*m_service_contexts[0]);
+
+    // Wait for the end of the additional service threads
+    for (size_t i = 1u; i < m_service_contexts.size(); i++)
+    {
+        ServiceContext& service_context = *m_service_contexts[i];
+        service_context.thread->join();
+        delete service_context.thread;
+        service_context.thread = nullptr;
+    }
+
+    // Destroy context
+    std::this_thread::sleep_for(std::chrono::milliseconds(50)); // Ensure stop caller is joining
+    lws_context_destroy(m_context);
+    for (auto& service_context : m_service_contexts)
+    {
+        service_context->waiting_send_queue.clear();
+    }
+}
+
+/** @brief Event loop of a service thread */
+void LibWebsocketServer::service(ServiceContext& service_context)
 {
     // Save this pointer for further callbacks
     server = this;
@@ -248,17 +331,27 @@ void LibWebsocketServer::process()
     int ret = 0;
     while (!m_end && (ret >= 0))
     {
-        ret = lws_service(m_context, 0);
+        ret = lws_service_tsi(m_context, 0, service_context.tsi);
     }
-    if (!m_end)
+    if (!m_end.exchange(true))
     {
         stop();
+        std::lock_guard<std::mutex> lock(m_listener_mutex);
         m_listener->wsServerError();
     }
+}
 
-    // Destroy context
-    std::this_thread::sleep_for(std::chrono::milliseconds(50)); // Ensure stop caller is joining
-    lws_context_destroy(m_context);
+/** @brief Check the credentials of a connecting client */
+bool LibWebsocketServer::checkCredentials(const char* uri, const std::string& user, const std::string& password)
+{
+    std::lock_guard<std::mutex> lock(m_listener_mutex);
+    return m_listener->wsCheckCredentials(uri, user, password);
+}
+
+/** @brief Get the context of the service thread which owns a socket */
+LibWebsocketServer::ServiceContext& LibWebsocketServer::getServiceContext(struct lws* wsi)
+{
+    return *m_service_contexts[static_cast<size_t>(lws_get_tsi(wsi))];
 }
 
 /** @brief libwebsockets event callback */
@@ -282,17 +375,22 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
             // => Save the current IP address so it can be retrieved
             //    in the LWS_CALLBACK_WSI_CREATE calls which happens
             //    during the same event loop processing
-            server->m_connecting_ip_address = new char[64u];
-            lws_sa46_write_numeric_address(reinterpret_cast<lws_sockaddr46*>(&filter->cli_addr), server->m_connecting_ip_address, 64u);
+            connecting_ip_address = new char[64u];
+            lws_sa46_write_numeric_address(reinterpret_cast<lws_sockaddr46*>(&filter->cli_addr), connecting_ip_address, 64u);
 
             // Notify user
-            if (!server->m_listener->wsAcceptConnection(server->m_connecting_ip_address))
+            bool accepted;
+            {
+                std::lock_guard<std::mutex> lock(server->m_listener_mutex);
+                accepted = server->m_listener->wsAcceptConnection(connecting_ip_address);
+            }
+            if (!accepted)
             {
                 // Disconnect
                 ret = -1;
 
                 // Release memory
-                delete[] server->m_connecting_ip_address;
+                delete[] connecting_ip_address;
             }
         }
         break;
@@ -302,7 +400,7 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
             // Set client IP address
             // => Must be done here to ensure that the event loop is still working
             //    with the same client as in the LWS_CALLBACK_FILTER_NETWORK_CONNECTION call
-            lws_set_wsi_user(wsi, server->m_connecting_ip_address);
+            lws_set_wsi_user(wsi, connecting_ip_address);
         }
         break;
 
@@ -332,7 +430,7 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
                             lwsl_warn("missing basic authent header\n");
 
                             // Notify connection without credentials
-                            authorized = server->m_listener->wsCheckCredentials(uri, "", "");
+                            authorized = server->checkCredentials(uri, "", "");
                         }
                         else
                         {
@@ -355,7 +453,7 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
                                     lwsl_err("auth missing basic: %s\n", b64);
 
                                     // Notify connection without credentials
-                                    authorized = server->m_listener->wsCheckCredentials(uri, "", "");
+                                    authorized = server->checkCredentials(uri, "", "");
                                 }
                                 else
                                 {
@@ -382,7 +480,7 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
                                             std::string username(plain, static_cast<size_t>(pcolon - plain));
                                             std::string password(pcolon + 1u, m - (username.size() + 1u));
                                             password.resize(m - (username.size() + 1u));
-                                            authorized = server->m_listener->wsCheckCredentials(uri, username, password);
+                                            authorized = server->checkCredentials(uri, username, password);
                                         }
                                     }
                                 }
@@ -430,14 +528,24 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
         }
         break;
 
+        case LWS_CALLBACK_CONFIRM_EXTENSION_OKAY:
+        {
+            // Check the compression parameters offered by the client
+            ret = (server->m_deflate.acceptOffer(wsi) ? 0 : 1);
+        }
+        break;
+
         case LWS_CALLBACK_ESTABLISHED:
         {
             // Get client IP address
             char* ip_address = reinterpret_cast<char*>(lws_wsi_user(wsi));
 
             // Instanciate a new client
-            std::shared_ptr<IClient> client(new Client(wsi, ip_address));
-            server->m_clients[wsi] = client;
+            // => The client is pinned to the service thread which owns the socket
+            ServiceContext&          service_context = server->getServiceContext(wsi);
+            std::shared_ptr<IClient> client(
+                new Client(service_context, wsi, ip_address, server->m_send_queue_max_msgs, server->m_send_queue_max_bytes));
+            service_context.clients[wsi] = client;
 
             // Notify connection
             const size_t uri_size = lws_hdr_total_length(wsi, WSI_TOKEN_GET_URI) + 1;
@@ -446,7 +554,10 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
             {
                 uri[0] = 0;
             }
-            server->m_listener->wsClientConnected(uri, client);
+            {
+                std::lock_guard<std::mutex> lock(server->m_listener_mutex);
+                server->m_listener->wsClientConnected(uri, client);
+            }
             delete[] uri;
         }
         break;
@@ -454,8 +565,9 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
         case LWS_CALLBACK_CLOSED:
         {
             // Get corresponding client
-            auto iter_client = server->m_clients.find(wsi);
-            if (iter_client != server->m_clients.end())
+            ServiceContext& service_context = server->getServiceContext(wsi);
+            auto            iter_client     = service_context.clients.find(wsi);
+            if (iter_client != service_context.clients.end())
             {
                 Client* client = dynamic_cast<Client*>(iter_client->second.get());
 
@@ -477,15 +589,17 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
             char* ip_address = reinterpret_cast<char*>(lws_wsi_user(wsi));
 
             // Get corresponding client
-            auto iter_client = server->m_clients.find(wsi);
-            if (iter_client != server->m_clients.end())
+            ServiceContext& service_context = server->getServiceContext(wsi);
+            auto            iter_client     = service_context.clients.find(wsi);
+            if (iter_client != service_context.clients.end())
             {
                 // Remove client
-                server->m_clients.erase(iter_client);
+                service_context.clients.erase(iter_client);
             }
             else
             {
                 // Connection failed to be established
+                std::lock_guard<std::mutex> lock(server->m_listener_mutex);
                 server->m_listener->wsClientFailedToConnect(ip_address);
             }
 
@@ -496,13 +610,21 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
 
         case LWS_CALLBACK_EVENT_WAIT_CANCELLED:
         {
-            // Trigger close or send
-            for (const auto& iter_client : server->m_clients)
+            // Trigger close or send only for the clients of this service thread which have requested it
+            ServiceContext& service_context = server->getServiceContext(wsi);
+            struct lws*     waiting_wsi     = nullptr;
+            while (service_context.waiting_send_queue.pop(waiting_wsi, 0))
             {
-                Client* client = dynamic_cast<Client*>(iter_client.second.get());
-                if (!client->m_connected || !client->m_send_msgs.empty())
+                auto iter_client = service_context.clients.find(waiting_wsi);
+                if (iter_client != service_context.clients.end())
                 {
-                    lws_callback_on_writable(client->m_wsi);
+                    Client* client = dynamic_cast<Client*>(iter_client->second.get());
+                    if (client)
+                    {
+                        // Further sends must schedule a new write
+                        client->m_send_scheduled = false;
+                        lws_callback_on_writable(client->m_wsi);
+                    }
                 }
             }
         }
@@ -511,30 +633,31 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
         case LWS_CALLBACK_SERVER_WRITEABLE:
         {
             // Get corresponding client
-            auto iter_client = server->m_clients.find(wsi);
-            if (iter_client != server->m_clients.end())
+            ServiceContext& service_context = server->getServiceContext(wsi);
+            auto            iter_client     = service_context.clients.find(wsi);
+            if (iter_client != service_context.clients.end())
             {
                 Client* client = dynamic_cast<Client*>(iter_client->second.get());
                 if (client->m_connected)
                 {
                     // Send data if any ready
-                    bool     error = false;
-                    SendMsg* msg   = nullptr;
-                    while (client->m_send_msgs.pop(msg, 0) && !error)
+                    if (!client->writeQueuedMessages(server->m_deflate.isEnabled()))
                     {
-                        if (lws_write(client->m_wsi, msg->payload, msg->size, LWS_WRITE_TEXT) < static_cast<int>(msg->size))
+                        // Error
+                        client->disconnect(true);
+                        if (client->m_listener)
                         {
-                            // Error
-                            client->disconnect(true);
-                            if (client->m_listener)
-                            {
-                                client->m_listener->wsClientError();
-                            }
-                            error = true;
+                            client->m_listener->wsClientError();
+                        }
+                    }
+                    else if (client->m_write_blocked && (client->m_queued_msgs <= (client->m_max_msgs / 2u)) &&
+                             ((client->m_max_bytes == 0) || (client->m_queued_bytes <= (client->m_max_bytes / 2u))))
+                    {
+                        // Send queue has drained below half of its limits, notify that new data can be sent
+                        if (client->m_write_blocked.exchange(false) && client->m_listener)
+                        {
+                            client->m_listener->wsClientWritable();
                         }
-
-                        // Free message memory
-                        delete msg;
                     }
                 }
                 else
@@ -550,8 +673,9 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
         case LWS_CALLBACK_RECEIVE:
         {
             // Get corresponding client
-            auto iter_client = server->m_clients.find(wsi);
-            if (iter_client != server->m_clients.end())
+            ServiceContext& service_context = server->getServiceContext(wsi);
+            auto            iter_client     = service_context.clients.find(wsi);
+            if (iter_client != service_context.clients.end())
             {
                 Client* client = dynamic_cast<Client*>(iter_client->second.get());
                 if (client->m_listener)
@@ -563,7 +687,10 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
                     if (is_first && is_last)
                     {
                         // Notify client
-                        client->m_listener->wsClientDataReceived(in, len);
+                        // => The listener takes the ownership of a copy of the frame
+                        client->beginFragmentedFrame(len);
+                        client->appendFragmentedData(in, len);
+                        client->m_listener->wsClientDataReceived(client->detachFragmentedFrame(), len);
                     }
                     else if (is_first)
                     {
@@ -578,10 +705,9 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
                         if (is_last)
                         {
                             // Notify client
-                            client->m_listener->wsClientDataReceived(client->getFragmentedFrame(), client->getFragmentedFrameSize());
-
-                            // Release resources
-                            client->releaseFragmentedFrame();
+                            // => The listener takes the ownership of the reassembled frame, no copy needed
+                            size_t frame_size = client->getFragmentedFrameSize();
+                            client->m_listener->wsClientDataReceived(client->detachFragmentedFrame(), frame_size);
                         }
                     }
                 }
@@ -596,16 +722,52 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
     return ret;
 }
 
+/** @brief libwebsockets extension callback */
+int LibWebsocketServer::extensionCallback(struct lws_context*                context,
+                                          const struct lws_extension*        ext,
+                                          struct lws*                        wsi,
+                                          enum lws_extension_callback_reasons reason,
+                                          void*                              user,
+                                          void*                              in,
+                                          size_t                             len)
+{
+    // Get corresponding client, if any
+    LibWebsocketDeflate::Counters* counters = nullptr;
+    if (wsi)
+    {
+        ServiceContext& service_context = server->getServiceContext(wsi);
+        auto            iter_client     = service_context.clients.find(wsi);
+        if (iter_client != service_context.clients.end())
+        {
+            Client* client = dynamic_cast<Client*>(iter_client->second.get());
+            counters       = &client->m_deflate_counters;
+        }
+    }
+
+    return LibWebsocketDeflate::process(counters, context, ext, wsi, reason, user, in, len);
+}
+
 /** @brief Constructor */
-LibWebsocketServer::Client::Client(struct lws* wsi, const char* ip_address)
-    : m_wsi(wsi),
+LibWebsocketServer::Client::Client(ServiceContext& service_context, struct lws* wsi, const char* ip_address, size_t max_msgs, size_t max_bytes)
+    : m_service_context(service_context),
+      m_wsi(wsi),
       m_ip_address(ip_address),
       m_connected(true),
       m_listener(nullptr),
       m_send_msgs(),
       m_fragmented_frame(nullptr),
       m_fragmented_frame_size(0),
-      m_fragmented_frame_index(0)
+      m_fragmented_frame_index(0),
+      m_send_scheduled(false),
+      m_max_msgs(max_msgs),
+      m_max_bytes(max_bytes),
+      m_queued_msgs(0),
+      m_queued_bytes(0),
+      m_write_blocked(false),
+      m_choked(false),
+      m_dropped_frames(0),
+      m_deferred_frames(0),
+      m_deflate_counters()
 {
 }
 /** @brief Destructor */
@@ -638,14 +800,15 @@ bool LibWebsocketServer::Client::disconnect(bool notify_disconnected)
         }
 
         // Schedule a close
-        lws_cancel_service_pt(m_wsi);
+        scheduleSend();
     }
 
     // Empty message queue
     SendMsg* msg = nullptr;
     while (m_send_msgs.pop(msg, 0))
     {
-        delete msg;
+        releaseSendMsg(msg);
+        m_dropped_frames++;
     }
 
     return ret;
@@ -657,20 +820,64 @@ bool LibWebsocketServer::Client::isConnected()
     return m_connected;
 }
 
-/** @copydoc bool IClient::send(const void*, size_t) */
-bool LibWebsocketServer::Client::send(const void* data, size_t size)
+/** @copydoc SendResult IClient::send(const void*, size_t) */
+IWebsocketServer::IClient::SendResult LibWebsocketServer::Client::send(const void* data, size_t size)
 {
-    bool ret = false;
+    SendFrame frame(size);
+    frame.append(data, size);
+    return send(std::move(frame));
+}
+
+/** @copydoc SendResult IClient::send(SendFrame&&) */
+IWebsocketServer::IClient::SendResult LibWebsocketServer::Client::send(SendFrame&& frame)
+{
+    SendResult ret = SendResult::FAILED;
 
     // Check if connected
     if (m_connected)
     {
-        // Prepare data to send
-        SendMsg* msg = new SendMsg(data, size);
-        ret          = m_send_msgs.push(msg);
+        // Reserve room in the send queue
+        // => A single message bigger than the byte limit is accepted when nothing else is waiting
+        //    to be sent, otherwise it could never be sent
+        size_t size         = frame.size();
+        size_t queued_msgs  = m_queued_msgs.fetch_add(1u) + 1u;
+        size_t queued_bytes = m_queued_bytes.fetch_add(size) + size;
+        bool   accepted     = (queued_msgs <= m_max_msgs) && ((m_max_bytes == 0) || (queued_bytes <= m_max_bytes) || (queued_msgs == 1u));
+        if (accepted)
+        {
+            // Prepare data to send
+            SendMsg* msg = new SendMsg(frame);
+            accepted     = m_send_msgs.push(msg);
+            if (accepted)
+            {
+                if (m_choked)
+                {
+                    m_deferred_frames++;
+                }
+            }
+            else
+            {
+                delete msg;
+            }
+        }
+        if (accepted)
+        {
+            ret = SendResult::SENT;
+        }
+        else
+        {
+            // Too much data waiting to be sent, the caller will be notified when the queue has drained
+            m_queued_msgs--;
+            m_queued_bytes -= size;
+            m_write_blocked = true;
+            m_dropped_frames++;
+            ret = SendResult::WOULD_BLOCK;
+        }
 
         // Schedule a send
-        lws_cancel_service_pt(m_wsi);
+        // => Also needed when the send is rejected since the queue may have been drained in the meantime
+        //    and the writable notification must not be missed
+        scheduleSend();
     }
 
     return ret;
@@ -682,6 +889,61 @@ void LibWebsocketServer::Client::registerListener(IClient::IListener& listener)
     m_listener = &listener;
 }
 
+/** @brief Add the client to the waiting send queue and wakeup the event loop */
+void LibWebsocketServer::Client::scheduleSend()
+{
+    // Wakeup the event loop of the owning service thread only once until the pending data has been processed
+    if (!m_send_scheduled.exchange(true))
+    {
+        m_service_context.waiting_send_queue.push(m_wsi);
+        lws_cancel_service_pt(m_wsi);
+    }
+}
+
+/** @brief Write the queued messages until the socket is choked */
+bool LibWebsocketServer::Client::writeQueuedMessages(bool single_message)
+{
+    bool     ret     = true;
+    bool     written = false;
+    SendMsg* msg     = nullptr;
+
+    // Do not write more than the socket can accept to not let libwebsockets buffer the remaining data,
+    // the messages stay in the bounded send queue until the socket is writable again
+    bool choked = (lws_send_pipe_choked(m_wsi) != 0);
+    while (ret && !choked && !(single_message && written) && m_send_msgs.pop(msg, 0))
+    {
+        if (lws_write(m_wsi, msg->payload, msg->size, LWS_WRITE_TEXT) < static_cast<int>(msg->size))
+        {
+            ret = false;
+        }
+
+        // Free message memory
+        releaseSendMsg(msg);
+
+        choked  = (lws_send_pipe_choked(m_wsi) != 0);
+        written = true;
+    }
+    if (ret)
+    {
+        m_choked = choked;
+        if ((choked || single_message) && !m_send_msgs.empty())
+        {
+            // Wait for the socket to be writable again
+            lws_callback_on_writable(m_wsi);
+        }
+    }
+
+    return ret;
+}
+
+/** @brief Release a message removed from the send queue */
+void LibWebsocketServer::Client::releaseSendMsg(SendMsg* msg)
+{
+    m_queued_bytes -= msg->size;
+    m_queued_msgs--;
+    delete msg;
+}
+
 /** @brief Prepare the buffer to store a new fragmented frame */
 void LibWebsocketServer::Client::beginFragmentedFrame(size_t frame_size)
 {
@@ -689,20 +951,29 @@ void LibWebsocketServer::Client::beginFragmentedFrame(size_t frame_size)
     releaseFragmentedFrame();
 
     // Allocate new buffer
-    m_fragmented_frame      = new uint8_t[frame_size];
-    m_fragmented_frame_size = frame_size;
+    // => Null terminated to allow in-situ parsing by the listener
+    m_fragmented_frame             = new char[frame_size + 1u];
+    m_fragmented_frame[frame_size] = 0;
+    m_fragmented_frame_size        = frame_size;
 }
 
 /** @brief Append data to the fragmented frame */
 void LibWebsocketServer::Client::appendFragmentedData(const void* data, size_t size)
 {
-    size_t copy_len = size;
-    if ((m_fragmented_frame_index + size) >= m_fragmented_frame_size)
+    // Grow the buffer if needed
+    // => The remaining payload length announced at the beginning of a compressed frame
+    //    is the compressed one, the decompressed data can be bigger
+    if ((m_fragmented_frame_index + size) > m_fragmented_frame_size)
     {
-        copy_len = m_fragmented_frame_size - m_fragmented_frame_index;
+        size_t frame_size = std::max(2u * m_fragmented_frame_size, m_fragmented_frame_index + size);
+        char*  frame      = new char[frame_size + 1u];
+        memcpy(frame, m_fragmented_frame, m_fragmented_frame_index);
+        delete[] m_fragmented_frame;
+        m_fragmented_frame      = frame;
+        m_fragmented_frame_size = frame_size;
     }
-    memcpy(&m_fragmented_frame[m_fragmented_frame_index], data, copy_len);
-    m_fragmented_frame_index += copy_len;
+    memcpy(&m_fragmented_frame[m_fragmented_frame_index], data, size);
+    m_fragmented_frame_index += size;
 }
 
 /** @brief Release the memory associated with the fragmented frame */
@@ -714,5 +985,15 @@ void LibWebsocketServer::Client::releaseFragmentedFrame()
     m_fragmented_frame_index = 0;
 }
 
+/** @brief Transfer the ownership of the fragmented frame */
+std::unique_ptr<char[]> LibWebsocketServer::Client::detachFragmentedFrame()
+{
+    m_fragmented_frame[m_fragmented_frame_index] = 0;
+    std::unique_ptr<char[]> frame(m_fragmented_frame);
+    m_fragmented_frame = nullptr;
+    releaseFragmentedFrame();
+    return frame;
+}
+
 } // namespace websockets
 } // namespace ocpp
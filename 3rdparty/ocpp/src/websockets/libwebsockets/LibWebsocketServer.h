@@ -20,15 +20,19 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #define OPENOCPP_LIBWEBSOCKETSERVER_H
 
 #include "IWebsocketServer.h"
+#include "LibWebsocketDeflate.h"
+#include "LockFreeQueue.h"
 #include "Queue.h"
 #include "Url.h"
 #include "websockets.h"
 
 #include <array>
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 namespace ocpp
 {
@@ -39,8 +43,17 @@ namespace websockets
 class LibWebsocketServer : public IWebsocketServer
 {
   public:
-    /** @brief Constructor */
-    LibWebsocketServer();
+    /**
+     * @brief Constructor
+     * @param service_threads_count Number of threads servicing the websocket connections (0 = 1 thread)
+     * @param send_queue_max_msgs Maximum number of messages waiting to be sent on a connection (0 or more than SEND_QUEUE_SIZE = SEND_QUEUE_SIZE)
+     * @param send_queue_max_bytes Maximum number of bytes waiting to be sent on a connection (0 = no limit)
+     * @param compression permessage-deflate compression parameters
+     */
+    LibWebsocketServer(unsigned int             service_threads_count = 1u,
+                       size_t                   send_queue_max_msgs   = 0u,
+                       size_t                   send_queue_max_bytes  = 0u,
+                       const CompressionConfig& compression           = CompressionConfig());
     /** @brief Destructor */
     virtual ~LibWebsocketServer();
 
@@ -61,13 +74,12 @@ class LibWebsocketServer : public IWebsocketServer
     /** @brief Message to send */
     struct SendMsg
     {
-        /** @brief Constructor */
-        SendMsg(const void* _data, size_t _size)
+        /** @brief Constructor, takes the ownership of the frame buffer */
+        SendMsg(SendFrame& frame)
         {
-            data    = new unsigned char[LWS_PRE + _size];
-            size    = _size;
-            payload = &data[LWS_PRE];
-            memcpy(payload, _data, size);
+            size    = frame.size();
+            data    = frame.release();
+            payload = &data[SendFrame::HEADER_SIZE];
         }
         /** @brief Destructor */
         virtual ~SendMsg() { delete[] data; }
@@ -80,6 +92,25 @@ class LibWebsocketServer : public IWebsocketServer
         size_t size;
     };
 
+    /** @brief Maximum number of messages waiting to be sent on a connection */
+    static constexpr size_t SEND_QUEUE_SIZE = 256u;
+
+    /** @brief Service thread context, each client connection is pinned to a single service thread */
+    struct ServiceContext
+    {
+        /** @brief Constructor */
+        ServiceContext(int _tsi) : tsi(_tsi), thread(nullptr), clients(), waiting_send_queue() { }
+
+        /** @brief Service thread index */
+        int tsi;
+        /** @brief Service thread (the first service thread is the internal thread of the server) */
+        std::thread* thread;
+        /** @brief Connected clients */
+        std::unordered_map<struct lws*, std::shared_ptr<IClient>> clients;
+        /** @brief Queue of client sockets waiting to send data or to be closed */
+        ocpp::helpers::Queue<struct lws*> waiting_send_queue;
+    };
+
     /** @brief Websocket client connection */
     class Client : public IClient
     {
@@ -88,10 +119,13 @@ class LibWebsocketServer : public IWebsocketServer
       public:
         /**
          * @brief Constructor
+         * @param service_context Context of the service thread which owns the client
          * @param wsi Client socket
          * @param ip_address IP address
+         * @param max_msgs Maximum number of messages waiting to be sent
+         * @param max_bytes Maximum number of bytes waiting to be sent (0 = no limit)
         */
-        Client(struct lws* wsi, const char* ip_address);
+        Client(ServiceContext& service_context, struct lws* wsi, const char* ip_address, size_t max_msgs, size_t max_bytes);
         /** @brief Destructor */
         virtual ~Client();
 
@@ -104,17 +138,29 @@ class LibWebsocketServer : public IWebsocketServer
         /** @copydoc bool IClient::isConnected() */
         bool isConnected() override;
 
-        /** @copydoc bool IClient::send(const void*, size_t) */
-        bool send(const void* data, size_t size) override;
+        /** @copydoc SendResult IClient::send(const void*, size_t) */
+        SendResult send(const void* data, size_t size) override;
+
+        /** @copydoc SendResult IClient::send(SendFrame&&) */
+        SendResult send(SendFrame&& frame) override;
+
+        /** @copydoc uint64_t IClient::droppedFramesCount() const */
+        uint64_t droppedFramesCount() const override { return m_dropped_frames; }
+
+        /** @copydoc uint64_t IClient::deferredFramesCount() const */
+        uint64_t deferredFramesCount() const override { return m_deferred_frames; }
+
+        /** @copydoc CompressionStats IClient::compressionStats() const */
+        CompressionStats compressionStats() const override { return m_deflate_counters.stats(); }
 
         /** @copydoc bool IClient::registerListener(IListener&) */
         void registerListener(IClient::IListener& listener) override;
 
         /**
-         * @brief Get the size in bytes of the fragmented frame
-         * @return Size in bytes of the fragmented frame
+         * @brief Get the size in bytes of the data received in the fragmented frame
+         * @return Size in bytes of the data received in the fragmented frame
          */
-        size_t getFragmentedFrameSize() const { return m_fragmented_frame_size; }
+        size_t getFragmentedFrameSize() const { return m_fragmented_frame_index; }
 
         /**
          * @brief Get the fragmented frame
@@ -138,7 +184,15 @@ class LibWebsocketServer : public IWebsocketServer
         /** @brief Release the memory associated with the fragmented frame */
         void releaseFragmentedFrame();
 
+        /**
+         * @brief Transfer the ownership of the fragmented frame
+         * @return Null terminated fragmented frame
+         */
+        std::unique_ptr<char[]> detachFragmentedFrame();
+
       private:
+        /** @brief Context of the service thread which owns the client */
+        ServiceContext& m_service_context;
         /** @brief Client socket */
         struct lws* m_wsi;
         /** @brief IP address */
@@ -148,27 +202,76 @@ class LibWebsocketServer : public IWebsocketServer
         /** @brief Listener */
         IClient::IListener* m_listener;
         /** @brief Queue of messages to send */
-        ocpp::helpers::Queue<SendMsg*> m_send_msgs;
+        ocpp::helpers::LockFreeQueue<SendMsg*, SEND_QUEUE_SIZE> m_send_msgs;
         /** @brief Buffer to store fragmented frames */
-        uint8_t* m_fragmented_frame;
+        char* m_fragmented_frame;
         /** @brief Size of the fragmented frame */
         size_t m_fragmented_frame_size;
         /** @brief Current index in the fragmented frame */
         size_t m_fragmented_frame_index;
+        /** @brief Indicate if the client is already in the waiting send queue */
+        std::atomic<bool> m_send_scheduled;
+        /** @brief Maximum number of messages waiting to be sent */
+        const size_t m_max_msgs;
+        /** @brief Maximum number of bytes waiting to be sent (0 = no limit) */
+        const size_t m_max_bytes;
+        /** @brief Number of messages waiting to be sent */
+        std::atomic<size_t> m_queued_msgs;
+        /** @brief Number of bytes waiting to be sent */
+        std::atomic<size_t> m_queued_bytes;
+        /** @brief Indicate if a send operation has been rejected since the send queue has last drained */
+        std::atomic<bool> m_write_blocked;
+        /** @brief Indicate if the socket was choked on the last write attempt */
+        std::atomic<bool> m_choked;
+        /** @brief Number of dropped frames */
+        std::atomic<uint64_t> m_dropped_frames;
+        /** @brief Number of deferred frames */
+        std::atomic<uint64_t> m_deferred_frames;
+        /** @brief Compression counters */
+        LibWebsocketDeflate::Counters m_deflate_counters;
+
+        /** @brief Add the client to the waiting send queue and wakeup the event loop */
+        void scheduleSend();
+
+        /**
+         * @brief Write the queued messages until the socket is choked
+         * @param single_message Write only one message (the compression extension may need
+         *                       further writable events to flush a message)
+         * @return true if the messages have been written or are waiting for the socket to be writable, false on write error
+         */
+        bool writeQueuedMessages(bool single_message);
+
+        /**
+         * @brief Release a message removed from the send queue
+         * @param msg Message to release
+         */
+        void releaseSendMsg(SendMsg* msg);
     };
 
     /** @brief Listener */
     IListener* m_listener;
+    /** @brief Mutex to serialize the listener notifications of the service threads */
+    std::mutex m_listener_mutex;
     /** @brief Internal thread */
     std::thread* m_thread;
+    /** @brief Internal thread of a server stopped from one of its service threads, waiting to be joined */
+    std::thread* m_stopped_thread;
     /** @brief Indicate the end of processing to the thread */
-    bool m_end;
+    std::atomic<bool> m_end;
+    /** @brief Number of requested service threads */
+    unsigned int m_service_threads_count;
+    /** @brief Maximum number of messages waiting to be sent on a connection */
+    size_t m_send_queue_max_msgs;
+    /** @brief Maximum number of bytes waiting to be sent on a connection (0 = no limit) */
+    size_t m_send_queue_max_bytes;
     /** @brief Connection URL */
     Url m_url;
     /** @brief Name of the protocol to use */
     std::string m_protocol;
     /** @brief Credentials */
     Credentials m_credentials;
+    /** @brief permessage-deflate extension */
+    LibWebsocketDeflate m_deflate;
 
     /** @brief Websocket context */
     struct lws_context* m_context;
@@ -180,17 +283,51 @@ class LibWebsocketServer : public IWebsocketServer
     lws_retry_bo_t m_retry_policy;
     /** @brief Protocols */
     std::array<struct lws_protocols, 2u> m_protocols;
-    /** @brief IP address of the currently connecting client */
-    char* m_connecting_ip_address;
-
-    /** @brief Connected clients */
-    std::unordered_map<struct lws*, std::shared_ptr<IClient>> m_clients;
+    /** @brief Service thread contexts */
+    std::vector<std::unique_ptr<ServiceContext>> m_service_contexts;
 
     /** @brief Internal thread */
     void process();
 
+    /**
+     * @brief Join the internal thread of a server stopped from one of its service threads
+     * @return true if there is no internal thread left to join, false if called from a service thread of the stopped server
+     */
+    bool joinStoppedThread();
+
+    /**
+     * @brief Check the credentials of a connecting client (serialized with the other listener notifications)
+     * @param uri Requested URI
+     * @param user User name
+     * @param password Password
+     * @return true if the credentials are valid, false otherwise
+     */
+    bool checkCredentials(const char* uri, const std::string& user, const std::string& password);
+
+    /**
+     * @brief Event loop of a service thread
+     * @param service_context Context of the service thread
+     */
+    void service(ServiceContext& service_context);
+
+    /**
+     * @brief Get the context of the service thread which owns a socket
+     * @param wsi Socket
+     * @return Context of the owning service thread
+     */
+    ServiceContext& getServiceContext(struct lws* wsi);
+
     /** @brief libwebsockets event callback */
     static int eventCallback(struct lws* wsi, enum lws_callback_reasons reason, void* user, void* in, size_t len);
+
+    /** @brief libwebsockets extension callback */
+    static int extensionCallback(struct lws_context*                context,
+                                 const struct lws_extension*        ext,
+                                 struct lws*                        wsi,
+                                 enum lws_extension_callback_reasons reason,
+                                 void*                              user,
+                                 void*                              in,
+                                 size_t                             len);
 };
 
 } // namespace websockets
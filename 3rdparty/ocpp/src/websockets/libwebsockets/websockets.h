@@ -35,6 +35,11 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #pragma warning(pop)
 #endif // _MSC_VER
 
+#include "SendFrame.h"
+
+/** @brief The frames to send must reserve enough room in front of their payload for the libwebsockets header */
+static_assert(ocpp::websockets::SendFrame::HEADER_SIZE >= LWS_PRE, "SendFrame::HEADER_SIZE is too small for libwebsockets");
+
 /** @brief Log selection for the websocket library */
 #define LIBWEBSOCKET_LOG_FLAGS (LLL_ERR | LLL_WARN | LLL_NOTICE)
 
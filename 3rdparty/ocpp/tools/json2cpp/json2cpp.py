@@ -117,6 +117,12 @@ class TypeField(object):
         self.max = None
         ''' Maximum value of the field '''
 
+        self.min_items = 0
+        ''' Minimum number of items of an array field '''
+
+        self.max_items = 0
+        ''' Maximum number of items of an array field (0 = no limit) '''
+
         self.comment = ""
         ''' Comment of the field '''
 
@@ -129,6 +135,24 @@ class TypeField(object):
             type = f"ocpp::types::Optional<{type}>"
         return type
     
+    def cpp_bounds(self) -> str:
+        '''
+            Get the C++ bounds of a numeric field (empty if the field is not bounded)
+        '''
+        bounds = ""
+        if (self.type == "integer" or self.type == "number") and (self.min is not None or self.max is not None):
+            cpp_type = self.get_cpp_type(self.type, "")
+            if self.min is not None:
+                min = f"{int(self.min)}" if self.type == "integer" else f"{float(self.min)}f"
+            else:
+                min = f"std::numeric_limits<{cpp_type}>::lowest()"
+            if self.max is not None:
+                max = f"{int(self.max)}" if self.type == "integer" else f"{float(self.max)}f"
+            else:
+                max = f"std::numeric_limits<{cpp_type}>::max()"
+            bounds = f"{min}, {max}"
+        return bounds
+
     def cpp_dependencies(self) -> list:
         '''
             Get the C++ dependencies corresponding to the type of the field
@@ -225,6 +249,9 @@ class Message(Type):
         self.types = {}
         ''' Dictionnary of the request and response types '''
 
+        self.is_streamed = False
+        ''' Indicate if the request can be converted while being read from a JSON stream '''
+
 def check_dir_exists(dir, path) -> bool:
     ''' 
         Check if a directory exists
@@ -468,7 +495,16 @@ def parse_type_contents(name, contents, ocpp_version_suffix) -> Type:
                     if "format" in property_definition:
                         if property_definition["format"] == "date-time":
                             field.type = "date-time"
+                elif field.type == "integer" or field.type == "number":
+                    if "minimum" in property_definition:
+                        field.min = property_definition["minimum"]
+                    if "maximum" in property_definition:
+                        field.max = property_definition["maximum"]
                 elif field.type == "array":
+                    if "minItems" in property_definition:
+                        field.min_items = property_definition["minItems"]
+                    if "maxItems" in property_definition:
+                        field.max_items = property_definition["maxItems"]
                     if "$ref" in property_definition["items"]:
                         external_type = property_definition["items"]["$ref"]
                         field.array_type = external_type[external_type.rfind("/") + 1:]
@@ -566,7 +602,7 @@ def gen_ocpp_enum(message, enum, templates, params, ocpp_version_suffix) -> None
     enum_impl.write(rendered_template)
     enum_impl.close()
 
-def gen_ocpp_type(message, type, other_types, templates, params, ocpp_version_suffix) -> None:
+def gen_ocpp_type(message, type, other_types, streamed_types, templates, params, ocpp_version_suffix) -> None:
     ''' 
         Generate the code corresponding to an OCPP type
 
@@ -579,6 +615,9 @@ def gen_ocpp_type(message, type, other_types, templates, params, ocpp_version_su
         @param other_types: OCPP types
         @type other_types: {string,Type}
 
+        @param streamed_types: Names of the OCPP types which can be converted while being read from a JSON stream
+        @type streamed_types: [string]
+
         @param templates: Code templates
         @type templates: {string,string}
 
@@ -595,7 +634,7 @@ def gen_ocpp_type(message, type, other_types, templates, params, ocpp_version_su
 
     env = jinja2.Environment()
     template = env.from_string(templates["type_header"])
-    rendered_template = template.render(message = message, type = type, ocpp_version_namespace = params.ocpp_version, ocpp_version_suffix = ocpp_version_suffix)
+    rendered_template = template.render(message = message, type = type, streamed_types = streamed_types, ocpp_version_namespace = params.ocpp_version, ocpp_version_suffix = ocpp_version_suffix)
 
     type_header.write(rendered_template)
     type_header.close()
@@ -606,23 +645,29 @@ def gen_ocpp_type(message, type, other_types, templates, params, ocpp_version_su
 
     env = jinja2.Environment()
     template = env.from_string(templates["type_impl"])
-    rendered_template = template.render(message = message, type = type, other_types=other_types, ocpp_version_namespace = params.ocpp_version, ocpp_version_suffix = ocpp_version_suffix)
+    rendered_template = template.render(message = message, type = type, other_types=other_types, streamed_types = streamed_types, ocpp_version_namespace = params.ocpp_version, ocpp_version_suffix = ocpp_version_suffix)
 
     type_impl.write(rendered_template)
     type_impl.close()
 
-def gen_ocpp_message(message, templates, params) -> None:
+def gen_ocpp_message(message, streamed_types, templates, params, msg_list) -> None:
     ''' 
         Generate the code corresponding to an OCPP message
 
         @param message: Name of the OCPP message
         @type message: string
 
+        @param streamed_types: Names of the OCPP types which can be converted while being read from a JSON stream
+        @type streamed_types: [string]
+
         @param templates: Code templates
         @type templates: {string,string}
 
         @param params: Command line parameters
         @type params: Parameters
+
+        @param msg_list: List of OCPP messages per roles
+        @type msg_list: {string, [string]}
     '''
 
     # Message object
@@ -630,6 +675,7 @@ def gen_ocpp_message(message, templates, params) -> None:
 
     msg = Message()
     msg.name = f"{message}"
+    msg.is_streamed = message in msg_list.get("streamed", [])
     
     # Parse input files
     request = json.load(open(os.path.join(params.input_dir, f"{ocpp_message}Request.json")))
@@ -657,7 +703,7 @@ def gen_ocpp_message(message, templates, params) -> None:
         if associated_type.basic_type == "enum":
             gen_ocpp_enum(msg, associated_type, templates, params, ocpp_version_suffix)
         else:
-            gen_ocpp_type(msg, associated_type, associated_types, templates, params, ocpp_version_suffix)
+            gen_ocpp_type(msg, associated_type, associated_types, streamed_types, templates, params, ocpp_version_suffix)
 
     # Generate message header file
     msg_header_path = os.path.join(params.messages_dir, ocpp_message + ocpp_version_suffix + ".h")
@@ -676,13 +722,36 @@ def gen_ocpp_message(message, templates, params) -> None:
 
     env = jinja2.Environment()
     template = env.from_string(templates["msg_impl"])
-    rendered_template = template.render(msg = msg, other_types = associated_types, ocpp_version_namespace = params.ocpp_version, ocpp_version_suffix = ocpp_version_suffix)
+    rendered_template = template.render(msg = msg, other_types = associated_types, streamed_types = streamed_types, ocpp_version_namespace = params.ocpp_version, ocpp_version_suffix = ocpp_version_suffix)
 
     msg_impl.write(rendered_template)
     msg_impl.close()
 
     return
 
+def list_streamed_types(params, msg_list) -> list:
+    ''' 
+        List the OCPP types used by the requests which can be converted while being read from a JSON stream
+
+        @param params: Command line parameters
+        @type params: Parameters
+
+        @param msg_list: List of OCPP messages per roles
+        @type msg_list: {string, [string]}
+
+        @return: Names of the OCPP types which can be converted while being read from a JSON stream
+        @rtype: [string]
+    '''
+
+    streamed_types = []
+    for message in msg_list.get("streamed", []):
+        request = json.load(open(os.path.join(params.input_dir, f"{message}Request.json")))
+        for type_name in request["definitions"]:
+            if request["definitions"][type_name]["type"] == "object" and not type_name in streamed_types:
+                streamed_types.append(type_name)
+
+    return streamed_types
+
 def gen_converters(templates, params, msg_list):
     ''' 
         Generate the code for the message converters
@@ -1003,11 +1072,14 @@ if __name__ == '__main__':
             ocpp_messages = [f[:f.find("Request.json")] for f in os.listdir(params.input_dir) if os.path.isfile(os.path.join(params.input_dir, f)) and f.endswith("Request.json")]
             print(f"{len(ocpp_messages)} messages found")
 
+            # List the types which can be converted while being read from a JSON stream
+            streamed_types = list_streamed_types(params, msg_list)
+
             # Generate messages
             gen_converters(templates, params, msg_list)
             for ocpp_message in ocpp_messages:
                 print(f"Generating {ocpp_message} message...")
-                gen_ocpp_message(ocpp_message,templates, params)
+                gen_ocpp_message(ocpp_message, streamed_types, templates, params, msg_list)
 
             # Generate charge point interfaces and classes
             gen_chargepoint(templates, params, msg_list)
@@ -21,7 +21,7 @@ public:
 
   /** @brief Path to the database to store persistent data */
   std::string databasePath() const override { return getString("DatabasePath"); }
-  /** @brief Path to the JSON schemas to validate the messages */
+  /** @brief Path to the JSON schemas to validate the messages (if empty, the messages are only checked by their converters) */
   std::string jsonSchemasPath() const override { return getString("JsonSchemasPath"); }
 
   // Communication parameters
@@ -50,6 +50,28 @@ public:
   std::string tlsServerCertificateCa() const override { return getString("TlsServerCertificateCa"); }
   /** @brief Enable client authentication using certificate */
   bool tlsClientCertificateAuthent() const override { return getBool("TlsClientCertificateAuthent"); }
+  /** @brief Number of threads servicing the websocket connections (0 = 1 thread) */
+  unsigned int webSocketServiceThreadsCount() const override { return get<unsigned int>("WebSocketServiceThreadsCount"); }
+  /** @brief Maximum number of messages waiting to be sent on a websocket connection (0 = default) */
+  unsigned int webSocketSendQueueMaxMessages() const override { return get<unsigned int>("WebSocketSendQueueMaxMessages"); }
+  /** @brief Maximum number of bytes waiting to be sent on a websocket connection (0 = no limit) */
+  unsigned int webSocketSendQueueMaxBytes() const override { return get<unsigned int>("WebSocketSendQueueMaxBytes"); }
+  /** @brief Enable the negotiation of the permessage-deflate compression on the websocket connections */
+  bool webSocketCompression() const override { return getBool("WebSocketCompression"); }
+  /** @brief Only accept the compression if the server resets its compression context after each message */
+  bool webSocketCompressionServerNoContextTakeover() const override { return getBool("WebSocketCompressionServerNoContextTakeover"); }
+  /** @brief Only accept the compression if the client resets its compression context after each message */
+  bool webSocketCompressionClientNoContextTakeover() const override { return getBool("WebSocketCompressionClientNoContextTakeover"); }
+  /** @brief Size in bits of the server's compression window requested by the outgoing connections */
+  unsigned int webSocketCompressionServerMaxWindowBits() const override
+  {
+    return get<unsigned int>("WebSocketCompressionServerMaxWindowBits");
+  }
+  /** @brief Size in bits of the client's compression window requested by the outgoing connections */
+  unsigned int webSocketCompressionClientMaxWindowBits() const override
+  {
+    return get<unsigned int>("WebSocketCompressionClientMaxWindowBits");
+  }
 
   // Logs
 
@@ -63,6 +85,9 @@ public:
   {
     return get<unsigned int>("IncomingRequestsFromCpThreadPoolSize");
   };
+  /** @brief Size of the thread pool running the timer callbacks and the asynchronous jobs
+   *         (0 = number of CPU cores, at least 2) */
+  unsigned int workerThreadPoolSize() const override { return get<unsigned int>("WorkerThreadPoolSize"); }
 
   // Not a stack parameter anymore
 
@@ -7,6 +7,11 @@
 namespace os {
 namespace ocpp {
 
+/** @brief Section name for the transaction journal parameters */
+static const std::string JOURNAL_PARAMS = "Journal";
+/** @brief Section name for the meter values store parameters */
+static const std::string METER_VALUES_PARAMS = "MeterValues";
+
 /** @brief Configuration of the Central System demo */
 class CentralSystemDemoConfig
 {
@@ -22,6 +27,40 @@ class CentralSystemDemoConfig
     /** @brief Heartbeat interval */
     std::chrono::seconds heartbeatInterval() const { return m_stack_config.heartbeatInterval(); }
 
+    /** @brief Directory of the transaction journal segments (empty = journal disabled) */
+    std::string journalPath() const { return m_config.get(JOURNAL_PARAMS, "Path", ""); }
+    /** @brief Size of a transaction journal segment file (bytes) */
+    size_t journalSegmentSize() const { return m_config.get(JOURNAL_PARAMS, "SegmentSize", 64u * 1024u * 1024u).toUInt(); }
+    /** @brief Maximum delay before a journaled event is made durable when nobody waits for it */
+    std::chrono::milliseconds journalGroupCommitInterval() const
+    {
+        return std::chrono::milliseconds(m_config.get(JOURNAL_PARAMS, "GroupCommitInterval", 10u).toUInt());
+    }
+    /** @brief Wait for the journaled TransactionEvent to be durable before answering the charge point */
+    bool journalSyncCommit() const { return m_config.get(JOURNAL_PARAMS, "SyncCommit", true).toBool(); }
+    /** @brief Number of filled transaction journal segments which triggers a compaction (0 = no compaction) */
+    size_t journalCompactionSegments() const { return m_config.get(JOURNAL_PARAMS, "CompactionSegments", 8u).toUInt(); }
+    /** @brief Retention of the ended transactions in the journal */
+    std::chrono::seconds journalEndedRetention() const
+    {
+        return std::chrono::seconds(m_config.get(JOURNAL_PARAMS, "EndedRetention", 30u * 24u * 3600u).toUInt());
+    }
+
+    /** @brief Directory of the meter values data file (empty = meter values only kept in memory) */
+    std::string meterValuesPath() const { return m_config.get(METER_VALUES_PARAMS, "Path", ""); }
+    /** @brief Maximum number of samples in a meter values block */
+    size_t meterValuesBlockSamples() const { return m_config.get(METER_VALUES_PARAMS, "BlockSamples", 1024u).toUInt(); }
+    /** @brief Retention of the 1 minute meter values rollups in memory (at most 1024 minutes) */
+    std::chrono::seconds meterValuesMinuteRollupRetention() const
+    {
+        return std::chrono::seconds(m_config.get(METER_VALUES_PARAMS, "MinuteRollupRetention", 6u * 3600u).toUInt());
+    }
+    /** @brief Retention of the 15 minutes meter values rollups in memory (at most 1024 quarters) */
+    std::chrono::seconds meterValuesQuarterRollupRetention() const
+    {
+        return std::chrono::seconds(m_config.get(METER_VALUES_PARAMS, "QuarterRollupRetention", 72u * 3600u).toUInt());
+    }
+
   private:
     /** @brief Configuration file */
     ::ocpp::helpers::IniFile m_config;
@@ -1,4 +1,5 @@
 #include "DefaultCentralSystemEventsHandler.h"
+#include "IRpc.h"
 #include "PrivateKey.h"
 #include "Sha2.h"
 #include "StringHelpers.h"
@@ -6,6 +7,7 @@
 #include <fstream>
 #include <iostream>
 #include <thread>
+#include <vector>
 
 // With MSVC compiler, the system() call returns directly the command's return value
 #ifdef _MSC_VER
@@ -36,12 +38,57 @@ DefaultCentralSystemEventsHandler::DefaultCentralSystemEventsHandler(CentralSyst
       m_set_pending_status(set_pending_status),
       m_chargepoints(),
       m_pending_chargepoints(),
-      m_accepted_chargepoints()
-{
+      m_accepted_chargepoints(),
+      m_station_states(),
+      m_transaction_journal(),
+      m_journal_sync_commit(config.journalSyncCommit()),
+      m_meter_values(),
+      m_reclaim_mutex(),
+      m_reclaim_cond(),
+      m_reclaim_queue(),
+      m_reclaim_stop(false),
+      m_reclaim_thread()
+{
+    // Transaction journal
+    std::string journal_path = m_config.journalPath();
+    if (!journal_path.empty())
+    {
+        TransactionJournal::Settings settings;
+        settings.segment_size          = m_config.journalSegmentSize();
+        settings.group_commit_interval = m_config.journalGroupCommitInterval();
+        settings.compaction_segments   = m_config.journalCompactionSegments();
+        settings.ended_retention       = m_config.journalEndedRetention();
+        if (m_transaction_journal.open(journal_path, settings))
+        {
+            for (const auto& transaction : m_transaction_journal.ongoingTransactions())
+            {
+                cout << "Ongoing transaction : [" << transaction.station << "] id = " << transaction.transaction_id
+                     << ", evse = " << transaction.evse_id << ", energy = " << (transaction.energy_wh - transaction.energy_start_wh)
+                     << " Wh" << endl;
+            }
+        }
+    }
+
+    // Meter values time series
+    MeterValueStore::Settings meter_values_settings;
+    meter_values_settings.block_samples     = m_config.meterValuesBlockSamples();
+    meter_values_settings.minute_retention  = m_config.meterValuesMinuteRollupRetention();
+    meter_values_settings.quarter_retention = m_config.meterValuesQuarterRollupRetention();
+    m_meter_values.open(m_config.meterValuesPath(), meter_values_settings);
+
+    m_reclaim_thread = std::thread(&DefaultCentralSystemEventsHandler::reclaimThread, this);
 }
 
 /** @brief Destructor */
-DefaultCentralSystemEventsHandler::~DefaultCentralSystemEventsHandler() { }
+DefaultCentralSystemEventsHandler::~DefaultCentralSystemEventsHandler()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_reclaim_mutex);
+        m_reclaim_stop = true;
+    }
+    m_reclaim_cond.notify_one();
+    m_reclaim_thread.join();
+}
 
 // ICentralSystemEventsHandler interface
 
@@ -71,35 +118,80 @@ void DefaultCentralSystemEventsHandler::chargePointConnected(
 {
     cout << "Charge point [" << chargepoint->identifier() << "] connected" << endl;
 
-    std::lock_guard<std::mutex> lock(m_chargepoints_mutex);
-
-    auto iter_chargepoint = m_chargepoints.find(chargepoint->identifier());
-    if (iter_chargepoint == m_chargepoints.end())
+    if (!m_chargepoints.insertIfAbsent(chargepoint->identifier(),
+                                       [&] { return std::shared_ptr<ChargePointRequestHandler>(new ChargePointRequestHandler(*this, chargepoint)); }))
     {
-        m_chargepoints[chargepoint->identifier()] =
-            std::shared_ptr<ChargePointRequestHandler>(new ChargePointRequestHandler(*this, chargepoint));
+        cout << "Charge point [" << chargepoint->identifier() << "] already connected" << endl;
+        chargepoint.reset();
     }
     else
     {
-        cout << "Charge point [" << chargepoint->identifier() << "] already connected" << endl;
-        chargepoint.reset();
+        m_station_states.setConnected(chargepoint->identifier(), true);
     }
 }
 
 /** @brief Remove a charge point from the connected charge points */
 void DefaultCentralSystemEventsHandler::removeChargePoint(const std::string& identifier)
 {
-    std::thread t(
-        [this, identifier = identifier]
+    bool wake_up = false;
+    {
+        std::lock_guard<std::mutex> lock(m_reclaim_mutex);
+
+        // The delay is the same for all the charge points so the queue stays ordered,
+        // the thread only needs to be woken up when it is waiting on an empty queue
+        wake_up = m_reclaim_queue.empty();
+        m_reclaim_queue.emplace_back(std::chrono::steady_clock::now() + RECLAIM_DELAY, identifier);
+    }
+    if (wake_up)
+    {
+        m_reclaim_cond.notify_one();
+    }
+}
+
+/** @brief Reclamation thread, removes the disconnected charge points by batches */
+void DefaultCentralSystemEventsHandler::reclaimThread()
+{
+    std::vector<std::string>     batch;
+    std::unique_lock<std::mutex> lock(m_reclaim_mutex);
+    while (!m_reclaim_stop)
+    {
+        if (m_reclaim_queue.empty())
+        {
+            m_reclaim_cond.wait(lock);
+        }
+        else if (m_reclaim_queue.front().first > std::chrono::steady_clock::now())
+        {
+            m_reclaim_cond.wait_until(lock, m_reclaim_queue.front().first);
+        }
+        else
         {
-            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            // Extract all the expired entries
+            auto now = std::chrono::steady_clock::now();
+            while (!m_reclaim_queue.empty() && (m_reclaim_queue.front().first <= now))
+            {
+                batch.push_back(std::move(m_reclaim_queue.front().second));
+                m_reclaim_queue.pop_front();
+            }
+            lock.unlock();
+
+            // Remove them from the lists, the charge point list lock is taken once per batch
+            for (const auto& identifier : batch)
+            {
+                m_chargepoints.erase(identifier);
+            }
+            {
+                std::lock_guard<std::mutex> chargepoints_lock(m_chargepoints_mutex);
+                for (const auto& identifier : batch)
+                {
+                    m_pending_chargepoints.erase(identifier);
+                    m_accepted_chargepoints.erase(identifier);
+                }
+            }
+            batch.clear();
 
-            std::lock_guard<std::mutex> lock(m_chargepoints_mutex);
-            m_chargepoints.erase(identifier);
-            m_pending_chargepoints.erase(identifier);
-            m_accepted_chargepoints.erase(identifier);
-        });
-    t.detach();
+            lock.lock();
+        }
+    }
 }
 
 /** @brief Indicate if a charge point must be accepted */
@@ -143,6 +235,7 @@ DefaultCentralSystemEventsHandler::ChargePointRequestHandler::~ChargePointReques
 void DefaultCentralSystemEventsHandler::ChargePointRequestHandler::disconnected()
 {
     cout << "[" << m_chargepoint->identifier() << "] - Disconnected" << endl;
+    m_event_handler.m_station_states.setConnected(m_chargepoint->identifier(), false);
     m_event_handler.removeChargePoint(m_chargepoint->identifier());
 }
 
@@ -319,7 +412,6 @@ bool DefaultCentralSystemEventsHandler::ChargePointRequestHandler::onMeterValues
 {
     bool ret = true;
 
-    (void)request;
     (void)response;
     (void)error;
     (void)message;
@@ -327,6 +419,9 @@ bool DefaultCentralSystemEventsHandler::ChargePointRequestHandler::onMeterValues
     cout << "[" << m_chargepoint->identifier() << "] - MeterValues" << endl;
     displayMeterValues(request.meterValue);
 
+    m_event_handler.m_station_states.updateMeterValues(m_chargepoint->identifier(), request.evseId, request.meterValue);
+    m_event_handler.m_meter_values.append(m_chargepoint->identifier(), request.evseId, request.meterValue);
+
     return ret;
 }
 
@@ -585,12 +680,15 @@ bool DefaultCentralSystemEventsHandler::ChargePointRequestHandler::onStatusNotif
 {
     bool ret = true;
 
-    (void)request;
     (void)response;
     (void)error;
     (void)message;
 
-    cout << "[" << m_chargepoint->identifier() << "] - StatusNotification" << endl;
+    cout << "[" << m_chargepoint->identifier() << "] - StatusNotification : evse = " << request.evseId
+         << " connector = " << request.connectorId << " status = " << ConnectorStatusEnumTypeHelper.toString(request.connectorStatus) << endl;
+
+    m_event_handler.m_station_states.updateConnectorStatus(
+        m_chargepoint->identifier(), request.evseId, request.connectorId, request.connectorStatus, request.timestamp.timestamp());
 
     return ret;
 }
@@ -605,8 +703,6 @@ bool DefaultCentralSystemEventsHandler::ChargePointRequestHandler::onTransaction
     bool ret = true;
 
     (void)response;
-    (void)error;
-    (void)message;
 
     cout << "[" << m_chargepoint->identifier() << "] - TransactionEvent" << endl;
 
@@ -635,6 +731,47 @@ bool DefaultCentralSystemEventsHandler::ChargePointRequestHandler::onTransaction
             break;
     }
 
+    // Journal the event, the charge point must retry it if it could not be stored
+    TransactionJournal& journal = m_event_handler.m_transaction_journal;
+    if (journal.isOpen())
+    {
+        uint64_t sequence = journal.append(m_chargepoint->identifier(), request);
+        if ((sequence == 0) || (m_event_handler.m_journal_sync_commit && !journal.waitDurable(sequence)))
+        {
+            error   = ::ocpp::rpc::IRpc::RPC_ERROR_INTERNAL;
+            message = "Unable to store the transaction event";
+            ret     = false;
+        }
+    }
+
+    // The station state only reflects the stored events, a rejected event will be retried
+    int  evse_id   = 0;
+    bool new_event = false;
+    if (ret)
+    {
+        new_event = m_event_handler.m_station_states.updateTransaction(m_chargepoint->identifier(), request, evse_id);
+    }
+
+    // Sampled values of the transaction, they have already been stored if the event is a retransmission
+    if (new_event && !request.meterValue.empty())
+    {
+        // The EVSE is only given by the first event, the journal still knows it after a restart
+        TransactionJournal::TransactionState state;
+        if ((evse_id == 0) && journal.isOpen() &&
+            journal.find(m_chargepoint->identifier(), request.transactionInfo.transactionId.str(), state))
+        {
+            evse_id = state.evse_id;
+        }
+        if (evse_id != 0)
+        {
+            m_event_handler.m_meter_values.append(m_chargepoint->identifier(), evse_id, request.meterValue);
+        }
+        else
+        {
+            cout << "✗ Unknown EVSE for transaction " << request.transactionInfo.transactionId.str() << ", meter values not stored" << endl;
+        }
+    }
+
     return ret;
 }
 
@@ -4,10 +4,18 @@
 #include "CentralSystemDemoConfig.h"
 #include "ICentralSystemEventsHandler20.h"
 #include "IChargePointRequestHandler20.h"
-
+#include "ShardedMap.h"
+#include "StationStateStore.h"
+#include "MeterValueStore.h"
+#include "TransactionJournal.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <experimental/filesystem>
 #include <map>
 #include <mutex>
+#include <thread>
 
 namespace os {
 namespace ocpp {
@@ -230,19 +238,36 @@ class DefaultCentralSystemEventsHandler : public ::ocpp::centralsystem::ocpp20::
     CentralSystemDemoConfig& getConfig() { return m_config; }
 
     /** @brief Get the number connected charge points */
-    size_t chargePointsCount()
+    size_t chargePointsCount() const { return m_chargepoints.size(); }
+
+    /** @brief Get a connected charge point from its identifier (nullptr if not connected) */
+    std::shared_ptr<ChargePointRequestHandler> chargePoint(const std::string& identifier) const
     {
-        std::lock_guard<std::mutex> lock(m_chargepoints_mutex);
-        return m_chargepoints.size();
+        std::shared_ptr<ChargePointRequestHandler> chargepoint;
+        m_chargepoints.find(identifier, chargepoint);
+        return chargepoint;
     }
 
-    /** @brief Get the list of the connected charge points */
-    std::map<std::string, std::shared_ptr<ChargePointRequestHandler>> chargePoints()
+    /** @brief Visit the connected charge points without copying the list,
+     *         the visitor is called with the identifier and the handler of each charge point */
+    template <typename Visitor>
+    void forEachChargePoint(Visitor&& visitor) const
     {
-        std::lock_guard<std::mutex> lock(m_chargepoints_mutex);
-        return m_chargepoints;
+        m_chargepoints.forEach(std::forward<Visitor>(visitor));
     }
 
+    /** @brief Get the live state of the charge points */
+    const StationStateStore& stationStates() const { return m_station_states; }
+
+    /** @brief Get the live state of the charge points */
+    StationStateStore& stationStates() { return m_station_states; }
+
+    /** @brief Get the journal of the transactions */
+    const TransactionJournal& transactionJournal() const { return m_transaction_journal; }
+
+    /** @brief Get the time series of the sampled meter values */
+    const MeterValueStore& meterValues() const { return m_meter_values; }
+
     /** @brief Get the list of the pending charge points */
     std::map<std::string, std::shared_ptr<::ocpp::centralsystem::ocpp20::ICentralSystem20::IChargePoint20>> pendingChargePoints()
     {
@@ -258,7 +283,8 @@ class DefaultCentralSystemEventsHandler : public ::ocpp::centralsystem::ocpp20::
     /** @brief Indicate if the charge point must be set on pending status upon connection */
     bool setPendingEnabled() const { return m_set_pending_status; }
 
-    /** @brief Remove a charge point from the connected charge points */
+    /** @brief Remove a charge point from the connected charge points,
+     *         the removal is deferred to the reclamation thread */
     void removeChargePoint(const std::string& identifier);
 
     /** @brief Indicate if a charge point must be accepted */
@@ -273,7 +299,7 @@ class DefaultCentralSystemEventsHandler : public ::ocpp::centralsystem::ocpp20::
   protected:
     /** @brief Central system's configuration */
     CentralSystemDemoConfig& m_config;
-    /** @brief Mutex for charge point list */
+    /** @brief Mutex for pending and accepted charge point lists */
     std::mutex m_chargepoints_mutex;
     /** @brief Path to the V2G root CA */
     std::experimental::filesystem::path m_iso_v2g_root_ca;
@@ -282,11 +308,37 @@ class DefaultCentralSystemEventsHandler : public ::ocpp::centralsystem::ocpp20::
     /** @brief Indicate if the charge point must be set on pending status upon connection */
     bool m_set_pending_status;
     /** @brief Connected charge points */
-    std::map<std::string, std::shared_ptr<ChargePointRequestHandler>> m_chargepoints;
+    ShardedMap<std::string, std::shared_ptr<ChargePointRequestHandler>> m_chargepoints;
     /** @brief Pending charge points */
     std::map<std::string, std::shared_ptr<::ocpp::centralsystem::ocpp20::ICentralSystem20::IChargePoint20>> m_pending_chargepoints;
     /** @brief Accepted charge points */
     std::map<std::string, std::shared_ptr<::ocpp::centralsystem::ocpp20::ICentralSystem20::IChargePoint20>> m_accepted_chargepoints;
+    /** @brief Live state of the charge points */
+    StationStateStore m_station_states;
+    /** @brief Journal of the transactions */
+    TransactionJournal m_transaction_journal;
+    /** @brief Wait for the journaled TransactionEvent to be durable before answering the charge point */
+    bool m_journal_sync_commit;
+    /** @brief Time series of the sampled meter values */
+    MeterValueStore m_meter_values;
+
+  private:
+    /** @brief Delay before a disconnected charge point is removed, lets its handler return from the disconnection callback */
+    static constexpr std::chrono::milliseconds RECLAIM_DELAY = std::chrono::milliseconds(50);
+
+    /** @brief Mutex for the reclamation queue */
+    std::mutex m_reclaim_mutex;
+    /** @brief Condition to wake up the reclamation thread */
+    std::condition_variable m_reclaim_cond;
+    /** @brief Disconnected charge points waiting to be removed with their removal time, ordered by removal time */
+    std::deque<std::pair<std::chrono::steady_clock::time_point, std::string>> m_reclaim_queue;
+    /** @brief Indicate that the reclamation thread must stop */
+    bool m_reclaim_stop;
+    /** @brief Reclamation thread */
+    std::thread m_reclaim_thread;
+
+    /** @brief Reclamation thread, removes the disconnected charge points by batches */
+    void reclaimThread();
 };
 
 } // ocpp
@@ -0,0 +1,1111 @@
+#include "MeterValueStore.h"
+#include "RecordCodec.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <experimental/filesystem>
+#include <iostream>
+#include <iterator>
+#include <tuple>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+using namespace ::ocpp::types;
+using namespace ::ocpp::types::ocpp20;
+
+namespace os {
+namespace ocpp {
+
+/** @brief Magic number at the start of the data file ("OSM1") */
+static constexpr uint32_t DATA_MAGIC = 0x314D534Fu;
+/** @brief Version of the data file format */
+static constexpr uint32_t DATA_VERSION = 1u;
+/** @brief Size of the data file header : magic, version */
+static constexpr size_t DATA_HEADER_SIZE = 8u;
+/** @brief Size of a record header : payload length, CRC */
+static constexpr size_t RECORD_HEADER_SIZE = 8u;
+/** @brief Maximum size of a record payload, bigger lengths are corrupted records */
+static constexpr uint32_t RECORD_MAX_SIZE = 16u * 1024u * 1024u;
+/** @brief Name of the data file */
+static const std::string DATA_FILE = "meter-values.tsdb";
+/** @brief Period of the minute rollups */
+static constexpr std::time_t MINUTE_PERIOD = 60;
+/** @brief Period of the quarter rollups */
+static constexpr std::time_t QUARTER_PERIOD = 15 * 60;
+/** @brief Phase value of the series holding the total of the phases */
+static constexpr int NO_PHASE = -1;
+
+namespace {
+
+/** @brief MSB first reader of an encoded block */
+class BitReader
+{
+  public:
+    /** @brief Constructor */
+    BitReader(const std::vector<uint8_t>& data) : m_data(data), m_position(0) { }
+
+    /** @brief Read a value of up to 64 bits, returns false at the end of the block */
+    bool read(unsigned int bits, uint64_t& value)
+    {
+        bool ret = (m_position + bits <= m_data.size() * 8u);
+        value    = 0;
+        if (ret)
+        {
+            for (unsigned int i = 0; i < bits; i++)
+            {
+                value = (value << 1u) | ((m_data[m_position >> 3u] >> (7u - (m_position & 7u))) & 1u);
+                m_position++;
+            }
+        }
+        return ret;
+    }
+
+  private:
+    /** @brief Encoded block */
+    const std::vector<uint8_t>& m_data;
+    /** @brief Position of the next bit */
+    size_t m_position;
+};
+
+} // namespace
+
+/** @brief Stored block */
+struct MeterValueStore::BlockRef
+{
+    /** @brief Timestamp of the oldest sample */
+    std::time_t start = 0;
+    /** @brief Timestamp of the most recent sample */
+    std::time_t end = 0;
+    /** @brief Number of samples */
+    uint32_t count = 0;
+    /** @brief Offset of the encoded samples in the data file */
+    uint64_t offset = 0;
+    /** @brief Size of the encoded samples */
+    uint32_t size = 0;
+    /** @brief Encoded samples when they are not in the data file */
+    std::shared_ptr<const std::vector<uint8_t>> data;
+};
+
+/** @brief Block being filled : delta of deltas of the timestamps, XOR of the values with the previous one */
+class MeterValueStore::BlockEncoder
+{
+  public:
+    /** @brief Constructor */
+    BlockEncoder() { reset(); }
+
+    /** @brief Start a new block */
+    void reset()
+    {
+        m_data.clear();
+        m_bit_count      = 0;
+        m_count          = 0;
+        m_start          = 0;
+        m_end            = 0;
+        m_prev_timestamp = 0;
+        m_prev_delta     = 0;
+        m_prev_bits      = 0;
+        m_prev_leading   = 0xFFu;
+        m_prev_trailing  = 0;
+    }
+
+    /** @brief Add a sample */
+    void add(std::time_t timestamp, double value)
+    {
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+
+        if (m_count == 0)
+        {
+            // First sample is stored as is
+            write(static_cast<uint64_t>(static_cast<int64_t>(timestamp)), 64u);
+            write(bits, 64u);
+            m_start = timestamp;
+            m_end   = timestamp;
+        }
+        else
+        {
+            // Timestamp : delta of deltas in buckets of increasing sizes, out of order samples give negative values
+            int64_t delta = static_cast<int64_t>(timestamp) - static_cast<int64_t>(m_prev_timestamp);
+            int64_t dod   = delta - m_prev_delta;
+            if (dod == 0)
+            {
+                write(0u, 1u);
+            }
+            else if ((dod >= -63) && (dod <= 64))
+            {
+                write(2u, 2u);
+                write(static_cast<uint64_t>(dod + 63), 7u);
+            }
+            else if ((dod >= -255) && (dod <= 256))
+            {
+                write(6u, 3u);
+                write(static_cast<uint64_t>(dod + 255), 9u);
+            }
+            else if ((dod >= -2047) && (dod <= 2048))
+            {
+                write(14u, 4u);
+                write(static_cast<uint64_t>(dod + 2047), 12u);
+            }
+            else
+            {
+                write(15u, 4u);
+                write(static_cast<uint32_t>(static_cast<int32_t>(dod)), 32u);
+            }
+            m_prev_delta = delta;
+
+            // Value : only the meaningful bits of the XOR, within the previous window when they fit
+            uint64_t xored = bits ^ m_prev_bits;
+            if (xored == 0)
+            {
+                write(0u, 1u);
+            }
+            else
+            {
+                unsigned int leading  = std::min(static_cast<unsigned int>(__builtin_clzll(xored)), 31u);
+                unsigned int trailing = static_cast<unsigned int>(__builtin_ctzll(xored));
+                if ((m_prev_leading != 0xFFu) && (leading >= m_prev_leading) && (trailing >= m_prev_trailing))
+                {
+                    write(2u, 2u);
+                    write(xored >> m_prev_trailing, 64u - m_prev_leading - m_prev_trailing);
+                }
+                else
+                {
+                    unsigned int length = 64u - leading - trailing;
+                    write(3u, 2u);
+                    write(leading, 5u);
+                    write(length & 63u, 6u);
+                    write(xored >> trailing, length);
+                    m_prev_leading  = leading;
+                    m_prev_trailing = trailing;
+                }
+            }
+
+            m_start = std::min(m_start, timestamp);
+            m_end   = std::max(m_end, timestamp);
+        }
+        m_prev_timestamp = timestamp;
+        m_prev_bits      = bits;
+        m_count++;
+    }
+
+    /** @brief Encoded samples */
+    const std::vector<uint8_t>& data() const { return m_data; }
+    /** @brief Number of samples */
+    uint32_t count() const { return m_count; }
+    /** @brief Timestamp of the oldest sample */
+    std::time_t start() const { return m_start; }
+    /** @brief Timestamp of the most recent sample */
+    std::time_t end() const { return m_end; }
+
+  private:
+    /** @brief Encoded samples */
+    std::vector<uint8_t> m_data;
+    /** @brief Number of bits written */
+    size_t m_bit_count;
+    /** @brief Number of samples */
+    uint32_t m_count;
+    /** @brief Timestamp of the oldest sample */
+    std::time_t m_start;
+    /** @brief Timestamp of the most recent sample */
+    std::time_t m_end;
+    /** @brief Timestamp of the previous sample */
+    std::time_t m_prev_timestamp;
+    /** @brief Delta between the 2 previous timestamps */
+    int64_t m_prev_delta;
+    /** @brief Bits of the previous value */
+    uint64_t m_prev_bits;
+    /** @brief Leading zeros of the current XOR window (0xFF = no window yet) */
+    unsigned int m_prev_leading;
+    /** @brief Trailing zeros of the current XOR window */
+    unsigned int m_prev_trailing;
+
+    /** @brief Write the lowest bits of a value, MSB first */
+    void write(uint64_t value, unsigned int bits)
+    {
+        while (bits > 0)
+        {
+            if ((m_bit_count & 7u) == 0)
+            {
+                m_data.push_back(0);
+            }
+            unsigned int free  = 8u - static_cast<unsigned int>(m_bit_count & 7u);
+            unsigned int count = std::min(free, bits);
+            uint8_t      chunk = static_cast<uint8_t>((value >> (bits - count)) & ((1u << count) - 1u));
+            m_data.back() |= static_cast<uint8_t>(chunk << (free - count));
+            bits -= count;
+            m_bit_count += count;
+        }
+    }
+};
+
+/** @brief Rollups of a series for a period, sorted by start of period */
+class MeterValueStore::Rollups
+{
+  public:
+    /** @brief Constructor */
+    Rollups(std::time_t period) : m_period(period), m_buckets() { }
+
+    /** @brief Period of the rollups */
+    std::time_t period() const { return m_period; }
+
+    /** @brief Start of the period of a timestamp */
+    std::time_t periodStart(std::time_t timestamp) const
+    {
+        std::time_t remainder = timestamp % m_period;
+        return timestamp - ((remainder < 0) ? (remainder + m_period) : remainder);
+    }
+
+    /** @brief Add a sample, the samples and the rollups older than the horizon are dropped */
+    void add(std::time_t timestamp, double value, std::time_t horizon)
+    {
+        if (timestamp < horizon)
+        {
+            return;
+        }
+        if (!m_buckets.empty() && (m_buckets.front().timestamp < horizon))
+        {
+            m_buckets.erase(m_buckets.begin(), lowerBound(horizon));
+        }
+
+        // Samples are mostly in order : the bucket is almost always the last one
+        std::time_t start = periodStart(timestamp);
+        auto        it    = (!m_buckets.empty() && (m_buckets.back().timestamp == start)) ? (m_buckets.end() - 1) : lowerBound(start);
+        if ((it == m_buckets.end()) || (it->timestamp != start))
+        {
+            Bucket bucket;
+            bucket.timestamp = start;
+            bucket.min       = value;
+            bucket.max       = value;
+            bucket.last_ts   = timestamp;
+            it               = m_buckets.insert(it, bucket);
+        }
+        it->count++;
+        it->min = std::min(it->min, value);
+        it->max = std::max(it->max, value);
+        it->sum += value;
+        if (timestamp >= it->last_ts)
+        {
+            it->last    = value;
+            it->last_ts = timestamp;
+        }
+    }
+
+    /** @brief Get the rollups whose period starts within a time range */
+    void query(std::time_t from, std::time_t to, std::vector<Point>& points) const
+    {
+        for (auto it = lowerBound(from); (it != m_buckets.end()) && (it->timestamp <= to); ++it)
+        {
+            points.push_back(*it);
+        }
+    }
+
+  private:
+    /** @brief Rollup of a period */
+    struct Bucket : public Point
+    {
+        /** @brief Timestamp of the most recent value */
+        std::time_t last_ts = 0;
+    };
+
+    /** @brief Period of the rollups */
+    const std::time_t m_period;
+    /** @brief Rollups sorted by start of period */
+    std::vector<Bucket> m_buckets;
+
+    /** @brief First rollup whose period starts at or after a timestamp */
+    std::vector<Bucket>::const_iterator lowerBound(std::time_t timestamp) const
+    {
+        return std::lower_bound(
+            m_buckets.begin(),
+            m_buckets.end(),
+            timestamp,
+            [](const Bucket& bucket, std::time_t value) { return bucket.timestamp < value; });
+    }
+    /** @brief First rollup whose period starts at or after a timestamp */
+    std::vector<Bucket>::iterator lowerBound(std::time_t timestamp)
+    {
+        return std::lower_bound(
+            m_buckets.begin(),
+            m_buckets.end(),
+            timestamp,
+            [](const Bucket& bucket, std::time_t value) { return bucket.timestamp < value; });
+    }
+};
+
+/** @brief Series of samples */
+struct MeterValueStore::Series : public std::enable_shared_from_this<MeterValueStore::Series>
+{
+    /** @brief Constructor */
+    Series(const std::string& _station, int _evse_id, int _measurand, int _phase)
+        : station(_station),
+          evse_id(_evse_id),
+          measurand(_measurand),
+          phase(_phase),
+          mutex(),
+          block(),
+          blocks(),
+          minute(MINUTE_PERIOD),
+          quarter(QUARTER_PERIOD),
+          rollups_loaded(false),
+          count(0),
+          first(0),
+          last(0)
+    {
+    }
+
+    /** @brief Charge point identifier */
+    const std::string station;
+    /** @brief EVSE id */
+    const int evse_id;
+    /** @brief Measurand */
+    const int measurand;
+    /** @brief Phase (NO_PHASE = total of the phases) */
+    const int phase;
+    /** @brief Mutex for the samples and the rollups */
+    std::mutex mutex;
+    /** @brief Block being filled */
+    BlockEncoder block;
+    /** @brief Stored blocks, in order of storage */
+    std::vector<BlockRef> blocks;
+    /** @brief 1 minute rollups */
+    Rollups minute;
+    /** @brief 15 minutes rollups */
+    Rollups quarter;
+    /** @brief Indicate if the rollups have been rebuilt from the stored blocks */
+    bool rollups_loaded;
+    /** @brief Number of samples */
+    uint64_t count;
+    /** @brief Timestamp of the oldest sample */
+    std::time_t first;
+    /** @brief Timestamp of the most recent sample */
+    std::time_t last;
+};
+
+/** @brief Block waiting to be written to the data file */
+struct MeterValueStore::PendingBlock
+{
+    /** @brief Series of the block */
+    std::shared_ptr<Series> series;
+    /** @brief Index of the block in the stored blocks of the series */
+    size_t index;
+    /** @brief Record to append : header, series, time range, number of samples and encoded samples */
+    std::string record;
+    /** @brief Offset of the encoded samples in the record */
+    size_t data_offset;
+};
+
+/** @brief Constructor */
+MeterValueStore::MeterValueStore()
+    : m_settings(),
+      m_open(false),
+      m_path(),
+      m_fd(-1),
+      m_file_size(0),
+      m_writer_mutex(),
+      m_writer_cond(),
+      m_pending_blocks(),
+      m_writer_stop(false),
+      m_writer(),
+      m_series()
+{
+}
+
+/** @brief Destructor */
+MeterValueStore::~MeterValueStore()
+{
+    close();
+}
+
+/** @brief Open the store and rebuild its index from the data file */
+bool MeterValueStore::open(const std::string& directory, const Settings& settings)
+{
+    namespace fs = std::experimental::filesystem;
+
+    if (m_open)
+    {
+        return false;
+    }
+
+    // The time range of a block must fit the 32 bits delta of deltas, the rollups must cover at least one period
+    // and at most MAX_ROLLUPS periods
+    m_settings                   = settings;
+    m_settings.block_samples     = std::max<size_t>(m_settings.block_samples, 16u);
+    m_settings.block_span        = std::min(std::max(m_settings.block_span, std::chrono::seconds(60)), std::chrono::seconds(1 << 30));
+    m_settings.minute_retention  = std::min(std::max(m_settings.minute_retention, std::chrono::seconds(MINUTE_PERIOD)),
+                                           std::chrono::seconds(MINUTE_PERIOD * static_cast<std::time_t>(MAX_ROLLUPS - 1u)));
+    m_settings.quarter_retention = std::min(std::max(m_settings.quarter_retention, std::chrono::seconds(QUARTER_PERIOD)),
+                                            std::chrono::seconds(QUARTER_PERIOD * static_cast<std::time_t>(MAX_ROLLUPS - 1u)));
+    m_series.clear();
+
+    if (!directory.empty())
+    {
+        std::error_code error;
+        fs::create_directories(directory, error);
+        if (!fs::is_directory(directory, error))
+        {
+            cout << "✗ Meter values store : invalid directory " << directory << endl;
+            return false;
+        }
+        m_path = (fs::path(directory) / DATA_FILE).string();
+        m_fd   = ::open(m_path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (m_fd < 0)
+        {
+            cout << "✗ Meter values store : unable to open " << m_path << endl;
+            return false;
+        }
+        if (!load())
+        {
+            ::close(m_fd);
+            m_fd = -1;
+            return false;
+        }
+
+        m_writer_stop = false;
+        m_writer      = std::thread(&MeterValueStore::writerThread, this);
+    }
+
+    m_open = true;
+    return true;
+}
+
+/** @brief Store the blocks which are not filled yet, wait for the pending writes and close the store */
+void MeterValueStore::close()
+{
+    if (m_open)
+    {
+        m_series.forEach(
+            [this](const std::string&, const std::shared_ptr<Series>& series)
+            {
+                std::lock_guard<std::mutex> lock(series->mutex);
+                sealBlock(*series);
+            });
+        if (m_writer.joinable())
+        {
+            // The writer thread stores the remaining blocks in a single batch before exiting
+            {
+                std::lock_guard<std::mutex> lock(m_writer_mutex);
+                m_writer_stop = true;
+            }
+            m_writer_cond.notify_one();
+            m_writer.join();
+        }
+        m_series.clear();
+        if (m_fd >= 0)
+        {
+            ::close(m_fd);
+            m_fd = -1;
+        }
+        m_open = false;
+    }
+}
+
+/** @brief Add the sampled values of a MeterValues or a TransactionEvent request */
+void MeterValueStore::append(const std::string& station, int evse_id, const std::vector<MeterValueType>& meter_values)
+{
+    if (!m_open)
+    {
+        return;
+    }
+
+    for (const MeterValueType& meter_value : meter_values)
+    {
+        std::time_t timestamp = meter_value.timestamp.timestamp();
+        for (const SampledValueType& sampled_value : meter_value.sampledValue)
+        {
+            // Convert to Wh or W
+            double value = sampled_value.value;
+            if (sampled_value.unitOfMeasure.isSet())
+            {
+                const UnitOfMeasureType& unit = sampled_value.unitOfMeasure.value();
+                if (unit.multiplier.isSet())
+                {
+                    value *= std::pow(10., unit.multiplier.value());
+                }
+                if (unit.unit.isSet() && ((unit.unit.value().str() == "kWh") || (unit.unit.value().str() == "kW")))
+                {
+                    value *= 1000.;
+                }
+            }
+
+            // Energy.Active.Import.Register is the default measurand
+            MeasurandEnumType measurand = sampled_value.measurand.isSet() ? sampled_value.measurand.value()
+                                                                          : MeasurandEnumType::Energy_Active_Import_Register;
+            int phase = sampled_value.phase.isSet() ? static_cast<int>(sampled_value.phase.value()) : NO_PHASE;
+
+            std::shared_ptr<Series>     series = getSeries(station, evse_id, static_cast<int>(measurand), phase);
+            std::lock_guard<std::mutex> lock(series->mutex);
+            addSample(*series, timestamp, value);
+        }
+    }
+}
+
+/** @brief Get the points of a series within a time range */
+bool MeterValueStore::query(const std::string&             station,
+                            int                            evse_id,
+                            MeasurandEnumType              measurand,
+                            const Optional<PhaseEnumType>& phase,
+                            std::time_t                    from,
+                            std::time_t                    to,
+                            Resolution                     resolution,
+                            std::vector<Point>&            points) const
+{
+    bool ret = false;
+
+    points.clear();
+
+    std::shared_ptr<Series> series;
+    if (m_series.find(seriesKey(station, evse_id, static_cast<int>(measurand), phase.isSet() ? static_cast<int>(phase.value()) : NO_PHASE),
+                      series))
+    {
+        if (resolution == Resolution::Raw)
+        {
+            std::vector<std::pair<std::time_t, double>> samples;
+            collectSamples(*series, from, to, samples);
+            points.reserve(samples.size());
+            for (const auto& sample : samples)
+            {
+                Point point;
+                point.timestamp = sample.first;
+                point.count     = 1u;
+                point.min       = sample.second;
+                point.max       = sample.second;
+                point.sum       = sample.second;
+                point.last      = sample.second;
+                points.push_back(point);
+            }
+        }
+        else
+        {
+            bool                         minute    = (resolution == Resolution::Minute);
+            std::chrono::seconds         retention = minute ? m_settings.minute_retention : m_settings.quarter_retention;
+            std::unique_lock<std::mutex> lock(series->mutex);
+            Rollups&                     rollups = minute ? series->minute : series->quarter;
+            std::time_t                  start   = rollups.periodStart(from);
+            std::time_t                  horizon = rollups.periodStart(series->last - retention.count());
+            loadRollups(*series);
+            if (start >= horizon)
+            {
+                // Whole range within the rollups
+                rollups.query(start, to, points);
+            }
+            else
+            {
+                // Range older than the rollups, aggregate the stored samples
+                std::time_t period = rollups.period();
+                lock.unlock();
+
+                std::vector<std::pair<std::time_t, double>> samples;
+                collectSamples(*series, start, to, samples);
+                aggregate(samples, period, points);
+            }
+        }
+        ret = true;
+    }
+
+    return ret;
+}
+
+/** @brief Get the series of a charge point */
+void MeterValueStore::listSeries(const std::string& station, std::vector<SeriesInfo>& series) const
+{
+    series.clear();
+    m_series.forEach(
+        [&station, &series](const std::string&, const std::shared_ptr<Series>& item)
+        {
+            if (item->station == station)
+            {
+                SeriesInfo info;
+                info.evse_id   = item->evse_id;
+                info.measurand = static_cast<MeasurandEnumType>(item->measurand);
+                if (item->phase != NO_PHASE)
+                {
+                    info.phase = static_cast<PhaseEnumType>(item->phase);
+                }
+                std::lock_guard<std::mutex> lock(item->mutex);
+                info.count = item->count;
+                info.first = item->first;
+                info.last  = item->last;
+                series.push_back(info);
+            }
+        });
+    std::sort(series.begin(),
+              series.end(),
+              [](const SeriesInfo& a, const SeriesInfo& b)
+              {
+                  int phase_a = a.phase.isSet() ? static_cast<int>(a.phase.value()) : NO_PHASE;
+                  int phase_b = b.phase.isSet() ? static_cast<int>(b.phase.value()) : NO_PHASE;
+                  return std::make_tuple(a.evse_id, static_cast<int>(a.measurand), phase_a) <
+                         std::make_tuple(b.evse_id, static_cast<int>(b.measurand), phase_b);
+              });
+}
+
+/** @brief Get a series, it is created if needed */
+std::shared_ptr<MeterValueStore::Series> MeterValueStore::getSeries(const std::string& station, int evse_id, int measurand, int phase)
+{
+    std::shared_ptr<Series> series;
+    std::string             key = seriesKey(station, evse_id, measurand, phase);
+    if (!m_series.find(key, series))
+    {
+        m_series.insertIfAbsent(key, [&] { return std::make_shared<Series>(station, evse_id, measurand, phase); });
+        m_series.find(key, series);
+    }
+    return series;
+}
+
+/** @brief Add a sample to a series (series mutex must be held) */
+void MeterValueStore::addSample(Series& series, std::time_t timestamp, double value)
+{
+    loadRollups(series);
+
+    // A block covers a bounded time range, an out of order sample may also extend it backward
+    BlockEncoder& block = series.block;
+    if ((block.count() > 0) && ((std::max(block.end(), timestamp) - std::min(block.start(), timestamp)) > m_settings.block_span.count()))
+    {
+        sealBlock(series);
+    }
+    block.add(timestamp, value);
+
+    series.first = (series.count == 0) ? timestamp : std::min(series.first, timestamp);
+    series.last  = (series.count == 0) ? timestamp : std::max(series.last, timestamp);
+    series.count++;
+
+    series.minute.add(timestamp, value, series.minute.periodStart(series.last - m_settings.minute_retention.count()));
+    series.quarter.add(timestamp, value, series.quarter.periodStart(series.last - m_settings.quarter_retention.count()));
+
+    if (block.count() >= m_settings.block_samples)
+    {
+        sealBlock(series);
+    }
+}
+
+/** @brief Hand the block which is being filled to the writer thread (series mutex must be held) */
+void MeterValueStore::sealBlock(Series& series)
+{
+    BlockEncoder& block = series.block;
+    if (block.count() == 0)
+    {
+        return;
+    }
+
+    // The block is read from memory until the writer thread has made it durable
+    BlockRef ref;
+    ref.start = block.start();
+    ref.end   = block.end();
+    ref.count = block.count();
+    ref.size  = static_cast<uint32_t>(block.data().size());
+    ref.data  = std::make_shared<const std::vector<uint8_t>>(block.data());
+
+    if (m_fd >= 0)
+    {
+        // Record : series, time range and number of samples followed by the encoded samples
+        std::string payload;
+        putString(payload, series.station);
+        put<int32_t>(payload, series.evse_id);
+        putString(payload, MeasurandEnumTypeHelper.toString(static_cast<MeasurandEnumType>(series.measurand)));
+        putString(payload, (series.phase != NO_PHASE) ? PhaseEnumTypeHelper.toString(static_cast<PhaseEnumType>(series.phase)) : "");
+        put<int64_t>(payload, ref.start);
+        put<int64_t>(payload, ref.end);
+        put<uint32_t>(payload, ref.count);
+        size_t data_offset = payload.size();
+        payload.append(reinterpret_cast<const char*>(block.data().data()), block.data().size());
+
+        PendingBlock pending;
+        pending.series      = series.shared_from_this();
+        pending.index       = series.blocks.size();
+        pending.data_offset = RECORD_HEADER_SIZE + data_offset;
+        put<uint32_t>(pending.record, static_cast<uint32_t>(payload.size()));
+        put<uint32_t>(pending.record, crc32c(payload.data(), payload.size()));
+        pending.record += payload;
+        {
+            std::lock_guard<std::mutex> lock(m_writer_mutex);
+            m_pending_blocks.push_back(std::move(pending));
+        }
+        m_writer_cond.notify_one();
+    }
+
+    series.blocks.push_back(ref);
+    block.reset();
+}
+
+/** @brief Writer thread, appends the sealed blocks to the data file */
+void MeterValueStore::writerThread()
+{
+    std::unique_lock<std::mutex> lock(m_writer_mutex);
+    while (!m_writer_stop || !m_pending_blocks.empty())
+    {
+        // The blocks sealed during a write are grouped in the next batch
+        m_writer_cond.wait(lock, [this] { return m_writer_stop || !m_pending_blocks.empty(); });
+        std::vector<PendingBlock> blocks;
+        blocks.swap(m_pending_blocks);
+        lock.unlock();
+        writeBlocks(blocks);
+        lock.lock();
+    }
+}
+
+/** @brief Write a batch of sealed blocks to the data file */
+void MeterValueStore::writeBlocks(std::vector<PendingBlock>& blocks)
+{
+    if (blocks.empty())
+    {
+        return;
+    }
+
+    // Single write and single synchronization for the whole batch
+    std::string batch;
+    for (const PendingBlock& pending : blocks)
+    {
+        batch += pending.record;
+    }
+    size_t written = 0;
+    while (written < batch.size())
+    {
+        ssize_t ret = pwrite(m_fd, batch.data() + written, batch.size() - written, static_cast<off_t>(m_file_size + written));
+        if (ret <= 0)
+        {
+            break;
+        }
+        written += static_cast<size_t>(ret);
+    }
+    if ((written != batch.size()) || (fdatasync(m_fd) != 0))
+    {
+        // Drop the partial records, the next batch is written at the same offset
+        cout << "✗ Meter values store : unable to write " << blocks.size() << " block(s), they are kept in memory" << endl;
+        if (ftruncate(m_fd, static_cast<off_t>(m_file_size)) != 0)
+        {
+            cout << "✗ Meter values store : unable to truncate " << m_path << endl;
+        }
+        return;
+    }
+
+    // The blocks are now read from the data file
+    uint64_t offset = m_file_size;
+    for (const PendingBlock& pending : blocks)
+    {
+        std::lock_guard<std::mutex> lock(pending.series->mutex);
+        BlockRef&                   ref = pending.series->blocks[pending.index];
+        ref.offset                      = offset + pending.data_offset;
+        ref.data.reset();
+        offset += pending.record.size();
+    }
+    m_file_size = offset;
+}
+
+/** @brief Read the content of a stored block */
+bool MeterValueStore::readBlock(const BlockRef& block, std::vector<uint8_t>& data) const
+{
+    bool ret = true;
+    if (block.data)
+    {
+        data = *block.data;
+    }
+    else
+    {
+        data.resize(block.size);
+        ret = (pread(m_fd, data.data(), data.size(), static_cast<off_t>(block.offset)) == static_cast<ssize_t>(data.size()));
+    }
+    return ret;
+}
+
+/** @brief Get the samples of a series within a time range, ordered by timestamp */
+void MeterValueStore::collectSamples(Series&                                      series,
+                                     std::time_t                                  from,
+                                     std::time_t                                  to,
+                                     std::vector<std::pair<std::time_t, double>>& samples) const
+{
+    std::vector<std::pair<std::time_t, double>> decoded;
+
+    // Blocks overlapping the range, the file is read without holding the series mutex
+    std::vector<BlockRef> blocks;
+    {
+        std::lock_guard<std::mutex> lock(series.mutex);
+        for (const BlockRef& block : series.blocks)
+        {
+            if ((block.end >= from) && (block.start <= to))
+            {
+                blocks.push_back(block);
+            }
+        }
+        if ((series.block.count() > 0) && (series.block.end() >= from) && (series.block.start() <= to))
+        {
+            decodeBlock(series.block.data(), series.block.count(), decoded);
+        }
+    }
+
+    std::vector<uint8_t> data;
+    for (const BlockRef& block : blocks)
+    {
+        if (readBlock(block, data))
+        {
+            decodeBlock(data, block.count, decoded);
+        }
+    }
+
+    samples.clear();
+    std::copy_if(decoded.begin(),
+                 decoded.end(),
+                 std::back_inserter(samples),
+                 [from, to](const std::pair<std::time_t, double>& sample) { return (sample.first >= from) && (sample.first <= to); });
+    std::stable_sort(samples.begin(),
+                     samples.end(),
+                     [](const std::pair<std::time_t, double>& a, const std::pair<std::time_t, double>& b) { return a.first < b.first; });
+}
+
+/** @brief Rebuild the rollups of a series from its stored blocks on first use (series mutex must be held) */
+void MeterValueStore::loadRollups(Series& series) const
+{
+    if (series.rollups_loaded)
+    {
+        return;
+    }
+    series.rollups_loaded = true;
+
+    // Only the blocks within the retention are decoded, the block being filled is empty until the first append
+    std::time_t minute_horizon  = series.minute.periodStart(series.last - m_settings.minute_retention.count());
+    std::time_t quarter_horizon = series.quarter.periodStart(series.last - m_settings.quarter_retention.count());
+    std::time_t horizon         = std::min(minute_horizon, quarter_horizon);
+
+    std::vector<uint8_t>                        data;
+    std::vector<std::pair<std::time_t, double>> samples;
+    for (const BlockRef& block : series.blocks)
+    {
+        if ((block.end >= horizon) && readBlock(block, data))
+        {
+            samples.clear();
+            decodeBlock(data, block.count, samples);
+            for (const auto& sample : samples)
+            {
+                series.minute.add(sample.first, sample.second, minute_horizon);
+                series.quarter.add(sample.first, sample.second, quarter_horizon);
+            }
+        }
+    }
+}
+
+/** @brief Load the blocks of the data file */
+bool MeterValueStore::load()
+{
+    struct stat st;
+    if (fstat(m_fd, &st) != 0)
+    {
+        return false;
+    }
+    uint64_t file_size = static_cast<uint64_t>(st.st_size);
+
+    // New file
+    if (file_size < DATA_HEADER_SIZE)
+    {
+        std::string header;
+        put<uint32_t>(header, DATA_MAGIC);
+        put<uint32_t>(header, DATA_VERSION);
+        bool ret = (ftruncate(m_fd, 0) == 0) && (pwrite(m_fd, header.data(), header.size(), 0) == static_cast<ssize_t>(header.size())) &&
+                   (fsync(m_fd) == 0);
+        m_file_size = DATA_HEADER_SIZE;
+        return ret;
+    }
+
+    uint32_t header[2] = {0, 0};
+    if ((pread(m_fd, header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header))) || (header[0] != DATA_MAGIC) ||
+        (header[1] != DATA_VERSION))
+    {
+        cout << "✗ Meter values store : invalid data file " << m_path << endl;
+        return false;
+    }
+
+    // Replay the records, stop at the first torn or corrupted one
+    uint64_t             offset = DATA_HEADER_SIZE;
+    size_t               blocks = 0;
+    std::vector<uint8_t> payload;
+    while (offset + RECORD_HEADER_SIZE <= file_size)
+    {
+        uint32_t record_header[2];
+        if (pread(m_fd, record_header, sizeof(record_header), static_cast<off_t>(offset)) != static_cast<ssize_t>(sizeof(record_header)))
+        {
+            break;
+        }
+        uint32_t length = record_header[0];
+        if ((length == 0) || (length > RECORD_MAX_SIZE) || (offset + RECORD_HEADER_SIZE + length > file_size))
+        {
+            break;
+        }
+        payload.resize(length);
+        if ((pread(m_fd, payload.data(), length, static_cast<off_t>(offset + RECORD_HEADER_SIZE)) != static_cast<ssize_t>(length)) ||
+            (crc32c(payload.data(), length) != record_header[1]))
+        {
+            break;
+        }
+
+        RecordReader reader(payload.data(), payload.size());
+        std::string  station   = reader.getString();
+        int          evse_id   = reader.get<int32_t>();
+        std::string  measurand = reader.getString();
+        std::string  phase     = reader.getString();
+        BlockRef     ref;
+        ref.start = static_cast<std::time_t>(reader.get<int64_t>());
+        ref.end   = static_cast<std::time_t>(reader.get<int64_t>());
+        ref.count = reader.get<uint32_t>();
+        if (!reader.isValid())
+        {
+            break;
+        }
+        ref.offset = offset + RECORD_HEADER_SIZE + reader.offset();
+        ref.size   = static_cast<uint32_t>(length - reader.offset());
+
+        MeasurandEnumType measurand_value;
+        PhaseEnumType     phase_value;
+        if (MeasurandEnumTypeHelper.fromString(measurand, measurand_value) &&
+            (phase.empty() || PhaseEnumTypeHelper.fromString(phase, phase_value)))
+        {
+            std::shared_ptr<Series> series =
+                getSeries(station, evse_id, static_cast<int>(measurand_value), phase.empty() ? NO_PHASE : static_cast<int>(phase_value));
+            series->first = (series->count == 0) ? ref.start : std::min(series->first, ref.start);
+            series->last  = (series->count == 0) ? ref.end : std::max(series->last, ref.end);
+            series->count += ref.count;
+            series->blocks.push_back(ref);
+            blocks++;
+        }
+
+        offset += RECORD_HEADER_SIZE + length;
+    }
+    if (offset != file_size)
+    {
+        cout << "Meter values store : " << (file_size - offset) << " bytes of torn or corrupted records dropped" << endl;
+        if (ftruncate(m_fd, static_cast<off_t>(offset)) != 0)
+        {
+            return false;
+        }
+    }
+    m_file_size = offset;
+
+    cout << "Meter values store : " << m_series.size() << " series, " << blocks << " blocks loaded from " << m_path << endl;
+    return true;
+}
+
+/** @brief Key of a series */
+std::string MeterValueStore::seriesKey(const std::string& station, int evse_id, int measurand, int phase)
+{
+    std::string key = station;
+    key.push_back('\0');
+    put<int32_t>(key, evse_id);
+    put<int8_t>(key, static_cast<int8_t>(measurand));
+    put<int8_t>(key, static_cast<int8_t>(phase));
+    return key;
+}
+
+/** @brief Decode the samples of a block */
+void MeterValueStore::decodeBlock(const std::vector<uint8_t>& data, uint32_t count, std::vector<std::pair<std::time_t, double>>& samples)
+{
+    BitReader reader(data);
+    uint64_t  timestamp = 0;
+    uint64_t  bits      = 0;
+    if ((count == 0) || !reader.read(64u, timestamp) || !reader.read(64u, bits))
+    {
+        return;
+    }
+
+    auto push = [&samples](int64_t ts, uint64_t value_bits)
+    {
+        double value;
+        memcpy(&value, &value_bits, sizeof(value));
+        samples.emplace_back(static_cast<std::time_t>(ts), value);
+    };
+    int64_t      prev_timestamp = static_cast<int64_t>(timestamp);
+    int64_t      prev_delta     = 0;
+    unsigned int leading        = 0;
+    unsigned int trailing       = 0;
+    push(prev_timestamp, bits);
+
+    for (uint32_t i = 1; i < count; i++)
+    {
+        // Timestamp
+        uint64_t     value  = 1u;
+        int64_t      dod    = 0;
+        unsigned int prefix = 0;
+        bool         valid  = true;
+        while (valid && (value == 1u) && (prefix < 4u))
+        {
+            valid = reader.read(1u, value);
+            prefix += (valid && (value == 1u)) ? 1u : 0u;
+        }
+        if (!valid)
+        {
+            break;
+        }
+        static const std::array<std::pair<unsigned int, int64_t>, 5u> dod_buckets = {
+            {{0u, 0}, {7u, 63}, {9u, 255}, {12u, 2047}, {32u, 0}}};
+        if (prefix > 0)
+        {
+            if (!reader.read(dod_buckets[prefix].first, value))
+            {
+                break;
+            }
+            dod = (prefix == 4u) ? static_cast<int64_t>(static_cast<int32_t>(static_cast<uint32_t>(value)))
+                                 : (static_cast<int64_t>(value) - dod_buckets[prefix].second);
+        }
+        prev_delta += dod;
+        prev_timestamp += prev_delta;
+
+        // Value
+        if (!reader.read(1u, value))
+        {
+            break;
+        }
+        if (value == 1u)
+        {
+            if (!reader.read(1u, value))
+            {
+                break;
+            }
+            if (value == 1u)
+            {
+                uint64_t new_leading = 0;
+                uint64_t length      = 0;
+                if (!reader.read(5u, new_leading) || !reader.read(6u, length))
+                {
+                    break;
+                }
+                length   = (length == 0) ? 64u : length;
+                leading  = static_cast<unsigned int>(new_leading);
+                trailing = 64u - leading - static_cast<unsigned int>(length);
+            }
+            if (!reader.read(64u - leading - trailing, value))
+            {
+                break;
+            }
+            bits ^= (value << trailing);
+        }
+        push(prev_timestamp, bits);
+    }
+}
+
+/** @brief Aggregate ordered samples into rollup points */
+void MeterValueStore::aggregate(const std::vector<std::pair<std::time_t, double>>& samples, std::time_t period, std::vector<Point>& points)
+{
+    for (const auto& sample : samples)
+    {
+        std::time_t remainder = sample.first % period;
+        std::time_t start     = sample.first - ((remainder < 0) ? (remainder + period) : remainder);
+        if (points.empty() || (points.back().timestamp != start))
+        {
+            Point point;
+            point.timestamp = start;
+            point.min       = sample.second;
+            point.max       = sample.second;
+            points.push_back(point);
+        }
+        Point& point = points.back();
+        point.count++;
+        point.min = std::min(point.min, sample.second);
+        point.max = std::max(point.max, sample.second);
+        point.sum += sample.second;
+        point.last = sample.second;
+    }
+}
+
+} // ocpp
+} // os
@@ -0,0 +1,216 @@
+#ifndef OS_METER_VALUE_STORE_H
+#define OS_METER_VALUE_STORE_H
+
+#include "MeasurandEnumType20.h"
+#include "MeterValueType20.h"
+#include "PhaseEnumType20.h"
+#include "ShardedMap.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace os {
+namespace ocpp {
+
+/** @brief Time series of the sampled values received from the charge points (MeterValues and TransactionEvent requests).
+ *
+ *  A series is identified by the charge point, the EVSE, the measurand and the phase. Its samples are stored by blocks,
+ *  timestamps encoded as delta of deltas and values XORed with the previous value (Gorilla encoding) :
+ *  a sample of a regular series takes a few bits instead of a row.
+ *  Filled blocks are handed to a writer thread which appends them by batches to a CRC framed data file
+ *  with a single synchronization per batch, they stay in memory until they are durable.
+ *  Once stored, only their time range and their position in the file stay in memory.
+ *  1 minute and 15 minutes rollups (count, min, max, sum, last) are maintained incrementally for the recent samples,
+ *  older ranges are aggregated from the stored blocks on demand. The number of rollups kept in memory for a series
+ *  is bounded, they are rebuilt from the stored blocks when the series is used for the first time after the opening.
+ *  The samples of a block which is not filled yet are lost if the process is killed.
+ */
+class MeterValueStore
+{
+  public:
+    /** @brief Resolution of a range query */
+    enum class Resolution
+    {
+        /** @brief Raw samples */
+        Raw,
+        /** @brief 1 minute rollups */
+        Minute,
+        /** @brief 15 minutes rollups */
+        Quarter
+    };
+
+    /** @brief Store settings */
+    struct Settings
+    {
+        /** @brief Maximum number of samples in a block */
+        size_t block_samples = 1024u;
+        /** @brief Maximum time range covered by a block, the block is stored once exceeded */
+        std::chrono::seconds block_span = std::chrono::hours(6);
+        /** @brief Retention of the 1 minute rollups in memory, limited to MAX_ROLLUPS periods */
+        std::chrono::seconds minute_retention = std::chrono::hours(6);
+        /** @brief Retention of the 15 minutes rollups in memory, limited to MAX_ROLLUPS periods */
+        std::chrono::seconds quarter_retention = std::chrono::hours(72);
+    };
+
+    /** @brief Maximum number of rollups of each resolution kept in memory for a series */
+    static constexpr size_t MAX_ROLLUPS = 1024u;
+
+    /** @brief Point of a range query, a raw sample has a count of 1 */
+    struct Point
+    {
+        /** @brief Timestamp of the sample or start of the rollup period */
+        std::time_t timestamp = 0;
+        /** @brief Number of samples */
+        uint32_t count = 0;
+        /** @brief Minimum value */
+        double min = 0.;
+        /** @brief Maximum value */
+        double max = 0.;
+        /** @brief Sum of the values */
+        double sum = 0.;
+        /** @brief Most recent value */
+        double last = 0.;
+    };
+
+    /** @brief Description of a series */
+    struct SeriesInfo
+    {
+        /** @brief EVSE id (0 = main meter) */
+        int evse_id = 0;
+        /** @brief Measurand */
+        ::ocpp::types::ocpp20::MeasurandEnumType measurand = ::ocpp::types::ocpp20::MeasurandEnumType::Energy_Active_Import_Register;
+        /** @brief Phase */
+        ::ocpp::types::Optional<::ocpp::types::ocpp20::PhaseEnumType> phase;
+        /** @brief Number of samples */
+        uint64_t count = 0;
+        /** @brief Timestamp of the oldest sample */
+        std::time_t first = 0;
+        /** @brief Timestamp of the most recent sample */
+        std::time_t last = 0;
+    };
+
+    /** @brief Constructor */
+    MeterValueStore();
+    /** @brief Destructor */
+    virtual ~MeterValueStore();
+
+    /**
+     * @brief Open the store and rebuild its index from the data file
+     * @param directory Directory of the data file, created if needed (empty = samples only kept in memory)
+     * @param settings Store settings
+     * @return true if the store has been opened, false otherwise
+     */
+    bool open(const std::string& directory, const Settings& settings);
+
+    /** @brief Store the blocks which are not filled yet, wait for the pending writes and close the store */
+    void close();
+
+    /**
+     * @brief Add the sampled values of a MeterValues or a TransactionEvent request
+     * @param station Charge point identifier
+     * @param evse_id EVSE id (0 = main meter)
+     * @param meter_values Meter values of the request
+     */
+    void append(const std::string& station, int evse_id, const std::vector<::ocpp::types::ocpp20::MeterValueType>& meter_values);
+
+    /**
+     * @brief Get the points of a series within a time range
+     * @param station Charge point identifier
+     * @param evse_id EVSE id (0 = main meter)
+     * @param measurand Measurand
+     * @param phase Phase (not set = total of the phases)
+     * @param from Start of the time range (included), rounded down to the rollup period for the rollup resolutions
+     * @param to End of the time range (included)
+     * @param resolution Resolution of the points
+     * @param points Points ordered by timestamp
+     * @return true if the series exists, false otherwise
+     */
+    bool query(const std::string&                                                    station,
+               int                                                                   evse_id,
+               ::ocpp::types::ocpp20::MeasurandEnumType                              measurand,
+               const ::ocpp::types::Optional<::ocpp::types::ocpp20::PhaseEnumType>& phase,
+               std::time_t                                                           from,
+               std::time_t                                                           to,
+               Resolution                                                            resolution,
+               std::vector<Point>&                                                   points) const;
+
+    /**
+     * @brief Get the series of a charge point
+     * @param station Charge point identifier
+     * @param series Series of the charge point
+     */
+    void listSeries(const std::string& station, std::vector<SeriesInfo>& series) const;
+
+  private:
+    /** @brief Stored block */
+    struct BlockRef;
+    /** @brief Block being filled */
+    class BlockEncoder;
+    /** @brief Rollups of a series for a period */
+    class Rollups;
+    /** @brief Series of samples */
+    struct Series;
+    /** @brief Block waiting to be written to the data file */
+    struct PendingBlock;
+
+    /** @brief Store settings */
+    Settings m_settings;
+    /** @brief Indicate if the store is opened */
+    bool m_open;
+    /** @brief Path to the data file (empty = samples only kept in memory) */
+    std::string m_path;
+    /** @brief Data file descriptor */
+    int m_fd;
+    /** @brief Size of the data file (only modified by the writer thread once the store is opened) */
+    uint64_t m_file_size;
+    /** @brief Mutex for the blocks waiting to be written */
+    std::mutex m_writer_mutex;
+    /** @brief Condition to wake up the writer thread */
+    std::condition_variable m_writer_cond;
+    /** @brief Blocks waiting to be written, in order of sealing */
+    std::vector<PendingBlock> m_pending_blocks;
+    /** @brief Indicate that the writer thread must stop once the pending blocks are written */
+    bool m_writer_stop;
+    /** @brief Writer thread */
+    std::thread m_writer;
+    /** @brief Series indexed by charge point identifier, EVSE, measurand and phase */
+    ShardedMap<std::string, std::shared_ptr<Series>> m_series;
+
+    /** @brief Get a series, it is created if needed */
+    std::shared_ptr<Series> getSeries(const std::string& station, int evse_id, int measurand, int phase);
+    /** @brief Add a sample to a series (series mutex must be held) */
+    void addSample(Series& series, std::time_t timestamp, double value);
+    /** @brief Hand the block which is being filled to the writer thread (series mutex must be held) */
+    void sealBlock(Series& series);
+    /** @brief Writer thread, appends the sealed blocks to the data file */
+    void writerThread();
+    /** @brief Write a batch of sealed blocks to the data file */
+    void writeBlocks(std::vector<PendingBlock>& blocks);
+    /** @brief Read the content of a stored block */
+    bool readBlock(const BlockRef& block, std::vector<uint8_t>& data) const;
+    /** @brief Get the samples of a series within a time range, ordered by timestamp */
+    void collectSamples(Series& series, std::time_t from, std::time_t to, std::vector<std::pair<std::time_t, double>>& samples) const;
+    /** @brief Rebuild the rollups of a series from its stored blocks on first use (series mutex must be held) */
+    void loadRollups(Series& series) const;
+    /** @brief Load the blocks of the data file */
+    bool load();
+
+    /** @brief Key of a series */
+    static std::string seriesKey(const std::string& station, int evse_id, int measurand, int phase);
+    /** @brief Decode the samples of a block */
+    static void decodeBlock(const std::vector<uint8_t>& data, uint32_t count, std::vector<std::pair<std::time_t, double>>& samples);
+    /** @brief Aggregate ordered samples into rollup points */
+    static void aggregate(const std::vector<std::pair<std::time_t, double>>& samples, std::time_t period, std::vector<Point>& points);
+};
+
+} // ocpp
+} // os
+
+#endif // OS_METER_VALUE_STORE_H
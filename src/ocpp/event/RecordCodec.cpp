@@ -0,0 +1,36 @@
+#include "RecordCodec.h"
+
+#include <array>
+
+namespace os {
+namespace ocpp {
+
+/** @brief CRC-32C (Castagnoli) of a buffer */
+uint32_t crc32c(const void* data, size_t size, uint32_t crc)
+{
+    static const auto table = []
+    {
+        std::array<uint32_t, 256u> values;
+        for (uint32_t i = 0; i < 256u; i++)
+        {
+            uint32_t value = i;
+            for (int bit = 0; bit < 8; bit++)
+            {
+                value = (value & 1u) ? ((value >> 1u) ^ 0x82F63B78u) : (value >> 1u);
+            }
+            values[i] = value;
+        }
+        return values;
+    }();
+
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    crc                  = ~crc;
+    for (size_t i = 0; i < size; i++)
+    {
+        crc = table[(crc ^ bytes[i]) & 0xFFu] ^ (crc >> 8u);
+    }
+    return ~crc;
+}
+
+} // ocpp
+} // os
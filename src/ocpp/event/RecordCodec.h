@@ -0,0 +1,118 @@
+#ifndef OS_RECORD_CODEC_H
+#define OS_RECORD_CODEC_H
+
+#include "Optional.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace os {
+namespace ocpp {
+
+/**
+ * @brief CRC-32C (Castagnoli) of a buffer
+ * @param data Buffer
+ * @param size Size of the buffer
+ * @param crc CRC of the previous buffers to chain the computation
+ * @return CRC of the buffer
+ */
+uint32_t crc32c(const void* data, size_t size, uint32_t crc = 0);
+
+/** @brief Append a fixed size value to a record payload */
+template <typename T>
+void put(std::string& payload, T value)
+{
+    payload.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+/** @brief Append a string to a record payload, it is truncated to 65535 bytes */
+inline void putString(std::string& payload, const std::string& value)
+{
+    uint16_t size = static_cast<uint16_t>(std::min<size_t>(value.size(), UINT16_MAX));
+    put(payload, size);
+    payload.append(value.data(), size);
+}
+
+/** @brief Append an optional enum to a record payload (0 = not set) */
+template <typename T>
+void putEnum(std::string& payload, const ::ocpp::types::Optional<T>& value)
+{
+    put<uint8_t>(payload, value.isSet() ? static_cast<uint8_t>(static_cast<int>(value.value()) + 1) : 0u);
+}
+
+/** @brief Bounds checked reader of a record payload, the reads past the end of the payload fail */
+class RecordReader
+{
+  public:
+    /** @brief Constructor */
+    RecordReader(const uint8_t* data, size_t size) : m_data(data), m_size(size), m_offset(0), m_valid(true) { }
+
+    /** @brief Read a fixed size value */
+    template <typename T>
+    T get()
+    {
+        T value{};
+        if (m_valid && ((m_size - m_offset) >= sizeof(T)))
+        {
+            memcpy(&value, m_data + m_offset, sizeof(T));
+            m_offset += sizeof(T);
+        }
+        else
+        {
+            m_valid = false;
+        }
+        return value;
+    }
+
+    /** @brief Read a string */
+    std::string getString()
+    {
+        std::string value;
+        uint16_t    size = get<uint16_t>();
+        if (m_valid && ((m_size - m_offset) >= size))
+        {
+            value.assign(reinterpret_cast<const char*>(m_data + m_offset), size);
+            m_offset += size;
+        }
+        else
+        {
+            m_valid = false;
+        }
+        return value;
+    }
+
+    /** @brief Read an optional enum */
+    template <typename T>
+    void getEnum(::ocpp::types::Optional<T>& value)
+    {
+        uint8_t raw = get<uint8_t>();
+        if (raw != 0)
+        {
+            value = static_cast<T>(raw - 1);
+        }
+    }
+
+    /** @brief Current offset */
+    size_t offset() const { return m_offset; }
+
+    /** @brief Indicate if all the reads were within the payload */
+    bool isValid() const { return m_valid; }
+
+  private:
+    /** @brief Payload */
+    const uint8_t* m_data;
+    /** @brief Size of the payload */
+    size_t m_size;
+    /** @brief Current offset */
+    size_t m_offset;
+    /** @brief Indicate if all the reads were within the payload */
+    bool m_valid;
+};
+
+} // ocpp
+} // os
+
+#endif // OS_RECORD_CODEC_H
@@ -0,0 +1,182 @@
+#ifndef OS_SHARDED_MAP_H
+#define OS_SHARDED_MAP_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace os {
+namespace ocpp {
+
+/** @brief Hash map for concurrent accesses, the items are spread over independent shards
+ *         which are protected by a readers/writer lock so that lookups of different keys
+ *         or lookups of the same key never block each other */
+template <typename KeyType, typename ValueType, size_t SHARDS_COUNT = 16u, typename Hash = std::hash<KeyType>>
+class ShardedMap
+{
+    static_assert(SHARDS_COUNT > 0, "At least 1 shard is needed");
+
+  public:
+    /** @brief Constructor */
+    ShardedMap() : m_shards(), m_size(0) { }
+    /** @brief Destructor */
+    virtual ~ShardedMap() { }
+
+    /**
+     * @brief Get the number of items in the map
+     * @return Number of items in the map
+     */
+    size_t size() const { return m_size; }
+
+    /**
+     * @brief Indicate if the map is empty
+     * @return true if the map is empty, false otherwise
+     */
+    bool empty() const { return (m_size == 0); }
+
+    /**
+     * @brief Look for an item
+     * @param key Key of the item
+     * @param value Copy of the item's value if found
+     * @return true if the item has been found, false otherwise
+     */
+    bool find(const KeyType& key, ValueType& value) const
+    {
+        bool ret = false;
+
+        const Shard&                        shard = getShard(key);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        auto                                iter = shard.items.find(key);
+        if (iter != shard.items.end())
+        {
+            value = iter->second;
+            ret   = true;
+        }
+
+        return ret;
+    }
+
+    /**
+     * @brief Indicate if an item is in the map
+     * @param key Key of the item
+     * @return true if the item is in the map, false otherwise
+     */
+    bool contains(const KeyType& key) const
+    {
+        const Shard&                        shard = getShard(key);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        return (shard.items.find(key) != shard.items.end());
+    }
+
+    /**
+     * @brief Add an item only if it is not already in the map
+     * @param key Key of the item
+     * @param factory Function which creates the value of the item, only called if the item is added
+     * @return true if the item has been added, false if it was already in the map
+     */
+    template <typename Factory>
+    bool insertIfAbsent(const KeyType& key, Factory&& factory)
+    {
+        bool ret = false;
+
+        Shard&                              shard = getShard(key);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        if (shard.items.find(key) == shard.items.end())
+        {
+            shard.items.emplace(key, factory());
+            m_size++;
+            ret = true;
+        }
+
+        return ret;
+    }
+
+    /**
+     * @brief Remove an item
+     * @param key Key of the item
+     * @return true if the item has been removed, false if it was not in the map
+     */
+    bool erase(const KeyType& key)
+    {
+        bool      ret = false;
+        ValueType value;
+        {
+            Shard&                              shard = getShard(key);
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            auto                                iter = shard.items.find(key);
+            if (iter != shard.items.end())
+            {
+                // Value is released outside of the lock
+                value = std::move(iter->second);
+                shard.items.erase(iter);
+                m_size--;
+                ret = true;
+            }
+        }
+        return ret;
+    }
+
+    /** @brief Remove all the items */
+    void clear()
+    {
+        for (Shard& shard : m_shards)
+        {
+            std::unordered_map<KeyType, ValueType, Hash> items;
+            {
+                std::unique_lock<std::shared_mutex> lock(shard.mutex);
+                items.swap(shard.items);
+                m_size -= items.size();
+            }
+        }
+    }
+
+    /**
+     * @brief Visit all the items without copying the map, the shards are visited one after the other
+     *        so the items added or removed during the visit may or may not be visited
+     * @param visitor Function called for each item with its key and its value,
+     *                it must not modify the map
+     */
+    template <typename Visitor>
+    void forEach(Visitor&& visitor) const
+    {
+        for (const Shard& shard : m_shards)
+        {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            for (const auto& item : shard.items)
+            {
+                visitor(item.first, item.second);
+            }
+        }
+    }
+
+  private:
+    /** @brief Shard of the map */
+    struct Shard
+    {
+        /** @brief Readers/writer lock */
+        mutable std::shared_mutex mutex;
+        /** @brief Items */
+        std::unordered_map<KeyType, ValueType, Hash> items;
+    };
+
+    /** @brief Shards */
+    std::array<Shard, SHARDS_COUNT> m_shards;
+    /** @brief Number of items */
+    std::atomic<size_t> m_size;
+
+    /** @brief Get the shard of a key */
+    Shard& getShard(const KeyType& key) { return m_shards[Hash()(key) % SHARDS_COUNT]; }
+
+    /** @brief Get the shard of a key */
+    const Shard& getShard(const KeyType& key) const { return m_shards[Hash()(key) % SHARDS_COUNT]; }
+};
+
+} // ocpp
+} // os
+
+#endif // OS_SHARDED_MAP_H
@@ -0,0 +1,332 @@
+#include "StationStateStore.h"
+
+#include <cmath>
+#include <functional>
+
+using namespace ::ocpp::types::ocpp20;
+
+namespace os {
+namespace ocpp {
+
+/** @brief Constructor */
+StationStateStore::StationStateStore() : m_stations(), m_changes_mutex(), m_changes() { }
+
+/** @brief Destructor */
+StationStateStore::~StationStateStore() { }
+
+/** @brief Update the connection state of a charge point */
+void StationStateStore::setConnected(const std::string& identifier, bool connected)
+{
+    auto                        station = getStation(identifier);
+    std::lock_guard<std::mutex> lock(station->writer_mutex);
+    beginUpdate(*station);
+    station->connected.store(connected, std::memory_order_relaxed);
+    endUpdate(*station);
+}
+
+/** @brief Update the status of a connector (StatusNotification) */
+void StationStateStore::updateConnectorStatus(
+    const std::string& identifier, int evse_id, int connector_id, ConnectorStatusEnumType status, std::time_t timestamp)
+{
+    auto                        station = getStation(identifier);
+    std::lock_guard<std::mutex> lock(station->writer_mutex);
+    Slot*                       slot = getSlot(*station, evse_id, connector_id);
+    if (slot)
+    {
+        beginUpdate(*station);
+        slot->status.store(static_cast<int>(status) + 1, std::memory_order_relaxed);
+        slot->updated.store(timestamp, std::memory_order_relaxed);
+        endUpdate(*station);
+    }
+}
+
+/** @brief Update the meter values of an EVSE, EVSE 0 is the main meter (MeterValues) */
+void StationStateStore::updateMeterValues(const std::string& identifier, int evse_id, const std::vector<MeterValueType>& meter_values)
+{
+    auto                        station = getStation(identifier);
+    std::lock_guard<std::mutex> lock(station->writer_mutex);
+
+    // The connector is not given, the meter values go to the connector of the EVSE with an ongoing transaction
+    Slot*  slot  = nullptr;
+    size_t count = station->connector_count.load(std::memory_order_relaxed);
+    for (size_t i = 0; (i < count) && (evse_id != 0); i++)
+    {
+        Slot& candidate = station->slots[i];
+        if (candidate.evse_id.load(std::memory_order_relaxed) == evse_id)
+        {
+            if (!slot || (candidate.transaction.load(std::memory_order_relaxed) != 0))
+            {
+                slot = &candidate;
+            }
+        }
+    }
+    if ((evse_id != 0) && !slot)
+    {
+        slot = getSlot(*station, evse_id, 1);
+        if (!slot)
+        {
+            return;
+        }
+    }
+
+    beginUpdate(*station);
+    applyMeterValues(*station, slot, meter_values);
+    endUpdate(*station);
+}
+
+/** @brief Update the transaction state and the meter values of an EVSE (TransactionEvent) */
+bool StationStateStore::updateTransaction(const std::string&                                  identifier,
+                                          const ::ocpp::messages::ocpp20::TransactionEventReq& request,
+                                          int&                                                 evse_id)
+{
+    auto                        station = getStation(identifier);
+    std::lock_guard<std::mutex> lock(station->writer_mutex);
+
+    // 0 is reserved for "no transaction"
+    size_t transaction = std::hash<std::string>()(request.transactionInfo.transactionId.str());
+    if (transaction == 0)
+    {
+        transaction = 1u;
+    }
+
+    // The EVSE is only mandatory in the first event of a transaction, the following events
+    // are matched with the last transaction of the connectors which is kept after its end
+    // so that a retransmitted Ended event is still recognized
+    Slot* slot = nullptr;
+    evse_id    = 0;
+    if (request.evse.isSet())
+    {
+        const EVSEType& evse = request.evse.value();
+        evse_id              = evse.id;
+        slot                 = getSlot(*station, evse.id, evse.connectorId.isSet() ? evse.connectorId.value() : 1);
+    }
+    else
+    {
+        size_t count = station->connector_count.load(std::memory_order_relaxed);
+        for (size_t i = 0; (i < count) && !slot; i++)
+        {
+            if (station->slots[i].last_transaction == transaction)
+            {
+                slot    = &station->slots[i];
+                evse_id = slot->evse_id.load(std::memory_order_relaxed);
+            }
+        }
+    }
+    if (slot)
+    {
+        // Events already applied are ignored
+        if ((slot->last_transaction == transaction) && (request.seqNo <= slot->last_seq_no))
+        {
+            return false;
+        }
+        slot->last_transaction = transaction;
+        slot->last_seq_no      = request.seqNo;
+
+        beginUpdate(*station);
+        if (request.eventType == TransactionEventEnumType::Ended)
+        {
+            slot->transaction.store(0, std::memory_order_relaxed);
+            slot->charging.store(false, std::memory_order_relaxed);
+            slot->power_w.store(0., std::memory_order_relaxed);
+        }
+        else
+        {
+            slot->transaction.store(transaction, std::memory_order_relaxed);
+            if (request.transactionInfo.chargingState.isSet())
+            {
+                slot->charging.store(request.transactionInfo.chargingState.value() == ChargingStateEnumType::Charging, std::memory_order_relaxed);
+            }
+        }
+        applyMeterValues(*station, slot, request.meterValue);
+        slot->updated.store(request.timestamp.timestamp(), std::memory_order_relaxed);
+        endUpdate(*station);
+    }
+
+    return true;
+}
+
+/** @brief Get a consistent snapshot of a charge point */
+bool StationStateStore::snapshot(const std::string& identifier, StationSnapshot& snapshot) const
+{
+    std::shared_ptr<Station> station;
+    if (!m_stations.find(identifier, station))
+    {
+        return false;
+    }
+
+    // Retry until no writer has modified the charge point during the copy
+    uint32_t start;
+    uint32_t end;
+    do
+    {
+        start = station->sequence.load(std::memory_order_acquire);
+        if ((start & 1u) != 0)
+        {
+            end = start + 1u;
+            continue;
+        }
+
+        snapshot.connected       = station->connected.load(std::memory_order_relaxed);
+        snapshot.main_energy_wh  = station->main_energy_wh.load(std::memory_order_relaxed);
+        snapshot.main_power_w    = station->main_power_w.load(std::memory_order_relaxed);
+        snapshot.connector_count = station->connector_count.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < snapshot.connector_count; i++)
+        {
+            const Slot&        slot      = station->slots[i];
+            ConnectorSnapshot& connector = snapshot.connectors[i];
+            int                status    = slot.status.load(std::memory_order_relaxed);
+
+            connector.evse_id         = slot.evse_id.load(std::memory_order_relaxed);
+            connector.connector_id    = slot.connector_id.load(std::memory_order_relaxed);
+            connector.status_known    = (status != 0);
+            connector.status          = static_cast<ConnectorStatusEnumType>(connector.status_known ? (status - 1) : 0);
+            connector.transaction     = (slot.transaction.load(std::memory_order_relaxed) != 0);
+            connector.charging        = slot.charging.load(std::memory_order_relaxed);
+            connector.energy_wh       = slot.energy_wh.load(std::memory_order_relaxed);
+            connector.power_w         = slot.power_w.load(std::memory_order_relaxed);
+            connector.power_offered_w = slot.power_offered_w.load(std::memory_order_relaxed);
+            connector.updated         = slot.updated.load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        end = station->sequence.load(std::memory_order_relaxed);
+    } while (start != end);
+
+    return true;
+}
+
+/** @brief Get the charge points which have been modified since the previous call */
+void StationStateStore::takeChanges(std::vector<std::string>& identifiers)
+{
+    identifiers.clear();
+    {
+        std::lock_guard<std::mutex> lock(m_changes_mutex);
+        identifiers.swap(m_changes);
+    }
+
+    // The flags are cleared before the caller reads the charge points so that a new update is never missed
+    for (const auto& identifier : identifiers)
+    {
+        std::shared_ptr<Station> station;
+        if (m_stations.find(identifier, station))
+        {
+            station->modified.store(false);
+        }
+    }
+}
+
+/** @brief Get a charge point, it is created if needed */
+std::shared_ptr<StationStateStore::Station> StationStateStore::getStation(const std::string& identifier)
+{
+    std::shared_ptr<Station> station;
+    if (!m_stations.find(identifier, station))
+    {
+        m_stations.insertIfAbsent(identifier, [&identifier] { return std::make_shared<Station>(identifier); });
+        m_stations.find(identifier, station);
+    }
+    return station;
+}
+
+/** @brief Start an update of a charge point (writer mutex must be held) */
+void StationStateStore::beginUpdate(Station& station)
+{
+    station.sequence.store(station.sequence.load(std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+/** @brief End an update of a charge point and mark it as modified (writer mutex must be held) */
+void StationStateStore::endUpdate(Station& station)
+{
+    station.sequence.store(station.sequence.load(std::memory_order_relaxed) + 1u, std::memory_order_release);
+
+    if (!station.modified.exchange(true))
+    {
+        std::lock_guard<std::mutex> lock(m_changes_mutex);
+        m_changes.push_back(station.identifier);
+    }
+}
+
+/** @brief Get the slot of a connector, it is allocated if needed (nullptr if no more slots are available) */
+StationStateStore::Slot* StationStateStore::getSlot(Station& station, int evse_id, int connector_id)
+{
+    Slot*  slot  = nullptr;
+    size_t count = station.connector_count.load(std::memory_order_relaxed);
+    for (size_t i = 0; (i < count) && !slot; i++)
+    {
+        if ((station.slots[i].evse_id.load(std::memory_order_relaxed) == evse_id) &&
+            (station.slots[i].connector_id.load(std::memory_order_relaxed) == connector_id))
+        {
+            slot = &station.slots[i];
+        }
+    }
+    if (!slot && (count < MAX_CONNECTORS))
+    {
+        // Readers only look at the first connector_count slots, the new slot is published with the count
+        slot = &station.slots[count];
+        beginUpdate(station);
+        slot->evse_id.store(evse_id, std::memory_order_relaxed);
+        slot->connector_id.store(connector_id, std::memory_order_relaxed);
+        station.connector_count.store(count + 1u, std::memory_order_relaxed);
+        endUpdate(station);
+    }
+    return slot;
+}
+
+/** @brief Apply meter values to a slot or to the main meter (slot = nullptr) */
+void StationStateStore::applyMeterValues(Station& station, Slot* slot, const std::vector<MeterValueType>& meter_values)
+{
+    for (const MeterValueType& meter_value : meter_values)
+    {
+        for (const SampledValueType& sampled_value : meter_value.sampledValue)
+        {
+            // Only the totals are stored, not the per phase values
+            if (sampled_value.phase.isSet())
+            {
+                continue;
+            }
+
+            // Convert to Wh or W
+            double value = sampled_value.value;
+            if (sampled_value.unitOfMeasure.isSet())
+            {
+                const UnitOfMeasureType& unit = sampled_value.unitOfMeasure.value();
+                if (unit.multiplier.isSet())
+                {
+                    value *= std::pow(10., unit.multiplier.value());
+                }
+                if (unit.unit.isSet() && ((unit.unit.value().str() == "kWh") || (unit.unit.value().str() == "kW")))
+                {
+                    value *= 1000.;
+                }
+            }
+
+            // Energy.Active.Import.Register is the default measurand
+            MeasurandEnumType measurand = sampled_value.measurand.isSet() ? sampled_value.measurand.value()
+                                                                          : MeasurandEnumType::Energy_Active_Import_Register;
+            switch (measurand)
+            {
+                case MeasurandEnumType::Energy_Active_Import_Register:
+                    (slot ? slot->energy_wh : station.main_energy_wh).store(value, std::memory_order_relaxed);
+                    break;
+                case MeasurandEnumType::Power_Active_Import:
+                    (slot ? slot->power_w : station.main_power_w).store(value, std::memory_order_relaxed);
+                    break;
+                case MeasurandEnumType::Power_Offered:
+                    if (slot)
+                    {
+                        slot->power_offered_w.store(value, std::memory_order_relaxed);
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+        if (slot)
+        {
+            slot->updated.store(meter_value.timestamp.timestamp(), std::memory_order_relaxed);
+        }
+    }
+}
+
+} // ocpp
+} // os
@@ -0,0 +1,191 @@
+#ifndef OS_STATION_STATE_STORE_H
+#define OS_STATION_STATE_STORE_H
+
+#include "ConnectorStatusEnumType20.h"
+#include "MeterValueType20.h"
+#include "ShardedMap.h"
+#include "TransactionEvent20.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace os {
+namespace ocpp {
+
+/** @brief Live state of the charge points built from the StatusNotification, MeterValues and TransactionEvent requests.
+ *
+ *  Each charge point owns a flat array of connector slots, filled in the order the connectors are first reported.
+ *  Writers of a charge point are serialized by a mutex and publish their updates through a sequence counter,
+ *  so readers copy a consistent snapshot without taking any lock on the charge point.
+ *  The modified charge points are collected once until they are taken by takeChanges().
+ */
+class StationStateStore
+{
+  public:
+    /** @brief Maximum number of connectors stored for a charge point */
+    static constexpr size_t MAX_CONNECTORS = 16u;
+
+    /** @brief Snapshot of a connector */
+    struct ConnectorSnapshot
+    {
+        /** @brief EVSE id */
+        int evse_id = 0;
+        /** @brief Connector id within the EVSE */
+        int connector_id = 0;
+        /** @brief Indicate if a status has been reported */
+        bool status_known = false;
+        /** @brief Last reported status */
+        ::ocpp::types::ocpp20::ConnectorStatusEnumType status = ::ocpp::types::ocpp20::ConnectorStatusEnumType::Unavailable;
+        /** @brief Indicate if a transaction is ongoing */
+        bool transaction = false;
+        /** @brief Indicate if energy is flowing to the EV */
+        bool charging = false;
+        /** @brief Active energy imported (Wh) */
+        double energy_wh = 0.;
+        /** @brief Active power imported (W) */
+        double power_w = 0.;
+        /** @brief Maximum power offered to the EV (W) */
+        double power_offered_w = 0.;
+        /** @brief Timestamp of the last update */
+        std::time_t updated = 0;
+    };
+
+    /** @brief Snapshot of a charge point */
+    struct StationSnapshot
+    {
+        /** @brief Indicate if the charge point is connected */
+        bool connected = false;
+        /** @brief Number of valid entries in connectors */
+        size_t connector_count = 0;
+        /** @brief Connectors */
+        std::array<ConnectorSnapshot, MAX_CONNECTORS> connectors;
+        /** @brief Active energy imported on the main meter (Wh) */
+        double main_energy_wh = 0.;
+        /** @brief Active power imported on the main meter (W) */
+        double main_power_w = 0.;
+    };
+
+    /** @brief Constructor */
+    StationStateStore();
+    /** @brief Destructor */
+    virtual ~StationStateStore();
+
+    /** @brief Update the connection state of a charge point */
+    void setConnected(const std::string& identifier, bool connected);
+
+    /** @brief Update the status of a connector (StatusNotification) */
+    void updateConnectorStatus(const std::string&                             identifier,
+                               int                                            evse_id,
+                               int                                            connector_id,
+                               ::ocpp::types::ocpp20::ConnectorStatusEnumType status,
+                               std::time_t                                    timestamp);
+
+    /** @brief Update the meter values of an EVSE, EVSE 0 is the main meter (MeterValues) */
+    void updateMeterValues(const std::string& identifier, int evse_id, const std::vector<::ocpp::types::ocpp20::MeterValueType>& meter_values);
+
+    /**
+     * @brief Update the transaction state and the meter values of an EVSE (TransactionEvent)
+     * @param identifier Charge point identifier
+     * @param request Transaction event
+     * @param evse_id EVSE of the transaction, given by the first event of the transaction (0 = unknown)
+     * @return false if the event has already been applied (retransmission), true otherwise
+     */
+    bool updateTransaction(const std::string& identifier, const ::ocpp::messages::ocpp20::TransactionEventReq& request, int& evse_id);
+
+    /**
+     * @brief Get a consistent snapshot of a charge point
+     * @param identifier Charge point identifier
+     * @param snapshot Snapshot of the charge point
+     * @return true if the charge point is known, false otherwise
+     */
+    bool snapshot(const std::string& identifier, StationSnapshot& snapshot) const;
+
+    /**
+     * @brief Get the charge points which have been modified since the previous call
+     * @param identifiers Identifiers of the modified charge points (each charge point is listed once)
+     */
+    void takeChanges(std::vector<std::string>& identifiers);
+
+  private:
+    /** @brief Connector slot, the fields are only read between 2 identical even values of the sequence counter */
+    struct Slot
+    {
+        /** @brief EVSE id */
+        std::atomic<int> evse_id{0};
+        /** @brief Connector id within the EVSE */
+        std::atomic<int> connector_id{0};
+        /** @brief Last reported status + 1 (0 = unknown) */
+        std::atomic<int> status{0};
+        /** @brief Hash of the ongoing transaction id (0 = no transaction) */
+        std::atomic<size_t> transaction{0};
+        /** @brief Indicate if energy is flowing to the EV */
+        std::atomic<bool> charging{false};
+        /** @brief Active energy imported (Wh) */
+        std::atomic<double> energy_wh{0.};
+        /** @brief Active power imported (W) */
+        std::atomic<double> power_w{0.};
+        /** @brief Maximum power offered to the EV (W) */
+        std::atomic<double> power_offered_w{0.};
+        /** @brief Timestamp of the last update */
+        std::atomic<std::time_t> updated{0};
+        /** @brief Hash of the last transaction id, kept after its end (only used by the writers) */
+        size_t last_transaction = 0;
+        /** @brief Sequence number of the last event of the last transaction (only used by the writers) */
+        int last_seq_no = -1;
+    };
+
+    /** @brief State of a charge point */
+    struct Station
+    {
+        /** @brief Constructor */
+        Station(const std::string& _identifier) : identifier(_identifier) { }
+
+        /** @brief Charge point identifier */
+        const std::string identifier;
+        /** @brief Indicate if the charge point is already in the list of modified charge points */
+        std::atomic<bool> modified{false};
+        /** @brief Serializes the writers */
+        std::mutex writer_mutex;
+        /** @brief Sequence counter, odd while an update is in progress */
+        std::atomic<uint32_t> sequence{0};
+        /** @brief Indicate if the charge point is connected */
+        std::atomic<bool> connected{false};
+        /** @brief Number of used slots */
+        std::atomic<size_t> connector_count{0};
+        /** @brief Connector slots */
+        std::array<Slot, MAX_CONNECTORS> slots;
+        /** @brief Active energy imported on the main meter (Wh) */
+        std::atomic<double> main_energy_wh{0.};
+        /** @brief Active power imported on the main meter (W) */
+        std::atomic<double> main_power_w{0.};
+    };
+
+    /** @brief Charge points, kept after disconnection so that their last known state stays available */
+    ShardedMap<std::string, std::shared_ptr<Station>> m_stations;
+    /** @brief Mutex for the list of modified charge points */
+    std::mutex m_changes_mutex;
+    /** @brief Modified charge points */
+    std::vector<std::string> m_changes;
+
+    /** @brief Get a charge point, it is created if needed */
+    std::shared_ptr<Station> getStation(const std::string& identifier);
+    /** @brief Start an update of a charge point (writer mutex must be held) */
+    void beginUpdate(Station& station);
+    /** @brief End an update of a charge point and mark it as modified (writer mutex must be held) */
+    void endUpdate(Station& station);
+    /** @brief Get the slot of a connector, it is allocated if needed (nullptr if no more slots are available) */
+    Slot* getSlot(Station& station, int evse_id, int connector_id);
+    /** @brief Apply meter values to a slot or to the main meter (slot = nullptr) */
+    static void applyMeterValues(Station& station, Slot* slot, const std::vector<::ocpp::types::ocpp20::MeterValueType>& meter_values);
+};
+
+} // ocpp
+} // os
+
+#endif // OS_STATION_STATE_STORE_H
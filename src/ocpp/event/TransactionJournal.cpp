@@ -0,0 +1,1073 @@
+#include "TransactionJournal.h"
+#include "RecordCodec.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <experimental/filesystem>
+#include <iostream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+using namespace ::ocpp::types;
+using namespace ::ocpp::types::ocpp20;
+using namespace ::ocpp::messages::ocpp20;
+
+namespace os {
+namespace ocpp {
+
+/** @brief Magic number at the start of a segment file ("OSJ1") */
+static constexpr uint32_t SEGMENT_MAGIC = 0x314A534Fu;
+/** @brief Version of the segment file format */
+static constexpr uint32_t SEGMENT_VERSION = 1u;
+/** @brief Size of the segment file header : magic, version, segment id, reserved */
+static constexpr size_t SEGMENT_HEADER_SIZE = 32u;
+/** @brief Size of a record header : payload length, CRC, sequence number, record type, reserved */
+static constexpr size_t RECORD_HEADER_SIZE = 24u;
+/** @brief Alignment of the records in a segment */
+static constexpr size_t RECORD_ALIGNMENT = 8u;
+/** @brief Record holding a TransactionEvent request */
+static constexpr uint32_t RECORD_EVENT = 1u;
+/** @brief Record holding the compacted state of a transaction */
+static constexpr uint32_t RECORD_STATE = 2u;
+/** @brief Number of transactions encoded by a compaction each time it takes the journal mutex */
+static constexpr size_t COMPACTION_BATCH_SIZE = 1024u;
+/** @brief Prefix of the segment file names */
+static const std::string SEGMENT_PREFIX = "journal-";
+/** @brief Extension of the segment file names */
+static const std::string SEGMENT_EXTENSION = ".log";
+
+/** @brief Flush a directory entry to the storage */
+static bool syncDirectory(const std::string& directory);
+
+/** @brief Memory-mapped segment file */
+struct TransactionJournal::Segment
+{
+    /** @brief Constructor */
+    Segment(uint64_t _id, int _fd, uint8_t* _base, size_t _size)
+        : id(_id), fd(_fd), base(_base), size(_size), write_offset(SEGMENT_HEADER_SIZE), synced_offset(0)
+    {
+    }
+    /** @brief Destructor */
+    ~Segment()
+    {
+        munmap(base, size);
+        ::close(fd);
+    }
+
+    /** @brief Segment id */
+    const uint64_t id;
+    /** @brief File descriptor */
+    const int fd;
+    /** @brief Mapped file */
+    uint8_t* const base;
+    /** @brief Size of the file */
+    const size_t size;
+    /** @brief Offset of the next record (journal mutex must be held) */
+    size_t write_offset;
+    /** @brief Offset up to which the file is durable (journal mutex must be held) */
+    size_t synced_offset;
+};
+
+/** @brief Constructor */
+TransactionJournal::TransactionJournal()
+    : m_settings(),
+      m_directory(),
+      m_mutex(),
+      m_flush_cond(),
+      m_durable_cond(),
+      m_compaction_cond(),
+      m_compaction_mutex(),
+      m_active(),
+      m_unsynced(),
+      m_sealed(),
+      m_next_segment_id(1u),
+      m_last_sequence(0),
+      m_durable_sequence(0),
+      m_lost_first_sequence(0),
+      m_lost_last_sequence(0),
+      m_waiters(0),
+      m_failed(false),
+      m_stop(false),
+      m_index(),
+      m_frozen_index(),
+      m_flusher(),
+      m_compactor()
+{
+}
+
+/** @brief Destructor */
+TransactionJournal::~TransactionJournal()
+{
+    close();
+}
+
+/** @brief Open the journal, replay its segments and start a new segment */
+bool TransactionJournal::open(const std::string& directory, const Settings& settings)
+{
+    namespace fs = std::experimental::filesystem;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_active)
+    {
+        return false;
+    }
+
+    // A segment must at least hold its header and a record
+    m_settings              = settings;
+    m_settings.segment_size = std::max<size_t>(m_settings.segment_size, 64u * 1024u);
+    m_directory             = directory;
+
+    std::error_code error;
+    fs::create_directories(m_directory, error);
+    if (!fs::is_directory(m_directory, error))
+    {
+        cout << "✗ Transaction journal : invalid directory " << m_directory << endl;
+        return false;
+    }
+
+    // List the segments, the leftovers of an interrupted compaction are discarded
+    std::vector<uint64_t> ids;
+    for (const auto& entry : fs::directory_iterator(m_directory, error))
+    {
+        std::string name = entry.path().filename().string();
+        if ((name.compare(0, SEGMENT_PREFIX.size(), SEGMENT_PREFIX) != 0) || (name.size() <= SEGMENT_PREFIX.size()))
+        {
+            continue;
+        }
+        if ((name.size() > SEGMENT_EXTENSION.size()) &&
+            (name.compare(name.size() - SEGMENT_EXTENSION.size(), SEGMENT_EXTENSION.size(), SEGMENT_EXTENSION) == 0))
+        {
+            std::string id = name.substr(SEGMENT_PREFIX.size(), name.size() - SEGMENT_PREFIX.size() - SEGMENT_EXTENSION.size());
+            if (!id.empty() && (id.find_first_not_of("0123456789abcdef") == std::string::npos))
+            {
+                ids.push_back(std::stoull(id, nullptr, 16));
+            }
+        }
+        else
+        {
+            fs::remove(entry.path(), error);
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+
+    // Rebuild the index
+    m_index.clear();
+    m_frozen_index.clear();
+    m_sealed.clear();
+    m_last_sequence = 0;
+    for (uint64_t id : ids)
+    {
+        m_last_sequence = std::max(m_last_sequence, replaySegment(segmentPath(id)));
+        m_sealed.push_back(id);
+    }
+    m_durable_sequence    = m_last_sequence;
+    m_lost_first_sequence = 0;
+    m_lost_last_sequence  = 0;
+    m_next_segment_id     = ids.empty() ? 1u : (ids.back() + 1u);
+
+    // Never append after a possibly torn tail : always start a new segment
+    m_active = createSegment(m_next_segment_id++);
+    if (!m_active)
+    {
+        return false;
+    }
+
+    cout << "✓ Transaction journal opened from " << m_directory << " : " << ids.size() << " segment(s), " << m_index.size()
+         << " transaction(s)" << endl;
+
+    m_failed    = false;
+    m_stop      = false;
+    m_flusher   = std::thread(&TransactionJournal::flusherThread, this);
+    m_compactor = std::thread(&TransactionJournal::compactionThread, this);
+    return true;
+}
+
+/** @brief Make all the appended records durable and close the journal */
+void TransactionJournal::close()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_active)
+        {
+            return;
+        }
+        m_stop = true;
+    }
+    m_flush_cond.notify_one();
+    m_compaction_cond.notify_one();
+    m_flusher.join();
+    m_compactor.join();
+
+    // The flusher has made all the records durable, the unused part of the active segment is released
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (ftruncate(m_active->fd, static_cast<off_t>(m_active->write_offset)) == 0)
+    {
+        fsync(m_active->fd);
+    }
+    m_active.reset();
+    m_unsynced.clear();
+    m_sealed.clear();
+    m_index.clear();
+    m_frozen_index.clear();
+    m_durable_cond.notify_all();
+}
+
+/** @brief Indicate if the journal is opened */
+bool TransactionJournal::isOpen() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return static_cast<bool>(m_active);
+}
+
+/** @brief Append a TransactionEvent request and update the index */
+uint64_t TransactionJournal::append(const std::string& station, const TransactionEventReq& request)
+{
+    // Encode outside of the lock, the buffer is reused by the thread
+    thread_local std::string payload;
+    encodeEvent(payload, station, request);
+    uint32_t payload_crc = crc32c(payload.data(), payload.size());
+    size_t   size        = recordSize(payload.size());
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_active || m_failed)
+    {
+        return 0;
+    }
+    if (size > (m_settings.segment_size - SEGMENT_HEADER_SIZE))
+    {
+        cout << "✗ Transaction journal : record too big for a segment (" << size << " bytes)" << endl;
+        return 0;
+    }
+
+    // Rotate to a new segment, the filled one will be made durable by the flusher
+    if ((m_active->write_offset + size) > m_active->size)
+    {
+        std::shared_ptr<Segment> segment = createSegment(m_next_segment_id);
+        if (!segment)
+        {
+            return 0;
+        }
+        m_next_segment_id++;
+        m_unsynced.push_back(m_active);
+        m_active = segment;
+    }
+
+    uint64_t sequence = m_last_sequence + 1u;
+    writeRecord(m_active->base + m_active->write_offset, sequence, RECORD_EVENT, payload, payload_crc);
+    m_active->write_offset += size;
+    m_last_sequence = sequence;
+
+    // The index follows the order of the journal
+    applyEvent(updateState(station, request.transactionInfo.transactionId.str()), request);
+
+    return sequence;
+}
+
+/** @brief Wait until a record is durable, the wait is shared with all the writers of the same group commit */
+bool TransactionJournal::waitDurable(uint64_t sequence)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if ((sequence == 0) || !m_active)
+    {
+        return false;
+    }
+
+    m_waiters++;
+    m_flush_cond.notify_one();
+    m_durable_cond.wait(lock, [this, sequence] { return (m_durable_sequence >= sequence) || m_failed || !m_active; });
+    m_waiters--;
+
+    // The records of a failed synchronization are considered as lost
+    return (m_durable_sequence >= sequence) && ((sequence < m_lost_first_sequence) || (sequence > m_lost_last_sequence));
+}
+
+/** @brief Get the latest state of a transaction */
+bool TransactionJournal::find(const std::string& station, const std::string& transaction_id, TransactionState& state) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const TransactionState*     found = findState(indexKey(station, transaction_id));
+    if (!found)
+    {
+        return false;
+    }
+    state = *found;
+    return true;
+}
+
+/** @brief Get the latest state of the ongoing transactions */
+std::vector<TransactionJournal::TransactionState> TransactionJournal::ongoingTransactions() const
+{
+    std::vector<TransactionState> transactions;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& iter : m_index)
+    {
+        if (iter.second.ended == 0)
+        {
+            transactions.push_back(iter.second);
+        }
+    }
+    for (const auto& iter : m_frozen_index)
+    {
+        if ((iter.second.ended == 0) && (m_index.find(iter.first) == m_index.end()))
+        {
+            transactions.push_back(iter.second);
+        }
+    }
+
+    return transactions;
+}
+
+/** @brief Get the number of transactions in the index */
+size_t TransactionJournal::size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t                      count = m_frozen_index.size();
+    for (const auto& iter : m_index)
+    {
+        if (m_frozen_index.find(iter.first) == m_frozen_index.end())
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+/** @brief Compact the filled segments now */
+bool TransactionJournal::compact()
+{
+    {
+        // Only the durable segments can be compacted
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_active)
+        {
+            return false;
+        }
+        sync(lock);
+    }
+    return compactSegments();
+}
+
+/** @brief Flusher thread, makes the appended records durable */
+void TransactionJournal::flusherThread()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stop)
+    {
+        // Synchronize immediately when a writer is waiting, the records appended meanwhile join the next group
+        m_flush_cond.wait_for(lock,
+                              m_settings.group_commit_interval,
+                              [this] { return m_stop || ((m_waiters != 0) && (m_last_sequence != m_durable_sequence)); });
+        sync(lock);
+    }
+    sync(lock);
+}
+
+/** @brief Compaction thread, compacts the filled segments once there are enough of them */
+void TransactionJournal::compactionThread()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stop)
+    {
+        m_compaction_cond.wait(lock,
+                               [this]
+                               {
+                                   return m_stop || ((m_settings.compaction_segments != 0) &&
+                                                     (m_sealed.size() >= std::max<size_t>(m_settings.compaction_segments, 2u)));
+                               });
+        if (!m_stop)
+        {
+            lock.unlock();
+            if (!compactSegments())
+            {
+                // Retry on the next filled segment
+                lock.lock();
+                size_t count = m_sealed.size();
+                m_compaction_cond.wait(lock, [this, count] { return m_stop || (m_sealed.size() > count); });
+                continue;
+            }
+            lock.lock();
+        }
+    }
+}
+
+/** @brief Make the appended records durable (mutex must be held, it is released during the synchronization) */
+void TransactionJournal::sync(std::unique_lock<std::mutex>& lock)
+{
+    if (m_failed)
+    {
+        recover();
+    }
+    if (m_failed || (m_last_sequence == m_durable_sequence))
+    {
+        return;
+    }
+
+    // Pending ranges, the segments are kept mapped by the shared pointers
+    struct Range
+    {
+        std::shared_ptr<Segment> segment;
+        size_t                   begin;
+        size_t                   end;
+    };
+    std::vector<Range> ranges;
+    for (const auto& segment : m_unsynced)
+    {
+        ranges.push_back({segment, segment->synced_offset, segment->write_offset});
+    }
+    if (m_active->write_offset > m_active->synced_offset)
+    {
+        ranges.push_back({m_active, m_active->synced_offset, m_active->write_offset});
+    }
+    uint64_t sequence = m_last_sequence;
+
+    lock.unlock();
+    static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    int                 error     = 0;
+    for (const Range& range : ranges)
+    {
+        size_t begin = range.begin & ~(page_size - 1u);
+        if ((error == 0) && (msync(range.segment->base + begin, range.end - begin, MS_SYNC) != 0))
+        {
+            error = errno;
+        }
+    }
+    lock.lock();
+
+    if (error != 0)
+    {
+        // The appends are rejected until a new segment is started, the pending writers are notified of the failure
+        cout << "✗ Transaction journal : synchronization failed (" << strerror(error) << ")" << endl;
+        m_failed = true;
+        recover();
+    }
+    else
+    {
+        for (const Range& range : ranges)
+        {
+            range.segment->synced_offset = std::max(range.segment->synced_offset, range.end);
+        }
+        while (!m_unsynced.empty() && (m_unsynced.front()->synced_offset == m_unsynced.front()->write_offset))
+        {
+            m_sealed.push_back(m_unsynced.front()->id);
+            m_unsynced.erase(m_unsynced.begin());
+            m_compaction_cond.notify_one();
+        }
+        m_durable_sequence = std::max(m_durable_sequence, sequence);
+    }
+    m_durable_cond.notify_all();
+}
+
+/** @brief Start a new segment after a failed synchronization (mutex must be held) */
+void TransactionJournal::recover()
+{
+    std::shared_ptr<Segment> segment = createSegment(m_next_segment_id);
+    if (!segment)
+    {
+        // Retried on the next synchronization
+        return;
+    }
+    m_next_segment_id++;
+
+    // The records which were not durable are lost, the failed segments are kept for the replay
+    // which will stop at their first corrupted record
+    m_lost_first_sequence = m_durable_sequence + 1u;
+    m_lost_last_sequence  = m_last_sequence;
+    m_durable_sequence    = m_last_sequence;
+    for (const auto& failed : m_unsynced)
+    {
+        m_sealed.push_back(failed->id);
+    }
+    m_sealed.push_back(m_active->id);
+    m_unsynced.clear();
+    m_active = segment;
+    m_failed = false;
+    m_compaction_cond.notify_one();
+
+    cout << "✓ Transaction journal : restarted on segment " << segmentPath(m_active->id) << ", sequences " << m_lost_first_sequence
+         << " to " << m_lost_last_sequence << " are lost" << endl;
+}
+
+/** @brief Compact the filled segments */
+bool TransactionJournal::compactSegments()
+{
+    std::lock_guard<std::mutex>  compaction_lock(m_compaction_mutex);
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_sealed.size() < 2u)
+    {
+        return true;
+    }
+
+    // Freeze the index, the events appended meanwhile update a copy of the state of their transaction.
+    // The events of the active segment are older than the snapshot and will be ignored on replay thanks to their sequence number
+    std::vector<uint64_t> segments = m_sealed;
+    uint64_t              sequence = m_durable_sequence;
+    std::time_t           expiry   = std::time(nullptr) - static_cast<std::time_t>(m_settings.ended_retention.count());
+    m_frozen_index.swap(m_index);
+    lock.unlock();
+
+    // Drop the expired transactions and snapshot the others, the mutex is only held for a batch of transactions
+    // at a time so that the appends and the durability waits are not stalled by a large index
+    std::string content(SEGMENT_HEADER_SIZE, '\0');
+    std::string payload;
+    auto        iter = m_frozen_index.begin();
+    while (iter != m_frozen_index.end())
+    {
+        lock.lock();
+        for (size_t count = 0; (count < COMPACTION_BATCH_SIZE) && (iter != m_frozen_index.end()); count++)
+        {
+            if ((iter->second.ended != 0) && (iter->second.ended < expiry))
+            {
+                iter = m_frozen_index.erase(iter);
+            }
+            else
+            {
+                encodeState(payload, iter->second);
+                size_t offset = content.size();
+                content.resize(offset + recordSize(payload.size()));
+                writeRecord(
+                    reinterpret_cast<uint8_t*>(&content[offset]), sequence, RECORD_STATE, payload, crc32c(payload.data(), payload.size()));
+                ++iter;
+            }
+        }
+        lock.unlock();
+    }
+
+    // The compacted segment replaces the most recent filled segment
+    memcpy(&content[0], &SEGMENT_MAGIC, sizeof(SEGMENT_MAGIC));
+    memcpy(&content[4], &SEGMENT_VERSION, sizeof(SEGMENT_VERSION));
+    memcpy(&content[8], &segments.back(), sizeof(uint64_t));
+
+    std::string path    = segmentPath(segments.back());
+    std::string tmp     = path + ".tmp";
+    bool        success = false;
+    int         fd      = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd >= 0)
+    {
+        size_t written = 0;
+        while (written < content.size())
+        {
+            ssize_t ret = write(fd, content.data() + written, content.size() - written);
+            if (ret <= 0)
+            {
+                break;
+            }
+            written += static_cast<size_t>(ret);
+        }
+        success = (written == content.size()) && (fsync(fd) == 0);
+        ::close(fd);
+    }
+    success = success && (rename(tmp.c_str(), path.c_str()) == 0) && syncDirectory(m_directory);
+    if (success)
+    {
+        // Older segments only hold stale events from now on
+        for (size_t i = 0; i < (segments.size() - 1u); i++)
+        {
+            unlink(segmentPath(segments[i]).c_str());
+        }
+        syncDirectory(m_directory);
+    }
+    else
+    {
+        cout << "✗ Transaction journal : compaction failed (" << strerror(errno) << ")" << endl;
+        unlink(tmp.c_str());
+    }
+
+    // Merge the transactions modified during the compaction back into the index
+    lock.lock();
+    for (auto& modified : m_index)
+    {
+        m_frozen_index[modified.first] = std::move(modified.second);
+    }
+    m_index.swap(m_frozen_index);
+    m_frozen_index.clear();
+    if (success)
+    {
+        m_sealed.erase(m_sealed.begin(), m_sealed.begin() + static_cast<std::ptrdiff_t>(segments.size() - 1u));
+        cout << "✓ Transaction journal compacted : " << segments.size() << " segments into " << content.size() << " bytes" << endl;
+    }
+
+    return success;
+}
+
+/** @brief Get the state of a transaction to update, it is created if needed (mutex must be held) */
+TransactionJournal::TransactionState& TransactionJournal::updateState(const std::string& station, const std::string& transaction_id)
+{
+    std::string key  = indexKey(station, transaction_id);
+    auto        iter = m_index.find(key);
+    if (iter == m_index.end())
+    {
+        // The index frozen by a running compaction is not modified, the state is copied from it
+        auto frozen = m_frozen_index.find(key);
+        iter        = m_index.emplace(std::move(key), (frozen != m_frozen_index.end()) ? frozen->second : TransactionState()).first;
+        if (iter->second.station.empty())
+        {
+            iter->second.station        = station;
+            iter->second.transaction_id = transaction_id;
+        }
+    }
+    return iter->second;
+}
+
+/** @brief Get the state of a transaction, nullptr if it is unknown (mutex must be held) */
+const TransactionJournal::TransactionState* TransactionJournal::findState(const std::string& key) const
+{
+    auto iter = m_index.find(key);
+    if (iter != m_index.end())
+    {
+        return &iter->second;
+    }
+    auto frozen = m_frozen_index.find(key);
+    if (frozen != m_frozen_index.end())
+    {
+        return &frozen->second;
+    }
+    return nullptr;
+}
+
+/** @brief Create a new segment file */
+std::shared_ptr<TransactionJournal::Segment> TransactionJournal::createSegment(uint64_t id)
+{
+    std::shared_ptr<Segment> segment;
+
+    std::string path  = segmentPath(id);
+    int         error = 0;
+    int         fd    = ::open(path.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (fd >= 0)
+    {
+        // Allocate the blocks now so that the writes through the mapping can't fail on a full disk,
+        // posix_fallocate() returns the error code instead of setting errno
+        error = posix_fallocate(fd, 0, static_cast<off_t>(m_settings.segment_size));
+        if (error == EOPNOTSUPP)
+        {
+            error = (ftruncate(fd, static_cast<off_t>(m_settings.segment_size)) == 0) ? 0 : errno;
+        }
+        void* base = MAP_FAILED;
+        if (error == 0)
+        {
+            if ((fsync(fd) == 0) && syncDirectory(m_directory))
+            {
+                base = mmap(nullptr, m_settings.segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            }
+            if (base == MAP_FAILED)
+            {
+                error = errno;
+            }
+        }
+        if (base != MAP_FAILED)
+        {
+            segment = std::make_shared<Segment>(id, fd, static_cast<uint8_t*>(base), m_settings.segment_size);
+            memcpy(segment->base, &SEGMENT_MAGIC, sizeof(SEGMENT_MAGIC));
+            memcpy(segment->base + 4u, &SEGMENT_VERSION, sizeof(SEGMENT_VERSION));
+            memcpy(segment->base + 8u, &id, sizeof(id));
+        }
+        else
+        {
+            ::close(fd);
+            unlink(path.c_str());
+        }
+    }
+    else
+    {
+        error = errno;
+    }
+    if (!segment)
+    {
+        cout << "✗ Transaction journal : unable to create segment " << path << " (" << strerror(error) << ")" << endl;
+    }
+
+    return segment;
+}
+
+/** @brief Replay the records of a segment file into the index, returns the last sequence number found */
+uint64_t TransactionJournal::replaySegment(const std::string& path)
+{
+    uint64_t last_sequence = 0;
+
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return last_sequence;
+    }
+    struct stat st;
+    if ((fstat(fd, &st) != 0) || (static_cast<size_t>(st.st_size) < SEGMENT_HEADER_SIZE))
+    {
+        ::close(fd);
+        return last_sequence;
+    }
+    size_t size = static_cast<size_t>(st.st_size);
+    void*  base = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (base == MAP_FAILED)
+    {
+        return last_sequence;
+    }
+    const uint8_t* data = static_cast<const uint8_t*>(base);
+
+    uint32_t magic;
+    uint32_t version;
+    memcpy(&magic, data, sizeof(magic));
+    memcpy(&version, data + 4u, sizeof(version));
+    size_t offset = SEGMENT_HEADER_SIZE;
+    if ((magic == SEGMENT_MAGIC) && (version == SEGMENT_VERSION))
+    {
+        // Stop at the end of the written records (zero filled) or at the first torn or corrupted record
+        TransactionEventReq request;
+        std::string         station;
+        while ((offset + RECORD_HEADER_SIZE) <= size)
+        {
+            uint32_t length;
+            uint32_t crc;
+            uint64_t sequence;
+            uint32_t type;
+            memcpy(&length, data + offset, sizeof(length));
+            memcpy(&crc, data + offset + 4u, sizeof(crc));
+            memcpy(&sequence, data + offset + 8u, sizeof(sequence));
+            memcpy(&type, data + offset + 16u, sizeof(type));
+            if ((length == 0) || (length > (size - offset - RECORD_HEADER_SIZE)) ||
+                (crc32c(data + offset + 8u, RECORD_HEADER_SIZE - 8u, crc32c(data + offset + RECORD_HEADER_SIZE, length)) != crc))
+            {
+                break;
+            }
+
+            const uint8_t* payload = data + offset + RECORD_HEADER_SIZE;
+            if (type == RECORD_EVENT)
+            {
+                request = TransactionEventReq();
+                if (decodeEvent(payload, length, station, request))
+                {
+                    applyEvent(updateState(station, request.transactionInfo.transactionId.str()), request);
+                }
+            }
+            else if (type == RECORD_STATE)
+            {
+                TransactionState state;
+                if (decodeState(payload, length, state))
+                {
+                    m_index[indexKey(state.station, state.transaction_id)] = state;
+                }
+            }
+
+            last_sequence = std::max(last_sequence, sequence);
+            offset += (RECORD_HEADER_SIZE + length + RECORD_ALIGNMENT - 1u) & ~(RECORD_ALIGNMENT - 1u);
+        }
+    }
+    munmap(base, size);
+
+    return last_sequence;
+}
+
+/** @brief Path of a segment file */
+std::string TransactionJournal::segmentPath(uint64_t id) const
+{
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(id));
+    return m_directory + "/" + SEGMENT_PREFIX + name + SEGMENT_EXTENSION;
+}
+
+/** @brief Key of a transaction in the index */
+std::string TransactionJournal::indexKey(const std::string& station, const std::string& transaction_id)
+{
+    std::string key;
+    key.reserve(station.size() + transaction_id.size() + 1u);
+    key += station;
+    key += '\0';
+    key += transaction_id;
+    return key;
+}
+
+/** @brief Apply an event to the state of a transaction */
+void TransactionJournal::applyEvent(TransactionState& state, const TransactionEventReq& request)
+{
+    // Events already known (retransmissions, replay after a compaction) are ignored
+    if ((state.event_count != 0) && (request.seqNo <= state.seq_no))
+    {
+        return;
+    }
+
+    std::time_t timestamp = request.timestamp.timestamp();
+    if (state.event_count == 0)
+    {
+        state.started = timestamp;
+    }
+    state.updated    = timestamp;
+    state.seq_no     = request.seqNo;
+    state.last_event = request.eventType;
+    state.event_count++;
+    if (request.evse.isSet())
+    {
+        state.evse_id      = request.evse.value().id;
+        state.connector_id = request.evse.value().connectorId.isSet() ? request.evse.value().connectorId.value() : state.connector_id;
+    }
+    if (request.idToken.isSet())
+    {
+        state.id_token = request.idToken.value().idToken.str();
+    }
+    if (request.transactionInfo.chargingState.isSet())
+    {
+        state.charging_state = request.transactionInfo.chargingState.value();
+    }
+    if (request.transactionInfo.stoppedReason.isSet())
+    {
+        state.stopped_reason = request.transactionInfo.stoppedReason.value();
+    }
+    if (request.eventType == TransactionEventEnumType::Ended)
+    {
+        state.ended = timestamp;
+    }
+
+    // Active energy register, total of the phases
+    for (const MeterValueType& meter_value : request.meterValue)
+    {
+        for (const SampledValueType& sampled_value : meter_value.sampledValue)
+        {
+            MeasurandEnumType measurand = sampled_value.measurand.isSet() ? sampled_value.measurand.value()
+                                                                          : MeasurandEnumType::Energy_Active_Import_Register;
+            if ((measurand != MeasurandEnumType::Energy_Active_Import_Register) || sampled_value.phase.isSet())
+            {
+                continue;
+            }
+
+            double value = sampled_value.value;
+            if (sampled_value.unitOfMeasure.isSet())
+            {
+                const UnitOfMeasureType& unit = sampled_value.unitOfMeasure.value();
+                if (unit.multiplier.isSet())
+                {
+                    value *= std::pow(10., unit.multiplier.value());
+                }
+                if (unit.unit.isSet() && (unit.unit.value().str() == "kWh"))
+                {
+                    value *= 1000.;
+                }
+            }
+            if (!state.energy_known)
+            {
+                state.energy_known    = true;
+                state.energy_start_wh = value;
+            }
+            state.energy_wh = value;
+        }
+    }
+}
+
+/** @brief Encode an event record payload */
+void TransactionJournal::encodeEvent(std::string& payload, const std::string& station, const TransactionEventReq& request)
+{
+    payload.clear();
+    putString(payload, station);
+    putString(payload, request.transactionInfo.transactionId.str());
+    put<uint8_t>(payload, static_cast<uint8_t>(request.eventType));
+    put<uint8_t>(payload, static_cast<uint8_t>(request.triggerReason));
+    put<int32_t>(payload, request.seqNo);
+    put<int64_t>(payload, request.timestamp.timestamp());
+    put<uint8_t>(payload, request.offline.isSet() && request.offline.value());
+    const bool has_connector = request.evse.isSet() && request.evse.value().connectorId.isSet();
+    put<int32_t>(payload, request.evse.isSet() ? request.evse.value().id : -1);
+    put<int32_t>(payload, has_connector ? request.evse.value().connectorId.value() : -1);
+    putEnum(payload, request.transactionInfo.chargingState);
+    putEnum(payload, request.transactionInfo.stoppedReason);
+    put<uint8_t>(payload, request.idToken.isSet() ? static_cast<uint8_t>(static_cast<int>(request.idToken.value().type) + 1) : 0u);
+    putString(payload, request.idToken.isSet() ? request.idToken.value().idToken.str() : std::string());
+
+    put<uint16_t>(payload, static_cast<uint16_t>(request.meterValue.size()));
+    for (const MeterValueType& meter_value : request.meterValue)
+    {
+        put<int64_t>(payload, meter_value.timestamp.timestamp());
+        put<uint16_t>(payload, static_cast<uint16_t>(meter_value.sampledValue.size()));
+        for (const SampledValueType& sampled_value : meter_value.sampledValue)
+        {
+            put<float>(payload, sampled_value.value);
+            putEnum(payload, sampled_value.measurand);
+            putEnum(payload, sampled_value.phase);
+            putEnum(payload, sampled_value.context);
+            putEnum(payload, sampled_value.location);
+
+            // Presence flags : unit, multiplier, signed meter value
+            const bool has_unit       = sampled_value.unitOfMeasure.isSet() && sampled_value.unitOfMeasure.value().unit.isSet();
+            const bool has_multiplier = sampled_value.unitOfMeasure.isSet() && sampled_value.unitOfMeasure.value().multiplier.isSet();
+            const bool has_signed     = sampled_value.signedMeterValue.isSet();
+            put<uint8_t>(payload, static_cast<uint8_t>((has_unit ? 1u : 0u) | (has_multiplier ? 2u : 0u) | (has_signed ? 4u : 0u)));
+            if (has_unit)
+            {
+                putString(payload, sampled_value.unitOfMeasure.value().unit.value().str());
+            }
+            if (has_multiplier)
+            {
+                put<int32_t>(payload, sampled_value.unitOfMeasure.value().multiplier.value());
+            }
+            if (has_signed)
+            {
+                const SignedMeterValueType& signed_value = sampled_value.signedMeterValue.value();
+                putString(payload, signed_value.signedMeterData.str());
+                putString(payload, signed_value.signingMethod.str());
+                putString(payload, signed_value.encodingMethod.str());
+                putString(payload, signed_value.publicKey.str());
+            }
+        }
+    }
+}
+
+/** @brief Decode an event record payload */
+bool TransactionJournal::decodeEvent(const uint8_t* payload, size_t size, std::string& station, TransactionEventReq& request)
+{
+    RecordReader reader(payload, size);
+    station = reader.getString();
+    request.transactionInfo.transactionId.assign(reader.getString());
+    request.eventType     = static_cast<TransactionEventEnumType>(reader.get<uint8_t>());
+    request.triggerReason = static_cast<TriggerReasonEnumType>(reader.get<uint8_t>());
+    request.seqNo         = reader.get<int32_t>();
+    request.timestamp     = DateTime(static_cast<std::time_t>(reader.get<int64_t>()));
+    if (reader.get<uint8_t>() != 0)
+    {
+        request.offline = true;
+    }
+    int32_t evse_id      = reader.get<int32_t>();
+    int32_t connector_id = reader.get<int32_t>();
+    if (evse_id >= 0)
+    {
+        request.evse.value().id = evse_id;
+        if (connector_id >= 0)
+        {
+            request.evse.value().connectorId = connector_id;
+        }
+    }
+    reader.getEnum(request.transactionInfo.chargingState);
+    reader.getEnum(request.transactionInfo.stoppedReason);
+    uint8_t     id_token_type = reader.get<uint8_t>();
+    std::string id_token      = reader.getString();
+    if (id_token_type != 0)
+    {
+        request.idToken.value().type = static_cast<IdTokenEnumType>(id_token_type - 1);
+        request.idToken.value().idToken.assign(id_token);
+    }
+
+    uint16_t meter_value_count = reader.get<uint16_t>();
+    for (uint16_t i = 0; (i < meter_value_count) && reader.isValid(); i++)
+    {
+        request.meterValue.emplace_back();
+        MeterValueType& meter_value = request.meterValue.back();
+        meter_value.timestamp       = DateTime(static_cast<std::time_t>(reader.get<int64_t>()));
+
+        uint16_t sampled_value_count = reader.get<uint16_t>();
+        for (uint16_t j = 0; (j < sampled_value_count) && reader.isValid(); j++)
+        {
+            meter_value.sampledValue.emplace_back();
+            SampledValueType& sampled_value = meter_value.sampledValue.back();
+            sampled_value.value             = reader.get<float>();
+            reader.getEnum(sampled_value.measurand);
+            reader.getEnum(sampled_value.phase);
+            reader.getEnum(sampled_value.context);
+            reader.getEnum(sampled_value.location);
+
+            uint8_t flags = reader.get<uint8_t>();
+            if (flags & 1u)
+            {
+                sampled_value.unitOfMeasure.value().unit.value().assign(reader.getString());
+            }
+            if (flags & 2u)
+            {
+                sampled_value.unitOfMeasure.value().multiplier = reader.get<int32_t>();
+            }
+            if (flags & 4u)
+            {
+                SignedMeterValueType& signed_value = sampled_value.signedMeterValue.value();
+                signed_value.signedMeterData.assign(reader.getString());
+                signed_value.signingMethod.assign(reader.getString());
+                signed_value.encodingMethod.assign(reader.getString());
+                signed_value.publicKey.assign(reader.getString());
+            }
+        }
+    }
+
+    return reader.isValid();
+}
+
+/** @brief Encode a state record payload */
+void TransactionJournal::encodeState(std::string& payload, const TransactionState& state)
+{
+    payload.clear();
+    putString(payload, state.station);
+    putString(payload, state.transaction_id);
+    put<int32_t>(payload, state.evse_id);
+    put<int32_t>(payload, state.connector_id);
+    putString(payload, state.id_token);
+    put<int64_t>(payload, state.started);
+    put<int64_t>(payload, state.updated);
+    put<int64_t>(payload, state.ended);
+    put<int32_t>(payload, state.seq_no);
+    put<uint8_t>(payload, static_cast<uint8_t>(state.last_event));
+    putEnum(payload, state.charging_state);
+    putEnum(payload, state.stopped_reason);
+    put<uint8_t>(payload, state.energy_known);
+    put<double>(payload, state.energy_start_wh);
+    put<double>(payload, state.energy_wh);
+    put<uint32_t>(payload, state.event_count);
+}
+
+/** @brief Decode a state record payload */
+bool TransactionJournal::decodeState(const uint8_t* payload, size_t size, TransactionState& state)
+{
+    RecordReader reader(payload, size);
+    state.station         = reader.getString();
+    state.transaction_id  = reader.getString();
+    state.evse_id         = reader.get<int32_t>();
+    state.connector_id    = reader.get<int32_t>();
+    state.id_token        = reader.getString();
+    state.started         = static_cast<std::time_t>(reader.get<int64_t>());
+    state.updated         = static_cast<std::time_t>(reader.get<int64_t>());
+    state.ended           = static_cast<std::time_t>(reader.get<int64_t>());
+    state.seq_no          = reader.get<int32_t>();
+    state.last_event      = static_cast<TransactionEventEnumType>(reader.get<uint8_t>());
+    reader.getEnum(state.charging_state);
+    reader.getEnum(state.stopped_reason);
+    state.energy_known    = (reader.get<uint8_t>() != 0);
+    state.energy_start_wh = reader.get<double>();
+    state.energy_wh       = reader.get<double>();
+    state.event_count     = reader.get<uint32_t>();
+    return reader.isValid();
+}
+
+/** @brief Size of a record in a segment, including its header and its padding */
+size_t TransactionJournal::recordSize(size_t payload_size)
+{
+    return (RECORD_HEADER_SIZE + payload_size + RECORD_ALIGNMENT - 1u) & ~(RECORD_ALIGNMENT - 1u);
+}
+
+/** @brief Write a record : header with the CRC followed by the payload and the padding */
+void TransactionJournal::writeRecord(uint8_t* dest, uint64_t sequence, uint32_t type, const std::string& payload, uint32_t payload_crc)
+{
+    uint32_t length   = static_cast<uint32_t>(payload.size());
+    uint32_t reserved = 0;
+    memcpy(dest + 8u, &sequence, sizeof(sequence));
+    memcpy(dest + 16u, &type, sizeof(type));
+    memcpy(dest + 20u, &reserved, sizeof(reserved));
+    memcpy(dest + RECORD_HEADER_SIZE, payload.data(), payload.size());
+    memset(dest + RECORD_HEADER_SIZE + payload.size(), 0, recordSize(payload.size()) - RECORD_HEADER_SIZE - payload.size());
+
+    // The CRC covers the payload and the header fields which follow it
+    uint32_t crc = crc32c(dest + 8u, RECORD_HEADER_SIZE - 8u, payload_crc);
+    memcpy(dest + 4u, &crc, sizeof(crc));
+    memcpy(dest, &length, sizeof(length));
+}
+
+/** @brief Flush a directory entry to the storage */
+static bool syncDirectory(const std::string& directory)
+{
+    bool ret = false;
+    int  fd  = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd >= 0)
+    {
+        ret = (fsync(fd) == 0);
+        ::close(fd);
+    }
+    return ret;
+}
+
+} // ocpp
+} // os
@@ -0,0 +1,237 @@
+#ifndef OS_TRANSACTION_JOURNAL_H
+#define OS_TRANSACTION_JOURNAL_H
+
+#include "TransactionEvent20.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace os {
+namespace ocpp {
+
+/** @brief Append-only journal of the TransactionEvent requests received from the charge points.
+ *
+ *  The events are appended with their meter values as CRC framed records into memory-mapped segment files
+ *  of a fixed size, a new segment is started when the current one is full and on each opening.
+ *  A flusher thread makes the appended records durable by batches (group commit) : every group commit interval,
+ *  or immediately when a writer waits for its record to be durable. When a synchronization fails, the records
+ *  which were not durable are reported as lost to their writers and the appends continue in a new segment.
+ *  Once enough segments have been filled, they are compacted into a single segment holding the latest state
+ *  of each transaction, the ended transactions being dropped after a retention period. The index is frozen
+ *  during the compaction and is encoded by batches without blocking the appends, which update a copy of the
+ *  states they modify.
+ *  An in-memory index gives the latest state of each transaction, it is rebuilt from the segments on opening :
+ *  the replay stops at the first torn or corrupted record of a segment.
+ */
+class TransactionJournal
+{
+  public:
+    /** @brief Journal settings */
+    struct Settings
+    {
+        /** @brief Size of a segment file (bytes) */
+        size_t segment_size = 64u * 1024u * 1024u;
+        /** @brief Maximum delay before an appended record is made durable when nobody waits for it */
+        std::chrono::milliseconds group_commit_interval = std::chrono::milliseconds(10);
+        /** @brief Number of filled segments which triggers a compaction (0 = no compaction) */
+        size_t compaction_segments = 8u;
+        /** @brief Retention of the ended transactions, they are dropped by the compaction after this delay */
+        std::chrono::seconds ended_retention = std::chrono::hours(24 * 30);
+    };
+
+    /** @brief Latest state of a transaction */
+    struct TransactionState
+    {
+        /** @brief Charge point identifier */
+        std::string station;
+        /** @brief Transaction id */
+        std::string transaction_id;
+        /** @brief EVSE id (0 = unknown) */
+        int evse_id = 0;
+        /** @brief Connector id within the EVSE (0 = unknown) */
+        int connector_id = 0;
+        /** @brief Id token which authorized the transaction */
+        std::string id_token;
+        /** @brief Timestamp of the first event */
+        std::time_t started = 0;
+        /** @brief Timestamp of the last event */
+        std::time_t updated = 0;
+        /** @brief Timestamp of the Ended event (0 = ongoing) */
+        std::time_t ended = 0;
+        /** @brief Sequence number of the last event */
+        int seq_no = -1;
+        /** @brief Type of the last event */
+        ::ocpp::types::ocpp20::TransactionEventEnumType last_event = ::ocpp::types::ocpp20::TransactionEventEnumType::Started;
+        /** @brief Last reported charging state */
+        ::ocpp::types::Optional<::ocpp::types::ocpp20::ChargingStateEnumType> charging_state;
+        /** @brief Reason of the end of the transaction */
+        ::ocpp::types::Optional<::ocpp::types::ocpp20::ReasonEnumType> stopped_reason;
+        /** @brief Indicate if an active energy register value has been received */
+        bool energy_known = false;
+        /** @brief First active energy register value (Wh) */
+        double energy_start_wh = 0.;
+        /** @brief Last active energy register value (Wh) */
+        double energy_wh = 0.;
+        /** @brief Number of events received */
+        uint32_t event_count = 0;
+    };
+
+    /** @brief Constructor */
+    TransactionJournal();
+    /** @brief Destructor */
+    virtual ~TransactionJournal();
+
+    /**
+     * @brief Open the journal, replay its segments and start a new segment
+     * @param directory Directory of the segment files, created if needed
+     * @param settings Journal settings
+     * @return true if the journal has been opened, false otherwise
+     */
+    bool open(const std::string& directory, const Settings& settings);
+
+    /** @brief Make all the appended records durable and close the journal */
+    void close();
+
+    /** @brief Indicate if the journal is opened */
+    bool isOpen() const;
+
+    /**
+     * @brief Append a TransactionEvent request and update the index
+     * @param station Charge point identifier
+     * @param request TransactionEvent request
+     * @return Sequence number of the record, 0 if the record could not be appended
+     */
+    uint64_t append(const std::string& station, const ::ocpp::messages::ocpp20::TransactionEventReq& request);
+
+    /**
+     * @brief Wait until a record is durable, the wait is shared with all the writers of the same group commit
+     * @param sequence Sequence number of the record
+     * @return true if the record is durable, false if it could not be made durable
+     */
+    bool waitDurable(uint64_t sequence);
+
+    /**
+     * @brief Get the latest state of a transaction
+     * @param station Charge point identifier
+     * @param transaction_id Transaction id
+     * @param state Latest state of the transaction
+     * @return true if the transaction is known, false otherwise
+     */
+    bool find(const std::string& station, const std::string& transaction_id, TransactionState& state) const;
+
+    /** @brief Get the latest state of the ongoing transactions */
+    std::vector<TransactionState> ongoingTransactions() const;
+
+    /** @brief Get the number of transactions in the index */
+    size_t size() const;
+
+    /**
+     * @brief Compact the filled segments now
+     * @return true if the segments have been compacted or if there was nothing to compact, false otherwise
+     */
+    bool compact();
+
+  private:
+    /** @brief Memory-mapped segment file */
+    struct Segment;
+
+    /** @brief Journal settings */
+    Settings m_settings;
+    /** @brief Directory of the segment files */
+    std::string m_directory;
+
+    /** @brief Mutex for the segments, the sequence numbers and the index */
+    mutable std::mutex m_mutex;
+    /** @brief Condition to wake up the flusher thread */
+    std::condition_variable m_flush_cond;
+    /** @brief Condition to notify the writers waiting for their records to be durable */
+    std::condition_variable m_durable_cond;
+    /** @brief Condition to wake up the compaction thread */
+    std::condition_variable m_compaction_cond;
+    /** @brief Serializes the compactions */
+    std::mutex m_compaction_mutex;
+    /** @brief Segment receiving the new records */
+    std::shared_ptr<Segment> m_active;
+    /** @brief Filled segments whose records are not all durable yet */
+    std::vector<std::shared_ptr<Segment>> m_unsynced;
+    /** @brief Ids of the filled and durable segments, in order */
+    std::vector<uint64_t> m_sealed;
+    /** @brief Id of the next segment to create */
+    uint64_t m_next_segment_id;
+    /** @brief Sequence number of the last appended record */
+    uint64_t m_last_sequence;
+    /** @brief Sequence number of the last durable record */
+    uint64_t m_durable_sequence;
+    /** @brief First sequence number of the records lost by the last failed synchronization */
+    uint64_t m_lost_first_sequence;
+    /** @brief Last sequence number of the records lost by the last failed synchronization */
+    uint64_t m_lost_last_sequence;
+    /** @brief Number of writers waiting for their records to be durable */
+    size_t m_waiters;
+    /** @brief Indicate that the records could not be made durable, the appends are rejected until a new segment is started */
+    bool m_failed;
+    /** @brief Indicate that the flusher thread must stop */
+    bool m_stop;
+    /** @brief Latest state of the transactions indexed by charge point identifier and transaction id */
+    std::unordered_map<std::string, TransactionState> m_index;
+    /** @brief Index frozen by the running compaction, m_index then only holds the transactions modified meanwhile */
+    std::unordered_map<std::string, TransactionState> m_frozen_index;
+    /** @brief Flusher thread */
+    std::thread m_flusher;
+    /** @brief Compaction thread */
+    std::thread m_compactor;
+
+    /** @brief Flusher thread, makes the appended records durable */
+    void flusherThread();
+    /** @brief Compaction thread, compacts the filled segments once there are enough of them */
+    void compactionThread();
+    /** @brief Make the appended records durable (mutex must be held, it is released during the synchronization) */
+    void sync(std::unique_lock<std::mutex>& lock);
+    /** @brief Start a new segment after a failed synchronization (mutex must be held) */
+    void recover();
+    /** @brief Compact the filled segments */
+    bool compactSegments();
+    /** @brief Get the state of a transaction to update, it is created if needed (mutex must be held) */
+    TransactionState& updateState(const std::string& station, const std::string& transaction_id);
+    /** @brief Get the state of a transaction, nullptr if it is unknown (mutex must be held) */
+    const TransactionState* findState(const std::string& key) const;
+    /** @brief Create a new segment file */
+    std::shared_ptr<Segment> createSegment(uint64_t id);
+    /** @brief Replay the records of a segment file into the index, returns the last sequence number found */
+    uint64_t replaySegment(const std::string& path);
+    /** @brief Path of a segment file */
+    std::string segmentPath(uint64_t id) const;
+
+    /** @brief Key of a transaction in the index */
+    static std::string indexKey(const std::string& station, const std::string& transaction_id);
+    /** @brief Apply an event to the state of a transaction */
+    static void applyEvent(TransactionState& state, const ::ocpp::messages::ocpp20::TransactionEventReq& request);
+    /** @brief Encode an event record payload */
+    static void encodeEvent(std::string& payload, const std::string& station, const ::ocpp::messages::ocpp20::TransactionEventReq& request);
+    /** @brief Decode an event record payload */
+    static bool decodeEvent(const uint8_t*                                  payload,
+                            size_t                                          size,
+                            std::string&                                    station,
+                            ::ocpp::messages::ocpp20::TransactionEventReq& request);
+    /** @brief Encode a state record payload */
+    static void encodeState(std::string& payload, const TransactionState& state);
+    /** @brief Decode a state record payload */
+    static bool decodeState(const uint8_t* payload, size_t size, TransactionState& state);
+    /** @brief Size of a record in a segment, including its header and its padding */
+    static size_t recordSize(size_t payload_size);
+    /** @brief Write a record : header with the CRC followed by the payload and the padding */
+    static void writeRecord(uint8_t* dest, uint64_t sequence, uint32_t type, const std::string& payload, uint32_t payload_crc);
+};
+
+} // ocpp
+} // os
+
+#endif // OS_TRANSACTION_JOURNAL_H
@@ -0,0 +1,137 @@
+#include "FleetOperation.h"
+
+#include <algorithm>
+
+namespace os {
+namespace ocpp {
+
+const std::vector<int64_t> &FleetOperationReport::latencyBuckets() {
+	static const std::vector<int64_t> buckets = {50, 100, 250, 500, 1000, 2000, 5000};
+	return buckets;
+}
+
+FleetOperation::FleetOperation(uint64_t id,
+										 std::vector<std::string> ids,
+										 std::vector<std::shared_ptr<ChargePoint>> charge_points,
+										 size_t window,
+										 Call call,
+										 ResultHandler on_result,
+										 CompletionHandler on_complete)
+	: m_mutex(),
+	  m_ids(std::move(ids)),
+	  m_charge_points(std::move(charge_points)),
+	  m_window(std::max<size_t>(window, 1u)),
+	  m_call(std::move(call)),
+	  m_on_result(std::move(on_result)),
+	  m_on_complete(std::move(on_complete)),
+	  m_next(0),
+	  m_in_flight(0),
+	  m_delivered(0),
+	  m_start_time(),
+	  m_report() {
+	m_report.operation_id = id;
+	m_report.total = m_ids.size();
+	m_report.latency_histogram.resize(FleetOperationReport::latencyBuckets().size() + 1u, 0);
+}
+
+void FleetOperation::start() {
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_start_time = std::chrono::steady_clock::now();
+	}
+	if (m_ids.empty()) {
+		// Нет станций - операция сразу завершена
+		if (m_on_complete) {
+			m_on_complete(m_report);
+		}
+	}
+	else {
+		launch();
+	}
+}
+
+void FleetOperation::launch() {
+	auto self = shared_from_this();
+	while (true) {
+		size_t index;
+		std::shared_ptr<ChargePoint> charge_point;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if ((m_in_flight >= m_window) || (m_next >= m_ids.size())) {
+				break;
+			}
+			index = m_next++;
+			m_in_flight++;
+
+			// Станция больше не нужна операции после отправки запроса
+			charge_point = std::move(m_charge_points[index]);
+		}
+
+		FleetStationResult result;
+		result.operation_id = m_report.operation_id;
+		result.id = m_ids[index];
+		if (!charge_point) {
+			result.error = "NotConnected";
+			complete(std::move(result));
+			continue;
+		}
+
+		auto sent_time = std::chrono::steady_clock::now();
+		bool sent = m_call(*charge_point, [self, index, sent_time](bool success, const std::string &error, const std::string &error_message) {
+			FleetStationResult result;
+			result.operation_id = self->m_report.operation_id;
+			result.id = self->m_ids[index];
+			result.success = success;
+			result.error = error;
+			result.error_message = error_message;
+			result.latency_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - sent_time).count();
+			if (!success && result.error.empty()) {
+				// Причина отказа не передана RPC
+				result.error = "Failed";
+			}
+			self->complete(std::move(result));
+			self->launch();
+		});
+		if (!sent) {
+			result.error = "NotSent";
+			complete(std::move(result));
+		}
+	}
+}
+
+void FleetOperation::complete(FleetStationResult &&result) {
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_in_flight--;
+		m_report.completed++;
+		if (result.success) {
+			const auto &buckets = FleetOperationReport::latencyBuckets();
+			size_t bucket = std::lower_bound(buckets.begin(), buckets.end(), result.latency_ms) - buckets.begin();
+			m_report.latency_histogram[bucket]++;
+			m_report.succeeded++;
+		}
+		else {
+			m_report.failures[result.error]++;
+			m_report.failed++;
+		}
+		if (m_report.completed == m_report.total) {
+			m_report.duration_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_start_time).count();
+		}
+	}
+
+	// Обработчики вызываются вне блокировки, итоги передаются после последнего результата
+	if (m_on_result) {
+		m_on_result(result);
+	}
+	if ((++m_delivered == m_report.total) && m_on_complete) {
+		FleetOperationReport report;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			report = m_report;
+		}
+		m_on_complete(report);
+	}
+}
+
+} // ocpp
+} // os
@@ -0,0 +1,113 @@
+#ifndef OS_FLEET_OPERATION_H
+#define OS_FLEET_OPERATION_H
+
+#include "ICentralSystem20.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace os {
+namespace ocpp {
+
+// Выбор станций для групповой операции
+struct FleetSelector {
+	enum class Type {
+		All,												// все подключенные станции
+		Ids,												// станции из списка
+		Prefix											// станции, идентификатор которых начинается с префикса
+	};
+
+	Type type = Type::All;
+	std::vector<std::string> ids;					// список станций (Type::Ids)
+	std::string prefix;								// префикс идентификатора (Type::Prefix)
+};
+
+// Результат операции на одной станции
+struct FleetStationResult {
+	uint64_t operation_id = 0;						// Идентификатор операции
+	std::string id;									// Идентификатор станции
+	bool success = false;							// Запрос принят станцией
+	std::string error;								// Причина отказа (NotConnected, NotSent, причина IRpc::RPC_FAILURE_*, код CallError или статус ответа)
+	std::string error_message;						// Текст ошибки
+	int64_t latency_ms = 0;							// Время ответа станции
+};
+
+// Итоги групповой операции
+struct FleetOperationReport {
+	// Границы корзин гистограммы времени ответа, мс (последняя корзина - все что больше)
+	static const std::vector<int64_t> &latencyBuckets();
+
+	uint64_t operation_id = 0;						// Идентификатор операции
+	size_t total = 0;									// Количество выбранных станций
+	size_t completed = 0;							// Количество обработанных станций
+	size_t succeeded = 0;							// Количество успешных ответов
+	size_t failed = 0;								// Количество отказов
+	std::map<std::string, size_t> failures;	// Гистограмма отказов по причине
+	std::vector<size_t> latency_histogram;		// Гистограмма времени ответа успешных запросов
+	int64_t duration_ms = 0;						// Длительность операции
+};
+
+/*
+Групповая операция: один запрос рассылается по выбранным станциям через асинхронный RPC,
+одновременно в работе находится не более window запросов. Каждый ответ запускает
+следующий запрос, поэтому поток вызывающего не блокируется.
+Обработчики вызываются из потоков RPC и не должны блокироваться.
+*/
+class FleetOperation : public std::enable_shared_from_this<FleetOperation> {
+public:
+	using ChargePoint = ::ocpp::centralsystem::ocpp20::ICentralSystem20::IChargePoint20;
+
+	// Завершение запроса на одной станции : принят ли запрос, причина отказа, текст ошибки
+	using CallDone = std::function<void(bool success, const std::string &error, const std::string &error_message)>;
+	// Отправка запроса на одну станцию, false если запрос не отправлен (done не вызывается)
+	using Call = std::function<bool(ChargePoint &charge_point, CallDone done)>;
+	// Результат по каждой станции
+	using ResultHandler = std::function<void(const FleetStationResult &result)>;
+	// Итоги операции, вызывается один раз
+	using CompletionHandler = std::function<void(const FleetOperationReport &report)>;
+
+	FleetOperation(uint64_t id,
+						std::vector<std::string> ids,
+						std::vector<std::shared_ptr<ChargePoint>> charge_points,
+						size_t window,
+						Call call,
+						ResultHandler on_result,
+						CompletionHandler on_complete);
+
+	// Запуск первых запросов
+	void start();
+
+	uint64_t id() const { return m_report.operation_id; }
+
+private:
+	std::mutex m_mutex;
+	std::vector<std::string> m_ids;										// выбранные станции
+	std::vector<std::shared_ptr<ChargePoint>> m_charge_points;		// станции (nullptr - не подключена)
+	size_t m_window;															// максимальное количество запросов в работе
+	Call m_call;
+	ResultHandler m_on_result;
+	CompletionHandler m_on_complete;
+
+	size_t m_next;																// индекс следующей станции
+	size_t m_in_flight;														// запросы в работе
+	std::atomic<size_t> m_delivered;										// результаты, переданные обработчику
+	std::chrono::steady_clock::time_point m_start_time;
+	FleetOperationReport m_report;
+
+	// Отправка запросов, пока окно не заполнено
+	void launch();
+	// Учет результата по станции
+	void complete(FleetStationResult &&result);
+};
+
+} // ocpp
+} // os
+
+#endif // OS_FLEET_OPERATION_H
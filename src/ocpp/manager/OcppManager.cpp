@@ -6,7 +6,7 @@
 namespace os {
 namespace ocpp {
 
-OcppManager::OcppManager() {}
+OcppManager::OcppManager() : m_init(false), m_start(false), m_fleet_operation_id(0) {}
 OcppManager::~OcppManager() {}
 
 bool OcppManager::init(std::string &ocpp_config_path) {
@@ -36,14 +36,16 @@ bool OcppManager::start() {
 	bool result = false;
 	if (m_init) {
 		result = m_central_system->start();
+		m_start = result;
 	}	
 	return result;
 }
 
 bool OcppManager::stop() {
 	bool result = false;
-	if (m_init && !m_start) {
+	if (m_init && m_start) {
 		result = m_central_system->stop();
+		m_start = !result;
 	}
 	return result;
 }
@@ -59,24 +61,21 @@ int OcppManager::getChargePointsCount() {
 std::vector<std::string> OcppManager::getChargePointIds() {
 	std::vector<std::string> result;
 	if (m_start) {
-		auto connected_chargepoints = m_event_handler->chargePoints();
-		for (auto &iter_chargepoint : connected_chargepoints) {
-			auto chargepoint = iter_chargepoint.second->proxy();
-			result.push_back(chargepoint->identifier());
-		}
+		// Обход реестра без копирования списка станций
+		result.reserve(m_event_handler->chargePointsCount());
+		m_event_handler->forEachChargePoint([&result](const std::string &identifier, const auto &) {
+			result.push_back(identifier);
+		});
 	}
 	return result;
 }
 
 std::shared_ptr<::ocpp::centralsystem::ocpp20::ICentralSystem20::IChargePoint20> OcppManager::getChargePointById(const std::string& id) {
-	auto connected_chargepoints = m_event_handler->chargePoints();
-	for (auto &iter_chargepoint : connected_chargepoints) {
-		auto chargepoint = iter_chargepoint.second->proxy();
-		if (chargepoint->identifier() == id) {
-			return chargepoint;
-		}
+	auto handler = m_event_handler->chargePoint(id);
+	if (handler == nullptr) {
+		return nullptr;
 	}
-	return nullptr;
+	return handler->proxy();
 }
 
 bool OcppManager::sendGetBaseReport(const std::string &id) {
@@ -104,13 +103,55 @@ bool OcppManager::sendGetBaseReport(const std::string &id) {
 	return true;
 }
 
+// Статус коннектора для панели : charge / alarm / ok / off
+static std::string connectorStatusName(const StationStateStore::ConnectorSnapshot &connector) {
+	if (!connector.status_known) {
+		return "off";
+	}
+	switch (connector.status) {
+		case ::ocpp::types::ocpp20::ConnectorStatusEnumType::Faulted:
+			return "alarm";
+		case ::ocpp::types::ocpp20::ConnectorStatusEnumType::Unavailable:
+			return "off";
+		case ::ocpp::types::ocpp20::ConnectorStatusEnumType::Occupied:
+			return connector.transaction ? "charge" : "ok";
+		default:
+			return "ok";
+	}
+}
+
 bool OcppManager::getAllStationInfo(const std::string &id, StationInfo &info) {
-	auto charge_point = getChargePointById(id);
+	if (!m_init) {
+		return false;
+	}
 
-	if (charge_point == nullptr) {
+	// Состояние берется из хранилища без запроса к станции
+	StationStateStore::StationSnapshot snapshot;
+	if (!m_event_handler->stationStates().snapshot(id, snapshot)) {
 		return false;
 	}
 
+	double max_power_w = 0.;
+	bool alarm = false;
+	info.connectors.clear();
+	info.connectors.reserve(snapshot.connector_count);
+	for (size_t i = 0; i < snapshot.connector_count; i++) {
+		const auto &connector = snapshot.connectors[i];
+
+		ConnectorInfo connector_info;
+		connector_info.type = "";														// тип коннектора не передается в StatusNotification
+		connector_info.status = connectorStatusName(connector);
+		connector_info.meter = static_cast<float>(connector.energy_wh / 1000.);		// кВт*ч
+		connector_info.power = static_cast<float>(connector.power_w / 1000.);		// кВт
+		info.connectors.push_back(std::move(connector_info));
+
+		max_power_w += connector.power_offered_w;
+		alarm = alarm || (connector.status_known && (connector.status == ::ocpp::types::ocpp20::ConnectorStatusEnumType::Faulted));
+	}
+
+	info.status = !snapshot.connected ? "off" : (alarm ? "alarm" : "ok");
+	info.connector_count = static_cast<int>(snapshot.connector_count);
+	info.max_power = static_cast<int>(max_power_w / 1000.);
 	return true;
 }
 
@@ -231,5 +272,149 @@ bool OcppManager::sendTriggerHeartbit(const std::string& id) {
 	return true;
 }
 
+void OcppManager::takeChangedStations(std::vector<std::string> &ids) {
+	ids.clear();
+	if (m_init) {
+		m_event_handler->stationStates().takeChanges(ids);
+	}
+}
+
+bool OcppManager::queryMeterValues(const std::string &id, int evse_id, const std::string &measurand, const std::string &phase,
+											  std::time_t from, std::time_t to, os::ocpp::MeterValueStore::Resolution resolution,
+											  std::vector<os::ocpp::MeterValueStore::Point> &points) {
+	points.clear();
+	if (!m_init) {
+		return false;
+	}
+
+	::ocpp::types::ocpp20::MeasurandEnumType measurand_value;
+	if (!::ocpp::types::ocpp20::MeasurandEnumTypeHelper.fromString(measurand, measurand_value)) {
+		return false;
+	}
+	::ocpp::types::Optional<::ocpp::types::ocpp20::PhaseEnumType> phase_value;
+	if (!phase.empty()) {
+		::ocpp::types::ocpp20::PhaseEnumType value;
+		if (!::ocpp::types::ocpp20::PhaseEnumTypeHelper.fromString(phase, value)) {
+			return false;
+		}
+		phase_value = value;
+	}
+
+	return m_event_handler->meterValues().query(id, evse_id, measurand_value, phase_value, from, to, resolution, points);
+}
+
+// Асинхронная отправка запроса для групповой операции,
+// check проверяет ответ станции и возвращает причину отказа (пустая строка - запрос принят)
+template <typename RequestType, typename ResponseType>
+static FleetOperation::Call makeFleetCall(RequestType request, std::function<std::string(const ResponseType &)> check) {
+	return [request, check](FleetOperation::ChargePoint &charge_point, FleetOperation::CallDone done) {
+		return charge_point.callAsync(request,
+			FleetOperation::ChargePoint::ResponseHandler<ResponseType>(
+				[check, done](bool received, const ResponseType &response, const std::string &error, const std::string &error_msg) {
+					if (received) {
+						std::string status = check(response);
+						done(status.empty(), status, std::string());
+					}
+					else {
+						done(false, error, error_msg);
+					}
+				}));
+	};
+}
+
+uint64_t OcppManager::startFleetOperation(const FleetSelector &selector, size_t window, FleetOperation::Call call,
+														FleetOperation::ResultHandler on_result, FleetOperation::CompletionHandler on_complete) {
+	if (!m_init) {
+		return 0;
+	}
+
+	// Выбор станций без копирования реестра
+	std::vector<std::string> ids;
+	std::vector<std::shared_ptr<FleetOperation::ChargePoint>> charge_points;
+	if (selector.type == FleetSelector::Type::Ids) {
+		ids.reserve(selector.ids.size());
+		charge_points.reserve(selector.ids.size());
+		for (const auto &id : selector.ids) {
+			ids.push_back(id);
+			charge_points.push_back(getChargePointById(id));
+		}
+	}
+	else {
+		ids.reserve(m_event_handler->chargePointsCount());
+		charge_points.reserve(m_event_handler->chargePointsCount());
+		m_event_handler->forEachChargePoint([&](const std::string &identifier, const auto &handler) {
+			if ((selector.type == FleetSelector::Type::All) || (identifier.compare(0, selector.prefix.size(), selector.prefix) == 0)) {
+				ids.push_back(identifier);
+				charge_points.push_back(handler->proxy());
+			}
+		});
+	}
+
+	uint64_t id = ++m_fleet_operation_id;
+	std::cout << "Fleet operation " << id << " : " << ids.size() << " stations, window = " << window << std::endl;
+
+	auto operation = std::make_shared<FleetOperation>(
+		id, std::move(ids), std::move(charge_points), window, std::move(call), std::move(on_result), std::move(on_complete));
+	operation->start();
+
+	return id;
+}
+
+uint64_t OcppManager::startFleetSetVariables(const FleetSelector &selector, const std::string &component, const std::string &variable, const std::string &attribute,
+															size_t window, FleetOperation::ResultHandler on_result, FleetOperation::CompletionHandler on_complete) {
+	::ocpp::messages::ocpp20::SetVariablesReq set_vars_req;
+	::ocpp::types::ocpp20::SetVariableDataType var;
+
+	var.variable.name.assign(variable);
+	var.component.name.assign(component);
+	var.attributeValue.assign(attribute);
+	set_vars_req.setVariableData.push_back(std::move(var));
+
+	auto call = makeFleetCall<::ocpp::messages::ocpp20::SetVariablesReq, ::ocpp::messages::ocpp20::SetVariablesConf>(
+		std::move(set_vars_req), [](const ::ocpp::messages::ocpp20::SetVariablesConf &response) {
+			for (const auto &result : response.setVariableResult) {
+				if (result.attributeStatus != ::ocpp::types::ocpp20::SetVariableStatusEnumType::Accepted) {
+					return ::ocpp::types::ocpp20::SetVariableStatusEnumTypeHelper.toString(result.attributeStatus);
+				}
+			}
+			return std::string();
+		});
+	return startFleetOperation(selector, window, std::move(call), std::move(on_result), std::move(on_complete));
+}
+
+uint64_t OcppManager::startFleetTriggerMessage(const FleetSelector &selector, ::ocpp::types::ocpp20::MessageTriggerEnumType message,
+															  size_t window, FleetOperation::ResultHandler on_result, FleetOperation::CompletionHandler on_complete) {
+	::ocpp::messages::ocpp20::TriggerMessageReq trigger_msg_req;
+
+	trigger_msg_req.evse.clear();
+	trigger_msg_req.requestedMessage = message;
+
+	auto call = makeFleetCall<::ocpp::messages::ocpp20::TriggerMessageReq, ::ocpp::messages::ocpp20::TriggerMessageConf>(
+		std::move(trigger_msg_req), [](const ::ocpp::messages::ocpp20::TriggerMessageConf &response) {
+			if (response.status != ::ocpp::types::ocpp20::TriggerMessageStatusEnumType::Accepted) {
+				return ::ocpp::types::ocpp20::TriggerMessageStatusEnumTypeHelper.toString(response.status);
+			}
+			return std::string();
+		});
+	return startFleetOperation(selector, window, std::move(call), std::move(on_result), std::move(on_complete));
+}
+
+uint64_t OcppManager::startFleetGetBaseReport(const FleetSelector &selector,
+															 size_t window, FleetOperation::ResultHandler on_result, FleetOperation::CompletionHandler on_complete) {
+	::ocpp::messages::ocpp20::GetBaseReportReq get_base_report_req;
+
+	get_base_report_req.requestId = std::chrono::system_clock::now().time_since_epoch().count();
+	get_base_report_req.reportBase = ::ocpp::types::ocpp20::ReportBaseEnumType::ConfigurationInventory;
+
+	auto call = makeFleetCall<::ocpp::messages::ocpp20::GetBaseReportReq, ::ocpp::messages::ocpp20::GetBaseReportConf>(
+		std::move(get_base_report_req), [](const ::ocpp::messages::ocpp20::GetBaseReportConf &response) {
+			if (response.status != ::ocpp::types::ocpp20::GenericDeviceModelStatusEnumType::Accepted) {
+				return ::ocpp::types::ocpp20::GenericDeviceModelStatusEnumTypeHelper.toString(response.status);
+			}
+			return std::string();
+		});
+	return startFleetOperation(selector, window, std::move(call), std::move(on_result), std::move(on_complete));
+}
+
 } // ocpp
 } // os
\ No newline at end of file
@@ -5,8 +5,10 @@
 
 #include "CentralSystemDemoConfig.h"
 #include "DefaultCentralSystemEventsHandler.h"
+#include "FleetOperation.h"
 #include "ICentralSystem20.h"
 
+#include <atomic>
 #include <cstring>
 #include <experimental/filesystem>
 #include <iostream>
@@ -64,6 +66,23 @@ public:
 	bool sendTriggerHeartbit(const std::string &id);
 
 	bool getAllStationInfo(const std::string &id, StationInfo &info);
+	// Станции, состояние которых изменилось с предыдущего вызова
+	void takeChangedStations(std::vector<std::string> &ids);
+	// Значения счетчиков станции за период : measurand и phase в формате OCPP ("Energy.Active.Import.Register", "L1"),
+	// пустая phase - сумма по фазам. false если значения неизвестны
+	bool queryMeterValues(const std::string &id, int evse_id, const std::string &measurand, const std::string &phase,
+								 std::time_t from, std::time_t to, os::ocpp::MeterValueStore::Resolution resolution,
+								 std::vector<os::ocpp::MeterValueStore::Point> &points);
+
+	// Групповые операции : запрос рассылается асинхронно, не более window запросов одновременно,
+	// результаты по станциям и итоги передаются обработчикам из потоков RPC.
+	// Возвращают идентификатор операции, 0 если операция не запущена
+	uint64_t startFleetSetVariables(const FleetSelector &selector, const std::string &component, const std::string &variable, const std::string &attribute,
+											  size_t window, FleetOperation::ResultHandler on_result, FleetOperation::CompletionHandler on_complete);
+	uint64_t startFleetTriggerMessage(const FleetSelector &selector, ::ocpp::types::ocpp20::MessageTriggerEnumType message,
+												 size_t window, FleetOperation::ResultHandler on_result, FleetOperation::CompletionHandler on_complete);
+	uint64_t startFleetGetBaseReport(const FleetSelector &selector,
+												size_t window, FleetOperation::ResultHandler on_result, FleetOperation::CompletionHandler on_complete);
 
 	// bool reconnect();
 	// bool isInit();
@@ -76,7 +95,12 @@ private:
 	bool m_init;
 	bool m_start;
 
+	std::atomic<uint64_t> m_fleet_operation_id;																		// идентификатор последней групповой операции
+
 	std::shared_ptr<::ocpp::centralsystem::ocpp20::ICentralSystem20::IChargePoint20> getChargePointById(const std::string& id);
+
+	uint64_t startFleetOperation(const FleetSelector &selector, size_t window, FleetOperation::Call call,
+										  FleetOperation::ResultHandler on_result, FleetOperation::CompletionHandler on_complete);
 };
 
 } // ocpp
@@ -0,0 +1,285 @@
+#include "StaticAssetCache.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#endif
+
+#ifdef OS_WEB_WITH_ZLIB
+#include <zlib.h>
+#endif
+
+namespace os {
+namespace web {
+
+StaticAssetCache::StaticAssetCache() : inotify_fd_(-1) {}
+
+StaticAssetCache::~StaticAssetCache() {
+    if (inotify_fd_ >= 0) {
+        close(inotify_fd_);
+    }
+}
+
+bool StaticAssetCache::load(const std::vector<std::string>& roots, bool watch) {
+    root_.clear();
+    for (const auto& root : roots) {
+        struct stat st;
+        if ((stat(root.c_str(), &st) == 0) && S_ISDIR(st.st_mode)) {
+            root_ = root;
+            break;
+        }
+    }
+    if (root_.empty()) {
+        std::cout << "✗ Static files directory not found" << std::endl;
+        return false;
+    }
+
+#ifdef __linux__
+    if (watch && (inotify_fd_ < 0)) {
+        inotify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (inotify_fd_ < 0) {
+            std::cout << "✗ Static files reload disabled: inotify is not available" << std::endl;
+        }
+    }
+#else
+    (void)watch;
+#endif
+
+    assets_.clear();
+    scanDirectory("");
+
+    size_t bytes = 0;
+    size_t gzip_bytes = 0;
+    for (const auto& item : assets_) {
+        bytes += item.second->content->size();
+        gzip_bytes += item.second->gzip_content ? item.second->gzip_content->size() : item.second->content->size();
+    }
+    std::cout << "✓ Static files loaded from " << root_ << ": " << assets_.size() << " files, "
+              << bytes << " bytes (" << gzip_bytes << " bytes compressed)" << std::endl;
+    return true;
+}
+
+std::shared_ptr<const StaticAsset> StaticAssetCache::find(const std::string& uri) const {
+    std::string path = uri.substr(0, uri.find_first_of("?#"));
+    if (path.empty() || (path.back() == '/')) {
+        path += "index.html";
+    }
+    if (path.front() != '/') {
+        path.insert(path.begin(), '/');
+    }
+
+    // Только файлы кэша : пути с ".." никогда не совпадают
+    auto it = assets_.find(path);
+    return (it != assets_.end()) ? it->second : nullptr;
+}
+
+void StaticAssetCache::poll() {
+#ifdef __linux__
+    if (inotify_fd_ < 0) {
+        return;
+    }
+
+    alignas(struct inotify_event) char buffer[4096];
+    while (true) {
+        ssize_t len = read(inotify_fd_, buffer, sizeof(buffer));
+        if (len <= 0) {
+            break;
+        }
+        for (char* ptr = buffer; ptr < buffer + len;) {
+            const auto* event = reinterpret_cast<const struct inotify_event*>(ptr);
+            ptr += sizeof(struct inotify_event) + event->len;
+
+            auto watch = watches_.find(event->wd);
+            if (watch == watches_.end()) {
+                continue;
+            }
+            if (event->mask & IN_IGNORED) {
+                watches_.erase(watch);
+                continue;
+            }
+            if (event->len == 0) {
+                continue;
+            }
+
+            std::string relative = watch->second + "/" + event->name;
+            if (event->mask & IN_ISDIR) {
+                if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
+                    scanDirectory(relative);
+                }
+                else if (event->mask & (IN_DELETE | IN_MOVED_FROM)) {
+                    removeDirectory(relative);
+                }
+            }
+            else if (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) {
+                if (loadFile(relative)) {
+                    std::cout << "✓ Static file reloaded: " << relative << std::endl;
+                }
+            }
+            else if (event->mask & (IN_DELETE | IN_MOVED_FROM)) {
+                assets_.erase(relative);
+                std::cout << "✓ Static file removed: " << relative << std::endl;
+            }
+        }
+    }
+#endif
+}
+
+std::string StaticAssetCache::mimeType(const std::string& path) {
+    std::string extension = path.substr(path.find_last_of(".") + 1);
+
+    static const std::unordered_map<std::string, std::string> mimeTypes = {
+        {"html", "text/html"},
+        {"htm", "text/html"},
+        {"css", "text/css"},
+        {"js", "application/javascript"},
+        {"json", "application/json"},
+        {"png", "image/png"},
+        {"jpg", "image/jpeg"},
+        {"jpeg", "image/jpeg"},
+        {"gif", "image/gif"},
+        {"svg", "image/svg+xml"},
+        {"ico", "image/x-icon"},
+        {"txt", "text/plain"}
+    };
+
+    // Приводим расширение к нижнему регистру
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+    auto it = mimeTypes.find(extension);
+    return it != mimeTypes.end() ? it->second : "text/plain";
+}
+
+void StaticAssetCache::scanDirectory(const std::string& relative) {
+    std::string path = root_ + relative;
+    DIR* dir = opendir(path.c_str());
+    if (!dir) {
+        return;
+    }
+
+#ifdef __linux__
+    if (inotify_fd_ >= 0) {
+        int wd = inotify_add_watch(inotify_fd_, path.c_str(),
+                                   IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF);
+        if (wd >= 0) {
+            watches_[wd] = relative;
+        }
+    }
+#endif
+
+    while (struct dirent* entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if ((name == ".") || (name == "..")) {
+            continue;
+        }
+
+        std::string child = relative + "/" + name;
+        struct stat st;
+        if (stat((root_ + child).c_str(), &st) != 0) {
+            continue;
+        }
+        if (S_ISDIR(st.st_mode)) {
+            scanDirectory(child);
+        }
+        else if (S_ISREG(st.st_mode)) {
+            loadFile(child);
+        }
+    }
+    closedir(dir);
+}
+
+bool StaticAssetCache::loadFile(const std::string& relative) {
+    std::ifstream file(root_ + relative, std::ios::binary);
+    if (!file) {
+        assets_.erase(relative);
+        return false;
+    }
+
+    auto content = std::make_shared<std::string>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    if (file.bad()) {
+        assets_.erase(relative);
+        return false;
+    }
+
+    auto asset = std::make_shared<StaticAsset>();
+    asset->mime_type = mimeType(relative);
+    // HTML всегда проверяется по ETag, остальные файлы кэшируются браузером на час
+    asset->cache_control = (asset->mime_type == "text/html") ? "no-cache" : "public, max-age=3600";
+    asset->etag = makeEtag(*content, "");
+    if (isCompressible(asset->mime_type)) {
+        auto compressed = std::make_shared<std::string>();
+        if (gzip(*content, *compressed) && (compressed->size() < content->size())) {
+            asset->gzip_etag = makeEtag(*content, "-gz");
+            asset->gzip_content = compressed;
+        }
+    }
+    asset->content = content;
+
+    // Отправляемые ответы держат свою копию, замена не влияет на них
+    assets_[relative] = asset;
+    return true;
+}
+
+void StaticAssetCache::removeDirectory(const std::string& relative) {
+    std::string prefix = relative + "/";
+    for (auto it = assets_.begin(); it != assets_.end();) {
+        if (it->first.compare(0, prefix.size(), prefix) == 0) {
+            it = assets_.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+bool StaticAssetCache::isCompressible(const std::string& mime_type) {
+    return (mime_type.compare(0, 5, "text/") == 0) || (mime_type == "application/javascript") ||
+           (mime_type == "application/json") || (mime_type == "image/svg+xml");
+}
+
+bool StaticAssetCache::gzip(const std::string& data, std::string& compressed) {
+#ifdef OS_WEB_WITH_ZLIB
+    z_stream stream = {};
+    // 15 + 16 : формат gzip вместо zlib
+    if (deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 9, Z_DEFAULT_STRATEGY) != Z_OK) {
+        return false;
+    }
+    compressed.resize(deflateBound(&stream, static_cast<uLong>(data.size())));
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = static_cast<uInt>(data.size());
+    stream.next_out = reinterpret_cast<Bytef*>(&compressed[0]);
+    stream.avail_out = static_cast<uInt>(compressed.size());
+    int ret = deflate(&stream, Z_FINISH);
+    compressed.resize(stream.total_out);
+    deflateEnd(&stream);
+    return (ret == Z_STREAM_END);
+#else
+    (void)data;
+    (void)compressed;
+    return false;
+#endif
+}
+
+std::string StaticAssetCache::makeEtag(const std::string& data, const char* suffix) {
+    // FNV-1a 64 бит по содержимому и размер
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : data) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    char etag[64];
+    snprintf(etag, sizeof(etag), "\"%zx-%016llx%s\"", data.size(), static_cast<unsigned long long>(hash), suffix);
+    return etag;
+}
+
+} // namespace web
+} // namespace os
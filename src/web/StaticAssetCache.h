@@ -0,0 +1,74 @@
+#ifndef OS_WEB_STATIC_ASSET_CACHE_H
+#define OS_WEB_STATIC_ASSET_CACHE_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace os {
+namespace web {
+
+// Статический файл в памяти
+struct StaticAsset {
+    std::string mime_type;
+    std::string cache_control;                           // значение заголовка Cache-Control
+    std::string etag;                                    // сильный ETag исходного содержимого
+    std::string gzip_etag;                               // сильный ETag сжатого содержимого
+    std::shared_ptr<const std::string> content;
+    std::shared_ptr<const std::string> gzip_content;     // nullptr если сжатие не уменьшает размер
+};
+
+/*
+Кэш статических файлов : все файлы каталога загружаются в память при старте,
+сжатые варианты и ETag вычисляются один раз при загрузке.
+Изменения файлов отслеживаются через inotify (Linux) и применяются в poll().
+Не потокобезопасен : используется только из потока обработки libwebsockets.
+*/
+class StaticAssetCache {
+public:
+    StaticAssetCache();
+    ~StaticAssetCache();
+
+    StaticAssetCache(const StaticAssetCache&) = delete;
+    StaticAssetCache& operator=(const StaticAssetCache&) = delete;
+
+    // Загрузка первого существующего каталога из списка, watch - отслеживать изменения файлов
+    bool load(const std::vector<std::string>& roots, bool watch);
+
+    // Файл по URI запроса ("/index.html"), nullptr если файла нет
+    std::shared_ptr<const StaticAsset> find(const std::string& uri) const;
+
+    // Применение изменений файлов, не блокирует
+    void poll();
+
+    const std::string& root() const { return root_; }
+    size_t size() const { return assets_.size(); }
+
+    // MIME тип по расширению файла
+    static std::string mimeType(const std::string& path);
+
+private:
+    std::string root_;
+    // Относительный путь ("/css/style.css") -> файл
+    std::unordered_map<std::string, std::shared_ptr<const StaticAsset>> assets_;
+    int inotify_fd_;
+    // Дескриптор наблюдения -> относительный путь каталога
+    std::unordered_map<int, std::string> watches_;
+
+    // Загрузка каталога со всеми подкаталогами
+    void scanDirectory(const std::string& relative);
+    // Загрузка (или перезагрузка) одного файла
+    bool loadFile(const std::string& relative);
+    // Удаление файлов каталога и всех подкаталогов
+    void removeDirectory(const std::string& relative);
+
+    static bool isCompressible(const std::string& mime_type);
+    static bool gzip(const std::string& data, std::string& compressed);
+    static std::string makeEtag(const std::string& data, const char* suffix);
+};
+
+} // namespace web
+} // namespace os
+
+#endif // OS_WEB_STATIC_ASSET_CACHE_H
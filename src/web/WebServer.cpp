@@ -3,6 +3,7 @@
 #include <iostream>
 #include <sstream>
 #include <cstring>
+#include <cstdlib>
 #include <algorithm>
 #include <map>
 #include <fstream>
@@ -60,6 +61,12 @@ const char* get_callback_reason_name(enum lws_callback_reasons reason) {
 // Статическая инициализация протоколов
 struct lws_protocols WebServer::protocols_[3];
 
+// Отправка статического файла, хранится в данных HTTP сессии
+struct HttpTransfer {
+    std::shared_ptr<const std::string> body;   // nullptr - только заголовки (304)
+    size_t offset = 0;
+};
+
 // WebSocketConnection implementation
 WebSocketConnection::WebSocketConnection(lws* wsi, int conn_id) 
     : wsi(wsi), connection_id(conn_id) {}
@@ -70,27 +77,28 @@ void WebSocketConnection::send(const std::string& message) {
 }
 
 void WebSocketConnection::sendBinary(const std::vector<uint8_t>& data) {
-    write_buffer.insert(write_buffer.end(), data.begin(), data.end());
+    write_queue.emplace_back(data.begin(), data.end());
     lws_callback_on_writable(wsi);
 }
 
 void WebSocketConnection::appendToWriteBuffer(const std::string& message) {
-    std::vector<uint8_t> data(message.begin(), message.end());
-    write_buffer.insert(write_buffer.end(), data.begin(), data.end());
-}
-
-std::vector<uint8_t> WebSocketConnection::getWriteBuffer() const {
-    return write_buffer;
+    write_queue.push_back(message);
 }
 
-void WebSocketConnection::clearWriteBuffer() {
-    write_buffer.clear();
+bool WebSocketConnection::popMessage(std::string& message) {
+    if (write_queue.empty()) {
+        return false;
+    }
+    message = std::move(write_queue.front());
+    write_queue.pop_front();
+    return true;
 }
 
 // WebServer implementation
 
 WebServer::WebServer(os::ocpp::OcppManager& manager, int port) 
-    : m_ocpp_manager(manager), context(nullptr), port(port), running(false), next_connection_id(1) {
+    : m_ocpp_manager(manager), context(nullptr), port(port), running(false), next_connection_id(1),
+      fleet_outbox_(std::make_shared<FleetOutbox>()) {
     initializeProtocols();
     initializeValues();
 }
@@ -107,7 +115,7 @@ void WebServer::initializeProtocols() {
     memset(&protocols_[0], 0, sizeof(lws_protocols));
     protocols_[0].name = "http-only";
     protocols_[0].callback = callback_http;
-    protocols_[0].per_session_data_size = 0;
+    protocols_[0].per_session_data_size = sizeof(void*);
     
     // WebSocket протокол - КРИТИЧЕСКИ ВАЖНО!
     memset(&protocols_[1], 0, sizeof(lws_protocols));
@@ -182,6 +190,9 @@ bool WebServer::start() {
         return false;
     }
     
+    // Статические файлы загружаются один раз, изменения подхватываются через inotify
+    asset_cache_.load({"web", "../web", "../../web", "app/web", "../app/web"}, true);
+
     running = true;
     
     std::cout << "✅ Server started successfully on all interfaces!" << std::endl;
@@ -217,6 +228,9 @@ void WebServer::run() {
     int count = 0;
     while (running) {
         lws_service(context, 50);
+        flushFleetOutbox();
+        publishStationChanges();
+        asset_cache_.poll();
         count++;
         
         if (count % 200 == 0) { // Реже выводим сообщения
@@ -267,7 +281,7 @@ int WebServer::callback_http(struct lws* wsi, enum lws_callback_reasons reason,
                 requestUri = "/index.html";
             }
             
-            if (server->serveStaticFile(wsi, requestUri)) {
+            if (server->serveStaticFile(wsi, user, requestUri)) {
                 return 0;
             }
             
@@ -275,6 +289,18 @@ int WebServer::callback_http(struct lws* wsi, enum lws_callback_reasons reason,
             server->sendHttpResponse(wsi, response, 200);
             return 0;
         }
+
+        case LWS_CALLBACK_HTTP_WRITEABLE:
+            return server->writeStaticFile(wsi, user);
+
+        case LWS_CALLBACK_CLOSED_HTTP: {
+            auto* transfer_ptr = static_cast<HttpTransfer**>(user);
+            if (transfer_ptr && *transfer_ptr) {
+                delete *transfer_ptr;
+                *transfer_ptr = nullptr;
+            }
+            break;
+        }
             
         default:
             break;
@@ -310,15 +336,17 @@ int WebServer::callback_websocket(struct lws* wsi, enum lws_callback_reasons rea
         case LWS_CALLBACK_SERVER_WRITEABLE: {
             std::cout << "WebSocket WRITABLE" << std::endl;
             auto* conn_ptr = static_cast<WebSocketConnection**>(user);
-            if (conn_ptr && *conn_ptr) {
-                auto buffer = (*conn_ptr)->getWriteBuffer();
-                if (!buffer.empty()) {
-                    unsigned char* buf = new unsigned char[LWS_PRE + buffer.size()];
-                    memcpy(buf + LWS_PRE, buffer.data(), buffer.size());
-                    lws_write(wsi, buf + LWS_PRE, buffer.size(), LWS_WRITE_TEXT);
-                    delete[] buf;
-                    (*conn_ptr)->clearWriteBuffer();
-                    std::cout << "Data sent to WebSocket" << std::endl;
+            std::string message;
+            if (conn_ptr && *conn_ptr && (*conn_ptr)->popMessage(message)) {
+                unsigned char* buf = new unsigned char[LWS_PRE + message.size()];
+                memcpy(buf + LWS_PRE, message.data(), message.size());
+                lws_write(wsi, buf + LWS_PRE, message.size(), LWS_WRITE_TEXT);
+                delete[] buf;
+                std::cout << "Data sent to WebSocket" << std::endl;
+
+                // Одно сообщение за вызов, остальные при следующей готовности сокета
+                if ((*conn_ptr)->hasPendingMessages()) {
+                    lws_callback_on_writable(wsi);
                 }
             }
             break;
@@ -531,6 +559,7 @@ void WebServer::handleWebSocketClose(struct lws* wsi) {
     }
     
     connections.erase(conn_id);
+    subscriptions_.erase(conn_id);
     std::cout << "WebSocket connection closed: " << conn_id << std::endl;
 }
 
@@ -614,76 +643,119 @@ std::string WebServer::readFile(const std::string& filePath) {
 
 // Метод для определения MIME типа
 std::string WebServer::getMimeType(const std::string& filePath) {
-    std::string extension = filePath.substr(filePath.find_last_of(".") + 1);
-    
-    static std::unordered_map<std::string, std::string> mimeTypes = {
-        {"html", "text/html"},
-        {"htm", "text/html"},
-        {"css", "text/css"},
-        {"js", "application/javascript"},
-        {"json", "application/json"},
-        {"png", "image/png"},
-        {"jpg", "image/jpeg"},
-        {"jpeg", "image/jpeg"},
-        {"gif", "image/gif"},
-        {"svg", "image/svg+xml"},
-        {"ico", "image/x-icon"},
-        {"txt", "text/plain"}
-    };
-    
-    // Приводим расширение к нижнему регистру
-    std::string extLower = extension;
-    std::transform(extLower.begin(), extLower.end(), extLower.begin(), ::tolower);
-    
-    auto it = mimeTypes.find(extLower);
-    return it != mimeTypes.end() ? it->second : "text/plain";
+    return StaticAssetCache::mimeType(filePath);
 }
 
 // Метод для обслуживания статических файлов
-bool WebServer::serveStaticFile(struct lws* wsi, const std::string& uri) {
-    std::string basePath = "web";
-    std::string filePath = basePath + uri;
-
-    std::cout << "Trying to serve static file: " << filePath << std::endl;
+bool WebServer::serveStaticFile(struct lws* wsi, void* user, const std::string& uri) {
+    auto asset = asset_cache_.find(uri);
+    if (!asset) {
+        std::cout << "✗ Static file not found: " << uri << std::endl;
+        return false;
+    }
+    auto** transfer_ptr = static_cast<HttpTransfer**>(user);
+    if (!transfer_ptr) {
+        return false;
+    }
 
-    // Если путь заканчивается на /, добавляем index.html
-    if (filePath.back() == '/')
-    {
-        filePath += "index.html";
+    // Сжатый вариант, если клиент его принимает
+    char header[256];
+    bool use_gzip = false;
+    if (asset->gzip_content && (lws_hdr_copy(wsi, header, sizeof(header), WSI_TOKEN_HTTP_ACCEPT_ENCODING) > 0)) {
+        std::string accept_encoding(header);
+        size_t pos = accept_encoding.find("gzip");
+        use_gzip = (pos != std::string::npos);
+        // "gzip;q=0" - клиент явно отказывается от сжатия
+        if (use_gzip && (accept_encoding.compare(pos, 7, "gzip;q=") == 0)) {
+            use_gzip = (std::strtod(accept_encoding.c_str() + pos + 7, nullptr) > 0.);
+        }
+    }
+    const std::string& etag = use_gzip ? asset->gzip_etag : asset->etag;
+    const auto& body = use_gzip ? asset->gzip_content : asset->content;
+
+    // Файл не изменился : 304 без содержимого
+    bool not_modified = false;
+    if (lws_hdr_copy(wsi, header, sizeof(header), WSI_TOKEN_HTTP_IF_NONE_MATCH) > 0) {
+        std::string if_none_match(header);
+        not_modified = (if_none_match == "*") || (if_none_match.find(asset->etag) != std::string::npos) ||
+                       (!asset->gzip_etag.empty() && (if_none_match.find(asset->gzip_etag) != std::string::npos));
     }
 
-    // Безопасность
-    if (filePath.find("..") != std::string::npos)
-    {
-        std::cout << "Security violation: path contains '..'" << std::endl;
+    unsigned char buffer[LWS_PRE + 1024];
+    unsigned char* start = buffer + LWS_PRE;
+    unsigned char* p = start;
+    unsigned char* end = buffer + sizeof(buffer) - 1;
+    if (not_modified) {
+        if (lws_add_http_header_status(wsi, HTTP_STATUS_NOT_MODIFIED, &p, end)) {
+            return false;
+        }
+    }
+    else if (lws_add_http_common_headers(wsi, HTTP_STATUS_OK, asset->mime_type.c_str(), body->size(), &p, end)) {
+        return false;
+    }
+    if (lws_add_http_header_by_token(wsi, WSI_TOKEN_HTTP_ETAG, reinterpret_cast<const unsigned char*>(etag.c_str()),
+                                     static_cast<int>(etag.length()), &p, end) ||
+        lws_add_http_header_by_token(wsi, WSI_TOKEN_HTTP_CACHE_CONTROL, reinterpret_cast<const unsigned char*>(asset->cache_control.c_str()),
+                                     static_cast<int>(asset->cache_control.length()), &p, end)) {
+        return false;
+    }
+    if (asset->gzip_content) {
+        static const std::string vary = "Accept-Encoding";
+        if (lws_add_http_header_by_token(wsi, WSI_TOKEN_HTTP_VARY, reinterpret_cast<const unsigned char*>(vary.c_str()),
+                                         static_cast<int>(vary.length()), &p, end)) {
+            return false;
+        }
+    }
+    if (use_gzip && !not_modified) {
+        static const std::string encoding = "gzip";
+        if (lws_add_http_header_by_token(wsi, WSI_TOKEN_HTTP_CONTENT_ENCODING, reinterpret_cast<const unsigned char*>(encoding.c_str()),
+                                         static_cast<int>(encoding.length()), &p, end)) {
+            return false;
+        }
+    }
+    if (lws_finalize_write_http_header(wsi, start, &p, end)) {
         return false;
     }
 
-    // Пробуем разные пути
-    std::vector<std::string> pathsToTry = {
-        filePath,
-        "../" + filePath,
-        "../../" + filePath,
-        "app/" + filePath,
-        "../app/" + filePath};
+    // Содержимое отправляется частями по готовности сокета, файл в кэше может быть заменен во время отправки
+    if (!*transfer_ptr) {
+        *transfer_ptr = new HttpTransfer();
+    }
+    (*transfer_ptr)->body = not_modified ? nullptr : body;
+    (*transfer_ptr)->offset = 0;
+    lws_callback_on_writable(wsi);
 
-    for (const auto &path : pathsToTry)
-    {
-        std::cout << "Trying path: " << path << std::endl;
-        std::string content = readFile(path);
-        if (!content.empty())
-        {
-            std::string mimeType = getMimeType(path);
-            std::cout << "✓ Serving: " << path << " (" << content.length() << " bytes)" << std::endl;
+    std::cout << "HTTP " << (not_modified ? 304 : 200) << " " << uri << (use_gzip ? " (gzip)" : "") << std::endl;
+    return true;
+}
+
+int WebServer::writeStaticFile(struct lws* wsi, void* user) {
+    auto** transfer_ptr = static_cast<HttpTransfer**>(user);
+    if (!transfer_ptr || !*transfer_ptr) {
+        return 0;
+    }
+    HttpTransfer* transfer = *transfer_ptr;
 
-            // Отправляем ответ
-            sendHttpResponse(wsi, content, 200, mimeType);
-            return true;
+    if (transfer->body && (transfer->offset < transfer->body->size())) {
+        size_t size = std::min(HTTP_CHUNK_SIZE, transfer->body->size() - transfer->offset);
+        bool last = (transfer->offset + size == transfer->body->size());
+
+        unsigned char buffer[LWS_PRE + HTTP_CHUNK_SIZE];
+        memcpy(buffer + LWS_PRE, transfer->body->data() + transfer->offset, size);
+        if (lws_write(wsi, buffer + LWS_PRE, size, last ? LWS_WRITE_HTTP_FINAL : LWS_WRITE_HTTP) != static_cast<int>(size)) {
+            return -1;
+        }
+        transfer->offset += size;
+        if (!last) {
+            lws_callback_on_writable(wsi);
+            return 0;
         }
     }
 
-    std::cout << "✗ Static file not found: " << filePath << std::endl;
-    return false;
+    // Ответ отправлен : соединение ждет следующий запрос или закрывается
+    delete transfer;
+    *transfer_ptr = nullptr;
+    return lws_http_transaction_completed(wsi) ? -1 : 0;
 }
 
 // Инициализация значений по умолчанию
@@ -888,6 +960,21 @@ void WebServer::sendRpcNotification(const std::string& method, const rapidjson::
     broadcast(notification_json);
 }
 
+// Отправка RPC уведомления одному клиенту
+void WebServer::sendRpcNotification(int connection_id, const std::string& method, const rapidjson::Value& params) {
+    rapidjson::Document doc = createJsonDocument();
+    auto& allocator = doc.GetAllocator();
+    
+    doc.AddMember("jsonrpc", rapidjson::Value().SetString("2.0", allocator), allocator);
+    doc.AddMember("method", rapidjson::Value().SetString(method.c_str(), allocator), allocator);
+    
+    rapidjson::Value params_copy;
+    params_copy.CopyFrom(params, allocator);
+    doc.AddMember("params", params_copy, allocator);
+    
+    sendToConnection(connection_id, jsonToString(doc));
+}
+
 // Широковещательное уведомление об изменении значения
 void WebServer::broadcastValueChange(const std::string& key, const std::string& value) {
     rapidjson::Document doc = createJsonDocument();
@@ -936,6 +1023,10 @@ void WebServer::handleRpcMessage(int connection_id, const std::string& message)
             std::cout << "Handling GetConnectorStatus command" << std::endl;
             result = handleGetConnectorStatus(request.params);
         }
+        else if (request.method == "GetMeterValues") {
+            std::cout << "Handling GetMeterValues command" << std::endl;
+            result = handleGetMeterValues(request.params);
+        }
 
         else if (request.method == "setValue") {
             std::cout << "Handling setValue command" << std::endl;
@@ -969,6 +1060,18 @@ void WebServer::handleRpcMessage(int connection_id, const std::string& message)
             std::cout << "Handling setMaxPower command" << std::endl;
             result = handleSetMaxPower(request.params);
         }
+        else if (request.method == "FleetOperation") {
+            std::cout << "Handling FleetOperation command" << std::endl;
+            result = handleFleetOperation(connection_id, request.params);
+        }
+        else if (request.method == "Subscribe") {
+            std::cout << "Handling Subscribe command" << std::endl;
+            result = handleSubscribe(connection_id, request.params);
+        }
+        else if (request.method == "Unsubscribe") {
+            std::cout << "Handling Unsubscribe command" << std::endl;
+            result = handleUnsubscribe(connection_id, request.params);
+        }
         else {
             std::cout << "Unknown method: " << request.method << std::endl;
             throw std::runtime_error("Unknown method: " + request.method);
@@ -997,12 +1100,6 @@ void WebServer::handleRpcMessage(int connection_id, const std::string& message)
 std::string WebServer::handleGetStations() {    
     std::vector<std::string> charge_points = m_ocpp_manager.getChargePointIds();
 
-    if (charge_points.size() == 0) {
-        for (int i = 0; i < 3; i++) {
-            charge_points.push_back("ST000" + std::to_string(i));
-        }
-    }
-
     rapidjson::Document doc = createJsonDocument();
     auto &allocator = doc.GetAllocator();
     rapidjson::Value arr(rapidjson::kArrayType);
@@ -1025,61 +1122,30 @@ std::string WebServer::handleGetStationStatus(const rapidjson::Value& params) {
 
     std::string station_id = params["station_id"].GetString();
 
-    // Данные
-    std::string station_status = "ok";
-    int connector_count = 2;
-    int max_power = 150;
-
-    if(station_id == "ST0001") {
-        station_status = "alarm";
-        connector_count = 3;
-        max_power = 120;
-    }
-    else if(station_id == "ST0002") {
-        station_status = "off";
-        connector_count = 4;
-        max_power = 180;
+    // Данные из хранилища состояния станций
+    os::ocpp::StationInfo info;
+    if (!m_ocpp_manager.getAllStationInfo(station_id, info)) {
+        throw std::runtime_error("Unknown station: " + station_id);
     }
 
     // JSON
     rapidjson::Document doc = createJsonDocument();
     auto &allocator = doc.GetAllocator();
 
-    doc.AddMember("status", rapidjson::Value(station_status.c_str(), static_cast<rapidjson::SizeType>(station_status.length()), allocator).Move(), allocator);
-    doc.AddMember("connector_count", connector_count, allocator);
-    doc.AddMember("max_power", max_power, allocator);
+    doc.AddMember("status", rapidjson::Value(info.status.c_str(), static_cast<rapidjson::SizeType>(info.status.length()), allocator).Move(), allocator);
+    doc.AddMember("connector_count", info.connector_count, allocator);
+    doc.AddMember("max_power", info.max_power, allocator);
 
     rapidjson::Value connectors(rapidjson::kArrayType);
 
-    for (int i = 0; i < connector_count; i++) {
-        std::string type = "CHADEMO";
-        std::string status = "charge";
-        float meter = 33.1;
-        float power = 22.1;
-        if (i == 1) {
-            type = "CCS2";
-            status = "alarm";
-            meter = 0;
-            power = 0;
-        }
-        else if (i == 2) {
-            type = "GBT";
-            status = "ok";
-            meter = 0;
-            power = 0;
-        }
-        else if (i == 3) {
-            type = "TYPE2";
-            status = "off";
-            meter = 0;
-            power = 0;
-        }
+    for (size_t i = 0; i < info.connectors.size(); i++) {
+        const auto &connector_info = info.connectors[i];
         rapidjson::Value connector(rapidjson::kObjectType);
-        connector.AddMember("id", i + 1, allocator);
-        connector.AddMember("type", rapidjson::Value(type.c_str(), static_cast<rapidjson::SizeType>(type.length()), allocator).Move(), allocator);
-        connector.AddMember("status", rapidjson::Value(status.c_str(), static_cast<rapidjson::SizeType>(status.length()), allocator).Move(), allocator);
-        connector.AddMember("meter", meter, allocator);
-        connector.AddMember("power", power, allocator);
+        connector.AddMember("id", static_cast<int>(i + 1), allocator);
+        connector.AddMember("type", rapidjson::Value(connector_info.type.c_str(), static_cast<rapidjson::SizeType>(connector_info.type.length()), allocator).Move(), allocator);
+        connector.AddMember("status", rapidjson::Value(connector_info.status.c_str(), static_cast<rapidjson::SizeType>(connector_info.status.length()), allocator).Move(), allocator);
+        connector.AddMember("meter", connector_info.meter, allocator);
+        connector.AddMember("power", connector_info.power, allocator);
         connectors.PushBack(connector, allocator);
     }
 
@@ -1099,38 +1165,116 @@ std::string WebServer::handleGetConnectorStatus(const rapidjson::Value& params)
     std::string station_id = params["station_id"].GetString();
     int connector_id = params["connector_id"].GetInt();
 
-    // Данные
-    std::string type = "CHADEMO";
-    std::string status = "charge";
-    float meter = 33.1;
-    float power = 22.1;
-    if (connector_id == 2) {
-        type = "CCS2";
-        status = "alarm";
-        meter = 0;
-        power = 0;
-    }
-    else if (connector_id == 3) {
-        type = "GBT";
-        status = "ok";
-        meter = 0;
-        power = 0;
-    }
-    else if (connector_id == 4) {
-        type = "TYPE2";
-        status = "off";
-        meter = 0;
-        power = 0;
+    // Данные из хранилища состояния станций, коннекторы нумеруются с 1
+    os::ocpp::StationInfo info;
+    if (!m_ocpp_manager.getAllStationInfo(station_id, info)) {
+        throw std::runtime_error("Unknown station: " + station_id);
+    }
+    if ((connector_id < 1) || (connector_id > static_cast<int>(info.connectors.size()))) {
+        throw std::runtime_error("Unknown connector: " + std::to_string(connector_id));
     }
+    const auto &connector_info = info.connectors[connector_id - 1];
 
     // JSON
     rapidjson::Document doc = createJsonDocument();
     auto &allocator = doc.GetAllocator();
 
-    doc.AddMember("status", rapidjson::Value(status.c_str(), static_cast<rapidjson::SizeType>(status.length()), allocator).Move(), allocator);
-    doc.AddMember("type", rapidjson::Value(type.c_str(), static_cast<rapidjson::SizeType>(type.length()), allocator).Move(), allocator);
-    doc.AddMember("meter", meter, allocator);
-    doc.AddMember("power", power, allocator);
+    doc.AddMember("status", rapidjson::Value(connector_info.status.c_str(), static_cast<rapidjson::SizeType>(connector_info.status.length()), allocator).Move(), allocator);
+    doc.AddMember("type", rapidjson::Value(connector_info.type.c_str(), static_cast<rapidjson::SizeType>(connector_info.type.length()), allocator).Move(), allocator);
+    doc.AddMember("meter", connector_info.meter, allocator);
+    doc.AddMember("power", connector_info.power, allocator);
+
+    return jsonToString(doc);
+}
+
+std::string WebServer::handleGetMeterValues(const rapidjson::Value& params) {
+    if (!params.IsObject() || !params.HasMember("station_id") || !params["station_id"].IsString()) {
+        throw std::runtime_error("Invalid parameters: expected object with 'station_id' string");
+    }
+    if (!params.HasMember("evse_id") || !params["evse_id"].IsInt()) {
+        throw std::runtime_error("Invalid parameters: expected object with 'evse_id' int");
+    }
+    if (!params.HasMember("from") || !params["from"].IsInt64() || !params.HasMember("to") || !params["to"].IsInt64()) {
+        throw std::runtime_error("Invalid parameters: expected object with 'from' and 'to' timestamps");
+    }
+
+    std::string station_id = params["station_id"].GetString();
+    int evse_id = params["evse_id"].GetInt();
+    std::time_t from = static_cast<std::time_t>(params["from"].GetInt64());
+    std::time_t to = static_cast<std::time_t>(params["to"].GetInt64());
+    // По умолчанию - показания счетчика энергии, сумма по фазам
+    std::string measurand = "Energy.Active.Import.Register";
+    if (params.HasMember("measurand") && params["measurand"].IsString()) {
+        measurand = params["measurand"].GetString();
+    }
+    std::string phase;
+    if (params.HasMember("phase") && params["phase"].IsString()) {
+        phase = params["phase"].GetString();
+    }
+
+    // raw - значения как получены, 1m и 15m - агрегаты за минуту и за 15 минут
+    std::string resolution_name = "raw";
+    if (params.HasMember("resolution") && params["resolution"].IsString()) {
+        resolution_name = params["resolution"].GetString();
+    }
+    os::ocpp::MeterValueStore::Resolution resolution;
+    std::chrono::seconds max_range;
+    if (resolution_name == "raw") {
+        resolution = os::ocpp::MeterValueStore::Resolution::Raw;
+        max_range = METER_VALUES_MAX_RAW_RANGE;
+    }
+    else if (resolution_name == "1m") {
+        resolution = os::ocpp::MeterValueStore::Resolution::Minute;
+        max_range = METER_VALUES_MAX_MINUTE_RANGE;
+    }
+    else if (resolution_name == "15m") {
+        resolution = os::ocpp::MeterValueStore::Resolution::Quarter;
+        max_range = METER_VALUES_MAX_QUARTER_RANGE;
+    }
+    else {
+        throw std::runtime_error("Invalid parameters: 'resolution' must be 'raw', '1m' or '15m'");
+    }
+
+    // Диапазон ограничен, чтобы запрос не декодировал всю историю серии в потоке веб-сервера
+    if (to < from) {
+        throw std::runtime_error("Invalid parameters: 'to' must not be before 'from'");
+    }
+    if ((to - from) > max_range.count()) {
+        throw std::runtime_error("Invalid parameters: range longer than " + std::to_string(max_range.count()) +
+                                 " s for resolution '" + resolution_name + "'");
+    }
+
+    std::vector<os::ocpp::MeterValueStore::Point> points;
+    if (!m_ocpp_manager.queryMeterValues(station_id, evse_id, measurand, phase, from, to, resolution, points)) {
+        throw std::runtime_error("Unknown meter values: " + station_id + " " + measurand);
+    }
+    if (points.size() > METER_VALUES_MAX_POINTS) {
+        throw std::runtime_error("Too many meter values (" + std::to_string(points.size()) +
+                                 "), reduce the range or use a lower resolution");
+    }
+
+    // JSON : значения в Wh или W
+    rapidjson::Document doc = createJsonDocument();
+    auto &allocator = doc.GetAllocator();
+
+    rapidjson::Value json_points(rapidjson::kArrayType);
+    json_points.Reserve(static_cast<rapidjson::SizeType>(points.size()), allocator);
+    for (const auto &point : points) {
+        rapidjson::Value json_point(rapidjson::kObjectType);
+        json_point.AddMember("timestamp", static_cast<int64_t>(point.timestamp), allocator);
+        if (resolution == os::ocpp::MeterValueStore::Resolution::Raw) {
+            json_point.AddMember("value", point.last, allocator);
+        }
+        else {
+            json_point.AddMember("count", point.count, allocator);
+            json_point.AddMember("min", point.min, allocator);
+            json_point.AddMember("max", point.max, allocator);
+            json_point.AddMember("avg", point.sum / point.count, allocator);
+            json_point.AddMember("last", point.last, allocator);
+        }
+        json_points.PushBack(json_point, allocator);
+    }
+    doc.AddMember("points", json_points, allocator);
 
     return jsonToString(doc);
 }
@@ -1280,5 +1424,439 @@ std::string WebServer::handleSetMaxPower(const rapidjson::Value& params) {
     return "Max power set to " + std::to_string(maxPower) + " kW";
 }
 
+// Групповая операция над станциями : запрос рассылается асинхронно,
+// результаты приходят уведомлениями fleetProgress, итоги - уведомлением fleetCompleted
+std::string WebServer::handleFleetOperation(int connection_id, const rapidjson::Value& params) {
+    if (!params.IsObject() || !params.HasMember("operation") || !params["operation"].IsString()) {
+        throw std::runtime_error("Invalid parameters: expected object with 'operation' string");
+    }
+    std::string operation = params["operation"].GetString();
+
+    // Выбор станций : список, префикс или все
+    os::ocpp::FleetSelector selector;
+    if (params.HasMember("station_ids")) {
+        if (!params["station_ids"].IsArray()) {
+            throw std::runtime_error("Invalid parameters: 'station_ids' must be an array of strings");
+        }
+        selector.type = os::ocpp::FleetSelector::Type::Ids;
+        for (const auto& id : params["station_ids"].GetArray()) {
+            if (!id.IsString()) {
+                throw std::runtime_error("Invalid parameters: 'station_ids' must be an array of strings");
+            }
+            selector.ids.emplace_back(id.GetString(), id.GetStringLength());
+        }
+    }
+    else if (params.HasMember("prefix") && params["prefix"].IsString()) {
+        selector.type = os::ocpp::FleetSelector::Type::Prefix;
+        selector.prefix = params["prefix"].GetString();
+    }
+
+    size_t window = 64;
+    if (params.HasMember("concurrency")) {
+        if (!params["concurrency"].IsInt() || (params["concurrency"].GetInt() < 1)) {
+            throw std::runtime_error("Invalid parameters: 'concurrency' must be a positive integer");
+        }
+        window = static_cast<size_t>(params["concurrency"].GetInt());
+    }
+
+    // Обработчики вызываются из потоков RPC : только складывают результаты,
+    // сервер мог быть уже удален к моменту ответа станций
+    std::weak_ptr<FleetOutbox> weak_outbox = fleet_outbox_;
+    auto on_result = [weak_outbox, connection_id](const os::ocpp::FleetStationResult& result) {
+        auto outbox = weak_outbox.lock();
+        if (outbox) {
+            std::lock_guard<std::mutex> lock(outbox->mutex);
+            outbox->results.push_back({connection_id, result});
+        }
+    };
+    auto on_complete = [weak_outbox, connection_id](const os::ocpp::FleetOperationReport& report) {
+        auto outbox = weak_outbox.lock();
+        if (outbox) {
+            std::lock_guard<std::mutex> lock(outbox->mutex);
+            outbox->reports.push_back({connection_id, report});
+        }
+    };
+
+    uint64_t id = 0;
+    if (operation == "SetVariables") {
+        if (!params.HasMember("component") || !params["component"].IsString() ||
+            !params.HasMember("variable") || !params["variable"].IsString() ||
+            !params.HasMember("value") || !params["value"].IsString()) {
+            throw std::runtime_error("Invalid parameters: expected 'component', 'variable' and 'value' strings");
+        }
+        id = m_ocpp_manager.startFleetSetVariables(selector, params["component"].GetString(), params["variable"].GetString(),
+                                                   params["value"].GetString(), window, on_result, on_complete);
+    }
+    else if (operation == "TriggerMessage") {
+        ::ocpp::types::ocpp20::MessageTriggerEnumType message;
+        if (!params.HasMember("message") || !params["message"].IsString() ||
+            !::ocpp::types::ocpp20::MessageTriggerEnumTypeHelper.fromString(params["message"].GetString(), message)) {
+            throw std::runtime_error("Invalid parameters: expected a valid 'message' to trigger");
+        }
+        id = m_ocpp_manager.startFleetTriggerMessage(selector, message, window, on_result, on_complete);
+    }
+    else if (operation == "GetBaseReport") {
+        id = m_ocpp_manager.startFleetGetBaseReport(selector, window, on_result, on_complete);
+    }
+    else {
+        throw std::runtime_error("Unknown fleet operation: " + operation);
+    }
+    if (id == 0) {
+        throw std::runtime_error("OCPP manager is not initialized");
+    }
+
+    rapidjson::Document doc = createJsonDocument();
+    auto &allocator = doc.GetAllocator();
+    doc.AddMember("operation_id", static_cast<uint64_t>(id), allocator);
+    doc.AddMember("operation", rapidjson::Value(operation.c_str(), static_cast<rapidjson::SizeType>(operation.length()), allocator).Move(), allocator);
+    doc.AddMember("concurrency", static_cast<uint64_t>(window), allocator);
+    return jsonToString(doc);
+}
+
+// Подписка на изменения состояния станций : все станции (all = true) или список station_ids,
+// для каждой станции можно ограничить коннекторы списком connector_ids (нумерация с 1).
+// Ответ содержит полное текущее состояние станций, дальше приходят только изменения уведомлением stationDelta
+std::string WebServer::handleSubscribe(int connection_id, const rapidjson::Value& params) {
+    if (!params.IsObject()) {
+        throw std::runtime_error("Invalid parameters: expected object with 'station_ids' array or 'all' boolean");
+    }
+
+    bool all_stations = params.HasMember("all") && params["all"].IsBool() && params["all"].GetBool();
+    std::vector<std::string> station_ids;
+    if (all_stations) {
+        station_ids = m_ocpp_manager.getChargePointIds();
+    }
+    else {
+        if (!params.HasMember("station_ids") || !params["station_ids"].IsArray()) {
+            throw std::runtime_error("Invalid parameters: expected object with 'station_ids' array or 'all' boolean");
+        }
+        for (const auto& id : params["station_ids"].GetArray()) {
+            if (!id.IsString()) {
+                throw std::runtime_error("Invalid parameters: 'station_ids' must be an array of strings");
+            }
+            station_ids.emplace_back(id.GetString(), id.GetStringLength());
+        }
+    }
+
+    std::set<int> connector_ids;
+    if (params.HasMember("connector_ids")) {
+        if (!params["connector_ids"].IsArray() || all_stations) {
+            throw std::runtime_error("Invalid parameters: 'connector_ids' must be an array of integers and requires 'station_ids'");
+        }
+        for (const auto& id : params["connector_ids"].GetArray()) {
+            if (!id.IsInt() || (id.GetInt() < 1)) {
+                throw std::runtime_error("Invalid parameters: 'connector_ids' must be an array of positive integers");
+            }
+            connector_ids.insert(id.GetInt());
+        }
+    }
+
+    // Неотправленные изменения этих станций сначала уходят текущим подписчикам,
+    // чтобы новый подписчик и остальные получали изменения относительно одного состояния
+    std::unordered_map<int, std::string> messages;
+    for (const auto& station_id : station_ids) {
+        publishStation(station_id, messages);
+    }
+    for (const auto& message : messages) {
+        sendToConnection(message.first, "{\"jsonrpc\":\"2.0\",\"method\":\"stationDelta\",\"params\":{\"stations\":{" + message.second + "}}}");
+    }
+
+    auto& subscription = subscriptions_[connection_id];
+    if (all_stations) {
+        subscription.all_stations = true;
+    }
+    else {
+        for (const auto& station_id : station_ids) {
+            subscription.stations[station_id] = connector_ids;
+        }
+    }
+
+    // Полное состояние станций
+    std::string stations;
+    for (const auto& station_id : station_ids) {
+        auto it = published_states_.find(station_id);
+        if (it == published_states_.end()) {
+            // Других подписчиков нет : опубликованное состояние начинается с ответа
+            os::ocpp::StationInfo info;
+            if (!m_ocpp_manager.getAllStationInfo(station_id, info)) {
+                continue;
+            }
+            it = published_states_.emplace(station_id, std::move(info)).first;
+        }
+        std::string fragment;
+        writeStationDelta(station_id, nullptr, it->second, connector_ids.empty() ? nullptr : &connector_ids, fragment);
+        if (!stations.empty()) {
+            stations += ',';
+        }
+        stations += fragment;
+    }
+    return "{\"stations\":{" + stations + "}}";
+}
+
+// Отмена подписки : все станции (all = true или нет параметров) или список station_ids
+std::string WebServer::handleUnsubscribe(int connection_id, const rapidjson::Value& params) {
+    auto it = subscriptions_.find(connection_id);
+    if (it != subscriptions_.end()) {
+        if (params.IsObject() && params.HasMember("station_ids") && params["station_ids"].IsArray()) {
+            for (const auto& id : params["station_ids"].GetArray()) {
+                if (id.IsString()) {
+                    it->second.stations.erase(std::string(id.GetString(), id.GetStringLength()));
+                }
+            }
+            if (params.HasMember("all") && params["all"].IsBool() && params["all"].GetBool()) {
+                it->second.all_stations = false;
+            }
+        }
+        else {
+            it->second.all_stations = false;
+            it->second.stations.clear();
+        }
+        if (!it->second.all_stations && it->second.stations.empty()) {
+            subscriptions_.erase(it);
+        }
+    }
+    return "Unsubscribed";
+}
+
+void WebServer::publishStationChanges() {
+    auto now = std::chrono::steady_clock::now();
+    if ((now - last_publish_) < PUBLISH_PERIOD) {
+        return;
+    }
+    last_publish_ = now;
+
+    // Изменения накапливаются в хранилище состояния, каждая станция обрабатывается один раз за период
+    std::vector<std::string> station_ids;
+    m_ocpp_manager.takeChangedStations(station_ids);
+    if (station_ids.empty()) {
+        return;
+    }
+
+    // Одно уведомление на подписчика за период
+    std::unordered_map<int, std::string> messages;
+    for (const auto& station_id : station_ids) {
+        publishStation(station_id, messages);
+    }
+    for (const auto& message : messages) {
+        sendToConnection(message.first, "{\"jsonrpc\":\"2.0\",\"method\":\"stationDelta\",\"params\":{\"stations\":{" + message.second + "}}}");
+    }
+}
+
+void WebServer::publishStation(const std::string& station_id, std::unordered_map<int, std::string>& messages) {
+    os::ocpp::StationInfo current;
+    if (!m_ocpp_manager.getAllStationInfo(station_id, current)) {
+        published_states_.erase(station_id);
+        return;
+    }
+
+    auto it = published_states_.find(station_id);
+    const os::ocpp::StationInfo* previous = (it != published_states_.end()) ? &it->second : nullptr;
+
+    // Изменения без фильтра коннекторов общие для всех подписчиков
+    bool interested = false;
+    bool delta_done = false;
+    bool delta_changed = false;
+    std::string delta;
+    for (const auto& item : subscriptions_) {
+        const auto& subscription = item.second;
+        const std::set<int>* connectors = nullptr;
+        if (!subscription.all_stations) {
+            auto station = subscription.stations.find(station_id);
+            if (station == subscription.stations.end()) {
+                continue;
+            }
+            if (!station->second.empty()) {
+                connectors = &station->second;
+            }
+        }
+        interested = true;
+
+        std::string filtered;
+        const std::string* fragment = &delta;
+        if (connectors) {
+            if (!writeStationDelta(station_id, previous, current, connectors, filtered)) {
+                continue;
+            }
+            fragment = &filtered;
+        }
+        else {
+            if (!delta_done) {
+                delta_changed = writeStationDelta(station_id, previous, current, nullptr, delta);
+                delta_done = true;
+            }
+            if (!delta_changed) {
+                continue;
+            }
+        }
+
+        auto& message = messages[item.first];
+        if (!message.empty()) {
+            message += ',';
+        }
+        message += *fragment;
+    }
+
+    // Без подписчиков состояние не хранится, следующий подписчик получит полное состояние
+    if (interested) {
+        published_states_[station_id] = std::move(current);
+    }
+    else if (previous) {
+        published_states_.erase(it);
+    }
+}
+
+bool WebServer::writeStationDelta(const std::string& station_id, const os::ocpp::StationInfo* previous, const os::ocpp::StationInfo& current,
+                                  const std::set<int>* connectors, std::string& fragment) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    bool changed = false;
+
+    writer.StartObject();
+    writer.Key(station_id.c_str(), static_cast<rapidjson::SizeType>(station_id.length()));
+    writer.StartObject();
+    if (!previous || (previous->status != current.status)) {
+        writer.Key("status");
+        writer.String(current.status.c_str(), static_cast<rapidjson::SizeType>(current.status.length()));
+        changed = true;
+    }
+    if (!previous || (previous->connector_count != current.connector_count)) {
+        writer.Key("connector_count");
+        writer.Int(current.connector_count);
+        changed = true;
+    }
+    if (!previous || (previous->max_power != current.max_power)) {
+        writer.Key("max_power");
+        writer.Int(current.max_power);
+        changed = true;
+    }
+
+    // Коннекторы по номеру (с 1), только изменившиеся поля
+    bool connectors_started = false;
+    for (size_t i = 0; i < current.connectors.size(); i++) {
+        int connector_id = static_cast<int>(i + 1);
+        if (connectors && (connectors->count(connector_id) == 0)) {
+            continue;
+        }
+        const auto& connector = current.connectors[i];
+        const os::ocpp::ConnectorInfo* old = (previous && (i < previous->connectors.size())) ? &previous->connectors[i] : nullptr;
+        bool status = !old || (old->status != connector.status);
+        bool type = !old || (old->type != connector.type);
+        bool meter = !old || (old->meter != connector.meter);
+        bool power = !old || (old->power != connector.power);
+        if (!status && !type && !meter && !power) {
+            continue;
+        }
+
+        if (!connectors_started) {
+            writer.Key("connectors");
+            writer.StartObject();
+            connectors_started = true;
+        }
+        std::string key = std::to_string(connector_id);
+        writer.Key(key.c_str(), static_cast<rapidjson::SizeType>(key.length()));
+        writer.StartObject();
+        if (status) {
+            writer.Key("status");
+            writer.String(connector.status.c_str(), static_cast<rapidjson::SizeType>(connector.status.length()));
+        }
+        if (type) {
+            writer.Key("type");
+            writer.String(connector.type.c_str(), static_cast<rapidjson::SizeType>(connector.type.length()));
+        }
+        if (meter) {
+            writer.Key("meter");
+            writer.Double(connector.meter);
+        }
+        if (power) {
+            writer.Key("power");
+            writer.Double(connector.power);
+        }
+        writer.EndObject();
+        changed = true;
+    }
+    if (connectors_started) {
+        writer.EndObject();
+    }
+    writer.EndObject();
+    writer.EndObject();
+
+    // Без внешних скобок : фрагменты станций объединяются в одно уведомление
+    fragment.assign(buffer.GetString() + 1, buffer.GetSize() - 2);
+    return changed;
+}
+
+void WebServer::flushFleetOutbox() {
+    std::vector<FleetOutbox::Result> results;
+    std::vector<FleetOutbox::Report> reports;
+    {
+        std::lock_guard<std::mutex> lock(fleet_outbox_->mutex);
+        results.swap(fleet_outbox_->results);
+        reports.swap(fleet_outbox_->reports);
+    }
+
+    // Одно уведомление на операцию за цикл обработки
+    std::map<std::pair<int, uint64_t>, rapidjson::Document> progress;
+    for (const auto& item : results) {
+        const auto& result = item.result;
+        auto& doc = progress[std::make_pair(item.connection_id, result.operation_id)];
+        auto& allocator = doc.GetAllocator();
+        if (!doc.IsObject()) {
+            doc.SetObject();
+            doc.AddMember("operation_id", static_cast<uint64_t>(result.operation_id), allocator);
+            doc.AddMember("results", rapidjson::Value(rapidjson::kArrayType), allocator);
+        }
+
+        rapidjson::Value value(rapidjson::kObjectType);
+        value.AddMember("station_id", rapidjson::Value(result.id.c_str(), static_cast<rapidjson::SizeType>(result.id.length()), allocator).Move(), allocator);
+        value.AddMember("success", result.success, allocator);
+        if (!result.success) {
+            value.AddMember("error", rapidjson::Value(result.error.c_str(), static_cast<rapidjson::SizeType>(result.error.length()), allocator).Move(), allocator);
+            value.AddMember("error_message", rapidjson::Value(result.error_message.c_str(), static_cast<rapidjson::SizeType>(result.error_message.length()), allocator).Move(), allocator);
+        }
+        value.AddMember("latency_ms", static_cast<int64_t>(result.latency_ms), allocator);
+        doc["results"].PushBack(value, allocator);
+    }
+    for (const auto& item : progress) {
+        sendRpcNotification(item.first.first, "fleetProgress", item.second);
+    }
+
+    for (const auto& item : reports) {
+        const auto& report = item.report;
+        rapidjson::Document doc = createJsonDocument();
+        auto& allocator = doc.GetAllocator();
+
+        doc.AddMember("operation_id", static_cast<uint64_t>(report.operation_id), allocator);
+        doc.AddMember("total", static_cast<uint64_t>(report.total), allocator);
+        doc.AddMember("succeeded", static_cast<uint64_t>(report.succeeded), allocator);
+        doc.AddMember("failed", static_cast<uint64_t>(report.failed), allocator);
+        doc.AddMember("duration_ms", static_cast<int64_t>(report.duration_ms), allocator);
+
+        rapidjson::Value failures(rapidjson::kObjectType);
+        for (const auto& failure : report.failures) {
+            failures.AddMember(rapidjson::Value(failure.first.c_str(), static_cast<rapidjson::SizeType>(failure.first.length()), allocator).Move(),
+                               static_cast<uint64_t>(failure.second), allocator);
+        }
+        doc.AddMember("failures", failures, allocator);
+
+        // Корзины гистограммы : верхняя граница в мс (null для последней) и количество ответов
+        const auto& buckets = os::ocpp::FleetOperationReport::latencyBuckets();
+        rapidjson::Value latency(rapidjson::kArrayType);
+        for (size_t i = 0; i < report.latency_histogram.size(); i++) {
+            rapidjson::Value bucket(rapidjson::kObjectType);
+            if (i < buckets.size()) {
+                bucket.AddMember("le_ms", static_cast<int64_t>(buckets[i]), allocator);
+            }
+            else {
+                bucket.AddMember("le_ms", rapidjson::Value(rapidjson::kNullType), allocator);
+            }
+            bucket.AddMember("count", static_cast<uint64_t>(report.latency_histogram[i]), allocator);
+            latency.PushBack(bucket, allocator);
+        }
+        doc.AddMember("latency_histogram", latency, allocator);
+
+        sendRpcNotification(item.connection_id, "fleetCompleted", doc);
+    }
+}
+
 } // namespace web
 } // namespace os
\ No newline at end of file
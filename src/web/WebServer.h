@@ -2,6 +2,7 @@
 #define OS_WEB_WEBSERVER_H
 
 #include "OcppManager.h"
+#include "StaticAssetCache.h"
 
 #include <libwebsockets.h>
 #include <string>
@@ -13,6 +14,9 @@
 #include <sstream>
 #include <atomic>
 #include <chrono>
+#include <deque>
+#include <mutex>
+#include <set>
 
 // RapidJSON
 #include "json.h"
@@ -52,7 +56,8 @@ class WebSocketConnection {
 private:
     struct lws* wsi;
     int connection_id;
-    std::vector<uint8_t> write_buffer;
+    // Каждое сообщение отправляется отдельным кадром
+    std::deque<std::string> write_queue;
 
 public:
     WebSocketConnection(struct lws* wsi, int conn_id);
@@ -64,8 +69,25 @@ public:
     
     // Для внутреннего использования
     void appendToWriteBuffer(const std::string& message);
-    std::vector<uint8_t> getWriteBuffer() const;
-    void clearWriteBuffer();
+    bool popMessage(std::string& message);
+    bool hasPendingMessages() const { return !write_queue.empty(); }
+};
+
+// Результаты групповых операций приходят из потоков RPC,
+// они копятся здесь и отправляются клиентам из цикла обработки сервера
+struct FleetOutbox {
+    struct Result {
+        int connection_id;
+        os::ocpp::FleetStationResult result;
+    };
+    struct Report {
+        int connection_id;
+        os::ocpp::FleetOperationReport report;
+    };
+
+    std::mutex mutex;
+    std::vector<Result> results;
+    std::vector<Report> reports;
 };
 
 class WebServer {
@@ -88,6 +110,32 @@ private:
     std::unordered_map<std::string, std::string> values_;
     std::atomic<int> request_counter_;
     std::chrono::steady_clock::time_point start_time_;
+
+    // Групповые операции (разделяется с обработчиками, которые могут пережить сервер)
+    std::shared_ptr<FleetOutbox> fleet_outbox_;
+
+    // Статические файлы
+    StaticAssetCache asset_cache_;
+    // Размер части файла за один вызов LWS_CALLBACK_HTTP_WRITEABLE
+    static constexpr size_t HTTP_CHUNK_SIZE = 16u * 1024u;
+
+    // Подписки на изменения состояния станций
+    struct StationSubscription {
+        bool all_stations = false;                                      // все станции
+        std::unordered_map<std::string, std::set<int>> stations;      // станция -> коннекторы (пусто - все коннекторы)
+    };
+    std::unordered_map<int, StationSubscription> subscriptions_;
+    // Последнее отправленное подписчикам состояние станций, изменения считаются относительно него
+    std::unordered_map<std::string, os::ocpp::StationInfo> published_states_;
+    std::chrono::steady_clock::time_point last_publish_;
+    // Период объединения изменений
+    static constexpr std::chrono::milliseconds PUBLISH_PERIOD = std::chrono::milliseconds(250);
+
+    // Ограничения запроса показаний счетчика : длительность диапазона для каждого разрешения и число точек в ответе
+    static constexpr std::chrono::seconds METER_VALUES_MAX_RAW_RANGE = std::chrono::hours(24);
+    static constexpr std::chrono::seconds METER_VALUES_MAX_MINUTE_RANGE = std::chrono::hours(24 * 7);
+    static constexpr std::chrono::seconds METER_VALUES_MAX_QUARTER_RANGE = std::chrono::hours(24 * 93);
+    static constexpr size_t METER_VALUES_MAX_POINTS = 100000u;
     
     // Системные метрики
     struct SystemMetrics {
@@ -129,8 +177,10 @@ private:
     // Метод для определения MIME типа
     std::string getMimeType(const std::string &filePath);
 
-    // Метод для обслуживания статических файлов
-    bool serveStaticFile(struct lws *wsi, const std::string &uri);
+    // Метод для обслуживания статических файлов из кэша : заголовки сразу, содержимое частями из LWS_CALLBACK_HTTP_WRITEABLE
+    bool serveStaticFile(struct lws *wsi, void *user, const std::string &uri);
+    // Отправка следующей части статического файла, -1 если соединение нужно закрыть
+    int writeStaticFile(struct lws *wsi, void *user);
 
     // RPC методы
     void handleRpcMessage(int connection_id, const std::string &message);
@@ -141,6 +191,7 @@ private:
     void sendRpcResponse(int connection_id, int request_id, const rapidjson::Value &result);
     void sendRpcError(int connection_id, int request_id, const std::string &error);
     void sendRpcNotification(const std::string &method, const rapidjson::Value &params);
+    void sendRpcNotification(int connection_id, const std::string &method, const rapidjson::Value &params);
     void broadcastValueChange(const std::string &key, const std::string &value);
 
     // RPC команды
@@ -148,6 +199,7 @@ private:
     std::string handleGetStations();
     std::string handleGetStationStatus(const rapidjson::Value &params);
     std::string handleGetConnectorStatus(const rapidjson::Value &params);
+    std::string handleGetMeterValues(const rapidjson::Value &params);
     std::string handleSetValue(const rapidjson::Value &params);
     std::string handleGetValues(const rapidjson::Value &params);
     std::string handleGetMetrics(const rapidjson::Value &params);
@@ -155,6 +207,20 @@ private:
     std::string handleStopCharging(const rapidjson::Value &params);
     std::string handleResetSystem(const rapidjson::Value &params);
     std::string handleSetMaxPower(const rapidjson::Value &params);
+    std::string handleFleetOperation(int connection_id, const rapidjson::Value &params);
+    std::string handleSubscribe(int connection_id, const rapidjson::Value &params);
+    std::string handleUnsubscribe(int connection_id, const rapidjson::Value &params);
+
+    // Отправка изменений состояния станций подписчикам, не чаще PUBLISH_PERIOD
+    void publishStationChanges();
+    // Отправка изменений одной станции и обновление опубликованного состояния
+    void publishStation(const std::string &station_id, std::unordered_map<int, std::string> &messages);
+    // Изменения станции в компактном JSON (только изменившиеся поля), false если изменений нет
+    static bool writeStationDelta(const std::string &station_id, const os::ocpp::StationInfo *previous, const os::ocpp::StationInfo &current,
+                                  const std::set<int> *connectors, std::string &fragment);
+
+    // Отправка накопленных результатов групповых операций, объединенных по операции
+    void flushFleetOutbox();
 
     // Вспомогательные методы
     void initializeValues();